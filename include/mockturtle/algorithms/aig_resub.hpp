@@ -758,9 +758,8 @@ void aig_resubstitution( Ntk& ntk, resubstitution_params const& ps = {}, resubst
   depth_view<Ntk> depth_view{ntk};
   resub_view_t resub_view{depth_view};
 
-  if ( ps.max_pis == 8 )
-  {
-    using truthtable_t = kitty::static_truth_table<8u>;
+  detail::with_window_truth_table( ps.max_pis, [&]( auto tt ) {
+    using truthtable_t = decltype( tt );
     using truthtable_dc_t = kitty::dynamic_truth_table;
     using resub_impl_t = detail::resubstitution_impl<resub_view_t, typename detail::window_based_resub_engine<resub_view_t, truthtable_t, truthtable_dc_t, aig_resub_functor<resub_view_t, typename detail::window_simulator<resub_view_t, truthtable_t>, truthtable_dc_t>>>;
 
@@ -782,32 +781,7 @@ void aig_resubstitution( Ntk& ntk, resubstitution_params const& ps = {}, resubst
     {
       *pst = st;
     }
-  }
-  else
-  {
-    using truthtable_t = kitty::dynamic_truth_table;
-    using truthtable_dc_t = kitty::dynamic_truth_table;
-    using resub_impl_t = detail::resubstitution_impl<resub_view_t, typename detail::window_based_resub_engine<resub_view_t, truthtable_t, truthtable_dc_t, aig_resub_functor<resub_view_t, typename detail::window_simulator<resub_view_t, truthtable_t>, truthtable_dc_t>>>;
-
-    resubstitution_stats st;
-    typename resub_impl_t::engine_st_t engine_st;
-    typename resub_impl_t::collector_st_t collector_st;
-
-    resub_impl_t p( resub_view, ps, st, engine_st, collector_st );
-    p.run();
-
-    if ( ps.verbose )
-    {
-      st.report();
-      collector_st.report();
-      engine_st.report();
-    }
-
-    if ( pst )
-    {
-      *pst = st;
-    }
-  }
+  } );
 }
 
 } /* namespace mockturtle */
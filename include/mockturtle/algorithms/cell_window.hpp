@@ -35,7 +35,6 @@
 #include <array>
 #include <memory>
 #include <optional>
-#include <unordered_set>
 #include <vector>
 
 #include "../networks/detail/foreach.hpp"
@@ -92,6 +91,11 @@ public:
   std::vector<node<Ntk>> _index_to_node;
   spp::sparse_hash_map<node<Ntk>, uint32_t> _node_to_index;
 
+  /* scratch buffers reused across calls to compute_window_for */
+  std::vector<node<Ntk>> _pivot_gates;
+  std::vector<node<Ntk>> _candidates;
+  spp::sparse_hash_set<node<Ntk>> _inputs;
+
   uint32_t _num_constants{1u};
   uint32_t _max_gates{};
   bool _has_mapping{true};
@@ -126,6 +130,7 @@ public:
 
     assert( Ntk::has_mapping() );
     _storage->_max_gates = max_gates;
+    _storage->_pivot_gates.reserve( max_gates );
   }
 
   bool compute_window_for( node const& pivot )
@@ -139,8 +144,8 @@ public:
     _storage->_nodes.clear();
     _storage->_gates.clear();
 
-    std::vector<node> gates;
-    gates.reserve( _storage->_max_gates );
+    auto& gates = _storage->_pivot_gates;
+    gates.clear();
     collect_mffc( pivot, gates );
     add_node( pivot, gates );
 
@@ -337,8 +342,10 @@ private:
       } );
     }
 
-    std::vector<node> candidates;
-    std::unordered_set<node> inputs;
+    auto& candidates = _storage->_candidates;
+    auto& inputs = _storage->_inputs;
+    candidates.clear();
+    inputs.clear();
 
     do
     {
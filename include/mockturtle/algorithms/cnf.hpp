@@ -324,6 +324,100 @@ node_map<lit_t, Ntk> node_literals( Ntk const& ntk, std::optional<uint32_t> cons
 namespace detail
 {
 
+/* adds the clauses of gate `n`, `child_lits` is used as scratch space */
+template<class Ntk, typename lit_t, class ClauseFn>
+void generate_gate_cnf( Ntk const& ntk, node<Ntk> const& n, node_map<lit_t, Ntk> const& node_lits, std::vector<lit_t>& child_lits, ClauseFn&& fn )
+{
+  child_lits.clear();
+  ntk.foreach_fanin( n, [&]( auto const& f ) {
+    child_lits.push_back( lit_not_cond( node_lits[f], ntk.is_complemented( f ) ) );
+  } );
+  lit_t node_lit = node_lits[n];
+
+  if constexpr ( has_is_and_v<Ntk> )
+  {
+    if ( ntk.is_and( n ) )
+    {
+      detail::on_and( node_lit, child_lits[0], child_lits[1], fn );
+      return;
+    }
+  }
+
+  if constexpr ( has_is_or_v<Ntk> )
+  {
+    if ( ntk.is_or( n ) )
+    {
+      detail::on_or( node_lit, child_lits[0], child_lits[1], fn );
+      return;
+    }
+  }
+
+  if constexpr ( has_is_xor_v<Ntk> )
+  {
+    if ( ntk.is_xor( n ) )
+    {
+      detail::on_xor( node_lit, child_lits[0], child_lits[1], fn );
+      return;
+    }
+  }
+
+  if constexpr ( has_is_maj_v<Ntk> )
+  {
+    if ( ntk.is_maj( n ) )
+    {
+      detail::on_maj( node_lit, child_lits[0], child_lits[1], child_lits[2], fn );
+      return;
+    }
+  }
+
+  if constexpr ( has_is_ite_v<Ntk> )
+  {
+    if ( ntk.is_ite( n ) )
+    {
+      detail::on_ite( node_lit, child_lits[0], child_lits[1], child_lits[2], fn );
+      return;
+    }
+  }
+
+  if constexpr ( has_is_xor3_v<Ntk> )
+  {
+    if ( ntk.is_xor3( n ) )
+    {
+      detail::on_xor3( node_lit, child_lits[0], child_lits[1], child_lits[2], fn );
+      return;
+    }
+  }
+
+  if constexpr ( has_is_nary_and_v<Ntk> )
+  {
+    if ( ntk.is_nary_and( n ) )
+    {
+      fmt::print( "[e] nary-AND not yet supported in generate_cnf" );
+      std::abort();
+    }
+  }
+
+  if constexpr ( has_is_nary_or_v<Ntk> )
+  {
+    if ( ntk.is_nary_or( n ) )
+    {
+      fmt::print( "[e] nary-OR not yet supported in generate_cnf" );
+      std::abort();
+    }
+  }
+  if constexpr ( has_is_nary_xor_v<Ntk> )
+  {
+    if ( ntk.is_nary_xor( n ) )
+    {
+      fmt::print( "[e] nary-XOR not yet supported in generate_cnf" );
+      std::abort();
+    }
+  }
+
+  /* general case */
+  detail::on_function( node_lit, child_lits, ntk.node_function( n ), fn );
+}
+
 template<class Ntk, typename lit_t>
 class generate_cnf_impl
 {
@@ -342,95 +436,7 @@ public:
 
     /* compute clauses for nodes */
     ntk_.foreach_gate( [&]( auto const& n ) {
-      std::vector<lit_t> child_lits;
-      ntk_.foreach_fanin( n, [&]( auto const& f ) {
-        child_lits.push_back( lit_not_cond( node_lits_[f], ntk_.is_complemented( f ) ) );
-      } );
-      lit_t node_lit = node_lits_[n];
-
-      if constexpr ( has_is_and_v<Ntk> )
-      {
-        if ( ntk_.is_and( n ) )
-        {
-          detail::on_and( node_lit, child_lits[0], child_lits[1], fn_ );
-          return true;
-        }
-      }
-
-      if constexpr ( has_is_or_v<Ntk> )
-      {
-        if ( ntk_.is_or( n ) )
-        {
-          detail::on_or( node_lit, child_lits[0], child_lits[1], fn_ );
-          return true;
-        }
-      }
-
-      if constexpr ( has_is_xor_v<Ntk> )
-      {
-        if ( ntk_.is_xor( n ) )
-        {
-          detail::on_xor( node_lit, child_lits[0], child_lits[1], fn_ );
-          return true;
-        }
-      }
-
-      if constexpr ( has_is_maj_v<Ntk> )
-      {
-        if ( ntk_.is_maj( n ) )
-        {
-          detail::on_maj( node_lit, child_lits[0], child_lits[1], child_lits[2], fn_ );
-          return true;
-        }
-      }
-
-      if constexpr ( has_is_ite_v<Ntk> )
-      {
-        if ( ntk_.is_ite( n ) )
-        {
-          detail::on_ite( node_lit, child_lits[0], child_lits[1], child_lits[2], fn_ );
-          return true;
-        }
-      }
-
-      if constexpr ( has_is_xor3_v<Ntk> )
-      {
-        if ( ntk_.is_xor3( n ) )
-        {
-          detail::on_xor3( node_lit, child_lits[0], child_lits[1], child_lits[2], fn_ );
-          return true;
-        }
-      }
-
-      if constexpr ( has_is_nary_and_v<Ntk> )
-      {
-        if ( ntk_.is_nary_and( n ) )
-        {
-          fmt::print( "[e] nary-AND not yet supported in generate_cnf" );
-          std::abort();
-        }
-      }
-
-      if constexpr ( has_is_nary_or_v<Ntk> )
-      {
-        if ( ntk_.is_nary_or( n ) )
-        {
-          fmt::print( "[e] nary-OR not yet supported in generate_cnf" );
-          std::abort();
-        }
-      }
-      if constexpr ( has_is_nary_xor_v<Ntk> )
-      {
-        if ( ntk_.is_nary_xor( n ) )
-        {
-          fmt::print( "[e] nary-XOR not yet supported in generate_cnf" );
-          std::abort();
-        }
-      }
-
-      /* general case */
-      detail::on_function( node_lit, child_lits, ntk_.node_function( n ), fn_ );
-      return true;
+      detail::generate_gate_cnf( ntk_, n, node_lits_, child_lits_, fn_ );
     } );
 
     std::vector<lit_t> output_lits;
@@ -446,6 +452,7 @@ private:
   clause_callback_t<lit_t> const& fn_;
 
   node_map<lit_t, Ntk> node_lits_;
+  std::vector<lit_t> child_lits_;
 };
 
 } // namespace detail
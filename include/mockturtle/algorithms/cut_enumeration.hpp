@@ -32,11 +32,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstdint>
 #include <iostream>
+#include <iterator>
 #include <optional>
+#include <utility>
 #include <vector>
 
 #include <kitty/constructors.hpp>
@@ -124,6 +127,9 @@ struct network_cuts;
 template<typename Ntk, bool ComputeTruth = false, typename CutData = empty_cut_data>
 network_cuts<Ntk, ComputeTruth, CutData> cut_enumeration( Ntk const& ntk, cut_enumeration_params const& ps = {}, cut_enumeration_stats * pst = nullptr );
 
+template<typename Ntk, bool ComputeTruth = false, typename CutData = empty_cut_data>
+class incremental_network_cuts;
+
 /* function to update a cut */
 template<typename CutData>
 struct cut_enumeration_update_cut
@@ -246,7 +252,18 @@ private:
   template<typename _Ntk, bool _ComputeTruth, typename _CutData>
   friend network_cuts<_Ntk, _ComputeTruth, _CutData> cut_enumeration( _Ntk const& ntk, cut_enumeration_params const& ps, cut_enumeration_stats * pst );
 
+  template<typename _Ntk, bool _ComputeTruth, typename _CutData>
+  friend class incremental_network_cuts;
+
 private:
+  void resize( uint32_t size )
+  {
+    if ( size > _cuts.size() )
+    {
+      _cuts.resize( size );
+    }
+  }
+
   void add_zero_cut( uint32_t index )
   {
     auto& cut = _cuts[index].add_cut( &index, &index ); /* fake iterator for emptyness */
@@ -304,33 +321,42 @@ public:
     stopwatch t( st.time_total );
 
     ntk.foreach_node( [this]( auto node ) {
-      const auto index = ntk.node_to_index( node );
+      compute_cuts( node );
+    } );
+  }
 
-      if ( ps.very_verbose )
-      {
-        std::cout << fmt::format( "[i] compute cut for node at index {}\n", index );
-      }
+  /* computes the cuts of a single node, assuming that the cuts of its
+   * fanins have been computed */
+  void compute_cuts( node<Ntk> const& node )
+  {
+    const auto index = ntk.node_to_index( node );
 
-      if ( ntk.is_constant( node ) )
-      {
-        cuts.add_zero_cut( index );
-      }
-      else if ( ntk.is_pi( node ) )
+    if ( ps.very_verbose )
+    {
+      std::cout << fmt::format( "[i] compute cut for node at index {}\n", index );
+    }
+
+    if ( ntk.is_constant( node ) )
+    {
+      cuts._cuts[index].clear();
+      cuts.add_zero_cut( index );
+    }
+    else if ( ntk.is_pi( node ) )
+    {
+      cuts._cuts[index].clear();
+      cuts.add_unit_cut( index );
+    }
+    else
+    {
+      if constexpr ( Ntk::min_fanin_size == 2 && Ntk::max_fanin_size == 2 )
       {
-        cuts.add_unit_cut( index );
+        merge_cuts2( index );
       }
       else
       {
-        if constexpr ( Ntk::min_fanin_size == 2 && Ntk::max_fanin_size == 2 )
-        {
-          merge_cuts2( index );
-        }
-        else
-        {
-          merge_cuts( index );
-        }
+        merge_cuts( index );
       }
-    } );
+    }
   }
 
 private:
@@ -513,6 +539,10 @@ private:
       /* limit the maximum number of cuts */
       rcuts.limit( ps.cut_limit - 1 );
     }
+    else
+    {
+      rcuts.clear();
+    }
 
     cuts._total_cuts += static_cast<uint32_t>( rcuts.size() );
 
@@ -606,6 +636,260 @@ network_cuts<Ntk, ComputeTruth, CutData> cut_enumeration( Ntk const& ntk, cut_en
   return res;
 }
 
+/*! \brief Incremental cut database for a network.
+ *
+ * This data structure computes all cuts of a network as `cut_enumeration`
+ * does, and then keeps them up-to-date while the network is modified.  It
+ * subscribes to the network events: added, modified, and deleted nodes are
+ * marked, and a call to `update` re-enumerates the cuts of marked nodes.  If
+ * the cut set of a node changes, its fanouts are re-enumerated as well;
+ * propagation stops at nodes whose cut sets remain the same.
+ *
+ * Changes are detected based on the leaves of the cuts (and the truth tables
+ * if `ComputeTruth` is true).  Cut data that depends on other properties of
+ * the network, e.g., the fanout size, is only recomputed for re-enumerated
+ * nodes.
+ *
+ * **Required network functions:**
+ * - `events`
+ * - `foreach_fanout`
+ * - all functions required by `cut_enumeration`
+ *
+   \verbatim embed:rst
+
+   Example
+
+   .. code-block:: c++
+
+      fanout_view<aig_network> aig{...};
+      incremental_network_cuts<fanout_view<aig_network>> cuts( aig );
+
+      aig.substitute_node( n, f );
+      cuts.update();
+
+      auto const& cut_set = cuts.cuts( aig.node_to_index( m ) );
+   \endverbatim
+ */
+template<typename Ntk, bool ComputeTruth, typename CutData>
+class incremental_network_cuts
+{
+public:
+  using network_cuts_t = network_cuts<Ntk, ComputeTruth, CutData>;
+  using cut_t = typename network_cuts_t::cut_t;
+  using cut_set_t = typename network_cuts_t::cut_set_t;
+
+public:
+  explicit incremental_network_cuts( Ntk const& ntk, cut_enumeration_params const& ps = {} )
+      : ntk( ntk ),
+        ps( ps ),
+        _cuts( ntk.size() ),
+        _impl( ntk, this->ps, st, _cuts ),
+        _dirty( ntk.size(), false )
+  {
+    static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
+    static_assert( has_is_constant_v<Ntk>, "Ntk does not implement the is_constant method" );
+    static_assert( has_is_pi_v<Ntk>, "Ntk does not implement the is_pi method" );
+    static_assert( has_size_v<Ntk>, "Ntk does not implement the size method" );
+    static_assert( has_get_node_v<Ntk>, "Ntk does not implement the get_node method" );
+    static_assert( has_foreach_node_v<Ntk>, "Ntk does not implement the foreach_node method" );
+    static_assert( has_foreach_fanin_v<Ntk>, "Ntk does not implement the foreach_fanin method" );
+    static_assert( has_foreach_fanout_v<Ntk>, "Ntk does not implement the foreach_fanout method" );
+    static_assert( has_node_to_index_v<Ntk>, "Ntk does not implement the node_to_index method" );
+    static_assert( !ComputeTruth || has_compute_v<Ntk, kitty::dynamic_truth_table>, "Ntk does not implement the compute method for kitty::dynamic_truth_table" );
+
+    _impl.run();
+
+    auto& events = ntk.events();
+    event_ptr[0] = events.on_add.size();
+    events.on_add.emplace_back( [this]( auto const& n ) {
+      mark( n );
+    } );
+    event_ptr[1] = events.on_modified.size();
+    events.on_modified.emplace_back( [this]( auto const& n, auto const& previous ) {
+      (void)previous;
+      mark( n );
+    } );
+    event_ptr[2] = events.on_delete.size();
+    events.on_delete.emplace_back( [this]( auto const& n ) {
+      mark( n );
+    } );
+  }
+
+  incremental_network_cuts( incremental_network_cuts const& ) = delete;
+  incremental_network_cuts& operator=( incremental_network_cuts const& ) = delete;
+
+  ~incremental_network_cuts()
+  {
+    auto& events = ntk.events();
+    events.on_add.erase( events.on_add.begin() + event_ptr[0] );
+    events.on_modified.erase( events.on_modified.begin() + event_ptr[1] );
+    events.on_delete.erase( events.on_delete.begin() + event_ptr[2] );
+  }
+
+  /*! \brief Re-enumerates the cuts of all modified nodes.
+   *
+   * \return Number of nodes for which cuts were re-enumerated
+   */
+  uint32_t update()
+  {
+    uint32_t count{0u};
+    while ( !_worklist.empty() )
+    {
+      const auto n = _worklist.back();
+      _worklist.pop_back();
+      recompute( n, count );
+    }
+    return count;
+  }
+
+  /*! \brief Checks whether there are nodes whose cuts are outdated. */
+  bool is_up_to_date() const
+  {
+    return _worklist.empty();
+  }
+
+  /*! \brief Returns the cut set of a node */
+  cut_set_t const& cuts( uint32_t node_index ) const { return _cuts.cuts( node_index ); }
+
+  /*! \brief Returns the truth table of a cut */
+  template<bool enabled = ComputeTruth, typename = std::enable_if_t<std::is_same_v<Ntk, Ntk> && enabled>>
+  auto truth_table( cut_t const& cut ) const
+  {
+    return _cuts.truth_table( cut );
+  }
+
+  /*! \brief Returns the number of nodes for which cuts are computed */
+  auto nodes_size() const
+  {
+    return _cuts.nodes_size();
+  }
+
+  /*! \brief Returns the underlying cut database. */
+  network_cuts_t const& database() const
+  {
+    return _cuts;
+  }
+
+private:
+  void mark( node<Ntk> const& n )
+  {
+    const auto index = ntk.node_to_index( n );
+    if ( index >= _dirty.size() )
+    {
+      _dirty.resize( ntk.size(), false );
+      _cuts.resize( ntk.size() );
+    }
+
+    if ( !_dirty[index] )
+    {
+      _dirty[index] = true;
+      _worklist.push_back( n );
+    }
+  }
+
+  void recompute( node<Ntk> const& root, uint32_t& count )
+  {
+    /* fanins must be up-to-date; nodes are expanded on an explicit stack,
+     * such that long chains of modified nodes do not overflow the call stack */
+    _stack.clear();
+    _stack.emplace_back( root, false );
+    while ( !_stack.empty() )
+    {
+      const auto [n, expanded] = _stack.back();
+      const auto index = ntk.node_to_index( n );
+      if ( !_dirty[index] )
+      {
+        _stack.pop_back();
+        continue;
+      }
+
+      if constexpr ( has_is_dead_v<Ntk> )
+      {
+        if ( ntk.is_dead( n ) )
+        {
+          _stack.pop_back();
+          _dirty[index] = false;
+          _cuts._cuts[index].clear();
+          _cuts.add_unit_cut( index );
+          continue;
+        }
+      }
+
+      if ( !expanded )
+      {
+        _stack.back().second = true;
+        ntk.foreach_fanin( n, [&]( auto const& f ) {
+          if ( const auto child = ntk.get_node( f ); _dirty[ntk.node_to_index( child )] )
+          {
+            _stack.emplace_back( child, false );
+          }
+        } );
+        continue;
+      }
+
+      _stack.pop_back();
+      _dirty[index] = false;
+
+      save_cuts( index );
+      _impl.compute_cuts( n );
+      ++count;
+
+      if ( cuts_changed( index ) )
+      {
+        ntk.foreach_fanout( n, [&]( auto const& fo ) {
+          mark( fo );
+        } );
+      }
+    }
+  }
+
+  void save_cuts( uint32_t index )
+  {
+    _saved.clear();
+    for ( auto const* cut : _cuts.cuts( index ) )
+    {
+      _saved.push_back( static_cast<uint32_t>( cut->size() ) );
+      if constexpr ( ComputeTruth )
+      {
+        _saved.push_back( ( *cut )->func_id );
+      }
+      std::copy( cut->begin(), cut->end(), std::back_inserter( _saved ) );
+    }
+  }
+
+  bool cuts_changed( uint32_t index ) const
+  {
+    auto it = _saved.begin();
+    for ( auto const* cut : _cuts.cuts( index ) )
+    {
+      if ( it == _saved.end() || *it++ != cut->size() )
+        return true;
+      if constexpr ( ComputeTruth )
+      {
+        if ( *it++ != ( *cut )->func_id )
+          return true;
+      }
+      if ( !std::equal( cut->begin(), cut->end(), it ) )
+        return true;
+      it += cut->size();
+    }
+    return it != _saved.end();
+  }
+
+private:
+  Ntk const& ntk;
+  cut_enumeration_params const ps;
+  cut_enumeration_stats st;
+  network_cuts_t _cuts;
+  detail::cut_enumeration_impl<Ntk, ComputeTruth, CutData> _impl;
+
+  std::vector<bool> _dirty;
+  std::vector<node<Ntk>> _worklist;
+  std::vector<std::pair<node<Ntk>, bool>> _stack; /* nodes to recompute and whether their fanins were expanded */
+  std::vector<uint32_t> _saved; /* flat copy of cut set before re-enumeration */
+  std::array<std::size_t, 3> event_ptr;
+};
+
 // This function expects to receive a network where nodes are sorted in
 // topological order. Cuts are represented as a 64-bit bit vector where each bit
 // determines whether a given node exists in the cut.
@@ -32,12 +32,18 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <iomanip>
 #include <iostream>
+#include <memory>
 #include <optional>
 #include <set>
+#include <thread>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 #include "../networks/klut.hpp"
@@ -100,6 +106,9 @@ struct cut_rewriting_params
   /*! \brief If true, candidates are only accepted if they do not increase logic level of node. */
   bool preserve_depth{false};
 
+  /*! \brief Number of threads to evaluate candidates (only in `cut_rewriting_with_compatibility_graph`). */
+  uint32_t num_threads{1u};
+
   /*! \brief Show progress. */
   bool progress{false};
 
@@ -129,6 +138,12 @@ struct cut_rewriting_stats
   /*! \brief Runtime to find minimal independent set. */
   stopwatch<>::duration time_mis{0};
 
+  /*! \brief Estimated total gain of in-place rewriting. */
+  uint32_t total_gain{0};
+
+  /*! \brief Number of threads that evaluated candidates (only in `cut_rewriting_with_compatibility_graph`). */
+  uint32_t num_threads{0};
+
   void report( bool show_time_mis = true ) const
   {
     fmt::print( "[i] total time     = {:>5.2f} secs\n", to_seconds( time_total ) );
@@ -138,6 +153,10 @@ struct cut_rewriting_stats
     {
       fmt::print( "[i] ind. set time  = {:>5.2f} secs\n", to_seconds( time_mis ) );
     }
+    else
+    {
+      fmt::print( "[i] total gain     = {:>5}\n", total_gain );
+    }
   }
 };
 
@@ -388,6 +407,25 @@ struct has_rewrite_with_dont_cares<Ntk,
 template<class Ntk, class RewritingFn, class Iterator>
 inline constexpr bool has_rewrite_with_dont_cares_v = has_rewrite_with_dont_cares<Ntk, RewritingFn, Iterator>::value;
 
+template<class Ntk, class RewritingFn, class Iterator, class = void>
+struct has_rewrite : std::false_type
+{
+};
+
+template<class Ntk, class RewritingFn, class Iterator>
+struct has_rewrite<Ntk,
+                   RewritingFn, Iterator,
+                   std::void_t<decltype( std::declval<RewritingFn>()( std::declval<Ntk&>(),
+                                                                      std::declval<kitty::dynamic_truth_table>(),
+                                                                      std::declval<Iterator const&>(),
+                                                                      std::declval<Iterator const&>(),
+                                                                      std::declval<void( signal<Ntk> )>() ) )>> : std::true_type
+{
+};
+
+template<class Ntk, class RewritingFn, class Iterator>
+inline constexpr bool has_rewrite_v = has_rewrite<Ntk, RewritingFn, Iterator>::value;
+
 template<class Ntk, class RewritingFn, class NodeCostFn>
 class cut_rewriting_with_compatibility_graph_impl
 {
@@ -416,100 +454,42 @@ public:
     node_map<std::vector<signal<Ntk>>, Ntk> best_replacements( ntk );
 
     /* iterate over all original nodes in the network */
-    const auto size = ntk.size();
     auto max_total_gain = 0u;
-    progress_bar pbar{ntk.size(), "cut_rewriting |{0}| node = {1:>4}@{2:>2} / " + std::to_string( size ) + "   comm. gain = {3}", ps.progress};
-    ntk.foreach_node( [&]( auto const& n, auto index ) {
-      /* stop once all original nodes were visited */
-      if ( index >= size )
-        return false;
-
-      /* do not iterate over constants or PIs */
-      if ( ntk.is_constant( n ) || ntk.is_pi( n ) )
-        return true;
-
-      /* skip cuts with small MFFC */
-      if ( mffc_size( ntk, n ) == 1 )
-        return true;
-
-      /* foreach cut */
-      for ( auto& cut : cuts.cuts( ntk.node_to_index( n ) ) )
+    bool evaluated{false};
+    if constexpr ( supports_parallel_evaluation )
+    {
+      if ( ps.num_threads > 1u )
       {
-        /* skip trivial cuts */
-        if ( cut->size() < ps.min_cand_cut_size )
-          continue;
-
-        const auto tt = cuts.truth_table( *cut );
-        assert( cut->size() == static_cast<unsigned>( tt.num_vars() ) );
-
-        pbar( index, ntk.node_to_index( n ), best_replacements[n].size(), max_total_gain );
-
-        std::vector<signal<Ntk>> children;
-        for ( auto l : *cut )
-        {
-          children.push_back( ntk.make_signal( ntk.index_to_node( l ) ) );
-        }
-
-        int32_t value = recursive_deref<Ntk, NodeCostFn>( ntk, n );
-        {
-          stopwatch t( st.time_rewriting );
-          int32_t best_gain{-1};
-
-          const auto on_signal = [&]( auto const& f_new ) {
-            auto [v, contains] = recursive_ref_contains( ntk.get_node( f_new ), n );
-            recursive_deref<Ntk, NodeCostFn>( ntk, ntk.get_node( f_new ) );
-
-            int32_t gain = contains ? -1 : value - v;
-
-            if ( gain > 0 || ( ps.allow_zero_gain && gain == 0 ) )
-            {
-              if ( best_gain == -1 )
-              {
-                ( *cut )->data.gain = best_gain = gain;
-                best_replacements[n].push_back( f_new );
-              }
-              else if ( gain > best_gain )
-              {
-                ( *cut )->data.gain = best_gain = gain;
-                best_replacements[n].back() = f_new;
-              }
-            }
+        stopwatch t( st.time_rewriting );
+        max_total_gain = evaluate_in_parallel( cuts, best_replacements );
+        evaluated = true;
+      }
+    }
 
-            return true;
-          };
+    if ( !evaluated )
+    {
+      st.num_threads = 1u;
+      const auto size = ntk.size();
+      progress_bar pbar{ntk.size(), "cut_rewriting |{0}| node = {1:>4} / " + std::to_string( size ) + "   comm. gain = {2}", ps.progress};
+      ntk.foreach_node( [&]( auto const& n, auto index ) {
+        if ( index >= size )
+          return false;
 
-          if ( ps.use_dont_cares )
-          {
-            if constexpr ( has_rewrite_with_dont_cares_v<Ntk, RewritingFn, decltype( children.begin() )> )
-            {
-              std::vector<node<Ntk>> pivots;
-              for ( auto const& c : children )
-              {
-                pivots.push_back( ntk.get_node( c ) );
-              }
-              rewriting_fn( ntk, cuts.truth_table( *cut ), satisfiability_dont_cares( ntk, pivots ), children.begin(), children.end(), on_signal );
-            }
-            else
-            {
-              rewriting_fn( ntk, cuts.truth_table( *cut ), children.begin(), children.end(), on_signal );
-            }
-          }
-          else
-          {
-            rewriting_fn( ntk, cuts.truth_table( *cut ), children.begin(), children.end(), on_signal );
-          }
+        /* do not iterate over constants or PIs */
+        if ( ntk.is_constant( n ) || ntk.is_pi( n ) )
+          return true;
 
-          if ( best_gain > 0 )
-          {
-            max_total_gain += best_gain;
-          }
-        }
+        /* skip cuts with small MFFC */
+        if ( mffc_size( ntk, n ) == 1 )
+          return true;
 
-        recursive_ref<Ntk, NodeCostFn>( ntk, n );
-      }
+        pbar( index, ntk.node_to_index( n ), max_total_gain );
 
-      return true;
-    } );
+        stopwatch t( st.time_rewriting );
+        max_total_gain += evaluate_node( ntk, cuts, n, best_replacements[n] );
+        return true;
+      } );
+    }
 
     stopwatch t2( st.time_mis );
     auto [g, map] = network_cuts_graph( ntk, cuts, ps );
@@ -554,20 +534,202 @@ public:
   }
 
 private:
-  std::pair<int32_t, bool> recursive_ref_contains( node<Ntk> const& n, node<Ntk> const& repl )
+  using base_ntk_t = typename Ntk::base_type;
+
+  /* candidates can be evaluated on private copies of the base network */
+  static constexpr bool supports_parallel_evaluation = has_clone_node_v<Ntk> &&
+                                                       has_rewrite_v<base_ntk_t, RewritingFn, typename std::vector<signal<Ntk>>::iterator> &&
+                                                       std::is_invocable_v<NodeCostFn const&, base_ntk_t const&, node<Ntk> const&>;
+
+  /*! \brief Computes the best replacement for each cut of `n`.
+   *
+   * Candidates are created in `net`, which is either the network itself or a
+   * private copy of it.  Returns the largest gain over all cuts.
+   */
+  template<class Net, class Cuts>
+  uint32_t evaluate_node( Net& net, Cuts const& cuts, node<Ntk> const& n, std::vector<signal<Net>>& replacements )
+  {
+    uint32_t max_gain{0u};
+
+    /* foreach cut */
+    for ( auto& cut : cuts.cuts( net.node_to_index( n ) ) )
+    {
+      /* skip trivial cuts */
+      if ( cut->size() < ps.min_cand_cut_size )
+        continue;
+
+      const auto tt = cuts.truth_table( *cut );
+      assert( cut->size() == static_cast<unsigned>( tt.num_vars() ) );
+
+      std::vector<signal<Net>> children;
+      for ( auto l : *cut )
+      {
+        children.push_back( net.make_signal( net.index_to_node( l ) ) );
+      }
+
+      int32_t value = recursive_deref<Net, NodeCostFn>( net, n );
+      int32_t best_gain{-1};
+
+      const auto on_signal = [&]( auto const& f_new ) {
+        auto [v, contains] = recursive_ref_contains( net, net.get_node( f_new ), n );
+        recursive_deref<Net, NodeCostFn>( net, net.get_node( f_new ) );
+
+        int32_t gain = contains ? -1 : value - v;
+
+        if ( gain > 0 || ( ps.allow_zero_gain && gain == 0 ) )
+        {
+          if ( best_gain == -1 )
+          {
+            ( *cut )->data.gain = best_gain = gain;
+            replacements.push_back( f_new );
+          }
+          else if ( gain > best_gain )
+          {
+            ( *cut )->data.gain = best_gain = gain;
+            replacements.back() = f_new;
+          }
+        }
+
+        return true;
+      };
+
+      if ( ps.use_dont_cares )
+      {
+        if constexpr ( has_rewrite_with_dont_cares_v<Net, RewritingFn, decltype( children.begin() )> )
+        {
+          std::vector<node<Net>> pivots;
+          for ( auto const& c : children )
+          {
+            pivots.push_back( net.get_node( c ) );
+          }
+          rewriting_fn( net, tt, satisfiability_dont_cares( net, pivots ), children.begin(), children.end(), on_signal );
+        }
+        else
+        {
+          rewriting_fn( net, tt, children.begin(), children.end(), on_signal );
+        }
+      }
+      else
+      {
+        rewriting_fn( net, tt, children.begin(), children.end(), on_signal );
+      }
+
+      if ( best_gain > 0 )
+      {
+        max_gain += best_gain;
+      }
+
+      recursive_ref<Net, NodeCostFn>( net, n );
+    }
+
+    return max_gain;
+  }
+
+  /*! \brief Evaluates candidates with `ps.num_threads` threads.
+   *
+   * Each thread evaluates nodes on its own copy of the network, in which it
+   * creates its candidates.  Node indexes of the original network are the same
+   * in all copies.  Afterwards, the candidates are imported into the network in
+   * the order of the nodes, such that the result does not depend on which
+   * thread evaluated a node.
+   */
+  template<class Cuts>
+  uint32_t evaluate_in_parallel( Cuts const& cuts, node_map<std::vector<signal<Ntk>>, Ntk>& best_replacements )
+  {
+    const auto size = static_cast<uint32_t>( ntk.size() );
+
+    std::vector<node<Ntk>> gates;
+    ntk.foreach_node( [&]( auto const& n, auto index ) {
+      if ( index >= size )
+        return false;
+
+      if ( !ntk.is_constant( n ) && !ntk.is_pi( n ) && mffc_size( ntk, n ) != 1 )
+      {
+        gates.push_back( n );
+      }
+      return true;
+    } );
+
+    std::vector<std::vector<signal<Ntk>>> replacements( gates.size() );
+    std::vector<uint32_t> owner( gates.size() );
+    std::vector<uint32_t> gains( gates.size() );
+    std::vector<std::unique_ptr<base_ntk_t>> nets( ps.num_threads );
+
+    std::atomic<uint32_t> next{0u};
+    std::vector<std::thread> workers;
+    for ( auto w = 0u; w < ps.num_threads; ++w )
+    {
+      workers.emplace_back( [&, w]() {
+        /* reference counters are copied together with the storage */
+        nets[w] = std::make_unique<base_ntk_t>( std::make_shared<std::decay_t<decltype( *ntk._storage )>>( *ntk._storage ) );
+        for ( auto i = next++; i < gates.size(); i = next++ )
+        {
+          owner[i] = w;
+          gains[i] = evaluate_node( *nets[w], cuts, gates[i], replacements[i] );
+        }
+      } );
+    }
+    for ( auto& worker : workers )
+    {
+      worker.join();
+    }
+    st.num_threads = static_cast<uint32_t>( workers.size() );
+
+    uint32_t max_total_gain{0u};
+    std::vector<std::unordered_map<node<Ntk>, signal<Ntk>>> imported( ps.num_threads );
+    for ( auto i = 0u; i < gates.size(); ++i )
+    {
+      for ( auto const& f : replacements[i] )
+      {
+        best_replacements[gates[i]].push_back( import_signal( *nets[owner[i]], size, f, imported[owner[i]] ) );
+      }
+      max_total_gain += gains[i];
+    }
+
+    return max_total_gain;
+  }
+
+  signal<Ntk> import_signal( base_ntk_t const& net, uint32_t num_nodes, signal<Ntk> const& f, std::unordered_map<node<Ntk>, signal<Ntk>>& imported )
+  {
+    const auto n = net.get_node( f );
+
+    signal<Ntk> g;
+    if ( net.node_to_index( n ) < num_nodes )
+    {
+      g = ntk.make_signal( n );
+    }
+    else if ( const auto it = imported.find( n ); it != imported.end() )
+    {
+      g = it->second;
+    }
+    else
+    {
+      std::vector<signal<Ntk>> children;
+      net.foreach_fanin( n, [&]( auto const& c ) {
+        children.emplace_back( import_signal( net, num_nodes, c, imported ) );
+      } );
+      g = ntk.clone_node( net, n, children );
+      imported.emplace( n, g );
+    }
+
+    return net.is_complemented( f ) ? ntk.create_not( g ) : g;
+  }
+
+  template<class Net>
+  std::pair<int32_t, bool> recursive_ref_contains( Net& net, node<Ntk> const& n, node<Ntk> const& repl )
   {
     /* terminate? */
-    if ( ntk.is_constant( n ) || ntk.is_pi( n ) )
+    if ( net.is_constant( n ) || net.is_pi( n ) )
       return {0, false};
 
     /* recursively collect nodes */
-    int32_t value = cost_fn( ntk, n );
+    int32_t value = cost_fn( net, n );
     bool contains = ( n == repl );
-    ntk.foreach_fanin( n, [&]( auto const& s ) {
-      contains = contains || ( ntk.get_node( s ) == repl );
-      if ( ntk.incr_value( ntk.get_node( s ) ) == 0 )
+    net.foreach_fanin( n, [&]( auto const& s ) {
+      contains = contains || ( net.get_node( s ) == repl );
+      if ( net.incr_value( net.get_node( s ) ) == 0 )
       {
-        const auto [v, c] = recursive_ref_contains( ntk.get_node( s ), repl );
+        const auto [v, c] = recursive_ref_contains( net, net.get_node( s ), repl );
         value += v;
         contains = contains || c;
       }
@@ -607,6 +769,15 @@ private:
  * input and output network.  Consequently, the algorithm does not return a
  * new network but applies changes in-place to the input network.
  *
+ * If `ps.num_threads` is larger than 1, candidates are evaluated by several
+ * threads, each on its own copy of the network, and are then imported into
+ * the network in a deterministic order.  This requires `clone_node` and a
+ * rewriting function that can be called on `Ntk::base_type`.  The rewriting
+ * function is called concurrently and must therefore be thread-safe, which is
+ * the case for database-based functions such as `xag_npn_resynthesis`, but
+ * not for `exact_resynthesis` with a cache.  Otherwise, candidates are
+ * evaluated sequentially.
+ *
  * **Required network functions:**
  * - `fanout_size`
  * - `foreach_node`
@@ -862,4 +1033,433 @@ Ntk cut_rewriting( Ntk const& ntk, RewritingFn const& rewriting_fn = {}, cut_rew
   return result;
 }
 
+namespace detail
+{
+
+template<class Ntk, class RewritingFn, class NodeCostFn>
+class dag_aware_cut_rewriting_impl
+{
+public:
+  dag_aware_cut_rewriting_impl( Ntk& ntk, RewritingFn&& rewriting_fn, cut_rewriting_params const& ps, cut_rewriting_stats& st, NodeCostFn const& cost_fn )
+      : ntk( ntk ),
+        rewriting_fn( rewriting_fn ),
+        ps( ps ),
+        st( st ),
+        cost_fn( cost_fn ) {}
+
+  void run()
+  {
+    stopwatch t( st.time_total );
+
+    /* enumerate cuts */
+    const auto cuts = call_with_stopwatch( st.time_cuts, [&]() { return cut_enumeration<Ntk, true>( ntk, ps.cut_enumeration_ps ); } );
+
+    /* values are reference counters, in which dangling nodes are not counted */
+    compute_reference_counts();
+    register_events();
+
+    const auto size = ntk.size();
+    progress_bar pbar{ntk.size(), "cut_rewriting |{0}| node = {1:>4} / " + std::to_string( size ) + "   gain = {2}", ps.progress};
+    ntk.foreach_node( [&]( auto const& n, auto index ) {
+      /* stop once all original nodes were visited */
+      if ( index >= size )
+        return false;
+
+      /* do not iterate over constants, PIs, and removed nodes */
+      if ( ntk.is_constant( n ) || ntk.is_pi( n ) || ntk.is_dead( n ) || ntk.value( n ) == 0 )
+        return true;
+
+      pbar( index, index, st.total_gain );
+
+      int32_t best_gain{-1};
+      std::optional<signal<Ntk>> best_signal;
+      std::vector<node<Ntk>> best_leaves;
+
+      std::vector<signal<Ntk>> children;
+      std::vector<node<Ntk>> leaves;
+      std::vector<node<Ntk>> pivots;
+      for ( auto& cut : cuts.cuts( ntk.node_to_index( n ) ) )
+      {
+        /* skip trivial cuts */
+        if ( cut->size() < ps.min_cand_cut_size )
+          continue;
+
+        /* leaves must still be used by the network; their functions did not change */
+        children.clear();
+        leaves.clear();
+        for ( auto l : *cut )
+        {
+          const auto leaf = ntk.index_to_node( l );
+          if ( leaf == n || ntk.is_dead( leaf ) || ( !ntk.is_constant( leaf ) && !ntk.is_pi( leaf ) && ntk.value( leaf ) == 0 ) )
+          {
+            break;
+          }
+          children.push_back( ntk.make_signal( leaf ) );
+          leaves.push_back( leaf );
+        }
+        if ( children.size() != cut->size() )
+          continue;
+
+        /* nodes between n and the leaves that are only used by n are freed by the replacement */
+        const int32_t value = deref_to_leaves( n, leaves );
+
+        const auto on_signal = [&]( auto const& f_new ) {
+          const auto n_new = ntk.get_node( f_new );
+          if ( n_new == n )
+            return true;
+
+          /* existing logic is reused for free */
+          int32_t gain{value};
+          if ( ntk.value( n_new ) == 0 && !ntk.is_constant( n_new ) && !ntk.is_pi( n_new ) )
+          {
+            auto [v, contains] = recursive_ref_contains( n_new, n );
+            recursive_deref<Ntk, NodeCostFn>( ntk, n_new );
+            gain = contains ? -1 : value - v;
+          }
+
+          if ( ( gain > 0 || ( ps.allow_zero_gain && gain == 0 ) ) && gain > best_gain )
+          {
+            /* existing nodes in the candidate may depend on n */
+            if ( cone_contains( n_new, n, children ) )
+            {
+              return true;
+            }
+            if constexpr ( has_level_v<Ntk> )
+            {
+              if ( ps.preserve_depth && ntk.level( n_new ) > ntk.level( n ) )
+              {
+                return true;
+              }
+            }
+            best_gain = gain;
+            best_signal = f_new;
+            best_leaves = leaves;
+          }
+
+          return true;
+        };
+
+        {
+          stopwatch t( st.time_rewriting );
+          if ( ps.use_dont_cares )
+          {
+            if constexpr ( has_rewrite_with_dont_cares_v<Ntk, RewritingFn, decltype( children.begin() )> )
+            {
+              pivots.clear();
+              for ( auto const& c : children )
+              {
+                pivots.push_back( ntk.get_node( c ) );
+              }
+              rewriting_fn( ntk, cuts.truth_table( *cut ), satisfiability_dont_cares( ntk, pivots ), children.begin(), children.end(), on_signal );
+            }
+            else
+            {
+              rewriting_fn( ntk, cuts.truth_table( *cut ), children.begin(), children.end(), on_signal );
+            }
+          }
+          else
+          {
+            rewriting_fn( ntk, cuts.truth_table( *cut ), children.begin(), children.end(), on_signal );
+          }
+        }
+
+        ref_to_leaves( n, leaves );
+      }
+
+      if ( !best_signal )
+      {
+        return true;
+      }
+
+      /* reference counts are updated by the network events */
+      deleted.clear();
+      ntk.substitute_node( n, *best_signal );
+      update_output_references();
+      st.total_gain += best_gain;
+
+      return true;
+    } );
+
+    release_events();
+  }
+
+private:
+  /* counts the references of each node from outputs and from nodes that are
+   * reachable from outputs */
+  void compute_reference_counts()
+  {
+    ntk.clear_values();
+    outputs.clear();
+
+    std::vector<node<Ntk>> stack;
+    const auto reference = [&]( signal<Ntk> const& f ) {
+      const auto n = ntk.get_node( f );
+      if ( ntk.incr_value( n ) == 0 && !ntk.is_constant( n ) && !ntk.is_pi( n ) )
+      {
+        stack.push_back( n );
+      }
+    };
+
+    ntk.foreach_po( [&]( auto const& f ) {
+      outputs.push_back( f );
+      reference( f );
+    } );
+    while ( !stack.empty() )
+    {
+      const auto n = stack.back();
+      stack.pop_back();
+      ntk.foreach_fanin( n, reference );
+    }
+  }
+
+  /* a substitution modifies the fanouts of the replaced node in place, or
+   * deletes them if they are merged with existing nodes by structural hashing;
+   * only the references of the touched nodes are updated */
+  void register_events()
+  {
+    auto& events = ntk.events();
+    event_ptr[0] = events.on_modified.size();
+    events.on_modified.emplace_back( [this]( auto const& n, auto const& previous ) {
+      if ( ntk.value( n ) == 0 )
+        return;
+
+      ntk.foreach_fanin( n, [&]( auto const& f ) {
+        reference( ntk.get_node( f ) );
+      } );
+      for ( auto const& f : previous )
+      {
+        dereference( ntk.get_node( f ) );
+      }
+    } );
+
+    /* deleted nodes keep their references until their fanouts and outputs
+     * are redirected, which releases their fanins */
+    event_ptr[1] = events.on_delete.size();
+    events.on_delete.emplace_back( [this]( auto const& n ) {
+      deleted.push_back( n );
+    } );
+  }
+
+  void release_events()
+  {
+    auto& events = ntk.events();
+    events.on_modified.erase( events.on_modified.begin() + event_ptr[0] );
+    events.on_delete.erase( events.on_delete.begin() + event_ptr[1] );
+  }
+
+  /* outputs are redirected without events; they are only compared if a
+   * deleted node is still referenced after the substitution */
+  void update_output_references()
+  {
+    if ( std::none_of( deleted.begin(), deleted.end(), [&]( auto const& n ) { return ntk.value( n ) > 0; } ) )
+      return;
+
+    uint32_t i{0};
+    ntk.foreach_po( [&]( auto const& f ) {
+      if ( ntk.get_node( f ) != ntk.get_node( outputs[i] ) )
+      {
+        reference( ntk.get_node( f ) );
+        dereference( ntk.get_node( outputs[i] ) );
+      }
+      outputs[i++] = f;
+    } );
+  }
+
+  /* references a node, and its fanins if it was not referenced before */
+  void reference( node<Ntk> const& n )
+  {
+    if ( ntk.incr_value( n ) == 0 && !ntk.is_constant( n ) && !ntk.is_pi( n ) )
+    {
+      ntk.foreach_fanin( n, [&]( auto const& f ) {
+        reference( ntk.get_node( f ) );
+      } );
+    }
+  }
+
+  /* dereferences a node, and its fanins if it is no longer referenced */
+  void dereference( node<Ntk> const& n )
+  {
+    if ( ntk.decr_value( n ) == 0 && !ntk.is_constant( n ) && !ntk.is_pi( n ) )
+    {
+      ntk.foreach_fanin( n, [&]( auto const& f ) {
+        dereference( ntk.get_node( f ) );
+      } );
+    }
+  }
+
+  int32_t deref_to_leaves( node<Ntk> const& n, std::vector<node<Ntk>> const& leaves )
+  {
+    const auto terminate = [&]( auto const& m ) { return ntk.is_constant( m ) || ntk.is_pi( m ) || std::find( leaves.begin(), leaves.end(), m ) != leaves.end(); };
+    return recursive_deref<Ntk, decltype( terminate ), NodeCostFn>( ntk, n, terminate );
+  }
+
+  int32_t ref_to_leaves( node<Ntk> const& n, std::vector<node<Ntk>> const& leaves )
+  {
+    const auto terminate = [&]( auto const& m ) { return ntk.is_constant( m ) || ntk.is_pi( m ) || std::find( leaves.begin(), leaves.end(), m ) != leaves.end(); };
+    return recursive_ref<Ntk, decltype( terminate ), NodeCostFn>( ntk, n, terminate );
+  }
+
+  bool cone_contains( node<Ntk> const& root, node<Ntk> const& n, std::vector<signal<Ntk>> const& leaves )
+  {
+    ntk.incr_trav_id();
+    for ( auto const& l : leaves )
+    {
+      ntk.set_visited( ntk.get_node( l ), ntk.trav_id() );
+    }
+    return cone_contains_rec( root, n );
+  }
+
+  bool cone_contains_rec( node<Ntk> const& root, node<Ntk> const& n )
+  {
+    if ( root == n )
+      return true;
+    if ( ntk.visited( root ) == ntk.trav_id() || ntk.is_constant( root ) || ntk.is_pi( root ) )
+      return false;
+    ntk.set_visited( root, ntk.trav_id() );
+
+    bool contains{false};
+    ntk.foreach_fanin( root, [&]( auto const& s ) {
+      contains = cone_contains_rec( ntk.get_node( s ), n );
+      return !contains;
+    } );
+    return contains;
+  }
+
+  std::pair<int32_t, bool> recursive_ref_contains( node<Ntk> const& n, node<Ntk> const& repl )
+  {
+    /* terminate? */
+    if ( ntk.is_constant( n ) || ntk.is_pi( n ) )
+      return {0, false};
+
+    /* recursively collect nodes */
+    int32_t value = cost_fn( ntk, n );
+    bool contains = ( n == repl );
+    ntk.foreach_fanin( n, [&]( auto const& s ) {
+      contains = contains || ( ntk.get_node( s ) == repl );
+      if ( ntk.incr_value( ntk.get_node( s ) ) == 0 )
+      {
+        const auto [v, c] = recursive_ref_contains( ntk.get_node( s ), repl );
+        value += v;
+        contains = contains || c;
+      }
+    } );
+    return {value, contains};
+  }
+
+private:
+  Ntk& ntk;
+  RewritingFn&& rewriting_fn;
+  cut_rewriting_params const& ps;
+  cut_rewriting_stats& st;
+  NodeCostFn cost_fn;
+
+  std::vector<signal<Ntk>> outputs;
+  std::vector<node<Ntk>> deleted;
+  std::array<std::size_t, 2> event_ptr;
+};
+
+} /* namespace detail */
+
+/*! \brief DAG-aware in-place cut rewriting algorithm.
+ *
+ * This algorithm enumerates cuts of a network and visits the nodes in
+ * topological order.  For each node, the rewriting function is called for
+ * each cut, and the gain of a candidate is the number of nodes between the
+ * node and the leaves of the cut that are only used by the node, minus the
+ * number of nodes that must be added for the candidate.
+ * Nodes that are already used in the network, e.g., because they are found by
+ * structural hashing, are not counted.  The best candidate is substituted
+ * immediately, if it leads to an improvement, similar to the `rewrite`
+ * command in ABC.
+ *
+ * In contrast to `cut_rewriting`, the network is modified in-place and not
+ * copied, and in contrast to `cut_rewriting_with_compatibility_graph`, no
+ * conflict graph is computed.  Since functions of nodes are preserved by
+ * substitutions, cuts that are enumerated at the beginning remain valid as
+ * long as their leaves are still used in the network.  Unsuccessful
+ * candidates remain dangling in the network and can be removed by calling
+ * `cleanup_dangling`.  Reference counts, which ignore dangling nodes, are
+ * updated from the network events after each substitution, which also
+ * covers nodes in the fanout of the replaced node that are merged by
+ * structural hashing.
+ *
+ * The rewriting function has the same signature as for `cut_rewriting`.
+ *
+ * **Required network functions:**
+ * - `fanout_size`
+ * - `foreach_node`
+ * - `foreach_fanin`
+ * - `foreach_po`
+ * - `is_constant`
+ * - `is_pi`
+ * - `is_dead`
+ * - `clear_values`
+ * - `incr_value`
+ * - `decr_value`
+ * - `set_value`
+ * - `value`
+ * - `node_to_index`
+ * - `index_to_node`
+ * - `substitute_node`
+ * - `make_signal`
+ * - `incr_trav_id`
+ * - `trav_id`
+ * - `visited`
+ * - `set_visited`
+ * - `events`
+ *
+ * \param ntk Network (will be modified)
+ * \param rewriting_fn Rewriting function
+ * \param ps Rewriting params
+ * \param pst Rewriting statistics
+ * \param cost_fn Node cost function (a functor with signature `uint32_t(Ntk const&, node<Ntk> const&)`)
+ */
+template<class Ntk, class RewritingFn, class NodeCostFn = unit_cost<Ntk>>
+void dag_aware_cut_rewriting( Ntk& ntk, RewritingFn&& rewriting_fn, cut_rewriting_params const& ps = {}, cut_rewriting_stats* pst = nullptr, NodeCostFn const& cost_fn = {} )
+{
+  static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
+  static_assert( has_fanout_size_v<Ntk>, "Ntk does not implement the fanout_size method" );
+  static_assert( has_foreach_node_v<Ntk>, "Ntk does not implement the foreach_node method" );
+  static_assert( has_foreach_fanin_v<Ntk>, "Ntk does not implement the foreach_fanin method" );
+  static_assert( has_foreach_po_v<Ntk>, "Ntk does not implement the foreach_po method" );
+  static_assert( has_is_constant_v<Ntk>, "Ntk does not implement the is_constant method" );
+  static_assert( has_is_pi_v<Ntk>, "Ntk does not implement the is_pi method" );
+  static_assert( has_clear_values_v<Ntk>, "Ntk does not implement the clear_values method" );
+  static_assert( has_incr_value_v<Ntk>, "Ntk does not implement the incr_value method" );
+  static_assert( has_decr_value_v<Ntk>, "Ntk does not implement the decr_value method" );
+  static_assert( has_set_value_v<Ntk>, "Ntk does not implement the set_value method" );
+  static_assert( has_value_v<Ntk>, "Ntk does not implement the value method" );
+  static_assert( has_node_to_index_v<Ntk>, "Ntk does not implement the node_to_index method" );
+  static_assert( has_index_to_node_v<Ntk>, "Ntk does not implement the index_to_node method" );
+  static_assert( has_substitute_node_v<Ntk>, "Ntk does not implement the substitute_node method" );
+  static_assert( has_make_signal_v<Ntk>, "Ntk does not implement the make_signal method" );
+  static_assert( has_incr_trav_id_v<Ntk>, "Ntk does not implement the incr_trav_id method" );
+  static_assert( has_trav_id_v<Ntk>, "Ntk does not implement the trav_id method" );
+  static_assert( has_visited_v<Ntk>, "Ntk does not implement the visited method" );
+  static_assert( has_set_visited_v<Ntk>, "Ntk does not implement the set_visited method" );
+
+  cut_rewriting_stats st;
+  if ( ps.preserve_depth )
+  {
+    depth_view<Ntk, NodeCostFn> depth_ntk{ntk};
+    detail::dag_aware_cut_rewriting_impl<depth_view<Ntk, NodeCostFn>, RewritingFn, NodeCostFn> p( depth_ntk, rewriting_fn, ps, st, cost_fn );
+    p.run();
+  }
+  else
+  {
+    detail::dag_aware_cut_rewriting_impl<Ntk, RewritingFn, NodeCostFn> p( ntk, rewriting_fn, ps, st, cost_fn );
+    p.run();
+  }
+
+  if ( ps.verbose )
+  {
+    st.report( false );
+  }
+
+  if ( pst )
+  {
+    *pst = st;
+  }
+}
+
 } /* namespace mockturtle */
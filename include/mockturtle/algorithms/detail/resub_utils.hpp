@@ -35,9 +35,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <vector>
 #include <optional>
 #include <iostream>
+#include <type_traits>
 
 #include <kitty/constructors.hpp>
 
@@ -167,10 +169,15 @@ public:
   explicit window_simulator( Ntk const& ntk, uint32_t num_divisors, uint32_t max_pis )
       : ntk( ntk ), num_divisors( num_divisors ), tts( num_divisors + 1 ), node_to_index( ntk.size(), 0u ), phase( ntk.size(), false )
   {
-    auto tt = kitty::create<truthtable_t>( max_pis );
+    /* static truth tables may have more variables than leaves */
+    truthtable_t tt;
+    if constexpr ( std::is_same_v<truthtable_t, kitty::dynamic_truth_table> )
+    {
+      tt = kitty::create<truthtable_t>( max_pis );
+    }
     tts[0] = tt;
 
-    for ( auto i = 0u; i < tt.num_vars(); ++i )
+    for ( auto i = 0u; i < std::min<uint32_t>( max_pis, tt.num_vars() ); ++i )
     {
       kitty::create_nth_var( tt, i );
       tts[i + 1] = tt;
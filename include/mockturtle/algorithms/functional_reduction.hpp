@@ -65,6 +65,11 @@ struct functional_reduction_params
   /*! \brief Whether to save the appended patterns (with CEXs) into file. */
   std::optional<std::string> save_patterns{};
 
+  /*! \brief Whether to save the patterns in binary format.
+   * If `save_patterns` is the binary file in `pattern_filename`, only the CEXs are appended to it.
+   */
+  bool binary_patterns{false};
+
   /*! \brief Maximum number of nodes in the transitive fanin cone (and their fanouts) to be compared to. */
   uint32_t max_TFI_nodes{1000};
 
@@ -138,13 +143,21 @@ public:
         sim( ps.pattern_filename ? partial_simulator( *ps.pattern_filename ) : partial_simulator( ntk.num_pis(), 256 ) ), validator( ntk, vps )
   {
     static_assert( !validator_t::use_odc_, "`circuit_validator::use_odc` flag should be turned off." );
+    num_loaded_patterns = sim.num_bits();
   }
 
   ~functional_reduction_impl()
   {
     if ( ps.save_patterns )
     {
-      write_patterns( sim, *ps.save_patterns );
+      if ( !ps.binary_patterns )
+      {
+        write_patterns( sim, *ps.save_patterns );
+      }
+      else if ( ps.pattern_filename != ps.save_patterns || !append_binary_patterns( sim, *ps.save_patterns, num_loaded_patterns ) )
+      {
+        write_binary_patterns( sim, *ps.save_patterns );
+      }
     }
   }
 
@@ -414,6 +427,7 @@ private:
 
   TT tts;
   partial_simulator sim;
+  uint32_t num_loaded_patterns{0};
   validator_t validator;
 
   uint32_t candidates{0};
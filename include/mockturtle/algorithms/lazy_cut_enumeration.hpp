@@ -0,0 +1,614 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2019  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file lazy_cut_enumeration.hpp
+  \brief Lazy cut enumeration with memoization
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include <kitty/constructors.hpp>
+#include <kitty/dynamic_truth_table.hpp>
+#include <kitty/operations.hpp>
+
+#include "../traits.hpp"
+#include "../utils/cuts.hpp"
+#include "../utils/mixed_radix.hpp"
+#include "../utils/truth_table_cache.hpp"
+#include "cut_enumeration.hpp"
+
+namespace mockturtle
+{
+
+/*! \brief Parameters for lazy_network_cuts.
+ *
+ * The data structure `lazy_cut_enumeration_params` holds configurable
+ * parameters with default arguments for `lazy_network_cuts`.
+ */
+struct lazy_cut_enumeration_params
+{
+  /*! \brief Maximum number of leaves for a cut. */
+  uint32_t cut_size{4u};
+
+  /*! \brief Maximum number of cuts for a node. */
+  uint32_t cut_limit{25u};
+
+  /*! \brief Maximum number of fan-ins for a node. */
+  uint32_t fanin_limit{10u};
+
+  /*! \brief Maximum number of cut sets kept in memory.
+   *
+   * If more cut sets are stored, the least recently used ones are evicted.
+   * While cuts are computed recursively, cut sets of fanins that are in use
+   * are not evicted, and the limit may be exceeded temporarily.
+   */
+  uint32_t max_cut_sets{10000u};
+};
+
+/*! \brief Statistics for lazy_network_cuts. */
+struct lazy_cut_enumeration_stats
+{
+  /*! \brief Number of cut set queries answered from memory. */
+  uint64_t hits{0};
+
+  /*! \brief Number of computed cut sets. */
+  uint64_t misses{0};
+
+  /*! \brief Number of evicted cut sets. */
+  uint64_t evictions{0};
+};
+
+/*! \brief Lazy cut database for a network.
+ *
+ * In contrast to `cut_enumeration`, which computes the cuts of all nodes in
+ * a network, this data structure computes the cuts of a node only when they
+ * are requested.  The cuts of the fanins are computed recursively and all
+ * computed cut sets are memoized.  The number of memoized cut sets is bounded
+ * by `max_cut_sets`; the least recently used cut sets are evicted first, and
+ * recomputed if they are requested again.  Truth tables that are no longer
+ * referred to by memoized cuts are removed from time to time.
+ *
+ * Cut sets are computed in the same way as in `cut_enumeration`, and the
+ * template parameters `ComputeTruth` and `CutData` have the same meaning.  If
+ * the cut data is computed from the cuts of the leaves, as for
+ * `cut_enumeration_mf_cut`, the cut sets of the leaves are computed first.  A
+ * reference returned by `cuts` is valid until the next call to `cuts`.
+ *
+ * The network must not be modified while the cut database is in use.
+ *
+ * **Required network functions:**
+ * - `is_constant`
+ * - `is_pi`
+ * - `get_node`
+ * - `node_to_index`
+ * - `index_to_node`
+ * - `foreach_fanin`
+ * - `compute` for `kitty::dynamic_truth_table` (if `ComputeTruth` is true)
+ *
+   \verbatim embed:rst
+
+   Example
+
+   .. code-block:: c++
+
+      aig_network aig = ...;
+
+      lazy_cut_enumeration_params ps;
+      ps.max_cut_sets = 1000;
+      lazy_network_cuts<aig_network, true> cuts( aig, ps );
+
+      for ( auto const* cut : cuts.cuts( aig.node_to_index( n ) ) )
+      {
+        auto tt = cuts.truth_table( *cut );
+      }
+   \endverbatim
+ */
+template<typename Ntk, bool ComputeTruth = false, typename CutData = empty_cut_data>
+class lazy_network_cuts
+{
+public:
+  static constexpr uint32_t max_cut_num = 26;
+  using cut_t = cut_type<ComputeTruth, CutData>;
+  using cut_set_t = cut_set<cut_t, max_cut_num>;
+  static constexpr bool compute_truth = ComputeTruth;
+
+public:
+  explicit lazy_network_cuts( Ntk const& ntk, lazy_cut_enumeration_params const& ps = {} )
+      : ntk( ntk ),
+        ps( ps )
+  {
+    static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
+    static_assert( has_is_constant_v<Ntk>, "Ntk does not implement the is_constant method" );
+    static_assert( has_is_pi_v<Ntk>, "Ntk does not implement the is_pi method" );
+    static_assert( has_get_node_v<Ntk>, "Ntk does not implement the get_node method" );
+    static_assert( has_node_to_index_v<Ntk>, "Ntk does not implement the node_to_index method" );
+    static_assert( has_index_to_node_v<Ntk>, "Ntk does not implement the index_to_node method" );
+    static_assert( has_foreach_fanin_v<Ntk>, "Ntk does not implement the foreach_fanin method" );
+    static_assert( !ComputeTruth || has_compute_v<Ntk, kitty::dynamic_truth_table>, "Ntk does not implement the compute method for kitty::dynamic_truth_table" );
+
+    kitty::dynamic_truth_table zero( 0u ), proj( 1u );
+    kitty::create_nth_var( proj, 0u );
+
+    _truth_tables.insert( zero );
+    _truth_tables.insert( proj );
+  }
+
+  /*! \brief Returns the cut set of a node, computes it if necessary */
+  cut_set_t const& cuts( uint32_t node_index ) const
+  {
+    return get_or_compute( node_index );
+  }
+
+  /*! \brief Returns the truth table of a cut */
+  template<bool enabled = ComputeTruth, typename = std::enable_if_t<std::is_same_v<Ntk, Ntk> && enabled>>
+  auto truth_table( cut_t const& cut ) const
+  {
+    return _truth_tables[cut->func_id];
+  }
+
+  /*! \brief Inserts a truth table into the truth table cache.
+   *
+   * Truth tables that are not referred to by cuts in memory are removed from
+   * the cache from time to time, when `cuts` is called.  The returned
+   * index is valid until then.
+   */
+  uint32_t insert_truth_table( kitty::dynamic_truth_table const& tt ) const
+  {
+    return _truth_tables.insert( tt );
+  }
+
+  /*! \brief Checks whether the cut set of a node is in memory. */
+  bool has_cuts( uint32_t node_index ) const
+  {
+    return _entries.find( node_index ) != _entries.end();
+  }
+
+  /*! \brief Number of truth tables in memory. */
+  auto num_truth_tables() const
+  {
+    return _truth_tables.size();
+  }
+
+  /*! \brief Number of cut sets in memory. */
+  auto num_cut_sets() const
+  {
+    return _entries.size();
+  }
+
+  /*! \brief Removes all cut sets from memory. */
+  void clear()
+  {
+    _entries.clear();
+    _lru.clear();
+    _free_slots.clear();
+    _slots.clear();
+  }
+
+  /*! \brief Returns statistics. */
+  lazy_cut_enumeration_stats const& stats() const
+  {
+    return st;
+  }
+
+private:
+  struct entry
+  {
+    uint32_t slot;
+    uint32_t pins;
+    std::list<uint32_t>::iterator lru;
+  };
+
+  struct frame
+  {
+    uint32_t index;
+    bool expanded; /* fanins have been pushed */
+    bool pin;      /* pin cut set for the fanout below on the stack */
+  };
+
+  /* read-only access to pinned cut sets for cut_enumeration_update_cut */
+  struct pinned_cuts
+  {
+    cut_set_t const& cuts( uint32_t node_index ) const
+    {
+      return *self._slots[self._entries.at( node_index ).slot];
+    }
+
+    template<bool enabled = ComputeTruth, typename = std::enable_if_t<std::is_same_v<Ntk, Ntk> && enabled>>
+    auto truth_table( cut_t const& cut ) const
+    {
+      return self._truth_tables[cut->func_id];
+    }
+
+    lazy_network_cuts const& self;
+  };
+
+  cut_set_t& get_or_compute( uint32_t index ) const
+  {
+    if ( auto it = _entries.find( index ); it != _entries.end() )
+    {
+      ++st.hits;
+      _lru.splice( _lru.begin(), _lru, it->second.lru );
+      return *_slots[it->second.slot];
+    }
+
+    /* Cut sets of fanins are computed before the cut set of a node, using an
+     * explicit stack of nodes to avoid deep recursion.  A fanin cut set is
+     * pinned once for each node that refers to it, until that node is
+     * computed, such that it is not evicted in the meantime.  Computing the
+     * cut data may compute cut sets of leaves, which is done in a nested call
+     * with its own stack. */
+    if ( _stacks.size() == _depth )
+    {
+      _stacks.emplace_back();
+    }
+    auto& stack = _stacks[_depth++];
+    stack.clear();
+    stack.push_back( {index, false, false} );
+    while ( !stack.empty() )
+    {
+      auto const [current, expanded, pin] = stack.back();
+      if ( !expanded )
+      {
+        if ( auto it = _entries.find( current ); it != _entries.end() )
+        {
+          /* computed in the meantime through another fanout */
+          it->second.pins += pin ? 1u : 0u;
+          stack.pop_back();
+          continue;
+        }
+
+        stack.back().expanded = true;
+        const auto n = ntk.index_to_node( current );
+        if ( !ntk.is_constant( n ) && !ntk.is_pi( n ) )
+        {
+          const auto first = stack.size();
+          ntk.foreach_fanin( n, [&]( auto const& f ) {
+            const auto child = ntk.node_to_index( ntk.get_node( f ) );
+            if ( auto it = _entries.find( child ); it != _entries.end() )
+            {
+              ++st.hits;
+              _lru.splice( _lru.begin(), _lru, it->second.lru );
+              it->second.pins++;
+            }
+            else
+            {
+              stack.push_back( {child, false, true} );
+            }
+          } );
+
+          /* compute fanins in order, such that earlier ones are pinned first */
+          std::reverse( stack.begin() + first, stack.end() );
+        }
+        continue;
+      }
+
+      stack.pop_back();
+      compute( current ).pins += pin ? 1u : 0u;
+    }
+    --_depth;
+
+    /* truth table indexes of cuts under construction must stay valid */
+    if constexpr ( ComputeTruth )
+    {
+      if ( _depth == 0u && _truth_tables.size() > _truth_table_limit )
+      {
+        collect_truth_tables();
+      }
+    }
+
+    return *_slots[_entries.at( index ).slot];
+  }
+
+  /* computes the cut set of a node, whose fanin cut sets are pinned */
+  entry& compute( uint32_t index ) const
+  {
+    ++st.misses;
+
+    const auto n = ntk.index_to_node( index );
+
+    std::vector<uint32_t> children;
+    if ( !ntk.is_constant( n ) && !ntk.is_pi( n ) )
+    {
+      ntk.foreach_fanin( n, [&]( auto const& f ) {
+        children.push_back( ntk.node_to_index( ntk.get_node( f ) ) );
+      } );
+    }
+
+    auto& e = allocate( index );
+    auto& set = *_slots[e.slot];
+    set.clear();
+    e.pins++;
+
+    if ( ntk.is_constant( n ) )
+    {
+      add_zero_cut( set, index );
+    }
+    else if ( ntk.is_pi( n ) )
+    {
+      add_unit_cut( set, index );
+    }
+    else
+    {
+      merge_cuts( set, index, children );
+
+      if constexpr ( Ntk::min_fanin_size == 2 && Ntk::max_fanin_size == 2 )
+      {
+        if ( set.size() > 1 || ( *set.begin() )->size() > 1 )
+        {
+          add_unit_cut( set, index );
+        }
+      }
+      else
+      {
+        add_unit_cut( set, index );
+      }
+    }
+
+    e.pins--;
+    for ( auto child : children )
+    {
+      _entries[child].pins--;
+    }
+
+    evict( index );
+    return _entries.at( index );
+  }
+
+  /* number of truth tables that may be referred to by cuts in memory */
+  std::size_t min_truth_table_limit() const
+  {
+    return static_cast<std::size_t>( ps.max_cut_sets ) * ps.cut_limit;
+  }
+
+  /* removes truth tables that are not referred to by cuts in memory */
+  void collect_truth_tables() const
+  {
+    truth_table_cache<kitty::dynamic_truth_table> truth_tables;
+    truth_tables.insert( _truth_tables[0] );
+    truth_tables.insert( _truth_tables[2] );
+
+    for ( auto const& [_, e] : _entries )
+    {
+      for ( auto* cut : *_slots[e.slot] )
+      {
+        ( *cut )->func_id = truth_tables.insert( _truth_tables[( *cut )->func_id] );
+      }
+    }
+
+    _truth_tables = std::move( truth_tables );
+    _truth_table_limit = std::max<std::size_t>( 2u * _truth_tables.size(), min_truth_table_limit() );
+  }
+
+  entry& allocate( uint32_t index ) const
+  {
+    uint32_t slot;
+    if ( !_free_slots.empty() )
+    {
+      slot = _free_slots.back();
+      _free_slots.pop_back();
+    }
+    else
+    {
+      slot = static_cast<uint32_t>( _slots.size() );
+      _slots.emplace_back( std::make_unique<cut_set_t>() );
+    }
+
+    _lru.push_front( index );
+    return _entries[index] = entry{slot, 0u, _lru.begin()};
+  }
+
+  /* evicts least recently used cut sets, except for the one of `keep` */
+  void evict( uint32_t keep ) const
+  {
+    auto it = _lru.end();
+    while ( _entries.size() > ps.max_cut_sets && it != _lru.begin() )
+    {
+      --it;
+      auto eit = _entries.find( *it );
+      if ( eit->second.pins > 0 || *it == keep )
+        continue;
+
+      _free_slots.push_back( eit->second.slot );
+      _entries.erase( eit );
+      it = _lru.erase( it );
+      ++st.evictions;
+    }
+  }
+
+  /* cut sets are reused after eviction, hence the cut data is reset */
+  void add_zero_cut( cut_set_t& set, uint32_t index ) const
+  {
+    auto& cut = set.add_cut( &index, &index ); /* fake iterator for emptyness */
+    cut->data = CutData{};
+
+    if constexpr ( ComputeTruth )
+    {
+      cut->func_id = 0;
+    }
+  }
+
+  void add_unit_cut( cut_set_t& set, uint32_t index ) const
+  {
+    auto& cut = set.add_cut( &index, &index + 1 );
+    cut->data = CutData{};
+
+    if constexpr ( ComputeTruth )
+    {
+      cut->func_id = 2;
+    }
+  }
+
+  uint32_t compute_truth_table( uint32_t index, std::vector<cut_t const*> const& vcuts, cut_t const& res ) const
+  {
+    std::vector<kitty::dynamic_truth_table> tt( vcuts.size() );
+    auto i = 0;
+    for ( auto const& cut : vcuts )
+    {
+      tt[i] = kitty::extend_to( _truth_tables[( *cut )->func_id], res.size() );
+
+      std::vector<uint8_t> support;
+      auto itp = res.begin();
+      for ( auto l : *cut )
+      {
+        itp = std::find( itp, res.end(), l );
+        support.push_back( static_cast<uint8_t>( std::distance( res.begin(), itp ) ) );
+      }
+      kitty::expand_inplace( tt[i], support );
+      ++i;
+    }
+
+    return _truth_tables.insert( ntk.compute( ntk.index_to_node( index ), tt.begin(), tt.end() ) );
+  }
+
+  void merge_cuts( cut_set_t& rcuts, uint32_t index, std::vector<uint32_t> const& children ) const
+  {
+    const auto fanin = children.size();
+    if ( fanin == 0u || fanin > ps.fanin_limit )
+      return;
+
+    std::vector<cut_set_t const*> lcuts( fanin );
+    std::vector<uint32_t> cut_sizes( fanin );
+    for ( auto i = 0u; i < fanin; ++i )
+    {
+      lcuts[i] = _slots[_entries.at( children[i] ).slot].get();
+      cut_sizes[i] = static_cast<uint32_t>( lcuts[i]->size() );
+    }
+
+    cut_t new_cut, tmp_cut;
+    std::vector<cut_t const*> vcuts( fanin );
+    std::vector<cut_t> candidates;
+
+    foreach_mixed_radix_tuple( cut_sizes.begin(), cut_sizes.end(), [&]( auto begin, auto end ) {
+      auto it = vcuts.begin();
+      auto i = 0u;
+      while ( begin != end )
+      {
+        *it++ = &( ( *lcuts[i++] )[*begin++] );
+      }
+
+      if ( fanin == 1u )
+      {
+        new_cut = *vcuts[0];
+      }
+      else
+      {
+        if ( !vcuts[0]->merge( *vcuts[1], new_cut, ps.cut_size ) )
+        {
+          return true; /* continue */
+        }
+
+        for ( i = 2; i < fanin; ++i )
+        {
+          tmp_cut = new_cut;
+          if ( !vcuts[i]->merge( tmp_cut, new_cut, ps.cut_size ) )
+          {
+            return true; /* continue */
+          }
+        }
+
+        if ( std::any_of( candidates.begin(), candidates.end(), [&]( auto const& other ) { return other.dominates( new_cut ); } ) )
+        {
+          return true; /* continue */
+        }
+      }
+
+      if constexpr ( ComputeTruth )
+      {
+        new_cut->func_id = compute_truth_table( index, vcuts, new_cut );
+      }
+
+      candidates.push_back( new_cut );
+
+      return true;
+    } );
+
+    /* Cut data may be computed from the cut sets of the leaves, which are
+     * computed and pinned before, such that the update does not compute or
+     * evict cut sets while this one is computed. */
+    std::vector<uint32_t> leaves;
+    if constexpr ( !std::is_same_v<CutData, empty_cut_data> )
+    {
+      for ( auto const& cut : candidates )
+      {
+        leaves.insert( leaves.end(), cut.begin(), cut.end() );
+      }
+      std::sort( leaves.begin(), leaves.end() );
+      leaves.erase( std::unique( leaves.begin(), leaves.end() ), leaves.end() );
+
+      for ( auto leaf : leaves )
+      {
+        get_or_compute( leaf );
+        _entries.at( leaf ).pins++;
+      }
+    }
+
+    const pinned_cuts view{*this};
+    for ( auto& cut : candidates )
+    {
+      if ( rcuts.is_dominated( cut ) )
+      {
+        continue;
+      }
+
+      cut_enumeration_update_cut<CutData>::apply( cut, view, ntk, ntk.index_to_node( index ) );
+
+      rcuts.insert( cut );
+    }
+
+    for ( auto leaf : leaves )
+    {
+      _entries.at( leaf ).pins--;
+    }
+
+    /* limit the maximum number of cuts */
+    rcuts.limit( ps.cut_limit - 1 );
+  }
+
+private:
+  Ntk const& ntk;
+  lazy_cut_enumeration_params const ps;
+
+  mutable lazy_cut_enumeration_stats st;
+  mutable std::unordered_map<uint32_t, entry> _entries;
+  mutable std::list<uint32_t> _lru; /* most recently used first */
+  mutable std::vector<std::unique_ptr<cut_set_t>> _slots;
+  mutable std::vector<uint32_t> _free_slots;
+  mutable truth_table_cache<kitty::dynamic_truth_table> _truth_tables;
+  mutable std::size_t _truth_table_limit{min_truth_table_limit()};
+  mutable std::deque<std::vector<frame>> _stacks; /* one stack per nested call */
+  mutable uint32_t _depth{0u};
+};
+
+} /* namespace mockturtle */
@@ -32,10 +32,16 @@
 
 #pragma once
 
+#include <cassert>
 #include <cstdint>
+#include <limits>
+#include <optional>
+#include <thread>
+#include <vector>
 
 #include <fmt/format.h>
 
+#include "../utils/lut_library.hpp"
 #include "../utils/stopwatch.hpp"
 #include "../views/topo_view.hpp"
 #include "cut_enumeration.hpp"
@@ -72,6 +78,23 @@ struct lut_mapping_params
   /*! \brief Number of rounds for exact area optimization. */
   uint32_t rounds_ela{1u};
 
+  /*! \brief LUT library for area and delay per LUT size.
+   *
+   * If no library is given, each LUT has unit area and unit delay.  If the
+   * library does not contain LUTs up to the cut size, the cut size is reduced
+   * to the largest LUT size in the library.
+   */
+  std::optional<lut_library> lut_lib;
+
+  /*! \brief Number of threads for exact area optimization.
+   *
+   * If larger than 1, the network is partitioned into output cones, and
+   * exact area optimization is performed for nodes that belong to a single
+   * partition on separate threads.  Nodes shared by several partitions are
+   * optimized afterwards on the main thread.
+   */
+  uint32_t ela_threads{1u};
+
   /*! \brief Be verbose. */
   bool verbose{false};
 };
@@ -86,8 +109,15 @@ struct lut_mapping_stats
   /*! \brief Total runtime. */
   stopwatch<>::duration time_total{0};
 
+  /*! \brief Area of the mapping (sum of LUT areas). */
+  float area{0};
+
+  /*! \brief Delay of the mapping. */
+  uint32_t delay{0};
+
   void report() const
   {
+    std::cout << fmt::format( "[i] area = {:.2f}, delay = {}\n", area, delay );
     std::cout << fmt::format( "[i] total time = {:>5.2f} secs\n", to_seconds( time_total ) );
   }
 };
@@ -114,6 +144,17 @@ public:
   using network_cuts_t = network_cuts<Ntk, StoreFunction, CutData>;
   using cut_t = typename network_cuts_t::cut_t;
 
+private:
+  /* temporary vectors to compute exact area and arrival times */
+  struct ela_scratch
+  {
+    std::vector<uint32_t> area;
+    std::vector<uint32_t> arrivals;
+  };
+
+  static constexpr uint32_t no_partition = std::numeric_limits<uint32_t>::max();
+  static constexpr uint32_t shared_partition = no_partition - 1;
+
 public:
   lut_mapping_impl( Ntk& ntk, lut_mapping_params const& ps, lut_mapping_stats& st )
       : ntk( ntk ),
@@ -123,9 +164,14 @@ public:
         map_refs( ntk.size(), 0 ),
         flows( ntk.size() ),
         delays( ntk.size() ),
-        cuts( cut_enumeration<Ntk, StoreFunction, CutData>( ntk, ps.cut_enumeration_ps ) )
+        cuts( cut_enumeration<Ntk, StoreFunction, CutData>( ntk, cut_enumeration_params_for( ps ) ) )
   {
     lut_mapping_update_cuts<CutData>().apply( cuts, ntk );
+
+    if ( ps.lut_lib )
+    {
+      update_cut_costs( *ps.lut_lib );
+    }
   }
 
   void run()
@@ -149,18 +195,93 @@ public:
       compute_mapping<false>();
     }
 
+    if ( ps.ela_threads > 1u && ps.rounds_ela > 0u )
+    {
+      compute_partitions();
+    }
+
     while ( iteration < ps.rounds + ps.rounds_ela )
     {
-      compute_mapping<true>();
+      if ( ps.ela_threads > 1u )
+      {
+        compute_mapping_parallel();
+      }
+      else
+      {
+        compute_mapping<true>();
+      }
     }
 
     derive_mapping();
+
+    st.area = area;
+    st.delay = delay;
   }
 
 private:
-  uint32_t cut_area( cut_t const& cut ) const
+  /* cuts must not be larger than the largest LUT in the library */
+  static cut_enumeration_params cut_enumeration_params_for( lut_mapping_params const& ps )
+  {
+    auto cut_ps = ps.cut_enumeration_ps;
+    if ( ps.lut_lib )
+    {
+      cut_ps.cut_size = std::min( cut_ps.cut_size, ps.lut_lib->max_lut_size() );
+    }
+    return cut_ps;
+  }
+
+  float cut_area( cut_t const& cut ) const
   {
-    return static_cast<uint32_t>( cut->data.cost );
+    return cut->data.cost;
+  }
+
+  /* recomputes area, delay, and area flow of all cuts according to a LUT
+   * library, and moves the cut with the best area flow to the front of each
+   * cut set. */
+  void update_cut_costs( lut_library const& lib )
+  {
+    constexpr auto mf_eps{0.005f};
+
+    std::vector<uint32_t> arrivals;
+    ntk.foreach_node( [&]( auto n ) {
+      if ( ntk.is_constant( n ) || ntk.is_pi( n ) )
+        return;
+
+      const auto index = ntk.node_to_index( n );
+      auto& cut_set = cuts.cuts( index );
+
+      int32_t best_cut{-1};
+      int32_t cut_index{-1};
+      for ( auto* cut : cut_set )
+      {
+        ++cut_index;
+        if ( cut->size() == 1 && *cut->begin() == index )
+          continue;
+
+        float flow = ( *cut )->data.cost = lib.area( cut->size() );
+        arrivals.clear();
+        for ( auto leaf : *cut )
+        {
+          const auto& best_leaf_cut = cuts.cuts( leaf )[0];
+          arrivals.push_back( best_leaf_cut->data.delay );
+          flow += best_leaf_cut->data.flow;
+        }
+        ( *cut )->data.delay = lib.arrival( arrivals );
+        ( *cut )->data.flow = flow / ntk.fanout_size( n );
+
+        auto const& best = cut_set[best_cut == -1 ? 0 : best_cut];
+        if ( best_cut == -1 || best->data.flow > ( *cut )->data.flow + mf_eps ||
+             ( best->data.flow > ( *cut )->data.flow - mf_eps && best->data.delay > ( *cut )->data.delay ) )
+        {
+          best_cut = cut_index;
+        }
+      }
+
+      if ( best_cut > 0 )
+      {
+        cut_set.update_best( best_cut );
+      }
+    } );
   }
 
   void init_nodes()
@@ -190,12 +311,139 @@ private:
     {
       if ( ntk.is_constant( n ) || ntk.is_pi( n ) )
         continue;
-      compute_best_cut<ELA>( ntk.node_to_index( n ) );
+      compute_best_cut<ELA>( ntk.node_to_index( n ), scratch );
     }
     set_mapping_refs<ELA>();
     //print_state();
   }
 
+  /* assigns each node to the output cone partition it belongs to, or marks
+   * it as shared if it is in the cones of several partitions */
+  void compute_partitions()
+  {
+    const auto num_parts = ps.ela_threads;
+    partitions.assign( ntk.size(), no_partition );
+
+    uint32_t num_pos = ntk.num_pos();
+    ntk.foreach_po( [&]( auto s, auto i ) {
+      const auto index = ntk.node_to_index( ntk.get_node( s ) );
+      const auto part = static_cast<uint32_t>( ( static_cast<uint64_t>( i ) * num_parts ) / num_pos );
+      if ( partitions[index] == no_partition )
+      {
+        partitions[index] = part;
+      }
+      else if ( partitions[index] != part )
+      {
+        partitions[index] = shared_partition;
+      }
+    } );
+
+    for ( auto it = top_order.rbegin(); it != top_order.rend(); ++it )
+    {
+      const auto part = partitions[ntk.node_to_index( *it )];
+      if ( part == no_partition || ntk.is_constant( *it ) || ntk.is_pi( *it ) )
+        continue;
+
+      ntk.foreach_fanin( *it, [&]( auto const& f ) {
+        auto& fpart = partitions[ntk.node_to_index( ntk.get_node( f ) )];
+        if ( fpart == no_partition )
+        {
+          fpart = part;
+        }
+        else if ( fpart != part )
+        {
+          fpart = shared_partition;
+        }
+      } );
+    }
+
+    /* node lists in topological order, one per partition, and one for shared
+     * and dangling nodes, which are optimized on the main thread */
+    partition_nodes.assign( num_parts + 1u, {} );
+    for ( auto const& n : top_order )
+    {
+      if ( ntk.is_constant( n ) || ntk.is_pi( n ) )
+        continue;
+
+      const auto part = partitions[ntk.node_to_index( n )];
+      partition_nodes[part < num_parts ? part : num_parts].push_back( n );
+    }
+  }
+
+  /* exact area round in which nodes of each partition are optimized on
+   * separate threads; cuts of nodes in a partition only contain nodes of the
+   * same partition or shared nodes, which are treated as terminals and are
+   * optimized afterwards on the main thread, together with dangling nodes */
+  void compute_mapping_parallel()
+  {
+    std::vector<std::thread> workers;
+    workers.reserve( ps.ela_threads );
+    for ( auto p = 0u; p < ps.ela_threads; ++p )
+    {
+      workers.emplace_back( [this, p]() {
+        ela_scratch local;
+        for ( auto const& n : partition_nodes[p] )
+        {
+          compute_best_cut<true>( ntk.node_to_index( n ), local, p );
+        }
+      } );
+    }
+    for ( auto& w : workers )
+    {
+      w.join();
+    }
+
+    /* reconcile references of shared nodes and optimize them */
+    recompute_mapping_refs();
+    for ( auto const& n : partition_nodes.back() )
+    {
+      compute_best_cut<true>( ntk.node_to_index( n ), scratch );
+    }
+
+    /* arrival times of partition nodes were computed from the arrival times
+     * of shared nodes before these were optimized */
+    recompute_delays();
+
+    set_mapping_refs<true>();
+  }
+
+  /* computes arrival times from scratch based on the best cuts */
+  void recompute_delays()
+  {
+    for ( auto const& n : top_order )
+    {
+      if ( ntk.is_constant( n ) || ntk.is_pi( n ) )
+        continue;
+
+      const auto index = ntk.node_to_index( n );
+      delays[index] = cut_flow( cuts.cuts( index )[0], scratch.arrivals ).second;
+    }
+  }
+
+  /* computes mapping references from scratch based on the best cuts */
+  void recompute_mapping_refs()
+  {
+    std::fill( map_refs.begin(), map_refs.end(), 0u );
+    ntk.foreach_po( [this]( auto s ) {
+      map_refs[ntk.node_to_index( ntk.get_node( s ) )]++;
+    } );
+
+    for ( auto it = top_order.rbegin(); it != top_order.rend(); ++it )
+    {
+      if ( ntk.is_constant( *it ) || ntk.is_pi( *it ) )
+        continue;
+
+      const auto index = ntk.node_to_index( *it );
+      if ( map_refs[index] == 0 )
+        continue;
+
+      for ( auto leaf : cuts.cuts( index )[0] )
+      {
+        map_refs[leaf]++;
+      }
+    }
+  }
+
   template<bool ELA>
   void set_mapping_refs()
   {
@@ -232,7 +480,7 @@ private:
           map_refs[leaf]++;
         }
       }
-      area++;
+      area += ps.lut_lib ? ps.lut_lib->area( cuts.cuts( index )[0].size() ) : 1.0f;
     }
 
     /* blend flow referenes */
@@ -244,11 +492,23 @@ private:
     ++iteration;
   }
 
-  std::pair<float, uint32_t> cut_flow( cut_t const& cut )
+  std::pair<float, uint32_t> cut_flow( cut_t const& cut, std::vector<uint32_t>& tmp_arrivals )
   {
     uint32_t time{0u};
     float flow{0.0f};
 
+    if ( ps.lut_lib )
+    {
+      tmp_arrivals.clear();
+      for ( auto leaf : cut )
+      {
+        tmp_arrivals.push_back( delays[leaf] );
+        flow += flows[leaf];
+      }
+
+      return {flow + cut_area( cut ), ps.lut_lib->arrival( tmp_arrivals )};
+    }
+
     for ( auto leaf : cut )
     {
       time = std::max( time, delays[leaf] );
@@ -258,21 +518,30 @@ private:
     return {flow + cut_area( cut ), time + 1u};
   }
 
+  /* checks whether recursion stops at a leaf, which is the case for constants
+   * and PIs, and for nodes outside of partition `part` (if given) */
+  bool is_terminal( uint32_t leaf, uint32_t part ) const
+  {
+    if ( part != no_partition && partitions[leaf] != part )
+      return true;
+    return ntk.is_constant( ntk.index_to_node( leaf ) ) || ntk.is_pi( ntk.index_to_node( leaf ) );
+  }
+
   /* reference cut:
    *   adds cut to current mapping and recursively adds best cuts of leaf
    *   nodes, if they are not part of the current mapping.
    */
-  uint32_t cut_ref( cut_t const& cut )
+  float cut_ref( cut_t const& cut, uint32_t part = no_partition )
   {
-    uint32_t count = cut_area( cut );
+    float count = cut_area( cut );
     for ( auto leaf : cut )
     {
-      if ( ntk.is_constant( ntk.index_to_node( leaf ) ) || ntk.is_pi( ntk.index_to_node( leaf ) ) )
+      if ( is_terminal( leaf, part ) )
         continue;
 
       if ( map_refs[leaf]++ == 0 )
       {
-        count += cut_ref( cuts.cuts( leaf )[0] );
+        count += cut_ref( cuts.cuts( leaf )[0], part );
       }
     }
     return count;
@@ -283,17 +552,17 @@ private:
    *   leaf nodes, if they are part of the current mapping.
    *   (this is the inverse operation to cut_ref)
    */
-  uint32_t cut_deref( cut_t const& cut )
+  float cut_deref( cut_t const& cut, uint32_t part = no_partition )
   {
-    uint32_t count = cut_area( cut );
+    float count = cut_area( cut );
     for ( auto leaf : cut )
     {
-      if ( ntk.is_constant( ntk.index_to_node( leaf ) ) || ntk.is_pi( ntk.index_to_node( leaf ) ) )
+      if ( is_terminal( leaf, part ) )
         continue;
 
       if ( --map_refs[leaf] == 0 )
       {
-        count += cut_deref( cuts.cuts( leaf ).best() );
+        count += cut_deref( cuts.cuts( leaf ).best(), part );
       }
     }
     return count;
@@ -305,21 +574,21 @@ private:
    *   2. it remembers all cuts for which the reference count increases in the
    *      vector `tmp_area`.
    */
-  uint32_t cut_ref_limit_save( cut_t const& cut, uint32_t limit )
+  float cut_ref_limit_save( cut_t const& cut, uint32_t limit, std::vector<uint32_t>& tmp_area, uint32_t part )
   {
-    uint32_t count = cut_area( cut );
+    float count = cut_area( cut );
     if ( limit == 0 )
       return count;
 
     for ( auto leaf : cut )
     {
-      if ( ntk.is_constant( ntk.index_to_node( leaf ) ) || ntk.is_pi( ntk.index_to_node( leaf ) ) )
+      if ( is_terminal( leaf, part ) )
         continue;
 
       tmp_area.push_back( leaf );
       if ( map_refs[leaf]++ == 0 )
       {
-        count += cut_ref_limit_save( cuts.cuts( leaf ).best(), limit - 1 );
+        count += cut_ref_limit_save( cuts.cuts( leaf ).best(), limit - 1, tmp_area, part );
       }
     }
     return count;
@@ -330,10 +599,10 @@ private:
    *   would be needed to add to the mapping if `cut` were to be added.  It
    *   temporarily modifies the reference counters but reverts them eventually.
    */
-  uint32_t cut_area_estimation( cut_t const& cut )
+  float cut_area_estimation( cut_t const& cut, std::vector<uint32_t>& tmp_area, uint32_t part )
   {
     tmp_area.clear();
-    const auto count = cut_ref_limit_save( cut, 8 );
+    const auto count = cut_ref_limit_save( cut, 8, tmp_area, part );
     for ( auto const& n : tmp_area )
     {
       map_refs[n]--;
@@ -342,7 +611,7 @@ private:
   }
 
   template<bool ELA>
-  void compute_best_cut( uint32_t index )
+  void compute_best_cut( uint32_t index, ela_scratch& tmp, uint32_t part = no_partition )
   {
     constexpr auto mf_eps{0.005f};
 
@@ -357,7 +626,7 @@ private:
     {
       if ( map_refs[index] > 0 )
       {
-        cut_deref( cuts.cuts( index )[0] );
+        cut_deref( cuts.cuts( index )[0], part );
       }
     }
 
@@ -369,11 +638,11 @@ private:
 
       if constexpr ( ELA )
       {
-        flow = static_cast<float>( cut_area_estimation( *cut ) );
+        flow = cut_area_estimation( *cut, tmp.area, part );
       }
       else
       {
-        std::tie( flow, time ) = cut_flow( *cut );
+        std::tie( flow, time ) = cut_flow( *cut, tmp.arrivals );
       }
 
       if ( best_cut == -1 || best_flow > flow + mf_eps || ( best_flow > flow - mf_eps && best_time > time ) )
@@ -391,7 +660,7 @@ private:
     {
       if ( map_refs[index] > 0 )
       {
-        cut_ref( cuts.cuts( index )[best_cut] );
+        cut_ref( cuts.cuts( index )[best_cut], part );
       }
     }
     else
@@ -400,7 +669,7 @@ private:
     }
     if constexpr ( ELA )
     {
-      best_time = cut_flow( cuts.cuts( index )[best_cut] ).second;
+      best_time = cut_flow( cuts.cuts( index )[best_cut], tmp.arrivals ).second;
     }
     delays[index] = best_time;
     flows[index] = best_flow / flow_refs[index];
@@ -455,7 +724,7 @@ private:
 
   uint32_t iteration{0}; /* current mapping iteration */
   uint32_t delay{0};     /* current delay of the mapping */
-  uint32_t area{0};      /* current area of the mapping */
+  float area{0};         /* current area of the mapping */
   //bool ela{false};       /* compute exact area */
 
   std::vector<node<Ntk>> top_order;
@@ -465,7 +734,9 @@ private:
   std::vector<uint32_t> delays;
   network_cuts_t cuts;
 
-  std::vector<uint32_t> tmp_area; /* temporary vector to compute exact area */
+  std::vector<uint32_t> partitions; /* output cone partition of each node (parallel exact area) */
+  std::vector<std::vector<node<Ntk>>> partition_nodes; /* nodes of each partition in topological order (parallel exact area) */
+  ela_scratch scratch;
 };
 
 }; /* namespace detail */
@@ -484,7 +755,11 @@ private:
  *
  * - `uint32_t delay`
  * - `float flow`
- * - `float costs`
+ * - `float cost`
+ *
+ * If a LUT library is passed in `ps.lut_lib`, the area and delay of each cut
+ * are taken from the library entry for the cut's size instead of assuming
+ * unit area and delay for all LUTs.
  *
  * See `include/mockturtle/algorithms/cut_enumeration/mf_cut.hpp` for one
  * example of a CutData type that implements the cost function that is used in
@@ -503,6 +778,7 @@ private:
  * - `clear_mapping`
  * - `add_to_mapping`
  * - `set_lut_funtion` (if `StoreFunction` is true)
+ * - `num_pos` and `foreach_fanin` (if `ps.ela_threads` is larger than 1)
  *
    \verbatim embed:rst
 
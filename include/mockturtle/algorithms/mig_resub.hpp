@@ -703,9 +703,8 @@ void mig_resubstitution( Ntk& ntk, resubstitution_params const& ps = {}, resubst
   static_assert( has_level_v<Ntk>, "Ntk does not implement the level method" );
   static_assert( has_foreach_fanout_v<Ntk>, "Ntk does not implement the foreach_fanout method" );
 
-  if ( ps.max_pis == 8 )
-  {
-    using truthtable_t = kitty::static_truth_table<8u>;
+  detail::with_window_truth_table( ps.max_pis, [&]( auto tt ) {
+    using truthtable_t = decltype( tt );
     using truthtable_dc_t = kitty::dynamic_truth_table;
     using resub_impl_t = detail::resubstitution_impl<Ntk, typename detail::window_based_resub_engine<Ntk, truthtable_t, truthtable_dc_t, mig_resub_functor<Ntk, typename detail::window_simulator<Ntk, truthtable_t>, truthtable_dc_t>>>;
 
@@ -727,32 +726,7 @@ void mig_resubstitution( Ntk& ntk, resubstitution_params const& ps = {}, resubst
     {
       *pst = st;
     }
-  }
-  else
-  {
-    using truthtable_t = kitty::dynamic_truth_table;
-    using truthtable_dc_t = kitty::dynamic_truth_table;
-    using resub_impl_t = detail::resubstitution_impl<Ntk, typename detail::window_based_resub_engine<Ntk, truthtable_t, truthtable_dc_t, mig_resub_functor<Ntk, typename detail::window_simulator<Ntk, truthtable_t>, truthtable_dc_t>>>;
-
-    resubstitution_stats st;
-    typename resub_impl_t::engine_st_t engine_st;
-    typename resub_impl_t::collector_st_t collector_st;
-
-    resub_impl_t p( ntk, ps, st, engine_st, collector_st );
-    p.run();
-
-    if ( ps.verbose )
-    {
-      st.report();
-      collector_st.report();
-      engine_st.report();
-    }
-
-    if ( pst )
-    {
-      *pst = st;
-    }
-  }
+  } );
 }
 
 } /* namespace mockturtle */
@@ -39,7 +39,10 @@
 #include <filesystem>
 #endif
 #include <fstream>
-#include <unordered_set>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <type_traits>
 #include <kitty/dynamic_truth_table.hpp>
 #include <kitty/hash.hpp>
 #include <nlohmann/json.hpp>
@@ -47,6 +50,8 @@
 #include "traits.hpp"
 #include "../../traits.hpp"
 #include "../../algorithms/cleanup.hpp"
+#include "../../io/verilog_reader.hpp"
+#include "../../utils/binary_utils.hpp"
 #include "../../utils/json_utils.hpp"
 #include "../../utils/network_cache.hpp"
 
@@ -74,29 +79,43 @@ void from_json( nlohmann::json const& j, no_blacklist_cache_info& info )
   (void)info;
 }
 
+/*! \brief Resynthesis function with a persistent cache.
+ *
+ * Calls `resyn_fn` for functions that have not been resynthesized before,
+ * and otherwise rebuilds the cached network for the function.  Functions
+ * for which `resyn_fn` does not find a network are stored in a blacklist,
+ * together with `blacklist_cache_info`.  A blacklisted function is tried
+ * again, if `retry` of the current info returns `true` for the stored
+ * info.
+ *
+ * If a file name is given, the cache is loaded from the file on
+ * construction, and new entries are appended to the file when calling
+ * `save` and on destruction.  The file is in a binary format, which starts
+ * with a magic number and a version, followed by the number of inputs of
+ * the cache, and a sequence of records for cached networks and blacklisted
+ * functions.  Files in the previous JSON format are read and replaced by a
+ * binary file when saving; the replaced file is kept as a backup with the
+ * suffix `.bak`, if it could not be read completely.  Files that are neither
+ * in the binary format of this version nor in the JSON format, e.g., files
+ * written by a newer version, are never overwritten, and the cache is then
+ * not saved.
+ *
+ * Copies of a cached resynthesis function share the same cache.  The cache
+ * can be accessed concurrently, such that copies can be used in different
+ * threads, if `resyn_fn` can be copied and each copy is only used by one
+ * thread.  The cache is saved after the last copy is destroyed.  Trivially
+ * copyable blacklist infos are stored as bytes, and other blacklist infos
+ * are stored in JSON using `to_json` and `from_json`.
+ */
 template<class Ntk, class ResynthesisFn, class BlacklistCacheInfo = no_blacklist_cache_info>
 class cached_resynthesis
 {
 public:
   explicit cached_resynthesis( ResynthesisFn const& resyn_fn, uint32_t max_pis, std::string const& cache_filename = {}, BlacklistCacheInfo const& blacklist_cache_info = {} )
     : _resyn_fn( resyn_fn ),
-      _cache( max_pis ),
-      _cache_filename( cache_filename ),
-      _blacklist_cache_info( blacklist_cache_info ),
-      _initial_size( max_pis )
+      _shared( std::make_shared<shared_cache>( cache_filename, max_pis ) ),
+      _blacklist_cache_info( blacklist_cache_info )
   {
-    if ( !_cache_filename.empty() )
-    {
-      load();
-    }
-  }
-
-  ~cached_resynthesis()
-  {
-    if ( !_cache_filename.empty() )
-    {
-      save();
-    }
   }
 
 private:
@@ -115,61 +134,288 @@ private:
     kitty::hash<kitty::dynamic_truth_table> _h;
   };
 
-  using blacklist_cache_key_t = std::pair<kitty::dynamic_truth_table, BlacklistCacheInfo>;
+  static constexpr uint32_t cache_magic = 0x4352544du; /* "MTRC" */
+  static constexpr uint32_t cache_version = 1u;
+
+  enum record_kind : uint8_t
+  {
+    record_entry = 0u,
+    record_blacklist = 1u
+  };
 
-  struct blacklist_cache_hash
+  /* cache that is shared by all copies of the resynthesis function */
+  struct shared_cache
   {
-    std::size_t operator()( const blacklist_cache_key_t& p ) const
+    shared_cache( std::string const& filename, uint32_t initial_size )
+        : filename( filename ),
+          initial_size( initial_size )
     {
-      return _h( p.first );
+      if ( !filename.empty() )
+      {
+        load();
+      }
     }
 
-  private:
-    kitty::hash<kitty::dynamic_truth_table> _h;
-  };
+    ~shared_cache()
+    {
+      if ( !filename.empty() )
+      {
+        save();
+      }
+    }
 
-  struct blacklist_cache_equal
-  {
-    bool operator()( const blacklist_cache_key_t& lhs, const blacklist_cache_key_t& rhs ) const
+    void load()
     {
-      return lhs.first == rhs.first;
+      std::ifstream is( filename.c_str(), std::ifstream::in | std::ifstream::binary );
+      if ( !is.good() || is.peek() == std::ifstream::traits_type::eof() )
+        return;
+
+      uint32_t magic, version, size;
+      if ( !detail::read_binary( is, magic ) || magic != cache_magic )
+      {
+        is.close();
+        load_json();
+        return;
+      }
+      if ( !detail::read_binary( is, version ) || version != cache_version || !detail::read_binary( is, size ) )
+      {
+        /* unknown version, the file is kept */
+        read_only = true;
+        return;
+      }
+      initial_size = size;
+
+      /* records are read until the end of the file; the records after a
+       * corrupt or incomplete record, e.g., from an interrupted save, are
+       * dropped, and the file is kept as backup when rewriting it */
+      uint8_t kind;
+      while ( detail::read_binary( is, kind ) )
+      {
+        kitty::dynamic_truth_table function;
+        if ( kind == record_entry )
+        {
+          cache_key_t key;
+          typename decltype( cache )::entry_t entry;
+          if ( !detail::read_binary_value( is, key ) || !detail::read_binary_value( is, entry ) )
+          {
+            rewrite = keep_backup = true;
+            break;
+          }
+          cache.insert( key, entry, false );
+        }
+        else if ( kind == record_blacklist )
+        {
+          BlacklistCacheInfo info;
+          if ( !detail::read_binary_value( is, function ) || !read_info( is, info ) )
+          {
+            rewrite = keep_backup = true;
+            break;
+          }
+          blacklist.assign( function, info, false );
+        }
+        else
+        {
+          rewrite = keep_backup = true;
+          break;
+        }
+      }
     }
-  };
 
-  bool is_blacklisted( kitty::dynamic_truth_table const& tt )
-  {
-    auto it = _blacklist_cache.find( {tt, _blacklist_cache_info} );
+    static void write_info( std::ostream& os, BlacklistCacheInfo const& info )
+    {
+      if constexpr ( std::is_trivially_copyable_v<BlacklistCacheInfo> )
+      {
+        detail::write_binary( os, info );
+      }
+      else
+      {
+        const auto text = nlohmann::json( info ).dump();
+        detail::write_binary_value( os, std::vector<char>( text.begin(), text.end() ) );
+      }
+    }
 
-    /* function cannot be found in black list cache */
-    if ( it == _blacklist_cache.end() )
+    static bool read_info( std::istream& is, BlacklistCacheInfo& info )
     {
-      return false;
+      if constexpr ( std::is_trivially_copyable_v<BlacklistCacheInfo> )
+      {
+        return detail::read_binary( is, info );
+      }
+      else
+      {
+        std::vector<char> text;
+        if ( !detail::read_binary_value( is, text ) )
+        {
+          return false;
+        }
+        try
+        {
+          nlohmann::json::parse( text.begin(), text.end() ).get_to( info );
+        }
+        catch ( nlohmann::json::exception const& )
+        {
+          return false;
+        }
+        return true;
+      }
     }
-    /* newer black list info, erase old entry from cache */
-    else if ( _blacklist_cache_info.retry( it->second ) )
+
+    /* previous format */
+    void load_json()
     {
-      _blacklist_cache.erase( it );
-      return false;
+      std::ifstream is( filename.c_str(), std::ifstream::in );
+      nlohmann::json data;
+      try
+      {
+        is >> data;
+      }
+      catch ( nlohmann::json::exception const& )
+      {
+        /* unknown format, the file is kept */
+        read_only = true;
+        return;
+      }
+
+      data["initial_size"].get_to( initial_size );
+
+      auto const& db = data["cache"];
+      std::istringstream sstr( db["db"].get<std::string>() );
+      Ntk read_ntk;
+      lorina::read_verilog( sstr, verilog_reader( read_ntk ) );
+
+      std::vector<signal<Ntk>> pis;
+      read_ntk.foreach_pi( [&]( auto const& n ) {
+        pis.push_back( read_ntk.make_signal( n ) );
+      } );
+      std::vector<signal<Ntk>> pos;
+      read_ntk.foreach_po( [&]( auto const& f ) {
+        pos.push_back( f );
+      } );
+
+      auto cntr = 0u;
+      for ( auto const& key : db["output_functions"].get<std::vector<cache_key_t>>() )
+      {
+        if ( const auto entry = decltype( cache )::encode( read_ntk, pos.at( cntr++ ), pis.begin(), pis.end() ); entry )
+        {
+          cache.insert( key, *entry, false );
+        }
+      }
+
+      for ( auto const& [function, info] : data["blacklist_cache"].get<std::vector<std::pair<kitty::dynamic_truth_table, BlacklistCacheInfo>>>() )
+      {
+        blacklist.assign( function, info, false );
+      }
+
+      rewrite = true;
     }
-    /* function is black listed */
-    else
+
+    /* appends new entries, or writes all entries into a new file; returns
+     * false, if the file is not written */
+    bool save()
     {
+#if __GNUC__ == 7
+      namespace fs = std::experimental::filesystem::v1;
+#else
+      namespace fs = std::filesystem;
+#endif
+
+      std::lock_guard<std::mutex> lock( file_mutex );
+
+      if ( read_only )
+      {
+        return false;
+      }
+
+      const auto append = !rewrite && fs::exists( filename ) && fs::file_size( filename ) > 0u;
+
+      // make a backup of existing cache file, if it is replaced
+      std::string backup_filename = fmt::format( "{}.bak", filename );
+      if ( !append && fs::exists( filename ) )
+      {
+        fs::copy( filename, backup_filename, fs::copy_options::overwrite_existing );
+      }
+
+      std::ofstream os( filename.c_str(), std::ofstream::out | std::ofstream::binary | ( append ? std::ofstream::app : std::ofstream::trunc ) );
+      if ( !os.good() )
+      {
+        return false;
+      }
+      if ( !append )
+      {
+        detail::write_binary<uint32_t>( os, cache_magic );
+        detail::write_binary<uint32_t>( os, cache_version );
+        detail::write_binary<uint32_t>( os, initial_size );
+      }
+
+      cache.flush( [&]( auto const& key, auto const& entry ) {
+        detail::write_binary<uint8_t>( os, record_entry );
+        detail::write_binary_value( os, key );
+        detail::write_binary_value( os, entry );
+      }, append );
+      blacklist.flush( [&]( auto const& function, auto const& info ) {
+        detail::write_binary<uint8_t>( os, record_blacklist );
+        detail::write_binary_value( os, function );
+        write_info( os, info );
+      }, append );
+      os.close();
+      if ( !os )
+      {
+        return false;
+      }
+      rewrite = false;
+
+      /* the backup is only removed, if all of its contents were loaded */
+      if ( !keep_backup && fs::exists( backup_filename ) )
+      {
+        fs::remove( backup_filename );
+      }
       return true;
     }
+
+    std::string filename;
+    uint32_t initial_size;
+
+    concurrent_network_cache<cache_key_t, cache_hash> cache;
+    detail::sharded_map<kitty::dynamic_truth_table, BlacklistCacheInfo, kitty::hash<kitty::dynamic_truth_table>> blacklist;
+
+    std::mutex file_mutex;
+    bool rewrite{false};
+    bool keep_backup{false};
+    bool read_only{false};
+  };
+
+  bool is_blacklisted( kitty::dynamic_truth_table const& tt ) const
+  {
+    const auto info = _shared->blacklist.find( tt );
+
+    /* function is black listed, unless the black list info is newer */
+    return info && !_blacklist_cache_info.retry( *info );
+  }
+
+  /* leaves, followed by existing functions starting at index `initial_size` */
+  template<typename LeavesIterator>
+  std::vector<signal<Ntk>> inputs( Ntk& ntk, LeavesIterator begin, LeavesIterator end ) const
+  {
+    std::vector<signal<Ntk>> signals( _shared->initial_size + _existing_signals.size(), ntk.get_constant( false ) );
+    std::copy( begin, end, signals.begin() );
+    std::copy( _existing_signals.begin(), _existing_signals.end(), signals.begin() + _shared->initial_size );
+    return signals;
   }
 
 public:
   template<typename LeavesIterator, typename Fn>
   void operator()( Ntk& ntk, kitty::dynamic_truth_table const& function, LeavesIterator begin, LeavesIterator end, Fn&& fn )
   {
-    if ( auto const key = std::make_pair( function, _existing_functions );
-         _cache.has( key ) )
+    if ( static_cast<uint32_t>( std::distance( begin, end ) ) > _shared->initial_size )
+    {
+      return; /* too many leaves */
+    }
+
+    const auto key = std::make_pair( function, _existing_functions );
+    const auto signals = inputs( ntk, begin, end );
+    if ( const auto f = _shared->cache.get( ntk, key, signals.begin(), signals.end() ); f )
     {
       ++_cache_hits;
-      std::vector<signal<Ntk>> signals( _cache.pis().size(), ntk.get_constant( false ) );
-      std::copy( begin, end, signals.begin() );
-      std::copy( _existing_signals.begin(), _existing_signals.end(), signals.begin() + _initial_size );
-      fn( cleanup_dangling( _cache.get_view( key ), ntk, signals.begin(), signals.end() ).front() );
+      fn( *f );
     }
     else if ( is_blacklisted( function ) )
     {
@@ -183,25 +429,22 @@ public:
         if ( !found_one )
         {
           ++_cache_misses;
-          _cache.insert_signal( key, f );
+          _shared->cache.insert_signal( ntk, key, f, signals.begin(), signals.end() );
           found_one = true;
-
-          std::vector<signal<Ntk>> signals( _cache.pis().size(), ntk.get_constant( false ) );
-          std::copy( begin, end, signals.begin() );
-          std::copy( _existing_signals.begin(), _existing_signals.end(), signals.begin() + _initial_size );
-          fn( cleanup_dangling( _cache.get_view( key ), ntk, signals.begin(), signals.end() ).front() );
+          fn( f );
         }
+        return false; /* only the first candidate is used */
       };
 
-      _resyn_fn( _cache.network(), function, _cache.pis().begin(), _cache.pis().begin() + function.num_vars(), on_signal );
+      _resyn_fn( ntk, function, begin, end, on_signal );
 
       if ( !found_one )
       {
-        _blacklist_cache.insert( {function, _blacklist_cache_info} );
+        _shared->blacklist.assign( function, _blacklist_cache_info );
       }
     }
   }
-  
+
   void set_bounds( std::optional<uint32_t> const& lower_bound, std::optional<uint32_t> const& upper_bound )
   {
     if constexpr ( has_set_bounds_v<ResynthesisFn> )
@@ -224,80 +467,39 @@ public:
   {
     if constexpr ( has_add_function_v<ResynthesisFn, Ntk> )
     {
-      // index of cache PI to foward
-      const auto pi_index = _initial_size + _existing_signals.size();
-
       _existing_signals.push_back( s );
       _existing_functions.push_back( tt );
-      _cache.ensure_pis( _initial_size + _existing_functions.size() );
 
-      _resyn_fn.add_function( _cache.pis()[pi_index], tt );
+      _resyn_fn.add_function( s, tt );
     }
     else
     {
       // TODO assert or warn?
     }
   }
-    
-  void report() const
-  {
-    fmt::print( "[i] cache hits              = {}\n", _cache_hits );
-    fmt::print( "[i] cache misses            = {}\n", _cache_misses );
-    fmt::print( "[i] size of cache           = {}\n", _cache.size() );
-    fmt::print( "[i] size of blacklist cache = {}\n", _blacklist_cache.size() );
-  }
 
-private:
-  void load()
+  /*! \brief Appends new entries to the cache file.
+   *
+   * Returns false, if the cache has no file name, if the file is in an
+   * unknown format, or if it cannot be written.
+   */
+  bool save()
   {
-    std::ifstream is( _cache_filename.c_str(), std::ifstream::in );
-    if ( !is.good() ) return;
-    nlohmann::json data;
-    is >> data;
-
-    _cache.insert_json( data["cache"] );
-    data["blacklist_cache"].get_to( _blacklist_cache );
-    data["initial_size"].get_to( _initial_size );
+    return !_shared->filename.empty() && _shared->save();
   }
 
-  void save()
+  void report() const
   {
-#if __GNUC__ == 7
-    namespace fs = std::experimental::filesystem::v1;
-#else
-    namespace fs = std::filesystem;
-#endif
-
-    nlohmann::json data{
-      {"cache", _cache.to_json()},
-      {"blacklist_cache", _blacklist_cache},
-      {"initial_size", _initial_size}
-    };
-
-    // make a backup of existing cache file, if it exists
-    std::string _backup_filename = fmt::format( "{}.bak", _cache_filename );
-    if ( fs::exists( _cache_filename ) )
-    {
-      fs::copy( _cache_filename, _backup_filename );
-    }
-
-    std::ofstream os( _cache_filename.c_str(), std::ofstream::out );
-    os << data.dump() << "\n";
-    os.close();
-
-    if ( fs::exists( _backup_filename ) )
-    {
-      fs::remove( _backup_filename );
-    }
+    fmt::print( "[i] cache hits              = {}\n", _cache_hits );
+    fmt::print( "[i] cache misses            = {}\n", _cache_misses );
+    fmt::print( "[i] size of cache           = {}\n", _shared->cache.size() );
+    fmt::print( "[i] size of blacklist cache = {}\n", _shared->blacklist.size() );
   }
 
 private:
   ResynthesisFn _resyn_fn;
-  network_cache<Ntk, cache_key_t, cache_hash> _cache;
-  std::unordered_set<blacklist_cache_key_t, blacklist_cache_hash, blacklist_cache_equal> _blacklist_cache;
-  std::string _cache_filename;
+  std::shared_ptr<shared_cache> _shared;
   BlacklistCacheInfo _blacklist_cache_info;
-  uint32_t _initial_size{};
 
   std::vector<kitty::dynamic_truth_table> _existing_functions;
   std::vector<signal<Ntk>> _existing_signals;
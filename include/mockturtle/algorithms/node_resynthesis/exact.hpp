@@ -32,25 +32,49 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <fstream>
 #include <iostream>
+#include <iterator>
 #include <memory>
+#include <mutex>
+#include <numeric>
 #include <optional>
+#include <string>
+#include <thread>
+#include <tuple>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
+#include <kitty/constructors.hpp>
 #include <kitty/dynamic_truth_table.hpp>
 #include <kitty/hash.hpp>
+#include <kitty/npn.hpp>
+#include <kitty/operations.hpp>
+#include <kitty/operators.hpp>
 #include <kitty/print.hpp>
 #include <kitty/traits.hpp>
 
 #include "../../networks/aig.hpp"
 #include "../../networks/xmg.hpp"
 #include "../../networks/klut.hpp"
+#include "../../utils/binary_utils.hpp"
 #include "../../utils/include/percy.hpp"
 
 namespace mockturtle
 {
 
+/*! \brief Solver, encoder, and synthesis method for portfolio synthesis. */
+struct exact_portfolio_entry
+{
+  percy::SolverType solver_type = percy::SLV_BSAT2;
+  percy::EncoderType encoder_type = percy::ENC_SSV;
+  percy::SynthMethod synthesis_method = percy::SYNTH_STD;
+};
+
 struct exact_resynthesis_params
 {
   using cache_map_t = std::unordered_map<kitty::dynamic_truth_table, percy::chain, kitty::hash<kitty::dynamic_truth_table>>;
@@ -71,13 +95,426 @@ struct exact_resynthesis_params
   bool add_symvar_clauses{true};
   int conflict_limit{0};
 
+  /*! \brief Key cache and blacklist entries by NPN representative.
+   *
+   * If true, the cache and the blacklist store entries for the NPN
+   * representative of a function (for functions with up to 6 variables), and
+   * the NPN transformation is applied when a cached entry is used.  Functions
+   * that only differ in input permutation, input negation, and output
+   * negation share a single entry.
+   */
+  bool use_npn_cache{false};
+
   percy::SolverType solver_type = percy::SLV_BSAT2;
 
   percy::EncoderType encoder_type = percy::ENC_SSV;
 
   percy::SynthMethod synthesis_method = percy::SYNTH_STD;
+
+  /*! \brief Configurations for portfolio synthesis.
+   *
+   * If not empty, each function is synthesized by running all configurations
+   * in parallel, one thread per configuration, instead of using
+   * `solver_type`, `encoder_type`, and `synthesis_method`.  The first
+   * configuration that finds an optimum chain wins, and all other threads
+   * are cancelled.  The conflict limit is a limit per configuration.
+   * Note that not all encoders support the gate primitive restriction used
+   * by `exact_aig_resynthesis`.
+   */
+  std::vector<exact_portfolio_entry> portfolio;
+
+  /*! \brief Number of threads used by `synthesize_batch`. */
+  uint32_t num_threads{1u};
 };
 
+namespace detail
+{
+
+/* returns the function to synthesize and the NPN transformation to apply;
+ * functions that are found in `cache` are not canonized */
+inline std::tuple<kitty::dynamic_truth_table, uint32_t, std::vector<uint8_t>> exact_cache_key( kitty::dynamic_truth_table const& function, bool use_npn, exact_resynthesis_params::cache_t const& cache = nullptr )
+{
+  if ( use_npn && function.num_vars() <= 6u && !( cache && cache->count( function ) ) )
+  {
+    return kitty::exact_npn_canonization( function );
+  }
+
+  std::vector<uint8_t> perm( function.num_vars() );
+  std::iota( perm.begin(), perm.end(), 0u );
+  return {function, 0u, perm};
+}
+
+inline void write_binary_truth_table( std::ostream& os, kitty::dynamic_truth_table const& tt )
+{
+  write_binary<uint8_t>( os, static_cast<uint8_t>( tt.num_vars() ) );
+  for ( auto word : tt )
+  {
+    write_binary<uint64_t>( os, word );
+  }
+}
+
+/* cut functions and operators of chains have at most 6 variables */
+inline constexpr uint8_t exact_cache_max_vars = 6u;
+
+inline std::optional<kitty::dynamic_truth_table> read_binary_truth_table( std::istream& is )
+{
+  uint8_t num_vars;
+  if ( !read_binary( is, num_vars ) || num_vars > exact_cache_max_vars )
+  {
+    return std::nullopt;
+  }
+
+  kitty::dynamic_truth_table tt( num_vars );
+  for ( auto& word : tt )
+  {
+    if ( !read_binary( is, word ) )
+    {
+      return std::nullopt;
+    }
+  }
+  tt.mask_bits();
+  return tt;
+}
+
+/* synthesizes a chain with a single configuration or with a portfolio */
+inline percy::synth_result exact_synthesize( percy::spec& spec, percy::chain& chain, exact_resynthesis_params const& ps )
+{
+  if ( ps.portfolio.empty() )
+  {
+    return percy::synthesize( spec, chain, ps.solver_type, ps.encoder_type, ps.synthesis_method );
+  }
+
+  /* Each worker solves with increasing conflict limits, such that it can be
+   * cancelled in between.  Since percy increases the number of steps starting
+   * from `initial_steps`, and it only moves on after the current number has
+   * been proven unrealizable, a worker resumes at the number of steps at
+   * which it timed out.  Therefore, each worker's result is optimum.  Slices
+   * grow only up to a fixed size, such that a worker notices the cancellation
+   * after a bounded amount of work. */
+  constexpr int initial_conflict_slice = 1000;
+  constexpr int max_conflict_slice = 64000;
+
+  std::atomic<bool> done{false};
+  std::mutex mutex;
+  std::optional<percy::chain> best;
+  bool has_failure{false};
+
+  const auto worker = [&]( exact_portfolio_entry const& entry ) {
+    auto local_spec = spec;
+    auto solver = percy::get_solver( entry.solver_type );
+    auto encoder = percy::get_encoder( *solver, entry.encoder_type );
+
+    int slice = initial_conflict_slice;
+    int spent = 0;
+    while ( !done )
+    {
+      local_spec.conflict_limit = ps.conflict_limit > 0 ? std::min( slice, ps.conflict_limit - spent ) : slice;
+
+      percy::chain local_chain;
+      const auto result = percy::synthesize( local_spec, local_chain, *solver, *encoder, entry.synthesis_method );
+      if ( result == percy::success )
+      {
+        std::lock_guard lock( mutex );
+        if ( !done.exchange( true ) )
+        {
+          best = local_chain;
+        }
+        return;
+      }
+      if ( result == percy::failure )
+      {
+        std::lock_guard lock( mutex );
+        has_failure = true;
+        return;
+      }
+
+      spent += local_spec.conflict_limit;
+      if ( ps.conflict_limit > 0 && spent >= ps.conflict_limit )
+      {
+        return;
+      }
+      local_spec.initial_steps = std::max( local_spec.initial_steps, local_spec.nr_steps );
+      slice = std::min( 2 * slice, max_conflict_slice );
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for ( auto const& entry : ps.portfolio )
+  {
+    threads.emplace_back( worker, std::cref( entry ) );
+  }
+  for ( auto& t : threads )
+  {
+    t.join();
+  }
+
+  if ( best )
+  {
+    chain = *best;
+    return percy::success;
+  }
+  return has_failure ? percy::failure : percy::timeout;
+}
+
+/* synthesizes all distinct functions that are not cached yet in parallel */
+template<typename MakeSpecFn>
+void exact_synthesize_batch( std::vector<kitty::dynamic_truth_table> const& functions, exact_resynthesis_params const& ps, MakeSpecFn&& make_spec, bool use_blacklist, bool denormalize )
+{
+  if ( !ps.cache )
+  {
+    return;
+  }
+
+  std::vector<kitty::dynamic_truth_table> keys;
+  std::unordered_set<kitty::dynamic_truth_table, kitty::hash<kitty::dynamic_truth_table>> seen;
+  for ( auto const& function : functions )
+  {
+    auto key = std::get<0>( exact_cache_key( function, ps.use_npn_cache, ps.cache ) );
+    if ( ps.cache->count( key ) || seen.count( key ) )
+    {
+      continue;
+    }
+    if ( use_blacklist && ps.blacklist_cache )
+    {
+      if ( const auto it = ps.blacklist_cache->find( key ); it != ps.blacklist_cache->end() && ps.conflict_limit >= it->second )
+      {
+        continue;
+      }
+    }
+    seen.insert( key );
+    keys.push_back( key );
+  }
+
+  std::vector<percy::synth_result> results( keys.size(), percy::failure );
+  std::vector<percy::chain> chains( keys.size() );
+  std::atomic<std::size_t> next{0u};
+
+  const auto worker = [&]() {
+    for ( auto i = next++; i < keys.size(); i = next++ )
+    {
+      auto spec = make_spec( keys[i] );
+      results[i] = exact_synthesize( spec, chains[i], ps );
+      if ( results[i] == percy::success && denormalize )
+      {
+        chains[i].denormalize();
+      }
+    }
+  };
+
+  const auto num_threads = std::min<std::size_t>( std::max( ps.num_threads, 1u ), keys.size() );
+  std::vector<std::thread> threads;
+  for ( auto t = 1u; t < num_threads; ++t )
+  {
+    threads.emplace_back( worker );
+  }
+  worker();
+  for ( auto& t : threads )
+  {
+    t.join();
+  }
+
+  for ( auto i = 0u; i < keys.size(); ++i )
+  {
+    if ( results[i] == percy::success )
+    {
+      ( *ps.cache )[keys[i]] = chains[i];
+    }
+    else if ( use_blacklist && ps.blacklist_cache )
+    {
+      ( *ps.blacklist_cache )[keys[i]] = results[i] == percy::timeout ? ps.conflict_limit : 0;
+    }
+  }
+}
+
+inline constexpr uint32_t exact_cache_magic = 0x4345544du; /* "MTEC" */
+inline constexpr uint32_t exact_cache_version = 1u;
+
+} /* namespace detail */
+
+/*! \brief Writes exact synthesis caches to a binary stream.
+ *
+ * Writes the entries of `ps.cache` and `ps.blacklist_cache`, if set, in a
+ * compact binary format that can be read with
+ * `read_exact_resynthesis_cache`.  Truth tables are stored as 64-bit words,
+ * and each chain is stored as its steps, operators, and outputs.  Entries
+ * for functions with more than 6 variables are not written.
+ */
+inline void write_exact_resynthesis_cache( std::ostream& os, exact_resynthesis_params const& ps )
+{
+  detail::write_binary<uint32_t>( os, detail::exact_cache_magic );
+  detail::write_binary<uint32_t>( os, detail::exact_cache_version );
+
+  const auto is_stored = []( auto const& entry ) { return entry.first.num_vars() <= detail::exact_cache_max_vars; };
+
+  detail::write_binary<uint32_t>( os, ps.cache ? static_cast<uint32_t>( std::count_if( ps.cache->begin(), ps.cache->end(), is_stored ) ) : 0u );
+  if ( ps.cache )
+  {
+    for ( auto const& [function, c] : *ps.cache )
+    {
+      if ( function.num_vars() > detail::exact_cache_max_vars )
+      {
+        continue;
+      }
+      detail::write_binary_truth_table( os, function );
+      detail::write_binary<uint8_t>( os, static_cast<uint8_t>( c.get_nr_inputs() ) );
+      detail::write_binary<uint8_t>( os, static_cast<uint8_t>( c.get_fanin() ) );
+      detail::write_binary<uint32_t>( os, static_cast<uint32_t>( c.get_nr_steps() ) );
+      detail::write_binary<uint32_t>( os, static_cast<uint32_t>( c.get_nr_outputs() ) );
+      for ( auto i = 0; i < c.get_nr_steps(); ++i )
+      {
+        for ( auto child : c.get_step( i ) )
+        {
+          detail::write_binary<int32_t>( os, child );
+        }
+        detail::write_binary<uint64_t>( os, *c.get_operator( i ).cbegin() );
+      }
+      for ( auto output : c.get_outputs() )
+      {
+        detail::write_binary<int32_t>( os, output );
+      }
+    }
+  }
+
+  detail::write_binary<uint32_t>( os, ps.blacklist_cache ? static_cast<uint32_t>( std::count_if( ps.blacklist_cache->begin(), ps.blacklist_cache->end(), is_stored ) ) : 0u );
+  if ( ps.blacklist_cache )
+  {
+    for ( auto const& [function, conflict_limit] : *ps.blacklist_cache )
+    {
+      if ( function.num_vars() > detail::exact_cache_max_vars )
+      {
+        continue;
+      }
+      detail::write_binary_truth_table( os, function );
+      detail::write_binary<int32_t>( os, conflict_limit );
+    }
+  }
+}
+
+/*! \brief Writes exact synthesis caches to a binary file. */
+inline bool write_exact_resynthesis_cache( std::string const& filename, exact_resynthesis_params const& ps )
+{
+  std::ofstream os( filename, std::ofstream::out | std::ofstream::binary );
+  if ( !os.is_open() )
+  {
+    return false;
+  }
+  write_exact_resynthesis_cache( os, ps );
+  return static_cast<bool>( os );
+}
+
+/*! \brief Reads exact synthesis caches from a binary stream.
+ *
+ * Entries are added to `ps.cache` and `ps.blacklist_cache`, which are
+ * created if they are not set.  Existing entries are kept.  Returns `false`,
+ * if the stream is not in the format written by
+ * `write_exact_resynthesis_cache`, if a chain does not realize a
+ * well-formed network over the variables of its function, or if a chain has
+ * more steps or larger steps than percy synthesizes, in which case the caches
+ * may contain a subset of the entries.
+ */
+inline bool read_exact_resynthesis_cache( std::istream& is, exact_resynthesis_params& ps )
+{
+  uint32_t magic, version;
+  if ( !detail::read_binary( is, magic ) || !detail::read_binary( is, version ) || magic != detail::exact_cache_magic || version != detail::exact_cache_version )
+  {
+    return false;
+  }
+
+  if ( !ps.cache )
+  {
+    ps.cache = std::make_shared<exact_resynthesis_params::cache_map_t>();
+  }
+  if ( !ps.blacklist_cache )
+  {
+    ps.blacklist_cache = std::make_shared<exact_resynthesis_params::blacklist_cache_map_t>();
+  }
+
+  uint32_t num_entries;
+  if ( !detail::read_binary( is, num_entries ) )
+  {
+    return false;
+  }
+  for ( auto e = 0u; e < num_entries; ++e )
+  {
+    const auto function = detail::read_binary_truth_table( is );
+    uint8_t nr_in, fanin;
+    uint32_t nr_steps, nr_out;
+    /* chains are bounded by the limits of percy, and outputs are distinct literals */
+    if ( !function || !detail::read_binary( is, nr_in ) || !detail::read_binary( is, fanin ) || !detail::read_binary( is, nr_steps ) || !detail::read_binary( is, nr_out ) ||
+         nr_in != function->num_vars() || fanin == 0u || fanin > static_cast<uint32_t>( percy::MAX_FANIN ) ||
+         nr_steps > static_cast<uint32_t>( percy::MAX_STEPS ) || nr_out == 0u || nr_out > 2u * ( 1u + nr_in + nr_steps ) )
+    {
+      return false;
+    }
+
+    percy::chain c;
+    c.reset( nr_in, nr_out, nr_steps, fanin );
+    std::vector<int> step( fanin );
+    for ( auto i = 0u; i < nr_steps; ++i )
+    {
+      for ( auto& child : step )
+      {
+        /* children are inputs or earlier steps */
+        int32_t index;
+        if ( !detail::read_binary( is, index ) || index < 0 || static_cast<uint32_t>( index ) >= nr_in + i )
+        {
+          return false;
+        }
+        child = index;
+      }
+
+      uint64_t word;
+      if ( !detail::read_binary( is, word ) )
+      {
+        return false;
+      }
+      kitty::dynamic_truth_table op( fanin );
+      kitty::create_from_words( op, &word, &word + 1 );
+      c.set_step( i, step, op );
+    }
+    for ( auto i = 0u; i < nr_out; ++i )
+    {
+      /* outputs are literals of the constant, the inputs, or the steps */
+      int32_t output;
+      if ( !detail::read_binary( is, output ) || output < 0 || static_cast<uint32_t>( output >> 1 ) > nr_in + nr_steps )
+      {
+        return false;
+      }
+      c.set_output( i, output );
+    }
+
+    ( *ps.cache )[*function] = c;
+  }
+
+  if ( !detail::read_binary( is, num_entries ) )
+  {
+    return false;
+  }
+  for ( auto e = 0u; e < num_entries; ++e )
+  {
+    const auto function = detail::read_binary_truth_table( is );
+    int32_t conflict_limit;
+    if ( !function || !detail::read_binary( is, conflict_limit ) )
+    {
+      return false;
+    }
+    ( *ps.blacklist_cache )[*function] = conflict_limit;
+  }
+
+  return true;
+}
+
+/*! \brief Reads exact synthesis caches from a binary file. */
+inline bool read_exact_resynthesis_cache( std::string const& filename, exact_resynthesis_params& ps )
+{
+  std::ifstream is( filename, std::ifstream::in | std::ifstream::binary );
+  if ( !is.is_open() )
+  {
+    return false;
+  }
+  return read_exact_resynthesis_cache( is, ps );
+}
+
 /*! \brief Resynthesis function based on exact synthesis.
  *
  * This resynthesis function can be passed to ``node_resynthesis``,
@@ -116,6 +553,10 @@ struct exact_resynthesis_params
       exact_resynthesis<klut_network> resyn( 3, ps );
       klut = cut_rewriting( klut, resyn );
 
+   With ``ps.use_npn_cache``, functions are looked up by their NPN
+   representative, and caches can be stored across runs with
+   ``write_exact_resynthesis_cache`` and ``read_exact_resynthesis_cache``.
+
    The underlying engine for this resynthesis function is percy_.
 
    .. _percy: https://github.com/lsils/percy
@@ -147,29 +588,25 @@ public:
       return;
     }
 
-    percy::spec spec;
-    spec.fanin = _fanin_size;
-    spec.verbosity = 0;
-    spec.add_alonce_clauses = _ps.add_alonce_clauses;
-    spec.add_colex_clauses = _ps.add_colex_clauses;
-    spec.add_lex_clauses = _ps.add_lex_clauses;
-    spec.add_lex_func_clauses = _ps.add_lex_func_clauses;
-    spec.add_nontriv_clauses = _ps.add_nontriv_clauses;
-    spec.add_noreapply_clauses = _ps.add_noreapply_clauses;
-    spec.add_symvar_clauses = _ps.add_symvar_clauses;
-    spec.conflict_limit = _ps.conflict_limit;
-    spec[0] = function;
     bool with_dont_cares{false};
     if ( !kitty::is_const0( dont_cares ) )
     {
-      spec.set_dont_care( 0, dont_cares );
       with_dont_cares = true;
     }
 
+    /* cached entries may be stored for the NPN representative */
+    const auto [key, phase, perm] = detail::exact_cache_key( function, _ps.use_npn_cache && !with_dont_cares, _ps.cache );
+
+    auto spec = make_spec( key );
+    if ( with_dont_cares )
+    {
+      spec.set_dont_care( 0, dont_cares );
+    }
+
     auto c = [&]() -> std::optional<percy::chain> {
       if ( !with_dont_cares && _ps.cache )
       {
-        const auto it = _ps.cache->find( function );
+        const auto it = _ps.cache->find( key );
         if ( it != _ps.cache->end() )
         {
           return it->second;
@@ -177,7 +614,7 @@ public:
       }
       else if ( !with_dont_cares && _ps.blacklist_cache )
       {
-        const auto it = _ps.blacklist_cache->find( function );
+        const auto it = _ps.blacklist_cache->find( key );
         if ( it != _ps.blacklist_cache->end() && _ps.conflict_limit >= it->second )
         {
           return std::nullopt;
@@ -185,21 +622,19 @@ public:
       }
 
       percy::chain c;
-      if ( const auto result = percy::synthesize( spec, c, _ps.solver_type,
-                                             _ps.encoder_type,
-                                             _ps.synthesis_method );
+      if ( const auto result = detail::exact_synthesize( spec, c, _ps );
            result != percy::success )
       {
         if ( _ps.blacklist_cache )
         {
-          ( *_ps.blacklist_cache )[function] = result == percy::timeout ? _ps.conflict_limit : 0;
+          ( *_ps.blacklist_cache )[key] = result == percy::timeout ? _ps.conflict_limit : 0;
         }
         return std::nullopt;
       }
       c.denormalize();
       if ( !with_dont_cares && _ps.cache )
       {
-        ( *_ps.cache )[function] = c;
+        ( *_ps.cache )[key] = c;
       }
       return c;
     }();
@@ -209,19 +644,85 @@ public:
       return;
     }
 
-    std::vector<signal<Ntk>> signals( begin, end );
+    /* input i of the chain is leaf perm[i] */
+    std::vector<signal<Ntk>> leaves( begin, end );
+    std::vector<signal<Ntk>> signals;
+    for ( auto i = 0u; i < perm.size(); ++i )
+    {
+      signals.emplace_back( leaves[perm[i]] );
+    }
 
+    /* absorb negations of inputs and output into the LUT functions */
+    const auto num_vars = static_cast<uint32_t>( function.num_vars() );
+    const auto output = static_cast<uint32_t>( c->get_outputs()[0] >> 1 );
+    auto inverted = c->is_output_inverted( 0 ) != static_cast<bool>( ( phase >> num_vars ) & 1 );
     for ( auto i = 0; i < c->get_nr_steps(); ++i )
     {
       std::vector<signal<Ntk>> fanin;
+      auto op = c->get_operator( i );
+      auto j = 0u;
       for ( const auto& child : c->get_step( i ) )
       {
+        if ( static_cast<uint32_t>( child ) < num_vars && ( ( phase >> perm[child] ) & 1 ) )
+        {
+          kitty::flip_inplace( op, j );
+        }
         fanin.emplace_back( signals[child] );
+        ++j;
       }
-      signals.emplace_back( ntk.create_node( fanin, c->get_operator( i ) ) );
+      if ( output == num_vars + i + 1 && inverted )
+      {
+        op = ~op;
+        inverted = false;
+      }
+      signals.emplace_back( ntk.create_node( fanin, op ) );
+    }
+
+    /* chains without steps compute a constant or a (complemented) input */
+    if ( output >= 1u && output <= num_vars && ( ( phase >> perm[output - 1] ) & 1 ) )
+    {
+      inverted = !inverted;
     }
+    const auto f = output == 0u ? ntk.get_constant( false ) : signals[output - 1];
+    fn( inverted ? ntk.create_not( f ) : f );
+  }
+
+  /*! \brief Synthesizes functions in parallel and stores them in the cache.
+   *
+   * Synthesizes all distinct functions in `functions`, which are neither in
+   * the cache nor in the blacklist, using `ps.num_threads` threads.  Results
+   * are added to `ps.cache` (and `ps.blacklist_cache`, if set), such that
+   * subsequent calls to the resynthesis function for these functions are
+   * cache hits.  This can be used to synthesize all functions that are
+   * collected in a pass before the network is rewritten.  Requires
+   * `ps.cache` to be set.
+   */
+  void synthesize_batch( std::vector<kitty::dynamic_truth_table> const& functions ) const
+  {
+    std::vector<kitty::dynamic_truth_table> large_functions;
+    std::copy_if( functions.begin(), functions.end(), std::back_inserter( large_functions ), [&]( auto const& f ) {
+      return static_cast<uint32_t>( f.num_vars() ) > _fanin_size;
+    } );
 
-    fn( signals.back() );
+    detail::exact_synthesize_batch( large_functions, _ps, [&]( auto const& key ) { return make_spec( key ); }, true, true );
+  }
+
+private:
+  percy::spec make_spec( kitty::dynamic_truth_table const& key ) const
+  {
+    percy::spec spec;
+    spec.fanin = _fanin_size;
+    spec.verbosity = 0;
+    spec.add_alonce_clauses = _ps.add_alonce_clauses;
+    spec.add_colex_clauses = _ps.add_colex_clauses;
+    spec.add_lex_clauses = _ps.add_lex_clauses;
+    spec.add_lex_func_clauses = _ps.add_lex_func_clauses;
+    spec.add_nontriv_clauses = _ps.add_nontriv_clauses;
+    spec.add_noreapply_clauses = _ps.add_noreapply_clauses;
+    spec.add_symvar_clauses = _ps.add_symvar_clauses;
+    spec.conflict_limit = _ps.conflict_limit;
+    spec[0] = key;
+    return spec;
   }
 
 private:
@@ -291,37 +792,25 @@ public:
   void operator()( Ntk& ntk, kitty::dynamic_truth_table const& function, kitty::dynamic_truth_table const& dont_cares, LeavesIterator begin, LeavesIterator end, Fn&& fn ) const
   {
     // TODO: special case for small functions (up to 2 variables)?
-    percy::spec spec;
-    if ( !_allow_xor )
-    {
-      spec.set_primitive( percy::AIG );
-    }
-    spec.fanin = 2;
-    spec.verbosity = 0;
-    spec.add_alonce_clauses = _ps.add_alonce_clauses;
-    spec.add_colex_clauses = _ps.add_colex_clauses;
-    spec.add_lex_clauses = _ps.add_lex_clauses;
-    spec.add_lex_func_clauses = _ps.add_lex_func_clauses;
-    spec.add_nontriv_clauses = _ps.add_nontriv_clauses;
-    spec.add_noreapply_clauses = _ps.add_noreapply_clauses;
-    spec.add_symvar_clauses = _ps.add_symvar_clauses;
-    spec.conflict_limit = _ps.conflict_limit;
-    if ( _lower_bound )
-    {
-      spec.initial_steps = *_lower_bound;
-    }
-    spec[0] = function;
     bool with_dont_cares{false};
     if ( !kitty::is_const0( dont_cares ) )
     {
-      spec.set_dont_care( 0, dont_cares );
       with_dont_cares = true;
     }
 
+    /* cached entries may be stored for the NPN representative */
+    const auto [key, phase, perm] = detail::exact_cache_key( function, _ps.use_npn_cache && !with_dont_cares, _ps.cache );
+
+    auto spec = make_spec( key );
+    if ( with_dont_cares )
+    {
+      spec.set_dont_care( 0, dont_cares );
+    }
+
     auto c = [&]() -> std::optional<percy::chain> {
       if ( !with_dont_cares && _ps.cache )
       {
-        const auto it = _ps.cache->find( function );
+        const auto it = _ps.cache->find( key );
         if ( it != _ps.cache->end() )
         {
           return it->second;
@@ -329,16 +818,14 @@ public:
       }
 
       percy::chain c;
-      if ( const auto result = percy::synthesize( spec, c, _ps.solver_type,
-                                                  _ps.encoder_type,
-                                                  _ps.synthesis_method );
+      if ( const auto result = detail::exact_synthesize( spec, c, _ps );
            result != percy::success )
       {
         return std::nullopt;
       }
       if ( !with_dont_cares && _ps.cache )
       {
-        ( *_ps.cache )[function] = c;
+        ( *_ps.cache )[key] = c;
       }
       return c;
     }();
@@ -348,7 +835,14 @@ public:
       return;
     }
 
-    std::vector<signal<Ntk>> signals( begin, end );
+    /* input i of the chain is leaf perm[i], possibly complemented */
+    std::vector<signal<Ntk>> leaves( begin, end );
+    std::vector<signal<Ntk>> signals;
+    for ( auto i = 0u; i < perm.size(); ++i )
+    {
+      signals.emplace_back( ( ( phase >> perm[i] ) & 1 ) ? !leaves[perm[i]] : leaves[perm[i]] );
+    }
+
     for ( auto i = 0; i < c->get_nr_steps(); ++i )
     {
       auto c1 = signals[c->get_step( i )[0]];
@@ -377,7 +871,10 @@ public:
       }
     }
 
-    fn( c->is_output_inverted( 0 ) ? !signals.back() : signals.back() );
+    const auto output = static_cast<uint32_t>( c->get_outputs()[0] >> 1 );
+    const auto f = output == 0u ? ntk.get_constant( false ) : signals[output - 1];
+    const bool inverted = c->is_output_inverted( 0 ) != static_cast<bool>( ( phase >> function.num_vars() ) & 1 );
+    fn( inverted ? !f : f );
   }
 
   void set_bounds( std::optional<uint32_t> const& lower_bound, std::optional<uint32_t> const& upper_bound )
@@ -386,6 +883,43 @@ public:
     _upper_bound = upper_bound;
   }
 
+  /*! \brief Synthesizes functions in parallel and stores them in the cache.
+   *
+   * Synthesizes all distinct functions in `functions`, which are not in the
+   * cache, using `ps.num_threads` threads and adds the results to
+   * `ps.cache`.  Requires `ps.cache` to be set.
+   */
+  void synthesize_batch( std::vector<kitty::dynamic_truth_table> const& functions ) const
+  {
+    detail::exact_synthesize_batch( functions, _ps, [&]( auto const& key ) { return make_spec( key ); }, false, false );
+  }
+
+private:
+  percy::spec make_spec( kitty::dynamic_truth_table const& key ) const
+  {
+    percy::spec spec;
+    if ( !_allow_xor )
+    {
+      spec.set_primitive( percy::AIG );
+    }
+    spec.fanin = 2;
+    spec.verbosity = 0;
+    spec.add_alonce_clauses = _ps.add_alonce_clauses;
+    spec.add_colex_clauses = _ps.add_colex_clauses;
+    spec.add_lex_clauses = _ps.add_lex_clauses;
+    spec.add_lex_func_clauses = _ps.add_lex_func_clauses;
+    spec.add_nontriv_clauses = _ps.add_nontriv_clauses;
+    spec.add_noreapply_clauses = _ps.add_noreapply_clauses;
+    spec.add_symvar_clauses = _ps.add_symvar_clauses;
+    spec.conflict_limit = _ps.conflict_limit;
+    if ( _lower_bound )
+    {
+      spec.initial_steps = *_lower_bound;
+    }
+    spec[0] = key;
+    return spec;
+  }
+
 private:
   bool _allow_xor = false;
   exact_resynthesis_params _ps;
@@ -33,8 +33,11 @@
 #pragma once
 
 #include <array>
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <optional>
 #include <string>
 #include <tuple>
 #include <unordered_map>
@@ -45,6 +48,7 @@
 #include <kitty/constructors.hpp>
 #include <kitty/hash.hpp>
 #include <kitty/operations.hpp>
+#include <kitty/operators.hpp>
 #include <kitty/print.hpp>
 #include <kitty/spectral.hpp>
 
@@ -52,6 +56,8 @@
 #include "../simulation.hpp"
 #include "../../traits.hpp"
 #include "../../networks/xag.hpp"
+#include "../../utils/binary_utils.hpp"
+#include "../../utils/mapped_file.hpp"
 #include "../../utils/stopwatch.hpp"
 #include "../../views/cut_view.hpp"
 
@@ -121,6 +127,238 @@ struct xag_minmc_resynthesis_stats
   }
 };
 
+namespace detail
+{
+
+/* reads a database in text format and calls fn( original, repr, mc, inputs,
+ * gates, output ) for each entry; `gates` contains two literals for each
+ * gate, which is an XOR if the first literal is larger than the second one,
+ * and an AND otherwise; literals 0 and 1 are constants, and literal `2 * i +
+ * c` refers to input `i - 1` or gate `i - inputs - 1` */
+template<class Fn>
+void read_xag_minmc_database_text( std::istream& is, Fn&& fn )
+{
+  std::string line;
+  unsigned pos{0u};
+  std::vector<uint32_t> gates;
+
+  while ( std::getline( is, line ) )
+  {
+    pos = static_cast<unsigned>( line.find( '\t' ) );
+    const auto name = line.substr( 0, pos++ );
+    auto original = line.substr( pos, 16u );
+    pos += 17u;
+    const auto token_f = line.substr( pos, 16u );
+    pos += 17u;
+    auto mc = std::stoul( line.substr( pos, 1u ) );
+    pos += 2u;
+    line.erase( 0, pos );
+
+    auto circuit = line;
+
+    std::string token = circuit.substr( 0, circuit.find( ' ' ) );
+    circuit.erase( 0, circuit.find( ' ' ) + 1 );
+    const auto inputs = std::stoul( token );
+
+    gates.clear();
+    while ( circuit.size() > 4 )
+    {
+      for ( auto j = 0u; j < 2u; j++ )
+      {
+        token = circuit.substr( 0, circuit.find( ' ' ) );
+        circuit.erase( 0, circuit.find( ' ' ) + 1 );
+        gates.push_back( static_cast<uint32_t>( std::stoul( token ) ) );
+      }
+      circuit.erase( 0, circuit.find( ' ' ) + 1 );
+    }
+
+    const auto output = static_cast<uint32_t>( std::stoul( circuit ) );
+    fn( original, token_f, static_cast<uint32_t>( mc ), static_cast<uint32_t>( inputs ), gates, output );
+  }
+}
+
+inline constexpr uint32_t xag_minmc_database_magic = 0x434d4d4du; /* "MMMC" */
+inline constexpr uint32_t xag_minmc_database_version = 2u;
+
+/* written in the byte order of the host, which must match when reading */
+inline constexpr uint32_t xag_minmc_database_byte_order = 0x01020304u;
+
+/* layout of the compiled database: header, entries, hash index, and gates */
+inline constexpr std::size_t xag_minmc_header_size = 56u;
+inline constexpr std::size_t xag_minmc_entry_size = 32u;
+
+/* the magic number in either byte order */
+inline bool has_xag_minmc_database_magic( mapped_file const& file )
+{
+  return file.is_open() && file.size() >= 4u && ( std::memcmp( file.data(), "MMMC", 4u ) == 0 || std::memcmp( file.data(), "CMMM", 4u ) == 0 );
+}
+
+/* function of a circuit in the text database, if its literals are valid */
+inline std::optional<kitty::static_truth_table<6u>> simulate_xag_minmc_entry( uint32_t inputs, std::vector<uint32_t> const& gates, uint32_t output )
+{
+  if ( inputs > 6u )
+  {
+    return std::nullopt;
+  }
+
+  std::vector<kitty::static_truth_table<6u>> tts( inputs );
+  for ( auto i = 0u; i < inputs; ++i )
+  {
+    kitty::create_nth_var( tts[i], i );
+  }
+
+  const auto to_tt = [&]( uint32_t lit ) -> std::optional<kitty::static_truth_table<6u>> {
+    if ( lit / 2u > tts.size() )
+    {
+      return std::nullopt;
+    }
+    auto tt = lit < 2u ? kitty::static_truth_table<6u>() : tts[lit / 2u - 1u];
+    return ( lit % 2u ) ? ~tt : tt;
+  };
+
+  for ( auto i = 0u; i + 1u < gates.size(); i += 2u )
+  {
+    const auto a = to_tt( gates[i] ), b = to_tt( gates[i + 1u] );
+    if ( !a || !b )
+    {
+      return std::nullopt;
+    }
+    tts.push_back( gates[i] > gates[i + 1u] ? *a ^ *b : *a & *b );
+  }
+  return to_tt( output );
+}
+
+inline uint64_t xag_minmc_hash( uint64_t repr )
+{
+  /* finalizer of MurmurHash3 */
+  repr ^= repr >> 33u;
+  repr *= UINT64_C( 0xff51afd7ed558ccd );
+  repr ^= repr >> 33u;
+  repr *= UINT64_C( 0xc4ceb9fe1a85ec53 );
+  repr ^= repr >> 33u;
+  return repr;
+}
+
+} // namespace detail
+
+/*! \brief Compiles a database for `xag_minmc_resynthesis` into binary format.
+ *
+ * Reads the text database `text_filename` and writes it to
+ * `binary_filename` in a binary format, which contains the representatives
+ * of the spectral classes, a hash index over the representatives, and the
+ * XAGs.  The binary database can be passed to `xag_minmc_resynthesis`
+ * instead of the text database, in which case it is memory-mapped and not
+ * parsed.  If the text database contains several entries for a
+ * representative, the first one is used, as when parsing the text database.
+ *
+ * The circuits are verified as with `verify_database`, and the function
+ * computed by a circuit is stored if it differs from the function in the
+ * text database.  The binary format uses the byte order of the host, which
+ * is stored in the file and checked when reading.  Returns `false`, if one
+ * of the files cannot be opened, or if a circuit refers to undefined
+ * literals.
+ */
+inline bool compile_xag_minmc_database( std::string const& text_filename, std::string const& binary_filename )
+{
+  std::ifstream is( text_filename.c_str(), std::ifstream::in );
+  if ( !is.is_open() )
+  {
+    return false;
+  }
+
+  struct entry
+  {
+    uint64_t repr, original;
+    uint32_t gates_begin, num_gates, output, mc, inputs;
+  };
+  std::vector<entry> entries;
+  std::vector<uint32_t> gate_words;
+  bool valid{true};
+
+  detail::read_xag_minmc_database_text( is, [&]( auto const& original, auto const& repr, uint32_t mc, uint32_t inputs, auto const& gates, uint32_t output ) {
+    const auto tt_circuit = detail::simulate_xag_minmc_entry( inputs, gates, output );
+    if ( !tt_circuit || output < 2u )
+    {
+      valid = false;
+      return;
+    }
+
+    (void)original;
+    kitty::static_truth_table<6u> tt_repr;
+    kitty::create_from_hex_string( tt_repr, repr );
+    entries.push_back( {tt_repr._bits, tt_circuit->_bits, static_cast<uint32_t>( gate_words.size() ), static_cast<uint32_t>( gates.size() / 2u ), output, mc, inputs} );
+    gate_words.insert( gate_words.end(), gates.begin(), gates.end() );
+  } );
+
+  if ( !valid )
+  {
+    return false;
+  }
+
+  /* open addressing with linear probing; slot value is entry index + 1 */
+  uint32_t num_slots{16u};
+  while ( num_slots < 2u * entries.size() )
+  {
+    num_slots <<= 1u;
+  }
+  std::vector<uint32_t> slots( num_slots, 0u );
+  for ( auto i = 0u; i < entries.size(); ++i )
+  {
+    auto pos = detail::xag_minmc_hash( entries[i].repr ) & ( num_slots - 1u );
+    while ( slots[pos] != 0u && entries[slots[pos] - 1u].repr != entries[i].repr )
+    {
+      pos = ( pos + 1u ) & ( num_slots - 1u );
+    }
+    if ( slots[pos] == 0u )
+    {
+      slots[pos] = i + 1u;
+    }
+  }
+
+  std::ofstream os( binary_filename.c_str(), std::ofstream::out | std::ofstream::binary );
+  if ( !os.is_open() )
+  {
+    return false;
+  }
+
+  const uint64_t entries_offset = detail::xag_minmc_header_size;
+  const uint64_t slots_offset = entries_offset + entries.size() * detail::xag_minmc_entry_size;
+  const uint64_t gates_offset = slots_offset + slots.size() * sizeof( uint32_t );
+
+  detail::write_binary<uint32_t>( os, detail::xag_minmc_database_magic );
+  detail::write_binary<uint32_t>( os, detail::xag_minmc_database_version );
+  detail::write_binary<uint32_t>( os, static_cast<uint32_t>( entries.size() ) );
+  detail::write_binary<uint32_t>( os, num_slots );
+  detail::write_binary<uint64_t>( os, entries_offset );
+  detail::write_binary<uint64_t>( os, slots_offset );
+  detail::write_binary<uint64_t>( os, gates_offset );
+  detail::write_binary<uint64_t>( os, gate_words.size() );
+  detail::write_binary<uint32_t>( os, detail::xag_minmc_database_byte_order );
+  detail::write_binary<uint32_t>( os, 0u );
+
+  for ( auto const& e : entries )
+  {
+    detail::write_binary<uint64_t>( os, e.repr );
+    detail::write_binary<uint64_t>( os, e.original );
+    detail::write_binary<uint32_t>( os, e.gates_begin );
+    detail::write_binary<uint32_t>( os, e.num_gates );
+    detail::write_binary<uint32_t>( os, e.output );
+    detail::write_binary<uint8_t>( os, static_cast<uint8_t>( e.mc ) );
+    detail::write_binary<uint8_t>( os, static_cast<uint8_t>( e.inputs ) );
+    detail::write_binary<uint16_t>( os, 0u );
+  }
+  for ( auto slot : slots )
+  {
+    detail::write_binary<uint32_t>( os, slot );
+  }
+  for ( auto word : gate_words )
+  {
+    detail::write_binary<uint32_t>( os, word );
+  }
+
+  return static_cast<bool>( os );
+}
+
 /*! \brief Resynthesis function to minimize multiplicative complexity in XAGs.
  *
  * This resynthesis function can be passed to ``cut_rewriting`` with a cut size
@@ -137,13 +375,18 @@ struct xag_minmc_resynthesis_stats
       xag_minmc_resynthesis resyn;
       xag = cut_rewriting( xag, resyn );
    \endverbatim
+ *
+ * The database is either given in text format, which is parsed on
+ * construction, or in the binary format written by
+ * `compile_xag_minmc_database`, which is memory-mapped read-only, such that
+ * construction is immediate and processes share the pages of the database.
  */
 class xag_minmc_resynthesis
 {
 public:
   /*! \brief Default constructor.
    *
-   * \param filename Database file with precomputed functions (information to be added)
+   * \param filename Database file with precomputed functions in text or binary format
    * \param ps Parameters
    * \param pst Statistics
    */
@@ -155,7 +398,17 @@ public:
         func_mc( std::make_shared<decltype( func_mc )::element_type>() ),
         classify_cache( std::make_shared<decltype( classify_cache )::element_type>() )
   {
-    build_db( filename );
+    if ( auto file = std::make_shared<mapped_file>( filename ); detail::has_xag_minmc_database_magic( *file ) )
+    {
+      if ( !map_db( file ) )
+      {
+        std::cerr << "[e] invalid binary database " << filename << "\n";
+      }
+    }
+    else
+    {
+      build_db( filename );
+    }
   }
 
   virtual ~xag_minmc_resynthesis()
@@ -259,9 +512,21 @@ public:
     }
 
     xag_network::signal circuit;
+    std::optional<std::size_t> mapped_entry;
 
     auto search = func_mc->find( kitty::to_hex( tt_ext ) );
-    if ( search != func_mc->end() )
+    if ( mapped && ( mapped_entry = find_mapped( tt_ext._bits ) ) )
+    {
+      kitty::static_truth_table<6u> db_repr;
+      db_repr._bits = mapped->read<uint64_t>( *mapped_entry + 8u );
+
+      call_with_stopwatch( st.time_classify, [&]() { return kitty::exact_spectral_canonization(
+                                                         db_repr, [&trans]( auto const& ops ) {
+                                                           std::copy( ops.rbegin(), ops.rend(),
+                                                                      std::back_inserter( trans ) );
+                                                         } ); } );
+    }
+    else if ( search != func_mc->end() )
     {
       unsigned int mc{0u};
       std::string original_f;
@@ -334,7 +599,17 @@ public:
 
     xag_network::signal output;
 
-    if ( db->is_constant( db->get_node( circuit ) ) )
+    if ( mapped_entry )
+    {
+      const auto f = create_mapped( xag, *mapped_entry, pis );
+      if ( !f )
+      {
+        st.unknown_function_aborts++;
+        return; /* quit */
+      }
+      output = *f;
+    }
+    else if ( db->is_constant( db->get_node( circuit ) ) )
     {
       output = xag.get_constant( db->is_complemented( circuit ) );
     }
@@ -361,73 +636,30 @@ private:
     std::generate( db_pis->begin(), db_pis->end(), [&]() { return db->create_pi(); } );
 
     std::ifstream file1( filename.c_str(), std::ifstream::in );
-    std::string line;
-    unsigned pos{0u};
-
-    //std::ofstream db_file( "/tmp/db", std::ofstream::out );
-
-    while ( std::getline( file1, line ) )
-    {
-      pos = static_cast<unsigned>( line.find( '\t' ) );
-      const auto name = line.substr( 0, pos++ );
-      auto original = line.substr( pos, 16u );
-      pos += 17u;
-      const auto token_f = line.substr( pos, 16u );
-      pos += 17u;
-      auto mc = std::stoul( line.substr( pos, 1u ) );
-      pos += 2u;
-      line.erase( 0, pos );
-
-      auto circuit = line;
-      //auto orig_circuit = circuit;
-
-      const std::string delimiter = " ";
-      std::string token = circuit.substr( 0, circuit.find( ' ' ) );
-      circuit.erase( 0, circuit.find( ' ' ) + 1 );
-      const auto inputs = std::stoul( token );
 
+    detail::read_xag_minmc_database_text( file1, [&]( std::string original, std::string const& token_f, uint32_t mc, uint32_t inputs, std::vector<uint32_t> const& gates, uint32_t output ) {
       std::vector<xag_network::signal> hashing_circ( db_pis->begin(), db_pis->begin() + inputs );
 
-      while ( circuit.size() > 4 )
-      {
-        std::array<unsigned, 2> signals;
-        std::vector<xag_network::signal> ff( 2 );
-        for ( auto j = 0u; j < 2u; j++ )
+      const auto to_signal = [&]( uint32_t lit ) {
+        if ( lit < 2u )
         {
-          token = circuit.substr( 0, circuit.find( ' ' ) );
-          circuit.erase( 0, circuit.find( ' ' ) + 1 );
-          signals[j] = std::stoul( token );
-          if ( signals[j] == 0 )
-          {
-            ff[j] = db->get_constant( false );
-          }
-          else if ( signals[j] == 1 )
-          {
-            ff[j] = db->get_constant( true );
-          }
-          else
-          {
-            ff[j] = hashing_circ[signals[j] / 2 - 1] ^ ( signals[j] % 2 != 0 );
-          }
+          return db->get_constant( lit == 1u );
         }
-        circuit.erase( 0, circuit.find( ' ' ) + 1 );
+        return hashing_circ[lit / 2 - 1] ^ ( lit % 2 != 0 );
+      };
 
-        if ( signals[0] > signals[1] )
-        {
-          hashing_circ.push_back( db->create_xor( ff[0], ff[1] ) );
-        }
-        else
-        {
-          hashing_circ.push_back( db->create_and( ff[0], ff[1] ) );
-        }
+      for ( auto i = 0u; i < gates.size(); i += 2u )
+      {
+        const auto a = to_signal( gates[i] );
+        const auto b = to_signal( gates[i + 1u] );
+        hashing_circ.push_back( gates[i] > gates[i + 1u] ? db->create_xor( a, b ) : db->create_and( a, b ) );
       }
 
-      const auto output = std::stoul( circuit );
       const auto f = hashing_circ[output / 2 - 1] ^ ( output % 2 != 0 );
       db->create_po( f );
 
       /* verify */
-      if (ps.verify_database)
+      if ( ps.verify_database )
       {
         cut_view<xag_network> view{*db, *db_pis, f};
         kitty::static_truth_table<6u> tt, tt_repr;
@@ -439,18 +671,120 @@ private:
           std::cerr << "[w] invalid circuit for " << original << ", got " << kitty::to_hex( result ) << "\n";
           original = kitty::to_hex( result );
 
-          const auto repr = exact_spectral_canonization(tt);
+          const auto repr = exact_spectral_canonization( tt );
           if ( repr != tt_repr )
           {
             std::cerr << "[e] representatives do not match\n";
           }
         }
-
-        //db_file << name << "\t" << token_f << "\t" << original << "\t" << mc << "\t" << orig_circuit << "\n";
       }
 
       func_mc->insert( {token_f, {original, mc, f}} );
+    } );
+  }
+
+  /* maps a database in binary format, returns false if the header is
+   * invalid, or was written with another version or byte order */
+  bool map_db( std::shared_ptr<mapped_file> const& file )
+  {
+    stopwatch t1( st.time_total );
+    stopwatch t2( st.time_parse_db );
+
+    if ( !file->is_open() || file->size() < detail::xag_minmc_header_size || file->read<uint32_t>( 0u ) != detail::xag_minmc_database_magic ||
+         file->read<uint32_t>( 48u ) != detail::xag_minmc_database_byte_order || file->read<uint32_t>( 4u ) != detail::xag_minmc_database_version )
+    {
+      return false;
+    }
+
+    const auto num_entries = file->read<uint32_t>( 8u );
+    const auto num_slots = file->read<uint32_t>( 12u );
+    const auto entries_offset = file->read<uint64_t>( 16u );
+    const auto slots_offset = file->read<uint64_t>( 24u );
+    const auto gates_offset = file->read<uint64_t>( 32u );
+    const auto num_gate_words = file->read<uint64_t>( 40u );
+
+    if ( num_slots == 0u || ( num_slots & ( num_slots - 1u ) ) != 0u ||
+         entries_offset + uint64_t( num_entries ) * detail::xag_minmc_entry_size > file->size() ||
+         slots_offset + uint64_t( num_slots ) * sizeof( uint32_t ) > file->size() ||
+         gates_offset + num_gate_words * sizeof( uint32_t ) > file->size() )
+    {
+      return false;
+    }
+
+    mapped = file;
+    mapped_index = {num_entries, num_slots, entries_offset, slots_offset, gates_offset, num_gate_words};
+    return true;
+  }
+
+  /* returns the offset of the entry for `repr` */
+  std::optional<std::size_t> find_mapped( uint64_t repr ) const
+  {
+    const auto mask = mapped_index.num_slots - 1u;
+    auto pos = detail::xag_minmc_hash( repr ) & mask;
+    for ( auto i = 0u; i < mapped_index.num_slots; ++i )
+    {
+      const auto slot = mapped->read<uint32_t>( mapped_index.slots_offset + pos * sizeof( uint32_t ) );
+      if ( slot == 0u || slot > mapped_index.num_entries )
+      {
+        return std::nullopt;
+      }
+
+      const auto offset = mapped_index.entries_offset + ( slot - 1u ) * detail::xag_minmc_entry_size;
+      if ( mapped->read<uint64_t>( offset ) == repr )
+      {
+        return offset;
+      }
+      pos = ( pos + 1u ) & mask;
+    }
+    return std::nullopt;
+  }
+
+  /* creates the XAG of a mapped entry, after checking its literals */
+  std::optional<xag_network::signal> create_mapped( xag_network& xag, std::size_t offset, std::vector<xag_network::signal> const& pis ) const
+  {
+    const auto gates_begin = mapped->read<uint32_t>( offset + 16u );
+    const auto num_gates = mapped->read<uint32_t>( offset + 20u );
+    const auto output = mapped->read<uint32_t>( offset + 24u );
+    const auto inputs = mapped->read<uint8_t>( offset + 29u );
+
+    if ( inputs > pis.size() || uint64_t( gates_begin ) + 2u * uint64_t( num_gates ) > mapped_index.num_gate_words )
+    {
+      return std::nullopt;
+    }
+
+    const auto gate = [&]( uint32_t i ) {
+      return mapped->read<uint32_t>( mapped_index.gates_offset + ( uint64_t( gates_begin ) + i ) * sizeof( uint32_t ) );
+    };
+    for ( auto i = 0u; i < 2u * num_gates; ++i )
+    {
+      if ( gate( i ) / 2u > inputs + i / 2u )
+      {
+        return std::nullopt;
+      }
+    }
+    if ( output < 2u || output / 2u > inputs + num_gates )
+    {
+      return std::nullopt;
     }
+
+    std::vector<xag_network::signal> signals( pis.begin(), pis.begin() + inputs );
+    const auto to_signal = [&]( uint32_t lit ) {
+      if ( lit < 2u )
+      {
+        return xag.get_constant( lit == 1u );
+      }
+      return signals[lit / 2 - 1] ^ ( lit % 2 != 0 );
+    };
+
+    for ( auto i = 0u; i < num_gates; ++i )
+    {
+      const auto l1 = gate( 2u * i ), l2 = gate( 2u * i + 1u );
+      const auto a = to_signal( l1 );
+      const auto b = to_signal( l2 );
+      signals.push_back( l1 > l2 ? xag.create_xor( a, b ) : xag.create_and( a, b ) );
+    }
+
+    return to_signal( output );
   }
 
 public:
@@ -464,6 +798,19 @@ private:
   std::shared_ptr<std::vector<xag_network::signal>> db_pis;
   std::shared_ptr<std::unordered_map<std::string, std::tuple<std::string, unsigned, xag_network::signal>>> func_mc;
   std::shared_ptr<std::unordered_map<kitty::static_truth_table<6u>, std::tuple<bool, kitty::static_truth_table<6u>, std::vector<kitty::detail::spectral_operation>>, kitty::hash<kitty::static_truth_table<6u>>>> classify_cache;
+
+  /* binary database */
+  struct mapped_index_t
+  {
+    uint32_t num_entries{0u};
+    uint32_t num_slots{0u};
+    uint64_t entries_offset{0u};
+    uint64_t slots_offset{0u};
+    uint64_t gates_offset{0u};
+    uint64_t num_gate_words{0u};
+  };
+  std::shared_ptr<mapped_file> mapped;
+  mapped_index_t mapped_index;
 };
 
 } // namespace mockturtle
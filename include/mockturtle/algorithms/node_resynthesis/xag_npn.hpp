@@ -47,6 +47,7 @@
 #include "../../networks/xag.hpp"
 #include "../../utils/index_list.hpp"
 #include "../../utils/node_map.hpp"
+#include "../../utils/npn4_classes.hpp"
 #include "../../utils/stopwatch.hpp"
 
 namespace mockturtle
@@ -78,7 +79,8 @@ struct xag_npn_resynthesis_stats
  * This resynthesis function can be passed to ``cut_rewriting``.  It will
  * produce a network based on pre-computed XAGs with up to at most 4 variables.
  * Consequently, the nodes' fan-in sizes in the input network must not exceed
- * 4.
+ * 4.  The database is built when the first instance is constructed and shared
+ * by all later instances.
  *
    \verbatim embed:rst
 
@@ -102,8 +104,7 @@ class xag_npn_resynthesis
 public:
   xag_npn_resynthesis( xag_npn_resynthesis_params const& ps = {}, xag_npn_resynthesis_stats* pst = nullptr )
       : ps( ps ),
-        pst( pst ),
-        _repr( 1u << 16u )
+        pst( pst )
   {
     static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
     static_assert( has_get_constant_v<Ntk>, "Ntk does not implement the get_constant method" );
@@ -146,11 +147,11 @@ public:
     kitty::static_truth_table<4u> tt = kitty::extend_to<4u>( function );
 
     /* get representative of function */
-    const auto [repr, phase, perm] = _repr[*tt.cbegin()];
+    const auto [repr, phase, perm] = _classes->canonization( tt );
 
     /* check if representative has circuits */
-    const auto it = _repr_to_signal.find( repr );
-    if ( it == _repr_to_signal.end() )
+    const auto it = _database->repr_to_signal.find( repr );
+    if ( it == _database->repr_to_signal.end() )
     {
       return;
     }
@@ -167,8 +168,8 @@ public:
 
     for ( auto const& cand : it->second )
     {
-      const auto f = copy_db_entry( ntk, _db.get_node( cand ), db_to_ntk );
-      if ( !fn( _db.is_complemented( cand ) != ( phase >> 4 & 1 ) ? ntk.create_not( f ) : f ) )
+      const auto f = copy_db_entry( ntk, _database->db.get_node( cand ), db_to_ntk );
+      if ( !fn( _database->db.is_complemented( cand ) != ( phase >> 4 & 1 ) ? ntk.create_not( f ) : f ) )
       {
         return;
       }
@@ -176,6 +177,13 @@ public:
   }
 
 private:
+  /* database of subgraphs, which is shared by all instances */
+  struct database
+  {
+    DatabaseNtk db;
+    std::unordered_map<kitty::static_truth_table<4u>, std::vector<signal<DatabaseNtk>>, kitty::hash<kitty::static_truth_table<4u>>> repr_to_signal;
+  };
+
   signal<Ntk>
   copy_db_entry( Ntk& ntk, node<DatabaseNtk> const& n, std::unordered_map<node<DatabaseNtk>, signal<Ntk>>& db_to_ntk ) const
   {
@@ -184,13 +192,14 @@ private:
       return it->second;
     }
 
+    auto const& db = _database->db;
     std::array<signal<Ntk>, 2> fanin{};
-    _db.foreach_fanin( n, [&]( auto const& f, auto i ) {
-      const auto ntk_f = copy_db_entry( ntk, _db.get_node( f ), db_to_ntk );
-      fanin[i] = _db.is_complemented( f ) ? ntk.create_not( ntk_f ) : ntk_f;
+    db.foreach_fanin( n, [&]( auto const& f, auto i ) {
+      const auto ntk_f = copy_db_entry( ntk, db.get_node( f ), db_to_ntk );
+      fanin[i] = db.is_complemented( f ) ? ntk.create_not( ntk_f ) : ntk_f;
     } );
 
-    const auto f = _db.is_xor( n ) ? ntk.create_xor( fanin[0], fanin[1] ) : ntk.create_and( fanin[0], fanin[1] );
+    const auto f = db.is_xor( n ) ? ntk.create_xor( fanin[0], fanin[1] ) : ntk.create_and( fanin[0], fanin[1] );
     db_to_ntk.insert( {n, f} );
     return f;
   }
@@ -199,61 +208,69 @@ private:
   {
     stopwatch t( st.time_classes );
 
-    kitty::static_truth_table<4u> tt;
-    do {
-      _repr[*tt.cbegin()] = kitty::exact_npn_canonization( tt );
-      kitty::next_inplace( tt );
-    } while ( !kitty::is_const0( tt ) );
+    _classes = &npn4_classes::get();
   }
 
   void build_db()
   {
     stopwatch t( st.time_db );
 
-    decode( _db, xag_index_list{std::vector<uint32_t>{subgraphs, subgraphs + sizeof subgraphs / sizeof subgraphs[0]}} );
-    const auto sim_res = simulate_nodes<kitty::static_truth_table<4u>>( _db );
+    static const database shared = make_database();
+    _database = &shared;
 
-    _db.foreach_node( [&]( auto n ) {
-      if ( std::get<0>( _repr[*sim_res[n].cbegin()] ) == sim_res[n] )
+    st.db_size = _database->db.size();
+    st.covered_classes = static_cast<uint32_t>( _database->repr_to_signal.size() );
+  }
+
+  static database make_database()
+  {
+    auto const& classes = npn4_classes::get();
+
+    database result;
+    auto& db = result.db;
+    auto& repr_to_signal = result.repr_to_signal;
+
+    decode( db, xag_index_list{std::vector<uint32_t>{subgraphs, subgraphs + sizeof subgraphs / sizeof subgraphs[0]}} );
+    const auto sim_res = simulate_nodes<kitty::static_truth_table<4u>>( db );
+
+    db.foreach_node( [&]( auto n ) {
+      if ( classes.representative( sim_res[n] ) == sim_res[n] )
       {
-        if ( _repr_to_signal.count( sim_res[n] ) == 0 )
+        if ( repr_to_signal.count( sim_res[n] ) == 0 )
         {
-          _repr_to_signal.insert( {sim_res[n], {_db.make_signal( n )}} );
+          repr_to_signal.insert( {sim_res[n], {db.make_signal( n )}} );
         }
         else
         {
-          _repr_to_signal[sim_res[n]].push_back( _db.make_signal( n ) );
+          repr_to_signal[sim_res[n]].push_back( db.make_signal( n ) );
         }
       }
       else
       {
         const auto f = ~sim_res[n];
-        if ( std::get<0>( _repr[*f.cbegin()] ) == f )
+        if ( classes.representative( f ) == f )
         {
-          if ( _repr_to_signal.count( f ) == 0 )
+          if ( repr_to_signal.count( f ) == 0 )
           {
-            _repr_to_signal.insert( {f, {!_db.make_signal( n )}} );
+            repr_to_signal.insert( {f, {!db.make_signal( n )}} );
           }
           else
           {
-            _repr_to_signal[f].push_back( !_db.make_signal( n ) );
+            repr_to_signal[f].push_back( !db.make_signal( n ) );
           }
         }
       }
     } );
 
-    st.db_size = _db.size();
-    st.covered_classes = static_cast<uint32_t>( _repr_to_signal.size() );
+    return result;
   }
 
   xag_npn_resynthesis_params ps;
   xag_npn_resynthesis_stats st;
   xag_npn_resynthesis_stats* pst{nullptr};
 
-  std::vector<std::tuple<kitty::static_truth_table<4u>, uint32_t, std::vector<uint8_t>>> _repr;
-  std::unordered_map<kitty::static_truth_table<4u>, std::vector<signal<DatabaseNtk>>, kitty::hash<kitty::static_truth_table<4u>>> _repr_to_signal;
-
-  DatabaseNtk _db;
+  npn4_classes const* _classes{nullptr};
+  database const* _database{nullptr};
 
   // clang-format off
   inline static const uint32_t subgraphs[] = {1780 << 16 | 0 << 8 | 4,
@@ -47,6 +47,7 @@
 #include "../../io/write_bench.hpp"
 #include "../../networks/xmg.hpp"
 #include "../../utils/node_map.hpp"
+#include "../../utils/npn4_classes.hpp"
 #include "../../utils/stopwatch.hpp"
 #include "../../views/topo_view.hpp"
 
@@ -79,7 +80,8 @@ struct xmg3_npn_resynthesis_stats
  * This resynthesis function can be passed to ``cut_rewriting``.  It will
  * produce a network based on pre-computed xmg3s with up to at most 4 variables.
  * Consequently, the nodes' fan-in sizes in the input network must not exceed
- * 4.
+ * 4.  The database is built when the first instance is constructed and shared
+ * by all later instances.
  *
    \verbatim embed:rst
 
@@ -103,8 +105,7 @@ class xmg3_npn_resynthesis
 public:
   xmg3_npn_resynthesis( xmg3_npn_resynthesis_params const& ps = {}, xmg3_npn_resynthesis_stats* pst = nullptr )
       : ps( ps ),
-        pst( pst ),
-        _classes( 1 << 16 )
+        pst( pst )
   {
     static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
     static_assert( has_get_constant_v<Ntk>, "Ntk does not implement the get_constant method" );
@@ -124,7 +125,6 @@ public:
     static_assert( has_foreach_node_v<DatabaseNtk>, "DatabaseNtk does not implement the foreach_node method" );
     static_assert( has_make_signal_v<DatabaseNtk>, "DatabaseNtk does not implement the make_signal method" );
 
-    _repr.reserve( 222u );
     build_classes();
     build_db();
   }
@@ -148,16 +148,16 @@ public:
     kitty::static_truth_table<4u> tt = kitty::extend_to<4u>( function );
 
     /* get representative of function */
-    const auto repr = _repr[_classes[*tt.cbegin()]];
+    const auto& repr = _classes->representative( tt );
 
     /* check if representative has circuits */
-    const auto it = _repr_to_signal.find( repr );
-    if ( it == _repr_to_signal.end() )
+    const auto it = _database->repr_to_signal.find( repr );
+    if ( it == _database->repr_to_signal.end() )
     {
       return;
     }
 
-    const auto config = kitty::exact_npn_canonization( tt );
+    const auto config = _classes->canonization( tt );
 
     assert( repr == std::get<0>( config ) );
 
@@ -189,8 +189,8 @@ public:
       {
         db_to_ntk.insert( {i + 1, pis_perm[i]} );
       }
-      auto f = copy_db_entry( ntk, _db.get_node( cand ), db_to_ntk );
-      if ( _db.is_complemented( cand ) != ( ( phase >> 4 ) & 1 ) )
+      auto f = copy_db_entry( ntk, _database->db.get_node( cand ), db_to_ntk );
+      if ( _database->db.is_complemented( cand ) != ( ( phase >> 4 ) & 1 ) )
       {
         f = ntk.create_not( f );
       }
@@ -202,6 +202,13 @@ public:
   }
 
 private:
+  /* database of subgraphs, which is shared by all instances */
+  struct database
+  {
+    DatabaseNtk db;
+    std::unordered_map<kitty::static_truth_table<4u>, std::vector<signal<DatabaseNtk>>, kitty::hash<kitty::static_truth_table<4u>>> repr_to_signal;
+  };
+
   signal<Ntk>
   copy_db_entry( Ntk& ntk, node<DatabaseNtk> const& n, std::unordered_map<node<DatabaseNtk>, signal<Ntk>>& db_to_ntk ) const
   {
@@ -210,18 +217,19 @@ private:
       return it->second;
     }
 
+    auto const& db = _database->db;
     std::vector<signal<Ntk>> fanin;
     //std::array<signal<Ntk>, 2> fanin;
-    _db.foreach_fanin( n, [&]( auto const& f ) {
-      auto ntk_f = copy_db_entry( ntk, _db.get_node( f ), db_to_ntk );
-      if ( _db.is_complemented( f ) )
+    db.foreach_fanin( n, [&]( auto const& f ) {
+      auto ntk_f = copy_db_entry( ntk, db.get_node( f ), db_to_ntk );
+      if ( db.is_complemented( f ) )
       {
         ntk_f = ntk.create_not( ntk_f );
       }
       fanin.push_back( ntk_f );
     } );
 
-    const auto f = _db.is_xor3( n ) ? ntk.create_xor3( fanin[0], fanin[1], fanin[2] ) : ntk.create_maj( fanin[0], fanin[1], fanin[2] );
+    const auto f = db.is_xor3( n ) ? ntk.create_xor3( fanin[0], fanin[1], fanin[2] ) : ntk.create_maj( fanin[0], fanin[1], fanin[2] );
     db_to_ntk.insert( {n, f} );
     return f;
   }
@@ -230,35 +238,34 @@ private:
   {
     stopwatch t( st.time_classes );
 
-    kitty::dynamic_truth_table map( 16u );
-    std::transform( map.cbegin(), map.cend(), map.begin(), []( auto word ) { return ~word; } );
-
-    int64_t index = 0;
-    kitty::static_truth_table<4u> tt;
-    while ( index != -1 )
-    {
-      kitty::create_from_words( tt, &index, &index + 1 );
-      const auto res = kitty::exact_npn_canonization( tt, [&]( const auto& tt ) {
-        _classes[*tt.cbegin()] = _repr.size();
-        kitty::clear_bit( map, *tt.cbegin() );
-      } );
-      _repr.push_back( std::get<0>( res ) );
-
-      /* find next non-classified truth table */
-      index = find_first_one_bit( map );
-    }
+    _classes = &npn4_classes::get();
   }
 
   void build_db()
   {
     stopwatch t( st.time_db );
 
-    _db.get_constant( false );
+    static const database shared = make_database();
+    _database = &shared;
+
+    st.db_size = _database->db.size();
+    st.covered_classes = static_cast<uint32_t>( _database->repr_to_signal.size() );
+  }
+
+  static database make_database()
+  {
+    auto const& classes = npn4_classes::get();
+
+    database result;
+    auto& db = result.db;
+    auto& repr_to_signal = result.repr_to_signal;
+
+    db.get_constant( false );
     /* four primary inputs */
-    _db.create_pi();
-    _db.create_pi();
-    _db.create_pi();
-    _db.create_pi();
+    db.create_pi();
+    db.create_pi();
+    db.create_pi();
+    db.create_pi();
 
     auto* p = subgraphs;
     while ( true )
@@ -273,64 +280,60 @@ private:
       auto is_xor = entry0 & 1;
       entry0 >>= 1;
 
-      const auto child0 = _db.make_signal( entry0 >> 1 ) ^ ( entry0 & 1 );
-      const auto child1 = _db.make_signal( entry1 >> 1 ) ^ ( entry1 & 1 );
-      const auto child2 = _db.make_signal( entry2 >> 1 ) ^ ( entry2 & 1 );
+      const auto child0 = db.make_signal( entry0 >> 1 ) ^ ( entry0 & 1 );
+      const auto child1 = db.make_signal( entry1 >> 1 ) ^ ( entry1 & 1 );
+      const auto child2 = db.make_signal( entry2 >> 1 ) ^ ( entry2 & 1 );
 
       if ( is_xor )
       {
-        _db.create_xor3( child0, child1, child2 );
+        db.create_xor3( child0, child1, child2 );
       }
       else
       {
-        _db.create_maj( child0, child1, child2 );
+        db.create_maj( child0, child1, child2 );
       }
     }
 
-    const auto sim_res = simulate_nodes<kitty::static_truth_table<4u>>( _db );
+    const auto sim_res = simulate_nodes<kitty::static_truth_table<4u>>( db );
 
-    _db.foreach_node( [&]( auto n ) {
-      if ( _repr[_classes[*sim_res[n].cbegin()]] == sim_res[n] )
+    db.foreach_node( [&]( auto n ) {
+      if ( classes.representative( sim_res[n] ) == sim_res[n] )
       {
-        if ( _repr_to_signal.count( sim_res[n] ) == 0 )
+        if ( repr_to_signal.count( sim_res[n] ) == 0 )
         {
-          _repr_to_signal.insert( {sim_res[n], {_db.make_signal( n )}} );
+          repr_to_signal.insert( {sim_res[n], {db.make_signal( n )}} );
         }
         else
         {
-          _repr_to_signal[sim_res[n]].push_back( _db.make_signal( n ) );
+          repr_to_signal[sim_res[n]].push_back( db.make_signal( n ) );
         }
       }
       else
       {
         const auto f = ~sim_res[n];
-        if ( _repr[_classes[*f.cbegin()]] == f )
+        if ( classes.representative( f ) == f )
         {
-          if ( _repr_to_signal.count( f ) == 0 )
+          if ( repr_to_signal.count( f ) == 0 )
           {
-            _repr_to_signal.insert( {f, {!_db.make_signal( n )}} );
+            repr_to_signal.insert( {f, {!db.make_signal( n )}} );
           }
           else
           {
-            _repr_to_signal[f].push_back( !_db.make_signal( n ) );
+            repr_to_signal[f].push_back( !db.make_signal( n ) );
           }
         }
       }
     } );
 
-    st.db_size = _db.size();
-    st.covered_classes = static_cast<uint32_t>( _repr_to_signal.size() );
+    return result;
   }
 
   xmg3_npn_resynthesis_params ps;
   xmg3_npn_resynthesis_stats st;
   xmg3_npn_resynthesis_stats* pst{nullptr};
 
-  std::vector<kitty::static_truth_table<4u>> _repr;
-  std::vector<uint32_t> _classes;
-  std::unordered_map<kitty::static_truth_table<4u>, std::vector<signal<DatabaseNtk>>, kitty::hash<kitty::static_truth_table<4u>>> _repr_to_signal;
-
-  DatabaseNtk _db;
+  npn4_classes const* _classes{nullptr};
+  database const* _database{nullptr};
 
   // clang-format off
   inline static const uint16_t subgraphs[]
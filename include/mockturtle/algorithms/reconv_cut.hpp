@@ -106,7 +106,26 @@ public:
 
   std::pair<std::vector<node>, std::vector<node>> run( std::vector<node> const& pivots )
   {
-    assert( pivots.size() > 0u );
+    compute( pivots.begin(), pivots.end() );
+    return { leaves, nodes };
+  }
+
+  /*! \brief Computes the cut of a single pivot without allocating memory.
+   *
+   * The returned leaves are stored in an internal buffer and are valid
+   * until the next call.
+   */
+  std::vector<node> const& run_single( node const& pivot )
+  {
+    compute( &pivot, &pivot + 1 );
+    return leaves;
+  }
+
+private:
+  template<typename Iterator>
+  void compute( Iterator begin, Iterator end )
+  {
+    assert( begin != end );
 
     /* prepare for traversal and clean internal state */
     ntk.incr_trav_id();
@@ -114,23 +133,23 @@ public:
     leaves.clear();
 
     /* collect and mark all pivots */
-    for ( const auto& pivot : pivots )
+    for ( auto it = begin; it != end; ++it )
     {
       if constexpr ( compute_nodes )
       {
-        nodes.emplace_back( pivot );
+        nodes.emplace_back( *it );
       }
-      ntk.set_visited( pivot, ntk.trav_id() );
+      ntk.set_visited( *it, ntk.trav_id() );
     }
 
-    leaves = pivots;
+    leaves.assign( begin, end );
 
     if ( leaves.size() > ps.max_leaves )
     {
       /* special case: cut already overflows at the current node because the cut size limit is very low */
       leaves.clear();
       nodes.clear();
-      return { leaves, nodes };
+      return;
     }
 
     /* compute the cut */
@@ -141,11 +160,8 @@ public:
     ++st.num_calls;
     st.num_leaves += leaves.size();
     st.num_nodes += nodes.size();
-
-    return { leaves, nodes };
   }
 
-private:
   bool construct_cut()
   {
     uint64_t best_cost{std::numeric_limits<uint64_t>::max()};
@@ -278,7 +294,26 @@ public:
 
   std::pair<std::vector<node>, std::vector<node>> run( std::vector<node> const& pivots )
   {
-    assert( pivots.size() > 0u );
+    compute( pivots.begin(), pivots.end() );
+    return { leaves, nodes };
+  }
+
+  /*! \brief Computes the cut of a single pivot without allocating memory.
+   *
+   * The returned leaves are stored in an internal buffer and are valid
+   * until the next call.
+   */
+  std::vector<node> const& run_single( node const& pivot )
+  {
+    compute( &pivot, &pivot + 1 );
+    return leaves;
+  }
+
+private:
+  template<typename Iterator>
+  void compute( Iterator begin, Iterator end )
+  {
+    assert( begin != end );
 
     /* prepare for traversal and clean internal state */
     ntk.incr_trav_id();
@@ -286,9 +321,9 @@ public:
     leaves.clear();
     assert( nodes.empty() );
 
-    for ( const auto& pivot : pivots )
+    for ( auto it = begin; it != end; ++it )
     {
-      ntk.set_visited( pivot, ntk.trav_id() );
+      ntk.set_visited( *it, ntk.trav_id() );
     }
 
     while ( construct_cut() );
@@ -298,8 +333,6 @@ public:
     ++st.num_calls;
     st.num_leaves += leaves.size();
     st.num_nodes += nodes.size();
-
-    return { leaves, nodes };
   }
 
   bool construct_cut()
@@ -163,7 +163,7 @@ public:
         return true;
       }
 
-      std::vector<signal<Ntk>> leaves( mffc.num_pis() );
+      leaves.resize( mffc.num_pis() );
       mffc.foreach_pi( [&]( auto const& m, auto j ) {
         leaves[j] = ntk.make_signal( m );
       } );
@@ -178,7 +178,7 @@ public:
         {
           if constexpr ( has_refactoring_with_dont_cares_v<Ntk, RefactoringFn, decltype( leaves.begin() )> )
           {
-            std::vector<node<Ntk>> pivots;
+            pivots.clear();
             for ( auto const& c : leaves )
             {
               pivots.push_back( ntk.get_node( c ) );
@@ -272,6 +272,10 @@ private:
   refactoring_stats& st;
   NodeCostFn cost_fn;
 
+  /* buffers reused across nodes */
+  std::vector<signal<Ntk>> leaves;
+  std::vector<node<Ntk>> pivots;
+
   uint32_t _candidates{0};
   uint32_t _estimated_gain{0};
 };
@@ -33,6 +33,7 @@
 
 #pragma once
 
+#include "../networks/storage.hpp"
 #include "../traits.hpp"
 #include "../utils/progress_bar.hpp"
 #include "../utils/stopwatch.hpp"
@@ -43,6 +44,16 @@
 #include "dont_cares.hpp"
 #include "reconv_cut.hpp"
 
+#include <kitty/dynamic_truth_table.hpp>
+#include <kitty/static_truth_table.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 namespace mockturtle
@@ -84,6 +95,17 @@ struct resubstitution_params
   /* \brief Window size for don't cares calculation. Only used by window-based resub engine. */
   uint32_t window_size{12u};
 
+  /*! \brief Number of threads for speculative resubstitution. Only used by window-based resub engine.
+   *
+   * If larger than 1, windows and resubstitution candidates are computed by
+   * worker threads on private copies of the network, and are committed in
+   * order after checking that the window has not been modified.
+   */
+  uint32_t num_threads{1u};
+
+  /*! \brief Number of root nodes evaluated speculatively per round. Only used if `num_threads` is larger than 1. */
+  uint32_t speculation_window{1024u};
+
   /****** simulation-based resub engine ******/
 
   /*! \brief Whether to use pre-generated patterns stored in a file.
@@ -94,6 +116,9 @@ struct resubstitution_params
   /*! \brief Whether to save the appended patterns (with CEXs) into file. Only used by simulation-based resub engine. */
   std::optional<std::string> save_patterns{};
 
+  /*! \brief Whether to save the patterns in binary format. If `save_patterns` is the binary file in `pattern_filename`, only the CEXs are appended to it. Only used by simulation-based resub engine. */
+  bool binary_patterns{false};
+
   /*! \brief Conflict limit for the SAT solver. Only used by simulation-based resub engine. */
   uint32_t conflict_limit{1000};
 
@@ -139,6 +164,15 @@ struct resubstitution_stats
   /*! \brief Initial network size (before resubstitution). */
   uint64_t initial_size{0};
 
+  /*! \brief Number of speculatively computed windows that were still valid. */
+  uint64_t num_speculative_accepts{0};
+
+  /*! \brief Number of speculatively computed windows that had to be recomputed. */
+  uint64_t num_speculative_retries{0};
+
+  /*! \brief Whether `num_threads` > 1 was requested for a network or engine without speculative mode. */
+  bool single_threaded_fallback{false};
+
   void report() const
   {
     // clang-format off
@@ -146,6 +180,15 @@ struct resubstitution_stats
     std::cout <<              "[i]     ========  Stats  ========\n";
     std::cout << fmt::format( "[i]     #divisors = {:8d}\n", num_total_divisors );
     std::cout << fmt::format( "[i]     est. gain = {:8d} ({:>5.2f}%)\n", estimated_gain, ( 100.0 * estimated_gain ) / initial_size );
+    if ( num_speculative_accepts + num_speculative_retries > 0 )
+    {
+      std::cout << fmt::format( "[i]     #spec. ok = {:8d}\n", num_speculative_accepts );
+      std::cout << fmt::format( "[i]     #retries  = {:8d}\n", num_speculative_retries );
+    }
+    if ( single_threaded_fallback )
+    {
+      std::cout <<            "[i]     speculative mode not supported, ran single-threaded\n";
+    }
     std::cout <<              "[i]     ======== Runtime ========\n";
     std::cout << fmt::format( "[i]     total         : {:>5.2f} secs\n", to_seconds( time_total ) );
     std::cout << fmt::format( "[i]       DivCollector: {:>5.2f} secs\n", to_seconds( time_divs ) );
@@ -179,6 +222,9 @@ struct default_collector_stats
   /*! \brief Total number of leaves. */
   uint64_t num_total_leaves{0};
 
+  /*! \brief Number of pivots for which the leaves, divisors, or MFFC buffers had to grow. */
+  uint64_t num_reallocations{0};
+
   /*! \brief Accumulated runtime for cut computation. */
   stopwatch<>::duration time_cuts{0};
 
@@ -193,6 +239,7 @@ struct default_collector_stats
     // clang-format off
     std::cout <<              "[i] <DivCollector: default_divisor_collector>\n";
     std::cout << fmt::format( "[i]     #leaves = {:6d}\n", num_total_leaves );
+    std::cout << fmt::format( "[i]     #reallocs = {:4d}\n", num_reallocations );
     std::cout <<              "[i]     ======== Runtime ========\n";
     std::cout << fmt::format( "[i]     reconv. cut : {:>5.2f} secs\n", to_seconds( time_cuts ) );
     std::cout << fmt::format( "[i]     MFFC        : {:>5.2f} secs\n", to_seconds( time_mffc ) );
@@ -232,8 +279,12 @@ public:
 
 public:
   explicit default_divisor_collector( Ntk const& ntk, resubstitution_params const& ps, stats& st )
-    : ntk( ntk ), ps( ps ), st( st ), cuts( ntk, cut_comp_parameters_type{ps.max_pis}, cuts_st )
+    : ntk( ntk ), ps( ps ), st( st ), cuts( ntk, cut_comp_parameters_type{ps.max_pis}, cuts_st ), mffc_mgr( ntk )
   {
+    /* buffers are reused for all pivots */
+    leaves.reserve( ps.max_pis );
+    divs.reserve( ps.max_divisors );
+    mffc.reserve( ps.max_divisors );
   }
 
   bool run( node const& n, mffc_result_t& potential_gain )
@@ -244,14 +295,15 @@ public:
       return false;
     }
 
+    const auto capacity = leaves.capacity() + divs.capacity() + mffc.capacity();
+
     /* compute a reconvergence-driven cut */
-    leaves = call_with_stopwatch( st.time_cuts, [&]() {
-        return cuts.run( { n } ).first;
+    call_with_stopwatch( st.time_cuts, [&]() {
+      leaves = cuts.run_single( n );
     });
     st.num_total_leaves += leaves.size();
 
     /* collect the MFFC */
-    MffcMgr mffc_mgr( ntk );
     potential_gain = call_with_stopwatch( st.time_mffc, [&]() {
       return mffc_mgr.run( n, leaves, mffc );
     });
@@ -261,6 +313,11 @@ public:
       return collect_divisors( n );
     });
 
+    if ( leaves.capacity() + divs.capacity() + mffc.capacity() != capacity )
+    {
+      ++st.num_reallocations;
+    }
+
     if ( !div_comp_success )
     {
       return false;
@@ -410,6 +467,7 @@ private:
 
   cut_comp cuts;
   cut_comp_statistics_type cuts_st;
+  MffcMgr mffc_mgr;
 
 public:
   std::vector<node> leaves;
@@ -543,13 +601,12 @@ private:
 
       /* compute truth tables of inner nodes */
       sim.assign( d, i - uint32_t( leaves.size() ) + ps.max_pis + 1 );
-      std::vector<TTsim> tts;
+      fanin_tts.clear();
       ntk.foreach_fanin( d, [&]( const auto& s ) {
-        tts.emplace_back( sim.get_tt( ntk.make_signal( ntk.get_node( s ) ) ) ); /* ignore sign */
+        fanin_tts.emplace_back( sim.get_tt( ntk.make_signal( ntk.get_node( s ) ) ) ); /* ignore sign */
       } );
 
-      auto const tt = ntk.compute( d, tts.begin(), tts.end() );
-      sim.set_tt( i - uint32_t( leaves.size() ) + ps.max_pis + 1, tt );
+      sim.set_tt( i - uint32_t( leaves.size() ) + ps.max_pis + 1, ntk.compute( d, fanin_tts.begin(), fanin_tts.end() ) );
     }
 
     /* normalize truth tables */
@@ -563,8 +620,125 @@ private:
   stats& st;
 
   window_simulator<Ntk, TTsim> sim;
+
+  /* truth tables of fanins, reused across nodes */
+  std::vector<TTsim> fanin_tts;
 }; /* window_based_resub_engine */
 
+template<class Ntk, class = void>
+struct is_resub_view : std::false_type
+{
+};
+
+/* speculative resubstitution removes nodes from copies of the storage, which
+ * is implemented for structurally hashed networks of regular nodes */
+template<class Node>
+struct is_regular_node : std::false_type
+{
+};
+
+template<int Fanin, int Size, int PointerFieldSize>
+struct is_regular_node<regular_node<Fanin, Size, PointerFieldSize>> : std::true_type
+{
+};
+
+template<class Ntk, class = void>
+struct has_regular_storage : std::false_type
+{
+};
+
+template<class Ntk>
+struct has_regular_storage<Ntk, std::void_t<typename Ntk::base_type::storage>> : is_regular_node<typename Ntk::base_type::storage::element_type::node_type>
+{
+};
+
+template<class Ntk>
+struct is_resub_view<Ntk, std::void_t<typename Ntk::base_type>> : std::is_same<Ntk, fanout_view<depth_view<typename Ntk::base_type>>>
+{
+};
+
+/*! \brief Private copy of a resubstitution view.
+ *
+ * The storage of the network is copied, such that node indices agree with the
+ * original network, while traversal IDs, values, and nodes created by
+ * resubstitution functors are local to the copy.  The copy is kept across
+ * rounds of speculative resubstitution: nodes created locally are removed
+ * again, and changes of the original network are replayed.
+ */
+template<class Ntk>
+class resub_snapshot
+{
+public:
+  using base_type = typename Ntk::base_type;
+  using node = typename Ntk::node;
+
+  explicit resub_snapshot( Ntk const& ntk )
+      : base( std::make_shared<std::decay_t<decltype( *ntk._storage )>>( *ntk._storage ) ),
+        depth( base ),
+        view( depth ),
+        num_nodes( static_cast<uint32_t>( ntk.size() ) )
+  {
+  }
+
+  /*! \brief Removes nodes created in the copy since the last synchronization.
+   *
+   * These nodes are dangling, since the copy is only used to compute
+   * resubstitution candidates, which are never substituted in the copy.
+   */
+  void remove_local_nodes()
+  {
+    auto& storage = *base._storage;
+    while ( storage.nodes.size() > num_nodes )
+    {
+      const auto n = base.index_to_node( static_cast<uint32_t>( storage.nodes.size() - 1u ) );
+      for ( auto const& fn : base._events->on_delete )
+      {
+        fn( n );
+      }
+
+      auto& nobj = storage.nodes.back();
+      storage.hash.erase( nobj );
+      for ( auto const& c : nobj.children )
+      {
+        storage.nodes[c.index].data[0].h1--;
+      }
+      storage.nodes.pop_back();
+    }
+  }
+
+  base_type base;
+  depth_view<base_type> depth;
+  Ntk view;
+
+  /*! \brief Number of nodes at the time of the last synchronization. */
+  uint32_t num_nodes;
+};
+
+/*! \brief Calls `fn` with a truth table for windows with up to `max_pis` leaves.
+ *
+ * The truth table is passed as a default-constructed value, whose type is
+ * `kitty::static_truth_table<6>` for up to 6 leaves,
+ * `kitty::static_truth_table<8>` for up to 8 leaves, and
+ * `kitty::dynamic_truth_table` otherwise.  Variables beyond the number of
+ * leaves are not used in the simulation.
+ */
+template<class Fn>
+void with_window_truth_table( uint32_t max_pis, Fn&& fn )
+{
+  if ( max_pis <= 6u )
+  {
+    fn( kitty::static_truth_table<6u>{} );
+  }
+  else if ( max_pis <= 8u )
+  {
+    fn( kitty::static_truth_table<8u>{} );
+  }
+  else
+  {
+    fn( kitty::dynamic_truth_table{} );
+  }
+}
+
 /*! \brief The top-level resubstitution framework.
  *
  * \param ResubEngine The engine that computes the resubtitution for a given root
@@ -634,6 +808,19 @@ public:
   {
     stopwatch t( st.time_total );
 
+    if constexpr ( supports_speculation )
+    {
+      if ( ps.num_threads > 1u )
+      {
+        run_speculative( callback );
+        return;
+      }
+    }
+    else
+    {
+      st.single_threaded_fallback = ps.num_threads > 1u;
+    }
+
     /* start the managers */
     DivCollector collector( ntk, ps, collector_st );
     ResubEngine resub_engine( ntk, ps, engine_st );
@@ -654,50 +841,423 @@ public:
         return true; /* next */
       }
 
-      /* compute cut, collect divisors, compute MFFC */
-      mffc_result_t potential_gain;
-      const auto collector_success = call_with_stopwatch( st.time_divs, [&]() {
-        return collector.run( n, potential_gain );
-      });
-      if ( !collector_success )
+      resub_node( collector, resub_engine, n, callback );
+      return true; /* next */
+    } );
+  }
+
+private:
+  static constexpr bool supports_speculation = ResubEngine::require_leaves_and_mffc && is_resub_view<Ntk>::value && has_clone_node_v<Ntk> && has_regular_storage<Ntk>::value;
+
+  struct speculative_candidate
+  {
+    /*! \brief Whether the root has been evaluated by a worker. */
+    bool evaluated{false};
+
+    /*! \brief Whether a resubstitution has been found. */
+    bool found{false};
+
+    /*! \brief Worker that evaluated the root. */
+    uint32_t worker{0};
+
+    uint32_t num_divs{0};
+    uint32_t gain{0};
+
+    /*! \brief Resubstitution in the worker's copy of the network. */
+    signal g;
+
+    /*! \brief Divisors and MFFC nodes (including the root). */
+    std::vector<node> window;
+  };
+
+  /* change of the original network during the commit phase of a round, which
+   * is replayed in the copies of the workers */
+  struct network_change
+  {
+    /*! \brief Whether `n` has been created (or substituted by `g`). */
+    bool created{false};
+
+    node n;
+    signal g;
+
+    /*! \brief Fanins of a created node at the time of its creation. */
+    std::vector<signal> children;
+  };
+
+  std::optional<signal> resub_node( DivCollector& collector, ResubEngine& resub_engine, node const& n, resub_callback_t const& callback )
+  {
+    /* compute cut, collect divisors, compute MFFC */
+    mffc_result_t potential_gain;
+    const auto collector_success = call_with_stopwatch( st.time_divs, [&]() {
+      return collector.run( n, potential_gain );
+    });
+    if ( !collector_success )
+    {
+      return std::nullopt;
+    }
+
+    /* update statistics */
+    last_gain = 0;
+    st.num_total_divisors += collector.divs.size();
+
+    /* try to find a resubstitution with the divisors */
+    auto g = call_with_stopwatch( st.time_resub, [&]() {
+      if constexpr ( ResubEngine::require_leaves_and_mffc ) /* window-based */
       {
-        return true; /* next */
+        return resub_engine.run( n, collector.leaves, collector.divs, collector.mffc, potential_gain, last_gain );
+      }
+      else /* simulation-based */
+      {
+        return resub_engine.run( n, collector.divs, potential_gain, last_gain );
+      }
+    });
+    if ( !g )
+    {
+      return std::nullopt;
+    }
+
+    /* update progress bar */
+    candidates++;
+    st.estimated_gain += last_gain;
+
+    /* update network */
+    call_with_stopwatch( st.time_callback, [&]() {
+      return callback( ntk, n, *g );
+    } );
+
+    return g;
+  }
+
+  /* Roots are processed in rounds of `ps.speculation_window` nodes.  In each
+   * round, every worker evaluates roots in its private copy of the network.
+   * Then the results are committed in the original order.  A result is only
+   * used if none of its window nodes has been modified (or changed its fanout)
+   * since the beginning of the round, otherwise the root is evaluated again.
+   * The copies are kept across rounds and are brought up to date by replaying
+   * the changes of the commit phase. */
+  void run_speculative( resub_callback_t const& callback )
+  {
+    /* values mark MFFC nodes during divisor collection and are copied into
+     * the snapshots, hence stale values must not be copied */
+    ntk.clear_values();
+
+    /* round in which a node has been modified last */
+    std::vector<uint32_t> stamps( ntk.size(), 0u );
+    uint32_t round{0u};
+
+    /* changes of the current commit phase */
+    std::vector<network_change> changes;
+    std::vector<node> touched;
+    bool replayable{true};
+
+    auto const stamp = [&]( node const& n ) {
+      const auto index = ntk.node_to_index( n );
+      if ( index >= stamps.size() )
+      {
+        stamps.resize( ntk.size(), 0u );
       }
+      if ( stamps[index] != round )
+      {
+        stamps[index] = round;
+        touched.emplace_back( n );
+      }
+    };
+    auto const stamp_fanins = [&]( node const& n ) {
+      stamp( n );
+      ntk.foreach_fanin( n, [&]( auto const& f ) {
+        stamp( ntk.get_node( f ) );
+      } );
+    };
 
-      /* update statistics */
-      last_gain = 0;
-      st.num_total_divisors += collector.divs.size();
+    const auto event_ptr = std::array<std::size_t, 3>{ntk._events->on_add.size(), ntk._events->on_modified.size(), ntk._events->on_delete.size()};
+    ntk._events->on_add.emplace_back( [&]( node const& n ) {
+      stamp_fanins( n );
 
-      /* try to find a resubstitution with the divisors */
-      auto g = call_with_stopwatch( st.time_resub, [&]() {
-        if constexpr ( ResubEngine::require_leaves_and_mffc ) /* window-based */
+      network_change change;
+      change.created = true;
+      change.n = n;
+      ntk.foreach_fanin( n, [&]( auto const& f ) {
+        change.children.emplace_back( f );
+      } );
+      changes.emplace_back( change );
+    } );
+    ntk._events->on_modified.emplace_back( [&]( node const& n, std::vector<signal> const& previous ) {
+      stamp_fanins( n );
+      for ( auto const& f : previous )
+      {
+        stamp( ntk.get_node( f ) );
+      }
+    } );
+    ntk._events->on_delete.emplace_back( [&]( node const& n ) {
+      stamp_fanins( n );
+    } );
+
+    auto const is_untouched = [&]( node const& n ) {
+      const auto index = ntk.node_to_index( n );
+      return !ntk.is_dead( n ) && ( index >= stamps.size() || stamps[index] < round );
+    };
+
+    /* applies the callback and records the substitution */
+    auto const commit = [&]( node const& n, signal const& g ) {
+      const auto substituted = callback( ntk, n, g );
+      if ( substituted && ntk.is_dead( n ) )
+      {
+        network_change change;
+        change.n = n;
+        change.g = g;
+        changes.emplace_back( change );
+      }
+      else if ( substituted )
+      {
+        /* the callback changed the network in some other way */
+        replayable = false;
+      }
+      stamp( n );
+      stamp( ntk.get_node( g ) );
+      return substituted;
+    };
+
+    DivCollector collector( ntk, ps, collector_st );
+    ResubEngine resub_engine( ntk, ps, engine_st );
+
+    std::vector<node> gates;
+    auto const size = ntk.num_gates();
+    ntk.foreach_gate( [&]( auto const& n, auto i ) {
+      if ( i >= size )
+      {
+        return false; /* terminate */
+      }
+      gates.emplace_back( n );
+      return true; /* next */
+    } );
+
+    progress_bar pbar{static_cast<uint32_t>( gates.size() ), "resub |{0}| node = {1:>4}   cand = {2:>4}   est. gain = {3:>5}", ps.progress};
+
+    const auto window = std::max( ps.speculation_window, 1u );
+    std::vector<speculative_candidate> cands;
+    std::vector<std::unique_ptr<resub_snapshot<Ntk>>> snapshots( ps.num_threads );
+
+    for ( auto begin = 0u; begin < gates.size(); begin += window )
+    {
+      const auto end = std::min<uint32_t>( begin + window, static_cast<uint32_t>( gates.size() ) );
+      ++round;
+
+      cands.clear();
+      cands.resize( end - begin );
+
+      std::atomic<uint32_t> next{begin};
+      std::vector<std::thread> workers;
+      for ( auto w = 0u; w < ps.num_threads; ++w )
+      {
+        workers.emplace_back( [&, w]() {
+          synchronize( snapshots[w], changes, touched, replayable );
+          evaluate_speculatively( *snapshots[w], w, gates, next, end, cands, begin );
+        } );
+      }
+      for ( auto& worker : workers )
+      {
+        worker.join();
+      }
+
+      changes.clear();
+      touched.clear();
+      replayable = true;
+
+      for ( auto j = begin; j < end; ++j )
+      {
+        auto const& n = gates[j];
+        auto const& cand = cands[j - begin];
+
+        pbar( j, j, candidates, st.estimated_gain );
+
+        if ( ntk.is_dead( n ) )
+        {
+          continue;
+        }
+
+        auto& snap = *snapshots[cand.worker];
+        if ( !cand.evaluated || !std::all_of( cand.window.begin(), cand.window.end(), is_untouched ) ||
+             ( cand.found && !is_untouched_cone( snap, snap.view.get_node( cand.g ), is_untouched ) ) )
         {
-          return resub_engine.run( n, collector.leaves, collector.divs, collector.mffc, potential_gain, last_gain );
+          ++st.num_speculative_retries;
+          resub_node( collector, resub_engine, n, [&]( auto&, auto const& root, auto const& g ) {
+            return commit( root, g );
+          } );
+          continue;
         }
-        else /* simulation-based */
+
+        ++st.num_speculative_accepts;
+        st.num_total_divisors += cand.num_divs;
+        if ( !cand.found )
+        {
+          continue;
+        }
+
+        std::unordered_map<node, signal> imported;
+        const auto g = import_signal( snap, cand.g, imported );
+
+        candidates++;
+        st.estimated_gain += cand.gain;
+
+        call_with_stopwatch( st.time_callback, [&]() {
+          return commit( n, g );
+        } );
+      }
+    }
+
+    ntk._events->on_add.erase( ntk._events->on_add.begin() + event_ptr[0] );
+    ntk._events->on_modified.erase( ntk._events->on_modified.begin() + event_ptr[1] );
+    ntk._events->on_delete.erase( ntk._events->on_delete.begin() + event_ptr[2] );
+  }
+
+  /* brings the copy of a worker up to date by replaying the changes of the
+   * last commit phase, or copies the network if this is not possible */
+  void synchronize( std::unique_ptr<resub_snapshot<Ntk>>& snap, std::vector<network_change> const& changes, std::vector<node> const& touched, bool replayable ) const
+  {
+    if ( snap && replayable && replay( *snap, changes, touched ) )
+    {
+      return;
+    }
+    snap = std::make_unique<resub_snapshot<Ntk>>( ntk );
+  }
+
+  bool replay( resub_snapshot<Ntk>& snap, std::vector<network_change> const& changes, std::vector<node> const& touched ) const
+  {
+    snap.remove_local_nodes();
+
+    for ( auto const& change : changes )
+    {
+      if ( change.created )
+      {
+        const auto g = snap.view.clone_node( ntk, change.n, change.children );
+        if ( snap.view.get_node( g ) != change.n )
         {
-          return resub_engine.run( n, collector.divs, potential_gain, last_gain );
+          return false;
         }
-      });
-      if ( !g )
+      }
+      else
       {
-        return true; /* next */
+        snap.view.substitute_node( change.n, change.g );
       }
+    }
 
-      /* update progress bar */
-      candidates++;
-      st.estimated_gain += last_gain;
+    if ( snap.view.size() != ntk.size() )
+    {
+      return false;
+    }
 
-      /* update network */
-      call_with_stopwatch( st.time_callback, [&]() {
-        return callback( ntk, n, *g );
+    /* levels of modified nodes are copied, and so are levels in their
+     * transitive fanout as long as they differ from the original network */
+    snap.view.resize_levels();
+    std::vector<node> stack( touched.begin(), touched.end() );
+    std::vector<bool> seeds( ntk.size(), false );
+    for ( auto const& n : touched )
+    {
+      seeds[ntk.node_to_index( n )] = true;
+    }
+    while ( !stack.empty() )
+    {
+      const auto n = stack.back();
+      stack.pop_back();
+      if ( !seeds[ntk.node_to_index( n )] && snap.view.level( n ) == ntk.level( n ) )
+      {
+        continue;
+      }
+      seeds[ntk.node_to_index( n )] = false;
+      snap.view.set_level( n, ntk.level( n ) );
+      ntk.foreach_fanout( n, [&]( auto const& p ) {
+        stack.push_back( p );
       } );
+    }
 
-      return true; /* next */
+    snap.num_nodes = static_cast<uint32_t>( ntk.size() );
+    return true;
+  }
+
+  void evaluate_speculatively( resub_snapshot<Ntk>& snap, uint32_t worker, std::vector<node> const& gates, std::atomic<uint32_t>& next, uint32_t end, std::vector<speculative_candidate>& cands, uint32_t begin ) const
+  {
+    /* statistics of workers are not collected */
+    collector_st_t local_collector_st;
+    engine_st_t local_engine_st;
+    DivCollector collector( snap.view, ps, local_collector_st );
+    ResubEngine resub_engine( snap.view, ps, local_engine_st );
+
+    for ( auto j = next++; j < end; j = next++ )
+    {
+      auto const& n = gates[j];
+      auto& cand = cands[j - begin];
+      cand.worker = worker;
+
+      if ( snap.view.is_dead( n ) )
+      {
+        continue;
+      }
+
+      cand.evaluated = true;
+
+      mffc_result_t potential_gain;
+      if ( !collector.run( n, potential_gain ) )
+      {
+        cand.window.emplace_back( n );
+        continue;
+      }
+
+      cand.num_divs = static_cast<uint32_t>( collector.divs.size() );
+      cand.window = collector.divs;
+      cand.window.insert( cand.window.end(), collector.mffc.begin(), collector.mffc.end() );
+
+      if ( const auto g = resub_engine.run( n, collector.leaves, collector.divs, collector.mffc, potential_gain, cand.gain ); g )
+      {
+        cand.found = true;
+        cand.g = *g;
+      }
+    }
+  }
+
+  /* checks nodes of the original network that are used by a resubstitution */
+  template<class Fn>
+  bool is_untouched_cone( resub_snapshot<Ntk> const& snap, node const& n, Fn&& is_untouched ) const
+  {
+    if ( snap.view.node_to_index( n ) < snap.num_nodes )
+    {
+      return is_untouched( n );
+    }
+
+    bool result = true;
+    snap.view.foreach_fanin( n, [&]( auto const& f ) {
+      result = is_untouched_cone( snap, snap.view.get_node( f ), is_untouched );
+      return result;
     } );
+    return result;
+  }
+
+  /* rebuilds nodes created in the copy of the network in the original network */
+  signal import_signal( resub_snapshot<Ntk> const& snap, signal const& f, std::unordered_map<node, signal>& imported )
+  {
+    const auto n = snap.view.get_node( f );
+
+    signal g;
+    if ( snap.view.node_to_index( n ) < snap.num_nodes )
+    {
+      g = ntk.make_signal( n );
+    }
+    else if ( const auto it = imported.find( n ); it != imported.end() )
+    {
+      g = it->second;
+    }
+    else
+    {
+      std::vector<signal> children;
+      snap.view.foreach_fanin( n, [&]( auto const& c ) {
+        children.emplace_back( import_signal( snap, c, imported ) );
+      } );
+      g = ntk.clone_node( snap.view, n, children );
+      imported.emplace( n, g );
+    }
+
+    return snap.view.is_complemented( f ) ? ntk.create_not( g ) : g;
   }
 
-private:
   /* maybe should move to depth_view */
   void update_node_level( node const& n, bool top_most = true )
   {
@@ -769,9 +1329,8 @@ void default_resubstitution( Ntk& ntk, resubstitution_params const& ps = {}, res
   depth_view<Ntk> depth_view{ntk};
   resub_view_t resub_view{depth_view};
 
-  if ( ps.max_pis == 8 )
-  {
-    using truthtable_t = kitty::static_truth_table<8>;
+  detail::with_window_truth_table( ps.max_pis, [&]( auto tt ) {
+    using truthtable_t = decltype( tt );
     using truthtable_dc_t = kitty::dynamic_truth_table;
     using resub_impl_t = detail::resubstitution_impl<resub_view_t, typename detail::window_based_resub_engine<resub_view_t, truthtable_t, truthtable_dc_t>>;
 
@@ -793,30 +1352,7 @@ void default_resubstitution( Ntk& ntk, resubstitution_params const& ps = {}, res
     {
       *pst = st;
     }
-  }
-  else
-  {
-    using resub_impl_t = detail::resubstitution_impl<resub_view_t>;
-
-    resubstitution_stats st;
-    typename resub_impl_t::engine_st_t engine_st;
-    typename resub_impl_t::collector_st_t collector_st;
-
-    resub_impl_t p( resub_view, ps, st, engine_st, collector_st );
-    p.run();
-
-    if ( ps.verbose )
-    {
-      st.report();
-      collector_st.report();
-      engine_st.report();
-    }
-
-    if ( pst )
-    {
-      *pst = st;
-    }
-  }
+  } );
 }
 
 } /* namespace mockturtle */
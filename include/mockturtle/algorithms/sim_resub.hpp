@@ -812,6 +812,7 @@ public:
       }
     });
     st.num_pats = sim.num_bits();
+    num_loaded_patterns = sim.num_bits();
 
     /* first simulation: the whole circuit; from 0 bits. */
     call_with_stopwatch( st.time_sim, [&]() {
@@ -823,7 +824,14 @@ public:
   {
     if ( ps.save_patterns )
     {
-      write_patterns( sim, *ps.save_patterns );
+      if ( !ps.binary_patterns )
+      {
+        write_patterns( sim, *ps.save_patterns );
+      }
+      else if ( ps.pattern_filename != ps.save_patterns || !append_binary_patterns( sim, *ps.save_patterns, num_loaded_patterns ) )
+      {
+        write_binary_patterns( sim, *ps.save_patterns );
+      }
     }
   }
 
@@ -979,6 +987,7 @@ private:
 
   TT tts;
   partial_simulator sim;
+  uint32_t num_loaded_patterns{0};
 
   validator_params vps;
   validator_t validator;
@@ -38,6 +38,7 @@
 #include <fstream>
 #include <random>
 
+#include "../io/binary_patterns.hpp"
 #include "../traits.hpp"
 #include "../utils/node_map.hpp"
 
@@ -209,6 +210,9 @@ public:
    *
    * The simulation pattern file should contain `num_pis` lines of the same length.
    * Each line is the simulation signature of a primary input, represented in hexadecimal.
+   * Files written by `write_binary_patterns` are detected and memory-mapped instead.
+   * If the file cannot be read or contains no patterns, the simulator has no
+   * primary inputs and `num_bits()` returns 0.
    *
    * \param fielname Name of the simulation pattern file.
    * \param length Number of simulation patterns to keep. Should not be greater than 4 times 
@@ -216,6 +220,19 @@ public:
    */
   partial_simulator( const std::string& filename, uint32_t length = 0u )
   {
+    if ( is_binary_patterns_file( filename ) )
+    {
+      if ( read_binary_patterns( filename, patterns, length ) && !patterns.empty() )
+      {
+        num_patterns = patterns[0].num_bits();
+      }
+      else
+      {
+        patterns.clear();
+      }
+      return;
+    }
+
     std::ifstream in( filename, std::ifstream::in );
     std::string line;
 
@@ -231,8 +248,10 @@ public:
 
     in.close();
 
-    assert( patterns.size() > 0 );
-    num_patterns = patterns[0].num_bits();
+    if ( !patterns.empty() )
+    {
+      num_patterns = patterns[0].num_bits();
+    }
   }
 
   kitty::partial_truth_table compute_constant( bool value ) const
@@ -276,14 +295,14 @@ public:
    *
    * \return A vector of `num_pis()` patterns stored in `kitty::partial_truth_table`s.
    */
-  std::vector<kitty::partial_truth_table> get_patterns() const
+  std::vector<kitty::partial_truth_table> const& get_patterns() const
   {
     return patterns;
   }
 
 private:
   std::vector<kitty::partial_truth_table> patterns;
-  uint32_t num_patterns;
+  uint32_t num_patterns{0u};
 };
 
 /*! \brief Simulates partial truth tables, and performs bit packing when requested.
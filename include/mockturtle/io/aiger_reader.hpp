@@ -34,11 +34,33 @@
 
 #include "../networks/aig.hpp"
 #include "../traits.hpp"
+#include "../utils/name_table.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include <lorina/aiger.hpp>
 
 namespace mockturtle
 {
 
+/*! \brief Map from signals to names.
+ *
+ * A signal may have several names.  The names are interned in a
+ * `name_table`, which can be shared with other maps or with a `names_view`
+ * by passing it in the constructor, such that only 32-bit name ids are
+ * stored per signal.
+ *
+ * The container template parameters are kept for compatibility.
+ * `StorageContainerMap` is ignored, since names are stored as ids, and
+ * `StorageContainerReverseMap` is the type returned by
+ * `get_name_to_signal_mapping`.
+ */
 template<typename Ntk, typename StorageContainerMap = std::unordered_map<signal<Ntk>, std::vector<std::string>>, typename StorageContainerReverseMap = std::unordered_map<std::string, signal<Ntk>>>
 class NameMap
 {
@@ -46,43 +68,38 @@ public:
   using signal = typename Ntk::signal;
 
 public:
-  NameMap() = default;
+  explicit NameMap( std::shared_ptr<name_table> names = std::make_shared<name_table>() )
+      : _table( names )
+  {
+  }
 
   void insert( signal const& s, std::string const& name )
   {
+    const auto id = _table->insert( name );
+
     /* update direct map */
-    auto const it = _names.find( s );
-    if ( it == _names.end() )
-    {
-      _names[s] = {name};
-    }
-    else
-    {
-      it->second.push_back( name );
-    }
+    _names[s].push_back( id );
 
     /* update reverse map */
-    auto const rev_it = _rev_names.find( name );
-    if ( rev_it != _rev_names.end() )
+    if ( !_rev_names.emplace( id, s ).second )
     {
       std::cout << "[w] signal name `" << name << "` is used twice" << std::endl;
     }
-    _rev_names.insert( std::make_pair( name, s ) );
   }
 
   std::vector<std::string> operator[]( signal const& s )
   {
-    return _names[s];
+    return to_strings( _names[s] );
   }
 
   std::vector<std::string> operator[]( signal const& s ) const
   {
-    return _names.at( s );
+    return to_strings( _names.at( s ) );
   }
 
   std::vector<std::string> get_name( signal const& s ) const
   {
-    return _names.at( s );
+    return to_strings( _names.at( s ) );
   }
 
   bool has_name( signal const& s, std::string const& name ) const
@@ -92,17 +109,42 @@ public:
     {
       return false;
     }
-    return ( std::find( it->second.begin(), it->second.end(), name ) != it->second.end() );
+    const auto id = _table->find( name );
+    return id != name_table::invalid_id && std::find( it->second.begin(), it->second.end(), id ) != it->second.end();
   }
 
   StorageContainerReverseMap get_name_to_signal_mapping() const
   {
-    return _rev_names;
+    StorageContainerReverseMap rev_names;
+    for ( auto const& [id, s] : _rev_names )
+    {
+      rev_names.emplace( _table->str( id ), s );
+    }
+    return rev_names;
+  }
+
+  /*! \brief Returns the table in which the names are interned. */
+  std::shared_ptr<name_table> const& get_name_table() const
+  {
+    return _table;
+  }
+
+protected:
+  std::vector<std::string> to_strings( std::vector<uint32_t> const& ids ) const
+  {
+    std::vector<std::string> names;
+    names.reserve( ids.size() );
+    for ( auto id : ids )
+    {
+      names.emplace_back( _table->str( id ) );
+    }
+    return names;
   }
 
 protected:
-  StorageContainerMap _names;
-  StorageContainerReverseMap _rev_names;
+  std::shared_ptr<name_table> _table;
+  std::unordered_map<signal, std::vector<uint32_t>> _names;
+  std::unordered_map<uint32_t, signal> _rev_names;
 }; // NameMap
 
 /*! \brief Lorina reader callback for Aiger files.
@@ -0,0 +1,283 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2019  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file binary_patterns.hpp
+  \brief Binary files of simulation patterns
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <kitty/partial_truth_table.hpp>
+
+#include "../utils/mapped_file.hpp"
+
+namespace mockturtle
+{
+
+namespace detail
+{
+
+inline constexpr uint32_t binary_patterns_magic = 0x5450544du; /* "MTPT" */
+inline constexpr uint32_t binary_patterns_version = 1u;
+
+/* the header is followed by `num_pis` rows of `row_words` words, of which
+ * the first `num_patterns` bits are used; rows have spare words such that
+ * patterns can be appended in place, and at least one word such that the
+ * number of rows is bounded by the file size */
+struct binary_patterns_header
+{
+  uint32_t magic{binary_patterns_magic};
+  uint32_t version{binary_patterns_version};
+  uint64_t num_pis{0u};
+  uint64_t num_patterns{0u};
+  uint64_t row_words{0u};
+};
+
+inline bool read_binary_patterns_header( char const* data, std::size_t size, binary_patterns_header& header )
+{
+  if ( size < sizeof( binary_patterns_header ) )
+  {
+    return false;
+  }
+  std::memcpy( &header, data, sizeof( binary_patterns_header ) );
+  const uint64_t num_words = ( size - sizeof( binary_patterns_header ) ) / 8u;
+  return header.magic == binary_patterns_magic && header.version == binary_patterns_version &&
+         header.row_words <= num_words && header.num_patterns <= header.row_words * 64u &&
+         ( header.num_pis == 0u || ( header.row_words != 0u && header.num_pis <= num_words / header.row_words ) );
+}
+
+/* bits `pos` to `pos + count - 1` (count <= 64) */
+inline uint64_t extract_bits( std::vector<uint64_t> const& words, uint64_t pos, uint32_t count )
+{
+  const auto shift = pos % 64u;
+  auto value = words[pos / 64u] >> shift;
+  if ( shift != 0u && shift + count > 64u )
+  {
+    value |= words[pos / 64u + 1u] << ( 64u - shift );
+  }
+  return count == 64u ? value : value & ( ( uint64_t( 1 ) << count ) - 1u );
+}
+
+/* copies bits `first` to `last - 1` of `src` to `dest` starting at bit `pos` */
+inline void copy_bits( std::vector<uint64_t> const& src, uint64_t first, uint64_t last, uint64_t* dest, uint64_t pos )
+{
+  while ( first < last )
+  {
+    const auto offset = pos % 64u;
+    const auto count = static_cast<uint32_t>( std::min<uint64_t>( 64u - offset, last - first ) );
+    const auto mask = count == 64u ? ~uint64_t( 0 ) : ( ( uint64_t( 1 ) << count ) - 1u ) << offset;
+    dest[pos / 64u] = ( dest[pos / 64u] & ~mask ) | ( extract_bits( src, first, count ) << offset );
+    first += count;
+    pos += count;
+  }
+}
+
+inline bool write_binary_patterns_file( std::string const& filename, binary_patterns_header const& header, std::vector<uint64_t> const& rows )
+{
+  std::ofstream os( filename.c_str(), std::ofstream::out | std::ofstream::binary | std::ofstream::trunc );
+  os.write( reinterpret_cast<char const*>( &header ), sizeof( binary_patterns_header ) );
+  os.write( reinterpret_cast<char const*>( rows.data() ), rows.size() * sizeof( uint64_t ) );
+  return static_cast<bool>( os );
+}
+
+} /* namespace detail */
+
+/*! \brief Checks whether a file contains simulation patterns in binary format. */
+inline bool is_binary_patterns_file( std::string const& filename )
+{
+  std::ifstream in( filename.c_str(), std::ifstream::in | std::ifstream::binary );
+  uint32_t magic{0u};
+  in.read( reinterpret_cast<char*>( &magic ), sizeof( magic ) );
+  return in && magic == detail::binary_patterns_magic;
+}
+
+/*! \brief Reads simulation patterns from a binary file.
+ *
+ * The file is memory-mapped and each row is copied in bulk into a partial
+ * truth table.  Returns false, if the file cannot be read or is not a
+ * binary pattern file; `patterns` is then not modified.
+ *
+ * \param filename Filename
+ * \param patterns One partial truth table per primary input
+ * \param length Number of patterns to keep (0: all patterns in the file)
+ */
+inline bool read_binary_patterns( std::string const& filename, std::vector<kitty::partial_truth_table>& patterns, uint32_t length = 0u )
+{
+  mapped_file file( filename );
+  detail::binary_patterns_header header;
+  if ( !file.is_open() || !detail::read_binary_patterns_header( file.data(), file.size(), header ) )
+  {
+    return false;
+  }
+
+  const auto num_patterns = length == 0u ? header.num_patterns : length;
+  const auto num_words = ( std::min<uint64_t>( num_patterns, header.num_patterns ) + 63u ) / 64u;
+  auto const* rows = file.data() + sizeof( detail::binary_patterns_header );
+
+  std::vector<kitty::partial_truth_table> result( header.num_pis, kitty::partial_truth_table( static_cast<uint32_t>( num_patterns ) ) );
+  for ( auto i = 0u; i < header.num_pis; ++i )
+  {
+    std::memcpy( result[i]._bits.data(), rows + i * header.row_words * 8u, num_words * 8u );
+    if ( num_patterns > header.num_patterns )
+    {
+      /* patterns beyond the file are 0 */
+      result[i].resize( static_cast<int>( header.num_patterns ) );
+      result[i].resize( static_cast<int>( num_patterns ) );
+    }
+    else
+    {
+      result[i].mask_bits();
+    }
+  }
+
+  patterns = std::move( result );
+  return true;
+}
+
+/*! \brief Writes simulation patterns into a binary file.
+ *
+ * The file starts with a header with the number of primary inputs and the
+ * number of patterns, which is followed by one row of 64-bit words per
+ * primary input.  The words are stored in the byte order of the host.
+ *
+ * \param patterns One partial truth table per primary input, all of the same length
+ * \param filename Filename
+ */
+inline bool write_binary_patterns( std::vector<kitty::partial_truth_table> const& patterns, std::string const& filename )
+{
+  detail::binary_patterns_header header;
+  header.num_pis = patterns.size();
+  header.num_patterns = patterns.empty() ? 0u : patterns[0].num_bits();
+  header.row_words = std::max<uint64_t>( ( header.num_patterns + 63u ) / 64u, 1u );
+
+  std::vector<uint64_t> rows( header.num_pis * header.row_words );
+  for ( auto i = 0u; i < patterns.size(); ++i )
+  {
+    std::copy_n( patterns[i]._bits.begin(), header.row_words, rows.begin() + i * header.row_words );
+  }
+  return detail::write_binary_patterns_file( filename, header, rows );
+}
+
+/*! \brief Appends simulation patterns to a binary file.
+ *
+ * Appends patterns `first_pattern` to `num_bits() - 1` of `patterns` to
+ * the patterns in the file.  If the rows in the file have enough spare
+ * words, only the new words and the header are written.  Otherwise, the
+ * file is rewritten with twice the capacity, such that appending blocks of
+ * patterns takes amortized time linear in their size.  If the file does not
+ * exist, it is created.
+ *
+ * Returns false, if the file exists but is not a binary pattern file with
+ * `patterns.size()` primary inputs; the file is then not modified.
+ *
+ * \param patterns One partial truth table per primary input, all of the same length
+ * \param filename Filename
+ * \param first_pattern First pattern to append
+ */
+inline bool append_binary_patterns( std::vector<kitty::partial_truth_table> const& patterns, std::string const& filename, uint32_t first_pattern = 0u )
+{
+  const uint64_t last_pattern = patterns.empty() ? 0u : patterns[0].num_bits();
+  const uint64_t count = last_pattern > first_pattern ? last_pattern - first_pattern : 0u;
+
+  detail::binary_patterns_header header;
+  header.num_pis = patterns.size();
+  std::vector<uint64_t> rows;
+  bool rewrite{true};
+  {
+    mapped_file file( filename );
+    if ( file.is_open() )
+    {
+      if ( !detail::read_binary_patterns_header( file.data(), file.size(), header ) || header.num_pis != patterns.size() )
+      {
+        return false;
+      }
+
+      const auto num_words = ( header.num_patterns + count + 63u ) / 64u;
+      if ( num_words > header.row_words )
+      {
+        /* grow the rows and rewrite the file */
+        const auto row_words = std::max<uint64_t>( num_words, 2u * header.row_words );
+        rows.resize( header.num_pis * row_words );
+        auto const* old_rows = file.data() + sizeof( detail::binary_patterns_header );
+        for ( auto i = 0u; i < header.num_pis; ++i )
+        {
+          std::memcpy( rows.data() + i * row_words, old_rows + i * header.row_words * 8u, header.row_words * 8u );
+        }
+        header.row_words = row_words;
+      }
+      else
+      {
+        rewrite = false;
+      }
+    }
+    else
+    {
+      header.row_words = std::max<uint64_t>( ( count + 63u ) / 64u, 1u );
+      rows.resize( header.num_pis * header.row_words );
+    }
+  }
+
+  if ( rewrite )
+  {
+    for ( auto i = 0u; i < patterns.size(); ++i )
+    {
+      detail::copy_bits( patterns[i]._bits, first_pattern, last_pattern, rows.data() + i * header.row_words, header.num_patterns );
+    }
+    header.num_patterns += count;
+    return detail::write_binary_patterns_file( filename, header, rows );
+  }
+
+  /* append in place: only the words from the last partially used word on change */
+  std::fstream fs( filename.c_str(), std::fstream::in | std::fstream::out | std::fstream::binary );
+  const auto first_word = header.num_patterns / 64u;
+  const auto num_words = ( header.num_patterns + count + 63u ) / 64u - first_word;
+  std::vector<uint64_t> words;
+  for ( auto i = 0u; i < patterns.size() && num_words > 0u; ++i )
+  {
+    /* the words after the first one only contain new patterns */
+    words.assign( num_words, 0u );
+    const auto offset = sizeof( detail::binary_patterns_header ) + ( i * header.row_words + first_word ) * 8u;
+    fs.seekg( offset );
+    fs.read( reinterpret_cast<char*>( words.data() ), 8u );
+    detail::copy_bits( patterns[i]._bits, first_pattern, last_pattern, words.data(), header.num_patterns % 64u );
+    fs.seekp( offset );
+    fs.write( reinterpret_cast<char const*>( words.data() ), num_words * 8u );
+  }
+
+  header.num_patterns += count;
+  fs.seekp( 0 );
+  fs.write( reinterpret_cast<char const*>( &header ), sizeof( detail::binary_patterns_header ) );
+  return static_cast<bool>( fs );
+}
+
+} /* namespace mockturtle */
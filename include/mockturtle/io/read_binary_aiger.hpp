@@ -0,0 +1,422 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2019  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file read_binary_aiger.hpp
+  \brief Fast reader for binary AIGER files into AIGs
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <lorina/common.hpp>
+
+#include "../networks/aig.hpp"
+#include "../utils/mapped_file.hpp"
+#include "aiger_reader.hpp"
+
+namespace mockturtle
+{
+
+/*! \brief Parameters for read_binary_aiger.
+ *
+ * The data structure `read_binary_aiger_params` holds configurable parameters
+ * with default arguments for `read_binary_aiger`.
+ */
+struct read_binary_aiger_params
+{
+  /*! \brief Assume that the file is structurally hashed.
+   *
+   * AND gates are then appended without looking up structurally equivalent
+   * gates.  Trivial AND gates are still simplified.
+   */
+  bool assume_strashed{false};
+
+  /*! \brief Build the structural hash table if `assume_strashed` is true.
+   *
+   * The table is then built in bulk after all gates have been read.  If
+   * false, the read gates are missing in the hash table, such that gates
+   * created later are not shared with them.
+   */
+  bool build_strash{true};
+};
+
+namespace detail
+{
+
+class binary_aiger_parser
+{
+public:
+  using signal = aig_network::signal;
+
+  binary_aiger_parser( aig_network& aig, read_binary_aiger_params const& ps, NameMap<aig_network>* names, char const* begin, char const* end )
+      : aig( aig ), ps( ps ), names( names ), pos( begin ), end( end )
+  {
+  }
+
+  lorina::return_code run()
+  {
+    uint64_t M, I, L, O, A;
+    if ( !parse_header( M, I, L, O, A ) )
+    {
+      return lorina::return_code::parse_error;
+    }
+
+    /* create_and grows the storage once 90% of its capacity are used */
+    auto& storage = *aig._storage;
+    const auto num_nodes = storage.nodes.size() + I + L + A;
+    storage.nodes.reserve( num_nodes + num_nodes / 9u + 1u );
+    if ( ps.build_strash || !ps.assume_strashed )
+    {
+      storage.hash.reserve( num_nodes + num_nodes / 9u + 1u );
+    }
+    storage.outputs.reserve( storage.outputs.size() + O + L );
+
+    /* AIGER variable to signal */
+    signals.reserve( M + 1 );
+    signals.push_back( aig.get_constant( false ) );
+    for ( auto i = 0u; i < I; ++i )
+    {
+      signals.push_back( aig.create_pi() );
+    }
+    for ( auto i = 0u; i < L; ++i )
+    {
+      signals.push_back( aig.create_ro() );
+    }
+
+    std::vector<std::tuple<uint64_t, int8_t>> latches( L );
+    for ( auto i = 0u; i < L; ++i )
+    {
+      auto& [next, reset] = latches[i];
+      uint64_t init{0u};
+      if ( !parse_unsigned( next ) || next > 2 * M + 1 )
+      {
+        return lorina::return_code::parse_error;
+      }
+      if ( pos != end && *pos == ' ' )
+      {
+        ++pos;
+        if ( !parse_unsigned( init ) )
+        {
+          return lorina::return_code::parse_error;
+        }
+      }
+      if ( !parse_newline() )
+      {
+        return lorina::return_code::parse_error;
+      }
+
+      /* the latch literal as initial value means nondeterministic */
+      if ( init > 1u && init != 2 * ( 1 + I + i ) )
+      {
+        return lorina::return_code::parse_error;
+      }
+      reset = init == 0u ? 0 : ( init == 1u ? 1 : -1 );
+    }
+
+    std::vector<uint64_t> outputs( O );
+    for ( auto& lit : outputs )
+    {
+      if ( !parse_unsigned( lit ) || lit > 2 * M + 1 || !parse_newline() )
+      {
+        return lorina::return_code::parse_error;
+      }
+    }
+
+    if ( !parse_ands( I + L, A ) )
+    {
+      return lorina::return_code::parse_error;
+    }
+
+    if ( ps.assume_strashed && ps.build_strash )
+    {
+      for ( auto i = storage.nodes.size() - num_appended; i < storage.nodes.size(); ++i )
+      {
+        storage.hash[storage.nodes[i]] = i;
+      }
+    }
+
+    for ( auto lit : outputs )
+    {
+      aig.create_po( to_signal( lit ) );
+    }
+    for ( auto const& [next, reset] : latches )
+    {
+      aig.create_ri( to_signal( next ), reset );
+    }
+
+    if ( names )
+    {
+      parse_symbols( I, L, O );
+    }
+
+    return lorina::return_code::success;
+  }
+
+private:
+  bool parse_header( uint64_t& M, uint64_t& I, uint64_t& L, uint64_t& O, uint64_t& A )
+  {
+    if ( end - pos < 4 || std::string( pos, 4 ) != "aig " )
+    {
+      return false;
+    }
+    pos += 4;
+
+    if ( !parse_unsigned( M ) || !parse_space() || !parse_unsigned( I ) || !parse_space() ||
+         !parse_unsigned( L ) || !parse_space() || !parse_unsigned( O ) || !parse_space() || !parse_unsigned( A ) )
+    {
+      return false;
+    }
+
+    /* extensions of AIGER 1.9 (bad states, constraints, ...) are not supported */
+    if ( !parse_newline() )
+    {
+      return false;
+    }
+
+    /* variables are numbered consecutively in binary AIGER */
+    if ( I > M || L > M || A > M || M != I + L + A || M >= ( uint64_t( 1 ) << 62 ) )
+    {
+      return false;
+    }
+
+    /* inputs and latches are indexed with 32 bits in the network */
+    if ( I + L > UINT32_MAX )
+    {
+      return false;
+    }
+
+    /* each latch and output line and each AND gate takes at least 2 bytes,
+     * such that the counts are bounded before anything is allocated */
+    const uint64_t remaining = static_cast<uint64_t>( end - pos ) / 2u;
+    return A <= remaining && O <= remaining - A && L <= remaining - A - O;
+  }
+
+  bool parse_ands( uint64_t first_and, uint64_t num_ands )
+  {
+    auto& storage = *aig._storage;
+
+    for ( auto i = 0u; i < num_ands; ++i )
+    {
+      const uint64_t lhs = 2 * ( first_and + i + 1 );
+
+      uint64_t delta0, delta1;
+      if ( !decode( delta0 ) || !decode( delta1 ) || delta0 == 0u || delta0 > lhs )
+      {
+        return false;
+      }
+
+      const auto rhs0 = lhs - delta0;
+      if ( delta1 > rhs0 )
+      {
+        return false;
+      }
+      const auto rhs1 = rhs0 - delta1;
+
+      auto a = to_signal( rhs1 );
+      auto b = to_signal( rhs0 );
+
+      if ( ps.assume_strashed )
+      {
+        if ( a.index > b.index )
+        {
+          std::swap( a, b );
+        }
+
+        /* trivial cases are handled by create_and */
+        if ( a.index != b.index && a.index != 0 )
+        {
+          const auto index = storage.nodes.size();
+          auto& node = storage.nodes.emplace_back();
+          node.children[0] = a;
+          node.children[1] = b;
+          storage.nodes[a.index].data[0].h1++;
+          storage.nodes[b.index].data[0].h1++;
+          ++num_appended;
+
+          for ( auto const& fn : aig._events->on_add )
+          {
+            fn( index );
+          }
+
+          signals.push_back( {index, 0} );
+          continue;
+        }
+      }
+
+      signals.push_back( aig.create_and( a, b ) );
+    }
+
+    return true;
+  }
+
+  void parse_symbols( uint64_t I, uint64_t L, uint64_t O )
+  {
+    while ( pos != end && *pos != 'c' )
+    {
+      const auto type = *pos++;
+      uint64_t index;
+      if ( !parse_unsigned( index ) || pos == end || *pos != ' ' )
+      {
+        return;
+      }
+      ++pos;
+
+      const auto name_begin = pos;
+      while ( pos != end && *pos != '\n' )
+      {
+        ++pos;
+      }
+      const std::string name( name_begin, pos );
+      if ( pos != end )
+      {
+        ++pos;
+      }
+
+      if ( type == 'i' && index < I )
+      {
+        names->insert( signals[1 + index], name );
+      }
+      else if ( type == 'l' && index < L )
+      {
+        names->insert( signals[1 + I + index], name );
+        names->insert( aig.ri_at( static_cast<uint32_t>( index ) ), name + "_next" );
+      }
+      else if ( type == 'o' && index < O )
+      {
+        names->insert( aig.po_at( static_cast<uint32_t>( index ) ), name );
+      }
+    }
+  }
+
+  signal to_signal( uint64_t lit ) const
+  {
+    return signals[lit >> 1] ^ ( ( lit & 1 ) != 0 );
+  }
+
+  bool decode( uint64_t& value )
+  {
+    value = 0u;
+    for ( auto shift = 0u; pos != end && shift < 64u; shift += 7u )
+    {
+      const auto ch = static_cast<unsigned char>( *pos++ );
+      value |= static_cast<uint64_t>( ch & 0x7f ) << shift;
+      if ( ( ch & 0x80 ) == 0 )
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool parse_unsigned( uint64_t& value )
+  {
+    if ( pos == end || *pos < '0' || *pos > '9' )
+    {
+      return false;
+    }
+
+    value = 0u;
+    while ( pos != end && *pos >= '0' && *pos <= '9' )
+    {
+      if ( value > ( UINT64_MAX - 9u ) / 10u )
+      {
+        return false;
+      }
+      value = 10u * value + static_cast<uint64_t>( *pos++ - '0' );
+    }
+    return true;
+  }
+
+  bool parse_space()
+  {
+    return pos != end && *pos++ == ' ';
+  }
+
+  bool parse_newline()
+  {
+    return pos != end && *pos++ == '\n';
+  }
+
+private:
+  aig_network& aig;
+  read_binary_aiger_params const& ps;
+  NameMap<aig_network>* names;
+  char const* pos;
+  char const* end;
+
+  std::vector<signal> signals;
+  std::size_t num_appended{0u};
+};
+
+} /* namespace detail */
+
+/*! \brief Reads a binary AIGER file into an AIG.
+ *
+ * This is a fast alternative to `lorina::read_aiger` with `aiger_reader` for
+ * large files.  The file is memory-mapped, the nodes and the structural hash
+ * table are allocated from the counts in the header, and the delta-encoded
+ * AND gates are decoded in a single loop that creates the nodes in the AIG
+ * directly.  If the file is known to be structurally hashed, the lookup of
+ * each gate can be skipped with `ps.assume_strashed`, and the hash table is
+ * then built in bulk, or not at all if `ps.build_strash` is false.
+ *
+ * Only the binary format (header `aig`) without the extensions of AIGER 1.9
+ * is supported.  Returns `lorina::return_code::parse_error` if the file
+ * cannot be read or is malformed; the AIG may then contain parts of the
+ * file.
+ *
+   \verbatim embed:rst
+
+   Example
+
+   .. code-block:: c++
+
+      aig_network aig;
+      read_binary_aiger( "file.aig", aig );
+   \endverbatim
+ *
+ * \param filename Filename
+ * \param aig AIG network
+ * \param ps Parameters
+ * \param names Optional map to store the names in the symbol table
+ */
+inline lorina::return_code read_binary_aiger( std::string const& filename, aig_network& aig, read_binary_aiger_params const& ps = {}, NameMap<aig_network>* names = nullptr )
+{
+  mapped_file file( filename );
+  if ( !file.is_open() )
+  {
+    return lorina::return_code::parse_error;
+  }
+
+  detail::binary_aiger_parser parser( aig, ps, names, file.data(), file.data() + file.size() );
+  return parser.run();
+}
+
+} /* namespace mockturtle */
@@ -0,0 +1,747 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2019  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file read_blif.hpp
+  \brief Fast reader for BLIF files into k-LUT networks
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include <fmt/format.h>
+#include <kitty/dynamic_truth_table.hpp>
+#include <kitty/operators.hpp>
+#include <lorina/common.hpp>
+#include <lorina/diagnostics.hpp>
+
+#include "../networks/klut.hpp"
+#include "../traits.hpp"
+#include "../utils/mapped_file.hpp"
+
+namespace mockturtle
+{
+
+/*! \brief Statistics for read_blif.
+ *
+ * The data structure `read_blif_stats` provides data collected by running
+ * `read_blif`.
+ */
+struct read_blif_stats
+{
+  /*! \brief Number of `.names` blocks. */
+  uint64_t num_covers{0u};
+
+  /*! \brief Number of covers that were converted into truth tables. */
+  uint64_t num_unique_covers{0u};
+};
+
+namespace detail
+{
+
+struct blif_cube
+{
+  std::string_view inputs;
+  char output;
+};
+
+/* truth table of an SOP cover, each cube is expanded word-parallel: the
+ * literals of the first 6 variables form a word pattern, and the literals of
+ * the other variables select the words to which it is written */
+class blif_cover_converter
+{
+public:
+  bool run( std::vector<blif_cube> const& cubes, uint32_t num_vars, kitty::dynamic_truth_table& tt )
+  {
+    tt = kitty::dynamic_truth_table( num_vars );
+    auto* words = &*tt.begin();
+    const uint64_t num_words = tt.num_blocks();
+
+    bool is_offset{false};
+    for ( auto i = 0u; i < cubes.size(); ++i )
+    {
+      const auto cube = cubes[i].inputs;
+      const auto output = cubes[i].output;
+      if ( output != '0' && output != '1' )
+      {
+        return false;
+      }
+      if ( i == 0u )
+      {
+        is_offset = output == '0';
+      }
+      else if ( is_offset != ( output == '0' ) )
+      {
+        return false;
+      }
+
+      uint64_t pattern{~uint64_t( 0 )}, care{0u}, value{0u};
+      for ( auto j = 0u; j < num_vars; ++j )
+      {
+        const auto c = cube[j];
+        if ( c == '-' )
+        {
+          continue;
+        }
+        if ( c != '0' && c != '1' )
+        {
+          return false;
+        }
+        if ( j < 6u )
+        {
+          pattern &= c == '1' ? projections[j] : ~projections[j];
+        }
+        else
+        {
+          care |= uint64_t( 1 ) << ( j - 6u );
+          value |= c == '1' ? ( uint64_t( 1 ) << ( j - 6u ) ) : 0u;
+        }
+      }
+
+      /* enumerate the subsets of the don't care variables above 6 */
+      const auto free = ( num_words - 1u ) & ~care;
+      uint64_t sub{0u};
+      do
+      {
+        words[value | sub] |= pattern;
+        sub = ( sub - free ) & free;
+      } while ( sub != 0u );
+    }
+
+    if ( is_offset )
+    {
+      tt = ~tt;
+    }
+    else
+    {
+      tt.mask_bits();
+    }
+    return true;
+  }
+
+private:
+  static constexpr uint64_t projections[] = {0xaaaaaaaaaaaaaaaa, 0xcccccccccccccccc, 0xf0f0f0f0f0f0f0f0,
+                                             0xff00ff00ff00ff00, 0xffff0000ffff0000, 0xffffffff00000000};
+};
+
+template<class Ntk>
+class blif_klut_parser
+{
+public:
+  using signal = typename Ntk::signal;
+
+  blif_klut_parser( Ntk& ntk, read_blif_stats& st, lorina::diagnostic_engine* diag, char const* begin, char const* end )
+      : ntk( ntk ), st( st ), diag( diag ), pos( begin ), end( end )
+  {
+  }
+
+  lorina::return_code run()
+  {
+    if ( !parse() || !create_network() )
+    {
+      return lorina::return_code::parse_error;
+    }
+    return lorina::return_code::success;
+  }
+
+private:
+  enum class source : uint8_t
+  {
+    none,
+    input,
+    latch,
+    gate
+  };
+
+  struct gate
+  {
+    uint32_t output;
+    uint32_t first_fanin;
+    uint32_t num_fanins;
+    uint32_t function; /* index in `unique_functions`, or the constant for gates without fanins */
+  };
+
+  struct latch
+  {
+    uint32_t input;
+    uint32_t output;
+    uint32_t init;
+    std::string_view type;
+    std::string_view control;
+  };
+
+  bool parse()
+  {
+    std::string_view line;
+    std::vector<std::string_view> tokens;
+    while ( next_line( line ) )
+    {
+      tokenize( line, tokens );
+      if ( tokens.empty() )
+      {
+        continue;
+      }
+
+      const auto keyword = tokens[0];
+      if ( keyword == ".names" )
+      {
+        if ( tokens.size() < 2u || !parse_names( tokens ) )
+        {
+          return error( "invalid .names block", line );
+        }
+      }
+      else if ( keyword == ".inputs" )
+      {
+        for ( auto i = 1u; i < tokens.size(); ++i )
+        {
+          const auto id = get_id( tokens[i] );
+          if ( !define( id, source::input, static_cast<uint32_t>( inputs.size() ) ) )
+          {
+            return error( "signal defined twice", tokens[i] );
+          }
+          inputs.push_back( id );
+        }
+      }
+      else if ( keyword == ".outputs" )
+      {
+        for ( auto i = 1u; i < tokens.size(); ++i )
+        {
+          outputs.push_back( get_id( tokens[i] ) );
+        }
+      }
+      else if ( keyword == ".latch" )
+      {
+        if ( tokens.size() < 3u || tokens.size() > 6u || !parse_latch( tokens ) )
+        {
+          return error( "latch format not supported", line );
+        }
+      }
+      else if ( keyword == ".end" || keyword == ".exdc" )
+      {
+        break;
+      }
+      else if ( keyword == ".subckt" || keyword == ".gate" || keyword == ".mlatch" )
+      {
+        return error( "unsupported keyword", keyword );
+      }
+      else if ( keyword[0] != '.' )
+      {
+        return error( "unexpected line", line );
+      }
+    }
+    return true;
+  }
+
+  bool parse_names( std::vector<std::string_view> const& tokens )
+  {
+    ++st.num_covers;
+
+    gate g;
+    g.output = get_id( tokens.back() );
+    g.first_fanin = static_cast<uint32_t>( fanins.size() );
+    g.num_fanins = static_cast<uint32_t>( tokens.size() - 2u );
+    for ( auto i = 1u; i + 1u < tokens.size(); ++i )
+    {
+      fanins.push_back( get_id( tokens[i] ) );
+    }
+    if ( !define( g.output, source::gate, static_cast<uint32_t>( gates.size() ) ) )
+    {
+      return false;
+    }
+
+    /* the cover extends up to the next line that starts with a keyword */
+    cubes.clear();
+    auto const* cover_begin = pos;
+    auto const* cover_end = pos;
+    while ( pos != end )
+    {
+      auto const* p = pos;
+      while ( p != end && ( *p == ' ' || *p == '\t' ) )
+      {
+        ++p;
+      }
+      if ( p != end && *p == '.' )
+      {
+        break;
+      }
+
+      std::string_view line;
+      next_physical_line( line );
+      tokenize( line, cube_parts );
+      if ( cube_parts.empty() )
+      {
+        continue;
+      }
+      if ( g.num_fanins == 0u && cube_parts.size() == 1u && cube_parts[0].size() == 1u )
+      {
+        cubes.push_back( {std::string_view(), cube_parts[0][0]} );
+      }
+      else if ( g.num_fanins != 0u && cube_parts.size() == 2u && cube_parts[0].size() == g.num_fanins && cube_parts[1].size() == 1u )
+      {
+        cubes.push_back( {cube_parts[0], cube_parts[1][0]} );
+      }
+      else
+      {
+        return false;
+      }
+      cover_end = line.data() + line.size();
+    }
+
+    if ( g.num_fanins == 0u )
+    {
+      g.function = !cubes.empty() && cubes[0].output == '1' ? 1u : 0u;
+    }
+    else
+    {
+      /* identical cover text gives identical functions */
+      const std::string_view text( cover_begin, cover_end - cover_begin );
+      if ( const auto it = functions.find( text ); it != functions.end() && it->second.first == g.num_fanins )
+      {
+        g.function = it->second.second;
+      }
+      else
+      {
+        if ( !converter.run( cubes, g.num_fanins, tt ) )
+        {
+          return false;
+        }
+        ++st.num_unique_covers;
+        g.function = static_cast<uint32_t>( unique_functions.size() );
+        unique_functions.push_back( tt );
+        functions[text] = {g.num_fanins, g.function};
+      }
+    }
+
+    gates.push_back( g );
+    return true;
+  }
+
+  bool parse_latch( std::vector<std::string_view> const& tokens )
+  {
+    latch l;
+    l.input = get_id( tokens[1] );
+    l.output = get_id( tokens[2] );
+    l.init = 3u;
+    l.type = "re";
+    l.control = "clock";
+
+    std::string_view init;
+    if ( tokens.size() == 4u )
+    {
+      init = tokens[3];
+    }
+    else if ( tokens.size() >= 5u )
+    {
+      l.type = tokens[3];
+      l.control = tokens[4];
+      if ( tokens.size() == 6u )
+      {
+        init = tokens[5];
+      }
+    }
+    if ( l.type != "fe" && l.type != "re" && l.type != "ah" && l.type != "al" && l.type != "as" )
+    {
+      l.type = "";
+    }
+    if ( init.size() == 1u && init[0] >= '0' && init[0] <= '3' )
+    {
+      l.init = init[0] - '0';
+    }
+
+    if ( !define( l.output, source::latch, static_cast<uint32_t>( latches.size() ) ) )
+    {
+      return false;
+    }
+    latches.push_back( l );
+    return true;
+  }
+
+  bool create_network()
+  {
+    auto& storage = *ntk._storage;
+    storage.nodes.reserve( storage.nodes.size() + inputs.size() + latches.size() + gates.size() );
+    storage.hash.reserve( storage.hash.size() + gates.size() );
+    storage.outputs.reserve( storage.outputs.size() + outputs.size() + latches.size() );
+
+    /* the functions are added to the truth table cache of the network only after the file is parsed */
+    literals.clear();
+    literals.reserve( unique_functions.size() );
+    for ( auto const& function : unique_functions )
+    {
+      literals.push_back( storage.data.cache.insert( function ) );
+    }
+    unique_functions = {};
+
+    signals.resize( ids.size() );
+    state.resize( ids.size() );
+    for ( auto id : inputs )
+    {
+      signals[id] = ntk.create_pi( std::string( names[id] ) );
+      if constexpr ( has_set_name_v<Ntk> )
+      {
+        ntk.set_name( signals[id], std::string( names[id] ) );
+      }
+      state[id] = 2u;
+    }
+    for ( auto const& l : latches )
+    {
+      signals[l.output] = ntk.create_ro( std::string( names[l.output] ) );
+      if constexpr ( has_set_name_v<Ntk> )
+      {
+        ntk.set_name( signals[l.output], std::string( names[l.output] ) );
+      }
+      state[l.output] = 2u;
+
+      latch_info info;
+      info.init = l.init;
+      info.type = std::string( l.type );
+      info.control = std::string( l.control );
+      storage.latch_information[ntk.get_node( signals[l.output] )] = info;
+    }
+
+    for ( auto const& g : gates )
+    {
+      if ( !create_gate( g.output ) )
+      {
+        return false;
+      }
+    }
+
+    for ( auto i = 0u; i < outputs.size(); ++i )
+    {
+      const auto id = outputs[i];
+      if ( !create_gate( id ) )
+      {
+        return false;
+      }
+      ntk.create_po( signals[id], std::string( names[id] ) );
+      if constexpr ( has_set_output_name_v<Ntk> )
+      {
+        ntk.set_output_name( i, std::string( names[id] ) );
+      }
+    }
+    for ( auto i = 0u; i < latches.size(); ++i )
+    {
+      const auto id = latches[i].input;
+      if ( !create_gate( id ) )
+      {
+        return false;
+      }
+      ntk.create_ri( signals[id], static_cast<int8_t>( latches[i].init ) );
+      if constexpr ( has_set_output_name_v<Ntk> )
+      {
+        ntk.set_output_name( static_cast<uint32_t>( outputs.size() + i ), std::string( names[id] ) );
+      }
+    }
+
+    return true;
+  }
+
+  /* creates the gate that drives `root` after its transitive fanin, without recursion */
+  bool create_gate( uint32_t root )
+  {
+    if ( state[root] == 2u )
+    {
+      return true;
+    }
+
+    std::vector<uint32_t>& stack = create_stack;
+    stack.assign( 1u, root );
+    while ( !stack.empty() )
+    {
+      const auto id = stack.back();
+      if ( state[id] == 2u )
+      {
+        stack.pop_back();
+        continue;
+      }
+      if ( sources[id] != source::gate )
+      {
+        return error( "undefined signal", names[id] );
+      }
+
+      auto const& g = gates[drivers[id]];
+      if ( state[id] == 0u )
+      {
+        state[id] = 1u;
+        for ( auto i = 0u; i < g.num_fanins; ++i )
+        {
+          const auto fanin = fanins[g.first_fanin + i];
+          if ( state[fanin] == 1u )
+          {
+            return error( "combinational cycle at signal", names[fanin] );
+          }
+          if ( state[fanin] == 0u )
+          {
+            stack.push_back( fanin );
+          }
+        }
+        continue;
+      }
+
+      /* all fanins are created */
+      if ( g.num_fanins == 0u )
+      {
+        signals[id] = ntk.get_constant( g.function != 0u );
+      }
+      else
+      {
+        children.clear();
+        for ( auto i = 0u; i < g.num_fanins; ++i )
+        {
+          children.push_back( signals[fanins[g.first_fanin + i]] );
+        }
+        signals[id] = ntk._create_node( children, literals[g.function] );
+      }
+      state[id] = 2u;
+      stack.pop_back();
+    }
+    return true;
+  }
+
+  uint32_t get_id( std::string_view name )
+  {
+    const auto [it, inserted] = ids.try_emplace( name, static_cast<uint32_t>( names.size() ) );
+    if ( inserted )
+    {
+      names.push_back( name );
+      sources.push_back( source::none );
+      drivers.push_back( 0u );
+    }
+    return it->second;
+  }
+
+  bool define( uint32_t id, source s, uint32_t driver )
+  {
+    if ( sources[id] != source::none )
+    {
+      return false;
+    }
+    sources[id] = s;
+    drivers[id] = driver;
+    return true;
+  }
+
+  /* reads a line without comment */
+  void next_physical_line( std::string_view& line )
+  {
+    auto const* line_end = static_cast<char const*>( std::memchr( pos, '\n', end - pos ) );
+    if ( !line_end )
+    {
+      line_end = end;
+    }
+    line = std::string_view( pos, line_end - pos );
+    pos = line_end == end ? end : line_end + 1;
+
+    if ( const auto comment = line.find( '#' ); comment != std::string_view::npos )
+    {
+      line = line.substr( 0, comment );
+    }
+    while ( !line.empty() && ( line.back() == '\r' || line.back() == ' ' || line.back() == '\t' ) )
+    {
+      line.remove_suffix( 1u );
+    }
+  }
+
+  /* reads a line and joins continued lines */
+  bool next_line( std::string_view& line )
+  {
+    if ( pos == end )
+    {
+      return false;
+    }
+
+    next_physical_line( line );
+    if ( line.empty() || line.back() != '\\' )
+    {
+      return true;
+    }
+
+    auto& joined = line_storage.emplace_back();
+    while ( !line.empty() && line.back() == '\\' )
+    {
+      joined.append( line.data(), line.size() - 1u );
+      joined += ' ';
+      if ( pos == end )
+      {
+        break;
+      }
+      next_physical_line( line );
+      if ( line.empty() || line.back() != '\\' )
+      {
+        joined.append( line.data(), line.size() );
+      }
+    }
+    line = joined;
+    return true;
+  }
+
+  static void tokenize( std::string_view line, std::vector<std::string_view>& tokens )
+  {
+    tokens.clear();
+    std::size_t i{0u};
+    while ( true )
+    {
+      while ( i < line.size() && ( line[i] == ' ' || line[i] == '\t' ) )
+      {
+        ++i;
+      }
+      if ( i == line.size() )
+      {
+        return;
+      }
+      const auto first = i;
+      while ( i < line.size() && line[i] != ' ' && line[i] != '\t' )
+      {
+        ++i;
+      }
+      tokens.push_back( line.substr( first, i - first ) );
+    }
+  }
+
+  bool error( char const* message, std::string_view context )
+  {
+    if ( diag )
+    {
+      diag->report( lorina::diagnostic_level::error, fmt::format( "{}: {}", message, context ) );
+    }
+    return false;
+  }
+
+private:
+  Ntk& ntk;
+  read_blif_stats& st;
+  lorina::diagnostic_engine* diag;
+  char const* pos;
+  char const* end;
+
+  /* signal names, which point into the file or into `line_storage` */
+  std::unordered_map<std::string_view, uint32_t> ids;
+  std::vector<std::string_view> names;
+  std::vector<source> sources;
+  std::vector<uint32_t> drivers;
+  std::deque<std::string> line_storage;
+
+  std::vector<uint32_t> inputs;
+  std::vector<uint32_t> outputs;
+  std::vector<latch> latches;
+  std::vector<gate> gates;
+  std::vector<uint32_t> fanins;
+
+  /* cover text to number of inputs and index in `unique_functions` */
+  std::unordered_map<std::string_view, std::pair<uint32_t, uint32_t>> functions;
+  std::vector<kitty::dynamic_truth_table> unique_functions;
+  std::vector<uint32_t> literals;
+  blif_cover_converter converter;
+  kitty::dynamic_truth_table tt;
+  std::vector<blif_cube> cubes;
+  std::vector<std::string_view> cube_parts;
+
+  std::vector<signal> signals;
+  std::vector<uint8_t> state;
+  std::vector<uint32_t> create_stack;
+  std::vector<signal> children;
+};
+
+} /* namespace detail */
+
+/*! \brief Reads a BLIF file into a k-LUT network.
+ *
+ * This is a fast alternative to `lorina::read_blif` with `blif_reader` for
+ * large mapped netlists.  The file is memory-mapped and scanned once, and
+ * the nodes are created afterwards in topological order into storage that is
+ * allocated for the number of gates.  Covers with identical text are
+ * converted into a truth table only once, and their truth table cache entry
+ * is reused for all nodes.  Cubes are expanded into the truth table
+ * word-parallel.
+ *
+ * Supported are `.model`, `.inputs`, `.outputs`, `.names`, `.latch`, and
+ * `.end`.  Returns `lorina::return_code::parse_error` if the file cannot be
+ * read, contains hierarchy (`.subckt`), malformed covers, undefined signals,
+ * or combinational cycles; the network may then contain parts of the file.
+ * Errors are reported to `diag`, if given.
+ *
+ * **Required network functions:**
+ * - `create_pi`
+ * - `create_po`
+ * - `create_ro`
+ * - `create_ri`
+ * - `get_constant`
+ *
+   \verbatim embed:rst
+
+   Example
+
+   .. code-block:: c++
+
+      klut_network klut;
+      read_blif( "file.blif", klut );
+   \endverbatim
+ *
+ * \param filename Filename
+ * \param ntk k-LUT network
+ * \param pst Statistics
+ * \param diag Optional diagnostic engine
+ */
+template<class Ntk>
+lorina::return_code read_blif( std::string const& filename, Ntk& ntk, read_blif_stats* pst = nullptr, lorina::diagnostic_engine* diag = nullptr )
+{
+  static_assert( std::is_same_v<typename Ntk::base_type, klut_network>, "Ntk is not a k-LUT network" );
+  static_assert( has_create_pi_v<Ntk>, "Ntk does not implement the create_pi function" );
+  static_assert( has_create_po_v<Ntk>, "Ntk does not implement the create_po function" );
+  static_assert( has_create_ro_v<Ntk>, "Ntk does not implement the create_ro function" );
+  static_assert( has_create_ri_v<Ntk>, "Ntk does not implement the create_ri function" );
+  static_assert( has_get_constant_v<Ntk>, "Ntk does not implement the get_constant function" );
+
+  mapped_file file( filename );
+  if ( !file.is_open() )
+  {
+    if ( diag )
+    {
+      diag->report( lorina::diagnostic_level::fatal, fmt::format( "could not open file `{}`", filename ) );
+    }
+    return lorina::return_code::parse_error;
+  }
+
+  read_blif_stats st;
+  detail::blif_klut_parser<Ntk> parser( ntk, st, diag, file.data(), file.data() + file.size() );
+  const auto result = parser.run();
+
+  if ( pst )
+  {
+    *pst = st;
+  }
+  return result;
+}
+
+} /* namespace mockturtle */
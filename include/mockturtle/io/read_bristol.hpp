@@ -0,0 +1,418 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2019  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file read_bristol.hpp
+  \brief Fast reader for Bristol circuits
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <fmt/format.h>
+#include <lorina/common.hpp>
+#include <lorina/diagnostics.hpp>
+
+#include "../networks/xag.hpp"
+#include "../traits.hpp"
+#include "../utils/mapped_file.hpp"
+
+namespace mockturtle
+{
+
+namespace detail
+{
+
+template<class Ntk>
+class bristol_parser
+{
+public:
+  bristol_parser( Ntk& ntk, lorina::diagnostic_engine* diag, char const* begin, char const* end )
+      : ntk( ntk ), diag( diag ), pos( begin ), end( end )
+  {
+  }
+
+  lorina::return_code run()
+  {
+    uint64_t num_gates, num_wires, num_pis{0u}, num_pos{0u};
+    if ( !parse_header( num_gates, num_wires, num_pis, num_pos ) )
+    {
+      return lorina::return_code::parse_error;
+    }
+
+    if constexpr ( std::is_same_v<typename Ntk::base_type, xag_network> )
+    {
+      /* each wire is at most one node; create_and grows the storage once 90% of its capacity are used */
+      auto& storage = *ntk._storage;
+      const auto num_nodes = storage.nodes.size() + num_wires;
+      storage.nodes.reserve( num_nodes + num_nodes / 9u + 1u );
+      storage.hash.reserve( num_nodes + num_nodes / 9u + 1u );
+      storage.outputs.reserve( storage.outputs.size() + num_pos );
+    }
+
+    signals.resize( num_wires );
+    defined.resize( num_wires, false );
+    for ( auto i = 0u; i < num_pis; ++i )
+    {
+      signals[i] = ntk.create_pi();
+      defined[i] = true;
+    }
+
+    while ( skip_whitespace() )
+    {
+      if ( !parse_gate() )
+      {
+        return lorina::return_code::parse_error;
+      }
+    }
+
+    for ( auto i = num_wires - num_pos; i < num_wires; ++i )
+    {
+      if ( !defined[i] )
+      {
+        error( "undefined output wire" );
+        return lorina::return_code::parse_error;
+      }
+      ntk.create_po( signals[i] );
+    }
+    return lorina::return_code::success;
+  }
+
+private:
+  /* The original format has a line with the numbers of input wires of both
+   * parties and of output wires; Bristol Fashion has a line with the number
+   * of inputs and their wires, and a line with the number of outputs and
+   * their wires.  The formats are distinguished by the third line, which is
+   * a gate in the original format. */
+  bool parse_header( uint64_t& num_gates, uint64_t& num_wires, uint64_t& num_pis, uint64_t& num_pos )
+  {
+    std::vector<uint64_t> line1, line2, line3;
+    if ( !parse_numbers_line( line1 ) || line1.size() != 2u )
+    {
+      return error( "invalid header" );
+    }
+    num_gates = line1[0];
+    num_wires = line1[1];
+
+    if ( !parse_numbers_line( line2 ) || line2.empty() )
+    {
+      return error( "invalid header" );
+    }
+
+    auto const* gates_begin = pos;
+    if ( !parse_numbers_line( line3 ) )
+    {
+      /* a gate line */
+      pos = gates_begin;
+      if ( line2.size() != 3u )
+      {
+        return error( "invalid header" );
+      }
+      if ( line2[0] > UINT64_MAX - line2[1] )
+      {
+        return error( "invalid header" );
+      }
+      num_pis = line2[0] + line2[1];
+      num_pos = line2[2];
+    }
+    else
+    {
+      if ( line2.size() != line2[0] + 1u || line3.empty() || line3.size() != line3[0] + 1u )
+      {
+        return error( "invalid header" );
+      }
+      for ( auto i = 1u; i < line2.size(); ++i )
+      {
+        if ( line2[i] > UINT64_MAX - num_pis )
+        {
+          return error( "invalid header" );
+        }
+        num_pis += line2[i];
+      }
+      for ( auto i = 1u; i < line3.size(); ++i )
+      {
+        if ( line3[i] > UINT64_MAX - num_pos )
+        {
+          return error( "invalid header" );
+        }
+        num_pos += line3[i];
+      }
+    }
+
+    if ( num_pis > num_wires || num_pos > num_wires || num_pis > UINT32_MAX )
+    {
+      return error( "invalid header" );
+    }
+
+    /* a gate line takes at least 10 bytes, and each wire that is not an
+     * input is written by a gate with at least 2 bytes, such that the
+     * counts are bounded before anything is allocated */
+    const auto remaining = static_cast<uint64_t>( end - pos );
+    if ( num_gates > remaining / 10u || num_wires - num_pis > remaining / 2u )
+    {
+      return error( "header does not match the file size" );
+    }
+    return true;
+  }
+
+  bool parse_gate()
+  {
+    uint64_t num_inputs, num_outputs;
+    if ( !parse_unsigned( num_inputs ) || !parse_unsigned( num_outputs ) || num_inputs > signals.size() || num_outputs > signals.size() )
+    {
+      return error( "invalid gate" );
+    }
+
+    wires.resize( num_inputs + num_outputs );
+    for ( auto& w : wires )
+    {
+      if ( !parse_unsigned( w ) )
+      {
+        return error( "invalid gate" );
+      }
+    }
+    const auto type = parse_name();
+
+    /* constants are given instead of an input wire */
+    if ( type == "EQ" )
+    {
+      if ( num_inputs != 1u || num_outputs != 1u || wires[0] > 1u )
+      {
+        return error( "invalid EQ gate" );
+      }
+      return define( wires[1], ntk.get_constant( wires[0] == 1u ) );
+    }
+
+    for ( auto i = 0u; i < num_inputs; ++i )
+    {
+      if ( wires[i] >= signals.size() || !defined[wires[i]] )
+      {
+        return error( "undefined input wire" );
+      }
+    }
+
+    auto const* in = wires.data();
+    auto const* out = wires.data() + num_inputs;
+    if ( ( type == "XOR" || type == "AND" ) && num_inputs == 2u && num_outputs == 1u )
+    {
+      return define( out[0], type == "XOR" ? ntk.create_xor( signals[in[0]], signals[in[1]] ) : ntk.create_and( signals[in[0]], signals[in[1]] ) );
+    }
+    else if ( ( type == "INV" || type == "NOT" ) && num_inputs == 1u && num_outputs == 1u )
+    {
+      return define( out[0], ntk.create_not( signals[in[0]] ) );
+    }
+    else if ( type == "EQW" && num_inputs == 1u && num_outputs == 1u )
+    {
+      return define( out[0], signals[in[0]] );
+    }
+    else if ( type == "MAND" && num_inputs == 2u * num_outputs )
+    {
+      /* the first inputs of all AND gates precede their second inputs */
+      for ( auto i = 0u; i < num_outputs; ++i )
+      {
+        if ( !define( out[i], ntk.create_and( signals[in[i]], signals[in[num_outputs + i]] ) ) )
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    return error( fmt::format( "unsupported gate {} with {} inputs and {} outputs", type, num_inputs, num_outputs ) );
+  }
+
+  bool define( uint64_t wire, signal<Ntk> const& f )
+  {
+    if ( wire >= signals.size() )
+    {
+      return error( "invalid output wire" );
+    }
+    signals[wire] = f;
+    defined[wire] = true;
+    return true;
+  }
+
+  /* numbers up to the end of the next non-empty line, fails if the line contains other tokens */
+  bool parse_numbers_line( std::vector<uint64_t>& numbers )
+  {
+    numbers.clear();
+    if ( !skip_whitespace() )
+    {
+      return false;
+    }
+    while ( pos != end && *pos != '\n' )
+    {
+      if ( *pos == ' ' || *pos == '\t' || *pos == '\r' )
+      {
+        ++pos;
+        continue;
+      }
+      if ( !parse_unsigned( numbers.emplace_back() ) )
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool parse_unsigned( uint64_t& value )
+  {
+    while ( pos != end && ( *pos == ' ' || *pos == '\t' || *pos == '\r' || *pos == '\n' ) )
+    {
+      ++pos;
+    }
+    if ( pos == end || *pos < '0' || *pos > '9' )
+    {
+      return false;
+    }
+
+    value = 0u;
+    while ( pos != end && *pos >= '0' && *pos <= '9' )
+    {
+      if ( value > ( UINT64_MAX - 9u ) / 10u )
+      {
+        return false;
+      }
+      value = 10u * value + static_cast<uint64_t>( *pos++ - '0' );
+    }
+    return true;
+  }
+
+  std::string_view parse_name()
+  {
+    while ( pos != end && ( *pos == ' ' || *pos == '\t' ) )
+    {
+      ++pos;
+    }
+    auto const* begin = pos;
+    while ( pos != end && *pos != ' ' && *pos != '\t' && *pos != '\r' && *pos != '\n' )
+    {
+      ++pos;
+    }
+    return std::string_view( begin, pos - begin );
+  }
+
+  /* returns false at the end of the file */
+  bool skip_whitespace()
+  {
+    while ( pos != end && ( *pos == ' ' || *pos == '\t' || *pos == '\r' || *pos == '\n' ) )
+    {
+      ++pos;
+    }
+    return pos != end;
+  }
+
+  bool error( std::string const& message )
+  {
+    if ( diag )
+    {
+      diag->report( lorina::diagnostic_level::error, message + " in Bristol file" );
+    }
+    return false;
+  }
+
+private:
+  Ntk& ntk;
+  lorina::diagnostic_engine* diag;
+  char const* pos;
+  char const* end;
+
+  /* signals of the wires, indexed by wire id */
+  std::vector<signal<Ntk>> signals;
+  std::vector<bool> defined;
+  std::vector<uint64_t> wires;
+};
+
+} /* namespace detail */
+
+/*! \brief Reads a Bristol circuit into a network.
+ *
+ * This is a fast alternative to `lorina::read_bristol` with
+ * `bristol_reader` for large circuits.  The file is memory-mapped, the gate
+ * lines are parsed by a scanner without intermediate strings, and wires are
+ * mapped to signals through a vector indexed by the wire id.
+ *
+ * Both the original Bristol format and Bristol Fashion, with any number of
+ * input and output values, are supported.  The gates `XOR`, `AND`, `INV`,
+ * `NOT`, `EQW`, `EQ` (constant), and `MAND` (several AND gates) are
+ * supported.  The primary inputs are the first wires and the primary
+ * outputs are the last wires.  Returns `lorina::return_code::parse_error`
+ * if the file cannot be read, is malformed, uses a wire before it is
+ * assigned, or contains other gates; the network may then contain parts of
+ * the file.  Errors are reported to `diag`, if given.
+ *
+ * **Required network functions:**
+ * - `create_pi`
+ * - `create_po`
+ * - `create_and`
+ * - `create_xor`
+ * - `create_not`
+ * - `get_constant`
+ *
+   \verbatim embed:rst
+
+   Example
+
+   .. code-block:: c++
+
+      xag_network xag;
+      read_bristol( "aes_128.txt", xag );
+   \endverbatim
+ *
+ * \param filename Filename
+ * \param ntk Network
+ * \param diag Optional diagnostic engine
+ */
+template<class Ntk>
+lorina::return_code read_bristol( std::string const& filename, Ntk& ntk, lorina::diagnostic_engine* diag = nullptr )
+{
+  static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
+  static_assert( has_create_pi_v<Ntk>, "Ntk does not implement the create_pi function" );
+  static_assert( has_create_po_v<Ntk>, "Ntk does not implement the create_po function" );
+  static_assert( has_create_and_v<Ntk>, "Ntk does not implement the create_and function" );
+  static_assert( has_create_xor_v<Ntk>, "Ntk does not implement the create_xor function" );
+  static_assert( has_create_not_v<Ntk>, "Ntk does not implement the create_not function" );
+  static_assert( has_get_constant_v<Ntk>, "Ntk does not implement the get_constant function" );
+
+  mapped_file file( filename );
+  if ( !file.is_open() )
+  {
+    if ( diag )
+    {
+      diag->report( lorina::diagnostic_level::fatal, fmt::format( "could not open file `{}`", filename ) );
+    }
+    return lorina::return_code::parse_error;
+  }
+
+  detail::bristol_parser<Ntk> parser( ntk, diag, file.data(), file.data() + file.size() );
+  return parser.run();
+}
+
+} /* namespace mockturtle */
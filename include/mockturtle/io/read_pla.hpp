@@ -0,0 +1,797 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2019  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file read_pla.hpp
+  \brief Parallel reader for PLA files
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <kitty/constructors.hpp>
+#include <kitty/cube.hpp>
+#include <kitty/dynamic_truth_table.hpp>
+#include <fmt/format.h>
+#include <kitty/operations.hpp>
+#include <lorina/common.hpp>
+#include <lorina/diagnostics.hpp>
+
+#include "../algorithms/exorcism.hpp"
+#include "../networks/klut.hpp"
+#include "../traits.hpp"
+#include "../utils/mapped_file.hpp"
+
+namespace mockturtle
+{
+
+/*! \brief Parameters for read_pla.
+ *
+ * The data structure `read_pla_params` holds configurable parameters with
+ * default arguments for `read_pla_cover`, `create_from_pla_cover`, and
+ * `read_pla`.
+ */
+struct read_pla_params
+{
+  /*! \brief Number of threads to parse the cubes (0: number of cores). */
+  uint32_t num_threads{0u};
+
+  /*! \brief Minimum number of bytes per thread. */
+  uint64_t min_chunk_size{1u << 20u};
+
+  /*! \brief Maximum fanin size of nodes created in k-LUT networks (at most 16).
+   *
+   * The function of each node is built as a truth table, such that larger
+   * nodes cannot be created in reasonable time and memory.
+   */
+  uint32_t lut_size{6u};
+
+  /*! \brief Minimize ESOP covers with at most 32 inputs using exorcism. */
+  bool minimize_esop{false};
+};
+
+/*! \brief Cubes of a PLA file.
+ *
+ * The input part and the output part of each cube are packed into 64-bit
+ * words.  For cube `c`, the words `c * input_words` to `(c + 1) *
+ * input_words - 1` of `masks` contain which inputs are in the cube and the
+ * same words of `bits` their polarity.  The words `c * output_words` to `(c
+ * + 1) * output_words - 1` of `outputs` contain to which outputs the cube
+ * belongs.
+ */
+struct pla_cover
+{
+  /*! \brief Number of inputs. */
+  uint32_t num_inputs{0u};
+
+  /*! \brief Number of outputs. */
+  uint32_t num_outputs{0u};
+
+  /*! \brief Whether the outputs are the XOR of their cubes (`.type esop`). */
+  bool is_esop{false};
+
+  /*! \brief Number of cubes. */
+  uint64_t num_cubes{0u};
+
+  /*! \brief Number of words per cube in `bits` and `masks`. */
+  uint32_t input_words{0u};
+
+  /*! \brief Number of words per cube in `outputs`. */
+  uint32_t output_words{0u};
+
+  /*! \brief Polarities of the literals. */
+  std::vector<uint64_t> bits;
+
+  /*! \brief Inputs that appear in the cubes. */
+  std::vector<uint64_t> masks;
+
+  /*! \brief Outputs to which the cubes belong. */
+  std::vector<uint64_t> outputs;
+
+  /*! \brief Whether input `var` appears in cube `c`. */
+  bool has_literal( uint64_t c, uint32_t var ) const
+  {
+    return ( ( masks[c * input_words + var / 64u] >> ( var % 64u ) ) & 1u ) != 0u;
+  }
+
+  /*! \brief Polarity of input `var` in cube `c`. */
+  bool polarity( uint64_t c, uint32_t var ) const
+  {
+    return ( ( bits[c * input_words + var / 64u] >> ( var % 64u ) ) & 1u ) != 0u;
+  }
+
+  /*! \brief Whether cube `c` belongs to output `index`. */
+  bool has_output( uint64_t c, uint32_t index ) const
+  {
+    return ( ( outputs[c * output_words + index / 64u] >> ( index % 64u ) ) & 1u ) != 0u;
+  }
+
+  /*! \brief Cubes of output `index` as `kitty::cube` (at most 32 inputs).
+   *
+   * For ESOP covers, the result can be passed directly to `exorcism`.
+   */
+  std::vector<kitty::cube> output_cubes( uint32_t index ) const
+  {
+    assert( num_inputs <= 32u );
+
+    std::vector<kitty::cube> cubes;
+    for ( auto c = 0u; c < num_cubes; ++c )
+    {
+      if ( has_output( c, index ) )
+      {
+        cubes.emplace_back( input_words == 0u ? 0u : static_cast<uint32_t>( bits[c * input_words] ),
+                            input_words == 0u ? 0u : static_cast<uint32_t>( masks[c * input_words] ) );
+      }
+    }
+    return cubes;
+  }
+};
+
+namespace detail
+{
+
+/* parses the cube lines in a chunk of a PLA file */
+class pla_chunk_parser
+{
+public:
+  pla_chunk_parser( uint32_t num_inputs, uint32_t num_outputs, char const* begin, char const* end )
+      : num_inputs( num_inputs ), num_outputs( num_outputs ),
+        input_words( ( num_inputs + 63u ) / 64u ), output_words( ( num_outputs + 63u ) / 64u ),
+        pos( begin ), end( end )
+  {
+  }
+
+  bool run()
+  {
+    while ( pos != end && !found_end )
+    {
+      auto const* line_end = static_cast<char const*>( std::memchr( pos, '\n', end - pos ) );
+      if ( !line_end )
+      {
+        line_end = end;
+      }
+      if ( !parse_line( pos, line_end ) )
+      {
+        return false;
+      }
+      pos = line_end == end ? end : line_end + 1;
+    }
+    return true;
+  }
+
+private:
+  static bool is_separator( char c )
+  {
+    return c == ' ' || c == '\t' || c == '\r' || c == '|';
+  }
+
+  bool parse_line( char const* p, char const* e )
+  {
+    while ( p != e && is_separator( *p ) )
+    {
+      ++p;
+    }
+    if ( p == e || *p == '#' )
+    {
+      return true;
+    }
+    if ( *p == '.' )
+    {
+      const std::string_view line( p, e - p );
+      const auto keyword = line.substr( 0, line.find_first_of( " \t\r" ) );
+      found_end = keyword == ".e" || keyword == ".end";
+      return true;
+    }
+
+    bits.resize( bits.size() + input_words );
+    masks.resize( masks.size() + input_words );
+    outputs.resize( outputs.size() + output_words );
+    auto* cube_bits = bits.data() + num_cubes * input_words;
+    auto* cube_masks = masks.data() + num_cubes * input_words;
+    auto* cube_outputs = outputs.data() + num_cubes * output_words;
+
+    for ( auto i = 0u; i < num_inputs; ++i )
+    {
+      while ( p != e && is_separator( *p ) )
+      {
+        ++p;
+      }
+      if ( p == e )
+      {
+        return error( "too few inputs in cube" );
+      }
+      switch ( *p++ )
+      {
+      case '1':
+        cube_bits[i / 64u] |= uint64_t( 1 ) << ( i % 64u );
+        cube_masks[i / 64u] |= uint64_t( 1 ) << ( i % 64u );
+        break;
+      case '0':
+        cube_masks[i / 64u] |= uint64_t( 1 ) << ( i % 64u );
+        break;
+      case '-':
+      case '2':
+      case '~':
+        break;
+      default:
+        ++num_unknown_characters;
+        break;
+      }
+    }
+
+    for ( auto i = 0u; i < num_outputs; ++i )
+    {
+      while ( p != e && is_separator( *p ) )
+      {
+        ++p;
+      }
+      if ( p == e )
+      {
+        return error( "too few outputs in cube" );
+      }
+      switch ( *p++ )
+      {
+      case '1':
+      case '4':
+        cube_outputs[i / 64u] |= uint64_t( 1 ) << ( i % 64u );
+        break;
+      case '0':
+      case '-':
+      case '2':
+      case '3':
+      case '~':
+        break;
+      default:
+        ++num_unknown_characters;
+        break;
+      }
+    }
+
+    ++num_cubes;
+    return true;
+  }
+
+  bool error( char const* message )
+  {
+    error_message = message;
+    return false;
+  }
+
+public:
+  uint64_t num_cubes{0u};
+  std::vector<uint64_t> bits;
+  std::vector<uint64_t> masks;
+  std::vector<uint64_t> outputs;
+
+  /* the chunk contains the end of the cubes (`.e`) */
+  bool found_end{false};
+  uint64_t num_unknown_characters{0u};
+
+  /* reported after the threads are joined */
+  char const* error_message{nullptr};
+
+private:
+  uint32_t num_inputs;
+  uint32_t num_outputs;
+  uint32_t input_words;
+  uint32_t output_words;
+  char const* pos;
+  char const* end;
+};
+
+template<class Ntk>
+class pla_network_builder
+{
+public:
+  static constexpr bool is_klut = std::is_same_v<typename Ntk::base_type, klut_network>;
+
+  /* node functions are built as truth tables, one for each polarity pattern */
+  static constexpr uint32_t max_lut_size = 16u;
+
+  pla_network_builder( Ntk& ntk, pla_cover const& cover, read_pla_params const& ps )
+      : ntk( ntk ), cover( cover ), ps( ps )
+  {
+  }
+
+  bool run()
+  {
+    if ( is_klut && ps.lut_size > max_lut_size )
+    {
+      return false;
+    }
+
+    pis.reserve( cover.num_inputs );
+    for ( auto i = 0u; i < cover.num_inputs; ++i )
+    {
+      pis.push_back( ntk.create_pi() );
+    }
+    if constexpr ( !is_klut )
+    {
+      for ( auto const& pi : pis )
+      {
+        negated_pis.push_back( ntk.create_not( pi ) );
+      }
+    }
+
+    const auto sum_op = cover.is_esop ? op::xor_ : op::or_;
+
+    if ( ps.minimize_esop && cover.is_esop && cover.num_inputs <= 32u )
+    {
+      for ( auto o = 0u; o < cover.num_outputs; ++o )
+      {
+        std::vector<leaf> sum;
+        for ( auto const& cube : exorcism( cover.output_cubes( o ), cover.num_inputs ) )
+        {
+          std::vector<leaf> product;
+          for ( auto i = 0u; i < cover.num_inputs; ++i )
+          {
+            if ( cube.get_mask( i ) )
+            {
+              product.push_back( literal( i, cube.get_bit( i ) ) );
+            }
+          }
+          sum.push_back( {tree( product, op::and_ ), true} );
+        }
+        ntk.create_po( tree( sum, sum_op ) );
+      }
+      return true;
+    }
+
+    /* products are created once and shared by all outputs */
+    std::vector<std::vector<leaf>> sums( cover.num_outputs );
+    std::vector<leaf> product;
+    for ( auto c = 0u; c < cover.num_cubes; ++c )
+    {
+      product.clear();
+      for ( auto i = 0u; i < cover.num_inputs; ++i )
+      {
+        if ( cover.has_literal( c, i ) )
+        {
+          product.push_back( literal( i, cover.polarity( c, i ) ) );
+        }
+      }
+
+      std::optional<signal<Ntk>> f;
+      for ( auto o = 0u; o < cover.num_outputs; ++o )
+      {
+        if ( cover.has_output( c, o ) )
+        {
+          if ( !f )
+          {
+            f = tree( product, op::and_ );
+          }
+          sums[o].push_back( {*f, true} );
+        }
+      }
+    }
+
+    for ( auto& sum : sums )
+    {
+      ntk.create_po( tree( sum, sum_op ) );
+    }
+    return true;
+  }
+
+private:
+  enum class op
+  {
+    and_,
+    or_,
+    xor_
+  };
+
+  /* signal with polarity, which is only used in k-LUT networks to avoid inverters */
+  struct leaf
+  {
+    signal<Ntk> f;
+    bool polarity;
+  };
+
+  leaf literal( uint32_t var, bool polarity ) const
+  {
+    if constexpr ( is_klut )
+    {
+      return {pis[var], polarity};
+    }
+    else
+    {
+      return {polarity ? pis[var] : negated_pis[var], true};
+    }
+  }
+
+  /* balanced tree over the leaves, which are overwritten */
+  signal<Ntk> tree( std::vector<leaf>& leaves, op o )
+  {
+    if ( leaves.empty() )
+    {
+      return ntk.get_constant( o == op::and_ );
+    }
+
+    const std::size_t arity = is_klut ? std::max<uint32_t>( ps.lut_size, 2u ) : 2u;
+    while ( leaves.size() > 1u )
+    {
+      std::size_t j = 0u;
+      for ( std::size_t i = 0u; i < leaves.size(); i += arity, ++j )
+      {
+        const auto k = std::min( arity, leaves.size() - i );
+        leaves[j] = k == 1u ? leaves[i] : leaf{gate( leaves.data() + i, k, o ), true};
+      }
+      leaves.resize( j );
+    }
+
+    return leaves.front().polarity ? leaves.front().f : ntk.create_not( leaves.front().f );
+  }
+
+  signal<Ntk> gate( leaf const* leaves, std::size_t k, op o )
+  {
+    if constexpr ( is_klut )
+    {
+      std::vector<signal<Ntk>> children( k );
+      uint64_t polarities{0u};
+      for ( auto i = 0u; i < k; ++i )
+      {
+        children[i] = leaves[i].f;
+        polarities |= leaves[i].polarity ? ( uint64_t{1} << i ) : 0u;
+      }
+      return ntk.create_node( children, function( static_cast<uint32_t>( k ), polarities, o ) );
+    }
+    else
+    {
+      assert( k == 2u );
+      switch ( o )
+      {
+      case op::and_:
+        return ntk.create_and( leaves[0].f, leaves[1].f );
+      case op::or_:
+        return ntk.create_or( leaves[0].f, leaves[1].f );
+      default:
+        return ntk.create_xor( leaves[0].f, leaves[1].f );
+      }
+    }
+  }
+
+  /* function of a k-input gate with complemented inputs */
+  kitty::dynamic_truth_table const& function( uint32_t k, uint64_t polarities, op o )
+  {
+    assert( k <= max_lut_size );
+    const auto key = ( uint64_t( o ) << 48u ) | ( uint64_t( k ) << 32u ) | polarities;
+    if ( const auto it = functions.find( key ); it != functions.end() )
+    {
+      return it->second;
+    }
+
+    kitty::dynamic_truth_table tt( k );
+    if ( o == op::and_ )
+    {
+      tt = ~tt;
+    }
+    for ( auto i = 0u; i < k; ++i )
+    {
+      auto var = tt.construct();
+      kitty::create_nth_var( var, i, ( ( polarities >> i ) & 1u ) == 0u );
+      switch ( o )
+      {
+      case op::and_:
+        tt &= var;
+        break;
+      case op::or_:
+        tt |= var;
+        break;
+      default:
+        tt ^= var;
+        break;
+      }
+    }
+    return functions.emplace( key, tt ).first->second;
+  }
+
+private:
+  Ntk& ntk;
+  pla_cover const& cover;
+  read_pla_params const& ps;
+
+  std::vector<signal<Ntk>> pis;
+  std::vector<signal<Ntk>> negated_pis;
+  std::unordered_map<uint64_t, kitty::dynamic_truth_table> functions;
+};
+
+} /* namespace detail */
+
+/*! \brief Reads the cubes of a PLA file in parallel.
+ *
+ * The file is memory-mapped.  After the header with the keywords `.i`,
+ * `.o`, and `.type`, the cube lines are split into chunks at line
+ * boundaries, which are parsed in parallel threads into packed arrays.  The
+ * cubes end at `.e`, `.end`, or the end of the file.  Characters other than
+ * `0`, `1`, and `-` in the input part are treated as don't cares; an output
+ * is set by `1` or `4`.
+ *
+ * Returns `lorina::return_code::parse_error` if the file cannot be read, if
+ * `.i` or `.o` are missing, or if a cube line is incomplete.  Errors and
+ * unknown characters are reported to `diag`, if given.
+ *
+ * \param filename Filename
+ * \param cover Cover that is overwritten with the cubes of the file
+ * \param ps Parameters
+ * \param diag Optional diagnostic engine
+ */
+inline lorina::return_code read_pla_cover( std::string const& filename, pla_cover& cover, read_pla_params const& ps = {}, lorina::diagnostic_engine* diag = nullptr )
+{
+  mapped_file file( filename );
+  if ( !file.is_open() )
+  {
+    if ( diag )
+    {
+      diag->report( lorina::diagnostic_level::fatal, fmt::format( "could not open file `{}`", filename ) );
+    }
+    return lorina::return_code::parse_error;
+  }
+
+  char const* pos = file.data();
+  char const* end = pos + file.size();
+
+  /* header */
+  cover = pla_cover{};
+  bool has_inputs{false}, has_outputs{false}, found_end{false};
+  while ( pos != end )
+  {
+    auto const* line_end = static_cast<char const*>( std::memchr( pos, '\n', end - pos ) );
+    if ( !line_end )
+    {
+      line_end = end;
+    }
+
+    std::string_view line( pos, line_end - pos );
+    line.remove_prefix( std::min( line.size(), line.find_first_not_of( " \t\r" ) ) );
+    if ( !line.empty() && line.front() != '#' )
+    {
+      if ( line.front() != '.' )
+      {
+        break;
+      }
+
+      const auto keyword = line.substr( 0, line.find_first_of( " \t\r" ) );
+      auto value = line.substr( keyword.size() );
+      value.remove_prefix( std::min( value.size(), value.find_first_not_of( " \t\r" ) ) );
+      value = value.substr( 0, value.find_first_of( " \t\r" ) );
+
+      if ( keyword == ".i" )
+      {
+        has_inputs = std::from_chars( value.data(), value.data() + value.size(), cover.num_inputs ).ec == std::errc();
+      }
+      else if ( keyword == ".o" )
+      {
+        has_outputs = std::from_chars( value.data(), value.data() + value.size(), cover.num_outputs ).ec == std::errc();
+      }
+      else if ( keyword == ".type" )
+      {
+        cover.is_esop = value == "esop";
+      }
+      else if ( keyword == ".e" || keyword == ".end" )
+      {
+        found_end = true;
+        break;
+      }
+    }
+
+    pos = line_end == end ? end : line_end + 1;
+  }
+
+  if ( !has_inputs || !has_outputs )
+  {
+    if ( diag )
+    {
+      diag->report( lorina::diagnostic_level::error, "missing .i or .o in PLA file" );
+    }
+    return lorina::return_code::parse_error;
+  }
+
+  cover.input_words = ( cover.num_inputs + 63u ) / 64u;
+  cover.output_words = ( cover.num_outputs + 63u ) / 64u;
+  if ( found_end )
+  {
+    return lorina::return_code::success;
+  }
+
+  /* chunks end after a newline */
+  const uint64_t size = end - pos;
+  const uint64_t num_threads = std::max<uint64_t>( 1u, ps.num_threads == 0u ? std::thread::hardware_concurrency() : ps.num_threads );
+  const uint64_t num_chunks = std::max<uint64_t>( 1u, std::min<uint64_t>( num_threads, size / std::max<uint64_t>( 1u, ps.min_chunk_size ) ) );
+
+  std::vector<char const*> bounds{pos};
+  for ( auto i = 1u; i < num_chunks; ++i )
+  {
+    auto p = std::max( bounds.back(), pos + size * i / num_chunks );
+    while ( p != end && *p++ != '\n' )
+    {
+    }
+    bounds.push_back( p );
+  }
+  bounds.push_back( end );
+
+  std::vector<detail::pla_chunk_parser> chunks;
+  chunks.reserve( num_chunks );
+  for ( auto i = 0u; i < num_chunks; ++i )
+  {
+    chunks.emplace_back( cover.num_inputs, cover.num_outputs, bounds[i], bounds[i + 1u] );
+  }
+
+  std::vector<char> success( num_chunks, 0 );
+  std::vector<std::thread> threads;
+  for ( auto i = 1u; i < num_chunks; ++i )
+  {
+    threads.emplace_back( [&chunks, &success, i]() { success[i] = chunks[i].run(); } );
+  }
+  success[0] = chunks[0].run();
+  for ( auto& t : threads )
+  {
+    t.join();
+  }
+
+  /* concatenate the chunks up to the end of the cubes */
+  uint64_t num_cubes{0u}, num_unknown_characters{0u};
+  auto num_used_chunks = 0u;
+  while ( num_used_chunks < num_chunks )
+  {
+    auto const& chunk = chunks[num_used_chunks++];
+    if ( !success[num_used_chunks - 1u] )
+    {
+      if ( diag )
+      {
+        diag->report( lorina::diagnostic_level::error, chunk.error_message );
+      }
+      return lorina::return_code::parse_error;
+    }
+    num_cubes += chunk.num_cubes;
+    num_unknown_characters += chunk.num_unknown_characters;
+    if ( chunk.found_end )
+    {
+      break;
+    }
+  }
+  if ( num_unknown_characters > 0u && diag )
+  {
+    diag->report( lorina::diagnostic_level::warning, fmt::format( "{} unknown characters in PLA cubes, treated as don't care or 0", num_unknown_characters ) );
+  }
+
+  cover.num_cubes = num_cubes;
+  cover.bits.reserve( num_cubes * cover.input_words );
+  cover.masks.reserve( num_cubes * cover.input_words );
+  cover.outputs.reserve( num_cubes * cover.output_words );
+  for ( auto i = 0u; i < num_used_chunks; ++i )
+  {
+    auto& chunk = chunks[i];
+    cover.bits.insert( cover.bits.end(), chunk.bits.begin(), chunk.bits.end() );
+    cover.masks.insert( cover.masks.end(), chunk.masks.begin(), chunk.masks.end() );
+    cover.outputs.insert( cover.outputs.end(), chunk.outputs.begin(), chunk.outputs.end() );
+    chunk.bits = {};
+    chunk.masks = {};
+    chunk.outputs = {};
+  }
+
+  return lorina::return_code::success;
+}
+
+/*! \brief Creates a network from the cubes of a PLA file.
+ *
+ * Each cube is created as a balanced tree of AND gates, and each output as
+ * a balanced tree of OR gates, or XOR gates for ESOP covers, over its cubes.
+ * Cubes that belong to several outputs are created once.  In k-LUT
+ * networks, the trees consist of nodes with up to `ps.lut_size` inputs, and
+ * complemented literals are part of the node functions.  Returns false and
+ * leaves the network unchanged, if `ps.lut_size` is larger than 16 for a
+ * k-LUT network.
+ *
+ * If `ps.minimize_esop` is true and the cover is an ESOP with at most 32
+ * inputs, the cubes of each output are minimized with `exorcism` before the
+ * network is created.
+ *
+ * **Required network functions:**
+ * - `create_pi`
+ * - `create_po`
+ * - `get_constant`
+ * - `create_not`
+ * - `create_and`
+ * - `create_or`
+ * - `create_xor`
+ *
+ * \param ntk Network
+ * \param cover Cubes
+ * \param ps Parameters
+ */
+template<class Ntk>
+bool create_from_pla_cover( Ntk& ntk, pla_cover const& cover, read_pla_params const& ps = {} )
+{
+  static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
+  static_assert( has_create_pi_v<Ntk>, "Ntk does not implement the create_pi function" );
+  static_assert( has_create_po_v<Ntk>, "Ntk does not implement the create_po function" );
+  static_assert( has_get_constant_v<Ntk>, "Ntk does not implement the get_constant function" );
+  static_assert( has_create_not_v<Ntk>, "Ntk does not implement the create_not function" );
+  static_assert( has_create_and_v<Ntk>, "Ntk does not implement the create_and function" );
+  static_assert( has_create_or_v<Ntk>, "Ntk does not implement the create_or function" );
+  static_assert( has_create_xor_v<Ntk>, "Ntk does not implement the create_xor function" );
+
+  detail::pla_network_builder<Ntk> builder( ntk, cover, ps );
+  return builder.run();
+}
+
+/*! \brief Reads a PLA file into a network.
+ *
+ * This is a fast alternative to `lorina::read_pla` with `pla_reader` for
+ * PLA files with many cubes.  It reads the cubes with `read_pla_cover` and
+ * creates the network with `create_from_pla_cover`.  Returns
+ * `lorina::return_code::parse_error`, if either of them fails.  Errors are
+ * reported to `diag`, if given.
+ *
+   \verbatim embed:rst
+
+   Example
+
+   .. code-block:: c++
+
+      aig_network aig;
+      read_pla( "file.pla", aig );
+
+      klut_network klut;
+      read_pla( "file.pla", klut );
+   \endverbatim
+ *
+ * \param filename Filename
+ * \param ntk Network
+ * \param ps Parameters
+ * \param diag Optional diagnostic engine
+ */
+template<class Ntk>
+lorina::return_code read_pla( std::string const& filename, Ntk& ntk, read_pla_params const& ps = {}, lorina::diagnostic_engine* diag = nullptr )
+{
+  pla_cover cover;
+  if ( const auto ret = read_pla_cover( filename, cover, ps, diag ); ret != lorina::return_code::success )
+  {
+    return ret;
+  }
+
+  if ( !create_from_pla_cover( ntk, cover, ps ) )
+  {
+    if ( diag )
+    {
+      diag->report( lorina::diagnostic_level::error, fmt::format( "LUT size {} is larger than 16", ps.lut_size ) );
+    }
+    return lorina::return_code::parse_error;
+  }
+  return lorina::return_code::success;
+}
+
+} /* namespace mockturtle */
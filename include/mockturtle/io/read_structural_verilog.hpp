@@ -0,0 +1,805 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2019  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file read_structural_verilog.hpp
+  \brief Parallel reader for structural Verilog files
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <lorina/common.hpp>
+#include <lorina/diagnostics.hpp>
+
+#include "../traits.hpp"
+#include "../utils/mapped_file.hpp"
+
+namespace mockturtle
+{
+
+/*! \brief Parameters for read_structural_verilog.
+ *
+ * The data structure `read_structural_verilog_params` holds configurable
+ * parameters with default arguments for `read_structural_verilog`.
+ */
+struct read_structural_verilog_params
+{
+  /*! \brief Number of threads to tokenize the file (0: number of cores). */
+  uint32_t num_threads{0u};
+
+  /*! \brief Minimum number of bytes per thread. */
+  uint64_t min_chunk_size{1u << 20u};
+};
+
+namespace detail
+{
+
+/* maps names to consecutive IDs from multiple threads; the strings must
+ * outlive the table */
+class concurrent_name_table
+{
+public:
+  uint32_t intern( std::string_view name )
+  {
+    auto& s = shards[std::hash<std::string_view>()( name ) % num_shards];
+    std::lock_guard lock( s.mutex );
+    const auto [it, inserted] = s.ids.emplace( name, 0u );
+    if ( inserted )
+    {
+      it->second = next_id++;
+    }
+    return it->second;
+  }
+
+  uint32_t size() const
+  {
+    return next_id;
+  }
+
+  /* names indexed by ID; not thread-safe */
+  std::vector<std::string_view> names() const
+  {
+    std::vector<std::string_view> result( next_id );
+    for ( auto const& s : shards )
+    {
+      for ( auto const& [name, id] : s.ids )
+      {
+        result[id] = name;
+      }
+    }
+    return result;
+  }
+
+private:
+  static constexpr uint32_t num_shards = 64u;
+
+  struct shard
+  {
+    std::mutex mutex;
+    std::unordered_map<std::string_view, uint32_t> ids;
+  };
+
+  std::array<shard, num_shards> shards;
+  std::atomic<uint32_t> next_id{0u};
+};
+
+struct structural_verilog_statement
+{
+  enum kind_t : uint8_t
+  {
+    input,
+    output,
+    buf,
+    and2,
+    or2,
+    xor2,
+    xor3,
+    maj3
+  };
+
+  kind_t kind;
+
+  /* assigned name, or declared name */
+  uint32_t lhs;
+
+  /* bit-width of declared registers, 0 for single bits */
+  uint32_t width{0u};
+
+  /* operands as 2 * name ID + complement */
+  std::array<uint32_t, 3> operands{};
+};
+
+class structural_verilog_tokenizer
+{
+public:
+  structural_verilog_tokenizer( concurrent_name_table& names, char const* begin, char const* end )
+      : names( names ), pos( begin ), end( end )
+  {
+  }
+
+  bool run()
+  {
+    while ( next_statement() )
+    {
+      if ( tokens.empty() )
+      {
+        continue;
+      }
+
+      if ( !parse_statement() )
+      {
+        std::string text;
+        for ( auto const& t : tokens )
+        {
+          text += std::string( t ) + " ";
+        }
+        error = fmt::format( "unsupported statement `{}`", text );
+        return false;
+      }
+    }
+    return true;
+  }
+
+  std::vector<structural_verilog_statement> statements;
+  std::string_view module_name;
+  uint32_t num_modules{0u};
+
+  /* reported after the threads are joined */
+  std::string error;
+
+private:
+  /* collects the tokens up to the next `;` or `endmodule` */
+  bool next_statement()
+  {
+    tokens.clear();
+    while ( true )
+    {
+      while ( pos != end && is_space( *pos ) )
+      {
+        ++pos;
+      }
+      if ( pos == end )
+      {
+        return !tokens.empty();
+      }
+
+      if ( is_operator( *pos ) )
+      {
+        if ( *pos++ == ';' )
+        {
+          return true;
+        }
+        tokens.emplace_back( pos - 1, 1u );
+        continue;
+      }
+
+      const auto begin = pos;
+      while ( pos != end && !is_space( *pos ) && !is_operator( *pos ) )
+      {
+        ++pos;
+      }
+      tokens.emplace_back( begin, pos - begin );
+
+      if ( tokens.back() == "endmodule" )
+      {
+        return true;
+      }
+    }
+  }
+
+  bool parse_statement()
+  {
+    using st = structural_verilog_statement;
+
+    const auto& kw = tokens.front();
+    if ( kw == "endmodule" )
+    {
+      return tokens.size() == 1u;
+    }
+    else if ( kw == "module" )
+    {
+      if ( tokens.size() < 2u )
+      {
+        return false;
+      }
+      module_name = tokens[1];
+      ++num_modules;
+      return true;
+    }
+    else if ( kw == "wire" )
+    {
+      return true;
+    }
+    else if ( kw == "input" || kw == "output" )
+    {
+      auto i = 1u;
+      uint32_t width{0u};
+      if ( tokens.size() > 1u && tokens[1].front() == '[' )
+      {
+        if ( !parse_range( tokens[1], width ) )
+        {
+          return false;
+        }
+        ++i;
+      }
+
+      for ( ; i < tokens.size(); i += 2u )
+      {
+        if ( is_operator( tokens[i].front() ) || ( i + 1u < tokens.size() && tokens[i + 1u] != "," ) )
+        {
+          return false;
+        }
+        statements.push_back( {kw == "input" ? st::input : st::output, names.intern( tokens[i] ), width, {}} );
+      }
+      return true;
+    }
+    else if ( kw == "assign" )
+    {
+      if ( tokens.size() < 4u || tokens[2] != "=" || is_operator( tokens[1].front() ) )
+      {
+        return false;
+      }
+      return parse_expression( names.intern( tokens[1] ) );
+    }
+
+    return false;
+  }
+
+  /* expressions as written by `write_verilog` */
+  bool parse_expression( uint32_t lhs )
+  {
+    using st = structural_verilog_statement;
+
+    std::array<uint32_t, 6> ops;
+    auto p = 3u;
+    const auto n = static_cast<uint32_t>( tokens.size() );
+
+    const auto operand = [&]( uint32_t& op ) {
+      bool complement{false};
+      if ( p < n && tokens[p] == "~" )
+      {
+        complement = true;
+        ++p;
+      }
+      if ( p >= n || is_operator( tokens[p].front() ) )
+      {
+        return false;
+      }
+      op = 2u * names.intern( tokens[p++] ) + ( complement ? 1u : 0u );
+      return true;
+    };
+    const auto expect = [&]( std::string_view t ) {
+      return p < n && tokens[p++] == t;
+    };
+
+    if ( tokens[p] == "(" )
+    {
+      /* ( a ) */
+      if ( n == 6u )
+      {
+        ++p;
+        if ( !operand( ops[0] ) || !expect( ")" ) )
+        {
+          return false;
+        }
+        statements.push_back( {st::buf, lhs, 0u, {ops[0], 0u, 0u}} );
+        return true;
+      }
+
+      /* ( a & b ) | ( a & c ) | ( b & c ) */
+      for ( auto i = 0u; i < 3u; ++i )
+      {
+        if ( ( i > 0u && !expect( "|" ) ) || !expect( "(" ) || !operand( ops[2 * i] ) || !expect( "&" ) || !operand( ops[2 * i + 1] ) || !expect( ")" ) )
+        {
+          return false;
+        }
+      }
+      if ( p != n || ops[0] != ops[2] || ops[1] != ops[4] || ops[3] != ops[5] )
+      {
+        return false;
+      }
+      statements.push_back( {st::maj3, lhs, 0u, {ops[0], ops[1], ops[3]}} );
+      return true;
+    }
+
+    if ( !operand( ops[0] ) )
+    {
+      return false;
+    }
+    if ( p == n )
+    {
+      statements.push_back( {st::buf, lhs, 0u, {ops[0], 0u, 0u}} );
+      return true;
+    }
+
+    const auto op = tokens[p++];
+    if ( !operand( ops[1] ) )
+    {
+      return false;
+    }
+    if ( p == n )
+    {
+      const auto kind = op == "&" ? st::and2 : ( op == "|" ? st::or2 : st::xor2 );
+      if ( op != "&" && op != "|" && op != "^" )
+      {
+        return false;
+      }
+      statements.push_back( {kind, lhs, 0u, {ops[0], ops[1], 0u}} );
+      return true;
+    }
+
+    if ( op != "^" || !expect( "^" ) || !operand( ops[2] ) || p != n )
+    {
+      return false;
+    }
+    statements.push_back( {st::xor3, lhs, 0u, {ops[0], ops[1], ops[2]}} );
+    return true;
+  }
+
+  /* [N:0] */
+  static bool parse_range( std::string_view range, uint32_t& width )
+  {
+    if ( range.size() < 5u || range.back() != ']' || range.substr( range.size() - 3u ) != ":0]" )
+    {
+      return false;
+    }
+
+    uint64_t msb{0u};
+    for ( auto c : range.substr( 1u, range.size() - 4u ) )
+    {
+      if ( c < '0' || c > '9' || msb > UINT32_MAX / 10u )
+      {
+        return false;
+      }
+      msb = 10u * msb + static_cast<uint64_t>( c - '0' );
+    }
+    if ( msb + 1u > UINT32_MAX )
+    {
+      return false;
+    }
+    width = static_cast<uint32_t>( msb + 1u );
+    return true;
+  }
+
+  static bool is_space( char c )
+  {
+    return c == ' ' || c == '\n' || c == '\t' || c == '\r';
+  }
+
+  static bool is_operator( char c )
+  {
+    return c == '(' || c == ')' || c == ',' || c == ';' || c == '=' || c == '&' || c == '|' || c == '^' || c == '~';
+  }
+
+private:
+  concurrent_name_table& names;
+  char const* pos;
+  char const* end;
+
+  std::vector<std::string_view> tokens;
+};
+
+template<class Ntk>
+class structural_verilog_builder
+{
+public:
+  using signal = mockturtle::signal<Ntk>;
+  using statement = structural_verilog_statement;
+
+  structural_verilog_builder( Ntk& ntk, concurrent_name_table& names, std::vector<structural_verilog_tokenizer> const& chunks, lorina::diagnostic_engine* diag )
+      : ntk( ntk ), names( names ), chunks( chunks ), diag( diag ), name_of( names.names() )
+  {
+  }
+
+  lorina::return_code run()
+  {
+    /* the first IDs are the constants 0, 1, 1'b0, and 1'b1 */
+    resize();
+    for ( auto i = 0u; i < 4u; ++i )
+    {
+      signals[i] = ntk.get_constant( i % 2u == 1u );
+      state[i] = done;
+    }
+
+    /* declarations, in file order */
+    for ( auto const& chunk : chunks )
+    {
+      for ( auto const& s : chunk.statements )
+      {
+        if ( s.kind == statement::input )
+        {
+          if ( s.width == 0u )
+          {
+            create_input( s.lhs );
+          }
+          else
+          {
+            for ( auto i = 0u; i < s.width; ++i )
+            {
+              create_input( bit( s.lhs, i ) );
+            }
+          }
+        }
+        else if ( s.kind == statement::output )
+        {
+          if ( s.width == 0u )
+          {
+            outputs.push_back( s.lhs );
+          }
+          else
+          {
+            for ( auto i = 0u; i < s.width; ++i )
+            {
+              outputs.push_back( bit( s.lhs, i ) );
+            }
+          }
+        }
+        else
+        {
+          resize();
+          definer[s.lhs] = &s;
+        }
+      }
+    }
+
+    /* gates in topological order */
+    resize();
+    for ( auto const& chunk : chunks )
+    {
+      for ( auto const& s : chunk.statements )
+      {
+        if ( s.kind != statement::input && s.kind != statement::output && definer[s.lhs] == &s && !resolve( s.lhs ) )
+        {
+          return lorina::return_code::parse_error;
+        }
+      }
+    }
+
+    for ( auto id : outputs )
+    {
+      if ( !resolve( id ) )
+      {
+        return lorina::return_code::parse_error;
+      }
+      ntk.create_po( signals[id], std::string( name_of[id] ) );
+    }
+
+    return lorina::return_code::success;
+  }
+
+private:
+  /* ID of `name[index]` */
+  uint32_t bit( uint32_t id, uint32_t index )
+  {
+    const auto& name = generated.emplace_back( fmt::format( "{}[{}]", name_of[id], index ) );
+    const auto bit_id = names.intern( name );
+    if ( bit_id >= name_of.size() )
+    {
+      name_of.resize( bit_id + 1u );
+      name_of[bit_id] = name;
+    }
+    return bit_id;
+  }
+
+  void create_input( uint32_t id )
+  {
+    resize();
+    signals[id] = ntk.create_pi( std::string( name_of[id] ) );
+    state[id] = done;
+  }
+
+  void resize()
+  {
+    if ( signals.size() < names.size() )
+    {
+      signals.resize( names.size() );
+      state.resize( names.size(), unvisited );
+      definer.resize( names.size(), nullptr );
+    }
+  }
+
+  signal operand( uint32_t op ) const
+  {
+    const auto f = signals[op >> 1];
+    return ( op & 1 ) ? ntk.create_not( f ) : f;
+  }
+
+  /* creates the signal for name `id` and its transitive fanin */
+  bool resolve( uint32_t id )
+  {
+    stack.clear();
+    stack.emplace_back( id, false );
+
+    while ( !stack.empty() )
+    {
+      const auto [current, expanded] = stack.back();
+      stack.pop_back();
+
+      if ( state[current] == done )
+      {
+        continue;
+      }
+
+      auto const* s = definer[current];
+      if ( s == nullptr )
+      {
+        if ( diag )
+        {
+          diag->report( lorina::diagnostic_level::warning, fmt::format( "undefined signal {} assigned 0", name_of[current] ) );
+        }
+        signals[current] = ntk.get_constant( false );
+        state[current] = done;
+        continue;
+      }
+
+      if ( !expanded )
+      {
+        if ( state[current] == visiting )
+        {
+          if ( diag )
+          {
+            diag->report( lorina::diagnostic_level::error, fmt::format( "combinational cycle at signal {}", name_of[current] ) );
+          }
+          return false;
+        }
+        state[current] = visiting;
+        stack.emplace_back( current, true );
+        for ( auto i = num_operands( s->kind ); i-- > 0u; )
+        {
+          if ( state[s->operands[i] >> 1] != done )
+          {
+            stack.emplace_back( s->operands[i] >> 1, false );
+          }
+        }
+        continue;
+      }
+
+      signals[current] = create_gate( *s );
+      state[current] = done;
+    }
+
+    return true;
+  }
+
+  signal create_gate( statement const& s )
+  {
+    const auto a = operand( s.operands[0] );
+    switch ( s.kind )
+    {
+    default:
+    case statement::buf:
+      return a;
+    case statement::and2:
+      return ntk.create_and( a, operand( s.operands[1] ) );
+    case statement::or2:
+      return ntk.create_or( a, operand( s.operands[1] ) );
+    case statement::xor2:
+      return ntk.create_xor( a, operand( s.operands[1] ) );
+    case statement::xor3:
+      if constexpr ( has_create_xor3_v<Ntk> )
+      {
+        return ntk.create_xor3( a, operand( s.operands[1] ), operand( s.operands[2] ) );
+      }
+      else
+      {
+        return ntk.create_xor( ntk.create_xor( a, operand( s.operands[1] ) ), operand( s.operands[2] ) );
+      }
+    case statement::maj3:
+      return ntk.create_maj( a, operand( s.operands[1] ), operand( s.operands[2] ) );
+    }
+  }
+
+  static uint32_t num_operands( statement::kind_t kind )
+  {
+    switch ( kind )
+    {
+    case statement::buf:
+      return 1u;
+    case statement::xor3:
+    case statement::maj3:
+      return 3u;
+    default:
+      return 2u;
+    }
+  }
+
+private:
+  enum state_t : uint8_t
+  {
+    unvisited,
+    visiting,
+    done
+  };
+
+  Ntk& ntk;
+  concurrent_name_table& names;
+  std::vector<structural_verilog_tokenizer> const& chunks;
+  lorina::diagnostic_engine* diag;
+
+  std::vector<std::string_view> name_of;
+  std::vector<signal> signals;
+  std::vector<state_t> state;
+  std::vector<statement const*> definer;
+  std::vector<uint32_t> outputs;
+  std::vector<std::pair<uint32_t, bool>> stack;
+  std::deque<std::string> generated;
+};
+
+} /* namespace detail */
+
+/*! \brief Reads a structural Verilog file in parallel.
+ *
+ * This is a fast alternative to `lorina::read_verilog` with `verilog_reader`
+ * for large gate-level netlists in the subset of Verilog that is written by
+ * `write_verilog`: a single module with input, output, and wire
+ * declarations, and assignments of single signals, 2-input AND, OR, XOR,
+ * 3-input XOR, and majority-of-3 expressions, with optional complemented
+ * operands.  Module instantiations and comments are not supported.
+ *
+ * The file is memory-mapped and split into chunks at statement boundaries,
+ * which are tokenized in parallel threads.  The names are interned into a
+ * concurrent table with integer IDs.  Afterwards, the gates are created in
+ * topological order, such that assignments may appear in any order in the
+ * file.  The resulting network is the same as the one created by
+ * `verilog_reader` for files in which every signal is assigned before it is
+ * used.
+ *
+ * Returns `lorina::return_code::parse_error` if the file cannot be read, is
+ * not in the supported subset, or contains a combinational cycle.  Parse
+ * errors and undefined signals are reported to `diag`, if given.
+ *
+ * **Required network functions:**
+ * - `create_pi`
+ * - `create_po`
+ * - `get_constant`
+ * - `create_not`
+ * - `create_and`
+ * - `create_or`
+ * - `create_xor`
+ * - `create_maj`
+ *
+   \verbatim embed:rst
+
+   Example
+
+   .. code-block:: c++
+
+      xag_network xag;
+      read_structural_verilog( "file.v", xag );
+   \endverbatim
+ *
+ * \param filename Filename
+ * \param ntk Network
+ * \param ps Parameters
+ * \param diag Optional diagnostic engine
+ */
+template<class Ntk>
+lorina::return_code read_structural_verilog( std::string const& filename, Ntk& ntk, read_structural_verilog_params const& ps = {}, lorina::diagnostic_engine* diag = nullptr )
+{
+  static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
+  static_assert( has_create_pi_v<Ntk>, "Ntk does not implement the create_pi function" );
+  static_assert( has_create_po_v<Ntk>, "Ntk does not implement the create_po function" );
+  static_assert( has_get_constant_v<Ntk>, "Ntk does not implement the get_constant function" );
+  static_assert( has_create_not_v<Ntk>, "Ntk does not implement the create_not function" );
+  static_assert( has_create_and_v<Ntk>, "Ntk does not implement the create_and function" );
+  static_assert( has_create_or_v<Ntk>, "Ntk does not implement the create_or function" );
+  static_assert( has_create_xor_v<Ntk>, "Ntk does not implement the create_xor function" );
+  static_assert( has_create_maj_v<Ntk>, "Ntk does not implement the create_maj function" );
+
+  mapped_file file( filename );
+  if ( !file.is_open() )
+  {
+    if ( diag )
+    {
+      diag->report( lorina::diagnostic_level::fatal, fmt::format( "could not open file `{}`", filename ) );
+    }
+    return lorina::return_code::parse_error;
+  }
+
+  char const* begin = file.data();
+  char const* end = begin + file.size();
+
+  /* chunks end after a `;` */
+  const uint64_t num_threads = std::max<uint64_t>( 1u, ps.num_threads == 0u ? std::thread::hardware_concurrency() : ps.num_threads );
+  const uint64_t num_chunks = std::max<uint64_t>( 1u, std::min<uint64_t>( num_threads, file.size() / std::max<uint64_t>( 1u, ps.min_chunk_size ) ) );
+
+  std::vector<char const*> bounds{begin};
+  for ( auto i = 1u; i < num_chunks; ++i )
+  {
+    auto pos = std::max( bounds.back(), begin + file.size() * i / num_chunks );
+    while ( pos != end && *pos++ != ';' )
+    {
+    }
+    bounds.push_back( pos );
+  }
+  bounds.push_back( end );
+
+  /* constants have the first IDs */
+  detail::concurrent_name_table names;
+  for ( auto const* constant : {"0", "1", "1'b0", "1'b1"} )
+  {
+    names.intern( constant );
+  }
+
+  std::vector<detail::structural_verilog_tokenizer> chunks;
+  chunks.reserve( num_chunks );
+  for ( auto i = 0u; i < num_chunks; ++i )
+  {
+    chunks.emplace_back( names, bounds[i], bounds[i + 1u] );
+  }
+
+  std::vector<char> success( num_chunks, 0 );
+  std::vector<std::thread> threads;
+  for ( auto i = 1u; i < num_chunks; ++i )
+  {
+    threads.emplace_back( [&chunks, &success, i]() { success[i] = chunks[i].run(); } );
+  }
+  success[0] = chunks[0].run();
+  for ( auto& t : threads )
+  {
+    t.join();
+  }
+
+  uint32_t num_modules{0u};
+  for ( auto i = 0u; i < num_chunks; ++i )
+  {
+    if ( !success[i] )
+    {
+      if ( diag )
+      {
+        diag->report( lorina::diagnostic_level::error, chunks[i].error );
+      }
+      return lorina::return_code::parse_error;
+    }
+    num_modules += chunks[i].num_modules;
+  }
+  if ( num_modules != 1u )
+  {
+    if ( diag )
+    {
+      diag->report( lorina::diagnostic_level::error, "expected a single module" );
+    }
+    return lorina::return_code::parse_error;
+  }
+
+  detail::structural_verilog_builder<Ntk> builder( ntk, names, chunks, diag );
+  return builder.run();
+}
+
+} /* namespace mockturtle */
@@ -0,0 +1,649 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2019  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file snapshot.hpp
+  \brief Binary snapshots of networks
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <kitty/dynamic_truth_table.hpp>
+
+#include "../traits.hpp"
+#include "../utils/binary_utils.hpp"
+#include "../utils/mapped_file.hpp"
+
+namespace mockturtle
+{
+
+class aig_network;
+class klut_network;
+class mig_network;
+class xag_network;
+class xmg_network;
+
+/*! \brief Parameters for read_snapshot.
+ *
+ * The data structure `read_snapshot_params` holds configurable parameters
+ * with default arguments for `read_snapshot`.
+ */
+struct read_snapshot_params
+{
+  /*! \brief Rebuild the structural hash table.
+   *
+   * If false, the hash table remains empty, such that gates created after
+   * loading are not shared with the loaded gates.
+   */
+  bool rebuild_strash{true};
+};
+
+namespace detail
+{
+
+inline constexpr uint32_t snapshot_magic = 0x4e53544du; /* "MTSN" */
+inline constexpr uint32_t snapshot_version = 2u;
+
+template<class Data, class = void>
+struct has_truth_table_cache : std::false_type
+{
+};
+
+template<class Data>
+struct has_truth_table_cache<Data, std::void_t<decltype( std::declval<Data>().cache )>> : std::true_type
+{
+};
+
+template<class Ntk, class = void>
+struct has_clear_names : std::false_type
+{
+};
+
+template<class Ntk>
+struct has_clear_names<Ntk, std::void_t<decltype( std::declval<Ntk>().clear_names() )>> : std::true_type
+{
+};
+
+/* stable names of the network types, which identify them in snapshots */
+template<class Ntk>
+struct snapshot_network_tag
+{
+  static constexpr char const* value = nullptr;
+};
+
+template<>
+struct snapshot_network_tag<aig_network>
+{
+  static constexpr char const* value = "aig";
+};
+
+template<>
+struct snapshot_network_tag<klut_network>
+{
+  static constexpr char const* value = "klut";
+};
+
+template<>
+struct snapshot_network_tag<mig_network>
+{
+  static constexpr char const* value = "mig";
+};
+
+template<>
+struct snapshot_network_tag<xag_network>
+{
+  static constexpr char const* value = "xag";
+};
+
+template<>
+struct snapshot_network_tag<xmg_network>
+{
+  static constexpr char const* value = "xmg";
+};
+
+/* sections are aligned to 8 bytes, such that arrays can be copied in bulk */
+class snapshot_writer
+{
+public:
+  explicit snapshot_writer( std::ostream& os ) : os( os ) {}
+
+  template<typename T>
+  void value( T const& v )
+  {
+    write_binary<T>( os, v );
+    offset += sizeof( T );
+  }
+
+  template<typename T>
+  void array( std::vector<T> const& values )
+  {
+    static_assert( std::is_trivially_copyable_v<T>, "T is not trivially copyable" );
+    value<uint64_t>( values.size() );
+    bytes( values.data(), values.size() * sizeof( T ) );
+  }
+
+  void string( std::string const& s )
+  {
+    value<uint64_t>( s.size() );
+    bytes( s.data(), s.size() );
+  }
+
+  void bytes( void const* data, std::size_t size )
+  {
+    os.write( static_cast<char const*>( data ), size );
+    offset += size;
+    while ( offset % 8u != 0u )
+    {
+      os.put( 0 );
+      ++offset;
+    }
+  }
+
+private:
+  std::ostream& os;
+  std::size_t offset{0u};
+};
+
+class snapshot_reader
+{
+public:
+  snapshot_reader( char const* data, std::size_t size ) : data( data ), size( size ) {}
+
+  template<typename T>
+  bool value( T& v )
+  {
+    if ( size - offset < sizeof( T ) )
+    {
+      return false;
+    }
+    std::memcpy( &v, data + offset, sizeof( T ) );
+    offset += sizeof( T );
+    return true;
+  }
+
+  template<typename T>
+  bool array( std::vector<T>& values )
+  {
+    uint64_t count;
+    if ( !value( count ) || count > ( size - offset ) / sizeof( T ) )
+    {
+      return false;
+    }
+    values.resize( count );
+    return bytes( values.data(), count * sizeof( T ) );
+  }
+
+  bool string( std::string& s )
+  {
+    uint64_t length;
+    if ( !value( length ) || length > size - offset )
+    {
+      return false;
+    }
+    s.assign( data + offset, length );
+    return bytes( nullptr, length );
+  }
+
+  /* copies `count` bytes, unless `dest` is null */
+  bool bytes( void* dest, std::size_t count )
+  {
+    if ( count > size - offset )
+    {
+      return false;
+    }
+    if ( dest != nullptr && count > 0u )
+    {
+      std::memcpy( dest, data + offset, count );
+    }
+    offset += count;
+    offset = std::min( size, ( offset + 7u ) & ~std::size_t( 7u ) );
+    return true;
+  }
+
+private:
+  char const* data;
+  std::size_t size;
+  std::size_t offset{0u};
+};
+
+/* signals are stored as 64-bit words */
+template<typename Signal>
+uint64_t snapshot_signal_data( Signal const& s )
+{
+  if constexpr ( std::is_integral_v<Signal> )
+  {
+    return s;
+  }
+  else
+  {
+    return s.data;
+  }
+}
+
+template<typename Signal>
+Signal snapshot_signal_from_data( uint64_t data )
+{
+  if constexpr ( std::is_integral_v<Signal> )
+  {
+    return static_cast<Signal>( data );
+  }
+  else
+  {
+    Signal s;
+    s.data = data;
+    return s;
+  }
+}
+
+template<typename Signal>
+uint64_t snapshot_signal_index( uint64_t data )
+{
+  if constexpr ( std::is_integral_v<Signal> )
+  {
+    return data;
+  }
+  else
+  {
+    return snapshot_signal_from_data<Signal>( data ).index;
+  }
+}
+
+} /* namespace detail */
+
+/*! \brief Writes a binary snapshot of a network into an output stream.
+ *
+ * The snapshot contains the storage of the network as it is, including
+ * node order, dead nodes, reference counts, latches, the structural hash
+ * table, and for k-LUT networks the truth table cache.  If the network
+ * is wrapped in a `names_view`, the names are stored as well.  Arrays of
+ * fixed-size nodes are dumped in bulk in the byte order of the host.
+ *
+ * The network type is part of the snapshot, and `read_snapshot` rejects
+ * snapshots of other network types.  Snapshots are supported for AIGs,
+ * XAGs, MIGs, XMGs, and k-LUT networks.
+ *
+ * **Required network functions:**
+ * - `foreach_node`
+ * - `make_signal`
+ *
+ * \param ntk Network
+ * \param os Output stream
+ */
+template<class Ntk>
+void write_snapshot( Ntk const& ntk, std::ostream& os )
+{
+  static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
+  static_assert( has_foreach_node_v<Ntk>, "Ntk does not implement the foreach_node method" );
+  static_assert( has_make_signal_v<Ntk>, "Ntk does not implement the make_signal method" );
+  static_assert( detail::snapshot_network_tag<typename Ntk::base_type>::value != nullptr, "Ntk does not support snapshots" );
+
+  using storage_t = typename Ntk::storage::element_type;
+  using node_type = typename storage_t::node_type;
+  auto const& storage = *ntk._storage;
+
+  detail::snapshot_writer writer( os );
+  writer.value<uint32_t>( detail::snapshot_magic );
+  writer.value<uint32_t>( detail::snapshot_version );
+  writer.string( detail::snapshot_network_tag<typename Ntk::base_type>::value );
+  writer.value<uint64_t>( sizeof( node_type ) );
+
+  /* nodes */
+  if constexpr ( std::is_trivially_copyable_v<node_type> )
+  {
+    writer.array( storage.nodes );
+  }
+  else
+  {
+    writer.value<uint64_t>( storage.nodes.size() );
+    for ( auto const& n : storage.nodes )
+    {
+      writer.array( n.children );
+      writer.bytes( n.data.data(), sizeof( n.data ) );
+    }
+  }
+
+  writer.array( storage.inputs );
+  writer.array( storage.outputs );
+
+  /* structural hash table as node indexes */
+  std::vector<uint64_t> hashed;
+  hashed.reserve( storage.hash.size() );
+  for ( auto const& [_, index] : storage.hash )
+  {
+    hashed.push_back( index );
+  }
+  writer.array( hashed );
+
+  /* storage data */
+  writer.value<uint32_t>( storage.data.num_pis );
+  writer.value<uint32_t>( storage.data.num_pos );
+  writer.value<uint32_t>( storage.data.trav_id );
+  writer.array( storage.data.latches );
+
+  writer.value<uint64_t>( storage.latch_information.size() );
+  for ( auto const& [index, info] : storage.latch_information )
+  {
+    writer.value<uint64_t>( index );
+    writer.value<uint64_t>( info.init );
+    writer.string( info.control );
+    writer.string( info.type );
+  }
+
+  if constexpr ( detail::has_truth_table_cache<decltype( storage.data )>::value )
+  {
+    writer.value<uint64_t>( storage.data.cache.size() );
+    for ( auto i = 0u; i < storage.data.cache.size(); ++i )
+    {
+      const auto tt = storage.data.cache[2 * i];
+      writer.value<uint64_t>( tt.num_vars() );
+      writer.array( std::vector<uint64_t>( tt.begin(), tt.end() ) );
+    }
+  }
+
+  /* names */
+  if constexpr ( has_has_name_v<Ntk> && has_get_name_v<Ntk> && has_has_output_name_v<Ntk> && has_get_output_name_v<Ntk> )
+  {
+    std::vector<std::pair<uint64_t, std::string>> names;
+    const auto add_name = [&]( auto const& s ) {
+      if ( ntk.has_name( s ) )
+      {
+        names.emplace_back( static_cast<uint64_t>( detail::snapshot_signal_data( s ) ), ntk.get_name( s ) );
+      }
+    };
+    ntk.foreach_node( [&]( auto const& n ) {
+      add_name( ntk.make_signal( n ) );
+      if constexpr ( !std::is_same_v<typename Ntk::signal, typename Ntk::node> )
+      {
+        add_name( !ntk.make_signal( n ) );
+      }
+    } );
+
+    writer.value<uint64_t>( names.size() );
+    for ( auto const& [data, name] : names )
+    {
+      writer.value<uint64_t>( data );
+      writer.string( name );
+    }
+
+    std::vector<std::pair<uint32_t, std::string>> output_names;
+    for ( auto i = 0u; i < storage.outputs.size(); ++i )
+    {
+      if ( ntk.has_output_name( i ) )
+      {
+        output_names.emplace_back( i, ntk.get_output_name( i ) );
+      }
+    }
+    writer.value<uint64_t>( output_names.size() );
+    for ( auto const& [index, name] : output_names )
+    {
+      writer.value<uint64_t>( index );
+      writer.string( name );
+    }
+  }
+  else
+  {
+    writer.value<uint64_t>( 0u );
+    writer.value<uint64_t>( 0u );
+  }
+}
+
+/*! \brief Writes a binary snapshot of a network into a file.
+ *
+ * \param ntk Network
+ * \param filename Filename
+ */
+template<class Ntk>
+void write_snapshot( Ntk const& ntk, std::string const& filename )
+{
+  std::ofstream os( filename.c_str(), std::ofstream::out | std::ofstream::binary );
+  write_snapshot( ntk, os );
+  os.close();
+}
+
+/*! \brief Reads a binary snapshot of a network.
+ *
+ * Restores a network written by `write_snapshot` with the same network
+ * type.  The storage of `ntk` is replaced, but its event handlers are kept.
+ * If `ntk` is a `names_view`, its names are replaced by the names in the
+ * snapshot.
+ * The file is memory-mapped, and arrays of fixed-size nodes, inputs, and
+ * outputs are copied in bulk without per-node work.  The structural hash
+ * table is rebuilt from the stored node indexes, unless
+ * `ps.rebuild_strash` is false.
+ *
+ * Returns false, if the file cannot be read, is not a snapshot of this
+ * network type, or is malformed; `ntk` is then not modified.
+ *
+ * \param filename Filename
+ * \param ntk Network
+ * \param ps Parameters
+ */
+template<class Ntk>
+bool read_snapshot( std::string const& filename, Ntk& ntk, read_snapshot_params const& ps = {} )
+{
+  static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
+  static_assert( detail::snapshot_network_tag<typename Ntk::base_type>::value != nullptr, "Ntk does not support snapshots" );
+
+  using storage_t = typename Ntk::storage::element_type;
+  using node_type = typename storage_t::node_type;
+  using pointer_type = typename node_type::pointer_type;
+
+  mapped_file file( filename );
+  if ( !file.is_open() )
+  {
+    return false;
+  }
+
+  detail::snapshot_reader reader( file.data(), file.size() );
+
+  uint32_t magic, version;
+  std::string tag;
+  uint64_t node_size;
+  if ( !reader.value( magic ) || magic != detail::snapshot_magic || !reader.value( version ) || version != detail::snapshot_version ||
+       !reader.string( tag ) || tag != detail::snapshot_network_tag<typename Ntk::base_type>::value || !reader.value( node_size ) || node_size != sizeof( node_type ) )
+  {
+    return false;
+  }
+
+  auto storage = std::make_shared<storage_t>();
+
+  if constexpr ( std::is_trivially_copyable_v<node_type> )
+  {
+    if ( !reader.array( storage->nodes ) )
+    {
+      return false;
+    }
+  }
+  else
+  {
+    uint64_t num_nodes;
+    if ( !reader.value( num_nodes ) || num_nodes > file.size() )
+    {
+      return false;
+    }
+    storage->nodes.resize( num_nodes );
+    for ( auto& n : storage->nodes )
+    {
+      if ( !reader.array( n.children ) || !reader.bytes( n.data.data(), sizeof( n.data ) ) )
+      {
+        return false;
+      }
+    }
+  }
+
+  std::vector<uint64_t> hashed;
+  if ( !reader.array( storage->inputs ) || !reader.array( storage->outputs ) || !reader.array( hashed ) )
+  {
+    return false;
+  }
+
+  /* all indexes must refer to nodes; the children of the constant and of
+   * combinational inputs are not indexes */
+  const auto num_nodes = storage->nodes.size();
+  const auto valid_index = [&]( uint64_t index ) { return index < num_nodes; };
+  if ( num_nodes == 0u || !std::all_of( storage->inputs.begin(), storage->inputs.end(), valid_index ) ||
+       !std::all_of( hashed.begin(), hashed.end(), valid_index ) ||
+       !std::all_of( storage->outputs.begin(), storage->outputs.end(), [&]( pointer_type const& p ) { return valid_index( p.index ); } ) )
+  {
+    return false;
+  }
+
+  std::vector<bool> is_gate( num_nodes, true );
+  is_gate[0] = false;
+  for ( auto index : storage->inputs )
+  {
+    is_gate[index] = false;
+  }
+  for ( auto i = 1u; i < num_nodes; ++i )
+  {
+    if ( is_gate[i] && !std::all_of( storage->nodes[i].children.begin(), storage->nodes[i].children.end(), [&]( pointer_type const& p ) { return valid_index( p.index ); } ) )
+    {
+      return false;
+    }
+  }
+
+  /* primary inputs and outputs precede the register outputs and inputs, and
+   * each register input has a latch */
+  uint32_t trav_id;
+  if ( !reader.value( storage->data.num_pis ) || !reader.value( storage->data.num_pos ) || !reader.value( trav_id ) || !reader.array( storage->data.latches ) ||
+       storage->data.num_pis > storage->inputs.size() || storage->data.num_pos > storage->outputs.size() ||
+       storage->data.latches.size() != storage->outputs.size() - storage->data.num_pos )
+  {
+    return false;
+  }
+  storage->data.trav_id = trav_id;
+
+  uint64_t num_latch_infos;
+  if ( !reader.value( num_latch_infos ) )
+  {
+    return false;
+  }
+  for ( auto i = 0u; i < num_latch_infos; ++i )
+  {
+    uint64_t index;
+    latch_info info;
+    if ( !reader.value( index ) || !reader.value( info.init ) || !reader.string( info.control ) || !reader.string( info.type ) )
+    {
+      return false;
+    }
+    storage->latch_information[index] = info;
+  }
+
+  if constexpr ( detail::has_truth_table_cache<decltype( storage->data )>::value )
+  {
+    uint64_t num_functions;
+    if ( !reader.value( num_functions ) )
+    {
+      return false;
+    }
+    for ( auto i = 0u; i < num_functions; ++i )
+    {
+      uint64_t num_vars;
+      std::vector<uint64_t> words;
+      if ( !reader.value( num_vars ) || num_vars > detail::binary_max_truth_table_vars || !reader.array( words ) )
+      {
+        return false;
+      }
+      kitty::dynamic_truth_table tt( static_cast<uint32_t>( num_vars ) );
+      if ( words.size() != tt.num_blocks() )
+      {
+        return false;
+      }
+      std::copy( words.begin(), words.end(), tt.begin() );
+      tt.mask_bits();
+
+      /* cached functions are normal and inserted in the same order */
+      if ( storage->data.cache.insert( tt ) != 2 * i )
+      {
+        return false;
+      }
+    }
+  }
+
+  std::vector<std::pair<uint64_t, std::string>> names;
+  std::vector<std::pair<uint64_t, std::string>> output_names;
+  for ( auto* list : {&names, &output_names} )
+  {
+    uint64_t count;
+    if ( !reader.value( count ) )
+    {
+      return false;
+    }
+    for ( auto i = 0u; i < count; ++i )
+    {
+      auto& [data, name] = list->emplace_back();
+      if ( !reader.value( data ) || !reader.string( name ) )
+      {
+        return false;
+      }
+    }
+  }
+  if ( !std::all_of( names.begin(), names.end(), [&]( auto const& p ) { return valid_index( detail::snapshot_signal_index<typename Ntk::signal>( p.first ) ); } ) ||
+       !std::all_of( output_names.begin(), output_names.end(), [&]( auto const& p ) { return p.first < storage->outputs.size(); } ) )
+  {
+    return false;
+  }
+
+  if ( ps.rebuild_strash )
+  {
+    storage->hash.reserve( hashed.size() );
+    for ( auto index : hashed )
+    {
+      storage->hash[storage->nodes[index]] = index;
+    }
+  }
+
+  ntk._storage = storage;
+
+  if constexpr ( detail::has_clear_names<Ntk>::value )
+  {
+    ntk.clear_names();
+  }
+  if constexpr ( has_set_name_v<Ntk> && has_set_output_name_v<Ntk> )
+  {
+    for ( auto const& [data, name] : names )
+    {
+      ntk.set_name( detail::snapshot_signal_from_data<typename Ntk::signal>( data ), name );
+    }
+    for ( auto const& [index, name] : output_names )
+    {
+      ntk.set_output_name( static_cast<uint32_t>( index ), name );
+    }
+  }
+
+  return true;
+}
+
+} /* namespace mockturtle */
@@ -36,12 +36,16 @@
 
 #pragma once
 
+#include "../networks/aig.hpp"
 #include "../traits.hpp"
+#include "../utils/output_buffer.hpp"
 
+#include <array>
+#include <cstdint>
 #include <fstream>
 #include <iostream>
 #include <string>
-#include <cstdio>
+#include <utility>
 
 namespace mockturtle
 {
@@ -49,17 +53,14 @@ namespace mockturtle
 namespace detail
 {
 
-void encode( std::vector<unsigned char>& buffer, uint32_t lit )
+inline void encode( output_buffer& buffer, uint32_t lit )
 {
-  unsigned char ch;
   while ( lit & ~0x7f )
   {
-    ch = ( lit & 0x7f ) | 0x80;
-    buffer.push_back( ch );
+    buffer << static_cast<char>( ( lit & 0x7f ) | 0x80 );
     lit >>= 7;
   }
-  ch = lit;
-  buffer.push_back( ch );
+  buffer << static_cast<char>( lit );
 }
 
 } /* detail */
@@ -78,7 +79,7 @@ void encode( std::vector<unsigned char>& buffer, uint32_t lit )
  * \param aig Combinational AIG network
  * \param os Output stream
  */
-void write_aiger( aig_network const& aig, std::ostream& os )
+inline void write_aiger( aig_network const& aig, std::ostream& os )
 {
   static_assert( is_network_type_v<aig_network>, "Ntk is not a network type" );
   static_assert( has_num_cis_v<aig_network>, "Ntk does not implement the num_cis method" );
@@ -97,32 +98,28 @@ void write_aiger( aig_network const& aig, std::ostream& os )
   assert( aig.num_latches() == 0u );
   uint32_t const M = aig.num_cis() + aig.num_gates() + aig.num_latches();
 
+  output_buffer buffer( os );
+
   /* HEADER */
-  char string_buffer[1024];
-  sprintf( string_buffer, "aig %u %u %u %u %u\n", M, aig.num_pis(), aig.num_latches(), aig.num_pos(), aig.num_gates() );
-  os.write( &string_buffer[0], sizeof( unsigned char )*strlen( string_buffer ) );
+  buffer << "aig " << M << ' ' << aig.num_pis() << ' ' << aig.num_latches() << ' ' << aig.num_pos() << ' ' << aig.num_gates() << '\n';
 
   /* POs */
   aig.foreach_po( [&]( signal const& f ){
-    sprintf( string_buffer, "%u\n", uint32_t(2*aig.get_node( f ) + aig.is_complemented( f )) );
-    os.write( &string_buffer[0], sizeof( unsigned char )*strlen( string_buffer ) );
+    buffer << uint32_t( 2 * aig.get_node( f ) + aig.is_complemented( f ) ) << '\n';
   });
 
   /* GATES */
-  std::vector<unsigned char> buffer;
   aig.foreach_gate( [&]( node const& n ){
-    std::vector<uint32_t> lits;
-    lits.push_back( 2*n );
+    std::array<uint32_t, 3> lits;
+    lits[0] = uint32_t( 2 * n );
 
-    aig.foreach_fanin( n, [&]( signal const& fi ){
-      lits.push_back( 2*aig.get_node( fi ) + aig.is_complemented( fi ) );
+    aig.foreach_fanin( n, [&]( signal const& fi, auto i ){
+      lits[i + 1] = uint32_t( 2 * aig.get_node( fi ) + aig.is_complemented( fi ) );
     });
 
     if ( lits[1] > lits[2] )
     {
-      auto const tmp = lits[1];
-      lits[1] = lits[2];
-      lits[2] = tmp;
+      std::swap( lits[1], lits[2] );
     }
 
     assert( lits[2] < lits[0] );
@@ -130,13 +127,8 @@ void write_aiger( aig_network const& aig, std::ostream& os )
     detail::encode( buffer, lits[2] - lits[1] );
   });
 
-  for ( const auto& b : buffer )
-  {
-    os.put( b );
-  }
-
   /* COMMENT */
-  os.put( 'c' );
+  buffer << 'c';
 }
 
 /*! \brief Writes a combinational AIG network in binary AIGER format into a file
@@ -153,7 +145,7 @@ void write_aiger( aig_network const& aig, std::ostream& os )
  * \param aig Combinational AIG network
  * \param filename Filename
  */
-void write_aiger( aig_network const& aig, std::string const& filename )
+inline void write_aiger( aig_network const& aig, std::string const& filename )
 {
   std::ofstream os( filename.c_str(), std::ofstream::out );
   write_aiger( aig, os );
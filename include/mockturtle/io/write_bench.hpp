@@ -41,6 +41,7 @@
 #include <kitty/print.hpp>
 
 #include "../traits.hpp"
+#include "../utils/output_buffer.hpp"
 
 namespace mockturtle
 {
@@ -74,19 +75,21 @@ void write_bench( Ntk const& ntk, std::ostream& os )
   static_assert( has_node_to_index_v<Ntk>, "Ntk does not implement the node_to_index method" );
   static_assert( has_node_function_v<Ntk>, "Ntk does not implement the node_function method" );
 
+  output_buffer out( os );
+
   ntk.foreach_pi( [&]( auto const& n ) {
-    os << fmt::format( "INPUT(n{})\n", ntk.node_to_index( n ) );
+    out << "INPUT(n" << ntk.node_to_index( n ) << ")\n";
   } );
 
   for ( auto i = 0u; i < ntk.num_pos(); ++i )
   {
-    os << fmt::format( "OUTPUT(po{})\n", i );
+    out << "OUTPUT(po" << i << ")\n";
   }
 
-  os << fmt::format( "n{} = gnd\n", ntk.node_to_index( ntk.get_node( ntk.get_constant( false ) ) ) );
+  out << 'n' << ntk.node_to_index( ntk.get_node( ntk.get_constant( false ) ) ) << " = gnd\n";
   if ( ntk.get_node( ntk.get_constant( false ) ) != ntk.get_node( ntk.get_constant( true ) ) )
   {
-    os << fmt::format( "n{} = vdd\n", ntk.node_to_index( ntk.get_node( ntk.get_constant( true ) ) ) );
+    out << 'n' << ntk.node_to_index( ntk.get_node( ntk.get_constant( true ) ) ) << " = vdd\n";
   }
 
   ntk.foreach_node( [&]( auto const& n ) {
@@ -94,47 +97,38 @@ void write_bench( Ntk const& ntk, std::ostream& os )
       return; /* continue */
 
     auto func = ntk.node_function( n );
-    std::string children;
-    auto first = true;
     ntk.foreach_fanin( n, [&]( auto const& c, auto i ) {
       if ( ntk.is_complemented( c ) )
       {
         kitty::flip_inplace( func, i );
       }
-      if ( first )
-      {
-        first = false;
-      }
-      else
+    } );
+
+    out << 'n' << ntk.node_to_index( n ) << " = LUT 0x" << kitty::to_hex( func ) << " (";
+    ntk.foreach_fanin( n, [&]( auto const& c, auto i ) {
+      if ( i != 0 )
       {
-        children += ", ";
+        out << ", ";
       }
-
-      children += fmt::format( "n{}", ntk.node_to_index( ntk.get_node( c ) ) );
+      out << 'n' << ntk.node_to_index( ntk.get_node( c ) );
     } );
-
-    os << fmt::format( "n{} = LUT 0x{} ({})\n",
-                       ntk.node_to_index( n ),
-                       kitty::to_hex( func ), children );
+    out << ")\n";
   } );
 
   /* outputs */
   ntk.foreach_po( [&]( auto const& s, auto i ) {
+    out << "po" << i << " = ";
     if ( ntk.is_constant( ntk.get_node( s ) ) )
     {
-      os << fmt::format( "po{} = {}\n",
-                         i,
-                         ( ntk.constant_value( ntk.get_node( s ) ) ^ ntk.is_complemented( s ) ) ? "vdd" : "gnd" );
+      out << ( ( ntk.constant_value( ntk.get_node( s ) ) ^ ntk.is_complemented( s ) ) ? "vdd\n" : "gnd\n" );
     }
     else
     {
-      os << fmt::format( "po{} = LUT 0x{} (n{})\n",
-                         i,
-                         ntk.is_complemented( s ) ? 1 : 2,
-                         ntk.node_to_index( ntk.get_node( s ) ) );
+      out << "LUT 0x" << ( ntk.is_complemented( s ) ? '1' : '2' ) << " (n" << ntk.node_to_index( ntk.get_node( s ) ) << ")\n";
     }
   } );
 
+  out.flush();
   os << std::flush;
 }
 
@@ -33,6 +33,8 @@
 #pragma once
 
 #include "../traits.hpp"
+#include "../networks/storage.hpp"
+#include "../utils/output_buffer.hpp"
 #include "../views/topo_view.hpp"
 
 #include <kitty/constructors.hpp>
@@ -91,14 +93,20 @@ void write_blif( Ntk const& ntk, std::ostream& os, write_blif_params const& ps =
   static_assert( has_node_function_v<Ntk>, "Ntk does not implement the node_function method" );
 
   topo_view topo_ntk{ntk};
+  output_buffer out( os );
+
+  /* writes the name of a node that has no name in a names_view */
+  const auto write_default_name = [&]( auto const& n ) {
+    out << ( topo_ntk.is_pi( n ) ? "pi" : "new_n" ) << n;
+  };
 
   /* write model */
-  os << ".model top\n";
+  out << ".model top\n";
 
   /* write inputs */
   if ( topo_ntk.num_pis() > 0u )
   {
-    os << ".inputs ";
+    out << ".inputs ";
     topo_ntk.foreach_ci( [&]( auto const& n, auto index ) 
     {
       if ( ( ( index + 1 ) <= topo_ntk.num_cis() - topo_ntk.num_latches() ) ) 
@@ -106,22 +114,29 @@ void write_blif( Ntk const& ntk, std::ostream& os, write_blif_params const& ps =
         if constexpr ( has_has_name_v<Ntk> && has_get_name_v<Ntk> )
         {
           signal<Ntk> const s = topo_ntk.make_signal( topo_ntk.node_to_index( n ) );
-          std::string const name = topo_ntk.has_name( s ) ? topo_ntk.get_name( s ) : fmt::format( "pi{}", topo_ntk.get_node( s ) );
-          os << name << ' ';
+          if ( topo_ntk.has_name( s ) )
+          {
+            out << topo_ntk.get_name( s );
+          }
+          else
+          {
+            out << "pi" << topo_ntk.get_node( s );
+          }
+          out << ' ';
         }
         else
         {
-          os << fmt::format( "pi{} ", topo_ntk.node_to_index( n ) );
+          out << "pi" << topo_ntk.node_to_index( n ) << ' ';
         }
       }
     } );
-    os << "\n";
+    out << "\n";
   }
 
   /* write outputs */
   if ( topo_ntk.num_pos() > 0u )
   {
-    os << ".outputs ";
+    out << ".outputs ";
     topo_ntk.foreach_co( [&]( auto const& f, auto index ) 
     {
       (void)f;
@@ -129,16 +144,23 @@ void write_blif( Ntk const& ntk, std::ostream& os, write_blif_params const& ps =
       {
         if constexpr ( has_has_output_name_v<Ntk> && has_get_output_name_v<Ntk> )
         {
-          std::string const output_name = topo_ntk.has_output_name( index ) ? topo_ntk.get_output_name( index ) : fmt::format( "po{}", index );
-          os << output_name << ' ';
+          if ( topo_ntk.has_output_name( index ) )
+          {
+            out << topo_ntk.get_output_name( index );
+          }
+          else
+          {
+            out << "po" << index;
+          }
+          out << ' ';
         }
         else
         {
-          os << fmt::format( "po{} ", index );
+          out << "po" << index << ' ';
         }
       }
     } );
-    os << "\n";
+    out << "\n";
   }
 
   if ( topo_ntk.num_latches() > 0u )
@@ -148,32 +170,33 @@ void write_blif( Ntk const& ntk, std::ostream& os, write_blif_params const& ps =
     {
       if( index >= topo_ntk.num_cos() - topo_ntk.num_latches() ) 
       {
-        os << ".latch ";
+        out << ".latch ";
         auto const ro_sig = topo_ntk.make_signal( topo_ntk.ri_to_ro( f ) );
-        mockturtle::latch_info l_info = topo_ntk._storage->latch_information[topo_ntk.get_node(ro_sig)];
+        latch_info const& l_info = topo_ntk._storage->latch_information[topo_ntk.get_node(ro_sig)];
         if constexpr ( has_has_name_v<Ntk> && has_get_name_v<Ntk> )
         {
           std::string const ri_name = topo_ntk.has_output_name( index ) ? topo_ntk.get_output_name( index ) : fmt::format( "new_n{}", topo_ntk.get_node( f ) );
           std::string const ro_name = topo_ntk.has_name( ro_sig ) ? topo_ntk.get_name( ro_sig ) : fmt::format( "new_n{}", topo_ntk.get_node( ro_sig ) );
-          os << fmt::format( "{} {} {} {} {}\n", ri_name, ro_name, l_info.type, l_info.control, l_info.init);
+          out << ri_name << ' ' << ro_name << ' ';
         }
         else
         {
-          os << fmt::format( "li{} new_n{} {} {} {}\n", latch_idx, topo_ntk.get_node( ro_sig ), l_info.type, l_info.control, l_info.init );
+          out << "li" << latch_idx << " new_n" << topo_ntk.get_node( ro_sig ) << ' ';
           latch_idx++;
         }
+        out << l_info.type << ' ' << l_info.control << ' ' << l_info.init << '\n';
       }
     } );
   }
 
   /* write constants */
-  os << ".names new_n0\n";
-  os << "0\n";
+  out << ".names new_n0\n";
+  out << "0\n";
 
   if ( topo_ntk.get_constant( false ) != topo_ntk.get_constant( true ) ) 
   {
-    os << ".names new_n1\n";
-    os << "1\n";
+    out << ".names new_n1\n";
+    out << "1\n";
   }
 
   /* write nodes */
@@ -184,26 +207,32 @@ void write_blif( Ntk const& ntk, std::ostream& os, write_blif_params const& ps =
       return; /* continue */
 
     /* write truth table of node */
-    auto func = topo_ntk.node_function( n );
+    const auto cubes = isop( topo_ntk.node_function( n ) );
 
-    if(isop( func ).size() == 0) 
+    if ( cubes.empty() )
     {
+      out << ".names ";
       if constexpr ( has_has_name_v<Ntk> && has_get_name_v<Ntk> )
       {
         auto const s = topo_ntk.make_signal( n );
-        std::string const name = topo_ntk.has_name( s ) ? topo_ntk.get_name( s ) : fmt::format( "new_n{}", topo_ntk.get_node( s ) );
-        os << fmt::format( ".names {}\n", name );
-        os << "0" << '\n';
+        if ( topo_ntk.has_name( s ) )
+        {
+          out << topo_ntk.get_name( s );
+        }
+        else
+        {
+          out << "new_n" << topo_ntk.get_node( s );
+        }
       }
       else
       {
-        os << fmt::format( ".names new_n{}\n", n );
-        os << "0" << '\n';
+        out << "new_n" << n;
       }
+      out << "\n0\n";
       return;
     }
 
-    os << fmt::format( ".names " );
+    out << ".names ";
 
     /* write fanins of node */
     topo_ntk.foreach_fanin( n, [&]( auto const& f ) 
@@ -212,13 +241,21 @@ void write_blif( Ntk const& ntk, std::ostream& os, write_blif_params const& ps =
       if constexpr ( has_has_name_v<Ntk> && has_get_name_v<Ntk> )
       {
         signal<Ntk> const s = topo_ntk.make_signal( f_node );
-        std::string const name = topo_ntk.has_name( s ) ? topo_ntk.get_name( s ) : topo_ntk.is_pi( f_node ) ? fmt::format( "pi{} ", f_node ) : fmt::format( "new_n{} ", f_node );
-        os << name << ' ';
+        if ( topo_ntk.has_name( s ) )
+        {
+          out << topo_ntk.get_name( s );
+        }
+        else
+        {
+          write_default_name( f_node );
+          out << ' ';
+        }
+        out << ' ';
       }
       else
       {
-        std::string const name = topo_ntk.is_pi( f_node ) ? fmt::format( "pi{} ", f_node ) : fmt::format( "new_n{} ", f_node );
-        os << name;
+        write_default_name( f_node );
+        out << ' ';
       }
     });
 
@@ -226,17 +263,23 @@ void write_blif( Ntk const& ntk, std::ostream& os, write_blif_params const& ps =
     if constexpr ( has_has_name_v<Ntk> && has_get_name_v<Ntk> )
     {
       auto const s = topo_ntk.make_signal( n );
-      std::string const name = topo_ntk.has_name( s ) ? topo_ntk.get_name( s ) : fmt::format( "new_n{}", topo_ntk.get_node( s ) );
-      os << name << '\n';
+      if ( topo_ntk.has_name( s ) )
+      {
+        out << topo_ntk.get_name( s );
+      }
+      else
+      {
+        out << "new_n" << topo_ntk.get_node( s );
+      }
+      out << '\n';
     }
     else
     {
-      os << fmt::format( "new_n{}\n", n );
+      out << "new_n" << n << '\n';
     }
 
-
-    int count = 0;
-    for ( auto cube : isop( func ) )
+    const auto num_fanins = topo_ntk.fanin_size( n );
+    for ( auto cube : cubes )
     {
       topo_ntk.foreach_fanin( n, [&]( auto const& f, auto index ) 
       {
@@ -244,9 +287,11 @@ void write_blif( Ntk const& ntk, std::ostream& os, write_blif_params const& ps =
           cube.flip_bit( index );
       });
 
-      cube.print( topo_ntk.fanin_size( n ), os );
-      os << " 1\n";
-      count++;
+      for ( auto i = 0u; i < num_fanins; ++i )
+      {
+        out << ( cube.get_mask( i ) ? ( cube.get_bit( i ) ? '1' : '0' ) : '-' );
+      }
+      out << " 1\n";
     }
   } );
 
@@ -261,28 +306,32 @@ void write_blif( Ntk const& ntk, std::ostream& os, write_blif_params const& ps =
       std::string const node_name = topo_ntk.has_name( s ) ? topo_ntk.get_name( s ) : fmt::format( "new_n{}", topo_ntk.get_node( s ) );
       std::string const output_name = topo_ntk.has_output_name( index ) ? topo_ntk.get_output_name( index ) : fmt::format( "po{}", index );
       if(!ps.skip_feedthrough || ( node_name != output_name ) )
-        os << fmt::format( ".names {} {}\n{} 1\n", node_name, output_name, minterm_string, index );
+        out << ".names " << node_name << ' ' << output_name << '\n' << minterm_string << " 1\n";
     }
     else
     {
       if( index >= topo_ntk.num_cos() - topo_ntk.num_latches() ) 
       {
         if(!ps.skip_feedthrough || ( topo_ntk.get_node( f ) != index)){
-          os << fmt::format( ".names new_n{} li{}\n{} 1\n", f_node, latch_idx, minterm_string );
+          out << ".names new_n" << f_node << " li" << latch_idx << '\n' << minterm_string << " 1\n";
           latch_idx++;
         }
       }
       else
       {
-        std::string const node_name = topo_ntk.is_pi( f_node ) ? fmt::format( "pi{}", f_node ) : fmt::format( "new_n{}", f_node );
         if(!ps.skip_feedthrough ||  ( topo_ntk.get_node( f ) != index ) )
-          os << fmt::format( ".names {} po{}\n{} 1\n", node_name, index, minterm_string );
+        {
+          out << ".names ";
+          write_default_name( f_node );
+          out << " po" << index << '\n' << minterm_string << " 1\n";
+        }
       }
       
     }
   } );
 
-  os << ".end\n";
+  out << ".end\n";
+  out.flush();
   os << std::flush;
 }
 
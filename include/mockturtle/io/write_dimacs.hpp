@@ -32,52 +32,277 @@
 
 #pragma once
 
+#include <cassert>
 #include <cstdint>
 #include <fstream>
+#include <initializer_list>
 #include <iostream>
-#include <sstream>
 #include <string>
-
-#include <fmt/format.h>
+#include <vector>
 
 #include "../traits.hpp"
 #include "../algorithms/cnf.hpp"
+#include "../utils/node_map.hpp"
+#include "../utils/output_buffer.hpp"
 
 namespace mockturtle
 {
 
+/*! \brief Parameters for write_dimacs.
+ *
+ * The data structure `write_dimacs_params` holds configurable parameters with
+ * default arguments for `write_dimacs`.
+ */
+struct write_dimacs_params
+{
+  /*! \brief Indexes of the outputs whose cone of influence is written.
+   *
+   * If empty, all gates and all outputs are written.  Otherwise, only the
+   * gates in the transitive fanin of these outputs are written, and only
+   * these outputs get unit clauses.
+   */
+  std::vector<uint32_t> outputs;
+};
+
+/*! \brief Statistics for write_dimacs. */
+struct write_dimacs_stats
+{
+  /*! \brief Number of variables in the header. */
+  uint64_t num_variables{0};
+
+  /*! \brief Number of clauses. */
+  uint64_t num_clauses{0};
+};
+
+namespace detail
+{
+
+/* clause function that counts clauses */
+struct dimacs_clause_counter
+{
+  void operator()( std::initializer_list<uint32_t> ) { ++num_clauses; }
+  void operator()( std::vector<uint32_t> const& ) { ++num_clauses; }
+
+  uint64_t num_clauses{0};
+};
+
+/* clause function that writes clauses */
+struct dimacs_clause_writer
+{
+  void operator()( std::initializer_list<uint32_t> clause ) { write( clause.begin(), clause.end() ); }
+  void operator()( std::vector<uint32_t> const& clause ) { write( clause.begin(), clause.end() ); }
+
+  template<class Iterator>
+  void write( Iterator begin, Iterator end )
+  {
+    for ( auto it = begin; it != end; ++it )
+    {
+      if ( *it & 1 )
+      {
+        out << '-';
+      }
+      out << ( *it >> 1 ) + 1u << ' ';
+    }
+    out << "0\n";
+  }
+
+  output_buffer& out;
+};
+
+template<class Ntk>
+class write_dimacs_impl
+{
+public:
+  write_dimacs_impl( Ntk const& ntk, std::ostream& os, write_dimacs_params const& ps, write_dimacs_stats& st )
+      : ntk( ntk ), os( os ), ps( ps ), st( st ), node_lits( ntk )
+  {
+  }
+
+  void run()
+  {
+    const auto num_variables = assign_literals();
+
+    /* first pass: count the clauses */
+    detail::dimacs_clause_counter counter;
+    counter( {lit_not( node_lits[ntk.get_constant( false )] )} );
+    foreach_selected_gate( [&]( auto const& n ) {
+      detail::generate_gate_cnf( ntk, n, node_lits, child_lits, counter );
+    } );
+    foreach_selected_output( [&]( auto const& ) {
+      ++counter.num_clauses;
+    } );
+
+    st.num_variables = num_variables;
+    st.num_clauses = counter.num_clauses;
+
+    /* second pass: write the clauses */
+    output_buffer out( os );
+    out << "p cnf " << st.num_variables << ' ' << st.num_clauses << '\n';
+
+    detail::dimacs_clause_writer writer{out};
+    writer( {lit_not( node_lits[ntk.get_constant( false )] )} );
+    foreach_selected_gate( [&]( auto const& n ) {
+      detail::generate_gate_cnf( ntk, n, node_lits, child_lits, writer );
+    } );
+    foreach_selected_output( [&]( auto const& f ) {
+      writer( {lit_not_cond( node_lits[f], ntk.is_complemented( f ) )} );
+    } );
+  }
+
+private:
+  /* returns the number of variables in the header */
+  uint32_t assign_literals()
+  {
+    if ( !ps.outputs.empty() )
+    {
+      mark_cone();
+    }
+
+    /* same numbering as node_literals, restricted to the selected gates */
+    node_lits[ntk.get_constant( false )] = make_lit( 0 );
+    if ( ntk.get_node( ntk.get_constant( false ) ) != ntk.get_node( ntk.get_constant( true ) ) )
+    {
+      node_lits[ntk.get_constant( true )] = make_lit( 0, true );
+    }
+    ntk.foreach_pi( [&]( auto const& n, auto i ) {
+      node_lits[n] = make_lit( i + 1 );
+    } );
+    uint32_t next_var = ntk.num_pis() + 1;
+    foreach_selected_gate( [&]( auto const& n ) {
+      node_lits[n] = make_lit( next_var++ );
+    } );
+    return next_var;
+  }
+
+  /* marks the cone of influence of the selected outputs; the marks are
+   * kept here, such that the network needs no traversal IDs */
+  void mark_cone()
+  {
+    std::vector<signal<Ntk>> pos;
+    ntk.foreach_po( [&]( auto const& f ) {
+      pos.push_back( f );
+    } );
+
+    in_cone.assign( ntk.size(), 0u );
+    std::vector<node<Ntk>> stack;
+    for ( auto index : ps.outputs )
+    {
+      assert( index < pos.size() );
+      selected_outputs.push_back( pos[index] );
+      stack.push_back( ntk.get_node( pos[index] ) );
+    }
+    while ( !stack.empty() )
+    {
+      const auto n = stack.back();
+      stack.pop_back();
+      if ( in_cone[ntk.node_to_index( n )] )
+      {
+        continue;
+      }
+      in_cone[ntk.node_to_index( n )] = 1u;
+      ntk.foreach_fanin( n, [&]( auto const& f ) {
+        stack.push_back( ntk.get_node( f ) );
+      } );
+    }
+  }
+
+  template<class Fn>
+  void foreach_selected_gate( Fn&& fn ) const
+  {
+    if ( ps.outputs.empty() )
+    {
+      ntk.foreach_gate( fn );
+    }
+    else
+    {
+      ntk.foreach_gate( [&]( auto const& n ) {
+        if ( in_cone[ntk.node_to_index( n )] )
+        {
+          fn( n );
+        }
+      } );
+    }
+  }
+
+  template<class Fn>
+  void foreach_selected_output( Fn&& fn ) const
+  {
+    if ( ps.outputs.empty() )
+    {
+      ntk.foreach_po( fn );
+    }
+    else
+    {
+      for ( auto const& f : selected_outputs )
+      {
+        fn( f );
+      }
+    }
+  }
+
+private:
+  Ntk const& ntk;
+  std::ostream& os;
+  write_dimacs_params const& ps;
+  write_dimacs_stats& st;
+
+  node_map<uint32_t, Ntk> node_lits;
+  std::vector<uint32_t> child_lits;
+  std::vector<uint8_t> in_cone;
+  std::vector<signal<Ntk>> selected_outputs;
+};
+
+} // namespace detail
+
 /*! \brief Writes network into CNF DIMACS format
  *
  * It also adds unit clauses for the outputs.  Therefore a satisfying solution
  * is one that makes all outputs 1.
  *
+ * The CNF is written in two passes over the network: the first one counts
+ * the clauses for the header and the second one writes them to the stream
+ * through a buffer.  No clauses are kept in memory.  If `ps.outputs` is not
+ * empty, only the cone of influence of these outputs is written; the
+ * variables of the primary inputs are the same as for the whole network.
+ *
+ * **Required network functions:**
+ * - `num_pis`
+ * - `get_constant`
+ * - `foreach_gate`
+ * - `foreach_fanin`
+ * - `foreach_po`
+ * - `foreach_pi`
+ * - `get_node`
+ * - `is_complemented`
+ * - `node_function`
+ *
  * \param ntk Logic network
  * \param out Output stream
+ * \param ps Parameters
+ * \param pst Statistics
  */
 template<class Ntk>
-void write_dimacs( Ntk const& ntk, std::ostream& out = std::cout )
+void write_dimacs( Ntk const& ntk, std::ostream& out = std::cout, write_dimacs_params const& ps = {}, write_dimacs_stats* pst = nullptr )
 {
-  std::stringstream clauses;
-  uint32_t num_clauses = 0u;
-
-  const auto lits = generate_cnf( ntk, [&]( std::vector<uint32_t> const& clause ) {
-    for ( auto lit : clause ) {
-      const auto var = ( lit / 2 ) + 1;
-      const auto pol = lit % 2;
-      clauses << fmt::format( "{}{} ", pol ? "-" : "", var );
-    }
-    clauses << fmt::format( "0\n" );
-    ++num_clauses;
-  } );
-
-  for ( auto lit : lits ) {
-    const auto var = ( lit / 2 ) + 1;
-    const auto pol = lit % 2;
-    clauses << fmt::format( "{}{} 0\n", pol ? "-" : "", var );
-    ++num_clauses;
-  }
+  static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
+  static_assert( has_num_pis_v<Ntk>, "Ntk does not implement the num_pis method" );
+  static_assert( has_get_constant_v<Ntk>, "Ntk does not implement the get_constant method" );
+  static_assert( has_foreach_gate_v<Ntk>, "Ntk does not implement the foreach_gate method" );
+  static_assert( has_foreach_fanin_v<Ntk>, "Ntk does not implement the foreach_fanin method" );
+  static_assert( has_foreach_po_v<Ntk>, "Ntk does not implement the foreach_po method" );
+  static_assert( has_foreach_pi_v<Ntk>, "Ntk does not implement the foreach_pi method" );
+  static_assert( has_get_node_v<Ntk>, "Ntk does not implement the get_node method" );
+  static_assert( has_is_complemented_v<Ntk>, "Ntk does not implement the is_complemented method" );
+  static_assert( has_node_function_v<Ntk>, "Ntk does not implement the node_function method" );
+
+  write_dimacs_stats st;
+  detail::write_dimacs_impl<Ntk> impl( ntk, out, ps, st );
+  impl.run();
 
-  out << fmt::format( "p cnf {} {}\n{}", ntk.size(), num_clauses, clauses.str() );
+  if ( pst )
+  {
+    *pst = st;
+  }
 }
 
 /*! \brief Writes network into CNF DIMACS format
@@ -87,12 +312,14 @@ void write_dimacs( Ntk const& ntk, std::ostream& out = std::cout )
  *
  * \param ntk Logic network
  * \param filename Filename
+ * \param ps Parameters
+ * \param pst Statistics
  */
 template<class Ntk>
-void write_dimacs( Ntk const& ntk, std::string const& filename )
+void write_dimacs( Ntk const& ntk, std::string const& filename, write_dimacs_params const& ps = {}, write_dimacs_stats* pst = nullptr )
 {
   std::ofstream os( filename.c_str(), std::ofstream::out );
-  write_dimacs( ntk, os );
+  write_dimacs( ntk, os, ps, pst );
   os.close();
 }
 
@@ -36,12 +36,13 @@
 #include <fstream>
 #include <iostream>
 #include <memory>
-#include <sstream>
 #include <string>
+#include <vector>
 
 #include <fmt/format.h>
 
 #include "../traits.hpp"
+#include "../utils/output_buffer.hpp"
 #include "../views/depth_view.hpp"
 
 namespace mockturtle
@@ -323,44 +324,18 @@ void write_dot( Ntk const& ntk, std::ostream& os, Drawer const& drawer = {} )
   static_assert( has_foreach_fanin_v<Ntk>, "Ntk does not implement the foreach_fanin method" );
   static_assert( has_foreach_po_v<Ntk>, "Ntk does not implement the foreach_po method" );
 
-  std::stringstream nodes, edges, levels;
+  output_buffer out( os );
+  out << "digraph {\n"
+      << "rankdir=BT;\n";
 
   std::vector<std::vector<uint32_t>> level_to_node_indexes;
 
+  /* nodes are written first, followed by edges and levels */
   ntk.foreach_node( [&]( auto const& n ) {
-    nodes << fmt::format( "{} [label=\"{}\",shape={},style=filled,fillcolor={}]\n",
-                          ntk.node_to_index( n ),
-                          drawer.node_label( ntk, n ),
-                          drawer.node_shape( ntk, n ),
-                          drawer.node_fillcolor( ntk, n ) );
-    if ( !ntk.is_constant( n ) && !ntk.is_pi( n ) )
-    {
-      /* for img_network drawing, modified by Zhufei */
-      if( ntk.node_function( n )._bits[0] == 0xd )
-      {
-       ntk.foreach_fanin( n, [&]( auto const& f, auto j ) {
-          if ( !drawer.draw_signal( ntk, n, f ) )
-          return true;
-          edges << fmt::format( "{} -> {} [color={}]\n",
-              ntk.node_to_index( ntk.get_node( f ) ),
-              ntk.node_to_index( n ),
-              j == 0 ? "red" : "black" );
-          return true;
-          } );
-      }
-      else
-      {
-       ntk.foreach_fanin( n, [&]( auto const& f ) {
-          if ( !drawer.draw_signal( ntk, n, f ) )
-          return true;
-          edges << fmt::format( "{} -> {} [style={}]\n",
-              ntk.node_to_index( ntk.get_node( f ) ),
-              ntk.node_to_index( n ),
-              drawer.signal_style( ntk, f ) );
-          return true;
-          } );
-      }
-    }
+    out << ntk.node_to_index( n )
+        << " [label=\"" << drawer.node_label( ntk, n )
+        << "\",shape=" << drawer.node_shape( ntk, n )
+        << ",style=filled,fillcolor=" << drawer.node_fillcolor( ntk, n ) << "]\n";
 
     const auto lvl = drawer.node_level( ntk, n );
     if ( level_to_node_indexes.size() <= lvl )
@@ -369,28 +344,61 @@ void write_dot( Ntk const& ntk, std::ostream& os, Drawer const& drawer = {} )
     }
     level_to_node_indexes[lvl].push_back( ntk.node_to_index( n ) );
   } );
+  ntk.foreach_po( [&]( auto const& f, auto i ) {
+    (void)f;
+    out << "po" << i << " [shape=" << drawer.po_shape( ntk, i ) << ",style=filled,fillcolor=" << drawer.po_fillcolor( ntk, i ) << "]\n";
+  } );
+
+  ntk.foreach_node( [&]( auto const& n ) {
+    if ( ntk.is_constant( n ) || ntk.is_pi( n ) )
+    {
+      return;
+    }
+
+    /* for img_network drawing, modified by Zhufei */
+    if( ntk.node_function( n )._bits[0] == 0xd )
+    {
+     ntk.foreach_fanin( n, [&]( auto const& f, auto j ) {
+        if ( !drawer.draw_signal( ntk, n, f ) )
+        return true;
+        out << ntk.node_to_index( ntk.get_node( f ) ) << " -> " << ntk.node_to_index( n )
+            << " [color=" << ( j == 0 ? "red" : "black" ) << "]\n";
+        return true;
+        } );
+    }
+    else
+    {
+     ntk.foreach_fanin( n, [&]( auto const& f ) {
+        if ( !drawer.draw_signal( ntk, n, f ) )
+        return true;
+        out << ntk.node_to_index( ntk.get_node( f ) ) << " -> " << ntk.node_to_index( n )
+            << " [style=" << drawer.signal_style( ntk, f ) << "]\n";
+        return true;
+        } );
+    }
+  } );
+  ntk.foreach_po( [&]( auto const& f, auto i ) {
+    out << ntk.node_to_index( ntk.get_node( f ) ) << " -> po" << i << " [style=" << drawer.signal_style( ntk, f ) << "]\n";
+  } );
 
   for ( auto const& indexes : level_to_node_indexes )
   {
-    levels << "{rank = same; ";
-    std::copy( indexes.begin(), indexes.end(), std::ostream_iterator<uint32_t>( levels, "; " ) );
-    levels << "}\n";
+    out << "{rank = same; ";
+    for ( auto index : indexes )
+    {
+      out << index << "; ";
+    }
+    out << "}\n";
   }
 
-  levels << "{rank = same; ";
+  out << "{rank = same; ";
   ntk.foreach_po( [&]( auto const& f, auto i ) {
-    nodes << fmt::format( "po{} [shape={},style=filled,fillcolor={}]\n", i, drawer.po_shape( ntk, i ), drawer.po_fillcolor( ntk, i ) );
-    edges << fmt::format( "{} -> po{} [style={}]\n",
-                          ntk.node_to_index( ntk.get_node( f ) ),
-                          i,
-                          drawer.signal_style( ntk, f ) );
-    levels << fmt::format( "po{}; ", i );
+    (void)f;
+    out << "po" << i << "; ";
   } );
-  levels << "}\n";
+  out << "}\n";
 
-  os << "digraph {\n"
-     << "rankdir=BT;\n"
-     << nodes.str() << edges.str() << levels.str() << "}\n";
+  out << "}\n";
 }
 
 /*! \brief Writes network in DOT format into a file
@@ -41,6 +41,7 @@
 #include <kitty/print.hpp>
 
 #include "../algorithms/simulation.hpp"
+#include "binary_patterns.hpp"
 
 namespace mockturtle
 {
@@ -83,4 +84,37 @@ void write_patterns( Simulator const& sim, std::string const& filename )
   os.close();
 }
 
+/*! \brief Writes simulation patterns in binary format
+ *
+ * The file can be read with the `partial_simulator` constructor and
+ * extended with `append_binary_patterns`.
+ *
+ * \param sim The `partial_simulator` or `bit_packed_simulator` object containing simulation patterns
+ * \param filename Filename
+ */
+template<class Simulator>
+bool write_binary_patterns( Simulator const& sim, std::string const& filename )
+{
+  static_assert( std::is_same_v<Simulator, partial_simulator> || std::is_same_v<Simulator, bit_packed_simulator>, "This function is specialized for partial_simulator or bit_packed_simulator" );
+
+  return write_binary_patterns( sim.get_patterns(), filename );
+}
+
+/*! \brief Appends simulation patterns to a file in binary format
+ *
+ * Appends the patterns from index `first_pattern` on, e.g., the
+ * counter-examples added after `sim` was loaded from the same file.
+ *
+ * \param sim The `partial_simulator` or `bit_packed_simulator` object containing simulation patterns
+ * \param filename Filename
+ * \param first_pattern Index of the first pattern to append
+ */
+template<class Simulator>
+bool append_binary_patterns( Simulator const& sim, std::string const& filename, uint32_t first_pattern )
+{
+  static_assert( std::is_same_v<Simulator, partial_simulator> || std::is_same_v<Simulator, bit_packed_simulator>, "This function is specialized for partial_simulator or bit_packed_simulator" );
+
+  return append_binary_patterns( sim.get_patterns(), filename, first_pattern );
+}
+
 } /* namespace mockturtle */
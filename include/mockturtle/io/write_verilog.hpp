@@ -36,12 +36,14 @@
 #include <fstream>
 #include <iostream>
 #include <string>
+#include <string_view>
+#include <vector>
 
-#include <lorina/verilog.hpp>
 #include <fmt/format.h>
 
 #include "../traits.hpp"
 #include "../utils/node_map.hpp"
+#include "../utils/output_buffer.hpp"
 #include "../utils/string_utils.hpp"
 #include "../views/topo_view.hpp"
 
@@ -54,14 +56,79 @@ namespace detail
 {
 
 template<class Ntk>
-std::vector<std::pair<bool, std::string>>
-format_fanin( Ntk const& ntk, node<Ntk> const& n, node_map<std::string, Ntk>& node_names )
+class verilog_name_writer
 {
-  std::vector<std::pair<bool, std::string>> children;
-  ntk.foreach_fanin( n, [&]( auto const& f ) {
-      children.emplace_back( std::make_pair( ntk.is_complemented( f ), node_names[f] ) );
-    });
-  return children;
+public:
+  verilog_name_writer( Ntk const& ntk, std::vector<std::string> const& xs )
+      : ntk( ntk ), xs( xs ), pi_indexes( ntk )
+  {
+    ntk.foreach_pi( [&]( auto const& n, auto i ) {
+      pi_indexes[n] = static_cast<uint32_t>( i );
+    } );
+  }
+
+  /* writes `~name` or `name` without building a string */
+  void operator()( output_buffer& out, signal<Ntk> const& f ) const
+  {
+    if ( ntk.is_complemented( f ) )
+    {
+      out << '~';
+    }
+    (*this)( out, ntk.get_node( f ) );
+  }
+
+  void operator()( output_buffer& out, node<Ntk> const& n ) const
+  {
+    if ( n == ntk.get_node( ntk.get_constant( false ) ) )
+    {
+      out << "1'b0";
+    }
+    else if ( n == ntk.get_node( ntk.get_constant( true ) ) )
+    {
+      out << "1'b1";
+    }
+    else if ( ntk.is_pi( n ) )
+    {
+      out << xs[pi_indexes[n]];
+    }
+    else
+    {
+      out << 'n' << ntk.node_to_index( n );
+    }
+  }
+
+private:
+  Ntk const& ntk;
+  std::vector<std::string> const& xs;
+  node_map<uint32_t, Ntk> pi_indexes;
+};
+
+template<class Ntk>
+void write_verilog_assign( output_buffer& out, verilog_name_writer<Ntk> const& name, Ntk const& ntk, node<Ntk> const& n, std::string_view op )
+{
+  out << "  assign ";
+  name( out, n );
+  out << " = ";
+  ntk.foreach_fanin( n, [&]( auto const& f, auto i ) {
+    if ( i != 0 )
+    {
+      out << ' ' << op << ' ';
+    }
+    name( out, f );
+  } );
+  out << " ;\n";
+}
+
+inline void write_verilog_names( output_buffer& out, std::vector<std::string> const& names, std::string_view sep )
+{
+  for ( auto i = 0u; i < names.size(); ++i )
+  {
+    if ( i != 0 )
+    {
+      out << sep;
+    }
+    out << names[i];
+  }
 }
 
 } // namespace detail
@@ -169,48 +236,53 @@ void write_verilog( Ntk const& ntk, std::ostream& os, write_verilog_params const
     }
   }
 
-  std::vector<std::string> ws;
-  ntk.foreach_gate( [&]( auto const& n ) {
-    ws.emplace_back( fmt::format( "n{}", ntk.node_to_index( n ) ) );
-  } );
+  output_buffer out( os );
+  out << "module " << ps.module_name << "( ";
+  detail::write_verilog_names( out, inputs, " , " );
+  if ( !inputs.empty() && !outputs.empty() )
+  {
+    out << " , ";
+  }
+  detail::write_verilog_names( out, outputs, " , " );
+  out << " );\n";
 
-  lorina::verilog_writer writer( os );
-  writer.on_module_begin( ps.module_name, inputs, outputs );
   if ( ps.input_names.empty() )
   {
-    writer.on_input( xs );
+    out << "  input ";
+    detail::write_verilog_names( out, xs, " , " );
+    out << " ;\n";
   }
   else
   {
     for ( auto const& [name, width] : ps.input_names )
     {
-      writer.on_input( width, name );
+      out << "  input [" << ( width - 1 ) << ":0] " << name << " ;\n";
     }
   }
   if ( ps.output_names.empty() )
   {
-    writer.on_output( ys );
+    out << "  output ";
+    detail::write_verilog_names( out, ys, " , " );
+    out << " ;\n";
   }
   else
   {
     for ( auto const& [name, width] : ps.output_names )
     {
-      writer.on_output( width, name );
+      out << "  output [" << ( width - 1 ) << ":0] " << name << " ;\n";
     }
   }
-  if ( !ws.empty() )
+  bool has_wires{false};
+  ntk.foreach_gate( [&]( auto const& n ) {
+    out << ( has_wires ? " , " : "  wire " ) << 'n' << ntk.node_to_index( n );
+    has_wires = true;
+  } );
+  if ( has_wires )
   {
-    writer.on_wire( ws );
+    out << " ;\n";
   }
 
-  node_map<std::string, Ntk> node_names( ntk );
-  node_names[ntk.get_constant( false )] = "1'b0";
-  if ( ntk.get_node( ntk.get_constant( false ) ) != ntk.get_node( ntk.get_constant( true ) ) )
-    node_names[ntk.get_constant( true )] = "1'b1";
-
-  ntk.foreach_pi( [&]( auto const& n, auto i ) {
-    node_names[n] = xs[i];
-  } );
+  detail::verilog_name_writer<Ntk> name( ntk, xs );
 
   topo_view ntk_topo{ntk};
 
@@ -218,47 +290,50 @@ void write_verilog( Ntk const& ntk, std::ostream& os, write_verilog_params const
     if ( ntk.is_constant( n ) || ntk.is_pi( n ) )
       return true;
 
-    /* assign a name */
-    node_names[n] = fmt::format( "n{}", ntk.node_to_index( n ) );
-
     if ( ntk.is_and( n ) )
     {
-      writer.on_assign( node_names[n], detail::format_fanin<Ntk>( ntk, n, node_names ), "&" );
+      detail::write_verilog_assign( out, name, ntk, n, "&" );
     }
     else if ( ntk.is_or( n ) )
     {
-      writer.on_assign( node_names[n], detail::format_fanin<Ntk>( ntk, n, node_names ), "|" );
+      detail::write_verilog_assign( out, name, ntk, n, "|" );
     }
     else if ( ntk.is_xor( n ) || ntk.is_xor3( n ) )
     {
-      writer.on_assign( node_names[n], detail::format_fanin<Ntk>( ntk, n, node_names ), "^" );
+      detail::write_verilog_assign( out, name, ntk, n, "^" );
     }
     else if ( ntk.is_maj( n ) )
     {
       std::array<signal<Ntk>, 3> children;
       ntk.foreach_fanin( n, [&]( auto const& f, auto i ) { children[i] = f; } );
 
+      out << "  assign ";
+      name( out, n );
+      out << " = ";
       if ( ntk.is_constant( ntk.get_node( children[0u] ) ) )
       {
-        std::vector<std::pair<bool, std::string>> vs;
-        vs.emplace_back( std::make_pair( ntk.is_complemented( children[1u] ), node_names[ntk.get_node( children[1u] )] ) );
-        vs.emplace_back( std::make_pair( ntk.is_complemented( children[2u] ), node_names[ntk.get_node( children[2u] )] ) );
-
-        if ( ntk.is_complemented( children[0u] ) )
-        {
-          // or
-          writer.on_assign( node_names[n], {vs[0u], vs[1u]}, "|" );
-        }
-        else
-        {
-          // and
-          writer.on_assign( node_names[n], {vs[0u], vs[1u]}, "&" );
-        }
+        /* or if the constant is complemented, and otherwise */
+        name( out, children[1u] );
+        out << ( ntk.is_complemented( children[0u] ) ? " | " : " & " );
+        name( out, children[2u] );
       }
       else
       {
-        writer.on_assign_maj3( node_names[n], detail::format_fanin<Ntk>( ntk, n, node_names ) );
+        out << "( ";
+        name( out, children[0u] );
+        out << " & ";
+        name( out, children[1u] );
+        out << " ) | ( ";
+        name( out, children[0u] );
+        out << " & ";
+        name( out, children[2u] );
+        out << " ) | ( ";
+        name( out, children[1u] );
+        out << " & ";
+        name( out, children[2u] );
+        out << " )";
       }
+      out << " ;\n";
     }
     else
     {
@@ -266,7 +341,7 @@ void write_verilog( Ntk const& ntk, std::ostream& os, write_verilog_params const
       {
         if ( ntk.is_nary_and( n ) )
         {
-          writer.on_assign( node_names[n], detail::format_fanin<Ntk>( ntk, n, node_names ), "&" );
+          detail::write_verilog_assign( out, name, ntk, n, "&" );
           return true;
         }
       }
@@ -274,7 +349,7 @@ void write_verilog( Ntk const& ntk, std::ostream& os, write_verilog_params const
       {
         if ( ntk.is_nary_or( n ) )
         {
-          writer.on_assign( node_names[n], detail::format_fanin<Ntk>( ntk, n, node_names ), "|" );
+          detail::write_verilog_assign( out, name, ntk, n, "|" );
           return true;
         }
       }
@@ -282,21 +357,27 @@ void write_verilog( Ntk const& ntk, std::ostream& os, write_verilog_params const
       {
         if ( ntk.is_nary_xor( n ) )
         {
-          writer.on_assign( node_names[n], detail::format_fanin<Ntk>( ntk, n, node_names ), "^" );
+          detail::write_verilog_assign( out, name, ntk, n, "^" );
           return true;
         }
       }
-      writer.on_assign_unknown_gate( node_names[n] );
+      out << "  assign ";
+      name( out, n );
+      out << " = unknown gate;\n";
     }
 
     return true;
   } );
 
   ntk.foreach_po( [&]( auto const& f, auto i ) {
-    writer.on_assign_po( ys[i], std::make_pair( ntk.is_complemented( f ), node_names[f] ) );
+    out << "  assign " << ys[i] << " = ";
+    name( out, f );
+    out << " ;\n";
   } );
 
-  writer.on_module_end();
+  out << "endmodule\n";
+  out.flush();
+  os.flush();
 }
 
 /*! \brief Writes network in structural Verilog format into a file
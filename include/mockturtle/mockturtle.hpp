@@ -83,6 +83,7 @@
 #include "mockturtle/algorithms/mig_algebraic_rewriting.hpp"
 #include "mockturtle/algorithms/xmg_optimization.hpp"
 #include "mockturtle/algorithms/cut_enumeration.hpp"
+#include "mockturtle/algorithms/lazy_cut_enumeration.hpp"
 #include "mockturtle/algorithms/cell_window.hpp"
 #include "mockturtle/algorithms/decomposition.hpp"
 #include "mockturtle/algorithms/node_resynthesis.hpp"
@@ -95,6 +96,7 @@
 #include "mockturtle/algorithms/functional_reduction.hpp"
 #include "mockturtle/utils/stopwatch.hpp"
 #include "mockturtle/utils/truth_table_cache.hpp"
+#include "mockturtle/utils/concurrent_truth_table_cache.hpp"
 #include "mockturtle/utils/string_utils.hpp"
 #include "mockturtle/utils/algorithm.hpp"
 #include "mockturtle/utils/progress_bar.hpp"
@@ -102,6 +104,8 @@
 #include "mockturtle/utils/node_map.hpp"
 #include "mockturtle/utils/cuts.hpp"
 #include "mockturtle/utils/index_list.hpp"
+#include "mockturtle/utils/lut_library.hpp"
+#include "mockturtle/utils/npn4_classes.hpp"
 #include "mockturtle/networks/aig.hpp"
 #include "mockturtle/networks/events.hpp"
 #include "mockturtle/networks/klut.hpp"
@@ -0,0 +1,162 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2019  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file binary_utils.hpp
+  \brief Helper functions for binary file formats
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <kitty/dynamic_truth_table.hpp>
+
+namespace mockturtle::detail
+{
+
+/* values are stored in the byte order of the host */
+template<typename T>
+void write_binary( std::ostream& os, T value )
+{
+  static_assert( std::is_trivially_copyable_v<T>, "T is not trivially copyable" );
+  os.write( reinterpret_cast<char const*>( &value ), sizeof( T ) );
+}
+
+template<typename T>
+bool read_binary( std::istream& is, T& value )
+{
+  static_assert( std::is_trivially_copyable_v<T>, "T is not trivially copyable" );
+  return static_cast<bool>( is.read( reinterpret_cast<char*>( &value ), sizeof( T ) ) );
+}
+
+/* structured values: truth tables, vectors, pairs, and trivially copyable
+ * types; truth tables with more than `max_vars` variables are rejected when
+ * reading */
+inline constexpr uint8_t binary_max_truth_table_vars = 16u;
+
+/* declarations, such that the overloads can be nested */
+template<typename T>
+void write_binary_value( std::ostream& os, std::vector<T> const& values );
+template<typename T1, typename T2>
+void write_binary_value( std::ostream& os, std::pair<T1, T2> const& value );
+template<typename T>
+bool read_binary_value( std::istream& is, std::vector<T>& values );
+template<typename T1, typename T2>
+bool read_binary_value( std::istream& is, std::pair<T1, T2>& value );
+
+template<typename T>
+void write_binary_value( std::ostream& os, T const& value )
+{
+  write_binary<T>( os, value );
+}
+
+inline void write_binary_value( std::ostream& os, kitty::dynamic_truth_table const& tt )
+{
+  write_binary<uint8_t>( os, static_cast<uint8_t>( tt.num_vars() ) );
+  for ( auto word : tt )
+  {
+    write_binary<uint64_t>( os, word );
+  }
+}
+
+template<typename T>
+void write_binary_value( std::ostream& os, std::vector<T> const& values )
+{
+  write_binary<uint32_t>( os, static_cast<uint32_t>( values.size() ) );
+  for ( auto const& value : values )
+  {
+    write_binary_value( os, value );
+  }
+}
+
+template<typename T1, typename T2>
+void write_binary_value( std::ostream& os, std::pair<T1, T2> const& value )
+{
+  write_binary_value( os, value.first );
+  write_binary_value( os, value.second );
+}
+
+template<typename T>
+bool read_binary_value( std::istream& is, T& value )
+{
+  return read_binary<T>( is, value );
+}
+
+inline bool read_binary_value( std::istream& is, kitty::dynamic_truth_table& tt )
+{
+  uint8_t num_vars;
+  if ( !read_binary( is, num_vars ) || num_vars > binary_max_truth_table_vars )
+  {
+    return false;
+  }
+
+  tt = kitty::dynamic_truth_table( num_vars );
+  for ( auto& word : tt )
+  {
+    if ( !read_binary( is, word ) )
+    {
+      return false;
+    }
+  }
+  tt.mask_bits();
+  return true;
+}
+
+template<typename T>
+bool read_binary_value( std::istream& is, std::vector<T>& values )
+{
+  uint32_t size;
+  if ( !read_binary( is, size ) )
+  {
+    return false;
+  }
+
+  /* the size is not trusted to reserve memory */
+  values.clear();
+  for ( auto i = 0u; i < size; ++i )
+  {
+    T value;
+    if ( !read_binary_value( is, value ) )
+    {
+      return false;
+    }
+    values.emplace_back( std::move( value ) );
+  }
+  return true;
+}
+
+template<typename T1, typename T2>
+bool read_binary_value( std::istream& is, std::pair<T1, T2>& value )
+{
+  return read_binary_value( is, value.first ) && read_binary_value( is, value.second );
+}
+
+} /* namespace mockturtle::detail */
@@ -0,0 +1,300 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2019  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file concurrent_truth_table_cache.hpp
+  \brief Thread-safe truth table cache with NPN normalization
+*/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <shared_mutex>
+#include <tuple>
+#include <vector>
+
+#include <kitty/hash.hpp>
+#include <kitty/npn.hpp>
+#include <kitty/operations.hpp>
+#include <kitty/operators.hpp>
+
+namespace mockturtle
+{
+
+/*! \brief Normalizes a truth table by output complementation.
+ *
+ * A function is normal, if the input pattern \f$0, \dots, 0\f$ maps to
+ * \f$0\f$.  This is the normalization used by `truth_table_cache`.
+ */
+struct complement_normalization
+{
+  template<typename TT>
+  std::tuple<TT, uint32_t, std::vector<uint8_t>> operator()( TT const& tt ) const
+  {
+    std::vector<uint8_t> perm( tt.num_vars() );
+    std::iota( perm.begin(), perm.end(), 0u );
+
+    if ( kitty::get_bit( tt, 0 ) )
+    {
+      return {~tt, 1u << tt.num_vars(), perm};
+    }
+    return {tt, 0u, perm};
+  }
+};
+
+/*! \brief Normalizes a truth table to its NPN representative.
+ *
+ * Uses `kitty::exact_npn_canonization`, i.e., functions must have at most 6
+ * variables.
+ */
+struct exact_npn_normalization
+{
+  template<typename TT>
+  std::tuple<TT, uint32_t, std::vector<uint8_t>> operator()( TT const& tt ) const
+  {
+    return kitty::exact_npn_canonization( tt );
+  }
+};
+
+/*! \brief Result of inserting into a `concurrent_truth_table_cache`.
+ *
+ * Contains the index of the representative in the cache and the
+ * transformation from the representative to the inserted function, in the
+ * format of `kitty::create_from_npn_config`.
+ */
+struct truth_table_cache_entry
+{
+  /*! \brief Index of the representative in the cache. */
+  uint32_t index;
+
+  /*! \brief Input and output negations (output negation in bit `num_vars`). */
+  uint32_t phase;
+
+  /*! \brief Input permutation. */
+  std::vector<uint8_t> perm;
+};
+
+/*! \brief Thread-safe truth table cache.
+ *
+ * Similar to `truth_table_cache`, this data structure stores each truth table
+ * once and refers to it by an index.  Truth tables are normalized before
+ * being inserted, such that all functions in the same class share one entry.
+ * The normalization is given by `Normalization`, which is a callable that
+ * returns a representative and a transformation in the same format as
+ * `kitty::exact_npn_canonization`.  By default, functions are NPN
+ * normalized.
+ *
+ * Insertions and lookups can be performed from multiple threads.  The cache is
+ * split into `NumShards` shards, each protected by its own lock, and the shard
+ * of a function is determined by its hash value.  Normalization is performed
+ * outside of the locks.  Each shard is an open-addressing hash table, in which
+ * a slot is a single 64-bit word containing a hash tag and an index into the
+ * shard's truth tables.
+ *
+   \verbatim embed:rst
+
+   Example
+
+   .. code-block:: c++
+
+      concurrent_truth_table_cache<kitty::static_truth_table<4>> cache;
+
+      kitty::static_truth_table<4> maj;
+      kitty::create_majority( maj );
+      auto e1 = cache.insert( maj );
+
+      auto e2 = cache.insert( ~maj ); // e2.index == e1.index
+
+      auto tt = cache.get( e2 ); // tt == ~maj
+   \endverbatim
+ */
+template<typename TT, typename Normalization = exact_npn_normalization, uint32_t NumShards = 64u>
+class concurrent_truth_table_cache
+{
+  static_assert( NumShards > 0u && ( NumShards & ( NumShards - 1u ) ) == 0u, "NumShards must be a power of 2" );
+
+public:
+  /*! \brief Creates a cache and reserves memory. */
+  explicit concurrent_truth_table_cache( uint32_t capacity = 1000u, Normalization const& normalize = {} )
+      : normalize( normalize )
+  {
+    const auto per_shard = ( capacity + NumShards - 1u ) / NumShards;
+    uint32_t slots{16u};
+    while ( slots < 2u * per_shard )
+    {
+      slots <<= 1u;
+    }
+
+    for ( auto& s : shards )
+    {
+      s.slots.resize( slots, 0u );
+      s.data.reserve( per_shard );
+    }
+  }
+
+  /*! \brief Inserts a truth table.
+   *
+   * Returns the index of the representative of `tt` together with the
+   * transformation that maps the representative to `tt`.
+   */
+  truth_table_cache_entry insert( TT const& tt )
+  {
+    auto [repr, phase, perm] = normalize( tt );
+    const auto h = hash_of( repr );
+    auto& s = shards[h & ( NumShards - 1u )];
+
+    std::unique_lock lock( s.mutex );
+    auto pos = find_slot( s, h, repr );
+    if ( s.slots[pos] == 0u )
+    {
+      if ( 2u * ( s.data.size() + 1u ) > s.slots.size() )
+      {
+        grow( s );
+        pos = find_slot( s, h, repr );
+      }
+
+      s.data.push_back( repr );
+      s.slots[pos] = ( tag_of( h ) << 32u ) | static_cast<uint64_t>( s.data.size() );
+    }
+
+    return {to_index( h & ( NumShards - 1u ), static_cast<uint32_t>( s.slots[pos] & 0xffffffff ) - 1u ), phase, perm};
+  }
+
+  /*! \brief Looks up a truth table without inserting it. */
+  std::optional<truth_table_cache_entry> find( TT const& tt ) const
+  {
+    auto [repr, phase, perm] = normalize( tt );
+    const auto h = hash_of( repr );
+    auto const& s = shards[h & ( NumShards - 1u )];
+
+    std::shared_lock lock( s.mutex );
+    const auto pos = find_slot( s, h, repr );
+    if ( s.slots[pos] == 0u )
+    {
+      return std::nullopt;
+    }
+    return truth_table_cache_entry{to_index( h & ( NumShards - 1u ), static_cast<uint32_t>( s.slots[pos] & 0xffffffff ) - 1u ), phase, perm};
+  }
+
+  /*! \brief Returns the representative at index `index`. */
+  TT operator[]( uint32_t index ) const
+  {
+    auto const& s = shards[index & ( NumShards - 1u )];
+    std::shared_lock lock( s.mutex );
+    return s.data[index / NumShards];
+  }
+
+  /*! \brief Returns the truth table for an entry returned by `insert`. */
+  TT get( truth_table_cache_entry const& entry ) const
+  {
+    return kitty::create_from_npn_config( std::make_tuple( ( *this )[entry.index], entry.phase, entry.perm ) );
+  }
+
+  /*! \brief Returns number of representatives in the cache. */
+  std::size_t size() const
+  {
+    std::size_t total{0u};
+    for ( auto const& s : shards )
+    {
+      std::shared_lock lock( s.mutex );
+      total += s.data.size();
+    }
+    return total;
+  }
+
+private:
+  struct shard
+  {
+    mutable std::shared_mutex mutex;
+    std::vector<uint64_t> slots; /* hash tag (upper 32 bits) and index + 1 (lower 32 bits), 0 if empty */
+    std::vector<TT> data;
+  };
+
+  static uint64_t hash_of( TT const& tt )
+  {
+    /* finalizer of MurmurHash3 to spread bits over shards and slots */
+    uint64_t h = kitty::hash<TT>()( tt );
+    h ^= h >> 33u;
+    h *= UINT64_C( 0xff51afd7ed558ccd );
+    h ^= h >> 33u;
+    h *= UINT64_C( 0xc4ceb9fe1a85ec53 );
+    h ^= h >> 33u;
+    return h;
+  }
+
+  static uint64_t tag_of( uint64_t h )
+  {
+    return h >> 32u;
+  }
+
+  static uint32_t to_index( uint64_t shard, uint32_t local )
+  {
+    return local * NumShards + static_cast<uint32_t>( shard );
+  }
+
+  static std::size_t find_slot( shard const& s, uint64_t h, TT const& repr )
+  {
+    const auto mask = s.slots.size() - 1u;
+    auto pos = static_cast<std::size_t>( tag_of( h ) ) & mask;
+    while ( s.slots[pos] != 0u )
+    {
+      if ( ( s.slots[pos] >> 32u ) == tag_of( h ) && s.data[( s.slots[pos] & 0xffffffff ) - 1u] == repr )
+      {
+        break;
+      }
+      pos = ( pos + 1u ) & mask;
+    }
+    return pos;
+  }
+
+  static void grow( shard& s )
+  {
+    std::vector<uint64_t> slots( 2u * s.slots.size(), 0u );
+    const auto mask = slots.size() - 1u;
+    for ( auto slot : s.slots )
+    {
+      if ( slot == 0u )
+        continue;
+
+      auto pos = static_cast<std::size_t>( slot >> 32u ) & mask;
+      while ( slots[pos] != 0u )
+      {
+        pos = ( pos + 1u ) & mask;
+      }
+      slots[pos] = slot;
+    }
+    s.slots.swap( slots );
+  }
+
+private:
+  Normalization normalize;
+  std::array<shard, NumShards> shards;
+};
+
+} /* namespace mockturtle */
@@ -32,6 +32,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <iostream>
@@ -181,10 +182,10 @@ public:
 
 private:
   std::array<uint32_t, MaxLeaves> _leaves;
-  uint32_t _length;
-  uint64_t _signature;
-  typename std::array<uint32_t, MaxLeaves>::const_iterator _cend;
-  typename std::array<uint32_t, MaxLeaves>::iterator _end;
+  uint32_t _length{0};
+  uint64_t _signature{0};
+  typename std::array<uint32_t, MaxLeaves>::const_iterator _cend{_leaves.begin()};
+  typename std::array<uint32_t, MaxLeaves>::iterator _end{_leaves.begin()};
 
   T _data;
 };
@@ -357,6 +358,15 @@ public:
    */
   cut_set();
 
+  /*! \brief Copy constructor.
+   *
+   * Cut pointers are redirected to the cuts of the new set.
+   */
+  cut_set( cut_set const& other );
+
+  /*! \brief Assignment operator. */
+  cut_set& operator=( cut_set const& other );
+
   /*! \brief Clears a cut set.
    */
   void clear();
@@ -468,6 +478,27 @@ cut_set<CutType, MaxCuts>::cut_set()
   clear();
 }
 
+template<typename CutType, int MaxCuts>
+cut_set<CutType, MaxCuts>::cut_set( cut_set const& other )
+{
+  *this = other;
+}
+
+template<typename CutType, int MaxCuts>
+cut_set<CutType, MaxCuts>& cut_set<CutType, MaxCuts>::operator=( cut_set const& other )
+{
+  if ( &other != this )
+  {
+    _cuts = other._cuts;
+    std::transform( other._pcuts.begin(), other._pcuts.end(), _pcuts.begin(), [&]( auto const* c ) {
+      return &_cuts[c - &other._cuts[0]];
+    } );
+    _pcend = _pcuts.begin() + std::distance( other._pcuts.begin(), other._pcend );
+    _pend = _pcuts.begin() + std::distance( other._pcuts.begin(), typename std::array<CutType*, MaxCuts>::const_iterator( other._pend ) );
+  }
+  return *this;
+}
+
 template<typename CutType, int MaxCuts>
 void cut_set<CutType, MaxCuts>::clear()
 {
@@ -0,0 +1,4170 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2019  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file npn4_constants.hpp
+  \brief Precomputed NPN classification of all 4-input functions
+*/
+
+/*! \cond PRIVATE */
+#pragma once
+
+#include <cstdint>
+
+namespace mockturtle
+{
+
+namespace detail
+{
+
+/* The tables were generated with kitty::exact_npn_canonization.  Each entry
+ * of npn4_entries stores the class index in bits 0-7, the phase in bits 8-12,
+ * and the index into npn4_permutations in bits 13-17. */
+
+// clang-format off
+inline constexpr uint16_t npn4_representatives[] = {
+    0x0000, 0x0001, 0x0003, 0x0006, 0x0007, 0x000f, 0x0016, 0x0017, 0x0018, 0x0019, 0x001b, 0x001e, 0x001f, 0x003c, 0x003d, 0x003f,
+    0x0069, 0x006b, 0x006f, 0x007e, 0x007f, 0x00ff, 0x0116, 0x0117, 0x0118, 0x0119, 0x011a, 0x011b, 0x011e, 0x011f, 0x012c, 0x012d,
+    0x012f, 0x013c, 0x013d, 0x013e, 0x013f, 0x0168, 0x0169, 0x016a, 0x016b, 0x016e, 0x016f, 0x017e, 0x017f, 0x0180, 0x0181, 0x0182,
+    0x0183, 0x0186, 0x0187, 0x0189, 0x018b, 0x018f, 0x0196, 0x0197, 0x0198, 0x0199, 0x019a, 0x019b, 0x019e, 0x019f, 0x01a8, 0x01a9,
+    0x01aa, 0x01ab, 0x01ac, 0x01ad, 0x01ae, 0x01af, 0x01bc, 0x01bd, 0x01be, 0x01bf, 0x01e8, 0x01e9, 0x01ea, 0x01eb, 0x01ee, 0x01ef,
+    0x01fe, 0x033c, 0x033d, 0x033f, 0x0356, 0x0357, 0x0358, 0x0359, 0x035a, 0x035b, 0x035e, 0x035f, 0x0368, 0x0369, 0x036a, 0x036b,
+    0x036c, 0x036d, 0x036e, 0x036f, 0x037c, 0x037d, 0x037e, 0x03c0, 0x03c1, 0x03c3, 0x03c5, 0x03c6, 0x03c7, 0x03cf, 0x03d4, 0x03d5,
+    0x03d6, 0x03d7, 0x03d8, 0x03d9, 0x03db, 0x03dc, 0x03dd, 0x03de, 0x03fc, 0x0660, 0x0661, 0x0662, 0x0663, 0x0666, 0x0667, 0x0669,
+    0x066b, 0x066f, 0x0672, 0x0673, 0x0676, 0x0678, 0x0679, 0x067a, 0x067b, 0x067e, 0x0690, 0x0691, 0x0693, 0x0696, 0x0697, 0x069f,
+    0x06b0, 0x06b1, 0x06b2, 0x06b3, 0x06b4, 0x06b5, 0x06b6, 0x06b7, 0x06b9, 0x06bd, 0x06f0, 0x06f1, 0x06f2, 0x06f6, 0x06f9, 0x0776,
+    0x0778, 0x0779, 0x077a, 0x077e, 0x07b0, 0x07b1, 0x07b4, 0x07b5, 0x07b6, 0x07bc, 0x07e0, 0x07e1, 0x07e2, 0x07e3, 0x07e6, 0x07e9,
+    0x07f0, 0x07f1, 0x07f2, 0x07f8, 0x0ff0, 0x1668, 0x1669, 0x166a, 0x166b, 0x166e, 0x167e, 0x1681, 0x1683, 0x1686, 0x1687, 0x1689,
+    0x168b, 0x168e, 0x1696, 0x1697, 0x1698, 0x1699, 0x169a, 0x169b, 0x169e, 0x16a9, 0x16ac, 0x16ad, 0x16bc, 0x16e9, 0x177e, 0x178e,
+    0x1796, 0x1798, 0x179a, 0x17ac, 0x17e8, 0x18e7, 0x19e1, 0x19e3, 0x19e6, 0x1bd8, 0x1be4, 0x1ee1, 0x3cc3, 0x6996};
+
+inline constexpr uint8_t npn4_permutations[][4] = {
+    {0, 1, 2, 3}, {0, 1, 3, 2}, {0, 2, 1, 3}, {0, 2, 3, 1}, {0, 3, 1, 2}, {0, 3, 2, 1}, {1, 0, 2, 3}, {1, 0, 3, 2},
+    {1, 2, 0, 3}, {1, 2, 3, 0}, {1, 3, 0, 2}, {1, 3, 2, 0}, {2, 0, 1, 3}, {2, 0, 3, 1}, {2, 1, 0, 3}, {2, 1, 3, 0},
+    {2, 3, 0, 1}, {2, 3, 1, 0}, {3, 0, 1, 2}, {3, 0, 2, 1}, {3, 1, 0, 2}, {3, 1, 2, 0}, {3, 2, 0, 1}, {3, 2, 1, 0}};
+
+inline constexpr uint32_t npn4_entries[] = {
+    0x00000, 0x00001, 0x00101, 0x00002, 0x00201, 0x10002, 0x00003, 0x00004, 0x00301, 0x00103, 0x10102, 0x00104, 0x00302, 0x00204, 0x00304, 0x00005,
+    0x00401, 0x18002, 0x06003, 0x06004, 0x1e003, 0x1e004, 0x00006, 0x00007, 0x00008, 0x00009, 0x04109, 0x0000a, 0x1c209, 0x0c00a, 0x0000b, 0x0000c,
+    0x00501, 0x06103, 0x18102, 0x06104, 0x04008, 0x04009, 0x00109, 0x0400a, 0x1e103, 0x00106, 0x1e104, 0x00107, 0x1c309, 0x0010b, 0x0c10a, 0x0010c,
+    0x00502, 0x06404, 0x06504, 0x06005, 0x1c409, 0x1800a, 0x0400b, 0x0400c, 0x1c509, 0x0410b, 0x1810a, 0x0410c, 0x0000d, 0x0000e, 0x0010e, 0x0000f,
+    0x00601, 0x1e203, 0x1c008, 0x1c009, 0x18202, 0x1e204, 0x00209, 0x1000a, 0x06203, 0x00206, 0x04309, 0x0020b, 0x06204, 0x00207, 0x0430a, 0x0020c,
+    0x10602, 0x1e404, 0x04409, 0x1c00a, 0x1e604, 0x1e005, 0x1c00b, 0x1c00c, 0x04609, 0x1c20b, 0x1000d, 0x1000e, 0x1c20a, 0x1c20c, 0x1020e, 0x1000f,
+    0x00703, 0x00406, 0x00509, 0x0440b, 0x00609, 0x1c40b, 0x1800d, 0x1800e, 0x00706, 0x00010, 0x1c70b, 0x00011, 0x0470b, 0x10011, 0x1830e, 0x00012,
+    0x00404, 0x00407, 0x0050a, 0x0440c, 0x0c60a, 0x1c40c, 0x1840e, 0x1800f, 0x0070b, 0x18011, 0x1050e, 0x04012, 0x0060e, 0x1c012, 0x00013, 0x00014,
+    0x00701, 0x1c108, 0x1e303, 0x1c109, 0x06303, 0x04209, 0x00306, 0x0030b, 0x18302, 0x00309, 0x1e304, 0x1010a, 0x06304, 0x0030a, 0x00307, 0x0030c,
+    0x00603, 0x00409, 0x00506, 0x0450b, 0x00606, 0x1c60b, 0x00110, 0x00111, 0x00709, 0x1810d, 0x1c50b, 0x1810e, 0x0460b, 0x1820e, 0x10111, 0x00112,
+    0x10702, 0x04509, 0x1e504, 0x1c10a, 0x04709, 0x1010d, 0x1c30b, 0x1010e, 0x1e704, 0x1c10b, 0x1e105, 0x1c10c, 0x1c30a, 0x1030e, 0x1c30c, 0x1010f,
+    0x00504, 0x0450a, 0x00507, 0x0450c, 0x0060b, 0x1040e, 0x18111, 0x04112, 0x0c70a, 0x1850e, 0x1c50c, 0x1810f, 0x0070e, 0x00113, 0x1c112, 0x00114,
+    0x00602, 0x1c609, 0x1c709, 0x0030d, 0x06604, 0x1820a, 0x0430b, 0x0020e, 0x06704, 0x0420b, 0x1830a, 0x0030e, 0x06305, 0x0420c, 0x0430c, 0x0030f,
+    0x00604, 0x1060a, 0x0050b, 0x0040e, 0x00607, 0x1c60c, 0x18211, 0x1c212, 0x0460a, 0x1860e, 0x1070e, 0x00213, 0x0460c, 0x1820f, 0x04212, 0x00214,
+    0x00704, 0x0040b, 0x1070a, 0x0050e, 0x0060a, 0x1060e, 0x1870e, 0x00313, 0x00707, 0x18311, 0x1c70c, 0x1c312, 0x0470c, 0x04312, 0x1830f, 0x00314,
+    0x00605, 0x0040c, 0x0050c, 0x0050f, 0x0060c, 0x1060f, 0x00712, 0x00414, 0x0070c, 0x00612, 0x1070f, 0x00514, 0x0060f, 0x00614, 0x00714, 0x00015,
+    0x00801, 0x24002, 0x08003, 0x08004, 0x16003, 0x16004, 0x02006, 0x02007, 0x02008, 0x02009, 0x08109, 0x0200a, 0x28209, 0x0e00a, 0x0200b, 0x0200c,
+    0x20003, 0x20004, 0x26006, 0x26007, 0x2e006, 0x2e007, 0x00016, 0x00017, 0x00018, 0x00019, 0x0001a, 0x0001b, 0x0e01a, 0x0e01b, 0x0001c, 0x0001d,
+    0x06008, 0x06009, 0x26109, 0x0600a, 0x06018, 0x06019, 0x0601a, 0x0601b, 0x08118, 0x0811a, 0x08119, 0x0811b, 0x0001e, 0x0001f, 0x0211f, 0x00020,
+    0x20409, 0x1a00a, 0x0600b, 0x0600c, 0x1801a, 0x1801b, 0x0601c, 0x0601d, 0x0401e, 0x0401f, 0x0611f, 0x04020, 0x00021, 0x00022, 0x00023, 0x00024,
+    0x1e008, 0x1e009, 0x1e018, 0x1e019, 0x16209, 0x1200a, 0x1001a, 0x1001b, 0x16218, 0x1621a, 0x0c01e, 0x0c01f, 0x16219, 0x1621b, 0x0e21f, 0x0c020,
+    0x2e409, 0x1e00a, 0x1e01a, 0x1e01b, 0x1e00b, 0x1e00c, 0x1e01c, 0x1e01d, 0x1001e, 0x1001f, 0x10021, 0x10022, 0x1221f, 0x10020, 0x10023, 0x10024,
+    0x20418, 0x2041a, 0x1801e, 0x1801f, 0x1c01e, 0x1c01f, 0x18021, 0x18022, 0x00025, 0x00026, 0x00027, 0x00028, 0x10027, 0x10028, 0x00029, 0x0002a,
+    0x20419, 0x2041b, 0x1a41f, 0x18020, 0x1e41f, 0x1c020, 0x18023, 0x18024, 0x18027, 0x18028, 0x04029, 0x0402a, 0x1c029, 0x1c02a, 0x0002b, 0x0002c,
+    0x0002d, 0x0002e, 0x0002f, 0x00030, 0x1002f, 0x10030, 0x00031, 0x00032, 0x0232e, 0x00033, 0x14330, 0x00034, 0x02330, 0x0c034, 0x02332, 0x00035,
+    0x1802f, 0x18030, 0x04031, 0x04032, 0x1c031, 0x1c032, 0x00036, 0x00037, 0x00038, 0x00039, 0x0003a, 0x0003b, 0x0c03a, 0x0c03b, 0x0003c, 0x0003d,
+    0x2652e, 0x04033, 0x1a530, 0x04034, 0x04038, 0x04039, 0x0403a, 0x0403b, 0x0003e, 0x0003f, 0x00040, 0x00041, 0x00042, 0x00043, 0x00044, 0x00045,
+    0x0a530, 0x18034, 0x06532, 0x04035, 0x1803a, 0x1803b, 0x0403c, 0x0403d, 0x04042, 0x04043, 0x04044, 0x04045, 0x00046, 0x00047, 0x00048, 0x00049,
+    0x2e62e, 0x1c033, 0x1c038, 0x1c039, 0x22630, 0x10034, 0x1003a, 0x1003b, 0x1003e, 0x1003f, 0x0c042, 0x0c043, 0x10040, 0x10041, 0x0c044, 0x0c045,
+    0x12630, 0x1c034, 0x1c03a, 0x1c03b, 0x1e632, 0x1c035, 0x1c03c, 0x1c03d, 0x10042, 0x10043, 0x10046, 0x10047, 0x10044, 0x10045, 0x10048, 0x10049,
+    0x1803e, 0x1803f, 0x18042, 0x18043, 0x1c042, 0x1c043, 0x18046, 0x18047, 0x0004a, 0x0004b, 0x0004c, 0x0004d, 0x1004c, 0x1004d, 0x0004e, 0x0004f,
+    0x18040, 0x18041, 0x18044, 0x18045, 0x1c044, 0x1c045, 0x18048, 0x18049, 0x1804c, 0x1804d, 0x0404e, 0x0404f, 0x1c04e, 0x1c04f, 0x00050, 0x01f14,
+    0x00901, 0x08103, 0x24102, 0x08104, 0x08008, 0x08009, 0x02109, 0x0800a, 0x16103, 0x02106, 0x16104, 0x02107, 0x28309, 0x0210b, 0x0e10a, 0x0210c,
+    0x26008, 0x26009, 0x06109, 0x0a00a, 0x08018, 0x08019, 0x0801a, 0x0801b, 0x06118, 0x0611a, 0x06119, 0x0611b, 0x0201e, 0x0201f, 0x0011f, 0x02020,
+    0x20103, 0x26106, 0x20104, 0x26107, 0x00118, 0x0011a, 0x00119, 0x0011b, 0x2e106, 0x00116, 0x2e107, 0x00117, 0x0e11a, 0x0011c, 0x0e11b, 0x0011d,
+    0x20509, 0x0610b, 0x1a10a, 0x0610c, 0x0601e, 0x0601f, 0x0411f, 0x06020, 0x1811a, 0x0611c, 0x1811b, 0x0611d, 0x00121, 0x00123, 0x00122, 0x00124,
+    0x0012d, 0x0012f, 0x0012e, 0x00130, 0x0222e, 0x14230, 0x00133, 0x00134, 0x1012f, 0x00131, 0x10130, 0x00132, 0x02230, 0x02232, 0x0c134, 0x00135,
+    0x2642e, 0x1a430, 0x04133, 0x04134, 0x0013e, 0x00140, 0x0013f, 0x00141, 0x04138, 0x0413a, 0x04139, 0x0413b, 0x00142, 0x00144, 0x00143, 0x00145,
+    0x1812f, 0x04131, 0x18130, 0x04132, 0x00138, 0x0013a, 0x00139, 0x0013b, 0x1c131, 0x00136, 0x1c132, 0x00137, 0x0c13a, 0x0013c, 0x0c13b, 0x0013d,
+    0x0a430, 0x06432, 0x18134, 0x04135, 0x04142, 0x04144, 0x04143, 0x04145, 0x1813a, 0x0413c, 0x1813b, 0x0413d, 0x00146, 0x00148, 0x00147, 0x00149,
+    0x1e108, 0x1e118, 0x1e109, 0x1e119, 0x16318, 0x0c11e, 0x1631a, 0x0c11f, 0x16309, 0x1011a, 0x1210a, 0x1011b, 0x16319, 0x0e31f, 0x1631b, 0x0c120,
+    0x20518, 0x1811e, 0x2051a, 0x1811f, 0x00125, 0x00127, 0x00126, 0x00128, 0x1c11e, 0x18121, 0x1c11f, 0x18122, 0x10127, 0x00129, 0x10128, 0x0012a,
+    0x2e509, 0x1e11a, 0x1e10a, 0x1e11b, 0x1011e, 0x10121, 0x1011f, 0x10122, 0x1e10b, 0x1e11c, 0x1e10c, 0x1e11d, 0x1231f, 0x10123, 0x10120, 0x10124,
+    0x20519, 0x1a51f, 0x2051b, 0x18120, 0x18127, 0x04129, 0x18128, 0x0412a, 0x1e51f, 0x18123, 0x1c120, 0x18124, 0x1c129, 0x0012b, 0x1c12a, 0x0012c,
+    0x2e72e, 0x1c138, 0x1c133, 0x1c139, 0x1013e, 0x0c142, 0x1013f, 0x0c143, 0x22730, 0x1013a, 0x10134, 0x1013b, 0x10140, 0x0c144, 0x10141, 0x0c145,
+    0x1813e, 0x18142, 0x1813f, 0x18143, 0x0014a, 0x0014c, 0x0014b, 0x0014d, 0x1c142, 0x18146, 0x1c143, 0x18147, 0x1014c, 0x0014e, 0x1014d, 0x0014f,
+    0x12730, 0x1c13a, 0x1c134, 0x1c13b, 0x10142, 0x10146, 0x10143, 0x10147, 0x1e732, 0x1c13c, 0x1c135, 0x1c13d, 0x10144, 0x10148, 0x10145, 0x10149,
+    0x18140, 0x18144, 0x18141, 0x18145, 0x1814c, 0x0414e, 0x1814d, 0x0414f, 0x1c144, 0x18148, 0x1c145, 0x18149, 0x1c14e, 0x00150, 0x1c14f, 0x01e14,
+    0x00902, 0x08804, 0x08904, 0x08005, 0x28809, 0x2400a, 0x0800b, 0x0800c, 0x28909, 0x0810b, 0x2410a, 0x0810c, 0x0200d, 0x0200e, 0x0210e, 0x0200f,
+    0x20809, 0x2600a, 0x2600b, 0x2600c, 0x2401a, 0x2401b, 0x0801c, 0x0801d, 0x0801e, 0x0801f, 0x0a11f, 0x08020, 0x02021, 0x02022, 0x02023, 0x02024,
+    0x20909, 0x2610b, 0x2610a, 0x2610c, 0x0a01e, 0x0a01f, 0x0811f, 0x0a020, 0x2411a, 0x0811c, 0x2411b, 0x0811d, 0x02121, 0x02123, 0x02122, 0x02124,
+    0x0a00d, 0x0a00e, 0x0a10e, 0x0a00f, 0x0a021, 0x0a022, 0x0a023, 0x0a024, 0x0a121, 0x0a123, 0x0a122, 0x0a124, 0x00051, 0x00052, 0x00152, 0x00053,
+    0x2e82e, 0x2e830, 0x1423e, 0x14240, 0x28233, 0x14234, 0x1423f, 0x14241, 0x28238, 0x1423a, 0x0e242, 0x0e244, 0x28239, 0x1423b, 0x0e243, 0x0e245,
+    0x20433, 0x20434, 0x1a43f, 0x1a441, 0x2e83f, 0x2e841, 0x00054, 0x00055, 0x00056, 0x00057, 0x00058, 0x00059, 0x0e058, 0x0e059, 0x0005a, 0x0005b,
+    0x20438, 0x2043a, 0x1a442, 0x1a444, 0x04056, 0x04057, 0x04058, 0x04059, 0x0005c, 0x0005d, 0x0005e, 0x0005f, 0x00060, 0x00061, 0x00062, 0x00063,
+    0x20439, 0x2043b, 0x1a443, 0x1a445, 0x1a058, 0x1a059, 0x0405a, 0x0405b, 0x04060, 0x04061, 0x04062, 0x04063, 0x00064, 0x00065, 0x00066, 0x01f24,
+    0x2e92e, 0x1433e, 0x2e930, 0x14340, 0x28338, 0x0e342, 0x1433a, 0x0e344, 0x28333, 0x1433f, 0x14334, 0x14341, 0x28339, 0x0e343, 0x1433b, 0x0e345,
+    0x20538, 0x1a542, 0x2053a, 0x1a544, 0x0015c, 0x0015e, 0x0015d, 0x0015f, 0x04156, 0x04158, 0x04157, 0x04159, 0x00160, 0x00162, 0x00161, 0x00163,
+    0x20533, 0x1a53f, 0x20534, 0x1a541, 0x00156, 0x00158, 0x00157, 0x00159, 0x2e93f, 0x00154, 0x2e941, 0x00155, 0x0e158, 0x0015a, 0x0e159, 0x0015b,
+    0x20539, 0x1a543, 0x2053b, 0x1a545, 0x04160, 0x04162, 0x04161, 0x04163, 0x1a158, 0x0415a, 0x1a159, 0x0415b, 0x00164, 0x00166, 0x00165, 0x01e24,
+    0x00067, 0x00068, 0x00168, 0x00069, 0x02268, 0x0006a, 0x0006b, 0x0006c, 0x02368, 0x0016b, 0x0016a, 0x0016c, 0x02369, 0x0226c, 0x0236c, 0x0006d,
+    0x0a468, 0x0406a, 0x0406b, 0x0406c, 0x0006e, 0x0006f, 0x00070, 0x00071, 0x00072, 0x00073, 0x04173, 0x00074, 0x00075, 0x00076, 0x00077, 0x0dd45,
+    0x0a568, 0x0416b, 0x0416a, 0x0416c, 0x04072, 0x04073, 0x00173, 0x04074, 0x0016e, 0x00170, 0x0016f, 0x00171, 0x00175, 0x00177, 0x00176, 0x0dc45,
+    0x0a569, 0x0646c, 0x0656c, 0x0406d, 0x04075, 0x04076, 0x04077, 0x19b45, 0x04175, 0x04177, 0x04176, 0x19a45, 0x00078, 0x1d94e, 0x1d84e, 0x01f0f,
+    0x00a01, 0x16203, 0x28008, 0x28009, 0x24202, 0x16204, 0x02209, 0x1400a, 0x08203, 0x02206, 0x08309, 0x0220b, 0x08204, 0x02207, 0x0830a, 0x0220c,
+    0x16008, 0x16009, 0x16018, 0x16019, 0x1e209, 0x1600a, 0x1601a, 0x1601b, 0x1e218, 0x1021a, 0x0e01e, 0x0e01f, 0x1e219, 0x1021b, 0x0c21f, 0x0e020,
+    0x0212d, 0x0212f, 0x0212e, 0x02130, 0x0022e, 0x10230, 0x02133, 0x02134, 0x1412f, 0x02131, 0x14130, 0x02132, 0x00230, 0x00232, 0x0e134, 0x02135,
+    0x2e42e, 0x22430, 0x1023e, 0x10240, 0x1c233, 0x10234, 0x1023f, 0x10241, 0x1c238, 0x1023a, 0x0c242, 0x0c244, 0x1c239, 0x1023b, 0x0c243, 0x0c245,
+    0x20203, 0x2e206, 0x00218, 0x0e21a, 0x20204, 0x2e207, 0x00219, 0x0e21b, 0x26206, 0x00216, 0x0021a, 0x0021c, 0x26207, 0x00217, 0x0021b, 0x0021d,
+    0x2e609, 0x1e20b, 0x1201e, 0x1201f, 0x1e20a, 0x1e20c, 0x1021f, 0x12020, 0x1e21a, 0x1e21c, 0x10221, 0x10223, 0x1e21b, 0x1e21d, 0x10222, 0x10224,
+    0x1822f, 0x1c231, 0x00238, 0x0c23a, 0x18230, 0x1c232, 0x00239, 0x0c23b, 0x04231, 0x00236, 0x0023a, 0x0023c, 0x04232, 0x00237, 0x0023b, 0x0023d,
+    0x12430, 0x1e432, 0x10242, 0x10244, 0x1c234, 0x1c235, 0x10243, 0x10245, 0x1c23a, 0x1c23c, 0x10246, 0x10248, 0x1c23b, 0x1c23d, 0x10247, 0x10249,
+    0x26308, 0x06218, 0x08318, 0x0231e, 0x06209, 0x06219, 0x0831a, 0x0021f, 0x26309, 0x0621a, 0x08319, 0x0231f, 0x0a30a, 0x0621b, 0x0831b, 0x02320,
+    0x20618, 0x1c21e, 0x00225, 0x10227, 0x2061a, 0x1c21f, 0x00226, 0x10228, 0x1821e, 0x18221, 0x00227, 0x00229, 0x1821f, 0x18222, 0x00228, 0x0022a,
+    0x2672e, 0x04238, 0x0023e, 0x00242, 0x04233, 0x04239, 0x0023f, 0x00243, 0x1a730, 0x0423a, 0x00240, 0x00244, 0x04234, 0x0423b, 0x00241, 0x00245,
+    0x1823e, 0x1c242, 0x0024a, 0x1024c, 0x1823f, 0x1c243, 0x0024b, 0x1024d, 0x18242, 0x18246, 0x0024c, 0x0024e, 0x18243, 0x18247, 0x0024d, 0x0024f,
+    0x20609, 0x1821a, 0x0631e, 0x00221, 0x1a20a, 0x1821b, 0x0421f, 0x00222, 0x0620b, 0x0621c, 0x0631f, 0x00223, 0x0620c, 0x0621d, 0x06320, 0x00224,
+    0x20619, 0x1e61f, 0x18227, 0x1c229, 0x2061b, 0x1c220, 0x18228, 0x1c22a, 0x1a61f, 0x18223, 0x04229, 0x0022b, 0x18220, 0x18224, 0x0422a, 0x0022c,
+    0x0a730, 0x1823a, 0x04242, 0x00246, 0x18234, 0x1823b, 0x04243, 0x00247, 0x06732, 0x0423c, 0x04244, 0x00248, 0x04235, 0x0423d, 0x04245, 0x00249,
+    0x18240, 0x1c244, 0x1824c, 0x1c24e, 0x18241, 0x1c245, 0x1824d, 0x1c24f, 0x18244, 0x18248, 0x0424e, 0x00250, 0x18245, 0x18249, 0x0424f, 0x01d14,
+    0x10a02, 0x16804, 0x08809, 0x2800a, 0x16a04, 0x16005, 0x2800b, 0x2800c, 0x08a09, 0x2820b, 0x1400d, 0x1400e, 0x2820a, 0x2820c, 0x1420e, 0x1400f,
+    0x2e809, 0x2a00a, 0x2a01a, 0x2a01b, 0x1600b, 0x1600c, 0x1601c, 0x1601d, 0x1401e, 0x1401f, 0x14021, 0x14022, 0x1621f, 0x14020, 0x14023, 0x14024,
+    0x2682e, 0x26830, 0x08133, 0x08134, 0x0213e, 0x02140, 0x0213f, 0x02141, 0x08138, 0x0813a, 0x08139, 0x0813b, 0x02142, 0x02144, 0x02143, 0x02145,
+    0x2e433, 0x22434, 0x2683f, 0x26841, 0x2243f, 0x22441, 0x02054, 0x02055, 0x02056, 0x02057, 0x02058, 0x02059, 0x0c058, 0x0c059, 0x0205a, 0x0205b,
+    0x2ea09, 0x1620b, 0x1601e, 0x1601f, 0x2a20a, 0x1620c, 0x1421f, 0x16020, 0x2a21a, 0x1621c, 0x14221, 0x14223, 0x2a21b, 0x1621d, 0x14222, 0x14224,
+    0x1200d, 0x1200e, 0x12021, 0x12022, 0x1220e, 0x1200f, 0x12023, 0x12024, 0x12221, 0x12223, 0x10051, 0x10052, 0x12222, 0x12224, 0x10252, 0x10053,
+    0x2e438, 0x2243a, 0x1e056, 0x1e057, 0x1e442, 0x1e444, 0x10058, 0x10059, 0x1005c, 0x1005d, 0x0c060, 0x0c061, 0x1005e, 0x1005f, 0x0c062, 0x0c063,
+    0x2e439, 0x2243b, 0x1e058, 0x1e059, 0x1e443, 0x1e445, 0x1e05a, 0x1e05b, 0x10060, 0x10061, 0x10064, 0x10065, 0x10062, 0x10063, 0x10066, 0x11f24,
+    0x26a2e, 0x0233e, 0x08338, 0x02342, 0x26a30, 0x02340, 0x0833a, 0x02344, 0x08333, 0x0233f, 0x08339, 0x02343, 0x08334, 0x02341, 0x0833b, 0x02345,
+    0x2e638, 0x1e642, 0x1025c, 0x1025e, 0x2263a, 0x1e644, 0x1025d, 0x1025f, 0x1e256, 0x10258, 0x0c260, 0x0c262, 0x1e257, 0x10259, 0x0c261, 0x0c263,
+    0x10067, 0x10068, 0x14168, 0x0c06a, 0x10268, 0x10069, 0x0c06b, 0x0c06c, 0x14368, 0x0e16b, 0x14169, 0x0e16c, 0x0e36a, 0x0c26c, 0x0e36c, 0x0c06d,
+    0x12468, 0x1006a, 0x1006e, 0x1006f, 0x1006b, 0x1006c, 0x10070, 0x10071, 0x0c072, 0x0c073, 0x0c075, 0x0c076, 0x10273, 0x0c074, 0x0c077, 0x01e45,
+    0x2e633, 0x2263f, 0x02256, 0x0c258, 0x22634, 0x22641, 0x02257, 0x0c259, 0x26a3f, 0x02254, 0x02258, 0x0225a, 0x26a41, 0x02255, 0x02259, 0x0225b,
+    0x2e639, 0x1e643, 0x10260, 0x10262, 0x2263b, 0x1e645, 0x10261, 0x10263, 0x1e258, 0x1e25a, 0x10264, 0x10266, 0x1e259, 0x1e25b, 0x10265, 0x11d24,
+    0x12668, 0x1026b, 0x10072, 0x10073, 0x1026a, 0x1026c, 0x0c273, 0x10074, 0x1026e, 0x10270, 0x0c275, 0x0c277, 0x1026f, 0x10271, 0x0c276, 0x01c45,
+    0x12669, 0x1246c, 0x10075, 0x10076, 0x1266c, 0x1006d, 0x10077, 0x1db45, 0x10275, 0x10277, 0x10078, 0x05a4e, 0x10276, 0x1d945, 0x0584e, 0x11d0f,
+    0x00b03, 0x02806, 0x02909, 0x0880b, 0x02a09, 0x2880b, 0x2400d, 0x2400e, 0x02b06, 0x02010, 0x28b0b, 0x02011, 0x08b0b, 0x14011, 0x2430e, 0x02012,
+    0x20818, 0x2c81a, 0x2401e, 0x2401f, 0x2801e, 0x2801f, 0x24021, 0x24022, 0x02025, 0x02026, 0x02027, 0x02028, 0x14027, 0x14028, 0x02029, 0x0202a,
+    0x2412f, 0x08131, 0x24130, 0x08132, 0x02138, 0x0213a, 0x02139, 0x0213b, 0x28131, 0x02136, 0x28132, 0x02137, 0x0e13a, 0x0213c, 0x0e13b, 0x0213d,
+    0x20838, 0x2c83a, 0x26842, 0x26844, 0x08056, 0x08057, 0x08058, 0x08059, 0x0205c, 0x0205d, 0x0205e, 0x0205f, 0x02060, 0x02061, 0x02062, 0x02063,
+    0x2422f, 0x28231, 0x02238, 0x0e23a, 0x24230, 0x28232, 0x02239, 0x0e23b, 0x08231, 0x02236, 0x0223a, 0x0223c, 0x08232, 0x02237, 0x0223b, 0x0223d,
+    0x2e838, 0x2e83a, 0x2a056, 0x2a057, 0x2a842, 0x2a844, 0x14058, 0x14059, 0x1405c, 0x1405d, 0x0e060, 0x0e061, 0x1405e, 0x1405f, 0x0e062, 0x0e063,
+    0x00079, 0x0007a, 0x0007b, 0x0007c, 0x0e07b, 0x0e07c, 0x0007d, 0x0007e, 0x0037a, 0x0007f, 0x0e37c, 0x00080, 0x0037c, 0x0e080, 0x0037e, 0x00081,
+    0x2007b, 0x2007c, 0x00082, 0x00083, 0x22082, 0x22083, 0x00084, 0x19f71, 0x00085, 0x00086, 0x00087, 0x00088, 0x0c087, 0x0c088, 0x00089, 0x01f3d,
+    0x20b18, 0x02325, 0x2831e, 0x14327, 0x2431e, 0x02327, 0x24321, 0x02329, 0x2cb1a, 0x02326, 0x2831f, 0x14328, 0x2431f, 0x02328, 0x24322, 0x0232a,
+    0x0008a, 0x0008b, 0x0218b, 0x0008c, 0x0228b, 0x0c08c, 0x0008d, 0x0008e, 0x0038b, 0x0218d, 0x0e18c, 0x0218e, 0x0038c, 0x0228e, 0x0038e, 0x0008f,
+    0x2eb38, 0x1435c, 0x2ab42, 0x1435e, 0x2a356, 0x0e360, 0x14358, 0x0e362, 0x2eb3a, 0x1435d, 0x2ab44, 0x1435f, 0x2a357, 0x0e361, 0x14359, 0x0e363,
+    0x00090, 0x00091, 0x00092, 0x00093, 0x00094, 0x00095, 0x00096, 0x00097, 0x0c391, 0x00098, 0x0c393, 0x19e65, 0x0c395, 0x00099, 0x0c397, 0x01e2a,
+    0x20b38, 0x0235c, 0x08356, 0x02360, 0x26b42, 0x0235e, 0x08358, 0x02362, 0x2cb3a, 0x0235d, 0x08357, 0x02361, 0x26b44, 0x0235f, 0x08359, 0x02363,
+    0x0c090, 0x0c091, 0x0c094, 0x0c095, 0x0c092, 0x0c093, 0x0c096, 0x0c097, 0x00391, 0x0c098, 0x00395, 0x0c099, 0x00393, 0x19d65, 0x00397, 0x01d2a,
+    0x2037b, 0x00385, 0x22382, 0x0c387, 0x00382, 0x00387, 0x00384, 0x00389, 0x2037c, 0x00386, 0x22383, 0x0c388, 0x00383, 0x00388, 0x19c71, 0x01c3d,
+    0x0009a, 0x0009b, 0x0009c, 0x05a77, 0x0c09c, 0x11977, 0x0009d, 0x19b4d, 0x0039b, 0x0009e, 0x11a77, 0x19a48, 0x05977, 0x19948, 0x1984d, 0x01d12,
+    0x00804, 0x02807, 0x0290a, 0x0880c, 0x0ea0a, 0x2880c, 0x2480e, 0x2400f, 0x02b0b, 0x24011, 0x1490e, 0x08012, 0x02a0e, 0x28012, 0x02013, 0x02014,
+    0x20819, 0x2c81b, 0x2681f, 0x24020, 0x2a81f, 0x28020, 0x24023, 0x24024, 0x24027, 0x24028, 0x08029, 0x0802a, 0x28029, 0x2802a, 0x0202b, 0x0202c,
+    0x0a830, 0x26832, 0x24134, 0x08135, 0x08142, 0x08144, 0x08143, 0x08145, 0x2413a, 0x0813c, 0x2413b, 0x0813d, 0x02146, 0x02148, 0x02147, 0x02149,
+    0x20839, 0x2c83b, 0x26843, 0x26845, 0x26058, 0x26059, 0x0805a, 0x0805b, 0x08060, 0x08061, 0x08062, 0x08063, 0x02064, 0x02065, 0x02066, 0x03f24,
+    0x12830, 0x16832, 0x14242, 0x14244, 0x28234, 0x28235, 0x14243, 0x14245, 0x2823a, 0x2823c, 0x14246, 0x14248, 0x2823b, 0x2823d, 0x14247, 0x14249,
+    0x2e839, 0x2e83b, 0x2a058, 0x2a059, 0x2a843, 0x2a845, 0x2a05a, 0x2a05b, 0x14060, 0x14061, 0x14064, 0x14065, 0x14062, 0x14063, 0x14066, 0x15f24,
+    0x2c07b, 0x2c07c, 0x02082, 0x02083, 0x2e082, 0x2e083, 0x02084, 0x25f71, 0x02085, 0x02086, 0x02087, 0x02088, 0x0e087, 0x0e088, 0x02089, 0x03f3d,
+    0x2007d, 0x2007e, 0x20084, 0x0bf71, 0x2e084, 0x13f71, 0x0009f, 0x25f55, 0x000a0, 0x000a1, 0x000a2, 0x0be5f, 0x0e0a2, 0x13d5f, 0x000a3, 0x01f1d,
+    0x2433e, 0x0234a, 0x28342, 0x1434c, 0x24342, 0x0234c, 0x24346, 0x0234e, 0x2433f, 0x0234b, 0x28343, 0x1434d, 0x24343, 0x0234d, 0x24347, 0x0234f,
+    0x02190, 0x02192, 0x02191, 0x02193, 0x0e291, 0x0e293, 0x02198, 0x25f65, 0x02194, 0x02196, 0x02195, 0x02197, 0x0e295, 0x0e297, 0x02199, 0x03f2a,
+    0x12968, 0x1416e, 0x1416a, 0x1416f, 0x0e172, 0x0e175, 0x0e173, 0x0e176, 0x1416b, 0x14170, 0x1416c, 0x14171, 0x14373, 0x0e177, 0x0e174, 0x03f45,
+    0x000a4, 0x000a5, 0x021a5, 0x0bf74, 0x000a6, 0x000a7, 0x000a8, 0x0bf59, 0x021a6, 0x021a8, 0x021a7, 0x07e59, 0x000a9, 0x15d93, 0x11c93, 0x03f20,
+    0x0aa68, 0x0226e, 0x08372, 0x02275, 0x0826a, 0x0226f, 0x02273, 0x02276, 0x0826b, 0x02270, 0x08373, 0x02277, 0x0826c, 0x02271, 0x08374, 0x0ff45,
+    0x0c0a4, 0x0c0a5, 0x0c0a6, 0x0c0a7, 0x0e2a5, 0x13d74, 0x0c0a8, 0x17f59, 0x0e2a6, 0x0e2a8, 0x0c0a9, 0x09e93, 0x0e2a7, 0x13d59, 0x05c93, 0x0dd20,
+    0x000aa, 0x000ab, 0x000ac, 0x000ad, 0x0c0ac, 0x0c0ad, 0x000ae, 0x25f6f, 0x023ab, 0x000af, 0x0e3ad, 0x09e83, 0x023ad, 0x05d83, 0x19c6f, 0x01c35,
+    0x000b0, 0x000b1, 0x000b2, 0x07f6c, 0x0c0b2, 0x13f6c, 0x01a9c, 0x19b41, 0x000b3, 0x01b9b, 0x11a75, 0x19a44, 0x05975, 0x1d944, 0x1984c, 0x01f0c,
+    0x00b01, 0x28108, 0x16303, 0x28109, 0x08303, 0x08209, 0x02306, 0x0230b, 0x24302, 0x02309, 0x16304, 0x1410a, 0x08304, 0x0230a, 0x02307, 0x0230c,
+    0x0202d, 0x0202e, 0x0202f, 0x02030, 0x1402f, 0x14030, 0x02031, 0x02032, 0x0032e, 0x02033, 0x10330, 0x02034, 0x00330, 0x0e034, 0x00332, 0x02035,
+    0x16108, 0x16118, 0x16109, 0x16119, 0x1e318, 0x0e11e, 0x1031a, 0x0e11f, 0x1e309, 0x1611a, 0x1610a, 0x1611b, 0x1e319, 0x0c31f, 0x1031b, 0x0e120,
+    0x2e52e, 0x1033e, 0x22530, 0x10340, 0x1c338, 0x0c342, 0x1033a, 0x0c344, 0x1c333, 0x1033f, 0x10334, 0x10341, 0x1c339, 0x0c343, 0x1033b, 0x0c345,
+    0x06308, 0x08218, 0x06318, 0x0031e, 0x26209, 0x08219, 0x0631a, 0x0221f, 0x06309, 0x0821a, 0x06319, 0x0031f, 0x0630a, 0x0821b, 0x0631b, 0x00320,
+    0x2662e, 0x0033e, 0x04338, 0x00342, 0x1a630, 0x00340, 0x0433a, 0x00344, 0x04333, 0x0033f, 0x04339, 0x00343, 0x04334, 0x00341, 0x0433b, 0x00345,
+    0x20718, 0x00325, 0x1c31e, 0x10327, 0x1831e, 0x00327, 0x18321, 0x00329, 0x2071a, 0x00326, 0x1c31f, 0x10328, 0x1831f, 0x00328, 0x18322, 0x0032a,
+    0x1833e, 0x0034a, 0x1c342, 0x1034c, 0x18342, 0x0034c, 0x18346, 0x0034e, 0x1833f, 0x0034b, 0x1c343, 0x1034d, 0x18343, 0x0034d, 0x18347, 0x0034f,
+    0x20303, 0x00318, 0x2e306, 0x0e31a, 0x26306, 0x0031a, 0x00316, 0x0031c, 0x20304, 0x00319, 0x2e307, 0x0e31b, 0x26307, 0x0031b, 0x00317, 0x0031d,
+    0x1832f, 0x00338, 0x1c331, 0x0c33a, 0x04331, 0x0033a, 0x00336, 0x0033c, 0x18330, 0x00339, 0x1c332, 0x0c33b, 0x04332, 0x0033b, 0x00337, 0x0033d,
+    0x2e709, 0x1211e, 0x1e30b, 0x1211f, 0x1e31a, 0x10321, 0x1e31c, 0x10323, 0x1e30a, 0x1031f, 0x1e30c, 0x12120, 0x1e31b, 0x10322, 0x1e31d, 0x10324,
+    0x12530, 0x10342, 0x1e532, 0x10344, 0x1c33a, 0x10346, 0x1c33c, 0x10348, 0x1c334, 0x10343, 0x1c335, 0x10345, 0x1c33b, 0x10347, 0x1c33d, 0x10349,
+    0x20709, 0x0431e, 0x1831a, 0x00321, 0x0630b, 0x0621f, 0x0631c, 0x00323, 0x1a30a, 0x0431f, 0x1831b, 0x00322, 0x0630c, 0x04320, 0x0631d, 0x00324,
+    0x0a630, 0x04342, 0x1833a, 0x00346, 0x06632, 0x04344, 0x0433c, 0x00348, 0x18334, 0x04343, 0x1833b, 0x00347, 0x04335, 0x04345, 0x0433d, 0x00349,
+    0x20719, 0x18327, 0x1e71f, 0x1c329, 0x1a71f, 0x04329, 0x18323, 0x0032b, 0x2071b, 0x18328, 0x1c320, 0x1c32a, 0x18320, 0x0432a, 0x18324, 0x0032c,
+    0x18340, 0x1834c, 0x1c344, 0x1c34e, 0x18344, 0x0434e, 0x18348, 0x00350, 0x18341, 0x1834d, 0x1c345, 0x1c34f, 0x18345, 0x0434f, 0x18349, 0x01c14,
+    0x00a03, 0x02809, 0x02906, 0x0890b, 0x02a06, 0x28a0b, 0x02110, 0x02111, 0x02b09, 0x2410d, 0x2890b, 0x2410e, 0x08a0b, 0x2420e, 0x14111, 0x02112,
+    0x2402f, 0x24030, 0x08031, 0x08032, 0x28031, 0x28032, 0x02036, 0x02037, 0x02038, 0x02039, 0x0203a, 0x0203b, 0x0e03a, 0x0e03b, 0x0203c, 0x0203d,
+    0x20918, 0x2411e, 0x2c91a, 0x2411f, 0x02125, 0x02127, 0x02126, 0x02128, 0x2811e, 0x24121, 0x2811f, 0x24122, 0x14127, 0x02129, 0x14128, 0x0212a,
+    0x20938, 0x26942, 0x2c93a, 0x26944, 0x0215c, 0x0215e, 0x0215d, 0x0215f, 0x08156, 0x08158, 0x08157, 0x08159, 0x02160, 0x02162, 0x02161, 0x02163,
+    0x20a18, 0x2821e, 0x02225, 0x14227, 0x2ca1a, 0x2821f, 0x02226, 0x14228, 0x2421e, 0x24221, 0x02227, 0x02229, 0x2421f, 0x24222, 0x02228, 0x0222a,
+    0x2ea38, 0x2aa42, 0x1425c, 0x1425e, 0x2ea3a, 0x2aa44, 0x1425d, 0x1425f, 0x2a256, 0x14258, 0x0e260, 0x0e262, 0x2a257, 0x14259, 0x0e261, 0x0e263,
+    0x0208a, 0x0208b, 0x0018b, 0x0208c, 0x0028b, 0x0e08c, 0x0208d, 0x0208e, 0x0238b, 0x0018d, 0x0c18c, 0x0018e, 0x0238c, 0x0028e, 0x0238e, 0x0208f,
+    0x00190, 0x00192, 0x00191, 0x00193, 0x0c291, 0x0c293, 0x00198, 0x19f65, 0x00194, 0x00196, 0x00195, 0x00197, 0x0c295, 0x0c297, 0x00199, 0x01f2a,
+    0x2432f, 0x02338, 0x28331, 0x0e33a, 0x08331, 0x0233a, 0x02336, 0x0233c, 0x24330, 0x02339, 0x28332, 0x0e33b, 0x08332, 0x0233b, 0x02337, 0x0233d,
+    0x00179, 0x0017b, 0x0017a, 0x0017c, 0x0027a, 0x0e27c, 0x0017f, 0x00180, 0x0e17b, 0x0017d, 0x0e17c, 0x0017e, 0x0027c, 0x0027e, 0x0e180, 0x00181,
+    0x2e938, 0x2a156, 0x2e93a, 0x2a157, 0x1415c, 0x0e160, 0x1415d, 0x0e161, 0x2a942, 0x14158, 0x2a944, 0x14159, 0x1415e, 0x0e162, 0x1415f, 0x0e163,
+    0x2017b, 0x00182, 0x2017c, 0x00183, 0x00185, 0x00187, 0x00186, 0x00188, 0x22182, 0x00184, 0x22183, 0x19e71, 0x0c187, 0x00189, 0x0c188, 0x01e3d,
+    0x20a38, 0x08256, 0x0225c, 0x02260, 0x2ca3a, 0x08257, 0x0225d, 0x02261, 0x26a42, 0x08258, 0x0225e, 0x02262, 0x26a44, 0x08259, 0x0225f, 0x02263,
+    0x2027b, 0x22282, 0x00285, 0x0c287, 0x2027c, 0x22283, 0x00286, 0x0c288, 0x00282, 0x00284, 0x00287, 0x00289, 0x00283, 0x19d71, 0x00288, 0x01d3d,
+    0x0c190, 0x0c194, 0x0c191, 0x0c195, 0x00291, 0x00295, 0x0c198, 0x0c199, 0x0c192, 0x0c196, 0x0c193, 0x0c197, 0x00293, 0x00297, 0x19c65, 0x01c2a,
+    0x0019a, 0x0019c, 0x0019b, 0x05b77, 0x0029b, 0x11b77, 0x0019e, 0x19b48, 0x0c19c, 0x0019d, 0x11877, 0x19a4d, 0x05877, 0x1994d, 0x19848, 0x01c12,
+    0x10b02, 0x08909, 0x16904, 0x2810a, 0x08b09, 0x1410d, 0x2830b, 0x1410e, 0x16b04, 0x2810b, 0x16105, 0x2810c, 0x2830a, 0x1430e, 0x2830c, 0x1410f,
+    0x2692e, 0x08033, 0x26930, 0x08034, 0x08038, 0x08039, 0x0803a, 0x0803b, 0x0203e, 0x0203f, 0x02040, 0x02041, 0x02042, 0x02043, 0x02044, 0x02045,
+    0x2e909, 0x2a11a, 0x2a10a, 0x2a11b, 0x1411e, 0x14121, 0x1411f, 0x14122, 0x1610b, 0x1611c, 0x1610c, 0x1611d, 0x1631f, 0x14123, 0x14120, 0x14124,
+    0x2e533, 0x2693f, 0x22534, 0x26941, 0x02156, 0x02158, 0x02157, 0x02159, 0x2253f, 0x02154, 0x22541, 0x02155, 0x0c158, 0x0215a, 0x0c159, 0x0215b,
+    0x26b2e, 0x08238, 0x0223e, 0x02242, 0x08233, 0x08239, 0x0223f, 0x02243, 0x26b30, 0x0823a, 0x02240, 0x02244, 0x08234, 0x0823b, 0x02241, 0x02245,
+    0x14067, 0x14068, 0x10168, 0x0e06a, 0x14268, 0x14069, 0x0e06b, 0x0e06c, 0x10368, 0x0c16b, 0x10169, 0x0c16c, 0x0c36a, 0x0e26c, 0x0c36c, 0x0e06d,
+    0x2e738, 0x1035c, 0x1e742, 0x1035e, 0x1e356, 0x0c360, 0x10358, 0x0c362, 0x2273a, 0x1035d, 0x1e744, 0x1035f, 0x1e357, 0x0c361, 0x10359, 0x0c363,
+    0x12568, 0x1016e, 0x1016a, 0x1016f, 0x0c172, 0x0c175, 0x0c173, 0x0c176, 0x1016b, 0x10170, 0x1016c, 0x10171, 0x10373, 0x0c177, 0x0c174, 0x01f45,
+    0x2eb09, 0x1611e, 0x1630b, 0x1611f, 0x2a31a, 0x14321, 0x1631c, 0x14323, 0x2a30a, 0x1431f, 0x1630c, 0x16120, 0x2a31b, 0x14322, 0x1631d, 0x14324,
+    0x2e538, 0x1e156, 0x2253a, 0x1e157, 0x1015c, 0x0c160, 0x1015d, 0x0c161, 0x1e542, 0x10158, 0x1e544, 0x10159, 0x1015e, 0x0c162, 0x1015f, 0x0c163,
+    0x1210d, 0x12121, 0x1210e, 0x12122, 0x12321, 0x10151, 0x12323, 0x10152, 0x1230e, 0x12123, 0x1210f, 0x12124, 0x12322, 0x10352, 0x12324, 0x10153,
+    0x2e539, 0x1e158, 0x2253b, 0x1e159, 0x10160, 0x10164, 0x10161, 0x10165, 0x1e543, 0x1e15a, 0x1e545, 0x1e15b, 0x10162, 0x10166, 0x10163, 0x11e24,
+    0x2e733, 0x02356, 0x2273f, 0x0c358, 0x26b3f, 0x02358, 0x02354, 0x0235a, 0x22734, 0x02357, 0x22741, 0x0c359, 0x26b41, 0x02359, 0x02355, 0x0235b,
+    0x12768, 0x10172, 0x1036b, 0x10173, 0x1036e, 0x0c375, 0x10370, 0x0c377, 0x1036a, 0x0c373, 0x1036c, 0x10174, 0x1036f, 0x0c376, 0x10371, 0x01d45,
+    0x2e739, 0x10360, 0x1e743, 0x10362, 0x1e358, 0x10364, 0x1e35a, 0x10366, 0x2273b, 0x10361, 0x1e745, 0x10363, 0x1e359, 0x10365, 0x1e35b, 0x11c24,
+    0x12769, 0x10175, 0x1256c, 0x10176, 0x10375, 0x10178, 0x10377, 0x05b4e, 0x1276c, 0x10177, 0x1016d, 0x1da45, 0x10376, 0x0594e, 0x1d845, 0x11c0f,
+    0x00904, 0x0890a, 0x02907, 0x0890c, 0x02a0b, 0x1480e, 0x24111, 0x08112, 0x0eb0a, 0x2490e, 0x2890c, 0x2410f, 0x02b0e, 0x02113, 0x28112, 0x02114,
+    0x0a930, 0x24034, 0x26932, 0x08035, 0x2403a, 0x2403b, 0x0803c, 0x0803d, 0x08042, 0x08043, 0x08044, 0x08045, 0x02046, 0x02047, 0x02048, 0x02049,
+    0x20919, 0x2691f, 0x2c91b, 0x24120, 0x24127, 0x08129, 0x24128, 0x0812a, 0x2a91f, 0x24123, 0x28120, 0x24124, 0x28129, 0x0212b, 0x2812a, 0x0212c,
+    0x20939, 0x26943, 0x2c93b, 0x26945, 0x08160, 0x08162, 0x08161, 0x08163, 0x26158, 0x0815a, 0x26159, 0x0815b, 0x02164, 0x02166, 0x02165, 0x03e24,
+    0x2423e, 0x28242, 0x0224a, 0x1424c, 0x2423f, 0x28243, 0x0224b, 0x1424d, 0x24242, 0x24246, 0x0224c, 0x0224e, 0x24243, 0x24247, 0x0224d, 0x0224f,
+    0x12868, 0x1406a, 0x1406e, 0x1406f, 0x1406b, 0x1406c, 0x14070, 0x14071, 0x0e072, 0x0e073, 0x0e075, 0x0e076, 0x14273, 0x0e074, 0x0e077, 0x03e45,
+    0x02090, 0x02091, 0x02092, 0x02093, 0x02094, 0x02095, 0x02096, 0x02097, 0x0e391, 0x02098, 0x0e393, 0x25e65, 0x0e395, 0x02099, 0x0e397, 0x03e2a,
+    0x020a4, 0x020a5, 0x001a5, 0x07f74, 0x020a6, 0x020a7, 0x020a8, 0x07f59, 0x001a6, 0x001a8, 0x001a7, 0x0be59, 0x020a9, 0x11d93, 0x15c93, 0x01f20,
+    0x12930, 0x14342, 0x16932, 0x14344, 0x2833a, 0x14346, 0x2833c, 0x14348, 0x28334, 0x14343, 0x28335, 0x14345, 0x2833b, 0x14347, 0x2833d, 0x14349,
+    0x2c17b, 0x02182, 0x2c17c, 0x02183, 0x02185, 0x02187, 0x02186, 0x02188, 0x2e182, 0x02184, 0x2e183, 0x25e71, 0x0e187, 0x02189, 0x0e188, 0x03e3d,
+    0x2e939, 0x2a158, 0x2e93b, 0x2a159, 0x14160, 0x14164, 0x14161, 0x14165, 0x2a943, 0x2a15a, 0x2a945, 0x2a15b, 0x14162, 0x14166, 0x14163, 0x15e24,
+    0x2017d, 0x20184, 0x2017e, 0x0be71, 0x001a0, 0x001a2, 0x001a1, 0x0bf5f, 0x2e184, 0x0019f, 0x13e71, 0x25e55, 0x0e1a2, 0x001a3, 0x13c5f, 0x01e1d,
+    0x0ab68, 0x02372, 0x0236e, 0x02375, 0x0836b, 0x08273, 0x02370, 0x02377, 0x0836a, 0x02373, 0x0236f, 0x02376, 0x0836c, 0x02374, 0x02371, 0x0fe45,
+    0x001aa, 0x001ac, 0x001ab, 0x001ad, 0x022ab, 0x0e2ad, 0x001af, 0x09f83, 0x0c1ac, 0x001ae, 0x0c1ad, 0x25e6f, 0x022ad, 0x19d6f, 0x05c83, 0x01d35,
+    0x0c1a4, 0x0c1a6, 0x0c1a5, 0x0c1a7, 0x0e3a6, 0x0c1a9, 0x0e3a8, 0x09f93, 0x0e3a5, 0x0c1a8, 0x13c74, 0x17e59, 0x0e3a7, 0x05d93, 0x13c59, 0x0dc20,
+    0x001b0, 0x001b2, 0x001b1, 0x07e6c, 0x001b3, 0x11b75, 0x01a9b, 0x19b44, 0x0c1b2, 0x01b9c, 0x13e6c, 0x19a41, 0x05875, 0x1994c, 0x1d844, 0x01e0c,
+    0x00a02, 0x28a09, 0x28b09, 0x0230d, 0x08a04, 0x2420a, 0x0830b, 0x0220e, 0x08b04, 0x0820b, 0x2430a, 0x0230e, 0x08305, 0x0820c, 0x0830c, 0x0230f,
+    0x2ea2e, 0x28033, 0x28038, 0x28039, 0x2ea30, 0x14034, 0x1403a, 0x1403b, 0x1403e, 0x1403f, 0x0e042, 0x0e043, 0x14040, 0x14041, 0x0e044, 0x0e045,
+    0x2eb2e, 0x28138, 0x28133, 0x28139, 0x1413e, 0x0e142, 0x1413f, 0x0e143, 0x2eb30, 0x1413a, 0x14134, 0x1413b, 0x14140, 0x0e144, 0x14141, 0x0e145,
+    0x02067, 0x02068, 0x02168, 0x02069, 0x00268, 0x0206a, 0x0206b, 0x0206c, 0x00368, 0x0216b, 0x0216a, 0x0216c, 0x00369, 0x0026c, 0x0036c, 0x0206d,
+    0x20a09, 0x2421a, 0x0a31e, 0x02221, 0x2620a, 0x2421b, 0x0821f, 0x02222, 0x2620b, 0x0821c, 0x0a31f, 0x02223, 0x2620c, 0x0821d, 0x0a320, 0x02224,
+    0x20633, 0x2ea3f, 0x00256, 0x0e258, 0x20634, 0x2ea41, 0x00257, 0x0e259, 0x1a63f, 0x00254, 0x00258, 0x0025a, 0x1a641, 0x00255, 0x00259, 0x0025b,
+    0x20738, 0x0035c, 0x04356, 0x00360, 0x1a742, 0x0035e, 0x04358, 0x00362, 0x2073a, 0x0035d, 0x04357, 0x00361, 0x1a744, 0x0035f, 0x04359, 0x00363,
+    0x0a668, 0x0026e, 0x04372, 0x00275, 0x0426a, 0x0026f, 0x00273, 0x00276, 0x0426b, 0x00270, 0x04373, 0x00277, 0x0426c, 0x00271, 0x04374, 0x0df45,
+    0x20b09, 0x0831e, 0x2431a, 0x02321, 0x2630b, 0x0a21f, 0x0831c, 0x02323, 0x2630a, 0x0831f, 0x2431b, 0x02322, 0x2630c, 0x08320, 0x0831d, 0x02324,
+    0x20638, 0x04256, 0x0025c, 0x00260, 0x2063a, 0x04257, 0x0025d, 0x00261, 0x1a642, 0x04258, 0x0025e, 0x00262, 0x1a644, 0x04259, 0x0025f, 0x00263,
+    0x20733, 0x00356, 0x2eb3f, 0x0e358, 0x1a73f, 0x00358, 0x00354, 0x0035a, 0x20734, 0x00357, 0x2eb41, 0x0e359, 0x1a741, 0x00359, 0x00355, 0x0035b,
+    0x0a768, 0x00372, 0x0036e, 0x00375, 0x0436b, 0x04273, 0x00370, 0x00377, 0x0436a, 0x00373, 0x0036f, 0x00376, 0x0436c, 0x00374, 0x00371, 0x0de45,
+    0x0a30d, 0x0a221, 0x0a321, 0x00351, 0x0a20e, 0x0a222, 0x0a323, 0x00252, 0x0a30e, 0x0a223, 0x0a322, 0x00352, 0x0a30f, 0x0a224, 0x0a324, 0x00353,
+    0x20639, 0x1a258, 0x04260, 0x00264, 0x2063b, 0x1a259, 0x04261, 0x00265, 0x1a643, 0x0425a, 0x04262, 0x00266, 0x1a645, 0x0425b, 0x04263, 0x01d24,
+    0x20739, 0x04360, 0x1a358, 0x00364, 0x1a743, 0x04362, 0x0435a, 0x00366, 0x2073b, 0x04361, 0x1a359, 0x00365, 0x1a745, 0x04363, 0x0435b, 0x01c24,
+    0x0a669, 0x04275, 0x04375, 0x00378, 0x0666c, 0x04276, 0x04377, 0x1db4e, 0x0676c, 0x04277, 0x04376, 0x1da4e, 0x0436d, 0x19945, 0x19845, 0x01c0f,
+    0x00a04, 0x14a0a, 0x0290b, 0x0280e, 0x02a07, 0x28a0c, 0x24211, 0x28212, 0x08a0a, 0x24a0e, 0x14b0e, 0x02213, 0x08a0c, 0x2420f, 0x08212, 0x02214,
+    0x12a30, 0x28034, 0x2803a, 0x2803b, 0x16a32, 0x28035, 0x2803c, 0x2803d, 0x14042, 0x14043, 0x14046, 0x14047, 0x14044, 0x14045, 0x14048, 0x14049,
+    0x2413e, 0x24142, 0x2413f, 0x24143, 0x0214a, 0x0214c, 0x0214b, 0x0214d, 0x28142, 0x24146, 0x28143, 0x24147, 0x1414c, 0x0214e, 0x1414d, 0x0214f,
+    0x0a868, 0x0806a, 0x0806b, 0x0806c, 0x0206e, 0x0206f, 0x02070, 0x02071, 0x02072, 0x02073, 0x08173, 0x02074, 0x02075, 0x02076, 0x02077, 0x0fd45,
+    0x20a19, 0x2aa1f, 0x24227, 0x28229, 0x2ca1b, 0x28220, 0x24228, 0x2822a, 0x26a1f, 0x24223, 0x08229, 0x0222b, 0x24220, 0x24224, 0x0822a, 0x0222c,
+    0x2ea39, 0x2aa43, 0x14260, 0x14262, 0x2ea3b, 0x2aa45, 0x14261, 0x14263, 0x2a258, 0x2a25a, 0x14264, 0x14266, 0x2a259, 0x2a25b, 0x14265, 0x15d24,
+    0x0e090, 0x0e091, 0x0e094, 0x0e095, 0x0e092, 0x0e093, 0x0e096, 0x0e097, 0x02391, 0x0e098, 0x02395, 0x0e099, 0x02393, 0x25d65, 0x02397, 0x03d2a,
+    0x0e0a4, 0x0e0a5, 0x0e0a6, 0x0e0a7, 0x0c2a5, 0x17d74, 0x0e0a8, 0x13f59, 0x0c2a6, 0x0c2a8, 0x0e0a9, 0x05e93, 0x0c2a7, 0x17d59, 0x09c93, 0x0fd20,
+    0x0aa30, 0x08342, 0x2433a, 0x02346, 0x26a32, 0x08344, 0x0833c, 0x02348, 0x24334, 0x08343, 0x2433b, 0x02347, 0x08335, 0x08345, 0x0833d, 0x02349,
+    0x2c27b, 0x2e282, 0x02285, 0x0e287, 0x2c27c, 0x2e283, 0x02286, 0x0e288, 0x02282, 0x02284, 0x02287, 0x02289, 0x02283, 0x25d71, 0x02288, 0x03d3d,
+    0x12b68, 0x14172, 0x1436b, 0x14173, 0x1436e, 0x0e375, 0x14370, 0x0e377, 0x1436a, 0x0e373, 0x1436c, 0x14174, 0x1436f, 0x0e376, 0x14371, 0x03d45,
+    0x021aa, 0x021ac, 0x021ab, 0x021ad, 0x002ab, 0x0c2ad, 0x021af, 0x05f83, 0x0e1ac, 0x021ae, 0x0e1ad, 0x19e6f, 0x002ad, 0x25d6f, 0x09c83, 0x03d35,
+    0x20a39, 0x26258, 0x08260, 0x02264, 0x2ca3b, 0x26259, 0x08261, 0x02265, 0x26a43, 0x0825a, 0x08262, 0x02266, 0x26a45, 0x0825b, 0x08263, 0x03d24,
+    0x2027d, 0x2e284, 0x002a0, 0x0e2a2, 0x2027e, 0x13d71, 0x002a1, 0x13f5f, 0x20284, 0x0029f, 0x002a2, 0x002a3, 0x0bd71, 0x25d55, 0x0bc5f, 0x01d1d,
+    0x023a4, 0x002a6, 0x023a6, 0x023a9, 0x002a5, 0x002a7, 0x023a8, 0x15f93, 0x023a5, 0x002a8, 0x023a7, 0x11e93, 0x07c74, 0x0bd59, 0x07c59, 0x01c20,
+    0x002b0, 0x0c2b2, 0x002b3, 0x05b75, 0x002b1, 0x13d6c, 0x0199b, 0x1db44, 0x002b2, 0x0db9c, 0x11875, 0x19a4c, 0x07d6c, 0x19941, 0x19844, 0x01d0c,
+    0x00b04, 0x0280b, 0x14b0a, 0x0290e, 0x02a0a, 0x14a0e, 0x24b0e, 0x02313, 0x02b07, 0x24311, 0x28b0c, 0x28312, 0x08b0c, 0x08312, 0x2430f, 0x02314,
+    0x2403e, 0x2403f, 0x24042, 0x24043, 0x28042, 0x28043, 0x24046, 0x24047, 0x0204a, 0x0204b, 0x0204c, 0x0204d, 0x1404c, 0x1404d, 0x0204e, 0x0204f,
+    0x12b30, 0x2813a, 0x28134, 0x2813b, 0x14142, 0x14146, 0x14143, 0x14147, 0x16b32, 0x2813c, 0x28135, 0x2813d, 0x14144, 0x14148, 0x14145, 0x14149,
+    0x0a968, 0x0816b, 0x0816a, 0x0816c, 0x08072, 0x08073, 0x02173, 0x08074, 0x0216e, 0x02170, 0x0216f, 0x02171, 0x02175, 0x02177, 0x02176, 0x0fc45,
+    0x0ab30, 0x2423a, 0x08242, 0x02246, 0x24234, 0x2423b, 0x08243, 0x02247, 0x26b32, 0x0823c, 0x08244, 0x02248, 0x08235, 0x0823d, 0x08245, 0x02249,
+    0x12a68, 0x1426b, 0x14072, 0x14073, 0x1426a, 0x1426c, 0x0e273, 0x14074, 0x1426e, 0x14270, 0x0e275, 0x0e277, 0x1426f, 0x14271, 0x0e276, 0x03c45,
+    0x2c37b, 0x02385, 0x2e382, 0x0e387, 0x02382, 0x02387, 0x02384, 0x02389, 0x2c37c, 0x02386, 0x2e383, 0x0e388, 0x02383, 0x02388, 0x25c71, 0x03c3d,
+    0x020aa, 0x020ab, 0x020ac, 0x020ad, 0x0e0ac, 0x0e0ad, 0x020ae, 0x19f6f, 0x003ab, 0x020af, 0x0c3ad, 0x05e83, 0x003ad, 0x09d83, 0x25c6f, 0x03c35,
+    0x20b19, 0x24327, 0x2ab1f, 0x28329, 0x26b1f, 0x08329, 0x24323, 0x0232b, 0x2cb1b, 0x24328, 0x28320, 0x2832a, 0x24320, 0x0832a, 0x24324, 0x0232c,
+    0x0e190, 0x0e194, 0x0e191, 0x0e195, 0x02291, 0x02295, 0x0e198, 0x0e199, 0x0e192, 0x0e196, 0x0e193, 0x0e197, 0x02293, 0x02297, 0x25c65, 0x03c2a,
+    0x2eb39, 0x14360, 0x2ab43, 0x14362, 0x2a358, 0x14364, 0x2a35a, 0x14366, 0x2eb3b, 0x14361, 0x2ab45, 0x14363, 0x2a359, 0x14365, 0x2a35b, 0x15c24,
+    0x0e1a4, 0x0e1a6, 0x0e1a5, 0x0e1a7, 0x0c3a6, 0x0e1a9, 0x0c3a8, 0x05f93, 0x0c3a5, 0x0e1a8, 0x17c74, 0x13e59, 0x0c3a7, 0x09d93, 0x17c59, 0x0fc20,
+    0x20b39, 0x08360, 0x26358, 0x02364, 0x26b43, 0x08362, 0x0835a, 0x02366, 0x2cb3b, 0x08361, 0x26359, 0x02365, 0x26b45, 0x08363, 0x0835b, 0x03c24,
+    0x003a4, 0x022a6, 0x003a6, 0x003a9, 0x022a5, 0x022a7, 0x003a8, 0x11f93, 0x003a5, 0x022a8, 0x003a7, 0x15e93, 0x0bc74, 0x07d59, 0x0bc59, 0x03c20,
+    0x2037d, 0x003a0, 0x2e384, 0x0e3a2, 0x20384, 0x003a2, 0x0039f, 0x003a3, 0x2037e, 0x003a1, 0x13c71, 0x13e5f, 0x0bc71, 0x0bd5f, 0x25c55, 0x01c1d,
+    0x003b0, 0x003b3, 0x0c3b2, 0x05a75, 0x003b2, 0x11975, 0x0da9c, 0x19b4c, 0x003b1, 0x0189b, 0x13c6c, 0x1da44, 0x07c6c, 0x19944, 0x19841, 0x01c0c,
+    0x00a05, 0x0280c, 0x0290c, 0x0290f, 0x02a0c, 0x14a0f, 0x02b12, 0x02814, 0x02b0c, 0x02a12, 0x14b0f, 0x02914, 0x02a0f, 0x02a14, 0x02b14, 0x02015,
+    0x24040, 0x24041, 0x24044, 0x24045, 0x28044, 0x28045, 0x24048, 0x24049, 0x2404c, 0x2404d, 0x0804e, 0x0804f, 0x2804e, 0x2804f, 0x02050, 0x03f14,
+    0x24140, 0x24144, 0x24141, 0x24145, 0x2414c, 0x0814e, 0x2414d, 0x0814f, 0x28144, 0x24148, 0x28145, 0x24149, 0x2814e, 0x02150, 0x2814f, 0x03e14,
+    0x0a969, 0x0a86c, 0x0a96c, 0x0806d, 0x08075, 0x08076, 0x08077, 0x25745, 0x08175, 0x08177, 0x08176, 0x25645, 0x02078, 0x2954e, 0x2944e, 0x03f0f,
+    0x24240, 0x28244, 0x2424c, 0x2824e, 0x24241, 0x28245, 0x2424d, 0x2824f, 0x24244, 0x24248, 0x0824e, 0x02250, 0x24245, 0x24249, 0x0824f, 0x03d14,
+    0x12a69, 0x1686c, 0x14075, 0x14076, 0x16a6c, 0x1406d, 0x14077, 0x29745, 0x14275, 0x14277, 0x14078, 0x0964e, 0x14276, 0x29545, 0x0944e, 0x15d0f,
+    0x0209a, 0x0209b, 0x0209c, 0x09677, 0x0e09c, 0x15577, 0x0209d, 0x2574d, 0x0239b, 0x0209e, 0x15677, 0x25648, 0x09577, 0x25548, 0x2544d, 0x03d12,
+    0x020b0, 0x020b1, 0x020b2, 0x0bf6c, 0x0e0b2, 0x17f6c, 0x0369c, 0x25741, 0x020b3, 0x0379b, 0x15675, 0x25644, 0x09575, 0x29544, 0x2544c, 0x03f0c,
+    0x24340, 0x2434c, 0x28344, 0x2834e, 0x24344, 0x0834e, 0x24348, 0x02350, 0x24341, 0x2434d, 0x28345, 0x2834f, 0x24345, 0x0834f, 0x24349, 0x03c14,
+    0x0219a, 0x0219c, 0x0219b, 0x09777, 0x0229b, 0x15777, 0x0219e, 0x25748, 0x0e19c, 0x0219d, 0x15477, 0x2564d, 0x09477, 0x2554d, 0x25448, 0x03c12,
+    0x12b69, 0x14175, 0x1696c, 0x14176, 0x14375, 0x14178, 0x14377, 0x0974e, 0x16b6c, 0x14177, 0x1416d, 0x29645, 0x14376, 0x0954e, 0x29445, 0x15c0f,
+    0x021b0, 0x021b2, 0x021b1, 0x0be6c, 0x021b3, 0x15775, 0x0369b, 0x25744, 0x0e1b2, 0x0379c, 0x17e6c, 0x25641, 0x09475, 0x2554c, 0x29444, 0x03e0c,
+    0x0aa69, 0x08275, 0x08375, 0x02378, 0x0aa6c, 0x08276, 0x08377, 0x2974e, 0x0ab6c, 0x08277, 0x08376, 0x2964e, 0x0836d, 0x25545, 0x25445, 0x03c0f,
+    0x022b0, 0x0e2b2, 0x022b3, 0x09775, 0x022b1, 0x17d6c, 0x0359b, 0x29744, 0x022b2, 0x0f79c, 0x15475, 0x2564c, 0x0bd6c, 0x25541, 0x25444, 0x03d0c,
+    0x023b0, 0x023b3, 0x0e3b2, 0x09675, 0x023b2, 0x15575, 0x0f69c, 0x2574c, 0x023b1, 0x0349b, 0x17c6c, 0x29644, 0x0bc6c, 0x25544, 0x25441, 0x03c0c,
+    0x000b4, 0x037b0, 0x036b0, 0x0bf69, 0x035b0, 0x13d69, 0x0369a, 0x25740, 0x034b0, 0x0379a, 0x13c69, 0x25640, 0x0bc69, 0x25540, 0x25440, 0x01c05,
+    0x00c01, 0x20403, 0x20008, 0x20009, 0x2e008, 0x2e009, 0x20018, 0x20019, 0x2612d, 0x0a12f, 0x2612e, 0x0a130, 0x2e22e, 0x12230, 0x1843e, 0x18440,
+    0x24402, 0x20404, 0x06409, 0x2000a, 0x1e409, 0x2200a, 0x2001a, 0x2001b, 0x0042e, 0x18430, 0x06133, 0x06134, 0x1e233, 0x12234, 0x1843f, 0x18441,
+    0x08403, 0x26406, 0x26509, 0x0640b, 0x1e418, 0x1e41a, 0x1a01e, 0x1a01f, 0x1a12f, 0x06131, 0x1a130, 0x06132, 0x1c438, 0x1c43a, 0x18442, 0x18444,
+    0x08404, 0x26407, 0x0a50a, 0x0640c, 0x1e419, 0x1e41b, 0x1841f, 0x1a020, 0x00430, 0x04432, 0x1a134, 0x06135, 0x1c439, 0x1c43b, 0x18443, 0x18445,
+    0x16403, 0x2e406, 0x06418, 0x1841a, 0x16609, 0x1e40b, 0x1e01e, 0x1e01f, 0x2222f, 0x1e231, 0x04438, 0x1843a, 0x22230, 0x1e232, 0x1c442, 0x1c444,
+    0x16404, 0x2e407, 0x06419, 0x1841b, 0x1660a, 0x1e40c, 0x1c41f, 0x1e020, 0x10430, 0x1c432, 0x04439, 0x1843b, 0x1e234, 0x1e235, 0x1c443, 0x1c445,
+    0x02406, 0x00416, 0x0641a, 0x0641c, 0x1041a, 0x1e41c, 0x18421, 0x18423, 0x02731, 0x00436, 0x0443a, 0x0443c, 0x1043a, 0x1c43c, 0x18446, 0x18448,
+    0x02407, 0x00417, 0x0641b, 0x0641d, 0x1041b, 0x1e41d, 0x18422, 0x18424, 0x00432, 0x00437, 0x0443b, 0x0443d, 0x1043b, 0x1c43d, 0x18447, 0x18449,
+    0x28608, 0x00418, 0x08518, 0x0651e, 0x16618, 0x1261e, 0x00425, 0x18427, 0x0272e, 0x00438, 0x0043e, 0x04442, 0x1043e, 0x10442, 0x0044a, 0x1844c,
+    0x02409, 0x00419, 0x0851a, 0x0441f, 0x1661a, 0x1041f, 0x00426, 0x18428, 0x02733, 0x00439, 0x0043f, 0x04443, 0x1043f, 0x10443, 0x0044b, 0x1844d,
+    0x08509, 0x0041a, 0x08519, 0x0651f, 0x0e61e, 0x10421, 0x00427, 0x04429, 0x14730, 0x0043a, 0x00440, 0x04444, 0x0c442, 0x10446, 0x0044c, 0x0444e,
+    0x0850a, 0x0041b, 0x0851b, 0x06520, 0x0c41f, 0x10422, 0x00428, 0x0442a, 0x0e734, 0x0043b, 0x00441, 0x04445, 0x0c443, 0x10447, 0x0044d, 0x0444f,
+    0x28609, 0x0e41a, 0x0251e, 0x00421, 0x16619, 0x1261f, 0x10427, 0x1c429, 0x02730, 0x0c43a, 0x00442, 0x00446, 0x10440, 0x10444, 0x1044c, 0x1c44e,
+    0x1460a, 0x0e41b, 0x0041f, 0x00422, 0x1661b, 0x12620, 0x10428, 0x1c42a, 0x02734, 0x0c43b, 0x00443, 0x00447, 0x10441, 0x10445, 0x1044d, 0x1c44f,
+    0x0240b, 0x0041c, 0x0251f, 0x00423, 0x0e61f, 0x10423, 0x00429, 0x0042b, 0x02732, 0x0043c, 0x00444, 0x00448, 0x0c444, 0x10448, 0x0044e, 0x00450,
+    0x0240c, 0x0041d, 0x02520, 0x00424, 0x0e620, 0x10424, 0x0042a, 0x0042c, 0x02735, 0x0043d, 0x00445, 0x00449, 0x0c445, 0x10449, 0x0044f, 0x01b14,
+    0x18c02, 0x20804, 0x26809, 0x2c00a, 0x16809, 0x2e00a, 0x2c01a, 0x2c01b, 0x0282e, 0x24830, 0x26133, 0x0a134, 0x16233, 0x16234, 0x2483f, 0x24841,
+    0x20c04, 0x20005, 0x2000b, 0x2000c, 0x2e00b, 0x2e00c, 0x2001c, 0x2001d, 0x0a13e, 0x0a140, 0x0a13f, 0x0a141, 0x1223f, 0x12241, 0x24054, 0x24055,
+    0x26c09, 0x2040b, 0x1a00d, 0x1a00e, 0x2001e, 0x2001f, 0x1a021, 0x1a022, 0x26138, 0x0a13a, 0x26139, 0x0a13b, 0x06056, 0x06057, 0x06058, 0x06059,
+    0x2c40a, 0x2040c, 0x1a40e, 0x1a00f, 0x2241f, 0x20020, 0x1a023, 0x1a024, 0x06142, 0x06144, 0x06143, 0x06145, 0x18058, 0x18059, 0x0605a, 0x0605b,
+    0x16c09, 0x2e40b, 0x2201e, 0x2201f, 0x2200d, 0x2200e, 0x22021, 0x22022, 0x16238, 0x1623a, 0x1c056, 0x1c057, 0x16239, 0x1623b, 0x12058, 0x12059,
+    0x2e40a, 0x2e40c, 0x2041f, 0x22020, 0x2240e, 0x2200f, 0x22023, 0x22024, 0x12242, 0x12244, 0x1c058, 0x1c059, 0x12243, 0x12245, 0x1c05a, 0x1c05b,
+    0x2c41a, 0x2041c, 0x1a421, 0x1a423, 0x22421, 0x22423, 0x18051, 0x18052, 0x1805c, 0x1805d, 0x18060, 0x18061, 0x1c060, 0x1c061, 0x18064, 0x18065,
+    0x2c41b, 0x2041d, 0x1a422, 0x1a424, 0x22422, 0x22424, 0x18452, 0x18053, 0x1805e, 0x1805f, 0x18062, 0x18063, 0x1c062, 0x1c063, 0x18066, 0x19f24,
+    0x02c2e, 0x1263e, 0x26538, 0x06542, 0x16638, 0x12642, 0x1845c, 0x1845e, 0x18067, 0x18068, 0x1a168, 0x1806a, 0x22268, 0x1c06a, 0x1806e, 0x1806f,
+    0x24c30, 0x12640, 0x0a53a, 0x06544, 0x1663a, 0x12644, 0x1845d, 0x1845f, 0x18468, 0x18069, 0x1806b, 0x1806c, 0x1c06b, 0x1c06c, 0x18070, 0x18071,
+    0x26533, 0x0a53f, 0x26539, 0x06543, 0x1c456, 0x1c458, 0x18460, 0x18462, 0x1a568, 0x1a16b, 0x1a169, 0x1a16c, 0x18072, 0x18073, 0x18075, 0x18076,
+    0x0a534, 0x0a541, 0x0a53b, 0x06545, 0x1c457, 0x1c459, 0x18461, 0x18463, 0x1a56a, 0x1846c, 0x1a56c, 0x1806d, 0x1c473, 0x18074, 0x18077, 0x05e45,
+    0x16633, 0x1263f, 0x06456, 0x18458, 0x16639, 0x12643, 0x1c460, 0x1c462, 0x22668, 0x1e26b, 0x1c072, 0x1c073, 0x22269, 0x1e26c, 0x1c075, 0x1c076,
+    0x16634, 0x12641, 0x06457, 0x18459, 0x1663b, 0x12645, 0x1c461, 0x1c463, 0x1e66a, 0x1c46c, 0x18473, 0x1c074, 0x1e66c, 0x1c06d, 0x1c077, 0x11d45,
+    0x24c3f, 0x24454, 0x06458, 0x0645a, 0x12458, 0x1c45a, 0x18464, 0x18466, 0x1846e, 0x18470, 0x18475, 0x18477, 0x1c475, 0x1c477, 0x18078, 0x01c4e,
+    0x24c41, 0x24455, 0x06459, 0x0645b, 0x12459, 0x1c45b, 0x18465, 0x19b24, 0x1846f, 0x18471, 0x18476, 0x05a45, 0x1c476, 0x11945, 0x0184e, 0x19f0f,
+    0x06d03, 0x26806, 0x06909, 0x2680b, 0x16818, 0x2a81a, 0x2601e, 0x2601f, 0x2612f, 0x26131, 0x26130, 0x26132, 0x28838, 0x2883a, 0x24842, 0x24844,
+    0x06c09, 0x2080b, 0x2600d, 0x2600e, 0x2c01e, 0x2c01f, 0x26021, 0x26022, 0x06138, 0x0613a, 0x06139, 0x0613b, 0x24056, 0x24057, 0x0a058, 0x0a059,
+    0x26d06, 0x26010, 0x20d0b, 0x0a011, 0x26025, 0x26026, 0x0a027, 0x0a028, 0x20131, 0x26136, 0x20132, 0x26137, 0x0a05c, 0x0a05d, 0x0a05e, 0x0a05f,
+    0x26d0b, 0x1a011, 0x2650e, 0x06012, 0x1a027, 0x1a028, 0x06029, 0x0602a, 0x1a13a, 0x0613c, 0x1a13b, 0x0613d, 0x06060, 0x06061, 0x06062, 0x06063,
+    0x2642f, 0x20431, 0x06438, 0x1a43a, 0x16838, 0x2a83a, 0x20056, 0x20057, 0x06079, 0x0607a, 0x0607b, 0x0607c, 0x1607b, 0x1607c, 0x04082, 0x04083,
+    0x26430, 0x20432, 0x06439, 0x1a43b, 0x2e842, 0x2e844, 0x20058, 0x20059, 0x1807b, 0x1807c, 0x0607d, 0x0607e, 0x18082, 0x18083, 0x04084, 0x11f71,
+    0x26431, 0x26436, 0x0643a, 0x0643c, 0x1a05c, 0x1a05d, 0x1a060, 0x1a061, 0x0657a, 0x0607f, 0x1857c, 0x06080, 0x04085, 0x04086, 0x04087, 0x04088,
+    0x26432, 0x26437, 0x0643b, 0x0643d, 0x1a05e, 0x1a05f, 0x1a062, 0x1a063, 0x0657c, 0x18080, 0x0657e, 0x06081, 0x18087, 0x18088, 0x04089, 0x05f3d,
+    0x16d18, 0x26525, 0x2c51e, 0x1a527, 0x0408a, 0x0408b, 0x0618b, 0x0408c, 0x16d38, 0x1a55c, 0x2ed42, 0x1a55e, 0x04090, 0x04091, 0x04092, 0x04093,
+    0x2651e, 0x0a527, 0x26521, 0x06529, 0x0648b, 0x1808c, 0x0408d, 0x0408e, 0x20556, 0x1a560, 0x20558, 0x1a562, 0x04094, 0x04095, 0x04096, 0x04097,
+    0x2ad1a, 0x26526, 0x2c51f, 0x1a528, 0x0458b, 0x0618d, 0x1a18c, 0x0618e, 0x2ad3a, 0x1a55d, 0x2ed44, 0x1a55f, 0x18591, 0x04098, 0x18593, 0x11e65,
+    0x2651f, 0x0a528, 0x26522, 0x0652a, 0x0458c, 0x0648e, 0x0458e, 0x0408f, 0x20557, 0x1a561, 0x20559, 0x1a563, 0x18595, 0x04099, 0x18597, 0x05e2a,
+    0x28d38, 0x0a55c, 0x24556, 0x06560, 0x18090, 0x18091, 0x18094, 0x18095, 0x1657b, 0x04585, 0x18582, 0x18587, 0x0409a, 0x0409b, 0x0409c, 0x01c77,
+    0x24d42, 0x0a55e, 0x0a558, 0x06562, 0x18092, 0x18093, 0x18096, 0x18097, 0x04582, 0x04587, 0x04584, 0x04589, 0x1809c, 0x1d977, 0x0409d, 0x11d4d,
+    0x28d3a, 0x0a55d, 0x24557, 0x06561, 0x04591, 0x18098, 0x04595, 0x18099, 0x1657c, 0x04586, 0x18583, 0x18588, 0x0459b, 0x0409e, 0x1dc77, 0x11c48,
+    0x24d44, 0x0a55f, 0x0a559, 0x06563, 0x04593, 0x11b65, 0x04597, 0x05b2a, 0x04583, 0x04588, 0x11a71, 0x05a3d, 0x01977, 0x11948, 0x1184d, 0x05e12,
+    0x06804, 0x26807, 0x0690a, 0x2680c, 0x16819, 0x2a81b, 0x2481f, 0x26020, 0x02830, 0x08832, 0x26134, 0x26135, 0x28839, 0x2883b, 0x24843, 0x24845,
+    0x1ac0a, 0x2080c, 0x2680e, 0x2600f, 0x2e81f, 0x2c020, 0x26023, 0x26024, 0x0a142, 0x0a144, 0x0a143, 0x0a145, 0x24058, 0x24059, 0x2405a, 0x2405b,
+    0x06d0b, 0x26011, 0x1a90e, 0x26012, 0x26027, 0x26028, 0x26029, 0x2602a, 0x2613a, 0x2613c, 0x2613b, 0x2613d, 0x0a060, 0x0a061, 0x0a062, 0x0a063,
+    0x0ac0e, 0x20012, 0x26013, 0x26014, 0x20029, 0x2002a, 0x2602b, 0x2602c, 0x0a146, 0x0a148, 0x0a147, 0x0a149, 0x0a064, 0x0a065, 0x0a066, 0x0bf24,
+    0x22830, 0x2e832, 0x20442, 0x20444, 0x16839, 0x2a83b, 0x2e058, 0x2e059, 0x2a07b, 0x2a07c, 0x06082, 0x06083, 0x1607d, 0x1607e, 0x28084, 0x03f71,
+    0x2c434, 0x20435, 0x20443, 0x20445, 0x2e843, 0x2e845, 0x2005a, 0x2005b, 0x1a082, 0x1a083, 0x06084, 0x27f71, 0x16084, 0x23f71, 0x0609f, 0x03f55,
+    0x2c43a, 0x2043c, 0x1a446, 0x1a448, 0x20060, 0x20061, 0x1a064, 0x1a065, 0x06085, 0x06086, 0x06087, 0x06088, 0x060a0, 0x060a1, 0x060a2, 0x03e5f,
+    0x2c43b, 0x2043d, 0x1a447, 0x1a449, 0x20062, 0x20063, 0x1a066, 0x1bf24, 0x1a087, 0x1a088, 0x06089, 0x07f3d, 0x180a2, 0x23b5f, 0x060a3, 0x07f1d,
+    0x2653e, 0x2654a, 0x2c542, 0x1a54c, 0x06190, 0x06192, 0x06191, 0x06193, 0x22968, 0x1a16e, 0x2016a, 0x1a16f, 0x040a4, 0x040a5, 0x061a5, 0x09f74,
+    0x26542, 0x0a54c, 0x26546, 0x0654e, 0x1a491, 0x1a493, 0x06198, 0x27f65, 0x1a172, 0x1a175, 0x1a173, 0x1a176, 0x040a6, 0x040a7, 0x040a8, 0x09f59,
+    0x2653f, 0x2654b, 0x2c543, 0x1a54d, 0x06194, 0x06196, 0x06195, 0x06197, 0x2016b, 0x1a170, 0x2016c, 0x1a171, 0x061a6, 0x061a8, 0x061a7, 0x03e59,
+    0x26543, 0x0a54d, 0x26547, 0x0654f, 0x1a495, 0x1a497, 0x06199, 0x07f2a, 0x20573, 0x1a177, 0x1a174, 0x07f45, 0x040a9, 0x21b93, 0x1da93, 0x07f20,
+    0x02c68, 0x0a46e, 0x0a572, 0x06475, 0x180a4, 0x180a5, 0x180a6, 0x180a7, 0x040aa, 0x040ab, 0x040ac, 0x040ad, 0x040b0, 0x040b1, 0x040b2, 0x03f6c,
+    0x0a46a, 0x0a46f, 0x06473, 0x06476, 0x1a4a5, 0x23f74, 0x180a8, 0x23f59, 0x180ac, 0x180ad, 0x040ae, 0x27f6f, 0x180b2, 0x1ff6c, 0x05c9c, 0x11d41,
+    0x0a46b, 0x0a470, 0x0a573, 0x06477, 0x1a4a6, 0x1a4a8, 0x180a9, 0x0be93, 0x065ab, 0x040af, 0x1a5ad, 0x0be83, 0x040b3, 0x05d9b, 0x1dc75, 0x0dc44,
+    0x0a46c, 0x0a471, 0x0a574, 0x1bf45, 0x1a4a7, 0x1fb59, 0x01a93, 0x1bf20, 0x065ad, 0x01b83, 0x11a6f, 0x07f35, 0x01975, 0x11944, 0x1184c, 0x05f0c,
+    0x1ee03, 0x2e806, 0x08818, 0x2481a, 0x1ea09, 0x1680b, 0x2a01e, 0x2a01f, 0x2e22f, 0x16231, 0x08838, 0x2483a, 0x2e230, 0x16232, 0x28842, 0x28844,
+    0x1ec09, 0x2e80b, 0x2e01e, 0x2e01f, 0x2e00d, 0x2e00e, 0x2e021, 0x2e022, 0x1e238, 0x1223a, 0x16056, 0x16057, 0x1e239, 0x1223b, 0x16058, 0x16059,
+    0x2e42f, 0x2e431, 0x26838, 0x2683a, 0x1e438, 0x1e43a, 0x2c056, 0x2c057, 0x08079, 0x0807a, 0x0807b, 0x0807c, 0x1007b, 0x1007c, 0x08082, 0x08083,
+    0x2e430, 0x2e432, 0x2c842, 0x2c844, 0x1e439, 0x1e43b, 0x22058, 0x22059, 0x1e07b, 0x1e07c, 0x0a082, 0x0a083, 0x1e07d, 0x1e07e, 0x1c084, 0x01f71,
+    0x2ee06, 0x2e010, 0x2e025, 0x2e026, 0x2ee0b, 0x12011, 0x12027, 0x12028, 0x2e231, 0x2e236, 0x1205c, 0x1205d, 0x2e232, 0x2e237, 0x1205e, 0x1205f,
+    0x16e0b, 0x22011, 0x22027, 0x22028, 0x2e60e, 0x1e012, 0x1e029, 0x1e02a, 0x1e23a, 0x1e23c, 0x12060, 0x12061, 0x1e23b, 0x1e23d, 0x12062, 0x12063,
+    0x16431, 0x2e436, 0x2205c, 0x2205d, 0x1243a, 0x1e43c, 0x1e060, 0x1e061, 0x0867a, 0x1e07f, 0x1c085, 0x1c086, 0x1e67c, 0x10080, 0x10087, 0x10088,
+    0x16432, 0x2e437, 0x2205e, 0x2205f, 0x1243b, 0x1e43d, 0x1e062, 0x1e063, 0x1067c, 0x1e080, 0x1c087, 0x1c088, 0x1e67e, 0x1e081, 0x1c089, 0x1df3d,
+    0x08e18, 0x2e625, 0x1c08a, 0x1c08b, 0x2e61e, 0x22627, 0x1e28b, 0x1008c, 0x26e38, 0x2265c, 0x10090, 0x10091, 0x2ce42, 0x2265e, 0x10092, 0x10093,
+    0x2a61e, 0x12627, 0x1e48b, 0x1c08c, 0x2e621, 0x1e629, 0x1c08d, 0x1c08e, 0x2c656, 0x1e660, 0x10094, 0x10095, 0x22658, 0x1e662, 0x10096, 0x10097,
+    0x08e38, 0x1265c, 0x1c090, 0x1c091, 0x16656, 0x12660, 0x1c094, 0x1c095, 0x0867b, 0x1c685, 0x1c09a, 0x1c09b, 0x0a682, 0x1c687, 0x1009c, 0x0dc77,
+    0x28e42, 0x1265e, 0x1c092, 0x1c093, 0x16658, 0x12662, 0x1c096, 0x1c097, 0x08682, 0x10687, 0x1c09c, 0x19a77, 0x1c684, 0x1c689, 0x1c09d, 0x01e4d,
+    0x24e1a, 0x2e626, 0x1c68b, 0x1e28d, 0x2e61f, 0x22628, 0x1e28c, 0x1e28e, 0x26e3a, 0x2265d, 0x1c691, 0x10098, 0x2ce44, 0x2265f, 0x1c693, 0x01d65,
+    0x2a61f, 0x12628, 0x1068c, 0x1e48e, 0x2e622, 0x1e62a, 0x1c68e, 0x1c08f, 0x2c657, 0x1e661, 0x1c695, 0x10099, 0x22659, 0x1e663, 0x1c697, 0x1dd2a,
+    0x24e3a, 0x1265d, 0x10691, 0x1c098, 0x16657, 0x12661, 0x10695, 0x1c099, 0x0867c, 0x1c686, 0x1c69b, 0x1c09e, 0x0a683, 0x1c688, 0x19c77, 0x01c48,
+    0x28e44, 0x1265f, 0x10693, 0x01b65, 0x16659, 0x12663, 0x10697, 0x1db2a, 0x08683, 0x10688, 0x0da77, 0x01a48, 0x01971, 0x1d93d, 0x0184d, 0x1dd12,
+    0x1e804, 0x2e807, 0x08819, 0x2481b, 0x12a0a, 0x1680c, 0x2881f, 0x2a020, 0x14830, 0x28832, 0x08839, 0x2483b, 0x2a234, 0x16235, 0x28843, 0x28845,
+    0x1ec0a, 0x2e80c, 0x2c81f, 0x2e020, 0x2e80e, 0x2e00f, 0x2e023, 0x2e024, 0x16242, 0x16244, 0x28058, 0x28059, 0x16243, 0x16245, 0x1605a, 0x1605b,
+    0x1a830, 0x20832, 0x26839, 0x2683b, 0x22442, 0x22444, 0x2c058, 0x2c059, 0x2407b, 0x2407c, 0x0807d, 0x0807e, 0x24082, 0x24083, 0x08084, 0x15f71,
+    0x2e434, 0x2e435, 0x2c843, 0x2c845, 0x22443, 0x22445, 0x2c05a, 0x2c05b, 0x26082, 0x26083, 0x26084, 0x1bf71, 0x1e084, 0x2ff71, 0x0809f, 0x01f55,
+    0x1ee0b, 0x2e011, 0x2e027, 0x2e028, 0x22a0e, 0x16012, 0x16029, 0x1602a, 0x2a23a, 0x1623c, 0x16060, 0x16061, 0x2a23b, 0x1623d, 0x16062, 0x16063,
+    0x12c0e, 0x2e012, 0x2e029, 0x2e02a, 0x2e013, 0x2e014, 0x2e02b, 0x2e02c, 0x12246, 0x12248, 0x12064, 0x12065, 0x12247, 0x12249, 0x12066, 0x13f24,
+    0x2e43a, 0x2e43c, 0x22060, 0x22061, 0x22446, 0x22448, 0x22064, 0x22065, 0x1e085, 0x1e086, 0x1e0a0, 0x1e0a1, 0x12087, 0x12088, 0x100a2, 0x15d5f,
+    0x2e43b, 0x2e43d, 0x22062, 0x22063, 0x22447, 0x22449, 0x22066, 0x23f24, 0x1e087, 0x1e088, 0x1e0a2, 0x1bb5f, 0x1e089, 0x1ff3d, 0x1e0a3, 0x1ff1d,
+    0x2e63e, 0x2e64a, 0x12290, 0x12292, 0x2e642, 0x2264c, 0x12291, 0x12293, 0x1aa68, 0x2226e, 0x100a4, 0x100a5, 0x2226a, 0x2226f, 0x122a5, 0x0fd74,
+    0x2a642, 0x1264c, 0x1e491, 0x1e493, 0x2e646, 0x1e64e, 0x12298, 0x2ff65, 0x1e272, 0x1e275, 0x100a6, 0x100a7, 0x1e273, 0x1e276, 0x100a8, 0x15f59,
+    0x14c68, 0x1246e, 0x1c0a4, 0x1c0a5, 0x16672, 0x12475, 0x1c0a6, 0x1c0a7, 0x1c0aa, 0x1c0ab, 0x1c0b0, 0x1c0b1, 0x100ac, 0x100ad, 0x100b2, 0x0ff6c,
+    0x1646a, 0x1246f, 0x1e4a5, 0x21f74, 0x12473, 0x12476, 0x1c0a8, 0x21f59, 0x1c0ac, 0x1c0ad, 0x1c0b2, 0x1bf6c, 0x1c0ae, 0x2ff6f, 0x11c9c, 0x01e41,
+    0x2e63f, 0x2e64b, 0x12294, 0x12296, 0x2e643, 0x2264d, 0x12295, 0x12297, 0x2226b, 0x22270, 0x122a6, 0x122a8, 0x2226c, 0x22271, 0x122a7, 0x0fd59,
+    0x2a643, 0x1264d, 0x1e495, 0x1e497, 0x2e647, 0x1e64f, 0x12299, 0x1ff2a, 0x22673, 0x1e277, 0x100a9, 0x23b93, 0x1e274, 0x13f45, 0x19993, 0x11d20,
+    0x1646b, 0x12470, 0x1e4a6, 0x1e4a8, 0x16673, 0x12477, 0x1c0a9, 0x17d93, 0x1e6ab, 0x1c0af, 0x1c0b3, 0x1de9b, 0x1e6ad, 0x19d83, 0x19c75, 0x01c44,
+    0x1646c, 0x12471, 0x1e4a7, 0x1bb59, 0x16674, 0x1ff45, 0x0d993, 0x1ff20, 0x126ad, 0x23b83, 0x0da75, 0x05a44, 0x0196f, 0x1ff35, 0x0184c, 0x1df0c,
+    0x00806, 0x00816, 0x0881a, 0x0881c, 0x1681a, 0x1681c, 0x24821, 0x24823, 0x00b31, 0x02836, 0x0883a, 0x0883c, 0x1483a, 0x2883c, 0x24846, 0x24848,
+    0x2081a, 0x2081c, 0x26821, 0x26823, 0x2e821, 0x2e823, 0x24051, 0x24052, 0x2405c, 0x2405d, 0x24060, 0x24061, 0x28060, 0x28061, 0x24064, 0x24065,
+    0x04d31, 0x26836, 0x0a83a, 0x2683c, 0x2605c, 0x2605d, 0x26060, 0x26061, 0x0897a, 0x0807f, 0x2497c, 0x08080, 0x08085, 0x08086, 0x08087, 0x08088,
+    0x2083a, 0x2083c, 0x26846, 0x26848, 0x2c060, 0x2c061, 0x26064, 0x26065, 0x26085, 0x26086, 0x0a087, 0x0a088, 0x080a0, 0x080a1, 0x080a2, 0x01e5f,
+    0x1ce31, 0x2e836, 0x2e05c, 0x2e05d, 0x1683a, 0x1683c, 0x2a060, 0x2a061, 0x06a7a, 0x1607f, 0x28085, 0x28086, 0x2aa7c, 0x16080, 0x14087, 0x14088,
+    0x2283a, 0x2e83c, 0x2e060, 0x2e061, 0x2e846, 0x2e848, 0x2e064, 0x2e065, 0x16085, 0x16086, 0x160a0, 0x160a1, 0x16087, 0x16088, 0x160a2, 0x11d5f,
+    0x00c7a, 0x2007f, 0x20085, 0x20086, 0x2e085, 0x2e086, 0x200a0, 0x200a1, 0x000b5, 0x000b6, 0x000b7, 0x000b8, 0x100b7, 0x100b8, 0x000b9, 0x0fd80,
+    0x2cc7c, 0x20080, 0x20087, 0x20088, 0x22087, 0x22088, 0x200a2, 0x19b5f, 0x180b7, 0x180b8, 0x060b9, 0x07e80, 0x1e0b9, 0x11d80, 0x000ba, 0x01f37,
+    0x00f25, 0x000bb, 0x1e98b, 0x000bc, 0x06a8b, 0x100bc, 0x000bd, 0x000be, 0x18f5c, 0x000bf, 0x12991, 0x000c0, 0x06a91, 0x0c0c0, 0x000c1, 0x03d99,
+    0x02c8b, 0x180bc, 0x040bd, 0x040be, 0x1c0bd, 0x1c0be, 0x000c2, 0x000c3, 0x000c4, 0x000c5, 0x000c6, 0x000c7, 0x0c0c6, 0x0c0c7, 0x000c8, 0x01f8e,
+    0x10f5c, 0x040bf, 0x1e991, 0x040c0, 0x040c4, 0x040c5, 0x040c6, 0x040c7, 0x1ef85, 0x000c9, 0x1e99b, 0x1fea1, 0x000ca, 0x000cb, 0x11ca8, 0x0de61,
+    0x02c91, 0x180c0, 0x040c1, 0x1be99, 0x180c6, 0x180c7, 0x040c8, 0x05f8e, 0x040ca, 0x040cb, 0x1daa8, 0x19e61, 0x000cc, 0x0fdc0, 0x11c96, 0x01e28,
+    0x00f5c, 0x1c0bf, 0x1c0c4, 0x1c0c5, 0x1aa91, 0x100c0, 0x100c6, 0x100c7, 0x06f85, 0x100c9, 0x0c0ca, 0x0c0cb, 0x06a9b, 0x07da1, 0x05ca8, 0x01d61,
+    0x0ec91, 0x1c0c0, 0x1c0c6, 0x1c0c7, 0x1c0c1, 0x1fd99, 0x1c0c8, 0x1df8e, 0x100ca, 0x100cb, 0x100cc, 0x03ec0, 0x199a8, 0x1dd61, 0x05c96, 0x11d28,
+    0x02f85, 0x180c9, 0x180ca, 0x180cb, 0x1c0ca, 0x1c0cb, 0x180cc, 0x13dc0, 0x24fb7, 0x000cd, 0x1feaf, 0x1de86, 0x07daf, 0x05d86, 0x19c70, 0x01c3c,
+    0x02c9b, 0x01ba1, 0x01aa8, 0x05b61, 0x0d9a8, 0x11b61, 0x01a96, 0x19b28, 0x03baf, 0x01b86, 0x11a70, 0x05a3c, 0x01970, 0x1d93c, 0x0184b, 0x11d11,
+    0x00807, 0x00817, 0x0881b, 0x0881d, 0x1681b, 0x1681d, 0x24822, 0x24824, 0x02832, 0x02837, 0x0883b, 0x0883d, 0x1483b, 0x2883d, 0x24847, 0x25f49,
+    0x2081b, 0x2081d, 0x26822, 0x26824, 0x2e822, 0x2e824, 0x24852, 0x24053, 0x2405e, 0x2405f, 0x24062, 0x24063, 0x28062, 0x28063, 0x24066, 0x25f24,
+    0x06832, 0x26837, 0x0a83b, 0x2683d, 0x2605e, 0x2605f, 0x26062, 0x26063, 0x0897c, 0x24080, 0x0897e, 0x08081, 0x24087, 0x24088, 0x08089, 0x09f3d,
+    0x2083b, 0x2083d, 0x26847, 0x27f49, 0x2c062, 0x2c063, 0x26066, 0x27f24, 0x26087, 0x26088, 0x26089, 0x27f3d, 0x240a2, 0x2f75f, 0x080a3, 0x09f1d,
+    0x1e832, 0x2e837, 0x2e05e, 0x2e05f, 0x1683b, 0x1683d, 0x2a062, 0x2a063, 0x16a7c, 0x2a080, 0x28087, 0x28088, 0x16a7e, 0x16081, 0x28089, 0x29f3d,
+    0x2283b, 0x2e83d, 0x2e062, 0x2e063, 0x2e847, 0x2ff49, 0x2e066, 0x2ff24, 0x2a087, 0x2a088, 0x2a0a2, 0x2775f, 0x16089, 0x17f3d, 0x160a3, 0x17f1d,
+    0x20c7c, 0x2c080, 0x2c087, 0x2c088, 0x2e087, 0x2e088, 0x2c0a2, 0x2575f, 0x240b7, 0x240b8, 0x080b9, 0x25780, 0x160b9, 0x2b780, 0x020ba, 0x03f37,
+    0x20c7e, 0x20081, 0x20089, 0x21f3d, 0x2e089, 0x2ff3d, 0x200a3, 0x21f1d, 0x200b9, 0x2d780, 0x260ba, 0x27f37, 0x2e0ba, 0x2ff37, 0x000ce, 0x01f17,
+    0x00f4a, 0x017ce, 0x1cd92, 0x097a3, 0x18e92, 0x177a3, 0x00bc1, 0x25766, 0x18b6e, 0x037ba, 0x129a5, 0x09789, 0x06aa5, 0x29789, 0x000cf, 0x25f47,
+    0x00d92, 0x217a3, 0x04dc1, 0x27766, 0x1cec1, 0x2f766, 0x000d0, 0x25f52, 0x000d1, 0x2d7a2, 0x000d2, 0x27762, 0x0c0d2, 0x2b762, 0x01cc1, 0x25f22,
+    0x10d6e, 0x277ba, 0x1e9a5, 0x27789, 0x040d1, 0x2b7a2, 0x040d2, 0x25762, 0x1e9ab, 0x097b9, 0x1feb1, 0x09e7e, 0x000d3, 0x29787, 0x13ea5, 0x09f3b,
+    0x02ca5, 0x21789, 0x040cf, 0x27f47, 0x180d2, 0x2f762, 0x05ac1, 0x27f22, 0x040d3, 0x2d787, 0x1fea5, 0x0bf3b, 0x1d7d1, 0x2f75e, 0x11c92, 0x09f1b,
+    0x00e6e, 0x2f7ba, 0x1c0d1, 0x257a2, 0x1aaa5, 0x17789, 0x100d2, 0x29762, 0x06aab, 0x177b9, 0x0c0d3, 0x25787, 0x07db1, 0x17d7e, 0x07da5, 0x15f3b,
+    0x0eca5, 0x2f789, 0x1c0d2, 0x2d762, 0x1c0cf, 0x2ff47, 0x1d9c1, 0x2ff22, 0x100d3, 0x2f787, 0x057d1, 0x2775e, 0x1bda5, 0x17f3b, 0x05c92, 0x17f1b,
+    0x02cab, 0x217b9, 0x180d3, 0x27787, 0x1c0d3, 0x2b787, 0x017d1, 0x2575e, 0x000d4, 0x257b7, 0x1feab, 0x09e7c, 0x07dab, 0x17d7c, 0x19c6e, 0x03f32,
+    0x02cb1, 0x21b7e, 0x03ba5, 0x21f3b, 0x0fba5, 0x23f3b, 0x01a92, 0x21f1b, 0x03bab, 0x21b7c, 0x11a6e, 0x07f32, 0x0196e, 0x1ff32, 0x0184a, 0x01f07,
+    0x1cd08, 0x00818, 0x06918, 0x0a91e, 0x1ea18, 0x16a1e, 0x02825, 0x24827, 0x00b2e, 0x02838, 0x22d3e, 0x08842, 0x1ae3e, 0x14842, 0x0284a, 0x2484c,
+    0x00c2e, 0x12a3e, 0x06938, 0x0a942, 0x1ea38, 0x16a42, 0x2485c, 0x2485e, 0x24067, 0x24068, 0x26168, 0x2406a, 0x2e268, 0x2806a, 0x2406e, 0x2406f,
+    0x1ed18, 0x26925, 0x22d1e, 0x26927, 0x0808a, 0x0808b, 0x2618b, 0x0808c, 0x1ed38, 0x2695c, 0x22d42, 0x2695e, 0x08090, 0x08091, 0x08092, 0x08093,
+    0x14f3e, 0x2694a, 0x20942, 0x2694c, 0x0a190, 0x0a192, 0x0a191, 0x0a193, 0x2e568, 0x2616e, 0x2c16a, 0x2616f, 0x080a4, 0x080a5, 0x0a1a5, 0x05f74,
+    0x06e18, 0x2ea25, 0x2808a, 0x2808b, 0x20e1e, 0x2ea27, 0x1628b, 0x1408c, 0x06e38, 0x2ea5c, 0x14090, 0x14091, 0x20e42, 0x2ea5e, 0x14092, 0x14093,
+    0x02f3e, 0x2ea4a, 0x16290, 0x16292, 0x22a42, 0x2ea4c, 0x16291, 0x16293, 0x26668, 0x2e26e, 0x140a4, 0x140a5, 0x2e26a, 0x2e26f, 0x162a5, 0x0dd74,
+    0x02f25, 0x020bb, 0x1658b, 0x020bc, 0x2668b, 0x140bc, 0x020bd, 0x020be, 0x24f5c, 0x020bf, 0x16591, 0x020c0, 0x0a691, 0x0e0c0, 0x020c1, 0x01d99,
+    0x02f4a, 0x01bce, 0x14792, 0x07ba3, 0x08792, 0x1fba3, 0x027c1, 0x19b66, 0x2476e, 0x01bba, 0x165a5, 0x05b89, 0x0a6a5, 0x1db89, 0x020cf, 0x19f47,
+    0x00f18, 0x2018a, 0x2ed25, 0x2018b, 0x26e25, 0x2e28b, 0x261bb, 0x0a1bc, 0x12d3e, 0x20690, 0x2ed4a, 0x22592, 0x26e4a, 0x20692, 0x01cce, 0x01ca3,
+    0x02f38, 0x20190, 0x2ed5c, 0x20191, 0x26e5c, 0x22291, 0x061bf, 0x061c0, 0x24768, 0x201a4, 0x2e56e, 0x201a5, 0x2666e, 0x222a5, 0x01cba, 0x01c89,
+    0x16d1e, 0x2e58b, 0x2ed27, 0x2018c, 0x0878b, 0x061bd, 0x1a1bc, 0x061be, 0x16d42, 0x22591, 0x2ed4c, 0x22593, 0x0a692, 0x066c1, 0x1fca3, 0x11c66,
+    0x14f42, 0x20192, 0x2ed5e, 0x20193, 0x08791, 0x061c1, 0x1a1c0, 0x19f99, 0x2876a, 0x225a5, 0x2e56f, 0x1de74, 0x087a5, 0x061cf, 0x1dc89, 0x11e47,
+    0x08f1e, 0x2068b, 0x2878b, 0x1e2bd, 0x26e27, 0x2228c, 0x222bc, 0x1e2be, 0x0ae42, 0x20691, 0x16592, 0x1e5c1, 0x26e4c, 0x20693, 0x07ca3, 0x01c66,
+    0x08f42, 0x22292, 0x14791, 0x1e2c1, 0x26e5e, 0x22293, 0x1e2c0, 0x1df99, 0x2666a, 0x206a5, 0x147a5, 0x1e2cf, 0x2666f, 0x19d74, 0x05c89, 0x01d47,
+    0x24f27, 0x0a6bc, 0x1478c, 0x1e5be, 0x0a68c, 0x066be, 0x027be, 0x000d5, 0x24f5e, 0x066c0, 0x16593, 0x11e99, 0x0a693, 0x05d99, 0x19c66, 0x01c2b,
+    0x24f4c, 0x01ba3, 0x14793, 0x01b66, 0x08793, 0x11b66, 0x01a99, 0x01b2b, 0x2476f, 0x01b89, 0x0da74, 0x01a47, 0x01974, 0x11947, 0x19847, 0x01c13,
+    0x00809, 0x00819, 0x0691a, 0x0881f, 0x10a1a, 0x1481f, 0x02826, 0x24828, 0x00b33, 0x02839, 0x0283f, 0x08843, 0x1483f, 0x14843, 0x0284b, 0x2484d,
+    0x18c30, 0x12a40, 0x0693a, 0x0a944, 0x12a3a, 0x16a44, 0x2485d, 0x2485f, 0x24868, 0x24069, 0x2406b, 0x2406c, 0x2806b, 0x2806c, 0x24070, 0x24071,
+    0x18d1e, 0x0a927, 0x1a921, 0x26929, 0x2688b, 0x2408c, 0x0808d, 0x0808e, 0x2c956, 0x26960, 0x2c958, 0x26962, 0x08094, 0x08095, 0x08096, 0x08097,
+    0x1a942, 0x0a94c, 0x1a946, 0x2694e, 0x26891, 0x26893, 0x0a198, 0x1bf65, 0x26172, 0x26175, 0x26173, 0x26176, 0x080a6, 0x080a7, 0x080a8, 0x05f59,
+    0x1ce1e, 0x12a27, 0x1688b, 0x2808c, 0x22a21, 0x16a29, 0x2808d, 0x2808e, 0x20a56, 0x2aa60, 0x14094, 0x14095, 0x2ea58, 0x2aa62, 0x14096, 0x14097,
+    0x1ea42, 0x12a4c, 0x2a891, 0x2a893, 0x22a46, 0x16a4e, 0x16298, 0x23f65, 0x2a272, 0x2a275, 0x140a6, 0x140a7, 0x2a273, 0x2a276, 0x140a8, 0x11f59,
+    0x00c8b, 0x240bc, 0x080bd, 0x080be, 0x280bd, 0x280be, 0x020c2, 0x020c3, 0x020c4, 0x020c5, 0x020c6, 0x020c7, 0x0e0c6, 0x0e0c7, 0x020c8, 0x03f8e,
+    0x02d92, 0x21ba3, 0x08dc1, 0x1bb66, 0x28ec1, 0x23b66, 0x020d0, 0x19f52, 0x020d1, 0x21ba2, 0x020d2, 0x1bb62, 0x0e0d2, 0x1fb62, 0x03cc1, 0x19f22,
+    0x00f38, 0x2c190, 0x22d5c, 0x2c191, 0x1ae5c, 0x2e291, 0x261bf, 0x0a1c0, 0x18b68, 0x2c1a4, 0x2296e, 0x2c1a5, 0x1aa6e, 0x2e2a5, 0x03cba, 0x03c89,
+    0x00d7b, 0x2019a, 0x20d85, 0x2019b, 0x2ee85, 0x2e29b, 0x0a1c9, 0x21fa1, 0x201aa, 0x201b0, 0x201ab, 0x201b1, 0x2e2ab, 0x2e2b1, 0x01cb9, 0x01f7e,
+    0x1ed56, 0x2c194, 0x22d60, 0x2c195, 0x261c4, 0x0a1c6, 0x261c5, 0x0a1c7, 0x1ed72, 0x2c1a6, 0x22975, 0x2c1a7, 0x261d1, 0x0a1d2, 0x11ca2, 0x0dc62,
+    0x02d82, 0x2019c, 0x2cd87, 0x1bb77, 0x061ca, 0x21ba8, 0x061cb, 0x1bf61, 0x201ac, 0x201b2, 0x201ad, 0x19e6c, 0x061d3, 0x23fa5, 0x11c87, 0x01e3b,
+    0x04e56, 0x2e294, 0x162c4, 0x162c6, 0x20e60, 0x2e295, 0x162c5, 0x162c7, 0x1ae72, 0x2e2a6, 0x162d1, 0x162d2, 0x20a75, 0x2e2a7, 0x07ca2, 0x01c62,
+    0x2ee82, 0x2229c, 0x122ca, 0x23ba8, 0x2ee87, 0x1fb77, 0x122cb, 0x1ff61, 0x222ac, 0x222b2, 0x122d3, 0x21fa5, 0x222ad, 0x1dd6c, 0x05c87, 0x0dd3b,
+    0x0ed94, 0x000d6, 0x28dc6, 0x000d7, 0x24ec6, 0x0c0d7, 0x000d8, 0x03fbe, 0x00fd1, 0x198cc, 0x1fca9, 0x11e95, 0x1bca9, 0x05d95, 0x19c64, 0x01c29,
+    0x02d9c, 0x01b9f, 0x03ba8, 0x05b5a, 0x0fba8, 0x1fb5a, 0x01a98, 0x19b23, 0x03bae, 0x01b84, 0x0da73, 0x05a43, 0x01973, 0x11943, 0x19846, 0x19f0e,
+    0x04909, 0x0081a, 0x06919, 0x0a91f, 0x0ca1e, 0x14821, 0x02827, 0x08829, 0x10b30, 0x0283a, 0x22d40, 0x08844, 0x0e842, 0x14846, 0x0284c, 0x0884e,
+    0x04c33, 0x0a93f, 0x06939, 0x0a943, 0x16856, 0x28858, 0x24860, 0x24862, 0x26968, 0x2616b, 0x26169, 0x2616c, 0x24072, 0x24073, 0x24075, 0x24076,
+    0x1ed1a, 0x26926, 0x2091f, 0x26928, 0x0898b, 0x2618d, 0x2618c, 0x2618e, 0x1ed3a, 0x2695d, 0x22d44, 0x2695f, 0x24991, 0x08098, 0x24993, 0x15e65,
+    0x1a93f, 0x2694b, 0x20943, 0x2694d, 0x0a194, 0x0a196, 0x0a195, 0x0a197, 0x2c16b, 0x26170, 0x2c16c, 0x26171, 0x0a1a6, 0x0a1a8, 0x0a1a7, 0x01e59,
+    0x04e38, 0x12a5c, 0x28090, 0x28091, 0x1ca56, 0x16a60, 0x28094, 0x28095, 0x18f7b, 0x28a85, 0x2809a, 0x2809b, 0x06a82, 0x28a87, 0x1409c, 0x0fc77,
+    0x10c68, 0x1286e, 0x280a4, 0x280a5, 0x12a72, 0x16875, 0x280a6, 0x280a7, 0x280aa, 0x280ab, 0x280b0, 0x280b1, 0x140ac, 0x140ad, 0x140b2, 0x0df6c,
+    0x14f5c, 0x080bf, 0x2a591, 0x080c0, 0x080c4, 0x080c5, 0x080c6, 0x080c7, 0x16f85, 0x020c9, 0x1659b, 0x17ea1, 0x020ca, 0x020cb, 0x15ca8, 0x0fe61,
+    0x14d6e, 0x27bba, 0x2a5a5, 0x07b89, 0x080d1, 0x1fba2, 0x080d2, 0x19b62, 0x165ab, 0x07bb9, 0x165b1, 0x07e7e, 0x020d3, 0x1db87, 0x17ea5, 0x05f3b,
+    0x12d1e, 0x2e98b, 0x22d27, 0x2c18c, 0x04b8b, 0x261bd, 0x261bc, 0x261be, 0x12d42, 0x2e991, 0x22d4c, 0x2e993, 0x1af92, 0x26ac1, 0x17ca3, 0x15c66,
+    0x2ad56, 0x20194, 0x2ed60, 0x20195, 0x061c4, 0x061c6, 0x061c5, 0x061c7, 0x2e572, 0x201a6, 0x2e575, 0x201a7, 0x061d1, 0x061d2, 0x17ca2, 0x0fc62,
+    0x12d21, 0x2018d, 0x2ed29, 0x2018e, 0x201bd, 0x261c2, 0x201be, 0x261c3, 0x12d46, 0x22598, 0x2ed4e, 0x13e65, 0x20fc1, 0x261d0, 0x13c66, 0x11e52,
+    0x2ad58, 0x20196, 0x2ed62, 0x20197, 0x1a1c6, 0x061c8, 0x1a1c7, 0x07e8e, 0x2e573, 0x201a8, 0x2e576, 0x1de59, 0x1a1d2, 0x07bc1, 0x13c62, 0x11e22,
+    0x00f56, 0x2e5c4, 0x2a594, 0x225c6, 0x06f94, 0x2cac6, 0x041d6, 0x041d7, 0x1af82, 0x1e5ca, 0x1659c, 0x17ca8, 0x1af9c, 0x07ca8, 0x07c9f, 0x01c5a,
+    0x14d72, 0x2e5d1, 0x2a5a6, 0x225d2, 0x04ed1, 0x13ba9, 0x119cc, 0x1df95, 0x165ac, 0x1e5d3, 0x165b2, 0x15ea5, 0x07cae, 0x19d73, 0x05c84, 0x01d43,
+    0x14f60, 0x2e5c5, 0x2a595, 0x225c7, 0x26fc6, 0x041d8, 0x181d7, 0x07ebe, 0x2af87, 0x1e5cb, 0x13c77, 0x13e61, 0x1bca8, 0x05d98, 0x1dc5a, 0x11c23,
+    0x14d75, 0x01ba2, 0x2a5a7, 0x05b62, 0x0fba9, 0x11b64, 0x01a95, 0x05b29, 0x165ad, 0x01b87, 0x11a6c, 0x19a3b, 0x05873, 0x11946, 0x1d843, 0x11e0e,
+    0x0490a, 0x0081b, 0x0691b, 0x0a920, 0x0e81f, 0x14822, 0x02828, 0x0882a, 0x0cb34, 0x0283b, 0x02841, 0x08845, 0x0e843, 0x14847, 0x0284d, 0x09e4f,
+    0x18c34, 0x0a941, 0x0693b, 0x0a945, 0x16857, 0x28859, 0x24861, 0x27f63, 0x2696a, 0x2486c, 0x2696c, 0x2406d, 0x28873, 0x24074, 0x24077, 0x09e45,
+    0x1a91f, 0x0a928, 0x1a922, 0x2692a, 0x0898c, 0x2688e, 0x0898e, 0x0808f, 0x2c957, 0x26961, 0x2c959, 0x25e63, 0x24995, 0x08099, 0x29697, 0x09e2a,
+    0x1a943, 0x0a94d, 0x1a947, 0x27f4f, 0x26895, 0x2d797, 0x0a199, 0x27f2a, 0x2c973, 0x26177, 0x26174, 0x0bf45, 0x080a9, 0x2d793, 0x29693, 0x0bf20,
+    0x1ce42, 0x12a5e, 0x28092, 0x28093, 0x12a58, 0x16a62, 0x28096, 0x28097, 0x04a82, 0x14a87, 0x2809c, 0x25677, 0x28a84, 0x28a89, 0x2809d, 0x03e4d,
+    0x10c6a, 0x1286f, 0x2a8a5, 0x27774, 0x16873, 0x23f76, 0x280a8, 0x2df59, 0x280ac, 0x280ad, 0x280b2, 0x27f6c, 0x280ae, 0x23f6f, 0x2969c, 0x03e41,
+    0x00c91, 0x240c0, 0x080c1, 0x0b799, 0x240c6, 0x240c7, 0x080c8, 0x09f8e, 0x080ca, 0x080cb, 0x296a8, 0x25e61, 0x020cc, 0x277c0, 0x29696, 0x03e28,
+    0x00ca5, 0x21b89, 0x080cf, 0x1bf47, 0x240d2, 0x23b62, 0x096c1, 0x1bf22, 0x080d3, 0x21b87, 0x2bea5, 0x07f3b, 0x29bd1, 0x23b5e, 0x29692, 0x07f1b,
+    0x10f42, 0x2c192, 0x22d5e, 0x2c193, 0x04b91, 0x261c1, 0x261c0, 0x09699, 0x1cb6a, 0x2e9a5, 0x2296f, 0x25674, 0x04ba5, 0x261cf, 0x29c89, 0x15e47,
+    0x00d82, 0x2c19c, 0x20d87, 0x27777, 0x0a1ca, 0x2d7a8, 0x0a1cb, 0x27f61, 0x2c1ac, 0x2c1b2, 0x2c1ad, 0x25e6c, 0x0a1d3, 0x2ffa5, 0x15c87, 0x03e3b,
+    0x1ed58, 0x2c196, 0x22d62, 0x2c197, 0x261c6, 0x261c8, 0x261c7, 0x27e8e, 0x22973, 0x2c1a8, 0x17e76, 0x29e59, 0x261d2, 0x277c1, 0x17c62, 0x15e22,
+    0x20d84, 0x2019d, 0x20d89, 0x0bf4d, 0x0a1cc, 0x2d796, 0x256c0, 0x0bf28, 0x201ae, 0x2d79c, 0x13e6f, 0x0bf41, 0x21cd1, 0x2d792, 0x13c5e, 0x01e1b,
+    0x00f72, 0x20ad1, 0x28dd1, 0x096a9, 0x1aaa6, 0x277d2, 0x036cc, 0x25f95, 0x18fac, 0x0b7d3, 0x296ae, 0x29e73, 0x07cb2, 0x05da5, 0x29c84, 0x0fe43,
+    0x02dac, 0x217ae, 0x096d3, 0x2df73, 0x1ced3, 0x23f73, 0x096ca, 0x2df57, 0x000d9, 0x2d7ac, 0x296ac, 0x27f6a, 0x07cac, 0x1dd6a, 0x05c82, 0x0dd34,
+    0x0eda6, 0x0b7cc, 0x256d2, 0x27e95, 0x000da, 0x277c6, 0x256c6, 0x09f8c, 0x10fd3, 0x0b7ca, 0x17e73, 0x17e57, 0x1bca6, 0x05d91, 0x13c58, 0x0fe1f,
+    0x02db2, 0x21b84, 0x01aa5, 0x1bf43, 0x0fba6, 0x1fb58, 0x01a91, 0x1bf1f, 0x03bac, 0x01b82, 0x13e6a, 0x07f34, 0x01972, 0x11942, 0x1d842, 0x05f0a,
+    0x1ca09, 0x0e81a, 0x0091e, 0x02821, 0x1ea19, 0x16a1f, 0x14827, 0x28829, 0x00b30, 0x0e83a, 0x02842, 0x02846, 0x1ae40, 0x14844, 0x1484c, 0x2884e,
+    0x1cc33, 0x12a3f, 0x24856, 0x24858, 0x1ea39, 0x16a43, 0x28860, 0x28862, 0x2ea68, 0x2a26b, 0x28072, 0x28073, 0x2e269, 0x2a26c, 0x28075, 0x28076,
+    0x1cd38, 0x0a95c, 0x06956, 0x0a960, 0x24090, 0x24091, 0x24094, 0x24095, 0x1ef7b, 0x08985, 0x24982, 0x24987, 0x0809a, 0x0809b, 0x0809c, 0x03c77,
+    0x00c68, 0x0a86e, 0x06972, 0x0a875, 0x240a4, 0x240a5, 0x240a6, 0x240a7, 0x080aa, 0x080ab, 0x080ac, 0x080ad, 0x080b0, 0x080b1, 0x080b2, 0x01f6c,
+    0x18e1a, 0x2ea26, 0x28a8b, 0x1628d, 0x22a1f, 0x2ea28, 0x2a28c, 0x1628e, 0x1ae3a, 0x2ea5d, 0x28a91, 0x14098, 0x20e44, 0x2ea5f, 0x28a93, 0x03d65,
+    0x22a3f, 0x2ea4b, 0x16294, 0x16296, 0x22a43, 0x2ea4d, 0x16295, 0x16297, 0x2e26b, 0x2e270, 0x162a6, 0x162a8, 0x2e26c, 0x2e271, 0x162a7, 0x0dd59,
+    0x02f5c, 0x280bf, 0x280c4, 0x280c5, 0x26691, 0x140c0, 0x140c6, 0x140c7, 0x26f85, 0x140c9, 0x0e0ca, 0x0e0cb, 0x2669b, 0x09da1, 0x09ca8, 0x03d61,
+    0x02e6e, 0x2fbba, 0x280d1, 0x19ba2, 0x266a5, 0x1fb89, 0x140d2, 0x1db62, 0x266ab, 0x1fbb9, 0x0e0d3, 0x19b87, 0x266b1, 0x1fd7e, 0x0bda5, 0x11f3b,
+    0x04f1e, 0x20a8b, 0x1cb8b, 0x162bd, 0x1ae27, 0x2e28c, 0x2e2bc, 0x162be, 0x06e42, 0x2ca91, 0x1ef92, 0x169c1, 0x1ae4c, 0x2ca93, 0x09ca3, 0x03c66,
+    0x08e56, 0x22294, 0x1e2c4, 0x122c6, 0x2ce60, 0x22295, 0x1e2c5, 0x122c7, 0x2c672, 0x222a6, 0x1e2d1, 0x122d2, 0x2c675, 0x222a7, 0x09ca2, 0x03c62,
+    0x02f56, 0x206c4, 0x12f94, 0x2e9c6, 0x26694, 0x206c6, 0x081d6, 0x081d7, 0x26f82, 0x1a6ca, 0x1ef9c, 0x13ca8, 0x0a69c, 0x0bca8, 0x09c9f, 0x03c5a,
+    0x02f72, 0x206d1, 0x1cdd1, 0x05aa9, 0x266a6, 0x206d2, 0x01acc, 0x19f95, 0x0a6ac, 0x1a6d3, 0x1fcae, 0x1de73, 0x0a6b2, 0x09da5, 0x1dc84, 0x0de43,
+    0x0ae21, 0x2e28d, 0x2e2bd, 0x2e2c2, 0x20e29, 0x2e28e, 0x2e2be, 0x2e2c3, 0x0ae46, 0x20698, 0x2efc1, 0x2e2d0, 0x20e4e, 0x0bd65, 0x0bc66, 0x01d52,
+    0x26e58, 0x22296, 0x1e2c6, 0x1e2c8, 0x2ce62, 0x22297, 0x1e2c7, 0x1fd8e, 0x2c673, 0x222a8, 0x1e2d2, 0x1fbc1, 0x2c676, 0x19d59, 0x07c62, 0x01d22,
+    0x08f60, 0x206c5, 0x2afc6, 0x1c2d8, 0x26695, 0x206c7, 0x1c2d7, 0x1fdbe, 0x26f87, 0x1a6cb, 0x1fca8, 0x11e98, 0x07c77, 0x07d61, 0x07c5a, 0x01c23,
+    0x08e75, 0x0fba2, 0x01aa9, 0x01b64, 0x266a7, 0x11b62, 0x0d995, 0x1db29, 0x0a6ad, 0x0db87, 0x11873, 0x01a46, 0x0596c, 0x1d93b, 0x19843, 0x01d0e,
+    0x10a0a, 0x0e81b, 0x0281f, 0x02822, 0x10a1b, 0x16a20, 0x14828, 0x2882a, 0x00b34, 0x0e83b, 0x02843, 0x02847, 0x14841, 0x14845, 0x1484d, 0x29d4f,
+    0x1cc34, 0x12a41, 0x24857, 0x24859, 0x12a3b, 0x16a45, 0x28861, 0x2bf63, 0x2aa6a, 0x2886c, 0x24873, 0x28074, 0x2aa6c, 0x2806d, 0x28077, 0x15d45,
+    0x18d42, 0x0a95e, 0x06958, 0x0a962, 0x24092, 0x24093, 0x24096, 0x24097, 0x08982, 0x08987, 0x08984, 0x08989, 0x2409c, 0x29577, 0x0809d, 0x15d4d,
+    0x04c6a, 0x0a86f, 0x0a873, 0x21f76, 0x268a5, 0x2b774, 0x240a8, 0x2ff59, 0x240ac, 0x240ad, 0x080ae, 0x1bf6f, 0x240b2, 0x2bf6c, 0x2559c, 0x15d41,
+    0x1ea1f, 0x12a28, 0x14a8c, 0x1688e, 0x22a22, 0x16a2a, 0x28a8e, 0x2808f, 0x20a57, 0x2aa61, 0x28a95, 0x14099, 0x2ea59, 0x29d63, 0x25597, 0x29d2a,
+    0x1ea43, 0x12a4d, 0x2a895, 0x2f797, 0x22a47, 0x17f4f, 0x16299, 0x17f2a, 0x2ea73, 0x2a277, 0x140a9, 0x2f793, 0x2a274, 0x17f45, 0x25593, 0x15d20,
+    0x0cc91, 0x280c0, 0x280c6, 0x280c7, 0x280c1, 0x17799, 0x280c8, 0x29f8e, 0x140ca, 0x140cb, 0x140cc, 0x2b7c0, 0x255a8, 0x29d61, 0x25596, 0x15d28,
+    0x0cca5, 0x2fb89, 0x280d2, 0x21b62, 0x280cf, 0x23f47, 0x295c1, 0x23f22, 0x140d3, 0x23b87, 0x09bd1, 0x1bb5e, 0x27da5, 0x13f3b, 0x25592, 0x11f1b,
+    0x04f42, 0x2e292, 0x10b91, 0x162c1, 0x1ae5e, 0x2e293, 0x2a2c0, 0x15599, 0x1aa6a, 0x2caa5, 0x10ba5, 0x162cf, 0x1aa6f, 0x29574, 0x09c89, 0x03d47,
+    0x22e82, 0x2e29c, 0x162ca, 0x2f7a8, 0x22e87, 0x2b777, 0x162cb, 0x2bf61, 0x2e2ac, 0x2e2b2, 0x162d3, 0x2dfa5, 0x2e2ad, 0x29d6c, 0x09c87, 0x0fd3b,
+    0x10d72, 0x2e9d1, 0x1e9a6, 0x2b7d2, 0x08ed1, 0x177a9, 0x155cc, 0x29f95, 0x1cfac, 0x177d3, 0x13cb2, 0x11ea5, 0x095ae, 0x25d73, 0x09c84, 0x03d43,
+    0x00dac, 0x2f7ae, 0x18dd3, 0x21f73, 0x155d3, 0x2ff73, 0x155ca, 0x21f57, 0x020d9, 0x2f7ac, 0x13cac, 0x1bf6a, 0x255ac, 0x29d6a, 0x09c82, 0x0fd34,
+    0x1ae58, 0x2e296, 0x2a2c6, 0x162c8, 0x20e62, 0x2e297, 0x2a2c7, 0x17d8e, 0x20a73, 0x2e2a8, 0x2a2d2, 0x177c1, 0x0bd76, 0x25d59, 0x0bc62, 0x03d22,
+    0x2ee84, 0x2e29d, 0x122cc, 0x2f796, 0x2ee89, 0x13f4d, 0x295c0, 0x13f28, 0x2e2ae, 0x2f79c, 0x2fcd1, 0x2f792, 0x0bd6f, 0x13f41, 0x0bc5e, 0x0fd1b,
+    0x02ea6, 0x137cc, 0x0c0da, 0x2b7c6, 0x295d2, 0x2bd95, 0x295c6, 0x17d8c, 0x04fd3, 0x177ca, 0x1fca6, 0x11e91, 0x0bd73, 0x25d57, 0x07c58, 0x03d1f,
+    0x0eeb2, 0x2fb84, 0x03ba6, 0x1bb58, 0x0d9a5, 0x1ff43, 0x0d991, 0x1ff1f, 0x0fbac, 0x23b82, 0x0da72, 0x05a42, 0x07d6a, 0x13f34, 0x19842, 0x0dd0a,
+    0x0080b, 0x0081c, 0x0091f, 0x02823, 0x0ca1f, 0x14823, 0x02829, 0x0282b, 0x00b32, 0x0283c, 0x02844, 0x02848, 0x0e844, 0x14848, 0x0284e, 0x03c50,
+    0x18c3f, 0x24854, 0x0a858, 0x2485a, 0x16858, 0x1685a, 0x24864, 0x24866, 0x2486e, 0x24870, 0x24875, 0x24877, 0x28875, 0x28877, 0x24078, 0x03c4e,
+    0x1cd3a, 0x0a95d, 0x06957, 0x0a961, 0x08991, 0x24098, 0x08995, 0x24099, 0x1097c, 0x08986, 0x24983, 0x29e88, 0x0899b, 0x0809e, 0x29c77, 0x15c48,
+    0x04d6b, 0x0a870, 0x06973, 0x0a877, 0x268a6, 0x268a8, 0x240a9, 0x07e93, 0x269ab, 0x080af, 0x2bead, 0x07e83, 0x080b3, 0x09d9b, 0x29c75, 0x0fc44,
+    0x18e3a, 0x12a5d, 0x14a91, 0x28098, 0x1ca57, 0x16a61, 0x14a95, 0x28099, 0x06a7c, 0x28a86, 0x28a9b, 0x2809e, 0x06a83, 0x25d88, 0x25c77, 0x03c48,
+    0x10e6b, 0x12870, 0x2a8a6, 0x2a8a8, 0x12a73, 0x16877, 0x280a9, 0x13d93, 0x16aab, 0x280af, 0x280b3, 0x29e9b, 0x27dad, 0x25d83, 0x25c75, 0x03c44,
+    0x00f85, 0x240c9, 0x240ca, 0x240cb, 0x280ca, 0x280cb, 0x240cc, 0x17dc0, 0x18fb7, 0x020cd, 0x294af, 0x29e86, 0x094af, 0x09d86, 0x25c70, 0x03c3c,
+    0x00cab, 0x21bb9, 0x240d3, 0x1bb87, 0x280d3, 0x1fb87, 0x03bd1, 0x19b5e, 0x020d4, 0x19bb7, 0x17eab, 0x07e7c, 0x27dab, 0x11d7c, 0x25c6e, 0x01f32,
+    0x18f27, 0x0aabc, 0x10b8c, 0x169be, 0x06a8c, 0x26abe, 0x00bbe, 0x020d5, 0x18f5e, 0x0aac0, 0x12993, 0x29499, 0x06a93, 0x25499, 0x25c66, 0x03c2b,
+    0x0cd94, 0x020d6, 0x1cdc6, 0x020d7, 0x18ec6, 0x0e0d7, 0x020d8, 0x01fbe, 0x02fd1, 0x254cc, 0x294a9, 0x15e95, 0x254a9, 0x09d95, 0x25c64, 0x03c29,
+    0x10f60, 0x2e9c5, 0x1e995, 0x2dec7, 0x1afc6, 0x081d8, 0x241d7, 0x27ebe, 0x1ef87, 0x294cb, 0x17c77, 0x17e61, 0x27ca8, 0x25498, 0x17c5a, 0x15c23,
+    0x0cda6, 0x0bbcc, 0x1cdd2, 0x1be95, 0x020da, 0x1bbc6, 0x19ac6, 0x05f8c, 0x294d3, 0x294ca, 0x13e73, 0x1de57, 0x27ca6, 0x09d91, 0x17c58, 0x0de1f,
+    0x04f60, 0x20ac5, 0x1efc6, 0x282d8, 0x1aa95, 0x2fdc7, 0x282d7, 0x17dbe, 0x1af87, 0x254cb, 0x2bca8, 0x29498, 0x0bc77, 0x0bd61, 0x25c5a, 0x03c23,
+    0x00ea6, 0x13bcc, 0x0e0da, 0x1fbc6, 0x18ed2, 0x1fd95, 0x1d9c6, 0x13d8c, 0x254d3, 0x254ca, 0x2bca6, 0x15e91, 0x07d73, 0x07d57, 0x0bc58, 0x01d1f,
+    0x00fa0, 0x000db, 0x12fcc, 0x21ec5, 0x0afcc, 0x2fdc5, 0x034d6, 0x13dbc, 0x20fb9, 0x254c9, 0x13c70, 0x13e5d, 0x0bc70, 0x0bd5d, 0x25c54, 0x01c1c,
+    0x02fb3, 0x01ba0, 0x01aa6, 0x05b60, 0x0d9a6, 0x11b60, 0x01a94, 0x19b27, 0x018ab, 0x01b85, 0x13c6b, 0x19a3a, 0x07c6b, 0x1d93a, 0x1983f, 0x01c0b,
+    0x0080c, 0x0081d, 0x00920, 0x02824, 0x0ca20, 0x14824, 0x0282a, 0x0372c, 0x00b35, 0x0283d, 0x02845, 0x03649, 0x0e845, 0x15549, 0x0344f, 0x03714,
+    0x18c41, 0x24855, 0x0a859, 0x0975b, 0x16859, 0x2b75b, 0x24865, 0x25724, 0x2486f, 0x24871, 0x0f676, 0x09645, 0x03576, 0x15545, 0x0344e, 0x2570f,
+    0x18d44, 0x0a95f, 0x06959, 0x09763, 0x08993, 0x15765, 0x03697, 0x0972a, 0x08983, 0x03788, 0x15671, 0x0963d, 0x03577, 0x15548, 0x1544d, 0x09712,
+    0x0686c, 0x0a871, 0x06974, 0x27f45, 0x0d7a7, 0x2b759, 0x03693, 0x25720, 0x017ad, 0x03783, 0x1566f, 0x09635, 0x03575, 0x15544, 0x1544c, 0x09f0c,
+    0x1ce44, 0x12a5f, 0x14a93, 0x03765, 0x12a59, 0x15763, 0x0f597, 0x2972a, 0x04a83, 0x0f788, 0x0f677, 0x03648, 0x03571, 0x2953d, 0x0344d, 0x29712,
+    0x1286c, 0x12871, 0x017a7, 0x27759, 0x12a74, 0x2bf45, 0x0f593, 0x29720, 0x0d7ad, 0x2f783, 0x0f675, 0x09644, 0x0356f, 0x29535, 0x0344c, 0x29f0c,
+    0x00c9b, 0x017a1, 0x036a8, 0x09761, 0x0f5a8, 0x15761, 0x03696, 0x25728, 0x017af, 0x03786, 0x15670, 0x0963c, 0x03570, 0x2953c, 0x0344b, 0x25711,
+    0x017b1, 0x2177e, 0x017a5, 0x2df3b, 0x0d7a5, 0x2ff3b, 0x03692, 0x2df1b, 0x017ab, 0x2d77c, 0x1566e, 0x27f32, 0x0356e, 0x17f32, 0x0344a, 0x03f07,
+    0x18f4c, 0x017a3, 0x10b93, 0x03766, 0x04b93, 0x15766, 0x03699, 0x0372b, 0x18b6f, 0x03789, 0x0f674, 0x03647, 0x03574, 0x15547, 0x25447, 0x03713,
+    0x00d9c, 0x0179f, 0x017a8, 0x0975a, 0x0d7a8, 0x2b75a, 0x03698, 0x25723, 0x017ae, 0x03784, 0x0f673, 0x09643, 0x03573, 0x15543, 0x25446, 0x25f0e,
+    0x10d75, 0x017a2, 0x036a7, 0x09762, 0x0d7a9, 0x15764, 0x03695, 0x09729, 0x0f4ad, 0x03787, 0x1566c, 0x2563b, 0x09473, 0x15546, 0x29443, 0x15e0e,
+    0x017b2, 0x21784, 0x036a5, 0x27f43, 0x0d7a6, 0x2b758, 0x03691, 0x27f1f, 0x017ac, 0x03782, 0x1566a, 0x25634, 0x03572, 0x15542, 0x29442, 0x09f0a,
+    0x04e75, 0x0f7a2, 0x036a9, 0x03764, 0x0f5a7, 0x15762, 0x0f595, 0x29729, 0x034ad, 0x0f787, 0x15473, 0x03646, 0x0956c, 0x2953b, 0x25443, 0x03d0e,
+    0x0d7b2, 0x2f784, 0x017a6, 0x27758, 0x0f5a5, 0x2bf43, 0x0f591, 0x2bf1f, 0x0d7ac, 0x2f782, 0x0f672, 0x09642, 0x0956a, 0x29534, 0x25442, 0x0fd0a,
+    0x017b3, 0x017a0, 0x036a6, 0x09760, 0x0f5a6, 0x15760, 0x03694, 0x25727, 0x034ab, 0x03785, 0x1566b, 0x2563a, 0x0956b, 0x2953a, 0x2543f, 0x03c0b,
+    0x017b0, 0x2177d, 0x036a4, 0x21f39, 0x0d7a4, 0x2ff39, 0x03690, 0x21f19, 0x017aa, 0x2d77b, 0x13e68, 0x0bf30, 0x0bd68, 0x13f30, 0x2543e, 0x01f04,
+    0x00d01, 0x20108, 0x20503, 0x20109, 0x2602d, 0x2602e, 0x0a02f, 0x0a030, 0x2e108, 0x20118, 0x2e109, 0x20119, 0x2e32e, 0x1853e, 0x12330, 0x18540,
+    0x08503, 0x26409, 0x26506, 0x0650b, 0x1a02f, 0x1a030, 0x06031, 0x06032, 0x1e518, 0x1a11e, 0x1e51a, 0x1a11f, 0x1c538, 0x18542, 0x1c53a, 0x18544,
+    0x24502, 0x06509, 0x20504, 0x2010a, 0x0052e, 0x06033, 0x18530, 0x06034, 0x1e509, 0x2011a, 0x2210a, 0x2011b, 0x1e333, 0x1853f, 0x12334, 0x18541,
+    0x08504, 0x0650a, 0x26507, 0x0650c, 0x00530, 0x1a034, 0x04532, 0x06035, 0x1e519, 0x1851f, 0x1e51b, 0x1a120, 0x1c539, 0x18543, 0x1c53b, 0x18545,
+    0x28708, 0x08418, 0x00518, 0x0451e, 0x0262e, 0x0053e, 0x00538, 0x04542, 0x16718, 0x00525, 0x1271e, 0x18527, 0x1053e, 0x0054a, 0x10542, 0x1854c,
+    0x08409, 0x08419, 0x0051a, 0x0641f, 0x14630, 0x00540, 0x0053a, 0x04544, 0x0e71e, 0x00527, 0x10521, 0x04529, 0x0c542, 0x0054c, 0x10546, 0x0454e,
+    0x02509, 0x0841a, 0x00519, 0x0451f, 0x02633, 0x0053f, 0x00539, 0x04543, 0x1671a, 0x00526, 0x1051f, 0x18528, 0x1053f, 0x0054b, 0x10543, 0x1854d,
+    0x0250a, 0x0841b, 0x0051b, 0x04520, 0x0e634, 0x00541, 0x0053b, 0x04545, 0x0c51f, 0x00528, 0x10522, 0x0452a, 0x0c543, 0x0054d, 0x10547, 0x0454f,
+    0x16503, 0x06518, 0x2e506, 0x1851a, 0x2232f, 0x04538, 0x1e331, 0x1853a, 0x16709, 0x1e11e, 0x1e50b, 0x1e11f, 0x22330, 0x1c542, 0x1e332, 0x1c544,
+    0x02506, 0x0651a, 0x00516, 0x0651c, 0x02631, 0x0453a, 0x00536, 0x0453c, 0x1051a, 0x18521, 0x1e51c, 0x18523, 0x1053a, 0x18546, 0x1c53c, 0x18548,
+    0x16504, 0x06519, 0x2e507, 0x1851b, 0x10530, 0x04539, 0x1c532, 0x1853b, 0x1670a, 0x1c51f, 0x1e50c, 0x1e120, 0x1e334, 0x1c543, 0x1e335, 0x1c545,
+    0x02507, 0x0651b, 0x00517, 0x0651d, 0x00532, 0x0453b, 0x00537, 0x0453d, 0x1051b, 0x18522, 0x1e51d, 0x18524, 0x1053b, 0x18547, 0x1c53d, 0x18549,
+    0x28709, 0x0051e, 0x0e51a, 0x00521, 0x02630, 0x00542, 0x0c53a, 0x00546, 0x16719, 0x10527, 0x1271f, 0x1c529, 0x10540, 0x1054c, 0x10544, 0x1c54e,
+    0x0250b, 0x0241f, 0x0051c, 0x00523, 0x02632, 0x00544, 0x0053c, 0x00548, 0x0e71f, 0x00529, 0x10523, 0x0052b, 0x0c544, 0x0054e, 0x10548, 0x00550,
+    0x1470a, 0x0051f, 0x0e51b, 0x00522, 0x02634, 0x00543, 0x0c53b, 0x00547, 0x1671b, 0x10528, 0x12720, 0x1c52a, 0x10541, 0x1054d, 0x10545, 0x1c54f,
+    0x0250c, 0x00520, 0x0051d, 0x00524, 0x02635, 0x00545, 0x0053d, 0x00549, 0x0e720, 0x0052a, 0x10524, 0x0052c, 0x0c545, 0x0054f, 0x10549, 0x01a14,
+    0x06c03, 0x06809, 0x26906, 0x2690b, 0x2602f, 0x26030, 0x26031, 0x26032, 0x16918, 0x2611e, 0x2a91a, 0x2611f, 0x28938, 0x24942, 0x2893a, 0x24944,
+    0x26c06, 0x20c0b, 0x26110, 0x0a111, 0x20031, 0x20032, 0x26036, 0x26037, 0x26125, 0x0a127, 0x26126, 0x0a128, 0x0a15c, 0x0a15e, 0x0a15d, 0x0a15f,
+    0x06d09, 0x2610d, 0x2090b, 0x2610e, 0x06038, 0x06039, 0x0603a, 0x0603b, 0x2c11e, 0x26121, 0x2c11f, 0x26122, 0x24156, 0x0a158, 0x24157, 0x0a159,
+    0x26c0b, 0x2640e, 0x1a111, 0x06112, 0x1a03a, 0x1a03b, 0x0603c, 0x0603d, 0x1a127, 0x06129, 0x1a128, 0x0612a, 0x06160, 0x06162, 0x06161, 0x06163,
+    0x16c18, 0x2c41e, 0x26425, 0x1a427, 0x16c38, 0x2ec42, 0x1a45c, 0x1a45e, 0x0608a, 0x0608b, 0x0418b, 0x0608c, 0x04190, 0x04192, 0x04191, 0x04193,
+    0x2ac1a, 0x2c41f, 0x26426, 0x1a428, 0x2ac3a, 0x2ec44, 0x1a45d, 0x1a45f, 0x0448b, 0x1a08c, 0x0608d, 0x0608e, 0x18491, 0x18493, 0x04198, 0x11f65,
+    0x2641e, 0x26421, 0x0a427, 0x06429, 0x20456, 0x20458, 0x1a460, 0x1a462, 0x0658b, 0x0418d, 0x1818c, 0x0418e, 0x04194, 0x04196, 0x04195, 0x04197,
+    0x2641f, 0x26422, 0x0a428, 0x0642a, 0x20457, 0x20459, 0x1a461, 0x1a463, 0x0658c, 0x0448e, 0x0658e, 0x0608f, 0x18495, 0x18497, 0x04199, 0x05f2a,
+    0x2652f, 0x06538, 0x20531, 0x1a53a, 0x06179, 0x0617b, 0x0617a, 0x0617c, 0x16938, 0x20156, 0x2a93a, 0x20157, 0x1617b, 0x04182, 0x1617c, 0x04183,
+    0x26531, 0x0653a, 0x26536, 0x0653c, 0x0647a, 0x1847c, 0x0617f, 0x06180, 0x1a15c, 0x1a160, 0x1a15d, 0x1a161, 0x04185, 0x04187, 0x04186, 0x04188,
+    0x26530, 0x06539, 0x20532, 0x1a53b, 0x1817b, 0x0617d, 0x1817c, 0x0617e, 0x2e942, 0x20158, 0x2e944, 0x20159, 0x18182, 0x04184, 0x18183, 0x11e71,
+    0x26532, 0x0653b, 0x26537, 0x0653d, 0x0647c, 0x0647e, 0x18180, 0x06181, 0x1a15e, 0x1a162, 0x1a15f, 0x1a163, 0x18187, 0x04189, 0x18188, 0x05e3d,
+    0x28c38, 0x24456, 0x0a45c, 0x06460, 0x1647b, 0x18482, 0x04485, 0x18487, 0x18190, 0x18194, 0x18191, 0x18195, 0x0419a, 0x0419c, 0x0419b, 0x01d77,
+    0x28c3a, 0x24457, 0x0a45d, 0x06461, 0x1647c, 0x18483, 0x04486, 0x18488, 0x04491, 0x04495, 0x18198, 0x18199, 0x0449b, 0x1dd77, 0x0419e, 0x11d48,
+    0x24c42, 0x0a458, 0x0a45e, 0x06462, 0x04482, 0x04484, 0x04487, 0x04489, 0x18192, 0x18196, 0x18193, 0x18197, 0x1819c, 0x0419d, 0x1d877, 0x11c4d,
+    0x24c44, 0x0a459, 0x0a45f, 0x06463, 0x04483, 0x11b71, 0x04488, 0x05b3d, 0x04493, 0x04497, 0x11a65, 0x05a2a, 0x01877, 0x1194d, 0x11848, 0x05f12,
+    0x18d02, 0x26909, 0x20904, 0x2c10a, 0x0292e, 0x26033, 0x24930, 0x0a034, 0x16909, 0x2c11a, 0x2e10a, 0x2c11b, 0x16333, 0x2493f, 0x16334, 0x24941,
+    0x26d09, 0x1a10d, 0x2050b, 0x1a10e, 0x26038, 0x26039, 0x0a03a, 0x0a03b, 0x2011e, 0x1a121, 0x2011f, 0x1a122, 0x06156, 0x06158, 0x06157, 0x06159,
+    0x20d04, 0x2010b, 0x20105, 0x2010c, 0x0a03e, 0x0a03f, 0x0a040, 0x0a041, 0x2e10b, 0x2011c, 0x2e10c, 0x2011d, 0x1233f, 0x24154, 0x12341, 0x24155,
+    0x2c50a, 0x1a50e, 0x2050c, 0x1a10f, 0x06042, 0x06043, 0x06044, 0x06045, 0x2251f, 0x1a123, 0x20120, 0x1a124, 0x18158, 0x0615a, 0x18159, 0x0615b,
+    0x02d2e, 0x26438, 0x1273e, 0x06442, 0x1a067, 0x1a068, 0x18168, 0x1a06a, 0x16738, 0x1855c, 0x12742, 0x1855e, 0x22368, 0x1816e, 0x1c16a, 0x1816f,
+    0x26433, 0x26439, 0x0a43f, 0x06443, 0x1a468, 0x1a069, 0x1a06b, 0x1a06c, 0x1c556, 0x18560, 0x1c558, 0x18562, 0x18172, 0x18175, 0x18173, 0x18176,
+    0x24d30, 0x0a43a, 0x12740, 0x06444, 0x18568, 0x1816b, 0x18169, 0x1816c, 0x1673a, 0x1855d, 0x12744, 0x1855f, 0x1c16b, 0x18170, 0x1c16c, 0x18171,
+    0x0a434, 0x0a43b, 0x0a441, 0x06445, 0x1856a, 0x1a46c, 0x1856c, 0x1a06d, 0x1c557, 0x18561, 0x1c559, 0x18563, 0x1c573, 0x18177, 0x18174, 0x05f45,
+    0x16d09, 0x2211e, 0x2e50b, 0x2211f, 0x16338, 0x1c156, 0x1633a, 0x1c157, 0x2210d, 0x22121, 0x2210e, 0x22122, 0x16339, 0x12158, 0x1633b, 0x12159,
+    0x2c51a, 0x1a521, 0x2051c, 0x1a523, 0x1815c, 0x18160, 0x1815d, 0x18161, 0x22521, 0x18151, 0x22523, 0x18152, 0x1c160, 0x18164, 0x1c161, 0x18165,
+    0x2e50a, 0x2051f, 0x2e50c, 0x22120, 0x12342, 0x1c158, 0x12344, 0x1c159, 0x2250e, 0x22123, 0x2210f, 0x22124, 0x12343, 0x1c15a, 0x12345, 0x1c15b,
+    0x2c51b, 0x1a522, 0x2051d, 0x1a524, 0x1815e, 0x18162, 0x1815f, 0x18163, 0x22522, 0x18552, 0x22524, 0x18153, 0x1c162, 0x18166, 0x1c163, 0x19e24,
+    0x16733, 0x06556, 0x1273f, 0x18558, 0x22768, 0x1c172, 0x1e36b, 0x1c173, 0x16739, 0x1c560, 0x12743, 0x1c562, 0x22369, 0x1c175, 0x1e36c, 0x1c176,
+    0x24d3f, 0x06558, 0x24554, 0x0655a, 0x1856e, 0x18575, 0x18570, 0x18577, 0x12558, 0x18564, 0x1c55a, 0x18566, 0x1c575, 0x18178, 0x1c577, 0x01d4e,
+    0x16734, 0x06557, 0x12741, 0x18559, 0x1e76a, 0x18573, 0x1c56c, 0x1c174, 0x1673b, 0x1c561, 0x12745, 0x1c563, 0x1e76c, 0x1c177, 0x1c16d, 0x11c45,
+    0x24d41, 0x06559, 0x24555, 0x0655b, 0x1856f, 0x18576, 0x18571, 0x05b45, 0x12559, 0x18565, 0x1c55b, 0x19a24, 0x1c576, 0x0194e, 0x11845, 0x19e0f,
+    0x06904, 0x0a90a, 0x26907, 0x2690c, 0x02930, 0x26034, 0x08932, 0x26035, 0x16919, 0x2491f, 0x2a91b, 0x26120, 0x28939, 0x24943, 0x2893b, 0x24945,
+    0x06c0b, 0x1a80e, 0x26111, 0x26112, 0x2603a, 0x2603b, 0x2603c, 0x2603d, 0x26127, 0x26129, 0x26128, 0x2612a, 0x0a160, 0x0a162, 0x0a161, 0x0a163,
+    0x1ad0a, 0x2690e, 0x2090c, 0x2610f, 0x0a042, 0x0a043, 0x0a044, 0x0a045, 0x2e91f, 0x26123, 0x2c120, 0x26124, 0x24158, 0x2415a, 0x24159, 0x2415b,
+    0x0ad0e, 0x26113, 0x20112, 0x26114, 0x0a046, 0x0a047, 0x0a048, 0x0a049, 0x20129, 0x2612b, 0x2012a, 0x2612c, 0x0a164, 0x0a166, 0x0a165, 0x0be24,
+    0x2643e, 0x2c442, 0x2644a, 0x1a44c, 0x22868, 0x2006a, 0x1a06e, 0x1a06f, 0x06090, 0x06091, 0x06092, 0x06093, 0x060a4, 0x060a5, 0x041a5, 0x03f74,
+    0x2643f, 0x2c443, 0x2644b, 0x1a44d, 0x2006b, 0x2006c, 0x1a070, 0x1a071, 0x06094, 0x06095, 0x06096, 0x06097, 0x060a6, 0x060a7, 0x060a8, 0x03f59,
+    0x26442, 0x26446, 0x0a44c, 0x0644e, 0x1a072, 0x1a073, 0x1a075, 0x1a076, 0x1a591, 0x06098, 0x1a593, 0x27e65, 0x041a6, 0x041a8, 0x041a7, 0x09e59,
+    0x26443, 0x26447, 0x0a44d, 0x0644f, 0x20473, 0x1a074, 0x1a077, 0x07e45, 0x1a595, 0x06099, 0x1a597, 0x07e2a, 0x060a9, 0x1db93, 0x21a93, 0x05f20,
+    0x22930, 0x20542, 0x2e932, 0x20544, 0x2a17b, 0x06182, 0x2a17c, 0x06183, 0x16939, 0x2e158, 0x2a93b, 0x2e159, 0x1617d, 0x28184, 0x1617e, 0x03e71,
+    0x2c53a, 0x1a546, 0x2053c, 0x1a548, 0x06185, 0x06187, 0x06186, 0x06188, 0x20160, 0x1a164, 0x20161, 0x1a165, 0x061a0, 0x061a2, 0x061a1, 0x03f5f,
+    0x2c534, 0x20543, 0x20535, 0x20545, 0x1a182, 0x06184, 0x1a183, 0x27e71, 0x2e943, 0x2015a, 0x2e945, 0x2015b, 0x16184, 0x0619f, 0x23e71, 0x03e55,
+    0x2c53b, 0x1a547, 0x2053d, 0x1a549, 0x1a187, 0x06189, 0x1a188, 0x07e3d, 0x20162, 0x1a166, 0x20163, 0x1be24, 0x181a2, 0x061a3, 0x23a5f, 0x07e1d,
+    0x02d68, 0x06572, 0x0a56e, 0x06575, 0x041aa, 0x041ac, 0x041ab, 0x041ad, 0x181a4, 0x181a6, 0x181a5, 0x181a7, 0x041b0, 0x041b2, 0x041b1, 0x03e6c,
+    0x0a56b, 0x0a473, 0x0a570, 0x06577, 0x064ab, 0x1a4ad, 0x041af, 0x0bf83, 0x1a5a6, 0x181a9, 0x1a5a8, 0x0bf93, 0x041b3, 0x1dd75, 0x05c9b, 0x0dd44,
+    0x0a56a, 0x06573, 0x0a56f, 0x06576, 0x181ac, 0x041ae, 0x181ad, 0x27e6f, 0x1a5a5, 0x181a8, 0x23e74, 0x23e59, 0x181b2, 0x05d9c, 0x1fe6c, 0x11c41,
+    0x0a56c, 0x06574, 0x0a571, 0x1be45, 0x064ad, 0x11b6f, 0x01a83, 0x07e35, 0x1a5a7, 0x01b93, 0x1fa59, 0x1be20, 0x01875, 0x1194c, 0x11844, 0x05e0c,
+    0x1cc08, 0x06818, 0x00918, 0x0891e, 0x00a2e, 0x22c3e, 0x02938, 0x08942, 0x1eb18, 0x02925, 0x16b1e, 0x24927, 0x1af3e, 0x0294a, 0x14942, 0x2494c,
+    0x1ec18, 0x22c1e, 0x26825, 0x26827, 0x1ec38, 0x22c42, 0x2685c, 0x2685e, 0x2608a, 0x2608b, 0x0818b, 0x0a08c, 0x08190, 0x08192, 0x08191, 0x08193,
+    0x00d2e, 0x06838, 0x12b3e, 0x0a842, 0x26067, 0x26068, 0x24168, 0x2606a, 0x1eb38, 0x2495c, 0x16b42, 0x2495e, 0x2e368, 0x2416e, 0x2816a, 0x2416f,
+    0x14e3e, 0x20842, 0x2684a, 0x2684c, 0x2e468, 0x2c06a, 0x2606e, 0x2606f, 0x0a090, 0x0a091, 0x0a092, 0x0a093, 0x0a0a4, 0x0a0a5, 0x081a5, 0x01f74,
+    0x00e18, 0x2ec25, 0x2008a, 0x2008b, 0x12c3e, 0x2ec4a, 0x20790, 0x22492, 0x26f25, 0x260bb, 0x2e38b, 0x0a0bc, 0x26f4a, 0x01dce, 0x20792, 0x01da3,
+    0x16c1e, 0x2ec27, 0x2e48b, 0x2008c, 0x16c42, 0x2ec4c, 0x22491, 0x22493, 0x0868b, 0x1a0bc, 0x060bd, 0x060be, 0x0a792, 0x1fda3, 0x067c1, 0x11d66,
+    0x02e38, 0x2ec5c, 0x20090, 0x20091, 0x24668, 0x2e46e, 0x200a4, 0x200a5, 0x26f5c, 0x060bf, 0x22391, 0x060c0, 0x2676e, 0x01dba, 0x223a5, 0x01d89,
+    0x14e42, 0x2ec5e, 0x20092, 0x20093, 0x2866a, 0x2e46f, 0x224a5, 0x1df74, 0x08691, 0x1a0c0, 0x060c1, 0x19e99, 0x086a5, 0x1dd89, 0x060cf, 0x11f47,
+    0x06f18, 0x2818a, 0x2eb25, 0x2818b, 0x06f38, 0x14190, 0x2eb5c, 0x14191, 0x20f1e, 0x1638b, 0x2eb27, 0x1418c, 0x20f42, 0x14192, 0x2eb5e, 0x14193,
+    0x02e25, 0x1648b, 0x021bb, 0x021bc, 0x24e5c, 0x16491, 0x021bf, 0x021c0, 0x2678b, 0x021bd, 0x141bc, 0x021be, 0x0a791, 0x021c1, 0x0e1c0, 0x01c99,
+    0x02e3e, 0x16390, 0x2eb4a, 0x16392, 0x26768, 0x141a4, 0x2e36e, 0x141a5, 0x22b42, 0x16391, 0x2eb4c, 0x16393, 0x2e36a, 0x163a5, 0x2e36f, 0x0dc74,
+    0x02e4a, 0x14692, 0x01ace, 0x07aa3, 0x2466e, 0x164a5, 0x01aba, 0x05a89, 0x08692, 0x026c1, 0x1faa3, 0x19a66, 0x0a7a5, 0x021cf, 0x1da89, 0x19e47,
+    0x0af1e, 0x2868b, 0x2078b, 0x1e3bd, 0x0af42, 0x16492, 0x20791, 0x1e4c1, 0x26f27, 0x223bc, 0x2238c, 0x1e3be, 0x26f4c, 0x07da3, 0x20793, 0x01d66,
+    0x24e27, 0x1468c, 0x0a7bc, 0x1e4be, 0x24e5e, 0x16493, 0x067c0, 0x11f99, 0x0868c, 0x026be, 0x067be, 0x040d5, 0x0a793, 0x19d66, 0x05c99, 0x01d2b,
+    0x08e42, 0x14691, 0x22392, 0x1e3c1, 0x2466a, 0x146a5, 0x207a5, 0x1e3cf, 0x26f5e, 0x1e3c0, 0x22393, 0x1de99, 0x2676f, 0x05d89, 0x19c74, 0x01c47,
+    0x24e4c, 0x14693, 0x01aa3, 0x01a66, 0x2466f, 0x0db74, 0x01a89, 0x01b47, 0x08693, 0x01b99, 0x11a66, 0x01a2b, 0x05974, 0x19947, 0x11847, 0x01d13,
+    0x04809, 0x06819, 0x0091a, 0x0a81f, 0x10a30, 0x22c40, 0x0293a, 0x08944, 0x0cb1e, 0x02927, 0x14921, 0x08929, 0x0e942, 0x0294c, 0x14946, 0x0894e,
+    0x1ec1a, 0x2081f, 0x26826, 0x26828, 0x1ec3a, 0x22c44, 0x2685d, 0x2685f, 0x0888b, 0x2608c, 0x2608d, 0x2608e, 0x24891, 0x24893, 0x08198, 0x15f65,
+    0x04d33, 0x06839, 0x0a83f, 0x0a843, 0x26868, 0x26069, 0x2606b, 0x2606c, 0x16956, 0x24960, 0x28958, 0x24962, 0x24172, 0x24175, 0x24173, 0x24176,
+    0x1a83f, 0x20843, 0x2684b, 0x2684d, 0x2c06b, 0x2c06c, 0x26070, 0x26071, 0x0a094, 0x0a095, 0x0a096, 0x0a097, 0x0a0a6, 0x0a0a7, 0x0a0a8, 0x01f59,
+    0x12c1e, 0x22c27, 0x2e88b, 0x2c08c, 0x12c42, 0x22c4c, 0x2e891, 0x2e893, 0x04a8b, 0x260bc, 0x260bd, 0x260be, 0x1ae92, 0x17da3, 0x26bc1, 0x15d66,
+    0x12c21, 0x2ec29, 0x2008d, 0x2008e, 0x12c46, 0x2ec4e, 0x22498, 0x13f65, 0x200bd, 0x200be, 0x260c2, 0x260c3, 0x20ec1, 0x13d66, 0x260d0, 0x11f52,
+    0x2ac56, 0x2ec60, 0x20094, 0x20095, 0x2e472, 0x2e475, 0x200a6, 0x200a7, 0x060c4, 0x060c5, 0x060c6, 0x060c7, 0x060d1, 0x17da2, 0x060d2, 0x0fd62,
+    0x2ac58, 0x2ec62, 0x20096, 0x20097, 0x2e473, 0x2e476, 0x200a8, 0x1df59, 0x1a0c6, 0x1a0c7, 0x060c8, 0x07f8e, 0x1a0d2, 0x13d62, 0x07ac1, 0x11f22,
+    0x04f38, 0x28190, 0x12b5c, 0x28191, 0x18e7b, 0x2819a, 0x28b85, 0x2819b, 0x1cb56, 0x28194, 0x16b60, 0x28195, 0x06b82, 0x1419c, 0x28b87, 0x0fd77,
+    0x14e5c, 0x2a491, 0x081bf, 0x081c0, 0x16e85, 0x1649b, 0x021c9, 0x17fa1, 0x081c4, 0x081c6, 0x081c5, 0x081c7, 0x021ca, 0x15da8, 0x021cb, 0x0ff61,
+    0x10d68, 0x281a4, 0x1296e, 0x281a5, 0x281aa, 0x281b0, 0x281ab, 0x281b1, 0x12b72, 0x281a6, 0x16975, 0x281a7, 0x141ac, 0x141b2, 0x141ad, 0x0de6c,
+    0x14c6e, 0x2a4a5, 0x27aba, 0x07a89, 0x164ab, 0x164b1, 0x07ab9, 0x07f7e, 0x081d1, 0x081d2, 0x1faa2, 0x19a62, 0x021d3, 0x17fa5, 0x1da87, 0x05e3b,
+    0x00e56, 0x2a494, 0x2e4c4, 0x224c6, 0x1ae82, 0x1649c, 0x1e4ca, 0x17da8, 0x06e94, 0x040d6, 0x2cbc6, 0x040d7, 0x1ae9c, 0x07d9f, 0x07da8, 0x01d5a,
+    0x14e60, 0x2a495, 0x2e4c5, 0x224c7, 0x2ae87, 0x13d77, 0x1e4cb, 0x13f61, 0x26ec6, 0x180d7, 0x040d8, 0x07fbe, 0x1bda8, 0x1dd5a, 0x05c98, 0x11d23,
+    0x14c72, 0x2a4a6, 0x2e4d1, 0x224d2, 0x164ac, 0x164b2, 0x1e4d3, 0x15fa5, 0x04fd1, 0x118cc, 0x13aa9, 0x1de95, 0x07dae, 0x05d84, 0x19c73, 0x01c43,
+    0x14c75, 0x2a4a7, 0x01aa2, 0x05a62, 0x164ad, 0x11b6c, 0x01a87, 0x19b3b, 0x0faa9, 0x01b95, 0x11a64, 0x05a29, 0x05973, 0x1d943, 0x11846, 0x11f0e,
+    0x00909, 0x0681a, 0x00919, 0x0891f, 0x00a33, 0x0293f, 0x02939, 0x08943, 0x10b1a, 0x02926, 0x1491f, 0x24928, 0x1493f, 0x0294b, 0x14943, 0x2494d,
+    0x18c1e, 0x1a821, 0x0a827, 0x26829, 0x2c856, 0x2c858, 0x26860, 0x26862, 0x2698b, 0x0818d, 0x2418c, 0x0818e, 0x08194, 0x08196, 0x08195, 0x08197,
+    0x18d30, 0x0683a, 0x12b40, 0x0a844, 0x24968, 0x2416b, 0x24169, 0x2416c, 0x12b3a, 0x2495d, 0x16b44, 0x2495f, 0x2816b, 0x24170, 0x2816c, 0x24171,
+    0x1a842, 0x1a846, 0x0a84c, 0x2684e, 0x26072, 0x26073, 0x26075, 0x26076, 0x26991, 0x0a098, 0x26993, 0x1be65, 0x081a6, 0x081a8, 0x081a7, 0x05e59,
+    0x00e38, 0x22c5c, 0x2c090, 0x2c091, 0x18a68, 0x2286e, 0x2c0a4, 0x2c0a5, 0x1af5c, 0x260bf, 0x2e391, 0x0a0c0, 0x1ab6e, 0x03dba, 0x2e3a5, 0x03d89,
+    0x1ec56, 0x22c60, 0x2c094, 0x2c095, 0x1ec72, 0x22875, 0x2c0a6, 0x2c0a7, 0x260c4, 0x260c5, 0x0a0c6, 0x0a0c7, 0x260d1, 0x11da2, 0x0a0d2, 0x0dd62,
+    0x00c7b, 0x20c85, 0x2009a, 0x2009b, 0x200aa, 0x200ab, 0x200b0, 0x200b1, 0x2ef85, 0x0a0c9, 0x2e39b, 0x21ea1, 0x2e3ab, 0x01db9, 0x2e3b1, 0x01e7e,
+    0x02c82, 0x2cc87, 0x2009c, 0x1ba77, 0x200ac, 0x200ad, 0x200b2, 0x19f6c, 0x060ca, 0x060cb, 0x21aa8, 0x1be61, 0x060d3, 0x11d87, 0x23ea5, 0x01f3b,
+    0x1cf1e, 0x1698b, 0x12b27, 0x2818c, 0x20b56, 0x14194, 0x2ab60, 0x14195, 0x22b21, 0x2818d, 0x16b29, 0x2818e, 0x2eb58, 0x14196, 0x2ab62, 0x14197,
+    0x00d8b, 0x081bd, 0x241bc, 0x081be, 0x021c4, 0x021c6, 0x021c5, 0x021c7, 0x281bd, 0x021c2, 0x281be, 0x021c3, 0x0e1c6, 0x021c8, 0x0e1c7, 0x03e8e,
+    0x1eb42, 0x2a991, 0x12b4c, 0x2a993, 0x2a372, 0x141a6, 0x2a375, 0x141a7, 0x22b46, 0x16398, 0x16b4e, 0x23e65, 0x2a373, 0x141a8, 0x2a376, 0x11e59,
+    0x02c92, 0x08cc1, 0x21aa3, 0x1ba66, 0x021d1, 0x021d2, 0x21aa2, 0x1ba62, 0x28fc1, 0x021d0, 0x23a66, 0x19e52, 0x0e1d2, 0x03dc1, 0x1fa62, 0x19e22,
+    0x04f56, 0x163c4, 0x2e394, 0x163c6, 0x1af72, 0x163d1, 0x2e3a6, 0x163d2, 0x20f60, 0x163c5, 0x2e395, 0x163c7, 0x20b75, 0x07da2, 0x2e3a7, 0x01d62,
+    0x0ec94, 0x28cc6, 0x001d6, 0x001d7, 0x00ed1, 0x1fda9, 0x199cc, 0x11f95, 0x24fc6, 0x001d8, 0x0c1d7, 0x03ebe, 0x1bda9, 0x19d64, 0x05c95, 0x01d29,
+    0x2ef82, 0x123ca, 0x2239c, 0x23aa8, 0x223ac, 0x123d3, 0x223b2, 0x21ea5, 0x2ef87, 0x123cb, 0x1fa77, 0x1fe61, 0x223ad, 0x05d87, 0x1dc6c, 0x0dc3b,
+    0x02c9c, 0x03aa8, 0x01a9f, 0x05a5a, 0x03aae, 0x0db73, 0x01a84, 0x05b43, 0x0faa8, 0x01b98, 0x1fa5a, 0x19a23, 0x01873, 0x19946, 0x11843, 0x19e0e,
+    0x0090a, 0x0681b, 0x0091b, 0x08920, 0x0ca34, 0x02941, 0x0293b, 0x08945, 0x0e91f, 0x02928, 0x14922, 0x0892a, 0x0e943, 0x0294d, 0x14947, 0x09f4f,
+    0x1a81f, 0x1a822, 0x0a828, 0x2682a, 0x2c857, 0x2c859, 0x26861, 0x25f63, 0x0a98c, 0x0888e, 0x2698e, 0x2608f, 0x24895, 0x29797, 0x08199, 0x09f2a,
+    0x18d34, 0x0683b, 0x0a841, 0x0a845, 0x2496a, 0x2686c, 0x2496c, 0x2606d, 0x16957, 0x24961, 0x28959, 0x27e63, 0x28973, 0x24177, 0x24174, 0x09f45,
+    0x1a843, 0x1a847, 0x0a84d, 0x27e4f, 0x2c873, 0x26074, 0x26077, 0x0be45, 0x26995, 0x0a099, 0x2d697, 0x27e2a, 0x0a0a9, 0x29793, 0x2d693, 0x09f20,
+    0x10e42, 0x22c5e, 0x2c092, 0x2c093, 0x1ca6a, 0x2286f, 0x2e8a5, 0x25774, 0x04a91, 0x260c0, 0x260c1, 0x09799, 0x04aa5, 0x29d89, 0x260cf, 0x15f47,
+    0x1ec58, 0x22c62, 0x2c096, 0x2c097, 0x22873, 0x17f76, 0x2c0a8, 0x29f59, 0x260c6, 0x260c7, 0x260c8, 0x27f8e, 0x260d2, 0x17d62, 0x276c1, 0x15f22,
+    0x00c82, 0x20c87, 0x2c09c, 0x27677, 0x2c0ac, 0x2c0ad, 0x2c0b2, 0x25f6c, 0x0a0ca, 0x0a0cb, 0x2d6a8, 0x27e61, 0x0a0d3, 0x15d87, 0x2fea5, 0x03f3b,
+    0x20c84, 0x20c89, 0x2009d, 0x0be4d, 0x200ae, 0x13f6f, 0x2d69c, 0x0be41, 0x0a0cc, 0x257c0, 0x2d696, 0x0be28, 0x21dd1, 0x13d5e, 0x2d692, 0x01f1b,
+    0x1cf42, 0x28192, 0x12b5e, 0x28193, 0x04b82, 0x2819c, 0x14b87, 0x25777, 0x12b58, 0x28196, 0x16b62, 0x28197, 0x28b84, 0x2819d, 0x28b89, 0x03f4d,
+    0x00d91, 0x081c1, 0x241c0, 0x0b699, 0x081ca, 0x297a8, 0x081cb, 0x25f61, 0x241c6, 0x081c8, 0x241c7, 0x09e8e, 0x021cc, 0x29796, 0x276c0, 0x03f28,
+    0x10d6a, 0x2a9a5, 0x1296f, 0x27674, 0x281ac, 0x281b2, 0x281ad, 0x27e6c, 0x16973, 0x281a8, 0x23e76, 0x2de59, 0x281ae, 0x2979c, 0x23e6f, 0x03f41,
+    0x00da5, 0x081cf, 0x21a89, 0x1be47, 0x081d3, 0x2bfa5, 0x21a87, 0x07e3b, 0x241d2, 0x097c1, 0x23a62, 0x1be22, 0x29ad1, 0x29792, 0x23a5e, 0x07e1b,
+    0x04f72, 0x28cd1, 0x20bd1, 0x0b6a9, 0x18eac, 0x297ae, 0x0b6d3, 0x29f73, 0x1aba6, 0x037cc, 0x276d2, 0x25e95, 0x07db2, 0x29d84, 0x05ca5, 0x0ff43,
+    0x0eca6, 0x257d2, 0x0b6cc, 0x27f95, 0x10ed3, 0x17f73, 0x0b6ca, 0x17f57, 0x040da, 0x257c6, 0x276c6, 0x0bf8c, 0x1bda6, 0x13d58, 0x05c91, 0x0ff1f,
+    0x02cac, 0x097d3, 0x216ae, 0x2de73, 0x040d9, 0x297ac, 0x2d6ac, 0x25f6a, 0x1cfd3, 0x097ca, 0x23e73, 0x2de57, 0x07dac, 0x05d82, 0x1dc6a, 0x0dc34,
+    0x02cb2, 0x01ba5, 0x21a84, 0x1be43, 0x03aac, 0x13f6a, 0x01a82, 0x07e34, 0x0faa6, 0x01b91, 0x1fa58, 0x1be1f, 0x05972, 0x1d942, 0x11842, 0x01f0a,
+    0x1ef03, 0x08918, 0x2e906, 0x2491a, 0x2e32f, 0x08938, 0x16331, 0x2493a, 0x1eb09, 0x2a11e, 0x1690b, 0x2a11f, 0x2e330, 0x28942, 0x16332, 0x28944,
+    0x2e52f, 0x26938, 0x2e531, 0x2693a, 0x08179, 0x0817b, 0x0817a, 0x0817c, 0x1e538, 0x2c156, 0x1e53a, 0x2c157, 0x1017b, 0x08182, 0x1017c, 0x08183,
+    0x1ed09, 0x2e11e, 0x2e90b, 0x2e11f, 0x1e338, 0x16156, 0x1233a, 0x16157, 0x2e10d, 0x2e121, 0x2e10e, 0x2e122, 0x1e339, 0x16158, 0x1233b, 0x16159,
+    0x2e530, 0x2c942, 0x2e532, 0x2c944, 0x1e17b, 0x0a182, 0x1e17c, 0x0a183, 0x1e539, 0x22158, 0x1e53b, 0x22159, 0x1e17d, 0x1c184, 0x1e17e, 0x01e71,
+    0x08f18, 0x1c18a, 0x2e725, 0x1c18b, 0x26f38, 0x10190, 0x2275c, 0x10191, 0x2e71e, 0x1e38b, 0x22727, 0x1018c, 0x2cf42, 0x10192, 0x2275e, 0x10193,
+    0x08f38, 0x1c190, 0x1275c, 0x1c191, 0x0877b, 0x1c19a, 0x1c785, 0x1c19b, 0x16756, 0x1c194, 0x12760, 0x1c195, 0x0a782, 0x1019c, 0x1c787, 0x0dd77,
+    0x2a71e, 0x1e58b, 0x12727, 0x1c18c, 0x2c756, 0x10194, 0x1e760, 0x10195, 0x2e721, 0x1c18d, 0x1e729, 0x1c18e, 0x22758, 0x10196, 0x1e762, 0x10197,
+    0x28f42, 0x1c192, 0x1275e, 0x1c193, 0x08782, 0x1c19c, 0x10787, 0x19b77, 0x16758, 0x1c196, 0x12762, 0x1c197, 0x1c784, 0x1c19d, 0x1c789, 0x01f4d,
+    0x2ef06, 0x2e125, 0x2e110, 0x2e126, 0x2e331, 0x1215c, 0x2e336, 0x1215d, 0x2ef0b, 0x12127, 0x12111, 0x12128, 0x2e332, 0x1215e, 0x2e337, 0x1215f,
+    0x16531, 0x2215c, 0x2e536, 0x2215d, 0x0877a, 0x1c185, 0x1e17f, 0x1c186, 0x1253a, 0x1e160, 0x1e53c, 0x1e161, 0x1e77c, 0x10187, 0x10180, 0x10188,
+    0x16f0b, 0x22127, 0x22111, 0x22128, 0x1e33a, 0x12160, 0x1e33c, 0x12161, 0x2e70e, 0x1e129, 0x1e112, 0x1e12a, 0x1e33b, 0x12162, 0x1e33d, 0x12163,
+    0x16532, 0x2215e, 0x2e537, 0x2215f, 0x1077c, 0x1c187, 0x1e180, 0x1c188, 0x1253b, 0x1e162, 0x1e53d, 0x1e163, 0x1e77e, 0x1c189, 0x1e181, 0x1de3d,
+    0x24f1a, 0x1c78b, 0x2e726, 0x1e38d, 0x26f3a, 0x1c791, 0x2275d, 0x10198, 0x2e71f, 0x1e38c, 0x22728, 0x1e38e, 0x2cf44, 0x1c793, 0x2275f, 0x01c65,
+    0x24f3a, 0x10791, 0x1275d, 0x1c198, 0x0877c, 0x1c79b, 0x1c786, 0x1c19e, 0x16757, 0x10795, 0x12761, 0x1c199, 0x0a783, 0x19d77, 0x1c788, 0x01d48,
+    0x2a71f, 0x1078c, 0x12728, 0x1e58e, 0x2c757, 0x1c795, 0x1e761, 0x10199, 0x2e722, 0x1c78e, 0x1e72a, 0x1c18f, 0x22759, 0x1c797, 0x1e763, 0x1dc2a,
+    0x28f44, 0x10793, 0x1275f, 0x01a65, 0x08783, 0x0db77, 0x10788, 0x01b48, 0x16759, 0x10797, 0x12763, 0x1da2a, 0x01871, 0x0194d, 0x1d83d, 0x1dc12,
+    0x00906, 0x0891a, 0x00916, 0x0891c, 0x00a31, 0x0893a, 0x02936, 0x0893c, 0x1691a, 0x24921, 0x1691c, 0x24923, 0x1493a, 0x24946, 0x2893c, 0x24948,
+    0x04c31, 0x0a93a, 0x26936, 0x2693c, 0x0887a, 0x2487c, 0x0817f, 0x08180, 0x2615c, 0x26160, 0x2615d, 0x26161, 0x08185, 0x08187, 0x08186, 0x08188,
+    0x2091a, 0x26921, 0x2091c, 0x26923, 0x2415c, 0x24160, 0x2415d, 0x24161, 0x2e921, 0x24151, 0x2e923, 0x24152, 0x28160, 0x24164, 0x28161, 0x24165,
+    0x2093a, 0x26946, 0x2093c, 0x26948, 0x26185, 0x0a187, 0x26186, 0x0a188, 0x2c160, 0x26164, 0x2c161, 0x26165, 0x081a0, 0x081a2, 0x081a1, 0x01f5f,
+    0x00e25, 0x1e88b, 0x001bb, 0x001bc, 0x18e5c, 0x12891, 0x001bf, 0x001c0, 0x06b8b, 0x001bd, 0x101bc, 0x001be, 0x06b91, 0x001c1, 0x0c1c0, 0x03c99,
+    0x10e5c, 0x1e891, 0x041bf, 0x041c0, 0x1ee85, 0x1e89b, 0x001c9, 0x1ffa1, 0x041c4, 0x041c6, 0x041c5, 0x041c7, 0x001ca, 0x11da8, 0x001cb, 0x0df61,
+    0x02d8b, 0x041bd, 0x181bc, 0x041be, 0x001c4, 0x001c6, 0x001c5, 0x001c7, 0x1c1bd, 0x001c2, 0x1c1be, 0x001c3, 0x0c1c6, 0x001c8, 0x0c1c7, 0x01e8e,
+    0x02d91, 0x041c1, 0x181c0, 0x1bf99, 0x041ca, 0x1dba8, 0x041cb, 0x19f61, 0x181c6, 0x041c8, 0x181c7, 0x05e8e, 0x001cc, 0x11d96, 0x0fcc0, 0x01f28,
+    0x1cf31, 0x2e15c, 0x2e936, 0x2e15d, 0x06b7a, 0x28185, 0x1617f, 0x28186, 0x1693a, 0x2a160, 0x1693c, 0x2a161, 0x2ab7c, 0x14187, 0x16180, 0x14188,
+    0x00d7a, 0x20185, 0x2017f, 0x20186, 0x001b5, 0x001b7, 0x001b6, 0x001b8, 0x2e185, 0x201a0, 0x2e186, 0x201a1, 0x101b7, 0x001b9, 0x101b8, 0x0fc80,
+    0x2293a, 0x2e160, 0x2e93c, 0x2e161, 0x16185, 0x161a0, 0x16186, 0x161a1, 0x2e946, 0x2e164, 0x2e948, 0x2e165, 0x16187, 0x161a2, 0x16188, 0x11c5f,
+    0x2cd7c, 0x20187, 0x20180, 0x20188, 0x181b7, 0x061b9, 0x181b8, 0x07f80, 0x22187, 0x201a2, 0x22188, 0x19a5f, 0x1e1b9, 0x001ba, 0x11c80, 0x01e37,
+    0x00e5c, 0x1c1c4, 0x1c1bf, 0x1c1c5, 0x06e85, 0x0c1ca, 0x101c9, 0x0c1cb, 0x1ab91, 0x101c6, 0x101c0, 0x101c7, 0x06b9b, 0x05da8, 0x07ca1, 0x01c61,
+    0x02e85, 0x181ca, 0x181c9, 0x181cb, 0x24eb7, 0x1ffaf, 0x001cd, 0x1df86, 0x1c1ca, 0x181cc, 0x1c1cb, 0x13cc0, 0x07caf, 0x19d70, 0x05c86, 0x01d3c,
+    0x0ed91, 0x1c1c6, 0x1c1c0, 0x1c1c7, 0x101ca, 0x101cc, 0x101cb, 0x03fc0, 0x1c1c1, 0x1c1c8, 0x1fc99, 0x1de8e, 0x198a8, 0x05d96, 0x1dc61, 0x11c28,
+    0x02d9b, 0x01ba8, 0x01aa1, 0x05a61, 0x03aaf, 0x11b70, 0x01a86, 0x05b3c, 0x0d8a8, 0x01b96, 0x11a61, 0x19a28, 0x01870, 0x0194b, 0x1d83c, 0x11c11,
+    0x1e904, 0x08919, 0x2e907, 0x2491b, 0x14930, 0x08939, 0x28932, 0x2493b, 0x12b0a, 0x2891f, 0x1690c, 0x2a120, 0x2a334, 0x28943, 0x16335, 0x28945,
+    0x1a930, 0x26939, 0x20932, 0x2693b, 0x2417b, 0x0817d, 0x2417c, 0x0817e, 0x22542, 0x2c158, 0x22544, 0x2c159, 0x24182, 0x08184, 0x24183, 0x15e71,
+    0x1ed0a, 0x2c91f, 0x2e90c, 0x2e120, 0x16342, 0x28158, 0x16344, 0x28159, 0x2e90e, 0x2e123, 0x2e10f, 0x2e124, 0x16343, 0x1615a, 0x16345, 0x1615b,
+    0x2e534, 0x2c943, 0x2e535, 0x2c945, 0x26182, 0x26184, 0x26183, 0x1be71, 0x22543, 0x2c15a, 0x22545, 0x2c15b, 0x1e184, 0x0819f, 0x2fe71, 0x01e55,
+    0x2e73e, 0x12390, 0x2e74a, 0x12392, 0x1ab68, 0x101a4, 0x2236e, 0x101a5, 0x2e742, 0x12391, 0x2274c, 0x12393, 0x2236a, 0x123a5, 0x2236f, 0x0fc74,
+    0x14d68, 0x1c1a4, 0x1256e, 0x1c1a5, 0x1c1aa, 0x1c1b0, 0x1c1ab, 0x1c1b1, 0x16772, 0x1c1a6, 0x12575, 0x1c1a7, 0x101ac, 0x101b2, 0x101ad, 0x0fe6c,
+    0x2a742, 0x1e591, 0x1274c, 0x1e593, 0x1e372, 0x101a6, 0x1e375, 0x101a7, 0x2e746, 0x12398, 0x1e74e, 0x2fe65, 0x1e373, 0x101a8, 0x1e376, 0x15e59,
+    0x1656a, 0x1e5a5, 0x1256f, 0x21e74, 0x1c1ac, 0x1c1b2, 0x1c1ad, 0x1be6c, 0x12573, 0x1c1a8, 0x12576, 0x21e59, 0x1c1ae, 0x11d9c, 0x2fe6f, 0x01f41,
+    0x1ef0b, 0x2e127, 0x2e111, 0x2e128, 0x2a33a, 0x16160, 0x1633c, 0x16161, 0x22b0e, 0x16129, 0x16112, 0x1612a, 0x2a33b, 0x16162, 0x1633d, 0x16163,
+    0x2e53a, 0x22160, 0x2e53c, 0x22161, 0x1e185, 0x1e1a0, 0x1e186, 0x1e1a1, 0x22546, 0x22164, 0x22548, 0x22165, 0x12187, 0x101a2, 0x12188, 0x15c5f,
+    0x12d0e, 0x2e129, 0x2e112, 0x2e12a, 0x12346, 0x12164, 0x12348, 0x12165, 0x2e113, 0x2e12b, 0x2e114, 0x2e12c, 0x12347, 0x12166, 0x12349, 0x13e24,
+    0x2e53b, 0x22162, 0x2e53d, 0x22163, 0x1e187, 0x1e1a2, 0x1e188, 0x1ba5f, 0x22547, 0x22166, 0x22549, 0x23e24, 0x1e189, 0x1e1a3, 0x1fe3d, 0x1fe1d,
+    0x2e73f, 0x12394, 0x2e74b, 0x12396, 0x2236b, 0x123a6, 0x22370, 0x123a8, 0x2e743, 0x12395, 0x2274d, 0x12397, 0x2236c, 0x123a7, 0x22371, 0x0fc59,
+    0x1656b, 0x1e5a6, 0x12570, 0x1e5a8, 0x1e7ab, 0x1c1b3, 0x1c1af, 0x1df9b, 0x16773, 0x1c1a9, 0x12577, 0x17c93, 0x1e7ad, 0x19d75, 0x19c83, 0x01d44,
+    0x2a743, 0x1e595, 0x1274d, 0x1e597, 0x22773, 0x101a9, 0x1e377, 0x23a93, 0x2e747, 0x12399, 0x1e74f, 0x1fe2a, 0x1e374, 0x19893, 0x13e45, 0x11c20,
+    0x1656c, 0x1e5a7, 0x12571, 0x1ba59, 0x127ad, 0x0db75, 0x23a83, 0x05b44, 0x16774, 0x0d893, 0x1fe45, 0x1fe20, 0x0186f, 0x0194c, 0x1fe35, 0x1de0c,
+    0x00907, 0x0891b, 0x00917, 0x0891d, 0x02932, 0x0893b, 0x02937, 0x0893d, 0x1691b, 0x24922, 0x1691d, 0x24924, 0x1493b, 0x24947, 0x2893d, 0x25e49,
+    0x06932, 0x0a93b, 0x26937, 0x2693d, 0x0887c, 0x0887e, 0x24180, 0x08181, 0x2615e, 0x26162, 0x2615f, 0x26163, 0x24187, 0x08189, 0x24188, 0x09e3d,
+    0x2091b, 0x26922, 0x2091d, 0x26924, 0x2415e, 0x24162, 0x2415f, 0x24163, 0x2e922, 0x24952, 0x2e924, 0x24153, 0x28162, 0x24166, 0x28163, 0x25e24,
+    0x2093b, 0x26947, 0x2093d, 0x27e49, 0x26187, 0x26189, 0x26188, 0x27e3d, 0x2c162, 0x26166, 0x2c163, 0x27e24, 0x241a2, 0x081a3, 0x2f65f, 0x09e1d,
+    0x00e4a, 0x1cc92, 0x016ce, 0x096a3, 0x18a6e, 0x128a5, 0x036ba, 0x09689, 0x18f92, 0x00ac1, 0x176a3, 0x25666, 0x06ba5, 0x001cf, 0x29689, 0x25e47,
+    0x10c6e, 0x1e8a5, 0x276ba, 0x27689, 0x1e8ab, 0x1ffb1, 0x096b9, 0x09f7e, 0x041d1, 0x041d2, 0x2b6a2, 0x25662, 0x001d3, 0x13fa5, 0x29687, 0x09e3b,
+    0x00c92, 0x04cc1, 0x216a3, 0x27666, 0x001d1, 0x001d2, 0x2d6a2, 0x27662, 0x1cfc1, 0x001d0, 0x2f666, 0x25e52, 0x0c1d2, 0x01dc1, 0x2b662, 0x25e22,
+    0x02da5, 0x041cf, 0x21689, 0x27e47, 0x041d3, 0x1ffa5, 0x2d687, 0x0be3b, 0x181d2, 0x05bc1, 0x2f662, 0x27e22, 0x1d6d1, 0x11d92, 0x2f65e, 0x09e1b,
+    0x1e932, 0x2e15e, 0x2e937, 0x2e15f, 0x16b7c, 0x28187, 0x2a180, 0x28188, 0x1693b, 0x2a162, 0x1693d, 0x2a163, 0x16b7e, 0x28189, 0x16181, 0x29e3d,
+    0x20d7c, 0x2c187, 0x2c180, 0x2c188, 0x241b7, 0x081b9, 0x241b8, 0x25680, 0x2e187, 0x2c1a2, 0x2e188, 0x2565f, 0x161b9, 0x021ba, 0x2b680, 0x03e37,
+    0x2293b, 0x2e162, 0x2e93d, 0x2e163, 0x2a187, 0x2a1a2, 0x2a188, 0x2765f, 0x2e947, 0x2e166, 0x2fe49, 0x2fe24, 0x16189, 0x161a3, 0x17e3d, 0x17e1d,
+    0x20d7e, 0x20189, 0x20181, 0x21e3d, 0x201b9, 0x261ba, 0x2d680, 0x27e37, 0x2e189, 0x201a3, 0x2fe3d, 0x21e1d, 0x2e1ba, 0x001ce, 0x2fe37, 0x01e17,
+    0x00f6e, 0x1c1d1, 0x2f6ba, 0x256a2, 0x06bab, 0x0c1d3, 0x176b9, 0x25687, 0x1aba5, 0x101d2, 0x17689, 0x29662, 0x07cb1, 0x07ca5, 0x17c7e, 0x15e3b,
+    0x02dab, 0x181d3, 0x216b9, 0x27687, 0x001d4, 0x1ffab, 0x256b7, 0x09f7c, 0x1c1d3, 0x016d1, 0x2b687, 0x2565e, 0x07cab, 0x19d6e, 0x17c7c, 0x03e32,
+    0x0eda5, 0x1c1d2, 0x2f689, 0x2d662, 0x101d3, 0x056d1, 0x2f687, 0x2765e, 0x1c1cf, 0x1d8c1, 0x2fe47, 0x2fe22, 0x1bca5, 0x05d92, 0x17e3b, 0x17e1b,
+    0x02db1, 0x03aa5, 0x21a7e, 0x21e3b, 0x03aab, 0x11b6e, 0x21a7c, 0x07e32, 0x0faa5, 0x01b92, 0x23e3b, 0x21e1b, 0x0186e, 0x0194a, 0x1fe32, 0x01e07,
+    0x1cb09, 0x0291e, 0x0e91a, 0x02921, 0x00a30, 0x02942, 0x0e93a, 0x02946, 0x1eb19, 0x14927, 0x16b1f, 0x28929, 0x1af40, 0x1494c, 0x14944, 0x2894e,
+    0x1cc38, 0x06856, 0x0a85c, 0x0a860, 0x1ee7b, 0x24882, 0x08885, 0x24887, 0x24190, 0x24194, 0x24191, 0x24195, 0x0819a, 0x0819c, 0x0819b, 0x03d77,
+    0x1cd33, 0x24956, 0x12b3f, 0x24958, 0x2eb68, 0x28172, 0x2a36b, 0x28173, 0x1eb39, 0x28960, 0x16b43, 0x28962, 0x2e369, 0x28175, 0x2a36c, 0x28176,
+    0x00d68, 0x0a972, 0x0a96e, 0x0a975, 0x081aa, 0x081ac, 0x081ab, 0x081ad, 0x241a4, 0x241a6, 0x241a5, 0x241a7, 0x081b0, 0x081b2, 0x081b1, 0x01e6c,
+    0x06f1e, 0x1ca8b, 0x20b8b, 0x163bd, 0x06f42, 0x1ee92, 0x2cb91, 0x168c1, 0x1af27, 0x2e3bc, 0x2e38c, 0x163be, 0x1af4c, 0x09da3, 0x2cb93, 0x03d66,
+    0x02e56, 0x12e94, 0x207c4, 0x2e8c6, 0x26e82, 0x1ee9c, 0x1a7ca, 0x13da8, 0x26794, 0x080d6, 0x207c6, 0x080d7, 0x0a79c, 0x09d9f, 0x0bda8, 0x03d5a,
+    0x08f56, 0x1e3c4, 0x22394, 0x123c6, 0x2c772, 0x1e3d1, 0x223a6, 0x123d2, 0x2cf60, 0x1e3c5, 0x22395, 0x123c7, 0x2c775, 0x09da2, 0x223a7, 0x03d62,
+    0x08f72, 0x1ccd1, 0x207d1, 0x07aa9, 0x0a7ac, 0x1fdae, 0x1a7d3, 0x1df73, 0x267a6, 0x01bcc, 0x207d2, 0x19e95, 0x0a7b2, 0x1dd84, 0x09ca5, 0x0df43,
+    0x18f1a, 0x28b8b, 0x2eb26, 0x1638d, 0x1af3a, 0x28b91, 0x2eb5d, 0x14198, 0x22b1f, 0x2a38c, 0x2eb28, 0x1638e, 0x20f44, 0x28b93, 0x2eb5f, 0x03c65,
+    0x02e5c, 0x281c4, 0x281bf, 0x281c5, 0x26e85, 0x0e1ca, 0x141c9, 0x0e1cb, 0x26791, 0x141c6, 0x141c0, 0x141c7, 0x2679b, 0x09da8, 0x09ca1, 0x03c61,
+    0x22b3f, 0x16394, 0x2eb4b, 0x16396, 0x2e36b, 0x163a6, 0x2e370, 0x163a8, 0x22b43, 0x16395, 0x2eb4d, 0x16397, 0x2e36c, 0x163a7, 0x2e371, 0x0dc59,
+    0x02f6e, 0x281d1, 0x2faba, 0x19aa2, 0x267ab, 0x0e1d3, 0x1fab9, 0x19a87, 0x267a5, 0x141d2, 0x1fa89, 0x1da62, 0x267b1, 0x0bca5, 0x1fc7e, 0x11e3b,
+    0x0af21, 0x2e3bd, 0x2e38d, 0x2e3c2, 0x0af46, 0x2eec1, 0x20798, 0x2e3d0, 0x20f29, 0x2e3be, 0x2e38e, 0x2e3c3, 0x20f4e, 0x0bd66, 0x0bc65, 0x01c52,
+    0x08e60, 0x2aec6, 0x207c5, 0x1c3d8, 0x26e87, 0x1fda8, 0x1a7cb, 0x11f98, 0x26795, 0x1c3d7, 0x207c7, 0x1fcbe, 0x07d77, 0x07d5a, 0x07c61, 0x01d23,
+    0x26f58, 0x1e3c6, 0x22396, 0x1e3c8, 0x2c773, 0x1e3d2, 0x223a8, 0x1fac1, 0x2cf62, 0x1e3c7, 0x22397, 0x1fc8e, 0x2c776, 0x07d62, 0x19c59, 0x01c22,
+    0x08f75, 0x03aa9, 0x0faa2, 0x01a64, 0x0a7ad, 0x11973, 0x0da87, 0x01b46, 0x267a7, 0x0d895, 0x11a62, 0x1da29, 0x0586c, 0x19943, 0x1d83b, 0x01c0e,
+    0x0090b, 0x0081f, 0x0091c, 0x02923, 0x00a32, 0x02944, 0x0293c, 0x02948, 0x0cb1f, 0x02929, 0x14923, 0x0292b, 0x0e944, 0x0294e, 0x14948, 0x03d50,
+    0x1cc3a, 0x06857, 0x0a85d, 0x0a861, 0x1087c, 0x24883, 0x08886, 0x29f88, 0x08891, 0x08895, 0x24198, 0x24199, 0x0889b, 0x29d77, 0x0819e, 0x15d48,
+    0x18d3f, 0x0a958, 0x24954, 0x2495a, 0x2496e, 0x24975, 0x24970, 0x24977, 0x16958, 0x24964, 0x1695a, 0x24966, 0x28975, 0x24178, 0x28977, 0x03d4e,
+    0x04c6b, 0x06873, 0x0a970, 0x0a977, 0x268ab, 0x2bfad, 0x081af, 0x07f83, 0x269a6, 0x241a9, 0x269a8, 0x07f93, 0x081b3, 0x29d75, 0x09c9b, 0x0fd44,
+    0x18e27, 0x10a8c, 0x0abbc, 0x168be, 0x18e5e, 0x12893, 0x0abc0, 0x29599, 0x04a8c, 0x00abe, 0x26bbe, 0x080d5, 0x06b93, 0x25d66, 0x25599, 0x03d2b,
+    0x10e60, 0x1e895, 0x2e8c5, 0x2dfc7, 0x1ee87, 0x17d77, 0x295cb, 0x17f61, 0x1aec6, 0x240d7, 0x080d8, 0x27fbe, 0x27da8, 0x17d5a, 0x25598, 0x15d23,
+    0x0cc94, 0x1ccc6, 0x021d6, 0x021d7, 0x02ed1, 0x295a9, 0x255cc, 0x15f95, 0x18fc6, 0x021d8, 0x0e1d7, 0x01ebe, 0x255a9, 0x25d64, 0x09c95, 0x03d29,
+    0x0cca6, 0x1ccd2, 0x0bacc, 0x1bf95, 0x295d3, 0x13f73, 0x295ca, 0x1df57, 0x080da, 0x19bc6, 0x1bac6, 0x07f8c, 0x27da6, 0x17d58, 0x09c91, 0x0df1f,
+    0x18f3a, 0x14b91, 0x12b5d, 0x28198, 0x06b7c, 0x28b9b, 0x28b86, 0x2819e, 0x1cb57, 0x14b95, 0x16b61, 0x28199, 0x06b83, 0x25d77, 0x25c88, 0x03d48,
+    0x00e85, 0x241ca, 0x241c9, 0x241cb, 0x18eb7, 0x295af, 0x021cd, 0x29f86, 0x281ca, 0x241cc, 0x281cb, 0x17cc0, 0x095af, 0x25d70, 0x09c86, 0x03d3c,
+    0x10f6b, 0x2a9a6, 0x12970, 0x2a9a8, 0x16bab, 0x281b3, 0x281af, 0x29f9b, 0x12b73, 0x281a9, 0x16977, 0x13c93, 0x27cad, 0x25d75, 0x25c83, 0x03d44,
+    0x00dab, 0x241d3, 0x21ab9, 0x1ba87, 0x021d4, 0x17fab, 0x19ab7, 0x07f7c, 0x281d3, 0x03ad1, 0x1fa87, 0x19a5e, 0x27cab, 0x25d6e, 0x11c7c, 0x01e32,
+    0x04e60, 0x1eec6, 0x20bc5, 0x283d8, 0x1ae87, 0x2bda8, 0x255cb, 0x29598, 0x1ab95, 0x283d7, 0x2fcc7, 0x17cbe, 0x0bd77, 0x25d5a, 0x0bc61, 0x03d23,
+    0x00ea0, 0x12ecc, 0x001db, 0x21fc5, 0x20eb9, 0x13d70, 0x255c9, 0x13f5d, 0x0aecc, 0x035d6, 0x2fcc5, 0x13cbc, 0x0bd70, 0x25d54, 0x0bc5d, 0x01d1c,
+    0x00fa6, 0x0e1da, 0x13acc, 0x1fac6, 0x255d3, 0x2bda6, 0x255ca, 0x15f91, 0x18fd2, 0x1d8c6, 0x1fc95, 0x13c8c, 0x07c73, 0x0bd58, 0x07c57, 0x01c1f,
+    0x02eb3, 0x01ba6, 0x01aa0, 0x05a60, 0x019ab, 0x13d6b, 0x01a85, 0x19b3a, 0x0d8a6, 0x01b94, 0x11a60, 0x19a27, 0x07d6b, 0x1993f, 0x1d83a, 0x01d0b,
+    0x10b0a, 0x0291f, 0x0e91b, 0x02922, 0x00a34, 0x02943, 0x0e93b, 0x02947, 0x10b1b, 0x14928, 0x16b20, 0x2892a, 0x14941, 0x1494d, 0x14945, 0x29c4f,
+    0x18c42, 0x06858, 0x0a85e, 0x0a862, 0x08882, 0x08884, 0x08887, 0x08889, 0x24192, 0x24196, 0x24193, 0x24197, 0x2419c, 0x0819d, 0x29477, 0x15c4d,
+    0x1cd34, 0x24957, 0x12b41, 0x24959, 0x2ab6a, 0x24973, 0x2896c, 0x28174, 0x12b3b, 0x28961, 0x16b45, 0x2be63, 0x2ab6c, 0x28177, 0x2816d, 0x15c45,
+    0x04d6a, 0x0a973, 0x0a96f, 0x21e76, 0x241ac, 0x081ae, 0x241ad, 0x1be6f, 0x269a5, 0x241a8, 0x2b674, 0x2fe59, 0x241b2, 0x2549c, 0x2be6c, 0x15c41,
+    0x04e42, 0x10a91, 0x2e392, 0x163c1, 0x18a6a, 0x10aa5, 0x2cba5, 0x163cf, 0x1af5e, 0x2a3c0, 0x2e393, 0x15499, 0x1ab6f, 0x09d89, 0x29474, 0x03c47,
+    0x10c72, 0x1e8a6, 0x2e8d1, 0x2b6d2, 0x1ceac, 0x13db2, 0x176d3, 0x11fa5, 0x08fd1, 0x154cc, 0x176a9, 0x29e95, 0x094ae, 0x09d84, 0x25c73, 0x03c43,
+    0x22f82, 0x163ca, 0x2e39c, 0x2f6a8, 0x2e3ac, 0x163d3, 0x2e3b2, 0x2dea5, 0x22f87, 0x163cb, 0x2b677, 0x2be61, 0x2e3ad, 0x09d87, 0x29c6c, 0x0fc3b,
+    0x00cac, 0x18cd3, 0x2f6ae, 0x21e73, 0x080d9, 0x13dac, 0x2f6ac, 0x19f6a, 0x154d3, 0x154ca, 0x2fe73, 0x21e57, 0x254ac, 0x09d82, 0x29c6a, 0x0fc34,
+    0x1eb1f, 0x14b8c, 0x12b28, 0x1698e, 0x20b57, 0x28b95, 0x2ab61, 0x14199, 0x22b22, 0x28b8e, 0x16b2a, 0x2818f, 0x2eb59, 0x25497, 0x29c63, 0x29c2a,
+    0x0cd91, 0x281c6, 0x281c0, 0x281c7, 0x141ca, 0x141cc, 0x141cb, 0x2b6c0, 0x281c1, 0x281c8, 0x17699, 0x29e8e, 0x254a8, 0x25496, 0x29c61, 0x15c28,
+    0x1eb43, 0x2a995, 0x12b4d, 0x2f697, 0x2eb73, 0x141a9, 0x2a377, 0x2f693, 0x22b47, 0x16399, 0x17e4f, 0x17e2a, 0x2a374, 0x25493, 0x17e45, 0x15c20,
+    0x0cda5, 0x281d2, 0x2fa89, 0x21a62, 0x141d3, 0x09ad1, 0x23a87, 0x1ba5e, 0x281cf, 0x294c1, 0x23e47, 0x23e22, 0x27ca5, 0x25492, 0x13e3b, 0x11e1b,
+    0x1af58, 0x2a3c6, 0x2e396, 0x163c8, 0x20b73, 0x2a3d2, 0x2e3a8, 0x176c1, 0x20f62, 0x2a3c7, 0x2e397, 0x17c8e, 0x0bc76, 0x0bd62, 0x25c59, 0x03c22,
+    0x02fa6, 0x0c1da, 0x136cc, 0x2b6c6, 0x04ed3, 0x1fda6, 0x176ca, 0x11f91, 0x294d2, 0x294c6, 0x2bc95, 0x17c8c, 0x0bc73, 0x07d58, 0x25c57, 0x03c1f,
+    0x2ef84, 0x123cc, 0x2e39d, 0x2f696, 0x2e3ae, 0x2fdd1, 0x2f69c, 0x2f692, 0x2ef89, 0x294c0, 0x13e4d, 0x13e28, 0x0bc6f, 0x0bd5e, 0x13e41, 0x0fc1b,
+    0x0efb2, 0x03aa6, 0x2fa84, 0x1ba58, 0x0faac, 0x0db72, 0x23a82, 0x05b42, 0x0d8a5, 0x0d891, 0x1fe43, 0x1fe1f, 0x07c6a, 0x19942, 0x13e34, 0x0dc0a,
+    0x0090c, 0x02920, 0x0091d, 0x02924, 0x00a35, 0x02945, 0x0293d, 0x03749, 0x0cb20, 0x0292a, 0x14924, 0x0362c, 0x0e945, 0x0354f, 0x15449, 0x03614,
+    0x18c44, 0x06859, 0x0a85f, 0x09663, 0x08883, 0x15771, 0x03688, 0x0973d, 0x08893, 0x03797, 0x15665, 0x0962a, 0x03477, 0x1554d, 0x15448, 0x09612,
+    0x18d41, 0x0a959, 0x24955, 0x0965b, 0x2496f, 0x0f776, 0x24971, 0x09745, 0x16959, 0x24965, 0x2b65b, 0x25624, 0x03476, 0x0354e, 0x15445, 0x2560f,
+    0x0696c, 0x0a974, 0x0a971, 0x27e45, 0x016ad, 0x1576f, 0x03683, 0x09735, 0x0d6a7, 0x03793, 0x2b659, 0x25620, 0x03475, 0x1554c, 0x15444, 0x09e0c,
+    0x18e4c, 0x10a93, 0x016a3, 0x03666, 0x18a6f, 0x0f774, 0x03689, 0x03747, 0x04a93, 0x03799, 0x15666, 0x0362b, 0x09574, 0x25547, 0x15447, 0x03613,
+    0x10c75, 0x037a7, 0x016a2, 0x09662, 0x0f5ad, 0x1576c, 0x03687, 0x2573b, 0x0d6a9, 0x03795, 0x15664, 0x09629, 0x09573, 0x29543, 0x15446, 0x15f0e,
+    0x00c9c, 0x016a8, 0x0169f, 0x0965a, 0x016ae, 0x0f773, 0x03684, 0x09743, 0x0d6a8, 0x03798, 0x2b65a, 0x25623, 0x03473, 0x25546, 0x15443, 0x25e0e,
+    0x016b2, 0x037a5, 0x21684, 0x27e43, 0x016ac, 0x1576a, 0x03682, 0x25734, 0x0d6a6, 0x03791, 0x2b658, 0x27e1f, 0x09572, 0x29542, 0x15442, 0x03f0a,
+    0x1cf44, 0x14b93, 0x12b5f, 0x03665, 0x04b83, 0x0f777, 0x0f688, 0x03748, 0x12b59, 0x0f497, 0x15663, 0x2962a, 0x03471, 0x0354d, 0x2943d, 0x29612,
+    0x00d9b, 0x037a8, 0x016a1, 0x09661, 0x016af, 0x15770, 0x03686, 0x0973c, 0x0f4a8, 0x03796, 0x15661, 0x25628, 0x03470, 0x0354b, 0x2943c, 0x25611,
+    0x1296c, 0x016a7, 0x12971, 0x27659, 0x0d6ad, 0x0f775, 0x2f683, 0x09744, 0x12b74, 0x0f493, 0x2be45, 0x29620, 0x0346f, 0x0354c, 0x29435, 0x29e0c,
+    0x016b1, 0x016a5, 0x2167e, 0x2de3b, 0x016ab, 0x1576e, 0x2d67c, 0x27e32, 0x0d6a5, 0x03792, 0x2fe3b, 0x2de1b, 0x0346e, 0x0354a, 0x17e32, 0x03e07,
+    0x04f75, 0x016a9, 0x0f6a2, 0x03664, 0x035ad, 0x15573, 0x0f687, 0x03746, 0x0f4a7, 0x0f495, 0x15662, 0x29629, 0x0946c, 0x25543, 0x2943b, 0x03c0e,
+    0x016b3, 0x037a6, 0x016a0, 0x09660, 0x035ab, 0x1576b, 0x03685, 0x2573a, 0x0f4a6, 0x03794, 0x15660, 0x25627, 0x0946b, 0x2553f, 0x2943a, 0x03d0b,
+    0x0d6b2, 0x016a6, 0x2f684, 0x27658, 0x0d6ac, 0x0f772, 0x2f682, 0x09742, 0x0f4a5, 0x0f491, 0x2be43, 0x2be1f, 0x0946a, 0x25542, 0x29434, 0x0fc0a,
+    0x016b0, 0x016a4, 0x2167d, 0x21e39, 0x016aa, 0x13f68, 0x2d67b, 0x0be30, 0x0d6a4, 0x03790, 0x2fe39, 0x21e19, 0x0bc68, 0x2553e, 0x13e30, 0x01e04,
+    0x00c02, 0x20c09, 0x20d09, 0x0a50d, 0x2ec2e, 0x20033, 0x20038, 0x20039, 0x2ed2e, 0x20138, 0x20133, 0x20139, 0x0a067, 0x0a068, 0x0a168, 0x0a069,
+    0x08c04, 0x2640a, 0x2650b, 0x0a40e, 0x2ec30, 0x20034, 0x2003a, 0x2003b, 0x1a13e, 0x1a142, 0x1a13f, 0x1a143, 0x00468, 0x0606a, 0x0606b, 0x0606c,
+    0x08d04, 0x2640b, 0x2650a, 0x0a50e, 0x1a03e, 0x1a03f, 0x1a042, 0x1a043, 0x2ed30, 0x2013a, 0x20134, 0x2013b, 0x00568, 0x0616b, 0x0616a, 0x0616c,
+    0x08505, 0x2640c, 0x2650c, 0x0a50f, 0x1a040, 0x1a041, 0x1a044, 0x1a045, 0x1a140, 0x1a144, 0x1a141, 0x1a145, 0x00569, 0x0446c, 0x0456c, 0x0606d,
+    0x28c09, 0x2441a, 0x0851e, 0x0a421, 0x28633, 0x2ec3f, 0x04456, 0x1a458, 0x28738, 0x0055c, 0x00556, 0x04560, 0x02668, 0x0046e, 0x00572, 0x04475,
+    0x2440a, 0x2441b, 0x0a41f, 0x0a422, 0x14634, 0x2ec41, 0x04457, 0x1a459, 0x0e742, 0x0055e, 0x00558, 0x04562, 0x0266a, 0x0046f, 0x04473, 0x04476,
+    0x0840b, 0x0841c, 0x0851f, 0x0a423, 0x1463f, 0x00454, 0x04458, 0x0445a, 0x1473a, 0x0055d, 0x00557, 0x04561, 0x0276b, 0x00470, 0x00573, 0x04477,
+    0x0840c, 0x0841d, 0x08520, 0x0a424, 0x14641, 0x00455, 0x04459, 0x0445b, 0x0e744, 0x0055f, 0x00559, 0x04563, 0x0046c, 0x00471, 0x00574, 0x19f45,
+    0x28d09, 0x0a51e, 0x2451a, 0x0a521, 0x28638, 0x00456, 0x0045c, 0x04460, 0x28733, 0x04556, 0x2ed3f, 0x1a558, 0x02768, 0x04572, 0x0056e, 0x04575,
+    0x0850b, 0x0841f, 0x0851c, 0x0a523, 0x1463a, 0x00457, 0x0045d, 0x04461, 0x1473f, 0x04558, 0x00554, 0x0455a, 0x0266b, 0x00473, 0x00570, 0x04577,
+    0x2450a, 0x0a51f, 0x2451b, 0x0a522, 0x0e642, 0x00458, 0x0045e, 0x04462, 0x14734, 0x04557, 0x2ed41, 0x1a559, 0x0276a, 0x04573, 0x0056f, 0x04576,
+    0x0850c, 0x0a520, 0x0851d, 0x0a524, 0x0e644, 0x00459, 0x0045f, 0x04463, 0x14741, 0x04559, 0x00555, 0x0455b, 0x0056c, 0x04574, 0x00571, 0x19e45,
+    0x0250d, 0x02421, 0x02521, 0x00551, 0x28639, 0x0e458, 0x00460, 0x00464, 0x28739, 0x00560, 0x0e558, 0x00564, 0x02669, 0x00475, 0x00575, 0x00578,
+    0x0240e, 0x02422, 0x02523, 0x00452, 0x1463b, 0x0e459, 0x00461, 0x00465, 0x0e743, 0x00562, 0x0055a, 0x00566, 0x0266c, 0x00476, 0x00577, 0x1dd4e,
+    0x0250e, 0x02423, 0x02522, 0x00552, 0x0e643, 0x0045a, 0x00462, 0x00466, 0x1473b, 0x00561, 0x0e559, 0x00565, 0x0276c, 0x00477, 0x00576, 0x1dc4e,
+    0x0250f, 0x02424, 0x02524, 0x00553, 0x0e645, 0x0045b, 0x00463, 0x01b24, 0x0e745, 0x00563, 0x0055b, 0x01a24, 0x0266d, 0x0d945, 0x0d845, 0x01a0f,
+    0x06c04, 0x20c0a, 0x0690b, 0x0a80e, 0x22c30, 0x2c034, 0x2c03a, 0x2c03b, 0x2613e, 0x26142, 0x2613f, 0x26143, 0x02868, 0x0a06a, 0x0a06b, 0x0a06c,
+    0x26c07, 0x20c0c, 0x26411, 0x20412, 0x2ec32, 0x20035, 0x2003c, 0x2003d, 0x2614a, 0x0a14c, 0x2614b, 0x0a14d, 0x0a06e, 0x0a06f, 0x0a070, 0x0a071,
+    0x0ac0a, 0x26c0e, 0x1ad0e, 0x26413, 0x20042, 0x20043, 0x1a046, 0x1a047, 0x2c142, 0x26146, 0x2c143, 0x26147, 0x06072, 0x06073, 0x0a173, 0x06074,
+    0x26c0c, 0x2640f, 0x26412, 0x26414, 0x20044, 0x20045, 0x1a048, 0x1a049, 0x1a14c, 0x0614e, 0x1a14d, 0x0614f, 0x06075, 0x06076, 0x06077, 0x1bb45,
+    0x16c19, 0x2ec1f, 0x26427, 0x20429, 0x16c39, 0x2ec43, 0x20460, 0x20462, 0x1a090, 0x1a091, 0x1a094, 0x1a095, 0x1a0a4, 0x1a0a5, 0x1a0a6, 0x1a0a7,
+    0x2ac1b, 0x2c420, 0x26428, 0x2042a, 0x2ac3b, 0x2ec45, 0x20461, 0x20463, 0x1a092, 0x1a093, 0x1a096, 0x1a097, 0x184a5, 0x1ff74, 0x1a0a8, 0x1ff59,
+    0x24c1f, 0x26423, 0x26429, 0x2642b, 0x2e458, 0x2045a, 0x1a464, 0x1a466, 0x06591, 0x1a098, 0x06595, 0x1a099, 0x184a6, 0x184a8, 0x1a0a9, 0x01e93,
+    0x26420, 0x26424, 0x2642a, 0x2642c, 0x2e459, 0x2045b, 0x1a465, 0x1bb24, 0x06593, 0x27b65, 0x06597, 0x07b2a, 0x184a7, 0x23b59, 0x0ba93, 0x19f20,
+    0x02c30, 0x0a542, 0x2653a, 0x0a546, 0x2a47b, 0x1a482, 0x06485, 0x1a487, 0x22d68, 0x20172, 0x2056b, 0x20173, 0x061aa, 0x061ac, 0x061ab, 0x061ad,
+    0x08c32, 0x0a544, 0x2653c, 0x0a548, 0x2a47c, 0x1a483, 0x06486, 0x1a488, 0x1a56e, 0x1a575, 0x1a570, 0x1a577, 0x044ab, 0x184ad, 0x061af, 0x01f83,
+    0x26534, 0x0a543, 0x2653b, 0x0a547, 0x06482, 0x06484, 0x06487, 0x06489, 0x2056a, 0x1a573, 0x2056c, 0x20174, 0x1a1ac, 0x061ae, 0x1a1ad, 0x11e6f,
+    0x26535, 0x0a545, 0x2653d, 0x0a549, 0x06483, 0x27b71, 0x06488, 0x07b3d, 0x1a56f, 0x1a576, 0x1a571, 0x07b45, 0x044ad, 0x27b6f, 0x0ba83, 0x05e35,
+    0x28c39, 0x24458, 0x0a460, 0x0a464, 0x1647d, 0x16484, 0x064a0, 0x184a2, 0x065a4, 0x044a6, 0x065a6, 0x065a9, 0x044b0, 0x184b2, 0x044b3, 0x01d75,
+    0x28c3b, 0x24459, 0x0a461, 0x0a465, 0x1647e, 0x23b71, 0x064a1, 0x23f5f, 0x044a5, 0x044a7, 0x065a8, 0x21f93, 0x044b1, 0x1fb6c, 0x0599b, 0x11d44,
+    0x24c43, 0x2445a, 0x0a462, 0x0a466, 0x28484, 0x0649f, 0x064a2, 0x064a3, 0x065a5, 0x044a8, 0x065a7, 0x1de93, 0x044b2, 0x19d9c, 0x1d875, 0x11c4c,
+    0x24c45, 0x2445b, 0x0a463, 0x0bb24, 0x03b71, 0x03b55, 0x03a5f, 0x07b1d, 0x03a74, 0x09b59, 0x03a59, 0x05a20, 0x03b6c, 0x11941, 0x0d844, 0x05b0c,
+    0x06d04, 0x0680b, 0x20d0a, 0x0a90e, 0x2603e, 0x2603f, 0x26042, 0x26043, 0x22d30, 0x2c13a, 0x2c134, 0x2c13b, 0x02968, 0x0a16b, 0x0a16a, 0x0a16c,
+    0x06c0a, 0x1ac0e, 0x26d0e, 0x26513, 0x2c042, 0x2c043, 0x26046, 0x26047, 0x20142, 0x1a146, 0x20143, 0x1a147, 0x0a072, 0x0a073, 0x06173, 0x0a074,
+    0x26d07, 0x26511, 0x20d0c, 0x20512, 0x2604a, 0x2604b, 0x0a04c, 0x0a04d, 0x2ed32, 0x2013c, 0x20135, 0x2013d, 0x0a16e, 0x0a170, 0x0a16f, 0x0a171,
+    0x26d0c, 0x26512, 0x2650f, 0x26514, 0x1a04c, 0x1a04d, 0x0604e, 0x0604f, 0x20144, 0x1a148, 0x20145, 0x1a149, 0x06175, 0x06177, 0x06176, 0x1ba45,
+    0x02d30, 0x2643a, 0x0a442, 0x0a446, 0x22c68, 0x2046b, 0x20072, 0x20073, 0x2a57b, 0x06585, 0x1a582, 0x1a587, 0x060aa, 0x060ab, 0x060ac, 0x060ad,
+    0x26434, 0x2643b, 0x0a443, 0x0a447, 0x2046a, 0x2046c, 0x1a473, 0x20074, 0x06582, 0x06587, 0x06584, 0x06589, 0x1a0ac, 0x1a0ad, 0x060ae, 0x11f6f,
+    0x08d32, 0x2643c, 0x0a444, 0x0a448, 0x1a46e, 0x1a470, 0x1a475, 0x1a477, 0x2a57c, 0x06586, 0x1a583, 0x1a588, 0x045ab, 0x060af, 0x185ad, 0x01e83,
+    0x26435, 0x2643d, 0x0a445, 0x0a449, 0x1a46f, 0x1a471, 0x1a476, 0x07a45, 0x06583, 0x06588, 0x27a71, 0x07a3d, 0x045ad, 0x0bb83, 0x27a6f, 0x05f35,
+    0x16d19, 0x26527, 0x2ed1f, 0x20529, 0x1a190, 0x1a194, 0x1a191, 0x1a195, 0x16d39, 0x20560, 0x2ed43, 0x20562, 0x1a1a4, 0x1a1a6, 0x1a1a5, 0x1a1a7,
+    0x24d1f, 0x26529, 0x26523, 0x2652b, 0x06491, 0x06495, 0x1a198, 0x1a199, 0x2e558, 0x1a564, 0x2055a, 0x1a566, 0x185a6, 0x1a1a9, 0x185a8, 0x01f93,
+    0x2ad1b, 0x26528, 0x2c520, 0x2052a, 0x1a192, 0x1a196, 0x1a193, 0x1a197, 0x2ad3b, 0x20561, 0x2ed45, 0x20563, 0x185a5, 0x1a1a8, 0x1fe74, 0x1fe59,
+    0x26520, 0x2652a, 0x26524, 0x2652c, 0x06493, 0x06497, 0x27a65, 0x07a2a, 0x2e559, 0x1a565, 0x2055b, 0x1ba24, 0x185a7, 0x0bb93, 0x23a59, 0x19e20,
+    0x28d39, 0x0a560, 0x24558, 0x0a564, 0x045a4, 0x064a6, 0x045a6, 0x045a9, 0x1657d, 0x065a0, 0x16584, 0x185a2, 0x045b0, 0x045b3, 0x185b2, 0x01c75,
+    0x24d43, 0x0a562, 0x2455a, 0x0a566, 0x064a5, 0x064a7, 0x045a8, 0x1df93, 0x28584, 0x065a2, 0x0659f, 0x065a3, 0x045b2, 0x1d975, 0x19c9c, 0x11d4c,
+    0x28d3b, 0x0a561, 0x24559, 0x0a565, 0x045a5, 0x064a8, 0x045a7, 0x21e93, 0x1657e, 0x065a1, 0x23a71, 0x23e5f, 0x045b1, 0x0589b, 0x1fa6c, 0x11c44,
+    0x24d45, 0x0a563, 0x2455b, 0x0ba24, 0x09a74, 0x03b59, 0x09a59, 0x07a20, 0x03a71, 0x03b5f, 0x03a55, 0x07a1d, 0x03a6c, 0x0d944, 0x11841, 0x05a0c,
+    0x06c05, 0x0680c, 0x0690c, 0x0a90f, 0x26040, 0x26041, 0x26044, 0x26045, 0x26140, 0x26144, 0x26141, 0x26145, 0x02969, 0x0886c, 0x0896c, 0x0a06d,
+    0x06c0c, 0x1ac0f, 0x06d12, 0x26814, 0x2c044, 0x2c045, 0x26048, 0x26049, 0x2614c, 0x2614e, 0x2614d, 0x2614f, 0x0a075, 0x0a076, 0x0a077, 0x27745,
+    0x06d0c, 0x06c12, 0x1ad0f, 0x26914, 0x2604c, 0x2604d, 0x2604e, 0x2604f, 0x2c144, 0x26148, 0x2c145, 0x26149, 0x0a175, 0x0a177, 0x0a176, 0x27645,
+    0x0ac0f, 0x26c14, 0x26d14, 0x26015, 0x2004e, 0x2004f, 0x26050, 0x27f14, 0x2014e, 0x26150, 0x2014f, 0x27e14, 0x0a078, 0x2134e, 0x2124e, 0x0bf0f,
+    0x26440, 0x2c444, 0x2644c, 0x2044e, 0x22c69, 0x2286c, 0x20075, 0x20076, 0x0609a, 0x0609b, 0x0609c, 0x0b677, 0x060b0, 0x060b1, 0x060b2, 0x09f6c,
+    0x26441, 0x2c445, 0x2644d, 0x2174f, 0x22c6c, 0x2006d, 0x20077, 0x2d745, 0x1a09c, 0x21377, 0x0609d, 0x2774d, 0x1a0b2, 0x23f6c, 0x1b39c, 0x27741,
+    0x26444, 0x26448, 0x2644e, 0x27650, 0x20475, 0x20477, 0x1a078, 0x2764e, 0x0659b, 0x0609e, 0x21677, 0x27648, 0x060b3, 0x0779b, 0x21675, 0x27644,
+    0x26445, 0x27349, 0x2724f, 0x27b14, 0x0b376, 0x2d345, 0x2724e, 0x1bf0f, 0x0b377, 0x27348, 0x2724d, 0x07e12, 0x0b375, 0x2d344, 0x2724c, 0x07f0c,
+    0x26540, 0x2654c, 0x2c544, 0x2054e, 0x0619a, 0x0619c, 0x0619b, 0x0b777, 0x22d69, 0x20175, 0x2296c, 0x20176, 0x061b0, 0x061b2, 0x061b1, 0x09e6c,
+    0x26544, 0x2654e, 0x26548, 0x27750, 0x0649b, 0x21777, 0x0619e, 0x27748, 0x20575, 0x1a178, 0x20577, 0x2774e, 0x061b3, 0x21775, 0x0769b, 0x27744,
+    0x26541, 0x2654d, 0x2c545, 0x2164f, 0x1a19c, 0x0619d, 0x21277, 0x2764d, 0x22d6c, 0x20177, 0x2016d, 0x2d645, 0x1a1b2, 0x1b29c, 0x23e6c, 0x27641,
+    0x26545, 0x2734f, 0x27249, 0x27a14, 0x0b277, 0x2734d, 0x27248, 0x07f12, 0x0b276, 0x2734e, 0x2d245, 0x1be0f, 0x0b275, 0x2734c, 0x2d244, 0x07e0c,
+    0x02c69, 0x0a475, 0x0a575, 0x0b678, 0x064b0, 0x1b7b2, 0x076b3, 0x0b775, 0x065b0, 0x077b3, 0x1b6b2, 0x0b675, 0x060b4, 0x077b0, 0x076b0, 0x03f69,
+    0x08c6c, 0x21376, 0x0a577, 0x2174e, 0x073b1, 0x23b6c, 0x0739b, 0x2d744, 0x073b2, 0x21375, 0x0739c, 0x2774c, 0x073b0, 0x23f69, 0x0739a, 0x27740,
+    0x08d6c, 0x0a477, 0x21276, 0x2164e, 0x072b2, 0x0729c, 0x21275, 0x2764c, 0x072b1, 0x0729b, 0x23a6c, 0x2d644, 0x072b0, 0x0729a, 0x23e69, 0x27640,
+    0x0b36d, 0x27345, 0x27245, 0x0ba0f, 0x09b6c, 0x27341, 0x27244, 0x07b0c, 0x09a6c, 0x27344, 0x27241, 0x07a0c, 0x03a69, 0x27340, 0x27240, 0x07f05,
+    0x1cc09, 0x1881a, 0x0491e, 0x0a821, 0x1ec33, 0x22c3f, 0x08856, 0x26858, 0x1cb38, 0x0295c, 0x02956, 0x08960, 0x00a68, 0x0286e, 0x02972, 0x08875,
+    0x1ec19, 0x22c1f, 0x1a827, 0x20829, 0x1ec39, 0x22c43, 0x2c860, 0x2c862, 0x26090, 0x26091, 0x26094, 0x26095, 0x260a4, 0x260a5, 0x260a6, 0x260a7,
+    0x00d30, 0x1a83a, 0x06842, 0x0a846, 0x2ec68, 0x2e46b, 0x2c072, 0x2c073, 0x10f7b, 0x26985, 0x26982, 0x26987, 0x260aa, 0x260ab, 0x0a0ac, 0x0a0ad,
+    0x14e40, 0x20844, 0x1a84c, 0x2084e, 0x2e469, 0x2e46c, 0x2c075, 0x2c076, 0x2609a, 0x2609b, 0x0a09c, 0x07a77, 0x260b0, 0x260b1, 0x0a0b2, 0x05f6c,
+    0x0ee1a, 0x2ec26, 0x20c8b, 0x2e48d, 0x12c3f, 0x2ec4b, 0x22494, 0x22496, 0x0af5c, 0x200bf, 0x200c4, 0x200c5, 0x0ae6e, 0x2fdba, 0x200d1, 0x0fda2,
+    0x16c1f, 0x2ec28, 0x2e48c, 0x2e48e, 0x16c43, 0x2ec4d, 0x22495, 0x22497, 0x24691, 0x200c0, 0x200c6, 0x200c7, 0x246a5, 0x1fd89, 0x200d2, 0x11d62,
+    0x0ee3a, 0x2ec5d, 0x2cc91, 0x20098, 0x2a46b, 0x2e470, 0x224a6, 0x224a8, 0x08f85, 0x1a0c9, 0x1a0ca, 0x1a0cb, 0x086ab, 0x1fdb9, 0x1a0d3, 0x0dd87,
+    0x14e44, 0x2ec5f, 0x2cc93, 0x0bb65, 0x2a46c, 0x2e471, 0x224a7, 0x19b59, 0x0869b, 0x09ba1, 0x0baa8, 0x07b61, 0x086b1, 0x1fb7e, 0x09ba5, 0x1df3b,
+    0x00f1e, 0x28c8b, 0x1cd8b, 0x2e4bd, 0x24e56, 0x16494, 0x1e4c4, 0x1e4c6, 0x06f56, 0x286c4, 0x1ef94, 0x2a9c6, 0x06f72, 0x286d1, 0x1cbd1, 0x01ca9,
+    0x14e27, 0x2a48c, 0x2e4bc, 0x2e4be, 0x28e60, 0x16495, 0x1e4c5, 0x1e4c7, 0x24694, 0x146c6, 0x261d6, 0x0a1d7, 0x246a6, 0x146d2, 0x01ccc, 0x0df95,
+    0x02e42, 0x28c91, 0x12f92, 0x2e9c1, 0x28672, 0x164a6, 0x1e4d1, 0x1e4d2, 0x24f82, 0x0e6ca, 0x12f9c, 0x1faa8, 0x086ac, 0x0e6d3, 0x1dcae, 0x11e73,
+    0x14e4c, 0x28c93, 0x09aa3, 0x0ba66, 0x28675, 0x164a7, 0x09aa2, 0x07a62, 0x0869c, 0x09aa8, 0x09a9f, 0x07a5a, 0x086b2, 0x0bba5, 0x1da84, 0x19e43,
+    0x02e21, 0x1648d, 0x164bd, 0x2e4c2, 0x24e58, 0x16496, 0x124c6, 0x1e4c8, 0x0af60, 0x286c5, 0x2efc6, 0x1c4d8, 0x0ae75, 0x19da2, 0x05ca9, 0x01d64,
+    0x28e29, 0x1648e, 0x164be, 0x2e4c3, 0x28e62, 0x16497, 0x124c7, 0x1fb8e, 0x24695, 0x146c7, 0x087d7, 0x1fbbe, 0x246a7, 0x1dd62, 0x19995, 0x1dd29,
+    0x02e46, 0x14698, 0x16fc1, 0x2e4d0, 0x28673, 0x164a8, 0x124d2, 0x1fdc1, 0x24f87, 0x0e6cb, 0x13aa8, 0x1de98, 0x086ad, 0x19d87, 0x1d873, 0x01c46,
+    0x28e4e, 0x03b65, 0x03a66, 0x01b52, 0x28676, 0x0db59, 0x03a62, 0x01b22, 0x03a77, 0x03b61, 0x03a5a, 0x01a23, 0x0196c, 0x1193b, 0x0d843, 0x01b0e,
+    0x1cc0a, 0x1881b, 0x0681f, 0x0a822, 0x1ec34, 0x22c41, 0x08857, 0x26859, 0x0cb42, 0x0295e, 0x02958, 0x08962, 0x00a6a, 0x0286f, 0x08873, 0x15f76,
+    0x1ec1b, 0x22c20, 0x1a828, 0x2082a, 0x1ec3b, 0x22c45, 0x2c861, 0x2ff63, 0x26092, 0x26093, 0x26096, 0x26097, 0x248a5, 0x2f774, 0x260a8, 0x2bf59,
+    0x04d34, 0x1a83b, 0x06843, 0x0a847, 0x2ec6a, 0x2c86c, 0x26873, 0x2c074, 0x0a982, 0x0a987, 0x26984, 0x26989, 0x260ac, 0x260ad, 0x260ae, 0x15f6f,
+    0x1a841, 0x20845, 0x1a84d, 0x21b4f, 0x2ec6c, 0x2c06d, 0x2c077, 0x21b45, 0x2609c, 0x2d377, 0x2609d, 0x1bb4d, 0x260b2, 0x2ff6c, 0x2739c, 0x1bb41,
+    0x12c1f, 0x22c28, 0x20c8c, 0x2e88e, 0x12c43, 0x22c4d, 0x2e895, 0x2b797, 0x18a91, 0x2c0c0, 0x2c0c6, 0x2c0c7, 0x18aa5, 0x17d89, 0x2c0d2, 0x15d62,
+    0x12c22, 0x2ec2a, 0x20c8e, 0x2008f, 0x12c47, 0x2ec4f, 0x22499, 0x2ff2a, 0x200c1, 0x23799, 0x200c8, 0x21f8e, 0x200cf, 0x13f47, 0x213c1, 0x13f22,
+    0x2ac57, 0x2ec61, 0x2cc95, 0x20099, 0x2ac73, 0x2e477, 0x200a9, 0x2b793, 0x200ca, 0x200cb, 0x1a0cc, 0x2f7c0, 0x200d3, 0x17d87, 0x27dd1, 0x15d5e,
+    0x2ac59, 0x2ec63, 0x27397, 0x21b2a, 0x2e474, 0x23f45, 0x27393, 0x23f20, 0x273a8, 0x2db61, 0x27396, 0x1bb28, 0x25ba5, 0x1ff3b, 0x27392, 0x1ff1b,
+    0x00f42, 0x2a492, 0x1cd91, 0x2e4c1, 0x18e82, 0x2a49c, 0x224ca, 0x2b7a8, 0x18f72, 0x169d1, 0x129a6, 0x2f7d2, 0x1aeac, 0x177ae, 0x01cd3, 0x15f73,
+    0x14e5e, 0x2a493, 0x2e4c0, 0x21399, 0x16e87, 0x2f777, 0x213cb, 0x2ff61, 0x26ed1, 0x213a9, 0x1b3cc, 0x2df95, 0x213d3, 0x2bf73, 0x213ca, 0x2bf57,
+    0x0ec6a, 0x28ca5, 0x1cda5, 0x2f7cf, 0x2a4ac, 0x2b7b2, 0x224d3, 0x29fa5, 0x10fac, 0x237d3, 0x1fab2, 0x1dea5, 0x060d9, 0x2b7ac, 0x11cac, 0x0ff6a,
+    0x14c6f, 0x2d374, 0x27a89, 0x0bb47, 0x273ad, 0x2db6c, 0x0ba87, 0x1bb3b, 0x273ae, 0x27b73, 0x27a84, 0x07b43, 0x273ac, 0x2ff6a, 0x0ba82, 0x05e34,
+    0x0ee58, 0x2a496, 0x2e4c6, 0x2f7c8, 0x16e84, 0x1779d, 0x224cc, 0x2b796, 0x06ea6, 0x237cc, 0x180da, 0x2f7c6, 0x1bdb2, 0x17d84, 0x07da6, 0x0fd58,
+    0x14e62, 0x2a497, 0x2d3c7, 0x2fb8e, 0x16e89, 0x23f4d, 0x2d3c0, 0x23f28, 0x2d3d2, 0x2fb95, 0x2d3c6, 0x21f8c, 0x199a5, 0x13f43, 0x19991, 0x13f1f,
+    0x14c73, 0x2a4a8, 0x2e4d2, 0x2f7c1, 0x164ae, 0x2b79c, 0x17ad1, 0x2b792, 0x00fd3, 0x237ca, 0x13aa6, 0x1de91, 0x1bdac, 0x19d82, 0x19c72, 0x01c42,
+    0x14c76, 0x27b59, 0x09a62, 0x0bb22, 0x03b6f, 0x23f41, 0x03a5e, 0x19b1b, 0x09b73, 0x09b57, 0x03a58, 0x07b1f, 0x03b6a, 0x1ff34, 0x0d842, 0x1df0a,
+    0x0480b, 0x0681c, 0x0491f, 0x0a823, 0x10a3f, 0x02854, 0x08858, 0x0885a, 0x10b3a, 0x0295d, 0x02957, 0x08961, 0x00b6b, 0x02870, 0x02973, 0x08877,
+    0x18c1f, 0x1a823, 0x06829, 0x2682b, 0x22858, 0x2c85a, 0x26864, 0x26866, 0x0a991, 0x26098, 0x0a995, 0x26099, 0x248a6, 0x248a8, 0x260a9, 0x03e93,
+    0x04d32, 0x0683c, 0x06844, 0x0a848, 0x2686e, 0x26870, 0x26875, 0x26877, 0x1e97c, 0x26986, 0x26983, 0x2de88, 0x089ab, 0x260af, 0x2fead, 0x03e83,
+    0x1a844, 0x1a848, 0x0684e, 0x27a50, 0x2c875, 0x2c877, 0x26078, 0x07a4e, 0x2699b, 0x2609e, 0x2da77, 0x1ba48, 0x260b3, 0x27b9b, 0x2da75, 0x1ba44,
+    0x0ce3a, 0x22c5d, 0x20c91, 0x2c098, 0x1ce6b, 0x22870, 0x2e8a6, 0x2e8a8, 0x04f85, 0x260c9, 0x260ca, 0x260cb, 0x04aab, 0x17db9, 0x260d3, 0x0fd87,
+    0x1ec57, 0x22c61, 0x20c95, 0x2c099, 0x1ec73, 0x22877, 0x2c0a9, 0x1fb93, 0x2c0ca, 0x2c0cb, 0x260cc, 0x09ec0, 0x2c0d3, 0x13d87, 0x07dd1, 0x11d5e,
+    0x00c7c, 0x20c86, 0x20c9b, 0x2009e, 0x2ecab, 0x200af, 0x200b3, 0x21e9b, 0x10fb7, 0x260cd, 0x212af, 0x21e86, 0x260d4, 0x11db7, 0x2feab, 0x01e7c,
+    0x02c83, 0x2cc88, 0x27a77, 0x0ba48, 0x2ecad, 0x27b83, 0x27a75, 0x07a44, 0x272af, 0x27b86, 0x27a70, 0x07a3c, 0x09bab, 0x1fb7c, 0x27a6e, 0x05f32,
+    0x10f27, 0x02cbc, 0x1cd8c, 0x2e9be, 0x04e94, 0x060d6, 0x10bc6, 0x060d7, 0x1cf60, 0x169c5, 0x12995, 0x29ec7, 0x18ba6, 0x03dcc, 0x0dcd2, 0x0fe95,
+    0x02c8c, 0x08cbe, 0x04dbe, 0x060d5, 0x0cec6, 0x1a0d7, 0x060d8, 0x05fbe, 0x0efc6, 0x261d8, 0x261d7, 0x09ebe, 0x060da, 0x0fdc6, 0x0dcc6, 0x01f8c,
+    0x10f5e, 0x08cc0, 0x1e993, 0x2d299, 0x06fd1, 0x272cc, 0x2d2a9, 0x21e95, 0x12f87, 0x2d2cb, 0x23a77, 0x23e61, 0x2d2d3, 0x2d2ca, 0x1fe73, 0x1fe57,
+    0x02c93, 0x27299, 0x27a66, 0x27a2b, 0x272a9, 0x0bb95, 0x27a64, 0x07a29, 0x25aa8, 0x27298, 0x2da5a, 0x1ba23, 0x25aa6, 0x0bb91, 0x23a58, 0x19e1f,
+    0x00f60, 0x28cc5, 0x12fc6, 0x216d8, 0x04ea6, 0x23dcc, 0x1a0da, 0x13dc6, 0x06fa0, 0x060db, 0x22fcc, 0x29ec5, 0x07db3, 0x07da0, 0x05ca6, 0x01d60,
+    0x0ec95, 0x28cc7, 0x072d7, 0x2fbbe, 0x0ced2, 0x13b95, 0x119c6, 0x1df8c, 0x02fcc, 0x17bc5, 0x072d6, 0x03ebc, 0x199a6, 0x1dd60, 0x05c94, 0x11d27,
+    0x0ef87, 0x272cb, 0x2faa8, 0x2d298, 0x272d3, 0x272ca, 0x2faa6, 0x21e91, 0x16fb9, 0x272c9, 0x23a70, 0x23e5d, 0x058ab, 0x05d85, 0x1dc6b, 0x0dc3a,
+    0x09a77, 0x09b61, 0x09a5a, 0x0ba23, 0x03b73, 0x03b57, 0x09a58, 0x05b1f, 0x03a70, 0x03b5d, 0x03a54, 0x07a1c, 0x03a6b, 0x1193a, 0x1183f, 0x05a0b,
+    0x0480c, 0x0681d, 0x04920, 0x0a824, 0x10a41, 0x02855, 0x08859, 0x2575b, 0x0cb44, 0x0295f, 0x02959, 0x0b763, 0x0286c, 0x02871, 0x02974, 0x25f45,
+    0x18c20, 0x1a824, 0x0682a, 0x2772c, 0x22859, 0x2175b, 0x26865, 0x27724, 0x0a993, 0x1b765, 0x07697, 0x2772a, 0x197a7, 0x2f759, 0x07693, 0x27720,
+    0x04d35, 0x0683d, 0x06845, 0x0b649, 0x2686f, 0x26871, 0x1b676, 0x0b645, 0x0a983, 0x07788, 0x1b671, 0x2763d, 0x057ad, 0x07783, 0x1b66f, 0x27635,
+    0x1a845, 0x1b349, 0x0724f, 0x27714, 0x07376, 0x21345, 0x0724e, 0x2770f, 0x07377, 0x1b348, 0x1b24d, 0x27712, 0x07375, 0x21344, 0x1b24c, 0x27f0c,
+    0x10e44, 0x22c5f, 0x20c93, 0x0b765, 0x1e86c, 0x22871, 0x057a7, 0x25759, 0x04a9b, 0x077a1, 0x076a8, 0x0b761, 0x057b1, 0x1777e, 0x057a5, 0x29f3b,
+    0x1ec59, 0x21763, 0x1b397, 0x2172a, 0x1ec74, 0x2ff45, 0x1b393, 0x2d720, 0x1b3a8, 0x21761, 0x1b396, 0x27728, 0x197a5, 0x2bf3b, 0x1b392, 0x2bf1b,
+    0x00c83, 0x1b788, 0x1b677, 0x0b648, 0x197ad, 0x1b783, 0x1b675, 0x0b644, 0x072af, 0x07786, 0x1b670, 0x2763c, 0x057ab, 0x2b77c, 0x1b66e, 0x09f32,
+    0x0b371, 0x2133d, 0x0b24d, 0x21712, 0x0b36f, 0x21335, 0x0b24c, 0x21f0c, 0x0b370, 0x2133c, 0x2724b, 0x27711, 0x0b36e, 0x2ff32, 0x2724a, 0x27f07,
+    0x10f4c, 0x077a3, 0x1cd93, 0x0b766, 0x18e9c, 0x0779f, 0x057a8, 0x2575a, 0x1cb75, 0x077a2, 0x076a7, 0x0b762, 0x057b2, 0x29784, 0x076a5, 0x25f43,
+    0x00d93, 0x1b766, 0x1b399, 0x2772b, 0x197a8, 0x2175a, 0x1b398, 0x27723, 0x1b3a9, 0x1b764, 0x07695, 0x27729, 0x197a6, 0x2f758, 0x07691, 0x25f1f,
+    0x10d6f, 0x07789, 0x21274, 0x0b647, 0x072ae, 0x07784, 0x1b673, 0x0b643, 0x1b2ad, 0x07787, 0x2166c, 0x2763b, 0x1b2ac, 0x07782, 0x2166a, 0x27634,
+    0x07374, 0x1b347, 0x27247, 0x27713, 0x07373, 0x21343, 0x27246, 0x27f0e, 0x0b273, 0x1b346, 0x2d243, 0x1be0e, 0x07372, 0x21342, 0x2d242, 0x0bf0a,
+    0x00e75, 0x197a2, 0x076a9, 0x0b764, 0x197b2, 0x17784, 0x057a6, 0x25758, 0x057b3, 0x077a0, 0x076a6, 0x0b760, 0x057b0, 0x1777d, 0x076a4, 0x29f39,
+    0x1b3a7, 0x21762, 0x1b395, 0x21729, 0x1b3a5, 0x2ff43, 0x1b391, 0x2ff1f, 0x1b3a6, 0x21760, 0x1b394, 0x27727, 0x1b3a4, 0x17f39, 0x1b390, 0x17f19,
+    0x072ad, 0x1b787, 0x21273, 0x0b646, 0x072ac, 0x1b782, 0x21272, 0x0b642, 0x072ab, 0x07785, 0x2166b, 0x2763a, 0x072aa, 0x2b77b, 0x23e68, 0x03f30,
+    0x0b36c, 0x2d33b, 0x27243, 0x0bb0e, 0x0b36a, 0x2d334, 0x27242, 0x21f0a, 0x0b36b, 0x2d33a, 0x2723f, 0x07a0b, 0x03b68, 0x23f30, 0x2723e, 0x07f04,
+    0x1cd09, 0x0691e, 0x1891a, 0x0a921, 0x1ca38, 0x02856, 0x0285c, 0x08860, 0x1ed33, 0x08956, 0x22d3f, 0x26958, 0x00b68, 0x08972, 0x0296e, 0x08975,
+    0x00c30, 0x06942, 0x1a93a, 0x0a946, 0x10e7b, 0x26882, 0x26885, 0x26887, 0x2ed68, 0x2c172, 0x2e56b, 0x2c173, 0x261aa, 0x0a1ac, 0x261ab, 0x0a1ad,
+    0x1ed19, 0x1a927, 0x22d1f, 0x20929, 0x26190, 0x26194, 0x26191, 0x26195, 0x1ed39, 0x2c960, 0x22d43, 0x2c962, 0x261a4, 0x261a6, 0x261a5, 0x261a7,
+    0x14f40, 0x1a94c, 0x20944, 0x2094e, 0x2619a, 0x0a19c, 0x2619b, 0x07b77, 0x2e569, 0x2c175, 0x2e56c, 0x2c176, 0x261b0, 0x0a1b2, 0x261b1, 0x05e6c,
+    0x02f1e, 0x1cc8b, 0x28d8b, 0x2e5bd, 0x06e56, 0x1ee94, 0x287c4, 0x2a8c6, 0x24f56, 0x1e5c4, 0x16594, 0x1e5c6, 0x0af72, 0x1cad1, 0x287d1, 0x03ca9,
+    0x02f42, 0x12e92, 0x28d91, 0x2e8c1, 0x24e82, 0x12e9c, 0x0e7ca, 0x1fba8, 0x28772, 0x1e5d1, 0x165a6, 0x1e5d2, 0x087ac, 0x1ddae, 0x0e7d3, 0x11f73,
+    0x14f27, 0x2e5bc, 0x2a58c, 0x2e5be, 0x24794, 0x260d6, 0x147c6, 0x0a0d7, 0x28f60, 0x1e5c5, 0x16595, 0x1e5c7, 0x247a6, 0x01dcc, 0x147d2, 0x0de95,
+    0x14f4c, 0x09ba3, 0x28d93, 0x0bb66, 0x0879c, 0x09b9f, 0x09ba8, 0x07b5a, 0x28775, 0x09ba2, 0x165a7, 0x07b62, 0x087b2, 0x1db84, 0x0baa5, 0x19f43,
+    0x0ef1a, 0x20d8b, 0x2ed26, 0x2e58d, 0x0ae5c, 0x201c4, 0x201bf, 0x201c5, 0x12d3f, 0x22594, 0x2ed4b, 0x22596, 0x0af6e, 0x201d1, 0x2fcba, 0x0fca2,
+    0x0ef3a, 0x2cd91, 0x2ed5d, 0x20198, 0x08e85, 0x1a1ca, 0x1a1c9, 0x1a1cb, 0x2a56b, 0x225a6, 0x2e570, 0x225a8, 0x087ab, 0x1a1d3, 0x1fcb9, 0x0dc87,
+    0x16d1f, 0x2e58c, 0x2ed28, 0x2e58e, 0x24791, 0x201c6, 0x201c0, 0x201c7, 0x16d43, 0x22595, 0x2ed4d, 0x22597, 0x247a5, 0x201d2, 0x1fc89, 0x11c62,
+    0x14f44, 0x2cd93, 0x2ed5f, 0x0ba65, 0x0879b, 0x0bba8, 0x09aa1, 0x07a61, 0x2a56c, 0x225a7, 0x2e571, 0x19a59, 0x087b1, 0x09aa5, 0x1fa7e, 0x1de3b,
+    0x02f21, 0x165bd, 0x1658d, 0x2e5c2, 0x0ae60, 0x2eec6, 0x287c5, 0x1c5d8, 0x24f58, 0x125c6, 0x16596, 0x1e5c8, 0x0af75, 0x07ca9, 0x19ca2, 0x01c64,
+    0x02f46, 0x16ec1, 0x14798, 0x2e5d0, 0x24e87, 0x13ba8, 0x0e7cb, 0x1df98, 0x28773, 0x125d2, 0x165a8, 0x1fcc1, 0x087ad, 0x1d973, 0x19c87, 0x01d46,
+    0x28f29, 0x165be, 0x1658e, 0x2e5c3, 0x24795, 0x086d7, 0x147c7, 0x1fabe, 0x28f62, 0x125c7, 0x16597, 0x1fa8e, 0x247a7, 0x19895, 0x1dc62, 0x1dc29,
+    0x28f4e, 0x03b66, 0x03a65, 0x01a52, 0x03b77, 0x03b5a, 0x03a61, 0x01b23, 0x28776, 0x03b62, 0x0da59, 0x01a22, 0x0186c, 0x0d943, 0x1183b, 0x01a0e,
+    0x0490b, 0x0481f, 0x0691c, 0x0a923, 0x10a3a, 0x02857, 0x0285d, 0x08861, 0x10b3f, 0x08958, 0x02954, 0x0895a, 0x00a6b, 0x02873, 0x02970, 0x08977,
+    0x04c32, 0x06944, 0x0693c, 0x0a948, 0x1e87c, 0x26883, 0x26886, 0x2df88, 0x2696e, 0x26975, 0x26970, 0x26977, 0x088ab, 0x2ffad, 0x261af, 0x03f83,
+    0x18d1f, 0x06929, 0x1a923, 0x2692b, 0x0a891, 0x0a895, 0x26198, 0x26199, 0x22958, 0x26964, 0x2c95a, 0x26966, 0x249a6, 0x261a9, 0x249a8, 0x03f93,
+    0x1a944, 0x0694e, 0x1a948, 0x27b50, 0x2689b, 0x2db77, 0x2619e, 0x1bb48, 0x2c975, 0x26178, 0x2c977, 0x07b4e, 0x261b3, 0x2db75, 0x27a9b, 0x1bb44,
+    0x10e27, 0x1cc8c, 0x02dbc, 0x2e8be, 0x1ce60, 0x12895, 0x168c5, 0x29fc7, 0x04f94, 0x10ac6, 0x061d6, 0x061d7, 0x18aa6, 0x0ddd2, 0x03ccc, 0x0ff95,
+    0x10e5e, 0x1e893, 0x08dc0, 0x2d399, 0x12e87, 0x23b77, 0x2d3cb, 0x23f61, 0x06ed1, 0x2d3a9, 0x273cc, 0x21f95, 0x2d3d3, 0x1ff73, 0x2d3ca, 0x1ff57,
+    0x00c8c, 0x04cbe, 0x08dbe, 0x260d5, 0x0eec6, 0x260d7, 0x260d8, 0x09fbe, 0x0cfc6, 0x061d8, 0x1a1d7, 0x05ebe, 0x0a0da, 0x0ddc6, 0x0fcc6, 0x03f8c,
+    0x02d93, 0x27b66, 0x27399, 0x27b2b, 0x25ba8, 0x2db5a, 0x27398, 0x1bb23, 0x273a9, 0x27b64, 0x0ba95, 0x07b29, 0x25ba6, 0x23b58, 0x0ba91, 0x19f1f,
+    0x0cf3a, 0x20d91, 0x22d5d, 0x2c198, 0x04e85, 0x261ca, 0x261c9, 0x261cb, 0x1cf6b, 0x2e9a6, 0x22970, 0x2e9a8, 0x04bab, 0x261d3, 0x17cb9, 0x0fc87,
+    0x00d7c, 0x20d9b, 0x20d86, 0x2019e, 0x10eb7, 0x213af, 0x261cd, 0x21f86, 0x2edab, 0x201b3, 0x201af, 0x21f9b, 0x261d4, 0x2ffab, 0x11cb7, 0x01f7c,
+    0x1ed57, 0x20d95, 0x22d61, 0x2c199, 0x2c1ca, 0x261cc, 0x2c1cb, 0x09fc0, 0x1ed73, 0x2c1a9, 0x22977, 0x1fa93, 0x2c1d3, 0x07cd1, 0x13c87, 0x11c5e,
+    0x02d83, 0x27b77, 0x2cd88, 0x0bb48, 0x273af, 0x27b70, 0x27a86, 0x07b3c, 0x2edad, 0x27b75, 0x27a83, 0x07b44, 0x09aab, 0x27b6e, 0x1fa7c, 0x05e32,
+    0x00e60, 0x12ec6, 0x28dc5, 0x217d8, 0x06ea0, 0x22ecc, 0x061db, 0x29fc5, 0x04fa6, 0x1a1da, 0x23ccc, 0x13cc6, 0x07cb3, 0x05da6, 0x07ca0, 0x01c60,
+    0x0ee87, 0x2fba8, 0x273cb, 0x2d398, 0x16eb9, 0x23b70, 0x273c9, 0x23f5d, 0x273d3, 0x2fba6, 0x273ca, 0x21f91, 0x059ab, 0x1dd6b, 0x05c85, 0x0dd3a,
+    0x0ed95, 0x073d7, 0x28dc7, 0x2fabe, 0x02ecc, 0x073d6, 0x17ac5, 0x03fbc, 0x0cfd2, 0x118c6, 0x13a95, 0x1de8c, 0x198a6, 0x05d94, 0x1dc60, 0x11c27,
+    0x09b77, 0x09b5a, 0x09a61, 0x0bb23, 0x03b70, 0x03b54, 0x03a5d, 0x07b1c, 0x03a73, 0x09b58, 0x03a57, 0x05a1f, 0x03b6b, 0x1193f, 0x1183a, 0x05b0b,
+    0x1cd0a, 0x0691f, 0x1891b, 0x0a922, 0x0ca42, 0x02858, 0x0285e, 0x08862, 0x1ed34, 0x08957, 0x22d41, 0x26959, 0x00b6a, 0x08973, 0x0296f, 0x15e76,
+    0x04c34, 0x06943, 0x1a93b, 0x0a947, 0x0a882, 0x26884, 0x0a887, 0x26889, 0x2ed6a, 0x26973, 0x2c96c, 0x2c174, 0x261ac, 0x261ae, 0x261ad, 0x15e6f,
+    0x1ed1b, 0x1a928, 0x22d20, 0x2092a, 0x26192, 0x26196, 0x26193, 0x26197, 0x1ed3b, 0x2c961, 0x22d45, 0x2fe63, 0x249a5, 0x261a8, 0x2f674, 0x2be59,
+    0x1a941, 0x1a94d, 0x20945, 0x21a4f, 0x2619c, 0x2619d, 0x2d277, 0x1ba4d, 0x2ed6c, 0x2c177, 0x2c16d, 0x21a45, 0x261b2, 0x2729c, 0x2fe6c, 0x1ba41,
+    0x00e42, 0x1cc91, 0x2a592, 0x2e5c1, 0x18e72, 0x128a6, 0x168d1, 0x2f6d2, 0x18f82, 0x225ca, 0x2a59c, 0x2b6a8, 0x1afac, 0x01dd3, 0x176ae, 0x15e73,
+    0x0cc6a, 0x1cca5, 0x28da5, 0x2f6cf, 0x10eac, 0x1fbb2, 0x236d3, 0x1dfa5, 0x2a5ac, 0x225d3, 0x2b6b2, 0x29ea5, 0x240d9, 0x11dac, 0x2b6ac, 0x0df6a,
+    0x14f5e, 0x2e5c0, 0x2a593, 0x21299, 0x26fd1, 0x1b2cc, 0x212a9, 0x2de95, 0x16f87, 0x212cb, 0x2f677, 0x2fe61, 0x212d3, 0x212ca, 0x2be73, 0x2be57,
+    0x14d6f, 0x27b89, 0x2d274, 0x0ba47, 0x272ae, 0x27b84, 0x27a73, 0x07a43, 0x272ad, 0x0bb87, 0x2da6c, 0x1ba3b, 0x272ac, 0x0bb82, 0x2fe6a, 0x05f34,
+    0x12d1f, 0x20d8c, 0x22d28, 0x2e98e, 0x18b91, 0x2c1c6, 0x2c1c0, 0x2c1c7, 0x12d43, 0x2e995, 0x22d4d, 0x2b697, 0x18ba5, 0x2c1d2, 0x17c89, 0x15c62,
+    0x2ad57, 0x2cd95, 0x2ed61, 0x20199, 0x201ca, 0x1a1cc, 0x201cb, 0x2f6c0, 0x2ad73, 0x201a9, 0x2e577, 0x2b693, 0x201d3, 0x27cd1, 0x17c87, 0x15c5e,
+    0x12d22, 0x20d8e, 0x2ed2a, 0x2018f, 0x201c1, 0x201c8, 0x23699, 0x21e8e, 0x12d47, 0x22599, 0x2ed4f, 0x2fe2a, 0x201cf, 0x212c1, 0x13e47, 0x13e22,
+    0x2ad59, 0x27297, 0x2ed63, 0x21a2a, 0x272a8, 0x27296, 0x2da61, 0x1ba28, 0x2e574, 0x27293, 0x23e45, 0x23e20, 0x25aa5, 0x27292, 0x1fe3b, 0x1fe1b,
+    0x0ef58, 0x2e5c6, 0x2a596, 0x2f6c8, 0x06fa6, 0x181da, 0x236cc, 0x2f6c6, 0x16f84, 0x225cc, 0x1769d, 0x2b696, 0x1bcb2, 0x07ca6, 0x17c84, 0x0fc58,
+    0x14d73, 0x2e5d2, 0x2a5a8, 0x2f6c1, 0x00ed3, 0x13ba6, 0x236ca, 0x1df91, 0x165ae, 0x17bd1, 0x2b69c, 0x2b692, 0x1bcac, 0x19d72, 0x19c82, 0x01d42,
+    0x14f62, 0x2d2c7, 0x2a597, 0x2fa8e, 0x2d2d2, 0x2d2c6, 0x2fa95, 0x21e8c, 0x16f89, 0x2d2c0, 0x23e4d, 0x23e28, 0x198a5, 0x19891, 0x13e43, 0x13e1f,
+    0x14d76, 0x09b62, 0x27a59, 0x0ba22, 0x09a73, 0x03b58, 0x09a57, 0x07a1f, 0x03a6f, 0x03b5e, 0x23e41, 0x19a1b, 0x03a6a, 0x0d942, 0x1fe34, 0x1de0a,
+    0x0490c, 0x06920, 0x0691d, 0x0a924, 0x0ca44, 0x02859, 0x0285f, 0x0b663, 0x10b41, 0x08959, 0x02955, 0x2565b, 0x0296c, 0x08974, 0x02971, 0x25e45,
+    0x04c35, 0x06945, 0x0693d, 0x0b749, 0x0a883, 0x1b771, 0x07688, 0x2773d, 0x2696f, 0x1b776, 0x26971, 0x0b745, 0x056ad, 0x1b76f, 0x07683, 0x27735,
+    0x18d20, 0x0692a, 0x1a924, 0x2762c, 0x0a893, 0x07797, 0x1b665, 0x2762a, 0x22959, 0x26965, 0x2165b, 0x27624, 0x196a7, 0x07793, 0x2f659, 0x27620,
+    0x1a945, 0x0734f, 0x1b249, 0x27614, 0x07277, 0x1b34d, 0x1b248, 0x27612, 0x07276, 0x0734e, 0x21245, 0x2760f, 0x07275, 0x1b34c, 0x21244, 0x27e0c,
+    0x10e4c, 0x1cc93, 0x076a3, 0x0b666, 0x1ca75, 0x077a7, 0x076a2, 0x0b662, 0x18f9c, 0x056a8, 0x0769f, 0x2565a, 0x056b2, 0x077a5, 0x29684, 0x25e43,
+    0x10c6f, 0x21374, 0x07689, 0x0b747, 0x1b3ad, 0x2176c, 0x07687, 0x2773b, 0x073ae, 0x1b773, 0x07684, 0x0b743, 0x1b3ac, 0x2176a, 0x07682, 0x27734,
+    0x00c93, 0x1b299, 0x1b666, 0x2762b, 0x1b2a9, 0x07795, 0x1b664, 0x27629, 0x196a8, 0x1b298, 0x2165a, 0x27623, 0x196a6, 0x07791, 0x2f658, 0x25e1f,
+    0x0b374, 0x27347, 0x1b247, 0x27613, 0x0b373, 0x2d343, 0x1b246, 0x1bf0e, 0x07273, 0x27346, 0x21243, 0x27e0e, 0x0b372, 0x2d342, 0x21242, 0x07f0a,
+    0x10f44, 0x20d93, 0x22d5f, 0x0b665, 0x04b9b, 0x077a8, 0x076a1, 0x0b661, 0x1e96c, 0x056a7, 0x22971, 0x25659, 0x056b1, 0x056a5, 0x1767e, 0x29e3b,
+    0x00d83, 0x1b777, 0x1b688, 0x0b748, 0x073af, 0x1b770, 0x07686, 0x2773c, 0x196ad, 0x1b775, 0x1b683, 0x0b744, 0x056ab, 0x1b76e, 0x2b67c, 0x09e32,
+    0x1ed59, 0x1b297, 0x21663, 0x2162a, 0x1b2a8, 0x1b296, 0x21661, 0x27628, 0x1ed74, 0x1b293, 0x2fe45, 0x2d620, 0x196a5, 0x1b292, 0x2be3b, 0x2be1b,
+    0x0b271, 0x0b34d, 0x2123d, 0x21612, 0x0b270, 0x2734b, 0x2123c, 0x27611, 0x0b26f, 0x0b34c, 0x21235, 0x21e0c, 0x0b26e, 0x2734a, 0x2fe32, 0x27e07,
+    0x00f75, 0x056a9, 0x196a2, 0x0b664, 0x056b3, 0x077a6, 0x076a0, 0x0b660, 0x196b2, 0x056a6, 0x17684, 0x25658, 0x056b0, 0x056a4, 0x1767d, 0x29e39,
+    0x073ad, 0x21373, 0x1b687, 0x0b746, 0x073ab, 0x2176b, 0x07685, 0x2773a, 0x073ac, 0x21372, 0x1b682, 0x0b742, 0x073aa, 0x23f68, 0x2b67b, 0x03e30,
+    0x1b2a7, 0x1b295, 0x21662, 0x21629, 0x1b2a6, 0x1b294, 0x21660, 0x27627, 0x1b2a5, 0x1b291, 0x2fe43, 0x2fe1f, 0x1b2a4, 0x1b290, 0x17e39, 0x17e19,
+    0x0b26c, 0x27343, 0x2d23b, 0x0ba0e, 0x0b26b, 0x2733f, 0x2d23a, 0x07b0b, 0x0b26a, 0x27342, 0x2d234, 0x21e0a, 0x03a68, 0x2733e, 0x23e30, 0x07e04,
+    0x00f0d, 0x00821, 0x00921, 0x00951, 0x1ca39, 0x0c858, 0x02860, 0x02864, 0x1cb39, 0x02960, 0x0c958, 0x02964, 0x00a69, 0x02875, 0x02975, 0x03c78,
+    0x1cc39, 0x18858, 0x06860, 0x0a864, 0x1ee7d, 0x1e884, 0x088a0, 0x248a2, 0x08fa4, 0x088a6, 0x0a9a6, 0x0a9a9, 0x26eb0, 0x25db2, 0x09cb3, 0x03d75,
+    0x1cd39, 0x06960, 0x18958, 0x0a964, 0x0afa4, 0x0a8a6, 0x089a6, 0x089a9, 0x1ef7d, 0x089a0, 0x1e984, 0x249a2, 0x26fb0, 0x09db3, 0x25cb2, 0x03c75,
+    0x00c69, 0x06875, 0x06975, 0x0ba78, 0x08eb0, 0x27bb2, 0x27ab3, 0x07b75, 0x08fb0, 0x27bb3, 0x27ab2, 0x07a75, 0x080b4, 0x09db0, 0x09cb0, 0x01f69,
+    0x00e21, 0x1ee8d, 0x1efbd, 0x2e8c2, 0x18e58, 0x1ee96, 0x168c6, 0x17dc8, 0x06f60, 0x1cac5, 0x22fc6, 0x29cd8, 0x06e75, 0x25da2, 0x09ca9, 0x03d64,
+    0x0ce58, 0x12e96, 0x228c6, 0x2fbc8, 0x1ee84, 0x1fd9d, 0x2e8cc, 0x13d96, 0x0aea6, 0x2fbcc, 0x240da, 0x23bc6, 0x27db2, 0x1fd84, 0x0bda6, 0x0dd58,
+    0x02f60, 0x1ccc5, 0x16fc6, 0x21ad8, 0x08ea6, 0x2fdcc, 0x260da, 0x17dc6, 0x08fa0, 0x080db, 0x2efcc, 0x1dec5, 0x27db3, 0x09da0, 0x09ca6, 0x03d60,
+    0x02e75, 0x25ba2, 0x0baa9, 0x0bb64, 0x24eb2, 0x1fb84, 0x09ba6, 0x19b58, 0x08fb3, 0x09ba0, 0x0baa6, 0x07b60, 0x27db0, 0x1fd7d, 0x09ca4, 0x1df39,
+    0x00f21, 0x1eebd, 0x1ef8d, 0x2e9c2, 0x06e60, 0x22ec6, 0x1cbc5, 0x29dd8, 0x18f58, 0x169c6, 0x1ef96, 0x17cc8, 0x06f75, 0x0bca9, 0x25ca2, 0x03c64,
+    0x02e60, 0x16ec6, 0x1cdc5, 0x21bd8, 0x08ea0, 0x2eecc, 0x081db, 0x1dfc5, 0x08fa6, 0x261da, 0x2fccc, 0x17cc6, 0x27cb3, 0x09da6, 0x09ca0, 0x03c60,
+    0x0cf58, 0x229c6, 0x12f96, 0x2fac8, 0x0afa6, 0x241da, 0x2facc, 0x23ac6, 0x1ef84, 0x2e9cc, 0x1fc9d, 0x13c96, 0x27cb2, 0x0bca6, 0x1fc84, 0x0dc58,
+    0x02f75, 0x09aa9, 0x25aa2, 0x0ba64, 0x08eb3, 0x0bba6, 0x09aa0, 0x07a60, 0x24fb2, 0x09aa6, 0x1fa84, 0x19a58, 0x27cb0, 0x0bca4, 0x1fc7d, 0x1de39,
+    0x00f51, 0x2eec2, 0x2efc2, 0x000dc, 0x0ae64, 0x2fdc8, 0x21dd8, 0x2fdc2, 0x0af64, 0x21cd8, 0x2fcc8, 0x2fcc2, 0x0bc78, 0x0bd64, 0x0bc64, 0x01c51,
+    0x02e64, 0x16ec8, 0x28fd8, 0x2fbc2, 0x24ea2, 0x1fd96, 0x1d9c5, 0x1fd8d, 0x08fa9, 0x17bc6, 0x23cc6, 0x1fcbd, 0x07d75, 0x19d58, 0x07c60, 0x01d21,
+    0x02f64, 0x28ed8, 0x16fc8, 0x2fac2, 0x0afa9, 0x23dc6, 0x17ac6, 0x1fdbd, 0x24fa2, 0x1d8c5, 0x1fc96, 0x1fc8d, 0x07c75, 0x07d60, 0x19c58, 0x01c21,
+    0x02f78, 0x03b64, 0x03a64, 0x01a51, 0x03b75, 0x0db58, 0x03a60, 0x01b21, 0x03a75, 0x03b60, 0x0da58, 0x01a21, 0x01969, 0x1d939, 0x1d839, 0x01c0d,
+    0x0080e, 0x00822, 0x00923, 0x00852, 0x10a3b, 0x0c859, 0x02861, 0x02865, 0x0cb43, 0x02962, 0x0295a, 0x02966, 0x00a6c, 0x29576, 0x02977, 0x29d4e,
+    0x1cc3b, 0x18859, 0x06861, 0x0a865, 0x1e87e, 0x2f771, 0x088a1, 0x2ff5f, 0x088a5, 0x237a7, 0x0a9a8, 0x2df93, 0x095b1, 0x2b76c, 0x0959b, 0x15d44,
+    0x18d43, 0x06962, 0x0695a, 0x0a966, 0x0a8a5, 0x177a7, 0x089a8, 0x29f93, 0x1c984, 0x089a2, 0x0899f, 0x089a3, 0x095b2, 0x29575, 0x0959c, 0x15d4c,
+    0x04c6c, 0x2d376, 0x06977, 0x21b4e, 0x273b1, 0x2f76c, 0x2739b, 0x21b44, 0x0b3b2, 0x2d375, 0x0b39c, 0x1bb4c, 0x273b0, 0x2f769, 0x2739a, 0x15d40,
+    0x1ce29, 0x1e88e, 0x1e8be, 0x2f7c3, 0x1ce62, 0x17797, 0x155c7, 0x1778e, 0x18a95, 0x137c7, 0x117d7, 0x177be, 0x255a7, 0x29d62, 0x25595, 0x29d29,
+    0x10e62, 0x23797, 0x213c7, 0x2f78e, 0x1ee89, 0x2ff4d, 0x213c0, 0x2ff28, 0x213d2, 0x23795, 0x213c6, 0x2f78c, 0x255a5, 0x17f43, 0x25591, 0x17f1f,
+    0x0cc95, 0x1f7c7, 0x0b2d7, 0x2f7be, 0x155d2, 0x17795, 0x155c6, 0x2b78c, 0x00fcc, 0x1f7c5, 0x272d6, 0x2f7bc, 0x255a6, 0x29d60, 0x25594, 0x15d27,
+    0x273a7, 0x2db62, 0x27395, 0x21b29, 0x273a5, 0x23f43, 0x27391, 0x23f1f, 0x273a6, 0x2db60, 0x27394, 0x1bb27, 0x273a4, 0x1ff39, 0x27390, 0x1ff19,
+    0x00f46, 0x1eec1, 0x1cd98, 0x2f7d0, 0x18e87, 0x177a8, 0x0f5cb, 0x15598, 0x1cb73, 0x137d2, 0x129a8, 0x17cc1, 0x095ad, 0x29573, 0x25c87, 0x03d46,
+    0x0ce87, 0x237a8, 0x1b3cb, 0x21398, 0x1eeb9, 0x2f770, 0x1b3c9, 0x2ff5d, 0x1b3d3, 0x237a6, 0x1b3ca, 0x2df91, 0x095ab, 0x2b76b, 0x09c85, 0x0fd3a,
+    0x10d73, 0x1f7d2, 0x1e9a8, 0x2fac1, 0x0f5d3, 0x177a6, 0x0f5ca, 0x29f91, 0x1cfae, 0x1f7d1, 0x13c9c, 0x13c92, 0x095ac, 0x29572, 0x25c82, 0x03d42,
+    0x0b3ad, 0x2d373, 0x27a87, 0x0bb46, 0x273ab, 0x2f76b, 0x27a85, 0x1bb3a, 0x0b3ac, 0x2d372, 0x27a82, 0x07b42, 0x273aa, 0x2ff68, 0x11c7b, 0x01e30,
+    0x00e64, 0x1f7c8, 0x1d7d8, 0x2f7c2, 0x18ea2, 0x17796, 0x295c5, 0x1778d, 0x04fa9, 0x137c6, 0x2fcc6, 0x177bd, 0x0bd75, 0x25d58, 0x0bc60, 0x03d21,
+    0x0eea2, 0x23796, 0x213c5, 0x2f78d, 0x2eeba, 0x2ff4b, 0x213bf, 0x2ff26, 0x213d1, 0x23794, 0x213c4, 0x21f8b, 0x0bd6e, 0x13f3f, 0x0bc5c, 0x0fd1a,
+    0x00fa9, 0x1f7c6, 0x2bac6, 0x2f7bd, 0x295d1, 0x17794, 0x295c4, 0x29f8b, 0x1d8d1, 0x1f7c4, 0x1fc94, 0x1de8b, 0x07c72, 0x25d56, 0x07c56, 0x01c1e,
+    0x09b75, 0x27b58, 0x09a60, 0x0bb21, 0x03b6e, 0x23f3f, 0x03a5c, 0x19b1a, 0x03a72, 0x09b56, 0x03a56, 0x05a1e, 0x01968, 0x1ff33, 0x1d838, 0x1df09,
+    0x0090e, 0x00823, 0x00922, 0x00952, 0x0ca43, 0x0285a, 0x02862, 0x02866, 0x10b3b, 0x02961, 0x0c959, 0x02965, 0x00b6c, 0x02877, 0x29476, 0x29c4e,
+    0x18c43, 0x0685a, 0x06862, 0x0a866, 0x1c884, 0x0889f, 0x088a2, 0x088a3, 0x0a9a5, 0x088a8, 0x176a7, 0x29e93, 0x094b2, 0x0949c, 0x29475, 0x15c4c,
+    0x1cd3b, 0x06961, 0x18959, 0x0a965, 0x089a5, 0x0a8a8, 0x236a7, 0x2de93, 0x1e97e, 0x089a1, 0x2f671, 0x2fe5f, 0x094b1, 0x0949b, 0x2b66c, 0x15c44,
+    0x04d6c, 0x06877, 0x2d276, 0x21a4e, 0x0b2b2, 0x0b29c, 0x2d275, 0x1ba4c, 0x272b1, 0x2729b, 0x2f66c, 0x21a44, 0x272b0, 0x2729a, 0x2f669, 0x15c40,
+    0x00e46, 0x1cc98, 0x1efc1, 0x2f6d0, 0x1ca73, 0x128a8, 0x136d2, 0x17dc1, 0x18f87, 0x0f4cb, 0x176a8, 0x15498, 0x094ad, 0x25d87, 0x29473, 0x03c46,
+    0x10c73, 0x1e8a8, 0x1f6d2, 0x2fbc1, 0x1ceae, 0x13d9c, 0x1f6d1, 0x13d92, 0x0f4d3, 0x0f4ca, 0x176a6, 0x29e91, 0x094ac, 0x25d82, 0x29472, 0x03c42,
+    0x0cf87, 0x1b2cb, 0x236a8, 0x21298, 0x1b2d3, 0x1b2ca, 0x236a6, 0x2de91, 0x1efb9, 0x1b2c9, 0x2f670, 0x2fe5d, 0x094ab, 0x09d85, 0x2b66b, 0x0fc3a,
+    0x0b2ad, 0x27b87, 0x2d273, 0x0ba46, 0x0b2ac, 0x27b82, 0x2d272, 0x07a42, 0x272ab, 0x27b85, 0x2f66b, 0x1ba3a, 0x272aa, 0x11d7b, 0x2fe68, 0x01f30,
+    0x1cf29, 0x1e9be, 0x1e98e, 0x2f6c3, 0x18b95, 0x116d7, 0x136c7, 0x176be, 0x1cf62, 0x154c7, 0x17697, 0x1768e, 0x254a7, 0x25495, 0x29c62, 0x29c29,
+    0x0cd95, 0x0b3d7, 0x1f6c7, 0x2f6be, 0x00ecc, 0x273d6, 0x1f6c5, 0x2f6bc, 0x154d2, 0x154c6, 0x17695, 0x2b68c, 0x254a6, 0x25494, 0x29c60, 0x15c27,
+    0x10f62, 0x212c7, 0x23697, 0x2f68e, 0x212d2, 0x212c6, 0x23695, 0x2f68c, 0x1ef89, 0x212c0, 0x2fe4d, 0x2fe28, 0x254a5, 0x25491, 0x17e43, 0x17e1f,
+    0x272a7, 0x27295, 0x2da62, 0x21a29, 0x272a6, 0x27294, 0x2da60, 0x1ba27, 0x272a5, 0x27291, 0x23e43, 0x23e1f, 0x272a4, 0x27290, 0x1fe39, 0x1fe19,
+    0x00f64, 0x1d6d8, 0x1f6c8, 0x2f6c2, 0x06fa9, 0x2fdc6, 0x136c6, 0x176bd, 0x18fa2, 0x294c5, 0x17696, 0x1768d, 0x0bc75, 0x0bd60, 0x25c58, 0x03c21,
+    0x02fa9, 0x2bbc6, 0x1f6c6, 0x2f6bd, 0x1d9d1, 0x1fd94, 0x1f6c4, 0x1df8b, 0x294d1, 0x294c4, 0x17694, 0x29e8b, 0x0bc72, 0x07d56, 0x25c56, 0x03c1e,
+    0x0efa2, 0x212c5, 0x23696, 0x2f68d, 0x212d1, 0x212c4, 0x23694, 0x21e8b, 0x2efba, 0x212bf, 0x2fe4b, 0x2fe26, 0x0bc6e, 0x0bd5c, 0x13e3f, 0x0fc1a,
+    0x09a75, 0x09b60, 0x27a58, 0x0ba21, 0x09a72, 0x03b56, 0x09a56, 0x07a1e, 0x03a6e, 0x03b5c, 0x23e3f, 0x19a1a, 0x01868, 0x1d938, 0x1fe33, 0x1de09,
+    0x0090f, 0x00824, 0x00924, 0x01653, 0x0ca45, 0x0175b, 0x01663, 0x03724, 0x0cb45, 0x01763, 0x0165b, 0x03624, 0x0166d, 0x0f545, 0x0f445, 0x0360f,
+    0x18c45, 0x0575b, 0x05663, 0x0b724, 0x01771, 0x01755, 0x0165f, 0x0971d, 0x01674, 0x05759, 0x01659, 0x09620, 0x0176c, 0x15541, 0x0f444, 0x0970c,
+    0x18d45, 0x05763, 0x0565b, 0x0b624, 0x05674, 0x01759, 0x05659, 0x0b620, 0x01671, 0x0175f, 0x01655, 0x0961d, 0x0166c, 0x0f544, 0x15441, 0x0960c,
+    0x0736d, 0x1b345, 0x1b245, 0x0b60f, 0x0576c, 0x1b341, 0x1b244, 0x2770c, 0x0566c, 0x1b344, 0x1b241, 0x2760c, 0x01669, 0x1b340, 0x1b240, 0x09605,
+    0x1ce4e, 0x01765, 0x01666, 0x01752, 0x01776, 0x0f759, 0x01662, 0x03722, 0x01677, 0x01761, 0x0165a, 0x03623, 0x0356c, 0x1553b, 0x0f443, 0x0370e,
+    0x05776, 0x1b759, 0x05662, 0x0b722, 0x0176f, 0x2ff41, 0x0165e, 0x2571b, 0x05773, 0x05757, 0x01658, 0x0b71f, 0x0176a, 0x15534, 0x0f442, 0x2570a,
+    0x05677, 0x05761, 0x0565a, 0x0b623, 0x01773, 0x01757, 0x05658, 0x0971f, 0x01670, 0x0175d, 0x01654, 0x0961c, 0x0166b, 0x1553a, 0x1543f, 0x0960b,
+    0x0736c, 0x2133b, 0x1b243, 0x0b70e, 0x0736a, 0x21334, 0x1b242, 0x2770a, 0x0736b, 0x2133a, 0x1b23f, 0x2760b, 0x01768, 0x2ff30, 0x1b23e, 0x09f04,
+    0x1cf4e, 0x01766, 0x01665, 0x01652, 0x01777, 0x0175a, 0x01661, 0x03723, 0x01676, 0x01762, 0x0f659, 0x03622, 0x0346c, 0x0f543, 0x1543b, 0x0360e,
+    0x05777, 0x0575a, 0x05661, 0x0b723, 0x01770, 0x01754, 0x0165d, 0x0971c, 0x01673, 0x05758, 0x01657, 0x0961f, 0x0176b, 0x1553f, 0x1543a, 0x0970b,
+    0x05676, 0x05762, 0x1b659, 0x0b622, 0x05673, 0x01758, 0x05657, 0x0b61f, 0x0166f, 0x0175e, 0x2fe41, 0x2561b, 0x0166a, 0x0f542, 0x15434, 0x2560a,
+    0x0726c, 0x1b343, 0x2123b, 0x0b60e, 0x0726b, 0x1b33f, 0x2123a, 0x2770b, 0x0726a, 0x1b342, 0x21234, 0x2760a, 0x01668, 0x1b33e, 0x2fe30, 0x09e04,
+    0x01678, 0x01764, 0x01664, 0x01651, 0x01775, 0x0f758, 0x01660, 0x03721, 0x01675, 0x01760, 0x0f658, 0x03621, 0x03569, 0x29539, 0x29439, 0x0360d,
+    0x05775, 0x1b758, 0x05660, 0x0b721, 0x0176e, 0x2ff3f, 0x0165c, 0x2571a, 0x01672, 0x05756, 0x01656, 0x0961e, 0x03568, 0x29533, 0x29438, 0x29f09,
+    0x05675, 0x05760, 0x1b658, 0x0b621, 0x05672, 0x01756, 0x05656, 0x0b61e, 0x0166e, 0x0175c, 0x2fe3f, 0x2561a, 0x03468, 0x29538, 0x29433, 0x29e09,
+    0x0b369, 0x21339, 0x21239, 0x0b60d, 0x0b368, 0x21333, 0x21238, 0x21f09, 0x0b268, 0x21338, 0x21233, 0x21e09, 0x0b367, 0x2ff2e, 0x2fe2e, 0x01f02,
+    0x00e01, 0x2e208, 0x2e02d, 0x2e02e, 0x20603, 0x2e209, 0x1202f, 0x12030, 0x20208, 0x20218, 0x2632e, 0x1863e, 0x20209, 0x20219, 0x0a330, 0x18640,
+    0x16603, 0x16409, 0x2202f, 0x22030, 0x2e606, 0x1e60b, 0x1e031, 0x1e032, 0x06618, 0x1e21e, 0x04638, 0x1c642, 0x1861a, 0x1e21f, 0x1863a, 0x1c644,
+    0x02608, 0x16418, 0x0252e, 0x1063e, 0x00618, 0x1061e, 0x00638, 0x10642, 0x08718, 0x00625, 0x0063e, 0x0064a, 0x0461e, 0x18627, 0x04642, 0x1864c,
+    0x28409, 0x16419, 0x02530, 0x10640, 0x0e61a, 0x1241f, 0x0c63a, 0x10644, 0x0061e, 0x10627, 0x00642, 0x1064c, 0x00621, 0x1c629, 0x00646, 0x1c64e,
+    0x24602, 0x1e609, 0x0062e, 0x1e033, 0x20604, 0x2220a, 0x18630, 0x12034, 0x06609, 0x2021a, 0x06333, 0x1863f, 0x2020a, 0x2021b, 0x06334, 0x18641,
+    0x16604, 0x1260a, 0x10630, 0x1e034, 0x2e607, 0x1e60c, 0x1c632, 0x1e035, 0x06619, 0x1c61f, 0x04639, 0x1c643, 0x1861b, 0x1e220, 0x1863b, 0x1c645,
+    0x02609, 0x1641a, 0x00633, 0x1063f, 0x00619, 0x1061f, 0x00639, 0x10643, 0x0871a, 0x00626, 0x0063f, 0x0064b, 0x0461f, 0x18628, 0x04643, 0x1864d,
+    0x0e60a, 0x1641b, 0x0c634, 0x10641, 0x0e61b, 0x10620, 0x0c63b, 0x10645, 0x0061f, 0x10628, 0x00643, 0x1064d, 0x00622, 0x1c62a, 0x00647, 0x1c64f,
+    0x08603, 0x1e618, 0x1a32f, 0x1c638, 0x26606, 0x1e61a, 0x06331, 0x1c63a, 0x26709, 0x1a21e, 0x1a330, 0x18642, 0x0660b, 0x1a21f, 0x06332, 0x18644,
+    0x02606, 0x1061a, 0x00631, 0x1063a, 0x00616, 0x1e61c, 0x00636, 0x1c63c, 0x0661a, 0x18621, 0x0463a, 0x18646, 0x0661c, 0x18623, 0x0463c, 0x18648,
+    0x08709, 0x0c61e, 0x14530, 0x0c642, 0x0061a, 0x10621, 0x0063a, 0x10646, 0x08719, 0x00627, 0x00640, 0x0064c, 0x0671f, 0x04629, 0x04644, 0x0464e,
+    0x0260b, 0x0e41f, 0x02532, 0x0c644, 0x0061c, 0x10623, 0x0063c, 0x10648, 0x0271f, 0x00629, 0x00644, 0x0064e, 0x00623, 0x0062b, 0x00648, 0x00650,
+    0x08604, 0x1e619, 0x00630, 0x1c639, 0x26607, 0x1e61b, 0x04632, 0x1c63b, 0x0660a, 0x1861f, 0x1a334, 0x18643, 0x0660c, 0x1a220, 0x06335, 0x18645,
+    0x02607, 0x1061b, 0x00632, 0x1063b, 0x00617, 0x1e61d, 0x00637, 0x1c63d, 0x0661b, 0x18622, 0x0463b, 0x18647, 0x0661d, 0x18624, 0x0463d, 0x18649,
+    0x0260a, 0x0c61f, 0x00634, 0x0c643, 0x0061b, 0x10622, 0x0063b, 0x10647, 0x0871b, 0x00628, 0x00641, 0x0064d, 0x04620, 0x0462a, 0x04645, 0x0464f,
+    0x0260c, 0x0c620, 0x00635, 0x0c645, 0x0061d, 0x10624, 0x0063d, 0x10649, 0x00620, 0x0062a, 0x00645, 0x0064f, 0x00624, 0x0062c, 0x00649, 0x01914,
+    0x1ec03, 0x1e809, 0x2e02f, 0x2e030, 0x2ea06, 0x16a0b, 0x16031, 0x16032, 0x08a18, 0x2a21e, 0x08a38, 0x28a42, 0x24a1a, 0x2a21f, 0x24a3a, 0x28a44,
+    0x2ec06, 0x2ec0b, 0x2e031, 0x2e032, 0x2e210, 0x12211, 0x2e036, 0x2e037, 0x2e225, 0x12227, 0x1225c, 0x1225e, 0x2e226, 0x12228, 0x1225d, 0x1225f,
+    0x08c18, 0x2e41e, 0x26c38, 0x2cc42, 0x2e425, 0x22427, 0x2245c, 0x2245e, 0x1e08a, 0x1e08b, 0x10290, 0x10292, 0x1c28b, 0x1208c, 0x10291, 0x10293,
+    0x24c1a, 0x2e41f, 0x26c3a, 0x2cc44, 0x2e426, 0x22428, 0x2245d, 0x2245f, 0x1c48b, 0x1e08c, 0x1c491, 0x1c493, 0x1e08d, 0x1e08e, 0x10298, 0x01f65,
+    0x1ee09, 0x2e20d, 0x1e038, 0x1e039, 0x2ea0b, 0x2e20e, 0x1203a, 0x1203b, 0x2e21e, 0x2e221, 0x16256, 0x16258, 0x2e21f, 0x2e222, 0x16257, 0x16259,
+    0x16c0b, 0x2e40e, 0x1e03a, 0x1e03b, 0x22211, 0x1e212, 0x1e03c, 0x1e03d, 0x22227, 0x1e229, 0x12260, 0x12262, 0x22228, 0x1e22a, 0x12261, 0x12263,
+    0x2a41e, 0x2e421, 0x2c456, 0x22458, 0x12427, 0x1e429, 0x1e460, 0x1e462, 0x1e68b, 0x1c28d, 0x10294, 0x10296, 0x1c28c, 0x1c28e, 0x10295, 0x10297,
+    0x2a41f, 0x2e422, 0x2c457, 0x22459, 0x12428, 0x1e42a, 0x1e461, 0x1e463, 0x1268c, 0x1c48e, 0x1c495, 0x1c497, 0x1e68e, 0x1e08f, 0x10299, 0x1df2a,
+    0x2e62f, 0x1e638, 0x08279, 0x1027b, 0x2e631, 0x1e63a, 0x0827a, 0x1027c, 0x26a38, 0x2c256, 0x0827b, 0x08282, 0x26a3a, 0x2c257, 0x0827c, 0x08283,
+    0x16631, 0x1263a, 0x0847a, 0x1e47c, 0x2e636, 0x1e63c, 0x1e27f, 0x10280, 0x2225c, 0x1e260, 0x1c285, 0x10287, 0x2225d, 0x1e261, 0x1c286, 0x10288,
+    0x08c38, 0x16456, 0x0847b, 0x0a482, 0x1245c, 0x12460, 0x1c485, 0x1c487, 0x1c290, 0x1c294, 0x1c29a, 0x1029c, 0x1c291, 0x1c295, 0x1c29b, 0x0de77,
+    0x24c3a, 0x16457, 0x0847c, 0x0a483, 0x1245d, 0x12461, 0x1c486, 0x1c488, 0x10491, 0x10495, 0x1c49b, 0x19e77, 0x1c298, 0x1c299, 0x1c29e, 0x01e48,
+    0x2e630, 0x1e639, 0x1e27b, 0x1e27d, 0x2e632, 0x1e63b, 0x1e27c, 0x1e27e, 0x2ca42, 0x22258, 0x0a282, 0x1c284, 0x2ca44, 0x22259, 0x0a283, 0x01d71,
+    0x16632, 0x1263b, 0x1047c, 0x1e47e, 0x2e637, 0x1e63d, 0x1e280, 0x1e281, 0x2225e, 0x1e262, 0x1c287, 0x1c289, 0x2225f, 0x1e263, 0x1c288, 0x1dd3d,
+    0x28c42, 0x16458, 0x08482, 0x1c484, 0x1245e, 0x12462, 0x10487, 0x1c489, 0x1c292, 0x1c296, 0x1c29c, 0x1c29d, 0x1c293, 0x1c297, 0x19877, 0x01c4d,
+    0x28c44, 0x16459, 0x08483, 0x01b71, 0x1245f, 0x12463, 0x10488, 0x1db3d, 0x10493, 0x10497, 0x0d877, 0x01a4d, 0x01965, 0x1d92a, 0x01848, 0x1df12,
+    0x04c08, 0x1e818, 0x0092e, 0x1ac3e, 0x00a18, 0x14a1e, 0x02a38, 0x14a42, 0x06b18, 0x02a25, 0x22f3e, 0x02a4a, 0x08a1e, 0x24a27, 0x08a42, 0x24a4c,
+    0x06c18, 0x20c1e, 0x06c38, 0x20c42, 0x2e825, 0x2e827, 0x2e85c, 0x2e85e, 0x1608a, 0x1608b, 0x14290, 0x14292, 0x2828b, 0x1608c, 0x14291, 0x14293,
+    0x00d18, 0x26c25, 0x0ac3e, 0x26c4a, 0x2e08a, 0x2e08b, 0x22790, 0x20492, 0x2ef25, 0x2e0bb, 0x2ef4a, 0x01ece, 0x2038b, 0x120bc, 0x22792, 0x01ea3,
+    0x0ac1e, 0x26c27, 0x0ac42, 0x26c4c, 0x2048b, 0x2208c, 0x20491, 0x20493, 0x2858b, 0x220bc, 0x16792, 0x07ea3, 0x1e0bd, 0x1e0be, 0x1e7c1, 0x01e66,
+    0x00e2e, 0x1e838, 0x2e067, 0x2e068, 0x0ab3e, 0x16842, 0x24268, 0x2a06a, 0x06b38, 0x24a5c, 0x26368, 0x2426e, 0x0ab42, 0x24a5e, 0x2636a, 0x2426f,
+    0x02d3e, 0x22842, 0x26468, 0x2e06a, 0x2e84a, 0x2e84c, 0x2e06e, 0x2e06f, 0x16090, 0x16091, 0x160a4, 0x160a5, 0x16092, 0x16093, 0x142a5, 0x11d74,
+    0x02d38, 0x26c5c, 0x24568, 0x2646e, 0x22090, 0x22091, 0x220a4, 0x220a5, 0x2ef5c, 0x1e0bf, 0x2e76e, 0x01eba, 0x20391, 0x120c0, 0x203a5, 0x01e89,
+    0x08d42, 0x26c5e, 0x2456a, 0x2646f, 0x22092, 0x22093, 0x204a5, 0x19f74, 0x14591, 0x1e0c0, 0x145a5, 0x05e89, 0x1e0c1, 0x1dd99, 0x1e0cf, 0x01f47,
+    0x1ef18, 0x2638a, 0x1ef38, 0x08290, 0x26b25, 0x0828b, 0x26b5c, 0x08291, 0x22f1e, 0x2638b, 0x22f42, 0x08292, 0x26b27, 0x0a38c, 0x26b5e, 0x08293,
+    0x02d25, 0x2648b, 0x24d5c, 0x0a491, 0x022bb, 0x142bc, 0x022bf, 0x0e2c0, 0x1678b, 0x022bd, 0x16791, 0x022c1, 0x022bc, 0x022be, 0x022c0, 0x0dc99,
+    0x14d1e, 0x0858b, 0x16f42, 0x0a492, 0x2e78b, 0x063bd, 0x22791, 0x064c1, 0x2ef27, 0x1a3bc, 0x2ef4c, 0x1fea3, 0x2038c, 0x063be, 0x22793, 0x11e66,
+    0x24d27, 0x0858c, 0x24d5e, 0x0a493, 0x127bc, 0x064be, 0x127c0, 0x05f99, 0x1678c, 0x025be, 0x16793, 0x19e66, 0x1e7be, 0x1c0d5, 0x11c99, 0x01e2b,
+    0x14d3e, 0x0a390, 0x2e768, 0x0a3a4, 0x26b4a, 0x0a392, 0x2636e, 0x082a5, 0x20b42, 0x0a391, 0x2c36a, 0x0a3a5, 0x26b4c, 0x0a393, 0x2636f, 0x01c74,
+    0x02d4a, 0x08592, 0x2456e, 0x0a4a5, 0x019ce, 0x1f9a3, 0x019ba, 0x1d989, 0x14592, 0x025c1, 0x167a5, 0x022cf, 0x079a3, 0x19966, 0x05989, 0x19d47,
+    0x14d42, 0x08591, 0x2a76a, 0x085a5, 0x20392, 0x063c1, 0x227a5, 0x063cf, 0x2ef5e, 0x1a3c0, 0x2e76f, 0x1de89, 0x20393, 0x19d99, 0x1dc74, 0x11c47,
+    0x24d4c, 0x08593, 0x2456f, 0x05a74, 0x019a3, 0x11966, 0x01989, 0x11b47, 0x14593, 0x0db99, 0x11a74, 0x19a47, 0x01966, 0x0192b, 0x01847, 0x01e13,
+    0x1c809, 0x1e819, 0x00930, 0x1ac40, 0x0ea1a, 0x1681f, 0x0ea3a, 0x14a44, 0x02a1e, 0x14a27, 0x02a42, 0x14a4c, 0x02a21, 0x28a29, 0x02a46, 0x28a4e,
+    0x18c1a, 0x2281f, 0x1ac3a, 0x20c44, 0x2e826, 0x2e828, 0x2e85d, 0x2e85f, 0x2888b, 0x2a08c, 0x28891, 0x28893, 0x1608d, 0x1608e, 0x14298, 0x03f65,
+    0x06c1e, 0x1ac27, 0x06c42, 0x1ac4c, 0x2088b, 0x2e08c, 0x2c891, 0x2c893, 0x1c98b, 0x2e0bc, 0x1ed92, 0x09ea3, 0x160bd, 0x160be, 0x16bc1, 0x03e66,
+    0x0ac21, 0x20c29, 0x0ac46, 0x20c4e, 0x2e08d, 0x2e08e, 0x20498, 0x0bf65, 0x2e0bd, 0x2e0be, 0x2edc1, 0x0be66, 0x2e0c2, 0x2e0c3, 0x2e0d0, 0x01f52,
+    0x1ce33, 0x1e839, 0x2e868, 0x2e069, 0x1283f, 0x16843, 0x2a06b, 0x2a06c, 0x24a56, 0x28a60, 0x28272, 0x28275, 0x24a58, 0x28a62, 0x28273, 0x28276,
+    0x2283f, 0x22843, 0x2e06b, 0x2e06c, 0x2e84b, 0x2e84d, 0x2e070, 0x2e071, 0x16094, 0x16095, 0x160a6, 0x160a7, 0x16096, 0x16097, 0x160a8, 0x0df59,
+    0x08c56, 0x2cc60, 0x2c472, 0x2c475, 0x22094, 0x22095, 0x220a6, 0x220a7, 0x1e0c4, 0x1e0c5, 0x1e0d1, 0x09ea2, 0x120c6, 0x120c7, 0x120d2, 0x03e62,
+    0x26c58, 0x2cc62, 0x2c473, 0x2c476, 0x22096, 0x22097, 0x220a8, 0x19f59, 0x1e0c6, 0x1e0c7, 0x1e0d2, 0x07e62, 0x1e0c8, 0x1ff8e, 0x1f9c1, 0x01f22,
+    0x1cf38, 0x24290, 0x1ed7b, 0x0829a, 0x0ab5c, 0x24291, 0x08b85, 0x0829b, 0x06b56, 0x24294, 0x24b82, 0x0829c, 0x0ab60, 0x24295, 0x24b87, 0x03e77,
+    0x02d5c, 0x26491, 0x26d85, 0x2649b, 0x282bf, 0x142c0, 0x142c9, 0x09fa1, 0x282c4, 0x142c6, 0x0e2ca, 0x09ea8, 0x282c5, 0x142c7, 0x0e2cb, 0x03f61,
+    0x02d56, 0x26494, 0x26d82, 0x0a49c, 0x204c4, 0x204c6, 0x1a4ca, 0x0bea8, 0x12d94, 0x1c0d6, 0x1ed9c, 0x09e9f, 0x2ebc6, 0x100d7, 0x13ea8, 0x03e5a,
+    0x08d60, 0x26495, 0x26d87, 0x07e77, 0x204c5, 0x204c7, 0x1a4cb, 0x07f61, 0x2adc6, 0x1c0d7, 0x1fea8, 0x07e5a, 0x1c0d8, 0x1ffbe, 0x11c98, 0x01e23,
+    0x00e68, 0x242a4, 0x082aa, 0x082b0, 0x0aa6e, 0x242a5, 0x082ab, 0x082b1, 0x0aa72, 0x242a6, 0x082ac, 0x082b2, 0x0aa75, 0x242a7, 0x082ad, 0x01d6c,
+    0x02c6e, 0x264a5, 0x264ab, 0x264b1, 0x2f9ba, 0x1f989, 0x1f9b9, 0x1ff7e, 0x282d1, 0x142d2, 0x0e2d3, 0x0bfa5, 0x199a2, 0x1d962, 0x19987, 0x11d3b,
+    0x08c72, 0x264a6, 0x0a4ac, 0x0a4b2, 0x204d1, 0x204d2, 0x1a4d3, 0x09fa5, 0x1cfd1, 0x018cc, 0x1feae, 0x1de84, 0x079a9, 0x19d95, 0x1dc73, 0x0dc43,
+    0x08c75, 0x264a7, 0x0a4ad, 0x05b6c, 0x0f9a2, 0x11962, 0x0d987, 0x1db3b, 0x039a9, 0x0db95, 0x11a73, 0x19a43, 0x01964, 0x1d929, 0x01846, 0x01f0e,
+    0x18e02, 0x16a09, 0x02a2e, 0x16033, 0x20a04, 0x2e20a, 0x24a30, 0x16034, 0x26a09, 0x2c21a, 0x26333, 0x24a3f, 0x2c20a, 0x2c21b, 0x0a334, 0x24a41,
+    0x16e09, 0x2220d, 0x16038, 0x16039, 0x2e60b, 0x2220e, 0x1603a, 0x1603b, 0x2221e, 0x22221, 0x1c256, 0x12258, 0x2221f, 0x22222, 0x1c257, 0x12259,
+    0x02e2e, 0x16438, 0x22067, 0x22068, 0x0a73e, 0x12442, 0x18268, 0x1e06a, 0x26738, 0x1865c, 0x1a368, 0x1826e, 0x06742, 0x1865e, 0x1a36a, 0x1826f,
+    0x16433, 0x16439, 0x22468, 0x22069, 0x1243f, 0x12443, 0x1e06b, 0x1e06c, 0x06656, 0x1c660, 0x1c272, 0x1c275, 0x18658, 0x1c662, 0x1c273, 0x1c276,
+    0x20e04, 0x2e20b, 0x1203e, 0x1203f, 0x20205, 0x2e20c, 0x12040, 0x12041, 0x2020b, 0x2021c, 0x0a33f, 0x24254, 0x2020c, 0x2021d, 0x0a341, 0x24255,
+    0x2e60a, 0x2260e, 0x12042, 0x12043, 0x2e60c, 0x2220f, 0x12044, 0x12045, 0x2061f, 0x22223, 0x1c258, 0x1c25a, 0x22220, 0x22224, 0x1c259, 0x1c25b,
+    0x24e30, 0x1643a, 0x18668, 0x1c26b, 0x0a740, 0x12444, 0x18269, 0x1c26c, 0x0a73a, 0x1865d, 0x1826b, 0x18270, 0x06744, 0x1865f, 0x1826c, 0x18271,
+    0x16434, 0x1643b, 0x1c66a, 0x1e46c, 0x12441, 0x12445, 0x1c66c, 0x1e06d, 0x06657, 0x1c661, 0x18673, 0x1c277, 0x18659, 0x1c663, 0x1c274, 0x11f45,
+    0x26e09, 0x2021e, 0x26338, 0x06256, 0x2060b, 0x2021f, 0x0a33a, 0x06257, 0x1a20d, 0x1a221, 0x26339, 0x06258, 0x1a20e, 0x1a222, 0x0a33b, 0x06259,
+    0x2c61a, 0x22621, 0x1825c, 0x1c260, 0x2061c, 0x22623, 0x1825d, 0x1c261, 0x1a621, 0x18251, 0x18260, 0x18264, 0x1a623, 0x18252, 0x18261, 0x18265,
+    0x26733, 0x1c656, 0x1a768, 0x18272, 0x0a73f, 0x1c658, 0x1a36b, 0x18273, 0x26739, 0x18660, 0x1a369, 0x18275, 0x06743, 0x18662, 0x1a36c, 0x18276,
+    0x24e3f, 0x12658, 0x1866e, 0x1c675, 0x24654, 0x1c65a, 0x18670, 0x1c677, 0x06658, 0x18664, 0x18675, 0x18278, 0x0665a, 0x18666, 0x18677, 0x01e4e,
+    0x2c60a, 0x2261f, 0x06342, 0x18258, 0x2060c, 0x20220, 0x06344, 0x18259, 0x1a60e, 0x1a223, 0x06343, 0x0625a, 0x1a20f, 0x1a224, 0x06345, 0x0625b,
+    0x2c61b, 0x22622, 0x1825e, 0x1c262, 0x2061d, 0x22624, 0x1825f, 0x1c263, 0x1a622, 0x18652, 0x18262, 0x18266, 0x1a624, 0x18253, 0x18263, 0x19d24,
+    0x0a734, 0x1c657, 0x1866a, 0x1c673, 0x0a741, 0x1c659, 0x1866c, 0x18274, 0x0a73b, 0x18661, 0x1a76c, 0x18277, 0x06745, 0x18663, 0x1a36d, 0x05c45,
+    0x24e41, 0x12659, 0x1866f, 0x1c676, 0x24655, 0x1c65b, 0x18671, 0x11b45, 0x06659, 0x18665, 0x18676, 0x01a4e, 0x0665b, 0x19924, 0x05845, 0x19d0f,
+    0x1ea04, 0x16a0a, 0x14a30, 0x2a034, 0x2ea07, 0x16a0c, 0x28a32, 0x16035, 0x08a19, 0x28a1f, 0x08a39, 0x28a43, 0x24a1b, 0x2a220, 0x24a3b, 0x28a45,
+    0x1ec0b, 0x2280e, 0x2a03a, 0x2a03b, 0x2e211, 0x16212, 0x1603c, 0x1603d, 0x2e227, 0x16229, 0x16260, 0x16262, 0x2e228, 0x1622a, 0x16261, 0x16263,
+    0x2e43e, 0x2e442, 0x1a868, 0x2206a, 0x2e44a, 0x2244c, 0x2206e, 0x2206f, 0x12090, 0x12091, 0x120a4, 0x120a5, 0x12092, 0x12093, 0x102a5, 0x15d74,
+    0x2e43f, 0x2e443, 0x2206b, 0x2206c, 0x2e44b, 0x2244d, 0x22070, 0x22071, 0x12094, 0x12095, 0x120a6, 0x120a7, 0x12096, 0x12097, 0x120a8, 0x0ff59,
+    0x1ee0a, 0x2ea0e, 0x16042, 0x16043, 0x2ea0c, 0x2e20f, 0x16044, 0x16045, 0x2ca1f, 0x2e223, 0x28258, 0x1625a, 0x2e220, 0x2e224, 0x28259, 0x1625b,
+    0x12e0e, 0x2e213, 0x12046, 0x12047, 0x2e212, 0x2e214, 0x12048, 0x12049, 0x2e229, 0x2e22b, 0x12264, 0x12266, 0x2e22a, 0x2e22c, 0x12265, 0x13d24,
+    0x2a442, 0x2e446, 0x1e072, 0x1e073, 0x1244c, 0x1e44e, 0x1e075, 0x1e076, 0x1e691, 0x12098, 0x102a6, 0x102a8, 0x1e693, 0x2fd65, 0x102a7, 0x15d59,
+    0x2a443, 0x2e447, 0x22473, 0x1e074, 0x1244d, 0x1e44f, 0x1e077, 0x13d45, 0x1e695, 0x12099, 0x120a9, 0x19b93, 0x1e697, 0x1fd2a, 0x23993, 0x13d20,
+    0x1aa30, 0x22642, 0x2427b, 0x24282, 0x20a32, 0x22644, 0x2427c, 0x24283, 0x26a39, 0x2c258, 0x0827d, 0x08284, 0x26a3b, 0x2c259, 0x0827e, 0x15d71,
+    0x2e63a, 0x22646, 0x1e285, 0x12287, 0x2e63c, 0x22648, 0x1e286, 0x12288, 0x22260, 0x22264, 0x1e2a0, 0x102a2, 0x22261, 0x22265, 0x1e2a1, 0x15f5f,
+    0x14e68, 0x12672, 0x1c2aa, 0x102ac, 0x1266e, 0x12675, 0x1c2ab, 0x102ad, 0x1c2a4, 0x1c2a6, 0x1c2b0, 0x102b2, 0x1c2a5, 0x1c2a7, 0x1c2b1, 0x0fd6c,
+    0x1666b, 0x16473, 0x1e4ab, 0x1e4ad, 0x12670, 0x12677, 0x1c2af, 0x19f83, 0x1e6a6, 0x1c2a9, 0x1c2b3, 0x19e75, 0x1e6a8, 0x17f93, 0x1dc9b, 0x01e44,
+    0x2e634, 0x22643, 0x26282, 0x1e284, 0x2e635, 0x22645, 0x26283, 0x2fd71, 0x2ca43, 0x2c25a, 0x26284, 0x0829f, 0x2ca45, 0x2c25b, 0x1bd71, 0x01d55,
+    0x2e63b, 0x22647, 0x1e287, 0x1e289, 0x2e63d, 0x22649, 0x1e288, 0x1fd3d, 0x22262, 0x22266, 0x1e2a2, 0x1e2a3, 0x22263, 0x23d24, 0x1b95f, 0x1fd1d,
+    0x1666a, 0x12673, 0x1c2ac, 0x1c2ae, 0x1266f, 0x12676, 0x1c2ad, 0x2fd6f, 0x1e6a5, 0x1c2a8, 0x1c2b2, 0x11e9c, 0x21d74, 0x21d59, 0x1bd6c, 0x01c41,
+    0x1666c, 0x12674, 0x124ad, 0x01b6f, 0x12671, 0x1fd45, 0x23983, 0x1fd35, 0x1e6a7, 0x0db93, 0x0d875, 0x01a4c, 0x1b959, 0x1fd20, 0x05844, 0x1dd0c,
+    0x00a09, 0x1081a, 0x02a33, 0x14a3f, 0x00a19, 0x14a1f, 0x02a39, 0x14a43, 0x06b1a, 0x02a26, 0x02a3f, 0x02a4b, 0x08a1f, 0x24a28, 0x08a43, 0x24a4d,
+    0x1cc1e, 0x22821, 0x20856, 0x2e858, 0x12827, 0x16829, 0x2a860, 0x2a862, 0x16a8b, 0x2828d, 0x14294, 0x14296, 0x2828c, 0x2828e, 0x14295, 0x14297,
+    0x00d38, 0x1ac5c, 0x18968, 0x1a86e, 0x2e090, 0x2e091, 0x2e0a4, 0x2e0a5, 0x22f5c, 0x160bf, 0x22b6e, 0x03eba, 0x2c391, 0x160c0, 0x2c3a5, 0x03e89,
+    0x04c56, 0x20c60, 0x1ac72, 0x20875, 0x2e094, 0x2e095, 0x2e0a6, 0x2e0a7, 0x160c4, 0x160c5, 0x160d1, 0x07ea2, 0x160c6, 0x160c7, 0x160d2, 0x01e62,
+    0x18e30, 0x1283a, 0x24a68, 0x2826b, 0x0ab40, 0x16844, 0x24269, 0x2826c, 0x06b3a, 0x24a5d, 0x2426b, 0x24270, 0x0ab44, 0x24a5f, 0x2426c, 0x24271,
+    0x1e842, 0x22846, 0x2a072, 0x2a073, 0x1284c, 0x1684e, 0x2a075, 0x2a076, 0x2aa91, 0x16098, 0x142a6, 0x142a8, 0x2aa93, 0x23d65, 0x142a7, 0x11d59,
+    0x0ec7b, 0x2ec85, 0x2e0aa, 0x2e0ab, 0x2e09a, 0x2e09b, 0x2e0b0, 0x2e0b1, 0x20f85, 0x120c9, 0x203ab, 0x01eb9, 0x2039b, 0x21da1, 0x203b1, 0x01d7e,
+    0x2ec82, 0x2ec87, 0x220ac, 0x220ad, 0x2209c, 0x1f977, 0x220b2, 0x1df6c, 0x120ca, 0x120cb, 0x120d3, 0x05e87, 0x239a8, 0x1fd61, 0x21da5, 0x0df3b,
+    0x18f1e, 0x26a8b, 0x2cb56, 0x08294, 0x0ab27, 0x2428c, 0x26b60, 0x08295, 0x1ab21, 0x0828d, 0x2cb58, 0x08296, 0x26b29, 0x0828e, 0x26b62, 0x08297,
+    0x00e8b, 0x282bd, 0x022c4, 0x0e2c6, 0x242bc, 0x282be, 0x022c5, 0x0e2c7, 0x082bd, 0x022c2, 0x022c6, 0x022c8, 0x082be, 0x022c3, 0x022c7, 0x03d8e,
+    0x1ef56, 0x263c4, 0x1ef72, 0x263d1, 0x2c394, 0x0a3c6, 0x2c3a6, 0x0a3d2, 0x22f60, 0x263c5, 0x22b75, 0x11ea2, 0x2c395, 0x0a3c7, 0x2c3a7, 0x0de62,
+    0x02c94, 0x24cc6, 0x00dd1, 0x1bea9, 0x002d6, 0x0c2d7, 0x19acc, 0x05f95, 0x28fc6, 0x002d8, 0x1fea9, 0x19e64, 0x002d7, 0x03dbe, 0x11c95, 0x01e29,
+    0x1ab42, 0x26a91, 0x26372, 0x082a6, 0x0ab4c, 0x26a93, 0x26375, 0x082a7, 0x1ab46, 0x0a398, 0x26373, 0x082a8, 0x26b4e, 0x1bd65, 0x26376, 0x05d59,
+    0x0ec92, 0x28cc1, 0x022d1, 0x0e2d2, 0x219a3, 0x23966, 0x219a2, 0x1f962, 0x08fc1, 0x022d0, 0x022d2, 0x03ec1, 0x1b966, 0x19d52, 0x1b962, 0x19d22,
+    0x02f82, 0x063ca, 0x203ac, 0x063d3, 0x2039c, 0x219a8, 0x203b2, 0x23da5, 0x2cf87, 0x063cb, 0x203ad, 0x11e87, 0x1b977, 0x1bd61, 0x19c6c, 0x01c3b,
+    0x0ec9c, 0x0f9a8, 0x01aae, 0x01b73, 0x0199f, 0x1f95a, 0x01984, 0x11b43, 0x039a8, 0x0db98, 0x0d873, 0x19a46, 0x0595a, 0x19923, 0x05843, 0x19d0e,
+    0x0ca0a, 0x1081b, 0x0ea34, 0x14a41, 0x0ea1b, 0x14a20, 0x0ea3b, 0x14a45, 0x02a1f, 0x14a28, 0x02a43, 0x14a4d, 0x02a22, 0x28a2a, 0x02a47, 0x29f4f,
+    0x1e81f, 0x22822, 0x20857, 0x2e859, 0x12828, 0x1682a, 0x2a861, 0x29f63, 0x16a8c, 0x2888e, 0x28895, 0x25797, 0x16a8e, 0x1608f, 0x14299, 0x29f2a,
+    0x04d42, 0x1ac5e, 0x1896a, 0x1a86f, 0x2e092, 0x2e093, 0x2c8a5, 0x29774, 0x10991, 0x2a0c0, 0x109a5, 0x09e89, 0x160c1, 0x15799, 0x160cf, 0x03f47,
+    0x1ac58, 0x20c62, 0x20873, 0x0bf76, 0x2e096, 0x2e097, 0x2e0a8, 0x25f59, 0x2a0c6, 0x2a0c7, 0x2a0d2, 0x0be62, 0x160c8, 0x17f8e, 0x175c1, 0x03f22,
+    0x1ce34, 0x1283b, 0x28a6a, 0x2a86c, 0x12841, 0x16845, 0x28a6c, 0x2a06d, 0x24a57, 0x28a61, 0x24a73, 0x28277, 0x24a59, 0x2bd63, 0x28274, 0x15f45,
+    0x1e843, 0x22847, 0x2e873, 0x2a074, 0x1284d, 0x17d4f, 0x2a077, 0x17d45, 0x2aa95, 0x16099, 0x160a9, 0x25793, 0x2f597, 0x17d2a, 0x2f593, 0x17d20,
+    0x22c82, 0x22c87, 0x2e0ac, 0x2e0ad, 0x2e09c, 0x2b577, 0x2e0b2, 0x29f6c, 0x160ca, 0x160cb, 0x160d3, 0x09e87, 0x2f5a8, 0x2bd61, 0x2dda5, 0x0ff3b,
+    0x2ec84, 0x2ec89, 0x2e0ae, 0x0bf6f, 0x2e09d, 0x13d4d, 0x2f59c, 0x13d41, 0x120cc, 0x297c0, 0x2fed1, 0x0be5e, 0x2f596, 0x13d28, 0x2f592, 0x0ff1b,
+    0x18f42, 0x24292, 0x08b82, 0x2429c, 0x0ab5e, 0x24293, 0x08b87, 0x29777, 0x06b58, 0x24296, 0x08b84, 0x0829d, 0x0ab62, 0x24297, 0x08b89, 0x15f4d,
+    0x0ce91, 0x282c1, 0x142ca, 0x257a8, 0x282c0, 0x17599, 0x142cb, 0x29f61, 0x282c6, 0x282c8, 0x142cc, 0x25796, 0x282c7, 0x29d8e, 0x2b5c0, 0x15f28,
+    0x0cd72, 0x08cd1, 0x1cdac, 0x097ae, 0x2ebd1, 0x157a9, 0x175d3, 0x25f73, 0x1eba6, 0x157cc, 0x13eb2, 0x09e84, 0x2b5d2, 0x29d95, 0x11ca5, 0x03f43,
+    0x02ca6, 0x297d2, 0x04dd3, 0x0bf73, 0x135cc, 0x2bf95, 0x175ca, 0x25f57, 0x100da, 0x297c6, 0x1fea6, 0x07e58, 0x2b5c6, 0x15d8c, 0x11c91, 0x03f1f,
+    0x04e6a, 0x26aa5, 0x242ac, 0x242b2, 0x0aa6f, 0x2b574, 0x242ad, 0x2bd6c, 0x0aa73, 0x242a8, 0x082ae, 0x2579c, 0x21d76, 0x2fd59, 0x1bd6f, 0x15f41,
+    0x0cea5, 0x282cf, 0x142d3, 0x27fa5, 0x2f989, 0x23d47, 0x23987, 0x13d3b, 0x282d2, 0x297c1, 0x099d1, 0x25792, 0x21962, 0x23d22, 0x1b95e, 0x11d1b,
+    0x0ecac, 0x157d3, 0x1e0d9, 0x257ac, 0x2f5ae, 0x2fd73, 0x2f5ac, 0x2bd6a, 0x18fd3, 0x157ca, 0x13eac, 0x09e82, 0x21d73, 0x21d57, 0x19c6a, 0x01c34,
+    0x0ecb2, 0x0dba5, 0x01aac, 0x07f6a, 0x2f984, 0x1fd43, 0x23982, 0x13d34, 0x039a6, 0x0db91, 0x11a72, 0x19a42, 0x1b958, 0x1fd1f, 0x05842, 0x11d0a,
+    0x06f03, 0x16a18, 0x2632f, 0x28a38, 0x26a06, 0x2aa1a, 0x26331, 0x28a3a, 0x06b09, 0x2621e, 0x26330, 0x24a42, 0x26a0b, 0x2621f, 0x26332, 0x24a44,
+    0x2662f, 0x16a38, 0x06279, 0x1627b, 0x20631, 0x2aa3a, 0x0627a, 0x1627c, 0x06638, 0x20256, 0x0627b, 0x04282, 0x1a63a, 0x20257, 0x0627c, 0x04283,
+    0x16f18, 0x0638a, 0x16f38, 0x04290, 0x26725, 0x0428b, 0x1a75c, 0x04291, 0x2c71e, 0x0638b, 0x2ef42, 0x04292, 0x1a727, 0x0638c, 0x1a75e, 0x04293,
+    0x28f38, 0x18290, 0x1677b, 0x0429a, 0x0a75c, 0x18291, 0x04785, 0x0429b, 0x24756, 0x18294, 0x18782, 0x0429c, 0x06760, 0x18295, 0x18787, 0x01e77,
+    0x06e09, 0x2c21e, 0x06338, 0x24256, 0x20a0b, 0x2c21f, 0x0633a, 0x24257, 0x2620d, 0x26221, 0x06339, 0x0a258, 0x2620e, 0x26222, 0x0633b, 0x0a259,
+    0x26630, 0x2ea42, 0x1827b, 0x18282, 0x20632, 0x2ea44, 0x1827c, 0x18283, 0x06639, 0x20258, 0x0627d, 0x04284, 0x1a63b, 0x20259, 0x0627e, 0x11d71,
+    0x2671e, 0x0668b, 0x20756, 0x04294, 0x0a727, 0x1828c, 0x1a760, 0x04295, 0x26721, 0x0428d, 0x20758, 0x04296, 0x06729, 0x0428e, 0x1a762, 0x04297,
+    0x24f42, 0x18292, 0x04782, 0x1829c, 0x0a75e, 0x18293, 0x04787, 0x1db77, 0x0a758, 0x18296, 0x04784, 0x0429d, 0x06762, 0x18297, 0x04789, 0x11f4d,
+    0x26f06, 0x26225, 0x20331, 0x0a25c, 0x26210, 0x26226, 0x26336, 0x0a25d, 0x20f0b, 0x0a227, 0x20332, 0x0a25e, 0x0a211, 0x0a228, 0x26337, 0x0a25f,
+    0x26631, 0x1a25c, 0x0677a, 0x04285, 0x26636, 0x1a25d, 0x0627f, 0x04286, 0x0663a, 0x1a260, 0x1877c, 0x04287, 0x0663c, 0x1a261, 0x06280, 0x04288,
+    0x2af1a, 0x0478b, 0x2af3a, 0x18791, 0x26726, 0x0638d, 0x1a75d, 0x04298, 0x2c71f, 0x1a38c, 0x2ef44, 0x18793, 0x1a728, 0x0638e, 0x1a75f, 0x11c65,
+    0x28f3a, 0x04791, 0x1677c, 0x0479b, 0x0a75d, 0x18298, 0x04786, 0x0429e, 0x24757, 0x04795, 0x18783, 0x1de77, 0x06761, 0x18299, 0x18788, 0x11e48,
+    0x26f0b, 0x1a227, 0x1a33a, 0x06260, 0x1a211, 0x1a228, 0x0633c, 0x06261, 0x2670e, 0x06229, 0x1a33b, 0x06262, 0x06212, 0x0622a, 0x0633d, 0x06263,
+    0x26632, 0x1a25e, 0x0677c, 0x18287, 0x26637, 0x1a25f, 0x18280, 0x18288, 0x0663b, 0x1a262, 0x0677e, 0x04289, 0x0663d, 0x1a263, 0x06281, 0x05d3d,
+    0x2671f, 0x0668c, 0x20757, 0x18795, 0x0a728, 0x0668e, 0x1a761, 0x04299, 0x26722, 0x0478e, 0x20759, 0x18797, 0x0672a, 0x0638f, 0x1a763, 0x05c2a,
+    0x24f44, 0x04793, 0x04783, 0x01b77, 0x0a75f, 0x11965, 0x04788, 0x11b48, 0x0a759, 0x04797, 0x11871, 0x11a4d, 0x06763, 0x0592a, 0x0583d, 0x05c12,
+    0x00a06, 0x16a1a, 0x02a31, 0x14a3a, 0x00a16, 0x16a1c, 0x02a36, 0x28a3c, 0x08a1a, 0x24a21, 0x08a3a, 0x24a46, 0x08a1c, 0x24a23, 0x08a3c, 0x24a48,
+    0x1cc31, 0x16a3a, 0x0687a, 0x2a87c, 0x2ea36, 0x16a3c, 0x1627f, 0x16280, 0x2e25c, 0x2a260, 0x28285, 0x14287, 0x2e25d, 0x2a261, 0x28286, 0x14288,
+    0x00d25, 0x0688b, 0x18d5c, 0x06891, 0x002bb, 0x102bc, 0x002bf, 0x0c2c0, 0x1eb8b, 0x002bd, 0x12b91, 0x002c1, 0x002bc, 0x002be, 0x002c0, 0x0fc99,
+    0x00d5c, 0x1a891, 0x06d85, 0x0689b, 0x1c2bf, 0x102c0, 0x102c9, 0x07fa1, 0x1c2c4, 0x102c6, 0x0c2ca, 0x05ea8, 0x1c2c5, 0x102c7, 0x0c2cb, 0x01f61,
+    0x20a1a, 0x2ea21, 0x2425c, 0x28260, 0x20a1c, 0x2ea23, 0x2425d, 0x28261, 0x26a21, 0x24251, 0x24260, 0x24264, 0x26a23, 0x24252, 0x24261, 0x24265,
+    0x22a3a, 0x2ea46, 0x16285, 0x16287, 0x2ea3c, 0x2ea48, 0x16286, 0x16288, 0x2e260, 0x2e264, 0x162a0, 0x162a2, 0x2e261, 0x2e265, 0x162a1, 0x11f5f,
+    0x02e8b, 0x1c2bd, 0x002c4, 0x0c2c6, 0x182bc, 0x1c2be, 0x002c5, 0x0c2c7, 0x042bd, 0x002c2, 0x002c6, 0x002c8, 0x042be, 0x002c3, 0x002c7, 0x01d8e,
+    0x0ee91, 0x1c2c1, 0x102ca, 0x19ba8, 0x1c2c0, 0x1ff99, 0x102cb, 0x1df61, 0x1c2c6, 0x1c2c8, 0x102cc, 0x05e96, 0x1c2c7, 0x1dd8e, 0x03cc0, 0x11f28,
+    0x04f31, 0x2625c, 0x08b7a, 0x08285, 0x26a36, 0x2625d, 0x0827f, 0x08286, 0x0aa3a, 0x26260, 0x24b7c, 0x08287, 0x26a3c, 0x26261, 0x08280, 0x08288,
+    0x00e7a, 0x2e285, 0x002b5, 0x102b7, 0x2027f, 0x2e286, 0x002b6, 0x102b8, 0x20285, 0x202a0, 0x002b7, 0x002b9, 0x20286, 0x202a1, 0x002b8, 0x01c80,
+    0x10d5c, 0x042c4, 0x1ed85, 0x002ca, 0x042bf, 0x042c5, 0x002c9, 0x002cb, 0x1eb91, 0x042c6, 0x1eb9b, 0x11ea8, 0x042c0, 0x042c7, 0x1fca1, 0x0dc61,
+    0x02d85, 0x1c2ca, 0x24db7, 0x07faf, 0x182c9, 0x1c2cb, 0x002cd, 0x05f86, 0x182ca, 0x182cc, 0x1fcaf, 0x19e70, 0x182cb, 0x07cc0, 0x1dc86, 0x01e3c,
+    0x20a3a, 0x2c260, 0x26285, 0x082a0, 0x20a3c, 0x2c261, 0x26286, 0x082a1, 0x26a46, 0x26264, 0x0a287, 0x082a2, 0x26a48, 0x26265, 0x0a288, 0x01c5f,
+    0x2ce7c, 0x22287, 0x182b7, 0x1e2b9, 0x20280, 0x22288, 0x182b8, 0x11f80, 0x20287, 0x202a2, 0x062b9, 0x002ba, 0x20288, 0x1995f, 0x07c80, 0x01d37,
+    0x02e91, 0x182c6, 0x042ca, 0x002cc, 0x182c0, 0x182c7, 0x042cb, 0x0ffc0, 0x042c1, 0x042c8, 0x1d8a8, 0x11e96, 0x1bc99, 0x05d8e, 0x19c61, 0x01c28,
+    0x02e9b, 0x0dba8, 0x01aaf, 0x01b70, 0x019a1, 0x11961, 0x01986, 0x1db3c, 0x018a8, 0x0db96, 0x11870, 0x01a4b, 0x05961, 0x19928, 0x0583c, 0x01c11,
+    0x04b09, 0x0ea1e, 0x10930, 0x0ea42, 0x00a1a, 0x14a21, 0x02a3a, 0x14a46, 0x06b19, 0x02a27, 0x22f40, 0x02a4c, 0x0ab1f, 0x08a29, 0x08a44, 0x08a4e,
+    0x04c38, 0x1c856, 0x18d7b, 0x06882, 0x1285c, 0x16860, 0x28885, 0x28887, 0x28290, 0x28294, 0x2829a, 0x1429c, 0x28291, 0x28295, 0x2829b, 0x0fe77,
+    0x10d1e, 0x0498b, 0x12f42, 0x1ad92, 0x2eb8b, 0x263bd, 0x2eb91, 0x268c1, 0x22f27, 0x263bc, 0x22f4c, 0x17ea3, 0x2c38c, 0x263be, 0x2eb93, 0x15e66,
+    0x00d56, 0x06d94, 0x1ad82, 0x1ad9c, 0x2e7c4, 0x2c8c6, 0x1e7ca, 0x07ea8, 0x2a794, 0x280d6, 0x1679c, 0x07e9f, 0x227c6, 0x140d7, 0x17ea8, 0x01e5a,
+    0x04e33, 0x16a56, 0x26b68, 0x24272, 0x0ab3f, 0x28a58, 0x2636b, 0x24273, 0x06b39, 0x24a60, 0x26369, 0x24275, 0x0ab43, 0x24a62, 0x2636c, 0x24276,
+    0x10e68, 0x16a72, 0x282aa, 0x142ac, 0x12a6e, 0x16a75, 0x282ab, 0x142ad, 0x282a4, 0x282a6, 0x282b0, 0x142b2, 0x282a5, 0x282a7, 0x282b1, 0x0dd6c,
+    0x2af56, 0x063c4, 0x2e772, 0x063d1, 0x20394, 0x063c6, 0x203a6, 0x063d2, 0x2ef60, 0x063c5, 0x2e775, 0x17ea2, 0x20395, 0x063c7, 0x203a7, 0x0fe62,
+    0x0ed72, 0x04cd1, 0x167ac, 0x07eae, 0x2e7d1, 0x11ba9, 0x1e7d3, 0x19f73, 0x2a7a6, 0x11bcc, 0x167b2, 0x05e84, 0x227d2, 0x1dd95, 0x15ca5, 0x01f43,
+    0x1ef1a, 0x08b8b, 0x1ef3a, 0x24b91, 0x26b26, 0x2638d, 0x26b5d, 0x08298, 0x20b1f, 0x2638c, 0x22f44, 0x24b93, 0x26b28, 0x2638e, 0x26b5f, 0x15c65,
+    0x14d5c, 0x082c4, 0x16d85, 0x022ca, 0x082bf, 0x082c5, 0x022c9, 0x022cb, 0x2a791, 0x082c6, 0x1679b, 0x15ea8, 0x082c0, 0x082c7, 0x17ca1, 0x0fc61,
+    0x12f21, 0x203bd, 0x12f46, 0x20dc1, 0x2038d, 0x263c2, 0x22798, 0x263d0, 0x2ef29, 0x203be, 0x2ef4e, 0x13e66, 0x2038e, 0x263c3, 0x13c65, 0x11c52,
+    0x14d60, 0x26dc6, 0x2ad87, 0x1bea8, 0x2e7c5, 0x043d8, 0x1e7cb, 0x05f98, 0x2a795, 0x183d7, 0x13e77, 0x1de5a, 0x227c7, 0x07cbe, 0x13c61, 0x11e23,
+    0x1ab3f, 0x0a394, 0x2c36b, 0x0a3a6, 0x26b4b, 0x0a396, 0x26370, 0x0a3a8, 0x20b43, 0x0a395, 0x2c36c, 0x0a3a7, 0x26b4d, 0x0a397, 0x26371, 0x01c59,
+    0x14f6e, 0x082d1, 0x167ab, 0x022d3, 0x279ba, 0x1f9a2, 0x079b9, 0x1d987, 0x2a7a5, 0x082d2, 0x167b1, 0x17ca5, 0x07989, 0x19962, 0x07c7e, 0x05d3b,
+    0x2af58, 0x1a3c6, 0x2e773, 0x1a3d2, 0x20396, 0x063c8, 0x203a8, 0x079c1, 0x2ef62, 0x1a3c7, 0x2e776, 0x13e62, 0x20397, 0x07c8e, 0x1dc59, 0x11c22,
+    0x14f75, 0x0dba9, 0x167ad, 0x05a73, 0x019a2, 0x11964, 0x01987, 0x11b46, 0x2a7a7, 0x01895, 0x1186c, 0x1da43, 0x05962, 0x05929, 0x1983b, 0x11c0e,
+    0x00a0b, 0x0c81f, 0x00932, 0x0ea44, 0x00a1c, 0x14a23, 0x02a3c, 0x14a48, 0x00b1f, 0x02a29, 0x02a44, 0x02a4e, 0x02a23, 0x02a2b, 0x02a48, 0x03e50,
+    0x18c3a, 0x1c857, 0x0687c, 0x06883, 0x1285d, 0x16861, 0x28886, 0x25f88, 0x14891, 0x14895, 0x2889b, 0x25e77, 0x28298, 0x28299, 0x2829e, 0x03e48,
+    0x18d27, 0x0498c, 0x18d5e, 0x06893, 0x12bbc, 0x268be, 0x16bc0, 0x25699, 0x12b8c, 0x009be, 0x12b93, 0x25e66, 0x16bbe, 0x280d5, 0x29699, 0x03e2b,
+    0x04d60, 0x1a895, 0x1ad87, 0x0be77, 0x208c5, 0x2ffc7, 0x256cb, 0x0bf61, 0x1edc6, 0x280d7, 0x2bea8, 0x25e5a, 0x280d8, 0x17fbe, 0x29698, 0x03e23,
+    0x18e3f, 0x16a58, 0x24a6e, 0x28a75, 0x24a54, 0x16a5a, 0x24a70, 0x28a77, 0x0aa58, 0x24a64, 0x24a75, 0x24278, 0x24a5a, 0x24a66, 0x24a77, 0x03e4e,
+    0x10c6b, 0x12873, 0x168ab, 0x27fad, 0x12a70, 0x16a77, 0x282af, 0x25f83, 0x2aaa6, 0x282a9, 0x282b3, 0x25e75, 0x2aaa8, 0x13f93, 0x29c9b, 0x03e44,
+    0x00c94, 0x18cc6, 0x02dd1, 0x256a9, 0x022d6, 0x0e2d7, 0x256cc, 0x09f95, 0x1cfc6, 0x022d8, 0x296a9, 0x25e64, 0x022d7, 0x01dbe, 0x15c95, 0x03e29,
+    0x00ca6, 0x18cd2, 0x256d3, 0x07f73, 0x139cc, 0x1ff95, 0x256ca, 0x07f57, 0x140da, 0x1dbc6, 0x2bea6, 0x0be58, 0x1f9c6, 0x11d8c, 0x15c91, 0x01f1f,
+    0x1cf3a, 0x08b91, 0x10b7c, 0x08b9b, 0x0ab5d, 0x24298, 0x08b86, 0x0829e, 0x06b57, 0x08b95, 0x24b83, 0x29e77, 0x0ab61, 0x24299, 0x29c88, 0x15e48,
+    0x00d85, 0x282ca, 0x18db7, 0x096af, 0x242c9, 0x282cb, 0x022cd, 0x09f86, 0x242ca, 0x242cc, 0x296af, 0x25e70, 0x242cb, 0x0bcc0, 0x29c86, 0x03e3c,
+    0x10d60, 0x1adc6, 0x1ed87, 0x27ea8, 0x2ebc5, 0x083d8, 0x296cb, 0x25698, 0x1eb95, 0x243d7, 0x17e77, 0x17e5a, 0x2dcc7, 0x27cbe, 0x17c61, 0x15e23,
+    0x00da0, 0x0adcc, 0x20db9, 0x0be70, 0x002db, 0x2ffc5, 0x256c9, 0x0bf5d, 0x12dcc, 0x036d6, 0x13e70, 0x25e54, 0x21cc5, 0x0bcbc, 0x13c5d, 0x01e1c,
+    0x04f6b, 0x26aa6, 0x26bab, 0x082b3, 0x0aa70, 0x26aa8, 0x082af, 0x09f9b, 0x06b73, 0x242a9, 0x2bcad, 0x29e75, 0x0aa77, 0x07c93, 0x07c83, 0x0fe44,
+    0x00eab, 0x282d3, 0x022d4, 0x27fab, 0x219b9, 0x1f987, 0x199b7, 0x11f7c, 0x242d3, 0x039d1, 0x17cab, 0x25e6e, 0x1b987, 0x1995e, 0x07c7c, 0x01d32,
+    0x0cfa6, 0x083da, 0x296d3, 0x27ea6, 0x0b9cc, 0x1b9c6, 0x296ca, 0x09f91, 0x1cfd2, 0x198c6, 0x13c73, 0x17e58, 0x1bc95, 0x07c8c, 0x1dc57, 0x0dc1f,
+    0x02db3, 0x0dba6, 0x01aab, 0x07e6b, 0x019a0, 0x11960, 0x01985, 0x1db3a, 0x018a6, 0x0db94, 0x13e6b, 0x19a3f, 0x05960, 0x19927, 0x1983a, 0x01e0b,
+    0x06a04, 0x16a19, 0x02a30, 0x28a39, 0x26a07, 0x2aa1b, 0x08a32, 0x28a3b, 0x0aa0a, 0x24a1f, 0x26334, 0x24a43, 0x26a0c, 0x26220, 0x26335, 0x24a45,
+    0x22a30, 0x16a39, 0x2a27b, 0x1627d, 0x2ea32, 0x2aa3b, 0x2a27c, 0x1627e, 0x20642, 0x2e258, 0x06282, 0x28284, 0x20644, 0x2e259, 0x06283, 0x03d71,
+    0x2673e, 0x06390, 0x22b68, 0x063a4, 0x2674a, 0x06392, 0x1a36e, 0x042a5, 0x2c742, 0x06391, 0x2036a, 0x063a5, 0x1a74c, 0x06393, 0x1a36f, 0x03c74,
+    0x02e68, 0x182a4, 0x042aa, 0x042b0, 0x0a66e, 0x182a5, 0x042ab, 0x042b1, 0x06672, 0x182a6, 0x042ac, 0x042b2, 0x06675, 0x182a7, 0x042ad, 0x03d6c,
+    0x1ae0a, 0x2ea1f, 0x0a342, 0x24258, 0x20a0c, 0x2c220, 0x0a344, 0x24259, 0x26a0e, 0x26223, 0x0a343, 0x2425a, 0x2620f, 0x26224, 0x0a345, 0x2425b,
+    0x2c634, 0x2ea43, 0x1a282, 0x16284, 0x20635, 0x2ea45, 0x1a283, 0x23d71, 0x20643, 0x2025a, 0x06284, 0x0629f, 0x20645, 0x2025b, 0x27d71, 0x03d55,
+    0x26742, 0x1a691, 0x1a372, 0x042a6, 0x0a74c, 0x1a693, 0x1a375, 0x042a7, 0x26746, 0x06398, 0x1a373, 0x042a8, 0x0674e, 0x27d65, 0x1a376, 0x09d59,
+    0x0a66a, 0x1a6a5, 0x182ac, 0x182b2, 0x0a66f, 0x23d74, 0x182ad, 0x1fd6c, 0x06673, 0x182a8, 0x042ae, 0x05e9c, 0x06676, 0x23d59, 0x27d6f, 0x11f41,
+    0x06f0b, 0x26227, 0x2633a, 0x0a260, 0x26211, 0x26228, 0x2633c, 0x0a261, 0x1ab0e, 0x26229, 0x2633b, 0x0a262, 0x26212, 0x2622a, 0x2633d, 0x0a263,
+    0x2c63a, 0x20260, 0x06285, 0x062a0, 0x2063c, 0x20261, 0x06286, 0x062a1, 0x1a646, 0x1a264, 0x06287, 0x062a2, 0x1a648, 0x1a265, 0x06288, 0x03c5f,
+    0x2673f, 0x06394, 0x2036b, 0x063a6, 0x2674b, 0x06396, 0x1a370, 0x063a8, 0x2c743, 0x06395, 0x2036c, 0x063a7, 0x1a74d, 0x06397, 0x1a371, 0x03c59,
+    0x0a66b, 0x1a6a6, 0x067ab, 0x042b3, 0x0a670, 0x1a6a8, 0x042af, 0x05f9b, 0x0a773, 0x182a9, 0x1a7ad, 0x1de75, 0x06677, 0x0bc93, 0x0bc83, 0x0de44,
+    0x0ae0e, 0x20229, 0x0a346, 0x0a264, 0x20212, 0x2022a, 0x0a348, 0x0a265, 0x26213, 0x2622b, 0x0a347, 0x0a266, 0x26214, 0x2622c, 0x0a349, 0x0bd24,
+    0x2c63b, 0x20262, 0x1a287, 0x182a2, 0x2063d, 0x20263, 0x1a288, 0x2395f, 0x1a647, 0x1a266, 0x06289, 0x062a3, 0x1a649, 0x1bd24, 0x07d3d, 0x07d1d,
+    0x26743, 0x1a695, 0x20773, 0x063a9, 0x0a74d, 0x1a697, 0x1a377, 0x21993, 0x26747, 0x06399, 0x1a374, 0x1d893, 0x0674f, 0x07d2a, 0x07d45, 0x05c20,
+    0x0a66c, 0x1a6a7, 0x067ad, 0x01b75, 0x0a671, 0x1f959, 0x01983, 0x11b44, 0x06674, 0x01893, 0x1186f, 0x11a4c, 0x1bd45, 0x1bd20, 0x07d35, 0x05d0c,
+    0x00a07, 0x16a1b, 0x02a32, 0x14a3b, 0x00a17, 0x16a1d, 0x02a37, 0x28a3d, 0x08a1b, 0x24a22, 0x08a3b, 0x24a47, 0x08a1d, 0x24a24, 0x08a3d, 0x25d49,
+    0x1ea32, 0x16a3b, 0x1687c, 0x1687e, 0x2ea37, 0x16a3d, 0x2a280, 0x16281, 0x2e25e, 0x2a262, 0x28287, 0x28289, 0x2e25f, 0x2a263, 0x28288, 0x29d3d,
+    0x00d4a, 0x18c92, 0x1896e, 0x068a5, 0x015ce, 0x175a3, 0x035ba, 0x29589, 0x1cf92, 0x009c1, 0x12ba5, 0x002cf, 0x095a3, 0x25566, 0x09589, 0x25d47,
+    0x00c6e, 0x1a8a5, 0x068ab, 0x07fb1, 0x2f5ba, 0x17589, 0x175b9, 0x17f7e, 0x1c2d1, 0x102d2, 0x0c2d3, 0x07fa5, 0x255a2, 0x29562, 0x25587, 0x15d3b,
+    0x20a1b, 0x2ea22, 0x2425e, 0x28262, 0x20a1d, 0x2ea24, 0x2425f, 0x28263, 0x26a22, 0x24a52, 0x24262, 0x24266, 0x26a24, 0x24253, 0x24263, 0x25d24,
+    0x22a3b, 0x2ea47, 0x2a287, 0x16289, 0x2ea3d, 0x2fd49, 0x2a288, 0x17d3d, 0x2e262, 0x2e266, 0x2a2a2, 0x162a3, 0x2e263, 0x2fd24, 0x2755f, 0x17d1d,
+    0x0cc92, 0x1ccc1, 0x002d1, 0x0c2d2, 0x215a3, 0x2f566, 0x2d5a2, 0x2b562, 0x04fc1, 0x002d0, 0x002d2, 0x01ec1, 0x27566, 0x25d52, 0x27562, 0x25d22,
+    0x0eea5, 0x1c2cf, 0x102d3, 0x1bfa5, 0x2f589, 0x2fd47, 0x2f587, 0x17d3b, 0x1c2d2, 0x1dbc1, 0x055d1, 0x05e92, 0x2d562, 0x2fd22, 0x2755e, 0x17d1b,
+    0x06a32, 0x2625e, 0x08b7c, 0x24287, 0x26a37, 0x2625f, 0x24280, 0x24288, 0x0aa3b, 0x26262, 0x08b7e, 0x08289, 0x26a3d, 0x26263, 0x08281, 0x09d3d,
+    0x20e7c, 0x2e287, 0x242b7, 0x162b9, 0x2c280, 0x2e288, 0x242b8, 0x2b580, 0x2c287, 0x2c2a2, 0x082b9, 0x022ba, 0x2c288, 0x2555f, 0x25580, 0x03d37,
+    0x10f6e, 0x042d1, 0x1ebab, 0x002d3, 0x275ba, 0x2b5a2, 0x095b9, 0x29587, 0x1eba5, 0x042d2, 0x1fcb1, 0x13ca5, 0x27589, 0x25562, 0x09c7e, 0x09d3b,
+    0x02eab, 0x1c2d3, 0x002d4, 0x07fab, 0x215b9, 0x2b587, 0x255b7, 0x17f7c, 0x182d3, 0x015d1, 0x1fcab, 0x19e6e, 0x27587, 0x2555e, 0x09c7c, 0x03d32,
+    0x20a3b, 0x2c262, 0x26287, 0x242a2, 0x20a3d, 0x2c263, 0x26288, 0x2f55f, 0x26a47, 0x26266, 0x26289, 0x082a3, 0x27d49, 0x27d24, 0x27d3d, 0x09d1d,
+    0x20e7e, 0x2e289, 0x202b9, 0x2e2ba, 0x20281, 0x2fd3d, 0x2d580, 0x2fd37, 0x20289, 0x202a3, 0x262ba, 0x002ce, 0x21d3d, 0x21d1d, 0x27d37, 0x01d17,
+    0x02ea5, 0x182d2, 0x042d3, 0x1d5d1, 0x21589, 0x2f562, 0x2d587, 0x2f55e, 0x042cf, 0x058c1, 0x1fca5, 0x11e92, 0x27d47, 0x27d22, 0x0bd3b, 0x09d1b,
+    0x02eb1, 0x0f9a5, 0x039ab, 0x01b6e, 0x2197e, 0x23d3b, 0x2197c, 0x1fd32, 0x039a5, 0x0db92, 0x1186e, 0x01a4a, 0x21d3b, 0x21d1b, 0x07d32, 0x01d07,
+    0x00a0a, 0x0ea1f, 0x02a34, 0x0ea43, 0x00a1b, 0x14a22, 0x02a3b, 0x14a47, 0x06b1b, 0x02a28, 0x02a41, 0x02a4d, 0x08a20, 0x08a2a, 0x08a45, 0x09c4f,
+    0x1cc42, 0x12858, 0x04882, 0x28884, 0x1285e, 0x16862, 0x14887, 0x28889, 0x28292, 0x28296, 0x2829c, 0x2829d, 0x28293, 0x28297, 0x25477, 0x03c4d,
+    0x10d42, 0x04991, 0x1eb6a, 0x049a5, 0x2c392, 0x263c1, 0x2eba5, 0x263cf, 0x22f5e, 0x263c0, 0x22b6f, 0x29e89, 0x2c393, 0x09499, 0x25474, 0x15c47,
+    0x04c72, 0x1a8a6, 0x18dac, 0x07eb2, 0x208d1, 0x275d2, 0x0b5d3, 0x05fa5, 0x28fd1, 0x034cc, 0x294ae, 0x29e84, 0x0b5a9, 0x25d95, 0x29c73, 0x0fc43,
+    0x18e34, 0x16a57, 0x24a6a, 0x28a73, 0x0ab41, 0x28a59, 0x24a6c, 0x24274, 0x06b3b, 0x24a61, 0x26b6c, 0x24277, 0x0ab45, 0x27d63, 0x2636d, 0x09c45,
+    0x10e6a, 0x16a73, 0x282ac, 0x282ae, 0x12a6f, 0x23d76, 0x282ad, 0x23d6f, 0x2aaa5, 0x282a8, 0x282b2, 0x2949c, 0x27574, 0x2dd59, 0x27d6c, 0x03c41,
+    0x00f82, 0x0a3ca, 0x2c3ac, 0x0a3d3, 0x2c39c, 0x2d5a8, 0x2c3b2, 0x2fda5, 0x20f87, 0x0a3cb, 0x2c3ad, 0x15e87, 0x27577, 0x27d61, 0x25c6c, 0x03c3b,
+    0x0ccac, 0x1ccd3, 0x2a0d9, 0x07eac, 0x215ae, 0x23d73, 0x2d5ac, 0x1fd6a, 0x094d3, 0x094ca, 0x294ac, 0x05e82, 0x2dd73, 0x2dd57, 0x25c6a, 0x03c34,
+    0x1ab1f, 0x0aa8c, 0x2cb57, 0x24b95, 0x0ab28, 0x26a8e, 0x26b61, 0x08299, 0x1ab22, 0x08b8e, 0x2cb59, 0x29497, 0x26b2a, 0x2638f, 0x25c63, 0x09c2a,
+    0x00e91, 0x242c6, 0x082ca, 0x022cc, 0x242c0, 0x242c7, 0x082cb, 0x275c0, 0x082c1, 0x082c8, 0x294a8, 0x29496, 0x0b599, 0x09d8e, 0x25c61, 0x03c28,
+    0x1ef58, 0x263c6, 0x22b73, 0x263d2, 0x2c396, 0x263c8, 0x2c3a8, 0x275c1, 0x22f62, 0x263c7, 0x17c76, 0x17e62, 0x2c397, 0x27c8e, 0x29c59, 0x15c22,
+    0x0efa6, 0x043da, 0x10dd3, 0x1bea6, 0x0b5cc, 0x275c6, 0x0b5ca, 0x05f91, 0x254d2, 0x254c6, 0x17c73, 0x13e58, 0x27c95, 0x0bc8c, 0x17c57, 0x0fc1f,
+    0x1ab43, 0x26a95, 0x2cb73, 0x0a3a9, 0x0ab4d, 0x2d597, 0x26377, 0x2d593, 0x1ab47, 0x0a399, 0x26374, 0x29493, 0x27d4f, 0x27d2a, 0x0bd45, 0x09c20,
+    0x00ea5, 0x242d2, 0x082d3, 0x299d1, 0x21989, 0x23962, 0x21987, 0x2395e, 0x082cf, 0x094c1, 0x2bca5, 0x29492, 0x1bd47, 0x1bd22, 0x07d3b, 0x07d1b,
+    0x20f84, 0x0a3cc, 0x203ae, 0x21ed1, 0x2039d, 0x2d596, 0x2d59c, 0x2d592, 0x20f89, 0x254c0, 0x13c6f, 0x13e5e, 0x0bd4d, 0x0bd28, 0x0bd41, 0x01c1b,
+    0x02fb2, 0x0f9a6, 0x0daac, 0x05a72, 0x21984, 0x1f958, 0x01982, 0x11b42, 0x018a5, 0x01891, 0x13c6a, 0x1da42, 0x1bd43, 0x1bd1f, 0x07d34, 0x01c0a,
+    0x00a0c, 0x0ea20, 0x02a35, 0x0ea45, 0x00a1d, 0x14a24, 0x02a3d, 0x15749, 0x02a20, 0x02a2a, 0x02a45, 0x0364f, 0x02a24, 0x0352c, 0x03449, 0x03514,
+    0x1cc44, 0x12859, 0x04883, 0x03771, 0x1285f, 0x15563, 0x0f588, 0x2973d, 0x14893, 0x0f797, 0x0f477, 0x0364d, 0x03565, 0x2952a, 0x03448, 0x29512,
+    0x18d4c, 0x04993, 0x1896f, 0x09674, 0x015a3, 0x15566, 0x03589, 0x15747, 0x10993, 0x0f799, 0x15674, 0x25647, 0x03566, 0x0352b, 0x03447, 0x03513,
+    0x04c75, 0x0f7a7, 0x036ad, 0x0976c, 0x0f5a2, 0x15562, 0x0f587, 0x2973b, 0x015a9, 0x0f795, 0x15673, 0x25643, 0x03564, 0x29529, 0x03446, 0x03f0e,
+    0x18e41, 0x16a59, 0x24a6f, 0x03776, 0x24a55, 0x2b55b, 0x24a71, 0x15745, 0x0aa59, 0x24a65, 0x0f476, 0x0364e, 0x0955b, 0x25524, 0x09445, 0x2550f,
+    0x12a6c, 0x16a74, 0x0d5ad, 0x0376f, 0x12a71, 0x2bd45, 0x2f583, 0x29735, 0x015a7, 0x0f793, 0x0f475, 0x0364c, 0x27559, 0x29520, 0x09444, 0x29d0c,
+    0x0cc9c, 0x0d5a8, 0x036ae, 0x03773, 0x0159f, 0x2b55a, 0x03584, 0x15743, 0x015a8, 0x0f798, 0x0f473, 0x25646, 0x0955a, 0x25523, 0x09443, 0x25d0e,
+    0x0d5b2, 0x0f7a5, 0x036ac, 0x0976a, 0x2f584, 0x2bd43, 0x2f582, 0x29734, 0x015a6, 0x0f791, 0x15672, 0x25642, 0x27558, 0x2bd1f, 0x09442, 0x15d0a,
+    0x18f44, 0x08b93, 0x08b83, 0x03777, 0x0ab5f, 0x15565, 0x03588, 0x15748, 0x06b59, 0x03497, 0x15471, 0x1564d, 0x09563, 0x0952a, 0x0943d, 0x09512,
+    0x00e9b, 0x0f7a8, 0x036af, 0x03770, 0x015a1, 0x15561, 0x03586, 0x2973c, 0x034a8, 0x0f796, 0x15470, 0x0364b, 0x09561, 0x25528, 0x0943c, 0x25511,
+    0x10f75, 0x0f7a9, 0x0f6ad, 0x09673, 0x015a2, 0x15564, 0x03587, 0x15746, 0x034a7, 0x03495, 0x1546c, 0x29643, 0x09562, 0x09529, 0x2543b, 0x15c0e,
+    0x015b3, 0x0f7a6, 0x036ab, 0x0976b, 0x015a0, 0x15560, 0x03585, 0x2973a, 0x034a6, 0x0f794, 0x1546b, 0x2563f, 0x09560, 0x25527, 0x2543a, 0x03e0b,
+    0x06a6c, 0x0d5a7, 0x015ad, 0x03775, 0x0aa71, 0x2b559, 0x03583, 0x15744, 0x0aa74, 0x03493, 0x1546f, 0x1564c, 0x27d45, 0x25520, 0x09435, 0x09d0c,
+    0x015b1, 0x0d5a5, 0x015ab, 0x0376e, 0x2157e, 0x2fd3b, 0x2d57c, 0x17d32, 0x015a5, 0x0f792, 0x1546e, 0x0364a, 0x2dd3b, 0x2dd1b, 0x27d32, 0x03d07,
+    0x015b2, 0x0d5a6, 0x0f6ac, 0x09672, 0x21584, 0x2b558, 0x03582, 0x15742, 0x034a5, 0x03491, 0x1546a, 0x29642, 0x27d43, 0x27d1f, 0x25434, 0x03c0a,
+    0x015b0, 0x0f7a4, 0x036aa, 0x0bf68, 0x2157d, 0x2fd39, 0x2d57b, 0x13d30, 0x015a4, 0x0f790, 0x13c68, 0x2563e, 0x21d39, 0x21d19, 0x0bd30, 0x01d04,
+    0x10c02, 0x2ec09, 0x26c2e, 0x2e033, 0x2ee09, 0x1260d, 0x2e038, 0x2e039, 0x26e2e, 0x2e238, 0x12067, 0x12068, 0x2e233, 0x2e239, 0x12268, 0x12069,
+    0x16c04, 0x2a40a, 0x26c30, 0x22034, 0x1660b, 0x1240e, 0x2203a, 0x2203b, 0x2223e, 0x1e242, 0x10468, 0x1206a, 0x2223f, 0x1e243, 0x1206b, 0x1206c,
+    0x08c09, 0x2a41a, 0x08533, 0x26c3f, 0x1461e, 0x12421, 0x1e456, 0x1e458, 0x08738, 0x1065c, 0x14568, 0x1046e, 0x02656, 0x10660, 0x0c672, 0x10475,
+    0x2840a, 0x2a41b, 0x08534, 0x26c41, 0x1641f, 0x12422, 0x1e457, 0x1e459, 0x02742, 0x1065e, 0x0e56a, 0x1046f, 0x0c658, 0x10662, 0x10473, 0x10476,
+    0x16e04, 0x1640b, 0x2203e, 0x2203f, 0x2a60a, 0x1260e, 0x1e042, 0x1e043, 0x26e30, 0x2223a, 0x10668, 0x1226b, 0x22234, 0x2223b, 0x1226a, 0x1226c,
+    0x16605, 0x1640c, 0x22040, 0x22041, 0x1660c, 0x1260f, 0x1e044, 0x1e045, 0x22240, 0x1e244, 0x10669, 0x1046c, 0x22241, 0x1e245, 0x1066c, 0x1206d,
+    0x2840b, 0x1641c, 0x0253f, 0x02454, 0x1461f, 0x12423, 0x10458, 0x1e45a, 0x0873a, 0x1065d, 0x0e76b, 0x10470, 0x02657, 0x10661, 0x0c673, 0x10477,
+    0x2840c, 0x1641d, 0x02541, 0x02455, 0x14620, 0x12424, 0x10459, 0x1e45b, 0x02744, 0x1065f, 0x0c46c, 0x10471, 0x0c659, 0x10663, 0x0c674, 0x1df45,
+    0x08e09, 0x1661e, 0x08538, 0x02456, 0x2a61a, 0x12621, 0x1045c, 0x10460, 0x08733, 0x1e656, 0x14768, 0x10672, 0x26e3f, 0x1e658, 0x1066e, 0x10675,
+    0x2860b, 0x1441f, 0x0853a, 0x02457, 0x1661c, 0x12623, 0x1045d, 0x10461, 0x0273f, 0x10658, 0x0c66b, 0x0c473, 0x02654, 0x1e65a, 0x10670, 0x10677,
+    0x1460d, 0x14421, 0x08539, 0x02458, 0x14621, 0x10651, 0x0c460, 0x10464, 0x08739, 0x0c660, 0x14769, 0x0c475, 0x02658, 0x10664, 0x0c675, 0x10678,
+    0x1440e, 0x14422, 0x0853b, 0x02459, 0x14623, 0x10452, 0x0c461, 0x10465, 0x02743, 0x0c662, 0x0e56c, 0x0c476, 0x0265a, 0x10666, 0x0c677, 0x05e4e,
+    0x2860a, 0x1661f, 0x02542, 0x0c458, 0x2a61b, 0x12622, 0x1045e, 0x10462, 0x08734, 0x1e657, 0x0c66a, 0x10673, 0x26e41, 0x1e659, 0x1066f, 0x10676,
+    0x2860c, 0x16620, 0x02544, 0x0c459, 0x1661d, 0x12624, 0x1045f, 0x10463, 0x02741, 0x10659, 0x0c66c, 0x10674, 0x02655, 0x1e65b, 0x10671, 0x1dd45,
+    0x1460e, 0x14423, 0x02543, 0x0245a, 0x14622, 0x10652, 0x0c462, 0x10466, 0x0873b, 0x0c661, 0x0e76c, 0x0c477, 0x02659, 0x10665, 0x0c676, 0x05c4e,
+    0x1460f, 0x14424, 0x02545, 0x0245b, 0x14624, 0x10653, 0x0c463, 0x11b24, 0x02745, 0x0c663, 0x0c66d, 0x01a45, 0x0265b, 0x11924, 0x01845, 0x11b0f,
+    0x1ec04, 0x22c0a, 0x1ac30, 0x2e034, 0x1ea0b, 0x1280e, 0x2e03a, 0x2e03b, 0x2e23e, 0x2a242, 0x14868, 0x1606a, 0x2e23f, 0x2a243, 0x1606b, 0x1606c,
+    0x2ec07, 0x2ec0c, 0x20c32, 0x2e035, 0x2e411, 0x2e412, 0x2e03c, 0x2e03d, 0x2e24a, 0x1224c, 0x1206e, 0x1206f, 0x2e24b, 0x1224d, 0x12070, 0x12071,
+    0x08c19, 0x2cc1f, 0x26c39, 0x2cc43, 0x2e427, 0x2e429, 0x22460, 0x22462, 0x1e090, 0x1e091, 0x1e0a4, 0x1e0a5, 0x1e094, 0x1e095, 0x1e0a6, 0x1e0a7,
+    0x24c1b, 0x2e420, 0x26c3b, 0x2cc45, 0x2e428, 0x2e42a, 0x22461, 0x22463, 0x1e092, 0x1e093, 0x1c4a5, 0x1bf74, 0x1e096, 0x1e097, 0x1e0a8, 0x1bf59,
+    0x16c0a, 0x2ec0e, 0x22042, 0x22043, 0x22e0e, 0x2e413, 0x22046, 0x22047, 0x2e242, 0x2e246, 0x12072, 0x12073, 0x2e243, 0x2e247, 0x16273, 0x12074,
+    0x16c0c, 0x2e40f, 0x22044, 0x22045, 0x16412, 0x2e414, 0x22048, 0x22049, 0x2224c, 0x1e24e, 0x12075, 0x12076, 0x2224d, 0x1e24f, 0x12077, 0x1fb45,
+    0x28c1f, 0x2e423, 0x2c458, 0x2c45a, 0x16429, 0x2e42b, 0x22464, 0x22466, 0x12691, 0x1e098, 0x1c4a6, 0x1c4a8, 0x12695, 0x1e099, 0x1e0a9, 0x0dd93,
+    0x2a420, 0x2e424, 0x2c459, 0x2c45b, 0x1642a, 0x2e42c, 0x22465, 0x23b24, 0x12693, 0x2fb65, 0x1c4a7, 0x21b59, 0x12697, 0x1fb2a, 0x17993, 0x1df20,
+    0x14c30, 0x16642, 0x2447b, 0x26482, 0x2a63a, 0x12646, 0x1e485, 0x1e487, 0x1ae68, 0x22272, 0x1e2aa, 0x122ac, 0x2266b, 0x22273, 0x1e2ab, 0x122ad,
+    0x28c32, 0x16644, 0x2447c, 0x26483, 0x1663c, 0x12648, 0x1e486, 0x1e488, 0x2266e, 0x1e675, 0x1c4ab, 0x1c4ad, 0x22670, 0x1e677, 0x1e2af, 0x23f83,
+    0x08c39, 0x28458, 0x0847d, 0x26484, 0x16460, 0x12464, 0x1e4a0, 0x1e4a2, 0x126a4, 0x104a6, 0x1c4b0, 0x1c4b2, 0x126a6, 0x126a9, 0x1c4b3, 0x0de75,
+    0x24c3b, 0x28459, 0x0847e, 0x1bb71, 0x16461, 0x12465, 0x1e4a1, 0x1bf5f, 0x104a5, 0x104a7, 0x1c4b1, 0x1bb6c, 0x126a8, 0x23f93, 0x1da9b, 0x05e44,
+    0x2a634, 0x16643, 0x24482, 0x1e484, 0x2a63b, 0x12647, 0x12487, 0x1e489, 0x2266a, 0x1e673, 0x1e2ac, 0x1e2ae, 0x2266c, 0x22274, 0x1e2ad, 0x01d6f,
+    0x16635, 0x16645, 0x24483, 0x2fb71, 0x1663d, 0x12649, 0x12488, 0x1fb3d, 0x2266f, 0x1e676, 0x104ad, 0x2fb6f, 0x22671, 0x13b45, 0x19983, 0x1dd35,
+    0x28c43, 0x1645a, 0x08484, 0x0849f, 0x16462, 0x12466, 0x104a2, 0x1e4a3, 0x126a5, 0x104a8, 0x104b2, 0x1de9c, 0x126a7, 0x19d93, 0x19875, 0x01c4c,
+    0x28c45, 0x1645b, 0x15b71, 0x01b55, 0x16463, 0x13b24, 0x1595f, 0x1fb1d, 0x15b74, 0x15b59, 0x0fb6c, 0x01a41, 0x0f959, 0x13b20, 0x01844, 0x1db0c,
+    0x04c09, 0x1e81a, 0x06c33, 0x1ac3f, 0x10a1e, 0x12821, 0x2a856, 0x2a858, 0x04b38, 0x14a5c, 0x10968, 0x1486e, 0x00a56, 0x14a60, 0x0ea72, 0x14875,
+    0x06c19, 0x20c1f, 0x06c39, 0x20c43, 0x22827, 0x2e829, 0x2e860, 0x2e862, 0x2a090, 0x2a091, 0x2a0a4, 0x2a0a5, 0x2a094, 0x2a095, 0x2a0a6, 0x2a0a7,
+    0x00d1a, 0x26c26, 0x0ac3f, 0x26c4b, 0x2ec8b, 0x2048d, 0x20494, 0x20496, 0x12f5c, 0x2e0bf, 0x12d6e, 0x27eba, 0x2e0c4, 0x2e0c5, 0x2e0d1, 0x01ea2,
+    0x0ac1f, 0x26c28, 0x0ac43, 0x26c4d, 0x2c48c, 0x2048e, 0x20495, 0x20497, 0x28591, 0x220c0, 0x285a5, 0x07e89, 0x220c6, 0x220c7, 0x220d2, 0x05e62,
+    0x10e30, 0x1e83a, 0x26c68, 0x2c46b, 0x12842, 0x12846, 0x2e072, 0x2e073, 0x06f7b, 0x16a85, 0x160aa, 0x160ab, 0x1aa82, 0x2aa87, 0x160ac, 0x160ad,
+    0x02d40, 0x22844, 0x26469, 0x2c46c, 0x2284c, 0x2e84e, 0x2e075, 0x2e076, 0x1609a, 0x1609b, 0x160b0, 0x160b1, 0x1609c, 0x13977, 0x160b2, 0x11f6c,
+    0x02d3a, 0x26c5d, 0x2646b, 0x26470, 0x2ec91, 0x22098, 0x204a6, 0x204a8, 0x28f85, 0x220c9, 0x285ab, 0x07eb9, 0x1e0ca, 0x1e0cb, 0x1e0d3, 0x01e87,
+    0x08d44, 0x26c5f, 0x2646c, 0x26471, 0x2ec93, 0x13b65, 0x204a7, 0x1db59, 0x2859b, 0x17ba1, 0x285b1, 0x07b7e, 0x179a8, 0x13b61, 0x15ba5, 0x19f3b,
+    0x0ed1e, 0x08c8b, 0x16d56, 0x0a494, 0x04e8b, 0x204bd, 0x064c4, 0x1a4c6, 0x1cf56, 0x085c4, 0x16d72, 0x085d1, 0x1af94, 0x26ac6, 0x04bd1, 0x0dca9,
+    0x02d27, 0x2648c, 0x24d60, 0x0a495, 0x264bc, 0x204be, 0x064c5, 0x1a4c7, 0x28594, 0x085c6, 0x285a6, 0x085d2, 0x162d6, 0x162d7, 0x11ccc, 0x01f95,
+    0x14d21, 0x2648d, 0x28d58, 0x0a496, 0x264bd, 0x264c2, 0x064c6, 0x064c8, 0x16f60, 0x085c5, 0x16d75, 0x1fea2, 0x2cfc6, 0x044d8, 0x11ca9, 0x11e64,
+    0x08d29, 0x2648e, 0x24d62, 0x0a497, 0x264be, 0x264c3, 0x064c7, 0x07b8e, 0x28595, 0x085c7, 0x285a7, 0x19e62, 0x147d7, 0x07bbe, 0x1da95, 0x05e29,
+    0x0ed42, 0x24c91, 0x24572, 0x0a4a6, 0x06f92, 0x20ac1, 0x064d1, 0x1a4d2, 0x06f82, 0x025ca, 0x145ac, 0x025d3, 0x06f9c, 0x1b9a8, 0x05cae, 0x05d73,
+    0x02d4c, 0x24c93, 0x24575, 0x0a4a7, 0x179a3, 0x13966, 0x179a2, 0x13962, 0x1459c, 0x159a8, 0x145b2, 0x17ba5, 0x0799f, 0x1d95a, 0x05984, 0x1dd43,
+    0x14d46, 0x08598, 0x24573, 0x0a4a8, 0x26fc1, 0x264d0, 0x064d2, 0x07ec1, 0x28f87, 0x025cb, 0x145ad, 0x1de87, 0x079a8, 0x19d98, 0x19873, 0x11c46,
+    0x08d4e, 0x15b65, 0x24576, 0x01b59, 0x15966, 0x11b52, 0x0f962, 0x11b22, 0x0f977, 0x0fb61, 0x0da6c, 0x05a3b, 0x0195a, 0x11923, 0x01843, 0x11b0e,
+    0x18c0a, 0x1e81b, 0x1ac34, 0x1ac41, 0x1281f, 0x12822, 0x2a857, 0x2a859, 0x00b42, 0x14a5e, 0x0c96a, 0x1486f, 0x0ea58, 0x14a62, 0x14873, 0x09f76,
+    0x18c1b, 0x20c20, 0x1ac3b, 0x20c45, 0x22828, 0x2e82a, 0x2e861, 0x2df63, 0x2a092, 0x2a093, 0x288a5, 0x2d774, 0x2a096, 0x2a097, 0x2a0a8, 0x27f59,
+    0x06c1f, 0x1ac28, 0x06c43, 0x1ac4d, 0x22c8c, 0x2088e, 0x2c895, 0x27797, 0x1c991, 0x2e0c0, 0x1c9a5, 0x27e89, 0x2e0c6, 0x2e0c7, 0x2e0d2, 0x09e62,
+    0x0ac22, 0x20c2a, 0x0ac47, 0x20c4f, 0x2ec8e, 0x2e08f, 0x20499, 0x21f2a, 0x2e0c1, 0x21799, 0x2e0cf, 0x0bf47, 0x2e0c8, 0x2ff8e, 0x2f3c1, 0x0bf22,
+    0x10e34, 0x1e83b, 0x2cc6a, 0x2e86c, 0x12843, 0x12847, 0x2a873, 0x2e074, 0x18a82, 0x16a87, 0x2a0ac, 0x2a0ad, 0x16a84, 0x16a89, 0x160ae, 0x03f6f,
+    0x22841, 0x22845, 0x2cc6c, 0x2e06d, 0x2284d, 0x2fb4f, 0x2e077, 0x23b45, 0x2a09c, 0x2f377, 0x2a0b2, 0x2df6c, 0x1609d, 0x23b4d, 0x2b39c, 0x23b41,
+    0x08c57, 0x2cc61, 0x26c73, 0x2c477, 0x2ec95, 0x22099, 0x220a9, 0x27793, 0x220ca, 0x220cb, 0x220d3, 0x0be87, 0x220cc, 0x2d7c0, 0x17ed1, 0x03e5e,
+    0x26c59, 0x2cc63, 0x2c474, 0x21f45, 0x2b397, 0x2fb2a, 0x2b393, 0x21f20, 0x2b3a8, 0x2fb61, 0x29ba5, 0x1bf3b, 0x2b396, 0x23b28, 0x2b392, 0x19f1b,
+    0x0cf42, 0x26492, 0x0ad82, 0x2649c, 0x18e91, 0x204c1, 0x204ca, 0x277a8, 0x1cf72, 0x26ad1, 0x1edac, 0x277ae, 0x06aa6, 0x2d7d2, 0x0dcd3, 0x09f73,
+    0x02d5e, 0x26493, 0x0ad87, 0x2d777, 0x2c4c0, 0x23399, 0x233cb, 0x2df61, 0x16dd1, 0x233a9, 0x233d3, 0x27f73, 0x233cc, 0x2ff95, 0x233ca, 0x09f57,
+    0x02d58, 0x26496, 0x26d84, 0x2779d, 0x2c4c6, 0x217c8, 0x1a4cc, 0x27796, 0x12da6, 0x1b7cc, 0x1edb2, 0x27e84, 0x1c0da, 0x2d7c6, 0x13ea6, 0x03e58,
+    0x08d62, 0x26497, 0x26d89, 0x1bf4d, 0x2f3c7, 0x21b8e, 0x2f3c0, 0x1bf28, 0x2f3d2, 0x2db95, 0x1daa5, 0x07f43, 0x2f3c6, 0x23f8c, 0x1da91, 0x07f1f,
+    0x02c6a, 0x24ca5, 0x264ac, 0x277b2, 0x18ea5, 0x217cf, 0x204d3, 0x25fa5, 0x04fac, 0x217d3, 0x1c0d9, 0x277ac, 0x1aab2, 0x19da5, 0x05cac, 0x01d6a,
+    0x02c6f, 0x2f374, 0x2b3ad, 0x2fb6c, 0x17989, 0x13b47, 0x17987, 0x1fb3b, 0x173ae, 0x2bb73, 0x2b3ac, 0x2df6a, 0x17984, 0x13b43, 0x19982, 0x11d34,
+    0x08c73, 0x264a8, 0x264ae, 0x2779c, 0x2c4d2, 0x217c1, 0x279d1, 0x27792, 0x0cfd3, 0x217ca, 0x1feac, 0x0be82, 0x079a6, 0x19d91, 0x1dc72, 0x0dc42,
+    0x08c76, 0x2bb59, 0x15b6f, 0x1bf41, 0x15962, 0x13b22, 0x1595e, 0x1fb1b, 0x15b73, 0x2bb57, 0x0da6a, 0x1bf34, 0x0f958, 0x13b1f, 0x01842, 0x19f0a,
+    0x1ee04, 0x1e80b, 0x2e03e, 0x2e03f, 0x22e0a, 0x12a0e, 0x2a042, 0x2a043, 0x1ae30, 0x2e23a, 0x14a68, 0x1626b, 0x2e234, 0x2e23b, 0x1626a, 0x1626c,
+    0x12c0a, 0x22c0e, 0x2e042, 0x2e043, 0x2ee0e, 0x2e613, 0x2e046, 0x2e047, 0x22242, 0x22246, 0x16072, 0x16073, 0x22243, 0x22247, 0x12273, 0x16074,
+    0x14e30, 0x2a43a, 0x1ac68, 0x2246b, 0x16442, 0x12446, 0x22072, 0x22073, 0x2467b, 0x1e685, 0x1e0aa, 0x1e0ab, 0x26682, 0x1e687, 0x120ac, 0x120ad,
+    0x2a434, 0x2a43b, 0x2246a, 0x2246c, 0x16443, 0x12447, 0x1e473, 0x22074, 0x24682, 0x12687, 0x1e0ac, 0x1e0ad, 0x1e684, 0x1e689, 0x1e0ae, 0x01f6f,
+    0x2ee07, 0x2e611, 0x2e04a, 0x2e04b, 0x2ee0c, 0x2e612, 0x1204c, 0x1204d, 0x20e32, 0x2e23c, 0x1226e, 0x12270, 0x2e235, 0x2e23d, 0x1226f, 0x12271,
+    0x16e0c, 0x16612, 0x2204c, 0x2204d, 0x2e60f, 0x2e614, 0x1e04e, 0x1e04f, 0x22244, 0x22248, 0x12275, 0x12277, 0x22245, 0x22249, 0x12276, 0x1f945,
+    0x28e32, 0x1643c, 0x2246e, 0x22470, 0x16444, 0x12448, 0x1e475, 0x1e477, 0x2467c, 0x1e686, 0x1c6ab, 0x1e0af, 0x26683, 0x1e688, 0x1c6ad, 0x23d83,
+    0x16435, 0x1643d, 0x2246f, 0x22471, 0x16445, 0x12449, 0x1e476, 0x13945, 0x24683, 0x12688, 0x106ad, 0x19b83, 0x2f971, 0x1f93d, 0x2f96f, 0x1df35,
+    0x08e19, 0x2e627, 0x1e290, 0x1e294, 0x2ce1f, 0x2e629, 0x1e291, 0x1e295, 0x26e39, 0x22660, 0x1e2a4, 0x1e2a6, 0x2ce43, 0x22662, 0x1e2a5, 0x1e2a7,
+    0x28e1f, 0x16629, 0x12491, 0x12495, 0x2e623, 0x2e62b, 0x1e298, 0x1e299, 0x2c658, 0x22664, 0x1c6a6, 0x1e2a9, 0x2c65a, 0x22666, 0x1c6a8, 0x0df93,
+    0x08e39, 0x16660, 0x106a4, 0x124a6, 0x28658, 0x12664, 0x106a6, 0x106a9, 0x0867d, 0x1e6a0, 0x1c6b0, 0x1c6b3, 0x26684, 0x1e6a2, 0x1c6b2, 0x0dc75,
+    0x28e43, 0x16662, 0x124a5, 0x124a7, 0x1665a, 0x12666, 0x106a8, 0x19f93, 0x08684, 0x106a2, 0x106b2, 0x19a75, 0x0869f, 0x1e6a3, 0x1dc9c, 0x01e4c,
+    0x24e1b, 0x2e628, 0x1e292, 0x1e296, 0x2e620, 0x2e62a, 0x1e293, 0x1e297, 0x26e3b, 0x22661, 0x1c6a5, 0x1e2a8, 0x2ce45, 0x22663, 0x1bd74, 0x1bd59,
+    0x2a620, 0x1662a, 0x12493, 0x12497, 0x2e624, 0x2e62c, 0x2f965, 0x1f92a, 0x2c659, 0x22665, 0x1c6a7, 0x17b93, 0x2c65b, 0x23924, 0x21959, 0x1dd20,
+    0x24e3b, 0x16661, 0x106a5, 0x124a8, 0x28659, 0x12665, 0x106a7, 0x23d93, 0x0867e, 0x1e6a1, 0x1c6b1, 0x1d89b, 0x1b971, 0x1bd5f, 0x1b96c, 0x05c44,
+    0x28e45, 0x16663, 0x0fb74, 0x0fb59, 0x1665b, 0x13924, 0x15959, 0x11b20, 0x15971, 0x15b5f, 0x0f96c, 0x01a44, 0x01955, 0x1f91d, 0x01841, 0x1d90c,
+    0x1ec05, 0x1e80c, 0x2e040, 0x2e041, 0x1ea0c, 0x12a0f, 0x2a044, 0x2a045, 0x2e240, 0x2a244, 0x14a69, 0x1486c, 0x2e241, 0x2a245, 0x14a6c, 0x1606d,
+    0x1ec0c, 0x22c0f, 0x2e044, 0x2e045, 0x1ee12, 0x2e814, 0x2e048, 0x2e049, 0x2e24c, 0x1624e, 0x16075, 0x16076, 0x2e24d, 0x1624f, 0x16077, 0x2b745,
+    0x2e440, 0x2e444, 0x1ac69, 0x2086c, 0x2e44c, 0x2e44e, 0x22075, 0x22076, 0x1e09a, 0x1e09b, 0x1e0b0, 0x1e0b1, 0x1209c, 0x17577, 0x120b2, 0x15f6c,
+    0x2e441, 0x2e445, 0x20c6c, 0x2206d, 0x2e44d, 0x2f74f, 0x22077, 0x2f745, 0x1e09c, 0x23377, 0x1e0b2, 0x21f6c, 0x1e09d, 0x2f74d, 0x1f39c, 0x2f741,
+    0x1ee0c, 0x1ec12, 0x2e04c, 0x2e04d, 0x22e0f, 0x2ea14, 0x1604e, 0x1604f, 0x2e244, 0x2e248, 0x16275, 0x16277, 0x2e245, 0x2e249, 0x16276, 0x2b545,
+    0x12c0f, 0x2ec14, 0x2e04e, 0x2e04f, 0x2ee14, 0x2e015, 0x2e050, 0x2ff14, 0x2e24e, 0x2f350, 0x12078, 0x2f34e, 0x2f14f, 0x2fd14, 0x2f14e, 0x13d0f,
+    0x2a444, 0x2e448, 0x22475, 0x22477, 0x1644e, 0x2f550, 0x22078, 0x1754e, 0x1e69b, 0x1e09e, 0x1e0b3, 0x1f79b, 0x23577, 0x2f548, 0x23575, 0x2b544,
+    0x2a445, 0x2f349, 0x17376, 0x2f345, 0x1714f, 0x2fb14, 0x1714e, 0x23f0f, 0x17377, 0x2f348, 0x17375, 0x2f344, 0x2f14d, 0x1fd12, 0x2f14c, 0x1ff0c,
+    0x2e640, 0x2e64c, 0x1e29a, 0x1229c, 0x2e644, 0x2e64e, 0x1e29b, 0x17777, 0x1ae69, 0x22275, 0x1e2b0, 0x122b2, 0x20a6c, 0x22276, 0x1e2b1, 0x15d6c,
+    0x2a644, 0x1664e, 0x1e49b, 0x23777, 0x2e648, 0x2e650, 0x1f39e, 0x2f748, 0x22675, 0x23378, 0x1f3b3, 0x23775, 0x22677, 0x1774e, 0x1f59b, 0x2b744,
+    0x14c69, 0x16475, 0x1e4b0, 0x1f7b2, 0x16675, 0x12678, 0x1f5b3, 0x17775, 0x1e6b0, 0x1e6b3, 0x1e0b4, 0x1f7b0, 0x1e6b2, 0x17575, 0x1f5b0, 0x15d69,
+    0x14c6c, 0x23376, 0x1f3b1, 0x21b6c, 0x16677, 0x2f74e, 0x1f39b, 0x2f744, 0x133b2, 0x23375, 0x1f3b0, 0x1bf69, 0x1339c, 0x2f74c, 0x1f39a, 0x2f740,
+    0x2e641, 0x2e64d, 0x1e29c, 0x1f19d, 0x2e645, 0x2e64f, 0x23177, 0x2f54d, 0x20e6c, 0x22277, 0x1f1b2, 0x1f19c, 0x2316d, 0x2f545, 0x21d6c, 0x2f541,
+    0x2a645, 0x1734f, 0x17177, 0x2f34d, 0x2f149, 0x2f914, 0x2f148, 0x1ff12, 0x17176, 0x1734e, 0x17175, 0x2f34c, 0x2f145, 0x23d0f, 0x2f144, 0x1fd0c,
+    0x14e6c, 0x16477, 0x131b2, 0x1319c, 0x23176, 0x2f54e, 0x23175, 0x2f54c, 0x1f1b1, 0x1f19b, 0x1f1b0, 0x1f19a, 0x2196c, 0x2f544, 0x1bd69, 0x2f540,
+    0x1716d, 0x2b345, 0x15b6c, 0x2f341, 0x2b145, 0x13b0f, 0x2b144, 0x1fb0c, 0x1596c, 0x2b344, 0x15b69, 0x2f340, 0x2f141, 0x1f90c, 0x2f140, 0x1fd05,
+    0x1c80b, 0x1e81c, 0x0093f, 0x00854, 0x10a1f, 0x12823, 0x14858, 0x2a85a, 0x04b3a, 0x14a5d, 0x0cb6b, 0x14870, 0x00a57, 0x14a61, 0x0ea73, 0x14877,
+    0x1cc1f, 0x22823, 0x20858, 0x2085a, 0x1e829, 0x2e82b, 0x2e864, 0x2e866, 0x16a91, 0x2a098, 0x288a6, 0x288a8, 0x16a95, 0x2a099, 0x2a0a9, 0x0fd93,
+    0x00d3a, 0x1ac5d, 0x18d6b, 0x1a870, 0x22c91, 0x2e098, 0x2c8a6, 0x2c8a8, 0x1cf85, 0x2e0c9, 0x1c9ab, 0x09eb9, 0x2a0ca, 0x2a0cb, 0x2a0d3, 0x03e87,
+    0x04c57, 0x20c61, 0x1ac73, 0x20877, 0x22c95, 0x2e099, 0x2e0a9, 0x1bb93, 0x2e0ca, 0x2e0cb, 0x2e0d3, 0x07e87, 0x2e0cc, 0x15dc0, 0x1fed1, 0x01e5e,
+    0x1ce32, 0x1e83c, 0x2e86e, 0x2e870, 0x12844, 0x12848, 0x2a875, 0x2a877, 0x18a7c, 0x16a86, 0x28aab, 0x160af, 0x1aa83, 0x2fd88, 0x2ddad, 0x2fd83,
+    0x1e844, 0x22848, 0x2e875, 0x2e877, 0x1e84e, 0x2f950, 0x2e078, 0x1f94e, 0x16a9b, 0x1609e, 0x160b3, 0x17b9b, 0x2f977, 0x23948, 0x2f975, 0x1f944,
+    0x0ec7c, 0x2ec86, 0x20cab, 0x2e0af, 0x2ec9b, 0x2e09e, 0x2e0b3, 0x2fd9b, 0x00fb7, 0x2e0cd, 0x2e0d4, 0x01eb7, 0x2f1af, 0x2fd86, 0x21dab, 0x0fd7c,
+    0x2ec83, 0x2ec88, 0x2ccad, 0x1bb83, 0x2b977, 0x13948, 0x2b975, 0x13944, 0x171af, 0x17b86, 0x29bab, 0x19b7c, 0x2f970, 0x1f93c, 0x2f96e, 0x1df32,
+    0x00f27, 0x14cbc, 0x10d94, 0x1e0d6, 0x18e8c, 0x20abe, 0x04bc6, 0x120d7, 0x18f60, 0x26ac5, 0x1cba6, 0x15ecc, 0x06a95, 0x25dc7, 0x01cd2, 0x03d95,
+    0x0ec8c, 0x28cbe, 0x00dc6, 0x1e0d7, 0x1cebe, 0x1e0d5, 0x1e0d8, 0x1dfbe, 0x02fc6, 0x173d8, 0x120da, 0x03ec6, 0x1f1d7, 0x29dbe, 0x01cc6, 0x0fd8c,
+    0x0cf60, 0x08cc5, 0x10da6, 0x1becc, 0x06fc6, 0x2f5d8, 0x1e0da, 0x07ec6, 0x1efa0, 0x1e0db, 0x1efb3, 0x1fea0, 0x1afcc, 0x09dc5, 0x11ca6, 0x0de60,
+    0x02c95, 0x24cc7, 0x00dd2, 0x07b95, 0x131d7, 0x21bbe, 0x05ac6, 0x19f8c, 0x14fcc, 0x27bc5, 0x1daa6, 0x19e60, 0x1f1d6, 0x15dbc, 0x11c94, 0x01e27,
+    0x00f5e, 0x14cc0, 0x1efd1, 0x2f1cc, 0x1aa93, 0x2f199, 0x2f1a9, 0x23d95, 0x06f87, 0x2f1cb, 0x2f1d3, 0x2f1ca, 0x21977, 0x21d61, 0x1bd73, 0x05d57,
+    0x0ec93, 0x2b199, 0x2b1a9, 0x17b95, 0x2f966, 0x2f92b, 0x2f964, 0x1f929, 0x299a8, 0x2b198, 0x299a6, 0x17b91, 0x2195a, 0x23923, 0x21958, 0x1dd1f,
+    0x02f87, 0x2b1cb, 0x2b1d3, 0x2b1ca, 0x2d9a8, 0x2f198, 0x2d9a6, 0x23d91, 0x08fb9, 0x2f1c9, 0x1d8ab, 0x1de85, 0x1b970, 0x1bd5d, 0x19c6b, 0x01c3a,
+    0x15977, 0x15b61, 0x0fb73, 0x01b57, 0x2b95a, 0x13923, 0x15958, 0x11b1f, 0x15970, 0x15b5d, 0x0da6b, 0x05a3a, 0x01954, 0x1f91c, 0x0183f, 0x1d90b,
+    0x1c80c, 0x1e81d, 0x00941, 0x00855, 0x10a20, 0x12824, 0x14859, 0x1775b, 0x00b44, 0x14a5f, 0x0e86c, 0x14871, 0x0ea59, 0x17763, 0x0ea74, 0x29f45,
+    0x1cc20, 0x22824, 0x20859, 0x2d75b, 0x1e82a, 0x2f72c, 0x2e865, 0x2f724, 0x16a93, 0x23765, 0x1d7a7, 0x2d759, 0x13597, 0x1772a, 0x13593, 0x2b720,
+    0x04d44, 0x1ac5f, 0x1a86c, 0x1a871, 0x22c93, 0x13765, 0x117a7, 0x29759, 0x1c99b, 0x1f7a1, 0x1d7b1, 0x0977e, 0x135a8, 0x17761, 0x117a5, 0x25f3b,
+    0x1ac59, 0x23763, 0x1ac74, 0x2df45, 0x1f397, 0x2f72a, 0x1f393, 0x2f720, 0x1f3a8, 0x23761, 0x1d7a5, 0x27f3b, 0x1f396, 0x2f728, 0x1f392, 0x25f1b,
+    0x1ce35, 0x1e83d, 0x2e86f, 0x2e871, 0x12845, 0x13549, 0x1f576, 0x17545, 0x18a83, 0x13788, 0x117ad, 0x25783, 0x23571, 0x1753d, 0x2356f, 0x17535,
+    0x1e845, 0x23349, 0x13376, 0x23345, 0x1f14f, 0x2f714, 0x1f14e, 0x2f70f, 0x13377, 0x23348, 0x13375, 0x23344, 0x2314d, 0x17712, 0x2314c, 0x17f0c,
+    0x22c83, 0x1f788, 0x1d7ad, 0x27783, 0x1f577, 0x13548, 0x1f575, 0x17544, 0x1f1af, 0x1f786, 0x1d7ab, 0x2577c, 0x23570, 0x1753c, 0x2356e, 0x29f32,
+    0x13371, 0x2f33d, 0x1336f, 0x2f335, 0x1314d, 0x2f712, 0x1314c, 0x2ff0c, 0x13370, 0x2f33c, 0x1336e, 0x21f32, 0x2f14b, 0x2f711, 0x2f14a, 0x2ff07,
+    0x00f4c, 0x1f7a3, 0x1cd9c, 0x0979f, 0x18e93, 0x13766, 0x117a8, 0x1775a, 0x18b75, 0x117a2, 0x117b2, 0x09784, 0x135a7, 0x17762, 0x135a5, 0x29f43,
+    0x0ce93, 0x23766, 0x1d7a8, 0x2d75a, 0x1f399, 0x2f72b, 0x1f398, 0x2f723, 0x1f3a9, 0x23764, 0x1d7a6, 0x2d758, 0x13595, 0x17729, 0x13591, 0x29f1f,
+    0x0cd75, 0x1f7a2, 0x1d7b2, 0x27784, 0x117a9, 0x13764, 0x117a6, 0x29758, 0x1d7b3, 0x1f7a0, 0x1d7b0, 0x0977d, 0x135a6, 0x17760, 0x117a4, 0x09f39,
+    0x1f3a7, 0x23762, 0x1f3a5, 0x2df43, 0x1f395, 0x2f729, 0x1f391, 0x2df1f, 0x1f3a6, 0x23760, 0x1f3a4, 0x27f39, 0x1f394, 0x2f727, 0x1f390, 0x09f19,
+    0x00e6f, 0x1f789, 0x1f1ae, 0x1f784, 0x23174, 0x13547, 0x1f573, 0x17543, 0x1f1ad, 0x13787, 0x1f1ac, 0x25782, 0x2356c, 0x2b53b, 0x2356a, 0x2b534,
+    0x17174, 0x23347, 0x13373, 0x23343, 0x2f147, 0x2f713, 0x2f146, 0x2ff0e, 0x17173, 0x23346, 0x17172, 0x23342, 0x2f143, 0x23d0e, 0x2f142, 0x13d0a,
+    0x131ad, 0x1f787, 0x131ac, 0x27782, 0x23173, 0x13546, 0x23172, 0x17542, 0x1f1ab, 0x1f785, 0x1f1aa, 0x2577b, 0x2356b, 0x2b53a, 0x1bd68, 0x15f30,
+    0x1736c, 0x2f33b, 0x1736a, 0x2f334, 0x2b143, 0x13b0e, 0x2b142, 0x23f0a, 0x1736b, 0x2f33a, 0x15b68, 0x1bf30, 0x2f13f, 0x1f90b, 0x2f13e, 0x1ff04,
+    0x04e09, 0x12a1e, 0x04938, 0x00856, 0x1ea1a, 0x12a21, 0x1485c, 0x14860, 0x06e33, 0x2aa56, 0x10b68, 0x14a72, 0x1ae3f, 0x2aa58, 0x14a6e, 0x14a75,
+    0x10c30, 0x12a42, 0x06d7b, 0x1a882, 0x1ea3a, 0x12a46, 0x16885, 0x2a887, 0x26e68, 0x2e272, 0x162aa, 0x162ac, 0x2c66b, 0x2e273, 0x162ab, 0x162ad,
+    0x0cd1e, 0x04c8b, 0x1cd56, 0x1ad94, 0x08e8b, 0x206bd, 0x087c4, 0x268c6, 0x16f56, 0x066c4, 0x12d72, 0x049d1, 0x0a694, 0x1a6c6, 0x087d1, 0x0fca9,
+    0x0ef42, 0x06d92, 0x06d82, 0x06d9c, 0x24e91, 0x208c1, 0x027ca, 0x1bba8, 0x24772, 0x066d1, 0x147ac, 0x05eae, 0x0a6a6, 0x1a6d2, 0x027d3, 0x05f73,
+    0x06e19, 0x22a27, 0x2a290, 0x2a294, 0x20e1f, 0x2ea29, 0x2a291, 0x2a295, 0x06e39, 0x2ea60, 0x2a2a4, 0x2a2a6, 0x20e43, 0x2ea62, 0x2a2a5, 0x2a2a7,
+    0x02f40, 0x22a4c, 0x1629a, 0x1629c, 0x22a44, 0x2ea4e, 0x1629b, 0x13b77, 0x26669, 0x2e275, 0x162b0, 0x162b2, 0x2c66c, 0x2e276, 0x162b1, 0x11d6c,
+    0x02f27, 0x266bc, 0x28794, 0x160d6, 0x2668c, 0x206be, 0x087c6, 0x160d7, 0x24f60, 0x066c5, 0x287a6, 0x11ecc, 0x0a695, 0x1a6c7, 0x087d2, 0x01d95,
+    0x02f4c, 0x17ba3, 0x1479c, 0x07b9f, 0x24e93, 0x13b66, 0x15ba8, 0x1db5a, 0x24775, 0x17ba2, 0x147b2, 0x05b84, 0x0a6a7, 0x13b62, 0x179a5, 0x1df43,
+    0x00f1a, 0x2ee8b, 0x12d5c, 0x2e2c4, 0x26e26, 0x2068d, 0x2e2bf, 0x2e2c5, 0x0ae3f, 0x20694, 0x12f6e, 0x2e2d1, 0x26e4b, 0x20696, 0x27cba, 0x01ca2,
+    0x02f3a, 0x2ee91, 0x28d85, 0x1e2ca, 0x26e5d, 0x22298, 0x222c9, 0x1e2cb, 0x2666b, 0x206a6, 0x287ab, 0x1e2d3, 0x26670, 0x206a8, 0x07cb9, 0x01c87,
+    0x14f21, 0x266bd, 0x16d60, 0x2cdc6, 0x2668d, 0x266c2, 0x087c5, 0x046d8, 0x28f58, 0x066c6, 0x16f75, 0x13ca9, 0x0a696, 0x066c8, 0x1fca2, 0x11c64,
+    0x14f46, 0x26dc1, 0x28d87, 0x07ba8, 0x08798, 0x266d0, 0x027cb, 0x19f98, 0x24773, 0x066d2, 0x147ad, 0x19a73, 0x0a6a8, 0x07cc1, 0x1dc87, 0x11e46,
+    0x0ae1f, 0x2c68c, 0x28791, 0x222c6, 0x26e28, 0x2068e, 0x222c0, 0x222c7, 0x0ae43, 0x20695, 0x287a5, 0x222d2, 0x26e4d, 0x20697, 0x07c89, 0x05c62,
+    0x08f44, 0x2ee93, 0x2879b, 0x17ba8, 0x26e5f, 0x13965, 0x179a1, 0x13961, 0x2666c, 0x206a7, 0x287b1, 0x159a5, 0x26671, 0x1d959, 0x0797e, 0x19d3b,
+    0x08f29, 0x266be, 0x28795, 0x046d7, 0x2668e, 0x266c3, 0x087c7, 0x079be, 0x24f62, 0x066c7, 0x287a7, 0x1d895, 0x0a697, 0x0798e, 0x19c62, 0x05c29,
+    0x08f4e, 0x15b66, 0x0fb77, 0x01b5a, 0x15965, 0x11952, 0x0f961, 0x11b23, 0x24776, 0x0fb62, 0x0d86c, 0x01a43, 0x01959, 0x11922, 0x0583b, 0x1190e,
+    0x1ca0b, 0x1081f, 0x0493a, 0x00857, 0x1ea1c, 0x12a23, 0x1485d, 0x14861, 0x00b3f, 0x14a58, 0x0ea6b, 0x0e873, 0x00a54, 0x2aa5a, 0x14a70, 0x14a77,
+    0x1cc32, 0x12a44, 0x1887c, 0x1a883, 0x1ea3c, 0x12a48, 0x16886, 0x2ff88, 0x2ea6e, 0x2aa75, 0x288ab, 0x2dfad, 0x2ea70, 0x2aa77, 0x162af, 0x2ff83,
+    0x00d27, 0x18c8c, 0x18d60, 0x06895, 0x14ebc, 0x208be, 0x268c5, 0x25fc7, 0x10f94, 0x049c6, 0x1c9a6, 0x01ed2, 0x1e2d6, 0x122d7, 0x15ccc, 0x03f95,
+    0x00d5e, 0x1a893, 0x06d87, 0x21b77, 0x14ec0, 0x2f399, 0x2f3cb, 0x21f61, 0x1edd1, 0x2f3a9, 0x2f3d3, 0x1bf73, 0x2f3cc, 0x23f95, 0x2f3ca, 0x05f57,
+    0x1ce1f, 0x1ea29, 0x16891, 0x16895, 0x22a23, 0x2ea2b, 0x2a298, 0x2a299, 0x20a58, 0x2ea64, 0x28aa6, 0x2a2a9, 0x20a5a, 0x2ea66, 0x28aa8, 0x0ff93,
+    0x1ea44, 0x1ea4e, 0x1689b, 0x2fb77, 0x22a48, 0x2ea50, 0x1739e, 0x23b48, 0x2ea75, 0x2f378, 0x173b3, 0x2fb75, 0x2ea77, 0x1fb4e, 0x1799b, 0x1fb44,
+    0x0cc8c, 0x1ccbe, 0x02dc6, 0x2a0d7, 0x28ebe, 0x160d5, 0x160d8, 0x29fbe, 0x00fc6, 0x1f3d8, 0x160da, 0x01ec6, 0x2b1d7, 0x1ddbe, 0x03cc6, 0x0dd8c,
+    0x0ee93, 0x2fb66, 0x29ba8, 0x21b5a, 0x2b399, 0x2fb2b, 0x2b398, 0x23b23, 0x2b3a9, 0x2fb64, 0x29ba6, 0x21b58, 0x17995, 0x1fb29, 0x17991, 0x1df1f,
+    0x00f3a, 0x22e91, 0x1cd85, 0x2a2ca, 0x1ae5d, 0x2e298, 0x2e2c9, 0x2a2cb, 0x18f6b, 0x2caa6, 0x1cbab, 0x2a2d3, 0x1aa70, 0x2caa8, 0x09cb9, 0x03c87,
+    0x0ee7c, 0x2ee9b, 0x00db7, 0x2f3af, 0x2ee86, 0x2f39e, 0x2f3cd, 0x2ff86, 0x20eab, 0x2f3b3, 0x2f3d4, 0x21fab, 0x2e2af, 0x2ff9b, 0x01cb7, 0x0ff7c,
+    0x0cd60, 0x06dc6, 0x1eda0, 0x1adcc, 0x08ec5, 0x2e6d8, 0x1f3db, 0x09fc5, 0x10fa6, 0x1f3da, 0x1fcb3, 0x11ea6, 0x1bccc, 0x07cc6, 0x1fca0, 0x0dc60,
+    0x02d87, 0x2dba8, 0x08db9, 0x1bb70, 0x2b3cb, 0x2f398, 0x2f3c9, 0x1bf5d, 0x2b3d3, 0x2dba6, 0x1daab, 0x19e6b, 0x2b3ca, 0x23f91, 0x1dc85, 0x01e3a,
+    0x04e57, 0x22e95, 0x2e2ca, 0x2e2cc, 0x20e61, 0x2e299, 0x2e2cb, 0x15fc0, 0x1ae73, 0x2e2a9, 0x2e2d3, 0x1fcd1, 0x20a77, 0x1b993, 0x07c87, 0x01c5e,
+    0x2ee83, 0x2bb77, 0x173af, 0x2fb70, 0x2ee88, 0x13b48, 0x17986, 0x1fb3c, 0x2cead, 0x2bb75, 0x299ab, 0x2fb6e, 0x1b983, 0x13b44, 0x1997c, 0x1dd32,
+    0x02e95, 0x133d7, 0x14dcc, 0x1f3d6, 0x24ec7, 0x219be, 0x279c5, 0x15fbc, 0x00fd2, 0x058c6, 0x1d8a6, 0x11e94, 0x07995, 0x19d8c, 0x19c60, 0x01c27,
+    0x15b77, 0x2bb5a, 0x15b70, 0x01b54, 0x15961, 0x13b23, 0x1595d, 0x1fb1c, 0x0f973, 0x15b58, 0x0fb6b, 0x01a3f, 0x01957, 0x1191f, 0x0583a, 0x1db0b,
+    0x10d0d, 0x10821, 0x04939, 0x00858, 0x10a21, 0x10a51, 0x0e860, 0x14864, 0x04b39, 0x0ea60, 0x10b69, 0x0e875, 0x00a58, 0x14a64, 0x0ea75, 0x15c78,
+    0x04c39, 0x1c858, 0x06d7d, 0x06884, 0x12860, 0x12864, 0x168a0, 0x2a8a2, 0x16da4, 0x148a6, 0x16db0, 0x29eb2, 0x16aa6, 0x16aa9, 0x29cb3, 0x0fe75,
+    0x10d21, 0x06d8d, 0x1cd58, 0x1ad96, 0x06fbd, 0x268c2, 0x0a8c6, 0x27ec8, 0x12f60, 0x049c5, 0x12d75, 0x2bea2, 0x20fc6, 0x09cd8, 0x15ca9, 0x15e64,
+    0x00d58, 0x06d96, 0x06d84, 0x06d9d, 0x208c6, 0x21bc8, 0x268cc, 0x07e96, 0x16da6, 0x27bcc, 0x2adb2, 0x07e84, 0x280da, 0x21bc6, 0x17ea6, 0x01e58,
+    0x04e39, 0x12a60, 0x14da4, 0x168a6, 0x1ca58, 0x12a64, 0x14aa6, 0x14aa9, 0x06f7d, 0x16aa0, 0x16fb0, 0x29eb3, 0x06a84, 0x2aaa2, 0x29cb2, 0x0fc75,
+    0x10c69, 0x12875, 0x28db0, 0x2bbb2, 0x12a75, 0x12a78, 0x179b3, 0x13b75, 0x28fb0, 0x16ab3, 0x160b4, 0x29eb0, 0x2aab2, 0x13975, 0x29cb0, 0x11d69,
+    0x0ef60, 0x04cc5, 0x14da6, 0x27ecc, 0x0afc6, 0x2f9d8, 0x2a0da, 0x0bec6, 0x16fa0, 0x160db, 0x16fb3, 0x17ea0, 0x26fcc, 0x05dc5, 0x15ca6, 0x0fe60,
+    0x0ed75, 0x2bba2, 0x28db2, 0x07b84, 0x15ba9, 0x13b64, 0x15ba6, 0x1db58, 0x28fb3, 0x17ba0, 0x17eb0, 0x07e7d, 0x179a6, 0x13b60, 0x15ca4, 0x05f39,
+    0x10f21, 0x06dbd, 0x12d60, 0x20dc6, 0x06f8d, 0x26ac2, 0x04bc5, 0x09ed8, 0x1cf58, 0x0aac6, 0x12f75, 0x17ca9, 0x1af96, 0x27cc8, 0x2bca2, 0x15c64,
+    0x0ed60, 0x0adc6, 0x16da0, 0x26dcc, 0x04ec5, 0x2ead8, 0x173db, 0x05fc5, 0x14fa6, 0x2b3da, 0x17cb3, 0x15ea6, 0x27ccc, 0x0bcc6, 0x17ca0, 0x0fc60,
+    0x10d51, 0x26dc2, 0x12d64, 0x20dc8, 0x26fc2, 0x100dc, 0x2efd8, 0x27ec2, 0x12f64, 0x2fcd8, 0x13c78, 0x13e64, 0x21cc8, 0x27cc2, 0x13c64, 0x11c51,
+    0x14d64, 0x26dc8, 0x2ada2, 0x1be96, 0x08fd8, 0x27bc2, 0x05ac5, 0x07e8d, 0x16da9, 0x0bbc6, 0x13e75, 0x1de58, 0x21cc6, 0x07cbd, 0x13c60, 0x11e21,
+    0x00f58, 0x20ac6, 0x16fa6, 0x291da, 0x06f96, 0x20ac8, 0x279cc, 0x219c6, 0x06f84, 0x26acc, 0x2bcb2, 0x17ca6, 0x07c9d, 0x07c96, 0x07c84, 0x01c58,
+    0x0ef75, 0x17ba9, 0x28db3, 0x17ba6, 0x2b9a2, 0x13964, 0x179a0, 0x13960, 0x28fb2, 0x159a6, 0x17cb0, 0x17ca4, 0x07984, 0x1d958, 0x07c7d, 0x05d39,
+    0x14f64, 0x08dd8, 0x14da9, 0x21ec6, 0x26fc8, 0x279c2, 0x0b9c6, 0x07ebd, 0x2afa2, 0x058c5, 0x13c75, 0x13e60, 0x1bc96, 0x07c8d, 0x1dc58, 0x11c21,
+    0x14d78, 0x15b64, 0x0fb75, 0x01b58, 0x15964, 0x11b51, 0x0f960, 0x11b21, 0x0f975, 0x0fb60, 0x11a69, 0x05a39, 0x01958, 0x11921, 0x05839, 0x11c0d,
+    0x1080e, 0x10822, 0x0493b, 0x00859, 0x10a23, 0x10852, 0x0e861, 0x14865, 0x00b43, 0x0ea62, 0x0c96c, 0x25676, 0x00a5a, 0x14a66, 0x0ea77, 0x09e4e,
+    0x18c3b, 0x1c859, 0x0687e, 0x27771, 0x12861, 0x12865, 0x168a1, 0x27f5f, 0x148a5, 0x217a7, 0x296b1, 0x2776c, 0x16aa8, 0x2ff93, 0x2969b, 0x09e44,
+    0x04d29, 0x0688e, 0x18d62, 0x0b797, 0x068be, 0x277c3, 0x096c7, 0x2778e, 0x1c995, 0x077c7, 0x296a7, 0x25e62, 0x057d7, 0x277be, 0x29695, 0x09e29,
+    0x04d62, 0x21797, 0x06d89, 0x27f4d, 0x233c7, 0x2178e, 0x233c0, 0x27f28, 0x233d2, 0x21795, 0x296a5, 0x0bf43, 0x233c6, 0x2d78c, 0x29691, 0x0bf1f,
+    0x1ce43, 0x12a62, 0x168a5, 0x0b7a7, 0x1ca5a, 0x12a66, 0x14aa8, 0x25f93, 0x04a84, 0x16aa2, 0x156b2, 0x25675, 0x06a9f, 0x16aa3, 0x1569c, 0x03e4c,
+    0x10c6c, 0x2f376, 0x173b1, 0x2d76c, 0x12a77, 0x2fb4e, 0x1739b, 0x23b44, 0x173b2, 0x2f375, 0x173b0, 0x27769, 0x1739c, 0x23b4c, 0x1739a, 0x03e40,
+    0x00c95, 0x1b7c7, 0x096d2, 0x0b795, 0x171d7, 0x217be, 0x096c6, 0x2778c, 0x10fcc, 0x077c5, 0x296a6, 0x25e60, 0x171d6, 0x277bc, 0x29694, 0x03e27,
+    0x2b3a7, 0x2fb62, 0x2b3a5, 0x21f43, 0x2b395, 0x2fb29, 0x2b391, 0x21f1f, 0x2b3a6, 0x2fb60, 0x2b3a4, 0x07f39, 0x2b394, 0x23b27, 0x2b390, 0x07f19,
+    0x10f46, 0x06dc1, 0x1cd87, 0x0b7a8, 0x18e98, 0x277d0, 0x036cb, 0x09698, 0x18b73, 0x077d2, 0x156ad, 0x25673, 0x06aa8, 0x27cc1, 0x29c87, 0x15e46,
+    0x00d87, 0x217a8, 0x06db9, 0x27770, 0x1f3cb, 0x23398, 0x233c9, 0x27f5d, 0x1f3d3, 0x217a6, 0x296ab, 0x2776b, 0x1f3ca, 0x2ff91, 0x29c85, 0x03e3a,
+    0x10d64, 0x077c8, 0x1eda2, 0x0b796, 0x057d8, 0x277c2, 0x096c5, 0x2778d, 0x12da9, 0x077c6, 0x17e75, 0x29e58, 0x2dcc6, 0x277bd, 0x17c60, 0x15e21,
+    0x00da2, 0x21796, 0x26dba, 0x27f4b, 0x2f3c5, 0x2178d, 0x2f3bf, 0x27f26, 0x2f3d1, 0x21794, 0x13e6e, 0x0bf3f, 0x2f3c4, 0x2ff8b, 0x13c5c, 0x01e1a,
+    0x04e73, 0x1b7d2, 0x036d3, 0x0b7a6, 0x1aaa8, 0x219c1, 0x036ca, 0x25f91, 0x04fae, 0x077d1, 0x156ac, 0x25672, 0x07c9c, 0x07c92, 0x07c82, 0x0fe42,
+    0x173ad, 0x2f373, 0x173ab, 0x2d76b, 0x2b987, 0x13b46, 0x17985, 0x1fb3a, 0x173ac, 0x2f372, 0x173aa, 0x27f68, 0x1b982, 0x13b42, 0x07c7b, 0x11d30,
+    0x0eda9, 0x1b7c6, 0x096d1, 0x0b794, 0x279c6, 0x217bd, 0x096c4, 0x09f8b, 0x058d1, 0x077c4, 0x13c72, 0x17e56, 0x1bc94, 0x05d8b, 0x1dc56, 0x0dc1e,
+    0x15b75, 0x2bb58, 0x15b6e, 0x1bf3f, 0x15960, 0x13b21, 0x1595c, 0x1fb1a, 0x15b72, 0x2bb56, 0x11a68, 0x07f33, 0x01956, 0x13b1e, 0x05838, 0x05f09,
+    0x18e0a, 0x12a1f, 0x00942, 0x0e858, 0x1ea1b, 0x12a22, 0x1485e, 0x14862, 0x1ae34, 0x2aa57, 0x0ea6a, 0x14a73, 0x1ae41, 0x2aa59, 0x14a6f, 0x09d76,
+    0x10c34, 0x12a43, 0x18882, 0x16884, 0x1ea3b, 0x12a47, 0x16887, 0x16889, 0x2ce6a, 0x2aa73, 0x2a2ac, 0x162ae, 0x2ea6c, 0x2e274, 0x2a2ad, 0x03d6f,
+    0x0cd42, 0x18c91, 0x1cd72, 0x068a6, 0x26692, 0x206c1, 0x268d1, 0x2d5d2, 0x0af82, 0x206ca, 0x1efac, 0x0ded3, 0x2669c, 0x275a8, 0x275ae, 0x09d73,
+    0x00c6a, 0x18ca5, 0x04dac, 0x1bbb2, 0x24ea5, 0x206cf, 0x215d3, 0x19fa5, 0x266ac, 0x206d3, 0x160d9, 0x05eac, 0x266b2, 0x25da5, 0x275ac, 0x03d6a,
+    0x18e1b, 0x22a28, 0x2a292, 0x2a296, 0x20e20, 0x2ea2a, 0x2a293, 0x2a297, 0x1ae3b, 0x2ea61, 0x28aa5, 0x2a2a8, 0x20e45, 0x2dd63, 0x2d574, 0x27d59,
+    0x22a41, 0x22a4d, 0x2a29c, 0x1719d, 0x22a45, 0x2ea4f, 0x2f177, 0x2394d, 0x2ce6c, 0x2e277, 0x2b1b2, 0x2b19c, 0x2f16d, 0x23945, 0x2dd6c, 0x23941,
+    0x02f5e, 0x2c6c0, 0x16fd1, 0x231cc, 0x26693, 0x23199, 0x231a9, 0x2fd95, 0x0af87, 0x231cb, 0x231d3, 0x231ca, 0x2d577, 0x2dd61, 0x27d73, 0x09d57,
+    0x02e6f, 0x17b89, 0x171ae, 0x17b84, 0x2f174, 0x13947, 0x2b973, 0x13943, 0x2b1ad, 0x17b87, 0x2b1ac, 0x19b82, 0x2f96c, 0x1f93b, 0x2dd6a, 0x11f34,
+    0x06e1f, 0x22e8c, 0x1cb91, 0x2e2c6, 0x1ae28, 0x20a8e, 0x2e2c0, 0x2e2c7, 0x06e43, 0x2ca95, 0x1cba5, 0x2e2d2, 0x1ae4d, 0x27597, 0x27c89, 0x09c62,
+    0x08e57, 0x2ee95, 0x222ca, 0x222cc, 0x2ce61, 0x22299, 0x222cb, 0x2d5c0, 0x26e73, 0x222a9, 0x222d3, 0x17cd1, 0x2c677, 0x27593, 0x0bc87, 0x03c5e,
+    0x02f58, 0x2c6c6, 0x12fa6, 0x1d1da, 0x26696, 0x206c8, 0x1b5cc, 0x2d5c6, 0x26f84, 0x1a6cc, 0x1fcb2, 0x13ca6, 0x2669d, 0x27596, 0x27c84, 0x03c58,
+    0x08e73, 0x2c6d2, 0x0cdd3, 0x07ba6, 0x266a8, 0x215c1, 0x215ca, 0x19f91, 0x266ae, 0x27bd1, 0x1fcac, 0x1de72, 0x2759c, 0x27592, 0x0bc82, 0x0de42,
+    0x0ae22, 0x2ee8e, 0x2e2c1, 0x2f1c8, 0x20e2a, 0x2f18f, 0x21599, 0x2fd8e, 0x0ae47, 0x20699, 0x2f1cf, 0x2f1c1, 0x21d4f, 0x21d2a, 0x0bd47, 0x0bd22,
+    0x26e59, 0x2b197, 0x2b1a8, 0x2b196, 0x2ce63, 0x2f92a, 0x2f961, 0x23928, 0x2c674, 0x2b193, 0x299a5, 0x2b192, 0x21d45, 0x21d20, 0x1bd3b, 0x19d1b,
+    0x08f62, 0x2f1c7, 0x2f1d2, 0x2f1c6, 0x26697, 0x2198e, 0x2d995, 0x23d8c, 0x26f89, 0x2f1c0, 0x1d8a5, 0x1d891, 0x1bd4d, 0x1bd28, 0x07d43, 0x07d1f,
+    0x08e76, 0x15b62, 0x15973, 0x0fb58, 0x2b959, 0x13922, 0x2b957, 0x1391f, 0x1596f, 0x15b5e, 0x0f96a, 0x01a42, 0x1bd41, 0x1f91b, 0x1bd34, 0x19d0a,
+    0x1ca0c, 0x12a20, 0x00944, 0x0e859, 0x1ea1d, 0x12a24, 0x1485f, 0x17563, 0x00b41, 0x14a59, 0x0ea6c, 0x14a74, 0x00a55, 0x1755b, 0x14a71, 0x29d45,
+    0x1cc35, 0x12a45, 0x18883, 0x23771, 0x1ea3d, 0x13749, 0x13588, 0x1773d, 0x2ea6f, 0x1f776, 0x115ad, 0x2376f, 0x2ea71, 0x17745, 0x25583, 0x17735,
+    0x00d4c, 0x18c93, 0x18975, 0x137a7, 0x1f5a3, 0x13566, 0x115a2, 0x17562, 0x1cf9c, 0x115a8, 0x115b2, 0x137a5, 0x0959f, 0x1755a, 0x09584, 0x29d43,
+    0x00c6f, 0x23374, 0x1f3ad, 0x2376c, 0x1f589, 0x13747, 0x13587, 0x2b73b, 0x1f3ae, 0x1f773, 0x1f3ac, 0x2376a, 0x1f584, 0x17743, 0x25582, 0x2b734,
+    0x1ce20, 0x1ea2a, 0x16893, 0x13797, 0x22a24, 0x2f52c, 0x23565, 0x1752a, 0x20a59, 0x2ea65, 0x1d5a7, 0x13793, 0x2d55b, 0x2f524, 0x2d559, 0x2b520,
+    0x1ea45, 0x1f34f, 0x13177, 0x2334d, 0x23149, 0x2f514, 0x23148, 0x17512, 0x13176, 0x1f34e, 0x13175, 0x2334c, 0x23145, 0x2f50f, 0x23144, 0x17d0c,
+    0x0cc93, 0x1f199, 0x1f1a9, 0x13795, 0x23566, 0x2f52b, 0x23564, 0x17529, 0x1d5a8, 0x1f198, 0x1d5a6, 0x13791, 0x2d55a, 0x2f523, 0x2d558, 0x29d1f,
+    0x13174, 0x2f347, 0x17373, 0x2f343, 0x23147, 0x2f513, 0x23146, 0x23f0e, 0x13173, 0x2f346, 0x13172, 0x2f342, 0x23143, 0x2fd0e, 0x23142, 0x17d0a,
+    0x04f44, 0x22e93, 0x1cb9b, 0x137a8, 0x1ae5f, 0x13565, 0x1f5a1, 0x17561, 0x1aa6c, 0x115a7, 0x1d5b1, 0x115a5, 0x1aa71, 0x29559, 0x0957e, 0x25d3b,
+    0x22e83, 0x1f777, 0x1f3af, 0x23770, 0x1f588, 0x13748, 0x1f586, 0x1773c, 0x1d5ad, 0x1f775, 0x1d5ab, 0x2376e, 0x27583, 0x17744, 0x2557c, 0x29d32,
+    0x0cf75, 0x137a9, 0x1d5b3, 0x137a6, 0x1f5a2, 0x13564, 0x1f5a0, 0x17560, 0x1d5b2, 0x115a6, 0x1d5b0, 0x137a4, 0x27584, 0x29558, 0x0957d, 0x09d39,
+    0x133ad, 0x23373, 0x1f3ab, 0x2376b, 0x1f587, 0x13746, 0x1f585, 0x2b73a, 0x133ac, 0x23372, 0x1f3aa, 0x1bf68, 0x27582, 0x17742, 0x2557b, 0x15d30,
+    0x1ae59, 0x1f197, 0x1f1a8, 0x1f196, 0x23563, 0x2f52a, 0x23561, 0x2f528, 0x1ae74, 0x1f193, 0x1d5a5, 0x1f192, 0x2dd45, 0x2f520, 0x27d3b, 0x25d1b,
+    0x13171, 0x1334d, 0x13170, 0x2f34b, 0x2f13d, 0x2f512, 0x2f13c, 0x2f511, 0x1316f, 0x1334c, 0x1316e, 0x2f34a, 0x2f135, 0x2fd0c, 0x21d32, 0x2fd07,
+    0x1f1a7, 0x1f195, 0x1f1a6, 0x1f194, 0x23562, 0x2f529, 0x23560, 0x2f527, 0x1f1a5, 0x1f191, 0x1f1a4, 0x1f190, 0x2dd43, 0x2dd1f, 0x27d39, 0x09d19,
+    0x1716c, 0x2b343, 0x1716b, 0x2f33f, 0x2f13b, 0x1390e, 0x2f13a, 0x1fb0b, 0x1716a, 0x2b342, 0x15968, 0x2f33e, 0x2f134, 0x23d0a, 0x1bd30, 0x1fd04,
+    0x10a0e, 0x10823, 0x00943, 0x0085a, 0x10a22, 0x10a52, 0x0e862, 0x14866, 0x04b3b, 0x0ea61, 0x0cb6c, 0x0e877, 0x00a59, 0x14a65, 0x25476, 0x09c4e,
+    0x1cc43, 0x1c85a, 0x04884, 0x0689f, 0x12862, 0x12866, 0x168a2, 0x168a3, 0x16aa5, 0x148a8, 0x154b2, 0x1549c, 0x0b5a7, 0x25d93, 0x25475, 0x03c4c,
+    0x10d46, 0x18c98, 0x18973, 0x068a8, 0x06fc1, 0x275d0, 0x075d2, 0x27ec1, 0x1cf87, 0x034cb, 0x154ad, 0x29e87, 0x0b5a8, 0x09498, 0x25473, 0x15c46,
+    0x04c73, 0x1a8a8, 0x04dae, 0x07e9c, 0x1b5d2, 0x21bc1, 0x075d1, 0x07e92, 0x034d3, 0x034ca, 0x154ac, 0x07e82, 0x0b5a6, 0x25d91, 0x25472, 0x0fc42,
+    0x18e3b, 0x12a61, 0x14aa5, 0x168a8, 0x1ca59, 0x12a65, 0x215a7, 0x2fd93, 0x06a7e, 0x16aa1, 0x294b1, 0x2949b, 0x27571, 0x27d5f, 0x2756c, 0x09c44,
+    0x10e6c, 0x12877, 0x171b2, 0x1719c, 0x2f176, 0x2f94e, 0x2f175, 0x2394c, 0x171b1, 0x1719b, 0x171b0, 0x1719a, 0x2d56c, 0x23944, 0x27569, 0x03c40,
+    0x00f87, 0x1f1cb, 0x1f1d3, 0x1f1ca, 0x215a8, 0x23198, 0x215a6, 0x2fd91, 0x06fb9, 0x231c9, 0x294ab, 0x29e85, 0x27570, 0x27d5d, 0x2756b, 0x03c3a,
+    0x171ad, 0x2bb87, 0x171ac, 0x1bb82, 0x2f173, 0x13946, 0x2f172, 0x13942, 0x171ab, 0x17b85, 0x171aa, 0x07e7b, 0x2d56b, 0x1f93a, 0x27d68, 0x11f30,
+    0x04f29, 0x06abe, 0x1cb95, 0x156d7, 0x06a8e, 0x275c3, 0x075c7, 0x275be, 0x18f62, 0x094c7, 0x294a7, 0x29495, 0x0b597, 0x2758e, 0x25c62, 0x09c29,
+    0x00e95, 0x173d7, 0x10dcc, 0x173d6, 0x1b5c7, 0x215be, 0x075c5, 0x275bc, 0x094d2, 0x094c6, 0x294a6, 0x29494, 0x0b595, 0x2758c, 0x25c60, 0x03c27,
+    0x10f64, 0x055d8, 0x10da9, 0x2dec6, 0x075c8, 0x275c2, 0x075c6, 0x275bd, 0x1efa2, 0x094c5, 0x17c75, 0x17e60, 0x0b596, 0x2758d, 0x29c58, 0x15c21,
+    0x0cda9, 0x27bc6, 0x05ad1, 0x1be94, 0x1b5c6, 0x215bd, 0x075c4, 0x05f8b, 0x094d1, 0x094c4, 0x17c72, 0x1de56, 0x0b594, 0x09d8b, 0x17c56, 0x0fc1e,
+    0x04f62, 0x231c7, 0x231d2, 0x231c6, 0x21597, 0x2158e, 0x21595, 0x2d58c, 0x06f89, 0x231c0, 0x294a5, 0x29491, 0x27d4d, 0x27d28, 0x0bd43, 0x0bd1f,
+    0x2b1a7, 0x2b195, 0x2b1a6, 0x2b194, 0x2f962, 0x2f929, 0x2f960, 0x23927, 0x2b1a5, 0x2b191, 0x2b1a4, 0x2b190, 0x21d43, 0x21d1f, 0x07d39, 0x07d19,
+    0x00fa2, 0x2f1c5, 0x2f1d1, 0x2f1c4, 0x21596, 0x2158d, 0x21594, 0x2fd8b, 0x26fba, 0x2f1bf, 0x13c6e, 0x13e5c, 0x27d4b, 0x27d26, 0x0bd3f, 0x01c1a,
+    0x15975, 0x15b60, 0x0fb72, 0x01b56, 0x2b958, 0x13921, 0x2b956, 0x11b1e, 0x1596e, 0x15b5c, 0x11868, 0x05a38, 0x1bd3f, 0x1f91a, 0x07d33, 0x05d09,
+    0x10a0f, 0x10824, 0x00945, 0x0375b, 0x10a24, 0x11753, 0x0d563, 0x15724, 0x00b45, 0x0d763, 0x0f66d, 0x03645, 0x0355b, 0x15524, 0x03445, 0x1570f,
+    0x1cc45, 0x1f75b, 0x11771, 0x03755, 0x11563, 0x13724, 0x1155f, 0x1771d, 0x11774, 0x11759, 0x0d76c, 0x03641, 0x0d559, 0x17720, 0x03444, 0x2970c,
+    0x04d4e, 0x11765, 0x0d776, 0x03759, 0x11566, 0x11752, 0x0d562, 0x15722, 0x0d577, 0x0d761, 0x0f66c, 0x0963b, 0x0355a, 0x15523, 0x03443, 0x1570e,
+    0x11776, 0x1f759, 0x1176f, 0x27f41, 0x11562, 0x13722, 0x1155e, 0x2b71b, 0x11773, 0x1f757, 0x0f66a, 0x09634, 0x0d558, 0x1771f, 0x03442, 0x2970a,
+    0x1ce45, 0x11763, 0x0d774, 0x0d759, 0x1f55b, 0x13524, 0x11559, 0x15720, 0x11571, 0x1175f, 0x0d56c, 0x03644, 0x03555, 0x1751d, 0x03441, 0x2950c,
+    0x1316d, 0x1f345, 0x1176c, 0x23341, 0x1f145, 0x1370f, 0x1f144, 0x1770c, 0x1156c, 0x1f344, 0x11769, 0x23340, 0x23141, 0x1750c, 0x23140, 0x17705,
+    0x11577, 0x11761, 0x0d773, 0x03757, 0x1f55a, 0x13523, 0x11558, 0x1571f, 0x11570, 0x1175d, 0x0f66b, 0x0963a, 0x03554, 0x1751c, 0x0343f, 0x2950b,
+    0x1336c, 0x2333b, 0x1336a, 0x23334, 0x1f143, 0x1370e, 0x1f142, 0x2b70a, 0x1336b, 0x2333a, 0x11768, 0x27f30, 0x2313f, 0x1750b, 0x2313e, 0x17f04,
+    0x04f4e, 0x11766, 0x0d777, 0x0375a, 0x11565, 0x11552, 0x0d561, 0x15723, 0x0d576, 0x0d762, 0x0f46c, 0x03643, 0x03559, 0x15522, 0x0943b, 0x1550e,
+    0x11777, 0x1f75a, 0x11770, 0x03754, 0x11561, 0x13723, 0x1155d, 0x1771c, 0x0d573, 0x11758, 0x0d76b, 0x0363f, 0x03557, 0x1551f, 0x0943a, 0x2970b,
+    0x11778, 0x11764, 0x0d775, 0x03758, 0x11564, 0x11751, 0x0d560, 0x15721, 0x0d575, 0x0d760, 0x15669, 0x09639, 0x03558, 0x15521, 0x09439, 0x1570d,
+    0x11775, 0x1f758, 0x1176e, 0x27f3f, 0x11560, 0x13721, 0x1155c, 0x2b71a, 0x11772, 0x1f756, 0x15668, 0x09633, 0x03556, 0x1771e, 0x09438, 0x09f09,
+    0x11576, 0x11762, 0x11573, 0x0d758, 0x1f559, 0x13522, 0x1f557, 0x1751f, 0x1156f, 0x1175e, 0x0d56a, 0x03642, 0x27d41, 0x2b51b, 0x09434, 0x2950a,
+    0x1316c, 0x1f343, 0x1316b, 0x2333f, 0x2313b, 0x1350e, 0x2313a, 0x1770b, 0x1316a, 0x1f342, 0x11568, 0x2333e, 0x23134, 0x2b50a, 0x27d30, 0x17d04,
+    0x11575, 0x11760, 0x0d772, 0x03756, 0x1f558, 0x13521, 0x1f556, 0x1571e, 0x1156e, 0x1175c, 0x15468, 0x09638, 0x27d3f, 0x2b51a, 0x09433, 0x09d09,
+    0x13169, 0x2f339, 0x13368, 0x2f333, 0x2f139, 0x1370d, 0x2f138, 0x2ff09, 0x13168, 0x2f338, 0x13167, 0x27f2e, 0x2f133, 0x2fd09, 0x27d2e, 0x11d02,
+    0x00c03, 0x20c18, 0x2452f, 0x20c38, 0x2462f, 0x2ec38, 0x00779, 0x2047b, 0x20f18, 0x0268a, 0x2ef38, 0x0c790, 0x20f38, 0x00790, 0x2077b, 0x0079a,
+    0x02c06, 0x2cc1a, 0x08531, 0x2cc3a, 0x28631, 0x2ec3a, 0x0047a, 0x2047c, 0x02725, 0x0048b, 0x1475c, 0x00491, 0x0275c, 0x0c491, 0x00785, 0x0049b,
+    0x02d09, 0x2441e, 0x24530, 0x26c42, 0x02638, 0x2a456, 0x0e77b, 0x00482, 0x2871e, 0x0258b, 0x2af42, 0x0c792, 0x08756, 0x00794, 0x22782, 0x0c79c,
+    0x08c0b, 0x2441f, 0x08532, 0x26c44, 0x0e63a, 0x2a457, 0x0047c, 0x00483, 0x14727, 0x0258c, 0x1475e, 0x00493, 0x02760, 0x0c495, 0x0c787, 0x05e77,
+    0x02e09, 0x2841e, 0x02538, 0x08456, 0x24630, 0x2ac42, 0x0077b, 0x22482, 0x2471e, 0x0268b, 0x2a756, 0x0c794, 0x26f42, 0x00792, 0x00782, 0x0079c,
+    0x28c0b, 0x2841f, 0x0253a, 0x08457, 0x28632, 0x2ac44, 0x0e47c, 0x22483, 0x02727, 0x0e68c, 0x0e760, 0x00495, 0x0275e, 0x0c493, 0x00787, 0x11d77,
+    0x2470d, 0x24421, 0x02539, 0x08458, 0x02639, 0x14458, 0x0077d, 0x00484, 0x24721, 0x0078d, 0x14758, 0x0c796, 0x08758, 0x00796, 0x00784, 0x0079d,
+    0x2440e, 0x24422, 0x0253b, 0x08459, 0x0e63b, 0x14459, 0x0047e, 0x19b71, 0x02729, 0x0048e, 0x0e762, 0x00497, 0x02762, 0x0c497, 0x00789, 0x19f4d,
+    0x02f06, 0x02425, 0x28531, 0x0245c, 0x08631, 0x1445c, 0x0077a, 0x00485, 0x2cf1a, 0x0078b, 0x2ef3a, 0x0c791, 0x2cf3a, 0x00791, 0x2077c, 0x0079b,
+    0x02710, 0x02426, 0x02536, 0x0245d, 0x02636, 0x1445d, 0x0077f, 0x00486, 0x02726, 0x0268d, 0x1475d, 0x0c798, 0x0275d, 0x00798, 0x00786, 0x0079e,
+    0x28f0b, 0x02427, 0x28532, 0x0245e, 0x0263a, 0x0e460, 0x0e77c, 0x00487, 0x2871f, 0x0c78c, 0x2af44, 0x0c793, 0x08757, 0x00795, 0x22783, 0x11e77,
+    0x14711, 0x02428, 0x02537, 0x0245f, 0x0263c, 0x0e461, 0x0e780, 0x00488, 0x14728, 0x0258e, 0x1475f, 0x19a65, 0x02761, 0x00799, 0x0c788, 0x19e48,
+    0x08f0b, 0x14427, 0x0e53a, 0x02460, 0x08632, 0x1445e, 0x0077c, 0x0c487, 0x2471f, 0x0268c, 0x2a757, 0x0c795, 0x26f44, 0x00793, 0x00783, 0x05d77,
+    0x02711, 0x14428, 0x0253c, 0x02461, 0x02637, 0x1445f, 0x00780, 0x0c488, 0x02728, 0x0268e, 0x0e761, 0x0c799, 0x0275f, 0x19965, 0x00788, 0x19d48,
+    0x2470e, 0x02429, 0x0e53b, 0x02462, 0x0263b, 0x0e462, 0x0077e, 0x00489, 0x24722, 0x0078e, 0x14759, 0x0c797, 0x08759, 0x00797, 0x19871, 0x19c4d,
+    0x02712, 0x0242a, 0x0253d, 0x02463, 0x0263d, 0x0e463, 0x00781, 0x01b3d, 0x0272a, 0x0268f, 0x0e763, 0x01a2a, 0x02763, 0x0192a, 0x0183d, 0x01a12,
+    0x00c06, 0x20c1a, 0x06c31, 0x20c3a, 0x1ec31, 0x22c3a, 0x0087a, 0x2c87c, 0x00b25, 0x0288b, 0x10b5c, 0x02891, 0x00b5c, 0x0e891, 0x02b85, 0x0289b,
+    0x00c16, 0x20c1c, 0x26c36, 0x20c3c, 0x2ec36, 0x2ec3c, 0x2047f, 0x20480, 0x004bb, 0x184bc, 0x044bf, 0x184c0, 0x1c4bf, 0x1c4c0, 0x184c9, 0x01fa1,
+    0x08c1a, 0x26c21, 0x0ac3a, 0x26c46, 0x2e45c, 0x2e460, 0x20485, 0x20487, 0x1ed8b, 0x044bd, 0x1ed91, 0x044c1, 0x1c4c4, 0x1c4c6, 0x184ca, 0x01ea8,
+    0x08c1c, 0x26c23, 0x26c3c, 0x26c48, 0x2e45d, 0x2e461, 0x20486, 0x20488, 0x004bc, 0x044be, 0x044c0, 0x07f99, 0x1c4c5, 0x1c4c7, 0x184cb, 0x05f61,
+    0x16c1a, 0x2ec21, 0x2645c, 0x2c460, 0x16c3a, 0x2ec46, 0x2e485, 0x22487, 0x06e8b, 0x1c4bd, 0x044c4, 0x184c6, 0x1ae91, 0x1c4c1, 0x1c4ca, 0x0dda8,
+    0x16c1c, 0x2ec23, 0x2645d, 0x2c461, 0x16c3c, 0x2ec48, 0x2e486, 0x22488, 0x104bc, 0x1c4be, 0x044c5, 0x184c7, 0x104c0, 0x13f99, 0x1c4cb, 0x11f61,
+    0x24c21, 0x24451, 0x26460, 0x26464, 0x2a460, 0x2e464, 0x204a0, 0x204a2, 0x004bd, 0x004c2, 0x044c6, 0x044c8, 0x104c6, 0x1c4c8, 0x184cc, 0x0dd96,
+    0x24c23, 0x24452, 0x26461, 0x26465, 0x2a461, 0x2e465, 0x204a1, 0x19f5f, 0x004be, 0x004c3, 0x044c7, 0x05b8e, 0x104c7, 0x1db8e, 0x07ac0, 0x19f28,
+    0x02c31, 0x2445c, 0x08d7a, 0x26485, 0x06e7a, 0x16485, 0x004b5, 0x184b7, 0x18b5c, 0x004c4, 0x1eb85, 0x044ca, 0x06b85, 0x104ca, 0x24bb7, 0x01caf,
+    0x02c36, 0x2445d, 0x0847f, 0x26486, 0x1647f, 0x16486, 0x004b6, 0x184b8, 0x004bf, 0x004c5, 0x004c9, 0x044cb, 0x104c9, 0x104cb, 0x004cd, 0x01f86,
+    0x08c3a, 0x24460, 0x24d7c, 0x0a487, 0x28485, 0x164a0, 0x004b7, 0x064b9, 0x12d91, 0x004c6, 0x1ed9b, 0x1dea8, 0x0c4ca, 0x104cc, 0x1dcaf, 0x11e70,
+    0x08c3c, 0x24461, 0x08480, 0x0a488, 0x28486, 0x164a1, 0x004b8, 0x19f80, 0x004c0, 0x004c7, 0x1faa1, 0x19a61, 0x0c4cb, 0x1ffc0, 0x1da86, 0x05e3c,
+    0x14c3a, 0x28460, 0x08485, 0x084a0, 0x2ae7c, 0x16487, 0x104b7, 0x1e4b9, 0x06e91, 0x0c4c6, 0x004ca, 0x004cc, 0x06e9b, 0x19da8, 0x05caf, 0x01d70,
+    0x28c3c, 0x28461, 0x08486, 0x084a1, 0x16480, 0x16488, 0x104b8, 0x1ff80, 0x0c4c0, 0x0c4c7, 0x004cb, 0x1bfc0, 0x079a1, 0x1d961, 0x05986, 0x1dd3c,
+    0x24c46, 0x24464, 0x08487, 0x084a2, 0x14487, 0x164a2, 0x004b9, 0x004ba, 0x004c1, 0x004c8, 0x118a8, 0x1de96, 0x058a8, 0x19d96, 0x19870, 0x01c4b,
+    0x24c48, 0x24465, 0x08488, 0x01a5f, 0x14488, 0x1195f, 0x01a80, 0x01b37, 0x0fa99, 0x01b8e, 0x0da61, 0x01a28, 0x01961, 0x11928, 0x0183c, 0x19f11,
+    0x00d09, 0x1ac1e, 0x18930, 0x1ac42, 0x00a38, 0x1e856, 0x0eb7b, 0x02882, 0x1ef1e, 0x0098b, 0x1ef42, 0x0eb92, 0x04b56, 0x02b94, 0x2eb82, 0x0eb9c,
+    0x06c1a, 0x1ac21, 0x06c3a, 0x1ac46, 0x2285c, 0x22860, 0x20885, 0x2c887, 0x16d8b, 0x085bd, 0x2ad91, 0x088c1, 0x167c4, 0x288c6, 0x127ca, 0x03ea8,
+    0x00d19, 0x0ac27, 0x0ac40, 0x0ac4c, 0x2e790, 0x2c494, 0x2e79a, 0x2049c, 0x12f27, 0x245bc, 0x12f4c, 0x21ea3, 0x2e794, 0x200d6, 0x2279c, 0x01e9f,
+    0x08d1f, 0x26c29, 0x0ac44, 0x26c4e, 0x2c491, 0x2c495, 0x2049b, 0x1be77, 0x2858c, 0x085be, 0x2ad93, 0x1be66, 0x167c6, 0x200d7, 0x23ea8, 0x05e5a,
+    0x02d33, 0x2cc56, 0x24d68, 0x26472, 0x18e68, 0x22c72, 0x2e7aa, 0x204ac, 0x20f56, 0x025c4, 0x2a772, 0x025d1, 0x20f72, 0x00ad1, 0x227ac, 0x01dae,
+    0x02d3f, 0x2cc58, 0x2456b, 0x26473, 0x22c6e, 0x22c75, 0x204ab, 0x204ad, 0x14594, 0x025c6, 0x145a6, 0x025d2, 0x167d1, 0x1dda9, 0x127d3, 0x0df73,
+    0x02d39, 0x26c60, 0x24569, 0x26475, 0x2e7a4, 0x2c4a6, 0x2e7b0, 0x204b2, 0x2af60, 0x025c5, 0x2a775, 0x21ea2, 0x2e7a6, 0x19dcc, 0x227b2, 0x01e84,
+    0x08d43, 0x26c62, 0x2456c, 0x26476, 0x2c4a5, 0x2c4a7, 0x204b1, 0x19b6c, 0x14595, 0x025c7, 0x145a7, 0x1be62, 0x167d2, 0x11b95, 0x21aa5, 0x05f43,
+    0x10f1a, 0x26d8b, 0x12f3a, 0x26d91, 0x1ab5c, 0x264c4, 0x2eb85, 0x064ca, 0x22f21, 0x285bd, 0x22f46, 0x28bc1, 0x20b60, 0x24bc6, 0x2eb87, 0x0fea8,
+    0x02d26, 0x0858d, 0x24d5d, 0x0a498, 0x167bf, 0x264c5, 0x127c9, 0x064cb, 0x2858d, 0x025c2, 0x16798, 0x025d0, 0x167c5, 0x005d8, 0x127cb, 0x0dc98,
+    0x14d1f, 0x2458c, 0x16f44, 0x26d93, 0x2e791, 0x0a4c6, 0x2e79b, 0x21ea8, 0x16f29, 0x285be, 0x16f4e, 0x23e66, 0x2e795, 0x223d7, 0x1fe77, 0x1fe5a,
+    0x24d28, 0x0858e, 0x24d5f, 0x1ba65, 0x167c0, 0x0a4c7, 0x21aa1, 0x1ba61, 0x2858e, 0x025c3, 0x23a65, 0x19a52, 0x167c7, 0x03abe, 0x1fa61, 0x19e23,
+    0x14d3f, 0x08594, 0x2856b, 0x085a6, 0x1af6e, 0x264d1, 0x2e7ab, 0x064d3, 0x2ef58, 0x0e5c6, 0x2a773, 0x0e5d2, 0x20f75, 0x19da9, 0x227ad, 0x01c73,
+    0x02d4b, 0x08596, 0x24570, 0x085a8, 0x039ba, 0x119a2, 0x019b9, 0x11987, 0x14596, 0x025c8, 0x145a8, 0x039c1, 0x079a2, 0x19964, 0x05987, 0x19d46,
+    0x14d43, 0x08595, 0x2856c, 0x085a7, 0x2e7a5, 0x0a4d2, 0x2e7b1, 0x23aa5, 0x2af62, 0x0e5c7, 0x2a776, 0x1fe62, 0x2e7a7, 0x05895, 0x1d86c, 0x11c43,
+    0x24d4d, 0x08597, 0x24571, 0x05a59, 0x03989, 0x0d962, 0x01a7e, 0x01b3b, 0x14597, 0x03a8e, 0x11a59, 0x19a22, 0x01962, 0x01929, 0x0d83b, 0x19a0e,
+    0x04c0b, 0x1881f, 0x04932, 0x1ac44, 0x0ca3a, 0x1e857, 0x0087c, 0x02883, 0x10b27, 0x0098c, 0x10b5e, 0x02893, 0x00b60, 0x0e895, 0x0eb87, 0x09e77,
+    0x06c1c, 0x1ac23, 0x06c3c, 0x1ac48, 0x2285d, 0x22861, 0x20886, 0x27f88, 0x22dbc, 0x088be, 0x22dc0, 0x27699, 0x288c5, 0x2bfc7, 0x276cb, 0x09f61,
+    0x04d1f, 0x06c29, 0x06c44, 0x06c4e, 0x20891, 0x20895, 0x2089b, 0x27e77, 0x1ed8c, 0x049be, 0x1ed93, 0x27e66, 0x12bc6, 0x2c0d7, 0x2fea8, 0x09e5a,
+    0x0ac23, 0x26c2b, 0x0ac48, 0x26c50, 0x2c498, 0x2c499, 0x2169e, 0x0be48, 0x2edbe, 0x200d5, 0x2d699, 0x27e2b, 0x200d8, 0x2ffbe, 0x2d698, 0x0be23,
+    0x10e3f, 0x22c58, 0x26c6e, 0x2cc75, 0x1ec6b, 0x1e873, 0x2e8ab, 0x25fad, 0x18f94, 0x0cac6, 0x06bd1, 0x276a9, 0x04aa6, 0x11dd2, 0x276d3, 0x03f73,
+    0x02c54, 0x2cc5a, 0x26c70, 0x2cc77, 0x22c70, 0x22c77, 0x204af, 0x27f83, 0x064d6, 0x277d7, 0x276cc, 0x0bf95, 0x239cc, 0x13f95, 0x276ca, 0x03f57,
+    0x08c58, 0x26c64, 0x26c75, 0x27678, 0x2eca6, 0x2c4a9, 0x216b3, 0x27e75, 0x10fc6, 0x076d8, 0x2d6a9, 0x27e64, 0x200da, 0x11dc6, 0x2fea6, 0x09e58,
+    0x08c5a, 0x26c66, 0x26c77, 0x07e4e, 0x2eca8, 0x1ff93, 0x21a9b, 0x07e44, 0x2d2d7, 0x05bbe, 0x21a95, 0x07e29, 0x139c6, 0x1ff8c, 0x21a91, 0x05f1f,
+    0x10f3a, 0x0ad91, 0x1ed7c, 0x26d9b, 0x04b85, 0x2c4ca, 0x10bb7, 0x276af, 0x1cb60, 0x0ebc6, 0x12b87, 0x25ea8, 0x06ba0, 0x02bcc, 0x16bb9, 0x03e70,
+    0x02d5d, 0x26498, 0x26d86, 0x2769e, 0x264c9, 0x2c4cb, 0x276cd, 0x27f86, 0x16dc5, 0x277d8, 0x2d6cb, 0x27698, 0x076db, 0x17fc5, 0x276c9, 0x03f5d,
+    0x02d57, 0x0ad95, 0x26d83, 0x2de77, 0x264ca, 0x264cc, 0x216af, 0x27e70, 0x12d95, 0x1b6d7, 0x23e77, 0x2de5a, 0x22bcc, 0x076d6, 0x23e70, 0x03e54,
+    0x08d61, 0x26499, 0x26d88, 0x1be48, 0x264cb, 0x23fc0, 0x21a86, 0x07e3c, 0x2adc7, 0x09abe, 0x23a61, 0x1be23, 0x29ac5, 0x23fbc, 0x23a5d, 0x07e1c,
+    0x02c6b, 0x24ca6, 0x08dab, 0x276b3, 0x04eab, 0x2c4d3, 0x276d4, 0x09fab, 0x18fa6, 0x076da, 0x2d6d3, 0x25ea6, 0x06bb3, 0x19da6, 0x05cab, 0x01d6b,
+    0x02c70, 0x24ca8, 0x264af, 0x27f9b, 0x179b9, 0x13987, 0x119b7, 0x1ff7c, 0x039cc, 0x0f9c6, 0x2d6ca, 0x0bf91, 0x079a0, 0x1d960, 0x05985, 0x11d3a,
+    0x02d73, 0x264a9, 0x24dad, 0x2de75, 0x264d3, 0x079d1, 0x2faab, 0x27e6e, 0x10fd2, 0x0d8c6, 0x1fa73, 0x23e58, 0x058a6, 0x19d94, 0x1fe6b, 0x11c3f,
+    0x08c77, 0x03a93, 0x03a83, 0x1be44, 0x0f987, 0x1195e, 0x01a7c, 0x05b32, 0x0fa95, 0x03a8c, 0x1fa57, 0x19a1f, 0x01960, 0x11927, 0x0d83a, 0x05e0b,
+    0x00e09, 0x1ec1e, 0x00938, 0x04856, 0x18a30, 0x1ec42, 0x00b7b, 0x2e882, 0x1af1e, 0x00a8b, 0x1eb56, 0x0eb94, 0x1af42, 0x02b92, 0x02b82, 0x02b9c,
+    0x10c1a, 0x22c21, 0x1a85c, 0x20860, 0x12c3a, 0x22c46, 0x2e885, 0x2e887, 0x26e8b, 0x286bd, 0x267c4, 0x248c6, 0x26e91, 0x288c1, 0x067ca, 0x0fda8,
+    0x00d33, 0x20c56, 0x18d68, 0x20c72, 0x24e68, 0x2a472, 0x207aa, 0x224ac, 0x2cf56, 0x026c4, 0x22f72, 0x009d1, 0x26772, 0x026d1, 0x207ac, 0x03dae,
+    0x14e3f, 0x2ec58, 0x1ac6e, 0x20c75, 0x2866b, 0x2a473, 0x2e4ab, 0x224ad, 0x08694, 0x0e6c6, 0x267d1, 0x19ea9, 0x086a6, 0x0e6d2, 0x067d3, 0x01f73,
+    0x00e19, 0x12c27, 0x2c790, 0x2e494, 0x12c40, 0x12c4c, 0x2079a, 0x2249c, 0x0af27, 0x246bc, 0x2c794, 0x2e0d6, 0x0af4c, 0x21da3, 0x2079c, 0x01d9f,
+    0x14e1f, 0x16c29, 0x2e491, 0x2e495, 0x16c44, 0x16c4e, 0x2e49b, 0x1fd77, 0x2468c, 0x286be, 0x0a7c6, 0x220d7, 0x26e93, 0x23d66, 0x21da8, 0x1fd5a,
+    0x02e39, 0x2ac60, 0x2c7a4, 0x2e4a6, 0x24669, 0x2a475, 0x207b0, 0x224b2, 0x26f60, 0x026c5, 0x2c7a6, 0x19ecc, 0x26775, 0x21da2, 0x207b2, 0x01d84,
+    0x14e43, 0x2ac62, 0x2e4a5, 0x2e4a7, 0x2866c, 0x2a476, 0x2e4b1, 0x1db6c, 0x08695, 0x0e6c7, 0x0a7d2, 0x05b95, 0x086a7, 0x1fd62, 0x239a5, 0x11f43,
+    0x06f1a, 0x16e8b, 0x22b5c, 0x164c4, 0x06f3a, 0x2ae91, 0x20b85, 0x124ca, 0x1af21, 0x086bd, 0x22b60, 0x28bc6, 0x1af46, 0x08bc1, 0x2cb87, 0x03da8,
+    0x02e26, 0x2868d, 0x267bf, 0x164c5, 0x24e5d, 0x16498, 0x0a7c9, 0x124cb, 0x0868d, 0x026c2, 0x267c5, 0x006d8, 0x0a798, 0x026d0, 0x067cb, 0x01c98,
+    0x02e3f, 0x14694, 0x22f6e, 0x164d1, 0x2466b, 0x146a6, 0x207ab, 0x124d3, 0x2cf58, 0x026c6, 0x22f75, 0x1dea9, 0x26773, 0x026d2, 0x207ad, 0x0dc73,
+    0x02e4b, 0x14696, 0x03aba, 0x07aa2, 0x24670, 0x146a8, 0x01ab9, 0x05a87, 0x08696, 0x026c8, 0x11aa2, 0x19a64, 0x086a8, 0x03ac1, 0x11a87, 0x19e46,
+    0x08e1f, 0x2868c, 0x2c791, 0x164c6, 0x0af44, 0x2ae93, 0x2079b, 0x23da8, 0x26f29, 0x086be, 0x2c795, 0x203d7, 0x26f4e, 0x1bd66, 0x1bd77, 0x05d5a,
+    0x24e28, 0x2868e, 0x0a7c0, 0x164c7, 0x24e5f, 0x23965, 0x219a1, 0x1f961, 0x0868e, 0x026c3, 0x0a7c7, 0x039be, 0x1b965, 0x19952, 0x1b961, 0x19d23,
+    0x08e43, 0x14695, 0x2c7a5, 0x164d2, 0x2466c, 0x146a7, 0x207b1, 0x219a5, 0x26f62, 0x026c7, 0x2c7a7, 0x11895, 0x26776, 0x1bd62, 0x1986c, 0x05c43,
+    0x24e4d, 0x14697, 0x03a89, 0x01a62, 0x24671, 0x11959, 0x0197e, 0x0db3b, 0x08697, 0x0398e, 0x0da62, 0x01a29, 0x05959, 0x19922, 0x0183b, 0x1990e,
+    0x1cc0b, 0x1c81f, 0x0093a, 0x04857, 0x1ca32, 0x1ec44, 0x0e87c, 0x2e883, 0x00b27, 0x0ca8c, 0x0cb60, 0x02895, 0x00b5e, 0x0e893, 0x02b87, 0x15d77,
+    0x1ec1c, 0x22c23, 0x1a85d, 0x20861, 0x1ec3c, 0x22c48, 0x2e886, 0x2bf88, 0x1aebc, 0x288be, 0x088c5, 0x27fc7, 0x20ec0, 0x2b599, 0x2b5cb, 0x15f61,
+    0x00d3f, 0x20c58, 0x1ac6b, 0x1a873, 0x2ec6e, 0x2ec75, 0x208ab, 0x29fad, 0x1cf94, 0x009c6, 0x109a6, 0x05ed2, 0x1ebd1, 0x2b5a9, 0x2b5d3, 0x0ff73,
+    0x00c54, 0x20c5a, 0x1ac70, 0x20c77, 0x2ec70, 0x2ec77, 0x2e4af, 0x1bf83, 0x1e4d6, 0x2b7d7, 0x1bacc, 0x07f95, 0x2f5cc, 0x17f95, 0x2b5ca, 0x01f57,
+    0x10e1f, 0x1ec29, 0x22891, 0x22895, 0x12c44, 0x1ec4e, 0x2e89b, 0x2bd77, 0x1ae8c, 0x1cabe, 0x06bc6, 0x2e0d7, 0x1ae93, 0x2fd66, 0x2dda8, 0x2bd5a,
+    0x12c23, 0x2ec2b, 0x2e498, 0x2e499, 0x12c48, 0x2ec50, 0x2f59e, 0x13d48, 0x20ebe, 0x2e0d5, 0x2e0d8, 0x21fbe, 0x2f599, 0x2fd2b, 0x2f598, 0x13d23,
+    0x14c58, 0x2ec64, 0x2cca6, 0x2e4a9, 0x2ac75, 0x2f578, 0x2f5b3, 0x2bd75, 0x04fc6, 0x1f5d8, 0x220da, 0x05ec6, 0x2f5a9, 0x2fd64, 0x2dda6, 0x15d58,
+    0x2ac5a, 0x2ec66, 0x2cca8, 0x1bf93, 0x2ac77, 0x1fd4e, 0x2f99b, 0x13d44, 0x2f1d7, 0x1dbbe, 0x07ac6, 0x1bf8c, 0x23995, 0x1fd29, 0x23991, 0x11f1f,
+    0x04f3a, 0x16e91, 0x1cb85, 0x2e4ca, 0x18e7c, 0x16e9b, 0x00bb7, 0x175af, 0x18b60, 0x02bc6, 0x1eba0, 0x14bcc, 0x06b87, 0x29da8, 0x08bb9, 0x15d70,
+    0x14e5d, 0x2a498, 0x2e4c9, 0x2e4cb, 0x16e86, 0x1759e, 0x2f5cd, 0x17f86, 0x26ec5, 0x166d8, 0x1f5db, 0x27fc5, 0x2f5cb, 0x2b598, 0x2f5c9, 0x15f5d,
+    0x0ec6b, 0x28ca6, 0x1cdab, 0x2e4d3, 0x28eab, 0x175b3, 0x2f5d4, 0x29fab, 0x1cfa6, 0x166da, 0x1fab3, 0x1dea6, 0x2f5d3, 0x29da6, 0x1dcab, 0x0fd6b,
+    0x14c70, 0x28ca8, 0x09ab9, 0x07a87, 0x164af, 0x17f9b, 0x01ab7, 0x19f7c, 0x15acc, 0x03ac6, 0x1faa0, 0x19a60, 0x2f5ca, 0x17f91, 0x1da85, 0x05e3a,
+    0x00e57, 0x16e95, 0x2a4ca, 0x2e4cc, 0x1ae83, 0x2fd77, 0x2f5af, 0x2fd70, 0x06e95, 0x2a6d7, 0x1abcc, 0x1f5d6, 0x21d77, 0x21d5a, 0x1bd70, 0x01d54,
+    0x14e61, 0x2a499, 0x2a4cb, 0x21fc0, 0x2ae88, 0x23d48, 0x2f986, 0x1fd3c, 0x26ec7, 0x299be, 0x099c5, 0x1bfbc, 0x21961, 0x23d23, 0x1b95d, 0x1fd1c,
+    0x0ee73, 0x2a4a9, 0x2a4d3, 0x1fad1, 0x28ead, 0x2fd75, 0x219ab, 0x2fd6e, 0x04fd2, 0x018c6, 0x118a6, 0x1de94, 0x1b973, 0x21d58, 0x1bd6b, 0x01c3f,
+    0x14c77, 0x0f993, 0x03a87, 0x01a5e, 0x2f983, 0x1fd44, 0x0f97c, 0x1db32, 0x03995, 0x0db8c, 0x0da60, 0x01a27, 0x05957, 0x1d91f, 0x0183a, 0x1dd0b,
+    0x18c0d, 0x18821, 0x00939, 0x04858, 0x00a39, 0x10858, 0x00b7d, 0x02884, 0x18b21, 0x02b8d, 0x10b58, 0x0eb96, 0x04b58, 0x02b96, 0x02b84, 0x03d9d,
+    0x18c21, 0x18c51, 0x1a860, 0x1a864, 0x1e860, 0x22864, 0x208a0, 0x2c8a2, 0x02fbd, 0x028c2, 0x088c6, 0x09ec8, 0x148c6, 0x29dc8, 0x248cc, 0x0fd96,
+    0x00d39, 0x1ac60, 0x18d69, 0x1a875, 0x22ca4, 0x208a6, 0x2ebb0, 0x2deb2, 0x1ef60, 0x009c5, 0x1eb75, 0x2dea2, 0x22ba6, 0x25dcc, 0x2feb2, 0x03e84,
+    0x04c58, 0x1ac64, 0x1ac75, 0x1ac78, 0x22ca6, 0x22ca9, 0x21ab3, 0x1be75, 0x14fc6, 0x27ad8, 0x23ea9, 0x1be64, 0x2c0da, 0x15dc6, 0x23ea6, 0x05e58,
+    0x00e39, 0x1ec60, 0x20ca4, 0x228a6, 0x18e69, 0x1e875, 0x20bb0, 0x2fdb2, 0x1af60, 0x00ac5, 0x20ba6, 0x25ecc, 0x1ab75, 0x2dda2, 0x2ddb2, 0x03d84,
+    0x10c58, 0x22c64, 0x20ca6, 0x20ca9, 0x1ec75, 0x22c78, 0x2f9b3, 0x1fd75, 0x08fc6, 0x179d8, 0x2e0da, 0x09ec6, 0x21da9, 0x23d64, 0x21da6, 0x11d58,
+    0x00c7d, 0x20ca0, 0x20cb0, 0x20cb3, 0x2ecb0, 0x2ecb3, 0x200b4, 0x2fdb0, 0x20fa0, 0x200db, 0x2efb3, 0x21ea0, 0x21db3, 0x21da0, 0x21db0, 0x01d7d,
+    0x02c84, 0x2cca2, 0x2ccb2, 0x1ba75, 0x2ecb2, 0x1f975, 0x21ab0, 0x19f69, 0x24fcc, 0x01bc5, 0x21aa6, 0x1be60, 0x239a6, 0x1fd60, 0x21da4, 0x01f39,
+    0x18f21, 0x02cbd, 0x1eb60, 0x14bc6, 0x1ab60, 0x08bc6, 0x20ba0, 0x24bcc, 0x18f51, 0x02bc2, 0x22b64, 0x29ec8, 0x1ab64, 0x09dc8, 0x2cba2, 0x03d96,
+    0x02c8d, 0x02cc2, 0x00dc5, 0x26cd8, 0x00ec5, 0x16cd8, 0x216db, 0x01fc5, 0x02fc2, 0x180dc, 0x16fd8, 0x03ec2, 0x27dd8, 0x03dc2, 0x01cc5, 0x03d8d,
+    0x10f58, 0x08cc6, 0x1ef75, 0x21ea9, 0x20fa6, 0x2e3da, 0x2fab3, 0x21ea6, 0x22f64, 0x17ad8, 0x22f78, 0x23e64, 0x20fa9, 0x09dc6, 0x1fe75, 0x11e58,
+    0x02c96, 0x08cc8, 0x2daa2, 0x1ba64, 0x25acc, 0x09ac6, 0x21aa0, 0x1ba60, 0x28fc8, 0x03ac2, 0x23a64, 0x19e51, 0x15ac6, 0x03dbd, 0x1fa60, 0x19e21,
+    0x04f58, 0x14cc6, 0x22fa6, 0x2d1da, 0x1af75, 0x23da9, 0x20bb3, 0x23da6, 0x1af64, 0x26bd8, 0x22fa9, 0x15ec6, 0x1bd78, 0x1bd64, 0x1bd75, 0x05d58,
+    0x0ec96, 0x28cc8, 0x259cc, 0x159c6, 0x2d9a2, 0x23964, 0x219a0, 0x1f960, 0x08fc8, 0x039c2, 0x099c6, 0x03ebd, 0x1b964, 0x19d51, 0x1b960, 0x19d21,
+    0x02f84, 0x24ccc, 0x2efb2, 0x23aa6, 0x2cfb2, 0x219a6, 0x2fab0, 0x23da4, 0x2cfa2, 0x018c5, 0x1fa75, 0x1fe60, 0x1b975, 0x1bd60, 0x19c69, 0x01c39,
+    0x02c9d, 0x03a96, 0x03a84, 0x05a58, 0x03984, 0x11958, 0x01a7d, 0x01b39, 0x0fa96, 0x03a8d, 0x11a58, 0x19a21, 0x05958, 0x19921, 0x01839, 0x19d0d,
+    0x1880e, 0x18822, 0x0093b, 0x04859, 0x0ca3b, 0x10859, 0x0087e, 0x25771, 0x00b29, 0x0288e, 0x0cb62, 0x09797, 0x00b62, 0x15797, 0x02b89, 0x25f4d,
+    0x18c23, 0x18852, 0x1a861, 0x1a865, 0x1e861, 0x22865, 0x208a1, 0x25f5f, 0x028be, 0x037c3, 0x0b6c7, 0x0978e, 0x175c7, 0x2978e, 0x0b6c0, 0x25f28,
+    0x04d43, 0x1ac62, 0x1896c, 0x27676, 0x208a5, 0x157a7, 0x216b1, 0x2576c, 0x10995, 0x037c7, 0x2d6a7, 0x27e62, 0x175d2, 0x15795, 0x2d6a5, 0x09f43,
+    0x04c5a, 0x1ac66, 0x1ac77, 0x27e4e, 0x22ca8, 0x2bf93, 0x2169b, 0x0be44, 0x212d7, 0x097be, 0x2d695, 0x27e29, 0x175c6, 0x2978c, 0x2d691, 0x09f1f,
+    0x10e43, 0x1ec62, 0x228a5, 0x097a7, 0x1ca6c, 0x2b576, 0x2f5b1, 0x2976c, 0x04a95, 0x0f7c7, 0x0b6d2, 0x09795, 0x2f5a7, 0x2bd62, 0x2f5a5, 0x15f43,
+    0x1ec5a, 0x22c66, 0x20ca8, 0x27f93, 0x1ec77, 0x17d4e, 0x2f59b, 0x17d44, 0x231d7, 0x297be, 0x0b6c6, 0x2578c, 0x2f595, 0x17d29, 0x2f591, 0x15f1f,
+    0x00c84, 0x20ca2, 0x216b2, 0x27675, 0x235b2, 0x2b575, 0x216b0, 0x25769, 0x18fcc, 0x037c5, 0x2d6a6, 0x27e60, 0x2f5a6, 0x2bd60, 0x2d6a4, 0x03f39,
+    0x00c9f, 0x20ca3, 0x2169c, 0x0be4c, 0x2359c, 0x13d4c, 0x2169a, 0x13d40, 0x2f1d6, 0x257bc, 0x2d694, 0x0be27, 0x2f594, 0x13d27, 0x2d690, 0x01f19,
+    0x18f46, 0x02bc1, 0x10b87, 0x097a8, 0x04b87, 0x157a8, 0x00bb9, 0x25770, 0x18b64, 0x037c8, 0x10ba2, 0x09796, 0x06ba2, 0x15796, 0x02bba, 0x03f4b,
+    0x00d98, 0x037d0, 0x076cb, 0x0b698, 0x135cb, 0x17598, 0x0b6c9, 0x25f5d, 0x017d8, 0x037c2, 0x276c5, 0x0978d, 0x175c5, 0x2978d, 0x276bf, 0x03f26,
+    0x0cd73, 0x037d2, 0x216ad, 0x27673, 0x135d3, 0x157a6, 0x216ab, 0x2576b, 0x1cfa9, 0x037c6, 0x23e75, 0x2de58, 0x175d1, 0x15794, 0x23e6e, 0x03f3f,
+    0x02ca8, 0x09ac1, 0x2da87, 0x1be46, 0x135ca, 0x2bf91, 0x21a85, 0x07e3a, 0x29ac6, 0x097bd, 0x23a60, 0x1be21, 0x175c4, 0x17f8b, 0x23a5c, 0x07e1a,
+    0x00e73, 0x0f7d2, 0x076d3, 0x097a6, 0x235ad, 0x2b573, 0x2f5ab, 0x2976b, 0x18fa9, 0x0f7c6, 0x276d1, 0x09794, 0x21d75, 0x2fd58, 0x1bd6e, 0x15f3f,
+    0x0eca8, 0x299c1, 0x076ca, 0x27f91, 0x2f987, 0x23d46, 0x2f985, 0x13d3a, 0x259c6, 0x297bd, 0x276c4, 0x27f8b, 0x21960, 0x23d21, 0x1b95c, 0x11d1a,
+    0x02cae, 0x037d1, 0x216ac, 0x27672, 0x235ac, 0x2b572, 0x216aa, 0x25f68, 0x018d1, 0x037c4, 0x23e72, 0x2de56, 0x21d72, 0x21d56, 0x19c68, 0x01c33,
+    0x03a9c, 0x03a92, 0x03a82, 0x1be42, 0x2f982, 0x1fd42, 0x01a7b, 0x19b30, 0x0fa94, 0x01b8b, 0x1fa56, 0x1be1e, 0x05956, 0x1fd1e, 0x01838, 0x01f09,
+    0x00f06, 0x00825, 0x1ef31, 0x0085c, 0x06f31, 0x1085c, 0x00b7a, 0x02885, 0x20f1a, 0x02b8b, 0x22f3a, 0x0eb91, 0x20f3a, 0x02b91, 0x2cb7c, 0x02b9b,
+    0x00c31, 0x1885c, 0x06d7a, 0x06885, 0x08e7a, 0x1e885, 0x007b5, 0x248b7, 0x2475c, 0x007c4, 0x16785, 0x107ca, 0x26785, 0x047ca, 0x187b7, 0x03caf,
+    0x16f1a, 0x06d8b, 0x16f3a, 0x1ad91, 0x2675c, 0x047c4, 0x2e785, 0x1c7ca, 0x2ef21, 0x1c7bd, 0x2ef46, 0x1c7c1, 0x2c760, 0x187c6, 0x22787, 0x0dea8,
+    0x14f3a, 0x06d91, 0x2ad7c, 0x06d9b, 0x08785, 0x007ca, 0x107b7, 0x05faf, 0x28760, 0x0c7c6, 0x16787, 0x19ea8, 0x087a0, 0x007cc, 0x1e7b9, 0x01e70,
+    0x08f1a, 0x1ee8b, 0x2e75c, 0x1c7c4, 0x0af3a, 0x1ee91, 0x20785, 0x187ca, 0x26f21, 0x047bd, 0x2e760, 0x1c7c6, 0x26f46, 0x047c1, 0x20787, 0x01da8,
+    0x08f3a, 0x12e91, 0x28785, 0x0c7ca, 0x24e7c, 0x1ee9b, 0x007b7, 0x1dfaf, 0x24760, 0x007c6, 0x167a0, 0x107cc, 0x0a787, 0x1dda8, 0x067b9, 0x11d70,
+    0x24f21, 0x007bd, 0x2a760, 0x107c6, 0x26760, 0x047c6, 0x207a0, 0x187cc, 0x24751, 0x007c2, 0x2e764, 0x1c7c8, 0x26764, 0x047c8, 0x207a2, 0x01d96,
+    0x24f46, 0x007c1, 0x14787, 0x05ba8, 0x08787, 0x11ba8, 0x007b9, 0x19b70, 0x24764, 0x007c8, 0x167a2, 0x19e96, 0x087a2, 0x1dd96, 0x007ba, 0x01f4b,
+    0x00f16, 0x007bb, 0x2ef36, 0x1c7bf, 0x26f36, 0x047bf, 0x2077f, 0x187c9, 0x20f1c, 0x187bc, 0x2ef3c, 0x1c7c0, 0x20f3c, 0x187c0, 0x20780, 0x01ca1,
+    0x02f36, 0x007bf, 0x1677f, 0x107c9, 0x0877f, 0x007c9, 0x007b6, 0x007cd, 0x2475d, 0x007c5, 0x16786, 0x107cb, 0x26786, 0x047cb, 0x187b8, 0x01c86,
+    0x16f1c, 0x107bc, 0x16f3c, 0x107c0, 0x2675d, 0x047c5, 0x2e786, 0x1c7cb, 0x2ef23, 0x1c7be, 0x2ef48, 0x13c99, 0x2c761, 0x187c7, 0x22788, 0x11c61,
+    0x28f3c, 0x0c7c0, 0x16780, 0x07aa1, 0x08786, 0x007cb, 0x107b8, 0x05a86, 0x28761, 0x0c7c7, 0x16788, 0x1da61, 0x087a1, 0x1bcc0, 0x1fc80, 0x1de3c,
+    0x08f1c, 0x007bc, 0x2e75d, 0x1c7c5, 0x26f3c, 0x047c0, 0x20786, 0x187cb, 0x26f23, 0x047be, 0x2e761, 0x1c7c7, 0x26f48, 0x07c99, 0x20788, 0x05c61,
+    0x08f3c, 0x007c0, 0x28786, 0x0c7cb, 0x08780, 0x1f9a1, 0x007b8, 0x1d986, 0x24761, 0x007c7, 0x167a1, 0x1fcc0, 0x0a788, 0x19961, 0x19c80, 0x05d3c,
+    0x24f23, 0x007be, 0x2a761, 0x107c7, 0x26761, 0x047c7, 0x207a1, 0x13ac0, 0x24752, 0x007c3, 0x2e765, 0x1d88e, 0x26765, 0x0588e, 0x19c5f, 0x19c28,
+    0x24f48, 0x03a99, 0x14788, 0x01a61, 0x08788, 0x0d961, 0x0fa80, 0x01b3c, 0x24765, 0x0188e, 0x11a5f, 0x11a28, 0x0195f, 0x01928, 0x01837, 0x19c11,
+    0x00d10, 0x00826, 0x00936, 0x0085d, 0x00a36, 0x1085d, 0x00b7f, 0x02886, 0x00b26, 0x00a8d, 0x10b5d, 0x0eb98, 0x00b5d, 0x02b98, 0x02b86, 0x03c9e,
+    0x00c36, 0x1885d, 0x06d7f, 0x06886, 0x1ee7f, 0x1e886, 0x008b6, 0x25fb8, 0x1edbf, 0x028c5, 0x22dc9, 0x0bfcb, 0x1aec9, 0x17fcb, 0x03ccd, 0x03f86,
+    0x00d26, 0x04c8d, 0x18d5d, 0x1ad98, 0x02ebf, 0x068c5, 0x12bc9, 0x09fcb, 0x1cf8d, 0x009c2, 0x1ed98, 0x01ed0, 0x1ebc5, 0x03dd8, 0x15ccb, 0x0fc98,
+    0x00d5d, 0x06d98, 0x06d86, 0x06d9e, 0x14ec9, 0x23fcb, 0x27acd, 0x07f86, 0x1edc5, 0x07bd8, 0x22dcb, 0x07f98, 0x09cdb, 0x1ffc5, 0x15cc9, 0x01f5d,
+    0x00e26, 0x1cc8d, 0x02dbf, 0x1e8c5, 0x18e5d, 0x1ee98, 0x0abc9, 0x15fcb, 0x04f8d, 0x00ac2, 0x06bc5, 0x03ed8, 0x1ae98, 0x01dd0, 0x09ccb, 0x03c98,
+    0x10e5d, 0x12e98, 0x02dc9, 0x21fcb, 0x1ee86, 0x1ff9e, 0x2f9cd, 0x1ff86, 0x06ec5, 0x1ead8, 0x17cdb, 0x07fc5, 0x20ecb, 0x13f98, 0x03cc9, 0x11f5d,
+    0x00c8d, 0x00cc2, 0x02dc5, 0x06cd8, 0x02ec5, 0x1ecd8, 0x21adb, 0x03fc5, 0x00fc2, 0x240dc, 0x1efd8, 0x01ec2, 0x07dd8, 0x01dc2, 0x03cc5, 0x01d8d,
+    0x02d98, 0x00cd0, 0x08dcb, 0x1bf98, 0x14ecb, 0x1ff98, 0x0bac9, 0x19f5d, 0x02fd8, 0x01bc2, 0x07ac5, 0x05e8d, 0x1f9c5, 0x1dd8d, 0x03cbf, 0x01f26,
+    0x00f36, 0x06dbf, 0x1ed7f, 0x1adc9, 0x06e7f, 0x22ec9, 0x00bb6, 0x03fcd, 0x18b5d, 0x02bc5, 0x1eb86, 0x17ccb, 0x06b86, 0x0bccb, 0x25cb8, 0x03c86,
+    0x00d7f, 0x0adc9, 0x00db6, 0x26dcd, 0x00eb6, 0x2ffcd, 0x000dd, 0x01fb6, 0x12dc9, 0x21cdb, 0x2fccd, 0x13cc9, 0x27ccd, 0x0bcc9, 0x01cb6, 0x01c7f,
+    0x10d5d, 0x06dc5, 0x1ed86, 0x20dcb, 0x02ec9, 0x17fdb, 0x2facd, 0x03fc9, 0x12d98, 0x1e9d8, 0x1fc9e, 0x13c98, 0x21ccb, 0x07cc5, 0x1fc86, 0x11c5d,
+    0x02d86, 0x0adcb, 0x24db8, 0x07a86, 0x02ecd, 0x23fc9, 0x01ab6, 0x07f7f, 0x16dcb, 0x03ac5, 0x1fa86, 0x19a5d, 0x1bcc9, 0x07cbf, 0x1fc7f, 0x01e36,
+    0x00e5d, 0x1eec5, 0x14dc9, 0x08ddb, 0x06e86, 0x22ecb, 0x26bcd, 0x15fc9, 0x06e98, 0x06ad8, 0x23ccb, 0x1fcc5, 0x07c9e, 0x07c98, 0x07c86, 0x01c5d,
+    0x02e86, 0x16ecb, 0x02dcd, 0x1bfc9, 0x24eb8, 0x1f986, 0x019b6, 0x1ff7f, 0x0aecb, 0x039c5, 0x23cc9, 0x1fcbf, 0x07986, 0x1995d, 0x07c7f, 0x01d36,
+    0x0ed98, 0x02cd8, 0x14dcb, 0x1fac5, 0x08ecb, 0x079c5, 0x13ac9, 0x03fbf, 0x00fd0, 0x018c2, 0x1fc98, 0x1de8d, 0x1bc98, 0x05d8d, 0x19c5d, 0x01c26,
+    0x02d9e, 0x03a98, 0x03a86, 0x01a5d, 0x03986, 0x1195d, 0x01a7f, 0x01b36, 0x0fa98, 0x01b8d, 0x11a5d, 0x01a26, 0x0195d, 0x01926, 0x01836, 0x01c10,
+    0x1cf0b, 0x00827, 0x1c932, 0x0085e, 0x00a3a, 0x0c860, 0x0eb7c, 0x02887, 0x1cb1f, 0x0eb8c, 0x1ef44, 0x0eb93, 0x04b57, 0x02b95, 0x2eb83, 0x15e77,
+    0x04c3a, 0x18860, 0x18d7c, 0x06887, 0x1c885, 0x1e8a0, 0x008b7, 0x088b9, 0x16d91, 0x028c6, 0x16d9b, 0x29ea8, 0x2e7ca, 0x148cc, 0x176af, 0x15e70,
+    0x10d1f, 0x1ad8c, 0x12f44, 0x1ad93, 0x22b91, 0x068c6, 0x2eb9b, 0x2dea8, 0x1ef29, 0x1c9be, 0x1ef4e, 0x2fe66, 0x22b95, 0x2e3d7, 0x2be77, 0x2be5a,
+    0x00d57, 0x06d95, 0x1ad83, 0x21e77, 0x2a7ca, 0x1a8cc, 0x2f6af, 0x1be70, 0x16d95, 0x1f6d7, 0x2fe77, 0x21e5a, 0x2e7cc, 0x1f6d6, 0x2fe70, 0x01e54,
+    0x00e3f, 0x1cc94, 0x2ef6e, 0x1e8d1, 0x1af6b, 0x10aa6, 0x20bab, 0x2b6d3, 0x20f58, 0x00ac6, 0x2ef75, 0x2b6a9, 0x1ab73, 0x05dd2, 0x29cad, 0x0fc73,
+    0x0cc6b, 0x1cca6, 0x28dab, 0x2f6d3, 0x1ceab, 0x1f9b3, 0x2f6d4, 0x1dfab, 0x28fa6, 0x136da, 0x176b3, 0x29ea6, 0x2e7d3, 0x1dda6, 0x29cab, 0x0dd6b,
+    0x14f58, 0x04cc6, 0x2af75, 0x2f6a9, 0x2cfa6, 0x223da, 0x2f6b3, 0x2dea6, 0x2ef64, 0x1f6d8, 0x2f678, 0x2fe64, 0x2e7a9, 0x05dc6, 0x2be75, 0x15e58,
+    0x0ed73, 0x04cd2, 0x28dad, 0x1ba73, 0x2a7d3, 0x11ba6, 0x21aab, 0x1be6b, 0x2a7a9, 0x01bc6, 0x2fe75, 0x21e58, 0x1f9d1, 0x1dd94, 0x2fe6e, 0x01f3f,
+    0x1ef1c, 0x1adbc, 0x1ef3c, 0x20dc0, 0x1ab5d, 0x08bc5, 0x2eb86, 0x2b6cb, 0x22f23, 0x28bbe, 0x22f48, 0x2b699, 0x20b61, 0x27cc7, 0x2bc88, 0x15c61,
+    0x14d5d, 0x26dc5, 0x16d86, 0x2f6cb, 0x2e7c9, 0x1f6db, 0x2f6cd, 0x2f6c9, 0x2a798, 0x165d8, 0x1769e, 0x2b698, 0x2e7cb, 0x27cc5, 0x17c86, 0x15c5d,
+    0x12f23, 0x20dbe, 0x12f48, 0x2f699, 0x2e798, 0x2e3d8, 0x2f69e, 0x2f698, 0x2ef2b, 0x2e3d5, 0x2ef50, 0x2fe2b, 0x2e799, 0x21cbe, 0x13e48, 0x13e23,
+    0x14d61, 0x26dc7, 0x2ad88, 0x21a61, 0x2a7cb, 0x09ac5, 0x2fa86, 0x1ba5d, 0x2a799, 0x29abe, 0x23e48, 0x23e23, 0x21cc0, 0x1bcbc, 0x1fe3c, 0x1fe1c,
+    0x00f54, 0x1e7d6, 0x2ef70, 0x2f6cc, 0x1af70, 0x1b9cc, 0x2e7af, 0x2b6ca, 0x20f5a, 0x1e7d7, 0x2ef77, 0x17c95, 0x20f77, 0x07c95, 0x1bc83, 0x01c57,
+    0x14f70, 0x159cc, 0x167af, 0x2f6ca, 0x099b9, 0x1f9a0, 0x019b7, 0x1d985, 0x28fa8, 0x039c6, 0x17c9b, 0x17c91, 0x07987, 0x19960, 0x19c7c, 0x05d3a,
+    0x2af5a, 0x2f2d7, 0x2af77, 0x23a95, 0x2cfa8, 0x079c6, 0x2fa9b, 0x23a91, 0x2ef66, 0x1d8be, 0x1fe4e, 0x1fe29, 0x1bc93, 0x1bc8c, 0x13e44, 0x11c1f,
+    0x14f77, 0x03a95, 0x2fa83, 0x05a57, 0x03987, 0x0d960, 0x0fa7c, 0x01b3a, 0x0fa93, 0x0fa8c, 0x1fe44, 0x1da1f, 0x0195e, 0x01927, 0x1d832, 0x1de0b,
+    0x18d11, 0x00828, 0x00937, 0x0085f, 0x00a3c, 0x0c861, 0x0eb80, 0x09688, 0x10b28, 0x0098e, 0x10b5f, 0x25665, 0x00b61, 0x02b99, 0x15688, 0x25e48,
+    0x04c3c, 0x18861, 0x18d80, 0x0b688, 0x1c886, 0x1e8a1, 0x016b8, 0x09680, 0x1edc0, 0x016c7, 0x176a1, 0x25661, 0x0d6cb, 0x016c0, 0x29686, 0x09e3c,
+    0x18d28, 0x0498e, 0x18d5f, 0x27665, 0x12bc0, 0x056c7, 0x216a1, 0x27661, 0x1c98e, 0x016c3, 0x2f665, 0x25652, 0x116c7, 0x016be, 0x2b661, 0x25e23,
+    0x04d61, 0x06d99, 0x21688, 0x27e48, 0x196cb, 0x056c0, 0x21686, 0x27e3c, 0x1d6c7, 0x056be, 0x2f661, 0x27e23, 0x1d6c5, 0x016bc, 0x2f65d, 0x09e1c,
+    0x00e4b, 0x1cc96, 0x016ba, 0x096a2, 0x18a70, 0x10aa8, 0x016b9, 0x09687, 0x18f96, 0x016c8, 0x176a2, 0x25664, 0x04aa8, 0x016c1, 0x15687, 0x25e46,
+    0x10c70, 0x1cca8, 0x076b9, 0x0b687, 0x1ceaf, 0x1ff9b, 0x016b7, 0x25f7c, 0x116cc, 0x016c6, 0x176a0, 0x25660, 0x0d6ca, 0x13f91, 0x29685, 0x09e3a,
+    0x00c96, 0x056c8, 0x216a2, 0x27664, 0x196cc, 0x056c6, 0x216a0, 0x27660, 0x1d6c8, 0x016c2, 0x2f664, 0x25651, 0x116c6, 0x016bd, 0x2b660, 0x25e21,
+    0x00ca8, 0x056c1, 0x21687, 0x27e46, 0x196ca, 0x1ff91, 0x21685, 0x0be3a, 0x1d6c6, 0x056bd, 0x2f660, 0x27e21, 0x1d6c4, 0x1ff8b, 0x2f65c, 0x09e1a,
+    0x1cf3c, 0x1adc0, 0x1ed80, 0x096a1, 0x04b86, 0x016cb, 0x116b8, 0x09686, 0x1cb61, 0x0d6c7, 0x17688, 0x29661, 0x06ba1, 0x0d6c0, 0x17680, 0x29e3c,
+    0x00d86, 0x056cb, 0x196b8, 0x27686, 0x016cd, 0x016c9, 0x016b6, 0x0967f, 0x116cb, 0x016c5, 0x17686, 0x2565d, 0x116c9, 0x016bf, 0x1767f, 0x03e36,
+    0x10d61, 0x196c7, 0x23688, 0x2d661, 0x1d6cb, 0x056c5, 0x2f686, 0x2765d, 0x12d99, 0x1d6be, 0x2fe48, 0x2fe23, 0x116c0, 0x116bc, 0x17e3c, 0x17e1c,
+    0x00da1, 0x196c0, 0x21680, 0x21e3c, 0x196c9, 0x056bf, 0x2167f, 0x27e36, 0x1d6c0, 0x196bc, 0x2fe3c, 0x21e1c, 0x1d6bf, 0x016bb, 0x2fe36, 0x01e16,
+    0x00f70, 0x016cc, 0x1f6b9, 0x096a0, 0x04eaf, 0x016ca, 0x116b7, 0x09685, 0x18fa8, 0x0d6c6, 0x17687, 0x29660, 0x07c9b, 0x07c91, 0x2bc7c, 0x15e3a,
+    0x02daf, 0x056ca, 0x196b7, 0x27685, 0x259b7, 0x1f985, 0x016b5, 0x09f7a, 0x116ca, 0x016c4, 0x17685, 0x2565c, 0x07985, 0x1995c, 0x07c7a, 0x01d31,
+    0x0cfa8, 0x196c6, 0x23687, 0x2d660, 0x1d6ca, 0x056c4, 0x2f685, 0x2765c, 0x1d6c1, 0x1d6bd, 0x2fe46, 0x2fe21, 0x1bc91, 0x07c8b, 0x17e3a, 0x17e1a,
+    0x03a9b, 0x03a91, 0x2da7c, 0x21e3a, 0x03985, 0x1195c, 0x01a7a, 0x07e31, 0x0fa91, 0x03a8b, 0x23e3a, 0x21e1a, 0x0195c, 0x01925, 0x1fe31, 0x01e06,
+    0x04f0b, 0x10827, 0x0c93a, 0x00860, 0x04a32, 0x1085e, 0x00b7c, 0x0e887, 0x18b1f, 0x00a8c, 0x1eb57, 0x0eb95, 0x1af44, 0x02b93, 0x02b83, 0x09d77,
+    0x10c3a, 0x1c860, 0x04885, 0x068a0, 0x1ee7c, 0x12887, 0x108b7, 0x168b9, 0x0ae91, 0x0e8c6, 0x2c7ca, 0x028cc, 0x26e9b, 0x25da8, 0x275af, 0x03d70,
+    0x10d3f, 0x18c94, 0x1ef6b, 0x049a6, 0x26f6e, 0x068d1, 0x2ebab, 0x275d3, 0x22f58, 0x0c9c6, 0x1eb73, 0x11ed2, 0x2cf75, 0x275a9, 0x25cad, 0x03c73,
+    0x00c6b, 0x18ca6, 0x04dab, 0x07ab3, 0x08eab, 0x2d5d3, 0x267d4, 0x05fab, 0x24fa6, 0x0a6da, 0x2c7d3, 0x19ea6, 0x267b3, 0x25da6, 0x09cab, 0x03d6b,
+    0x04e1f, 0x1ee8c, 0x20b91, 0x128c6, 0x06f44, 0x1ee93, 0x20b9b, 0x2fda8, 0x06f29, 0x04abe, 0x20b95, 0x2c3d7, 0x06f4e, 0x27d66, 0x27d77, 0x09d5a,
+    0x02e57, 0x12e95, 0x267ca, 0x228cc, 0x26e83, 0x23d77, 0x215af, 0x23d70, 0x0ae95, 0x266d7, 0x267cc, 0x075d6, 0x2dd77, 0x2dd5a, 0x27d70, 0x03d54,
+    0x08f58, 0x10cc6, 0x2efa6, 0x211da, 0x26f75, 0x2d5a9, 0x207b3, 0x2fda6, 0x26f64, 0x067d8, 0x2c7a9, 0x11ec6, 0x26778, 0x27d64, 0x27d75, 0x09d58,
+    0x02e73, 0x10cd2, 0x267d3, 0x05ba6, 0x24ead, 0x1f973, 0x2f9ab, 0x1fd6b, 0x267a9, 0x0dbc6, 0x07ad1, 0x19e94, 0x2dd75, 0x23d58, 0x27d6e, 0x11f3f,
+    0x06f1c, 0x22ebc, 0x22b5d, 0x28bc5, 0x06f3c, 0x22ec0, 0x20b86, 0x275cb, 0x1af23, 0x08bbe, 0x22b61, 0x2bcc7, 0x1af48, 0x27599, 0x27c88, 0x09c61,
+    0x02e5d, 0x16ec5, 0x267c9, 0x067db, 0x26e86, 0x2d5cb, 0x267cd, 0x275c9, 0x26798, 0x266d8, 0x2c7cb, 0x17cc5, 0x2679e, 0x27598, 0x27c86, 0x03c5d,
+    0x02f54, 0x067d6, 0x22f70, 0x23acc, 0x26f70, 0x275cc, 0x207af, 0x275ca, 0x2cf5a, 0x1a7d7, 0x22f77, 0x13c95, 0x2cf77, 0x0bc95, 0x27c83, 0x03c57,
+    0x02f70, 0x03acc, 0x17ab9, 0x07aa0, 0x267af, 0x2d5ca, 0x11ab7, 0x05a85, 0x24fa8, 0x0fac6, 0x13a87, 0x1da60, 0x27c9b, 0x0bc91, 0x1fc7c, 0x11e3a,
+    0x0af23, 0x2eebe, 0x2c798, 0x211d8, 0x0af48, 0x2d599, 0x2079e, 0x2d598, 0x26f2b, 0x211d5, 0x2c799, 0x2fcbe, 0x27d50, 0x27d2b, 0x0bd48, 0x0bd23,
+    0x08e61, 0x2aec7, 0x267cb, 0x299c5, 0x26e88, 0x23961, 0x21986, 0x2395d, 0x26799, 0x099be, 0x23cc0, 0x23cbc, 0x1bd48, 0x1bd23, 0x07d3c, 0x07d1c,
+    0x08f5a, 0x2d1d7, 0x2efa8, 0x13ac6, 0x26f77, 0x21995, 0x2199b, 0x21991, 0x26f66, 0x058be, 0x1fc93, 0x1fc8c, 0x07d4e, 0x07d29, 0x07d44, 0x05c1f,
+    0x08f77, 0x0f995, 0x0fa87, 0x01a60, 0x03983, 0x1f957, 0x0197c, 0x0db3a, 0x03993, 0x0398c, 0x11a5e, 0x11a27, 0x1bd44, 0x1991f, 0x05832, 0x05d0b,
+    0x18e11, 0x10828, 0x0093c, 0x00861, 0x00a37, 0x1085f, 0x00b80, 0x15588, 0x00b28, 0x00a8e, 0x0cb61, 0x0eb99, 0x00b5f, 0x25565, 0x09588, 0x25d48,
+    0x1cc3c, 0x1c861, 0x04886, 0x068a1, 0x1ee80, 0x17588, 0x115b8, 0x17580, 0x1aec0, 0x0d5c7, 0x015cb, 0x0d5c0, 0x095a1, 0x29561, 0x09586, 0x29d3c,
+    0x00d4b, 0x18c96, 0x18970, 0x049a8, 0x015ba, 0x175a2, 0x015b9, 0x15587, 0x1cf96, 0x015c8, 0x109a8, 0x015c1, 0x095a2, 0x25564, 0x09587, 0x25d46,
+    0x00c70, 0x18ca8, 0x04daf, 0x07f9b, 0x1f5b9, 0x17587, 0x115b7, 0x2bf7c, 0x015cc, 0x0d5c6, 0x015ca, 0x07f91, 0x095a0, 0x29560, 0x09585, 0x15d3a,
+    0x18e28, 0x1ca8e, 0x06bc0, 0x115c7, 0x18e5f, 0x2f565, 0x215a1, 0x2b561, 0x04a8e, 0x015c3, 0x055c7, 0x015be, 0x27565, 0x25552, 0x27561, 0x25d23,
+    0x10e61, 0x12e99, 0x1d5cb, 0x115c0, 0x23588, 0x2fd48, 0x2f586, 0x17d3c, 0x195c7, 0x1d5be, 0x055c5, 0x115bc, 0x2d561, 0x2fd23, 0x2755d, 0x17d1c,
+    0x0cc96, 0x1d5c8, 0x195cc, 0x115c6, 0x215a2, 0x2f564, 0x215a0, 0x2b560, 0x055c8, 0x015c2, 0x055c6, 0x015bd, 0x27564, 0x25551, 0x27560, 0x25d21,
+    0x0cca8, 0x1d5c1, 0x1d5ca, 0x1bf91, 0x23587, 0x2fd46, 0x2f585, 0x17d3a, 0x195c6, 0x1d5bd, 0x055c4, 0x07f8b, 0x2d560, 0x2fd21, 0x2755c, 0x17d1a,
+    0x04f3c, 0x1eec0, 0x1cb86, 0x0d5cb, 0x18e80, 0x175a1, 0x015b8, 0x29586, 0x18b61, 0x015c7, 0x1eba1, 0x015c0, 0x0b588, 0x25561, 0x09580, 0x09d3c,
+    0x00e86, 0x115cb, 0x015cd, 0x115c9, 0x195b8, 0x17586, 0x015b6, 0x1757f, 0x055cb, 0x015c5, 0x015c9, 0x015bf, 0x27586, 0x2555d, 0x0957f, 0x03d36,
+    0x10f70, 0x115cc, 0x1cdaf, 0x0d5ca, 0x075b9, 0x175a0, 0x015b7, 0x29585, 0x1cfa8, 0x015c6, 0x1fc9b, 0x13c91, 0x0b587, 0x25560, 0x25c7c, 0x09d3a,
+    0x00daf, 0x115ca, 0x25ab7, 0x07a85, 0x195b7, 0x17585, 0x015b5, 0x07f7a, 0x055ca, 0x015c4, 0x1fa85, 0x19a5c, 0x27585, 0x2555c, 0x09c7a, 0x03d31,
+    0x04e61, 0x1d5c7, 0x195cb, 0x1d5c5, 0x21588, 0x2f561, 0x21586, 0x2f55d, 0x06e99, 0x055be, 0x055c0, 0x015bc, 0x27d48, 0x27d23, 0x27d3c, 0x09d1c,
+    0x00ea1, 0x1d5c0, 0x195c9, 0x1d5bf, 0x21580, 0x2fd3c, 0x2157f, 0x2fd36, 0x195c0, 0x195bc, 0x055bf, 0x015bb, 0x21d3c, 0x21d1c, 0x27d36, 0x01d16,
+    0x00fa8, 0x1d5c6, 0x195ca, 0x1d5c4, 0x21587, 0x2f560, 0x21585, 0x2f55c, 0x055c1, 0x055bd, 0x1fc91, 0x1fc8b, 0x27d46, 0x27d21, 0x0bd3a, 0x09d1a,
+    0x0399b, 0x0f991, 0x03a85, 0x01a5c, 0x2d97c, 0x23d3a, 0x0197a, 0x1fd31, 0x03991, 0x0398b, 0x11a5c, 0x01a25, 0x21d3a, 0x21d1a, 0x07d31, 0x01d06,
+    0x18b0e, 0x00829, 0x0c93b, 0x00862, 0x00a3b, 0x0c862, 0x00b7e, 0x02889, 0x18b22, 0x02b8e, 0x10b59, 0x15497, 0x04b59, 0x09497, 0x25471, 0x25c4d,
+    0x18c46, 0x18864, 0x04887, 0x068a2, 0x10887, 0x108a2, 0x008b9, 0x028ba, 0x028c1, 0x034c8, 0x154a8, 0x15496, 0x094a8, 0x09496, 0x25470, 0x03c4b,
+    0x10d43, 0x04995, 0x1c96c, 0x2f6a7, 0x22ba5, 0x0b5d2, 0x2f6b1, 0x2f6a5, 0x1ef62, 0x0f4c7, 0x2b676, 0x2be62, 0x094a7, 0x09495, 0x2946c, 0x15c43,
+    0x00d73, 0x18ca9, 0x236ad, 0x21e75, 0x075d3, 0x275d1, 0x2f6ab, 0x1be6e, 0x0f4d2, 0x0f4c6, 0x2b673, 0x2fe58, 0x094a6, 0x09494, 0x2946b, 0x15c3f,
+    0x04e43, 0x10a95, 0x20ba5, 0x176d2, 0x18a6c, 0x2d5a7, 0x215b1, 0x2d5a5, 0x1af62, 0x034c7, 0x154a7, 0x15495, 0x27576, 0x27d62, 0x2546c, 0x09c43,
+    0x0ce73, 0x1cca9, 0x136d3, 0x176d1, 0x215ad, 0x23d75, 0x215ab, 0x23d6e, 0x034d2, 0x034c6, 0x154a6, 0x15494, 0x27573, 0x2dd58, 0x2546b, 0x03c3f,
+    0x00f84, 0x18ccc, 0x236b2, 0x2f6a6, 0x215b2, 0x2d5a6, 0x2f6b0, 0x2f6a4, 0x20fa2, 0x034c5, 0x2b675, 0x2be60, 0x27575, 0x27d60, 0x25469, 0x03c39,
+    0x00cae, 0x01bd1, 0x236ac, 0x21e72, 0x215ac, 0x23d72, 0x2f6aa, 0x19f68, 0x034d1, 0x034c4, 0x2b672, 0x21e56, 0x27572, 0x2dd56, 0x25c68, 0x03c33,
+    0x18f23, 0x02bbe, 0x1eb61, 0x176c7, 0x1ab61, 0x0b5c7, 0x20ba1, 0x176c0, 0x18b52, 0x034c3, 0x22b65, 0x2948e, 0x1ab65, 0x0948e, 0x25c5f, 0x25c28,
+    0x0cd98, 0x014d8, 0x136cb, 0x176c5, 0x075cb, 0x275c5, 0x136c9, 0x176bf, 0x034d0, 0x034c2, 0x17698, 0x2948d, 0x0b598, 0x0948d, 0x25c5d, 0x03c26,
+    0x1ef5a, 0x232d7, 0x1ef77, 0x2f695, 0x20fa8, 0x0b5c6, 0x2f69b, 0x2f691, 0x22f66, 0x294be, 0x17e4e, 0x17e29, 0x27c93, 0x2548c, 0x17e44, 0x15c1f,
+    0x0efa8, 0x25ac6, 0x2fa87, 0x21a60, 0x075ca, 0x275c4, 0x2fa85, 0x1ba5c, 0x29ac1, 0x294bd, 0x23e46, 0x23e21, 0x27c91, 0x27c8b, 0x13e3a, 0x11e1a,
+    0x04f5a, 0x211d7, 0x22fa8, 0x176c6, 0x1af77, 0x2d595, 0x2159b, 0x2d591, 0x1af66, 0x094be, 0x2bc93, 0x2948c, 0x27d4e, 0x27d29, 0x0bd44, 0x09c1f,
+    0x02fa8, 0x299c6, 0x136ca, 0x176c4, 0x2d987, 0x23960, 0x21985, 0x2395c, 0x099c1, 0x094bd, 0x2bc91, 0x17c8b, 0x1bd46, 0x1bd21, 0x07d3a, 0x07d1a,
+    0x00f9f, 0x211d6, 0x2369c, 0x2f694, 0x2159c, 0x2d594, 0x2f69a, 0x2f690, 0x20fa3, 0x254bc, 0x13e4c, 0x13e27, 0x0bd4c, 0x0bd27, 0x0bd40, 0x01c19,
+    0x0fa9c, 0x03a94, 0x2fa82, 0x05a56, 0x03982, 0x1f956, 0x0fa7b, 0x01b38, 0x0fa92, 0x0188b, 0x1fe42, 0x1fe1e, 0x1bd42, 0x1bd1e, 0x19830, 0x01c09,
+    0x00b12, 0x0082a, 0x0093d, 0x03663, 0x00a3d, 0x0f563, 0x01681, 0x0373d, 0x00b2a, 0x0168f, 0x0f663, 0x0362a, 0x03563, 0x0352a, 0x0343d, 0x03612,
+    0x18c48, 0x18865, 0x01688, 0x0365f, 0x0d588, 0x1555f, 0x01680, 0x03737, 0x0d699, 0x0378e, 0x0f661, 0x03628, 0x03561, 0x15528, 0x0343c, 0x03611,
+    0x18d4d, 0x01697, 0x18971, 0x09659, 0x01589, 0x0f562, 0x0167e, 0x0373b, 0x0d697, 0x0168e, 0x15659, 0x25622, 0x03562, 0x03529, 0x0f43b, 0x2560e,
+    0x04c77, 0x01693, 0x01683, 0x27e44, 0x0d587, 0x1555e, 0x0167c, 0x09732, 0x0d695, 0x0168c, 0x2b657, 0x2561f, 0x03560, 0x15527, 0x0f43a, 0x09e0b,
+    0x18e4d, 0x0d597, 0x01689, 0x03662, 0x18a71, 0x15559, 0x0157e, 0x0f73b, 0x01597, 0x0158e, 0x0f662, 0x03629, 0x09559, 0x25522, 0x0343b, 0x2550e,
+    0x10c77, 0x0d593, 0x01687, 0x0365e, 0x23583, 0x2bd44, 0x0f57c, 0x29732, 0x01595, 0x0f78c, 0x0f660, 0x03627, 0x09557, 0x2951f, 0x0343a, 0x29d0b,
+    0x0169d, 0x01696, 0x01684, 0x09658, 0x01584, 0x15558, 0x0167d, 0x03739, 0x0d696, 0x0168d, 0x15658, 0x25621, 0x09558, 0x25521, 0x03439, 0x2560d,
+    0x0169c, 0x01692, 0x01682, 0x27e42, 0x23582, 0x2bd42, 0x0167b, 0x25730, 0x0d694, 0x0378b, 0x2b656, 0x2561e, 0x09556, 0x2951e, 0x03438, 0x03f09,
+    0x18f48, 0x01699, 0x0d688, 0x03661, 0x01588, 0x0f561, 0x0f680, 0x0373c, 0x18b65, 0x0348e, 0x1565f, 0x15628, 0x0355f, 0x03528, 0x03437, 0x15611,
+    0x0169e, 0x01698, 0x01686, 0x0365d, 0x01586, 0x1555d, 0x0167f, 0x03736, 0x0d698, 0x0378d, 0x1565d, 0x03626, 0x0355d, 0x03526, 0x03436, 0x03610,
+    0x10f77, 0x01695, 0x23683, 0x09657, 0x01587, 0x0f560, 0x0f67c, 0x0373a, 0x0d693, 0x0d68c, 0x2be44, 0x2961f, 0x0355e, 0x03527, 0x29432, 0x29e0b,
+    0x0169b, 0x01691, 0x2167c, 0x2de3a, 0x01585, 0x1555c, 0x0167a, 0x09731, 0x0d691, 0x0168b, 0x2fe3a, 0x2de1a, 0x0355c, 0x03525, 0x29431, 0x03e06,
+    0x04f77, 0x0d595, 0x0d687, 0x03660, 0x01583, 0x2b557, 0x0157c, 0x0f73a, 0x01593, 0x0158c, 0x1565e, 0x15627, 0x27d44, 0x2551f, 0x09432, 0x09d0b,
+    0x0159b, 0x0d591, 0x01685, 0x0365c, 0x2157c, 0x2fd3a, 0x0157a, 0x29731, 0x01591, 0x0158b, 0x1565c, 0x03625, 0x2dd3a, 0x2dd1a, 0x09431, 0x03d06,
+    0x0d69c, 0x01694, 0x23682, 0x09656, 0x01582, 0x2b556, 0x0f67b, 0x03738, 0x0d692, 0x0348b, 0x2be42, 0x2961e, 0x27d42, 0x2551e, 0x25430, 0x03c09,
+    0x0169a, 0x01690, 0x2167b, 0x21e38, 0x2157b, 0x2fd38, 0x01679, 0x2572f, 0x0d690, 0x0168a, 0x2fe38, 0x21e18, 0x21d38, 0x21d18, 0x2542f, 0x01d03,
+    0x00c04, 0x20c19, 0x0ac30, 0x20c39, 0x12c30, 0x2ec39, 0x2c47b, 0x2047d, 0x2473e, 0x0e690, 0x12d68, 0x025a4, 0x0ae68, 0x0e6a4, 0x027aa, 0x004b0,
+    0x02c07, 0x2cc1b, 0x26c32, 0x2cc3b, 0x16c32, 0x2ec3b, 0x2c47c, 0x2047e, 0x0274a, 0x0e692, 0x1456e, 0x004a5, 0x0266e, 0x0c4a5, 0x004ab, 0x004b1,
+    0x08c0a, 0x26c1f, 0x24534, 0x26c43, 0x14642, 0x2a458, 0x02482, 0x20484, 0x28742, 0x02591, 0x1456a, 0x025a5, 0x02672, 0x0c4a6, 0x0e7ac, 0x004b2,
+    0x08c0c, 0x24420, 0x08535, 0x26c45, 0x14644, 0x2a459, 0x02483, 0x0bb71, 0x1474c, 0x02593, 0x1456f, 0x07a74, 0x02675, 0x0c4a7, 0x004ad, 0x07b6c,
+    0x14c0a, 0x2ac1f, 0x08542, 0x26458, 0x28634, 0x2ac43, 0x2e482, 0x2e484, 0x24742, 0x0e691, 0x14772, 0x004a6, 0x0866a, 0x0e6a5, 0x027ac, 0x0c4b2,
+    0x28c0c, 0x28420, 0x08544, 0x26459, 0x28635, 0x2ac45, 0x2e483, 0x13b71, 0x0274c, 0x0e693, 0x0e575, 0x004a7, 0x0266f, 0x17b74, 0x0c4ad, 0x13b6c,
+    0x24c0e, 0x24423, 0x08543, 0x0845a, 0x14643, 0x2a45a, 0x02484, 0x0049f, 0x24746, 0x0e698, 0x0e573, 0x004a8, 0x02673, 0x0c4a8, 0x027ae, 0x0dd9c,
+    0x2440f, 0x24424, 0x08545, 0x0845b, 0x14645, 0x2a45b, 0x25b71, 0x25b55, 0x0274e, 0x25b65, 0x0e576, 0x0bb59, 0x02676, 0x17b59, 0x25b6f, 0x19f41,
+    0x02f0b, 0x24427, 0x2453a, 0x08460, 0x2863a, 0x14460, 0x02485, 0x004a0, 0x2473f, 0x0e694, 0x1456b, 0x025a6, 0x0866b, 0x0e6a6, 0x027ab, 0x004b3,
+    0x24411, 0x24428, 0x0853c, 0x08461, 0x2863c, 0x14461, 0x02486, 0x004a1, 0x0274b, 0x0e696, 0x14570, 0x025a8, 0x02670, 0x0e6a8, 0x027af, 0x01f9b,
+    0x14d0e, 0x08429, 0x2453b, 0x08462, 0x14646, 0x14464, 0x02487, 0x004a2, 0x28743, 0x02595, 0x1456c, 0x025a7, 0x08773, 0x0e6a9, 0x0e7ad, 0x11e75,
+    0x08412, 0x0842a, 0x0853d, 0x08463, 0x14648, 0x14465, 0x02488, 0x0ba5f, 0x1474d, 0x02597, 0x14571, 0x07a59, 0x02677, 0x09a93, 0x09a83, 0x19e44,
+    0x02e0e, 0x28429, 0x02546, 0x02464, 0x2863b, 0x14462, 0x0e487, 0x0e4a2, 0x24743, 0x0e695, 0x14773, 0x025a9, 0x0866c, 0x0e6a7, 0x027ad, 0x05d75,
+    0x28412, 0x2842a, 0x02548, 0x02465, 0x2863d, 0x14463, 0x0e488, 0x1395f, 0x0274d, 0x0e697, 0x0e577, 0x15993, 0x02671, 0x13959, 0x05983, 0x1dd44,
+    0x02413, 0x0242b, 0x02547, 0x02466, 0x14647, 0x14466, 0x02489, 0x004a3, 0x24747, 0x0e699, 0x14774, 0x11893, 0x02674, 0x05893, 0x1986f, 0x19c4c,
+    0x02414, 0x0242c, 0x02549, 0x03b24, 0x14649, 0x15b24, 0x03b3d, 0x01b1d, 0x0274f, 0x03b2a, 0x03b45, 0x01a20, 0x0fb45, 0x0fb20, 0x03b35, 0x01b0c,
+    0x00c07, 0x20c1b, 0x06c32, 0x20c3b, 0x1ec32, 0x22c3b, 0x2087c, 0x2087e, 0x00b4a, 0x0ca92, 0x1096e, 0x028a5, 0x00a6e, 0x0e8a5, 0x028ab, 0x03fb1,
+    0x00c17, 0x20c1d, 0x26c37, 0x20c3d, 0x2ec37, 0x2ec3d, 0x2c480, 0x21381, 0x013ce, 0x213a3, 0x273ba, 0x21389, 0x2f3ba, 0x2f389, 0x213b9, 0x21f7e,
+    0x08c1b, 0x26c22, 0x0ac3b, 0x26c47, 0x2e45e, 0x2e462, 0x2c487, 0x20489, 0x10f92, 0x049c1, 0x1eda5, 0x053cf, 0x1c4d1, 0x193d2, 0x053d3, 0x03fa5,
+    0x08c1d, 0x26c24, 0x26c3d, 0x26c49, 0x2e45f, 0x2d363, 0x27388, 0x21b3d, 0x093a3, 0x27366, 0x27389, 0x27b47, 0x253a2, 0x2d362, 0x27387, 0x21b3b,
+    0x16c1b, 0x2ec22, 0x2645e, 0x2c462, 0x16c3b, 0x2ec47, 0x2e487, 0x2e489, 0x04f92, 0x1cac1, 0x044d1, 0x1d3d2, 0x1aea5, 0x1d3cf, 0x113d3, 0x0ffa5,
+    0x16c1d, 0x2ec24, 0x2645f, 0x2f363, 0x16c3d, 0x2ec49, 0x2b388, 0x2fb3d, 0x173a3, 0x2f366, 0x2b3a2, 0x2f362, 0x17389, 0x2fb47, 0x2b387, 0x23b3b,
+    0x24c22, 0x24c52, 0x26462, 0x26466, 0x2a462, 0x2e466, 0x2c4a2, 0x204a3, 0x00fc1, 0x013d0, 0x013d2, 0x05ec1, 0x0d3d2, 0x1ddc1, 0x013d1, 0x0dd92,
+    0x24c24, 0x25353, 0x25363, 0x27b24, 0x29363, 0x2fb24, 0x2535f, 0x21b1d, 0x25366, 0x25b52, 0x25362, 0x27b22, 0x29362, 0x2fb22, 0x2535e, 0x21b1b,
+    0x02c32, 0x2445e, 0x08d7c, 0x26487, 0x16e7c, 0x2a487, 0x244b7, 0x204b9, 0x18f6e, 0x004d1, 0x1edab, 0x193d3, 0x06eab, 0x1d3d3, 0x013d4, 0x03fab,
+    0x02c37, 0x2445f, 0x24480, 0x2d388, 0x2a480, 0x2f388, 0x253b8, 0x2d380, 0x033ba, 0x2d3a2, 0x093b9, 0x2d387, 0x173b9, 0x2f387, 0x253b7, 0x21f7c,
+    0x08c3b, 0x24462, 0x08d7e, 0x26489, 0x28487, 0x2a4a2, 0x084b9, 0x264ba, 0x12da5, 0x053d2, 0x1edb1, 0x1faa5, 0x013d3, 0x053d1, 0x1faab, 0x11e6e,
+    0x08c3d, 0x27363, 0x09381, 0x27b3d, 0x25388, 0x2735f, 0x25380, 0x27b37, 0x09389, 0x27362, 0x09a7e, 0x0bb3b, 0x25387, 0x2735e, 0x09a7c, 0x07b32,
+    0x14c3b, 0x28462, 0x24487, 0x244a2, 0x16e7e, 0x16489, 0x164b9, 0x2e4ba, 0x06ea5, 0x113d2, 0x0d3d3, 0x1d3d1, 0x06eb1, 0x1b9a5, 0x079ab, 0x01d6e,
+    0x28c3d, 0x2b363, 0x29388, 0x2f35f, 0x17381, 0x17b3d, 0x2b380, 0x2fb37, 0x29389, 0x2b362, 0x29387, 0x2f35e, 0x1797e, 0x17b3b, 0x1797c, 0x1fb32,
+    0x24c47, 0x24466, 0x08489, 0x084a3, 0x28489, 0x164a3, 0x024ba, 0x004ce, 0x013cf, 0x018c1, 0x13aa5, 0x1de92, 0x079a5, 0x19d92, 0x1986e, 0x01c4a,
+    0x24c49, 0x25b24, 0x09b3d, 0x09b1d, 0x29b3d, 0x17b1d, 0x03b37, 0x01b17, 0x25b47, 0x25b22, 0x09b3b, 0x09b1b, 0x15b3b, 0x17b1b, 0x03b32, 0x01b07,
+    0x04c0a, 0x1ac1f, 0x06c34, 0x1ac43, 0x10a42, 0x1e858, 0x00882, 0x20884, 0x1cb42, 0x00991, 0x12d6a, 0x009a5, 0x00a72, 0x0e8a6, 0x0cbac, 0x03eb2,
+    0x06c1b, 0x1ac22, 0x06c3b, 0x1ac47, 0x2285e, 0x22862, 0x20887, 0x20889, 0x28592, 0x085c1, 0x2ada5, 0x093cf, 0x288d1, 0x253d2, 0x093d3, 0x01fa5,
+    0x00d1b, 0x0ac28, 0x0ac41, 0x0ac4d, 0x2c492, 0x2c496, 0x2c49c, 0x2129d, 0x12f5e, 0x245c0, 0x12d6f, 0x21e89, 0x20fd1, 0x0b2cc, 0x212ae, 0x21e84,
+    0x0ac20, 0x26c2a, 0x0ac45, 0x26c4f, 0x2c493, 0x2c497, 0x27277, 0x0ba4d, 0x28593, 0x0b299, 0x27274, 0x1ba47, 0x093a9, 0x27b95, 0x2da73, 0x1ba43,
+    0x02d34, 0x2cc57, 0x26c6a, 0x2cc73, 0x1ec6a, 0x22c73, 0x2c4ac, 0x204ae, 0x04f82, 0x085ca, 0x285ac, 0x085d3, 0x06fac, 0x1ddd3, 0x200d9, 0x0ddac,
+    0x02d41, 0x2cc59, 0x26c6c, 0x26474, 0x22c6f, 0x22c76, 0x293ad, 0x13b6f, 0x2859c, 0x293a8, 0x293b2, 0x2bba5, 0x293ae, 0x17b73, 0x293ac, 0x11f6a,
+    0x02d3b, 0x26c61, 0x24d6c, 0x26477, 0x2eca5, 0x2c4a8, 0x2d2b2, 0x2d29c, 0x14f87, 0x0b2cb, 0x2d2ad, 0x21e87, 0x0b2d3, 0x0b2ca, 0x2d2ac, 0x01e82,
+    0x08d45, 0x26c63, 0x2536d, 0x0ba45, 0x25374, 0x29b59, 0x25b6c, 0x0ba41, 0x25377, 0x25b61, 0x27a6c, 0x07a3b, 0x29b73, 0x17b57, 0x27a6a, 0x19f34,
+    0x0ed1f, 0x08c8c, 0x16d57, 0x26d95, 0x04e91, 0x264c6, 0x0a4ca, 0x0a4cc, 0x12f58, 0x245c6, 0x16d73, 0x245d2, 0x1afa6, 0x013da, 0x11cd3, 0x0fea6,
+    0x02d28, 0x08c8e, 0x24d61, 0x0a499, 0x264c0, 0x253c7, 0x093cb, 0x253c0, 0x28596, 0x093c8, 0x285a8, 0x093c1, 0x033cc, 0x253c6, 0x093ca, 0x01f91,
+    0x14d22, 0x26d8e, 0x28d59, 0x2d297, 0x264c1, 0x272c8, 0x2d2a8, 0x2d296, 0x16f62, 0x272c7, 0x16d76, 0x23e62, 0x272d2, 0x272c6, 0x23a73, 0x1fe58,
+    0x08d2a, 0x0938f, 0x24d63, 0x27a2a, 0x09399, 0x27b8e, 0x27a61, 0x0ba28, 0x28597, 0x09a8e, 0x2da59, 0x1ba22, 0x25a95, 0x09a8c, 0x2da57, 0x1ba1f,
+    0x0ed43, 0x24c95, 0x28d73, 0x085a9, 0x04ea5, 0x264d2, 0x0a4d3, 0x219d1, 0x28f84, 0x025cc, 0x285ae, 0x29ed1, 0x06fb2, 0x1b9a6, 0x19cac, 0x01c72,
+    0x02d4d, 0x29397, 0x24577, 0x29393, 0x29989, 0x17962, 0x15987, 0x1395e, 0x2939d, 0x29396, 0x2939c, 0x29392, 0x29984, 0x13958, 0x05982, 0x1dd42,
+    0x14d47, 0x08599, 0x24574, 0x2d293, 0x272cf, 0x272c1, 0x2faa5, 0x2d292, 0x28f89, 0x272c0, 0x23a6f, 0x23e5e, 0x058a5, 0x05891, 0x1fa6a, 0x11c42,
+    0x08d4f, 0x09b2a, 0x09b45, 0x0ba20, 0x15b47, 0x15b22, 0x03b3b, 0x01b1b, 0x03b4d, 0x03b28, 0x03b41, 0x07a1b, 0x0fb43, 0x0fb1f, 0x03b34, 0x05a0a,
+    0x04c0c, 0x1ac20, 0x06c35, 0x1ac45, 0x10a44, 0x1e859, 0x00883, 0x0b771, 0x10b4c, 0x00993, 0x1096f, 0x0b674, 0x00a75, 0x1b7a7, 0x076ad, 0x0b76c,
+    0x06c1d, 0x1ac24, 0x06c3d, 0x1b749, 0x2285f, 0x21363, 0x1b388, 0x2173d, 0x073a3, 0x1b366, 0x07389, 0x1b747, 0x193a2, 0x21362, 0x1b387, 0x2d73b,
+    0x06c20, 0x06c2a, 0x06c45, 0x0764f, 0x20893, 0x1b797, 0x1b277, 0x0b64d, 0x1c993, 0x07299, 0x1b274, 0x27647, 0x053a9, 0x1b795, 0x21673, 0x27643,
+    0x0ac24, 0x2732c, 0x0b249, 0x27314, 0x0b365, 0x2132a, 0x0b248, 0x21312, 0x0b366, 0x2732b, 0x0b247, 0x27313, 0x0b364, 0x21329, 0x0b246, 0x0bf0e,
+    0x10e41, 0x22c59, 0x26c6f, 0x07776, 0x1ec6c, 0x22c74, 0x193ad, 0x0b76f, 0x04f9c, 0x193a8, 0x053ae, 0x07773, 0x193b2, 0x1b7a5, 0x193ac, 0x0b76a,
+    0x02c55, 0x2135b, 0x26c71, 0x21745, 0x22c71, 0x2fb45, 0x1b383, 0x21735, 0x0739f, 0x2135a, 0x07384, 0x21743, 0x17384, 0x2fb43, 0x1b382, 0x2d734,
+    0x08c59, 0x26c65, 0x1b276, 0x0764e, 0x053a7, 0x1b793, 0x1b275, 0x0b64c, 0x053a8, 0x07298, 0x1b273, 0x27646, 0x053a6, 0x1b791, 0x1b272, 0x27642,
+    0x2535b, 0x27324, 0x0b245, 0x2730f, 0x25359, 0x2d320, 0x0b244, 0x21b0c, 0x2535a, 0x27323, 0x0b243, 0x27b0e, 0x25358, 0x2fb1f, 0x0b242, 0x1bf0a,
+    0x0cf44, 0x0ad93, 0x0ad83, 0x07777, 0x04e9b, 0x1b7a8, 0x053af, 0x0b770, 0x1cf75, 0x193a9, 0x1b6ad, 0x0b673, 0x053b3, 0x1b7a6, 0x076ab, 0x0b76b,
+    0x02d5f, 0x1b365, 0x07388, 0x1b748, 0x073a1, 0x21361, 0x07386, 0x2173c, 0x073a2, 0x1b364, 0x07387, 0x1b746, 0x073a0, 0x21360, 0x07385, 0x2d73a,
+    0x02d59, 0x07297, 0x1b271, 0x1b64d, 0x072a8, 0x07296, 0x1b270, 0x2764b, 0x072a7, 0x07295, 0x2126c, 0x2d643, 0x072a6, 0x07294, 0x2126b, 0x2763f,
+    0x0b363, 0x2732a, 0x2723d, 0x27312, 0x0b361, 0x27328, 0x2723c, 0x27311, 0x0b362, 0x27329, 0x2723b, 0x1ba0e, 0x0b360, 0x27327, 0x2723a, 0x07e0b,
+    0x02c6c, 0x193a7, 0x053ad, 0x07775, 0x053b1, 0x193a5, 0x053ab, 0x0b76e, 0x053b2, 0x193a6, 0x053ac, 0x0b672, 0x053b0, 0x193a4, 0x053aa, 0x03f68,
+    0x02c71, 0x2f359, 0x07383, 0x21744, 0x1737e, 0x2bb3b, 0x2b37c, 0x2fb32, 0x29384, 0x2f358, 0x07382, 0x21742, 0x1737d, 0x17b39, 0x2b37b, 0x23b30,
+    0x08c74, 0x07293, 0x1b26f, 0x1b64c, 0x053a5, 0x07292, 0x1b26e, 0x2764a, 0x072a5, 0x07291, 0x2126a, 0x2d642, 0x053a4, 0x07290, 0x23a68, 0x2763e,
+    0x25b45, 0x27320, 0x27235, 0x27b0c, 0x29b3b, 0x2bb1b, 0x09b32, 0x27b07, 0x25b43, 0x25b1f, 0x27234, 0x07a0a, 0x29b39, 0x17b19, 0x03b30, 0x07b04,
+    0x10c0a, 0x1ec1f, 0x04942, 0x1a858, 0x12c34, 0x1ec43, 0x22882, 0x2e884, 0x18b42, 0x0ca91, 0x10b72, 0x028a6, 0x06e6a, 0x0caa5, 0x00bac, 0x0fdb2,
+    0x10c1b, 0x22c22, 0x1a85e, 0x20862, 0x12c3b, 0x22c47, 0x22887, 0x2e889, 0x24692, 0x286c1, 0x088d1, 0x293d2, 0x26ea5, 0x293cf, 0x153d3, 0x0dfa5,
+    0x00d34, 0x20c57, 0x1ac6a, 0x20c73, 0x2ac6a, 0x2ec73, 0x2e4ac, 0x2e4ae, 0x08f82, 0x146ca, 0x12fac, 0x19ed3, 0x246ac, 0x146d3, 0x2c0d9, 0x0fdac,
+    0x14e41, 0x2ec59, 0x1ac6f, 0x20c76, 0x2ac6c, 0x2a474, 0x253ad, 0x0bb6f, 0x2469c, 0x253a8, 0x093ae, 0x0bb73, 0x253b2, 0x27ba5, 0x253ac, 0x05f6a,
+    0x0ee1b, 0x12c28, 0x2e492, 0x2e496, 0x12c41, 0x12c4d, 0x2e49c, 0x2f19d, 0x0af5e, 0x286c0, 0x2efd1, 0x131cc, 0x0ae6f, 0x2fd89, 0x2f1ae, 0x2fd84,
+    0x16c20, 0x16c2a, 0x2e493, 0x2e497, 0x16c45, 0x16c4f, 0x2b177, 0x1394d, 0x24693, 0x17199, 0x171a9, 0x2bb95, 0x2b174, 0x23947, 0x2f973, 0x1f943,
+    0x0ee3b, 0x2ac61, 0x2cca5, 0x2e4a8, 0x28e6c, 0x2a477, 0x2f1b2, 0x2f19c, 0x08f87, 0x171cb, 0x171d3, 0x171ca, 0x2f1ad, 0x23d87, 0x2f1ac, 0x23d82,
+    0x14e45, 0x2ac63, 0x29374, 0x25b59, 0x2b16d, 0x17945, 0x29b6c, 0x13941, 0x29377, 0x29b61, 0x25b73, 0x25b57, 0x2b96c, 0x1393b, 0x29b6a, 0x1df34,
+    0x02e1f, 0x14c8c, 0x10d91, 0x2a4c6, 0x24e57, 0x2ae95, 0x164ca, 0x124cc, 0x06f58, 0x286c6, 0x1efa6, 0x111da, 0x0ae73, 0x286d2, 0x05cd3, 0x03da6,
+    0x14e28, 0x28c8e, 0x2a4c0, 0x293c7, 0x28e61, 0x16499, 0x153cb, 0x293c0, 0x24696, 0x293c8, 0x153cc, 0x293c6, 0x246a8, 0x293c1, 0x153ca, 0x0df91,
+    0x02e43, 0x28c95, 0x10da5, 0x2a4d2, 0x24e73, 0x146a9, 0x164d3, 0x2fad1, 0x08f84, 0x146cc, 0x12fb2, 0x1faa6, 0x086ae, 0x09dd1, 0x1dcac, 0x0dc72,
+    0x14e4d, 0x25397, 0x09a89, 0x0ba62, 0x28677, 0x25393, 0x09a87, 0x0ba5e, 0x0939d, 0x25396, 0x09a84, 0x07a58, 0x2539c, 0x25392, 0x09a82, 0x19e42,
+    0x02e22, 0x16e8e, 0x164c1, 0x171c8, 0x24e59, 0x2f197, 0x2f1a8, 0x2f196, 0x0af62, 0x2b1c7, 0x2b1d2, 0x2b1c6, 0x0ae76, 0x21d62, 0x21973, 0x1bd58,
+    0x28e2a, 0x1718f, 0x15399, 0x17b8e, 0x28e63, 0x1792a, 0x2b961, 0x13928, 0x24697, 0x2998e, 0x29995, 0x17b8c, 0x2f959, 0x23922, 0x21957, 0x1f91f,
+    0x02e47, 0x14699, 0x171cf, 0x171c1, 0x28674, 0x2f193, 0x2d9a5, 0x2f192, 0x08f89, 0x2b1c0, 0x118a5, 0x11891, 0x1b96f, 0x1bd5e, 0x1b96a, 0x05c42,
+    0x28e4f, 0x29b2a, 0x03b47, 0x03b22, 0x15b45, 0x15b20, 0x0fb3b, 0x0fb1b, 0x15b4d, 0x15b28, 0x03b43, 0x03b1f, 0x15b41, 0x1191b, 0x0fb34, 0x0db0a,
+    0x1cc0c, 0x1ec20, 0x04944, 0x1a859, 0x1ec35, 0x1ec45, 0x22883, 0x13771, 0x00b4c, 0x0ca93, 0x0c975, 0x1f7a7, 0x00a6f, 0x13774, 0x135ad, 0x1776c,
+    0x1ec1d, 0x22c24, 0x1a85f, 0x23363, 0x1ec3d, 0x23749, 0x1f388, 0x2f73d, 0x1f3a3, 0x23366, 0x1f3a2, 0x23362, 0x1f389, 0x23747, 0x1f387, 0x2f73b,
+    0x00d41, 0x20c59, 0x1ac6c, 0x20c74, 0x2ec6f, 0x13776, 0x1d3ad, 0x1376f, 0x10f9c, 0x1d3a8, 0x1d3b2, 0x1f7a5, 0x1d3ae, 0x13773, 0x1d3ac, 0x1776a,
+    0x00c55, 0x2d35b, 0x1ac71, 0x2db45, 0x2ec71, 0x23745, 0x27383, 0x2f735, 0x0939f, 0x2d35a, 0x27384, 0x2db43, 0x1f384, 0x23743, 0x27382, 0x2f734,
+    0x12c20, 0x1ec2a, 0x22893, 0x1f797, 0x12c45, 0x1f54f, 0x1f177, 0x1354d, 0x18a93, 0x13199, 0x131a9, 0x1f795, 0x1f174, 0x2f547, 0x23573, 0x2b543,
+    0x12c24, 0x2f32c, 0x13365, 0x2f32a, 0x13149, 0x2f314, 0x13148, 0x2f312, 0x13366, 0x2f32b, 0x13364, 0x2f329, 0x13147, 0x2f313, 0x13146, 0x13f0e,
+    0x14c59, 0x2ec65, 0x113a7, 0x1f793, 0x1f176, 0x1f54e, 0x1f175, 0x1354c, 0x113a8, 0x13198, 0x113a6, 0x1f791, 0x1f173, 0x2f546, 0x1f172, 0x2b542,
+    0x1735b, 0x2f324, 0x29359, 0x2f320, 0x17145, 0x2f30f, 0x17144, 0x2fb0c, 0x1735a, 0x2f323, 0x29358, 0x2db1f, 0x17143, 0x2fb0e, 0x17142, 0x1ff0a,
+    0x00f44, 0x16e93, 0x1cd9b, 0x1f7a8, 0x18e83, 0x13777, 0x1d3af, 0x13770, 0x18f75, 0x1d3a9, 0x1d3b3, 0x1f7a6, 0x1f5ad, 0x17573, 0x1f5ab, 0x1776b,
+    0x14e5f, 0x23365, 0x1f3a1, 0x23361, 0x13388, 0x23748, 0x1f386, 0x2f73c, 0x113a2, 0x23364, 0x1f3a0, 0x23360, 0x13387, 0x23746, 0x1f385, 0x2f73a,
+    0x0ec6c, 0x1d3a7, 0x1d3b1, 0x1d3a5, 0x113ad, 0x13775, 0x1d3ab, 0x1376e, 0x113b2, 0x1d3a6, 0x1d3b0, 0x1d3a4, 0x113ac, 0x13772, 0x1d3aa, 0x15f68,
+    0x14c71, 0x2d359, 0x0937e, 0x27b3b, 0x25383, 0x23744, 0x2537c, 0x21b32, 0x09384, 0x2d358, 0x0937d, 0x27b39, 0x25382, 0x23742, 0x2537b, 0x1bb30,
+    0x0ee59, 0x13197, 0x131a8, 0x13196, 0x23171, 0x2354d, 0x23170, 0x2f54b, 0x131a7, 0x13195, 0x131a6, 0x13194, 0x2316c, 0x2f543, 0x2316b, 0x2f53f,
+    0x17363, 0x1732a, 0x17361, 0x2f328, 0x1713d, 0x17312, 0x1713c, 0x2f311, 0x17362, 0x17329, 0x17360, 0x2f327, 0x2b13b, 0x2390e, 0x2b13a, 0x1fd0b,
+    0x14c74, 0x13193, 0x113a5, 0x13192, 0x2316f, 0x2354c, 0x2316e, 0x2f54a, 0x131a5, 0x13191, 0x131a4, 0x13190, 0x2316a, 0x2f542, 0x1b968, 0x2f53e,
+    0x29b45, 0x2b320, 0x25b3b, 0x25b1b, 0x17135, 0x17b0c, 0x29b32, 0x2fb07, 0x29b43, 0x29b1f, 0x09b39, 0x09b19, 0x2b134, 0x17b0a, 0x15b30, 0x1fb04,
+    0x18c0e, 0x18823, 0x04943, 0x0485a, 0x10a43, 0x1e85a, 0x00884, 0x0089f, 0x18b46, 0x0ca98, 0x0c973, 0x028a8, 0x00a73, 0x0e8a8, 0x00bae, 0x0fd9c,
+    0x18c22, 0x18c52, 0x1a862, 0x1a866, 0x1e862, 0x22866, 0x208a2, 0x208a3, 0x02fc1, 0x033d0, 0x033d2, 0x09ec1, 0x0f3d2, 0x29dc1, 0x033d1, 0x0fd92,
+    0x00d3b, 0x1ac61, 0x18d6c, 0x1a877, 0x22ca5, 0x208a8, 0x212b2, 0x2129c, 0x10f87, 0x072cb, 0x212ad, 0x2de87, 0x072d3, 0x072ca, 0x212ac, 0x03e82,
+    0x04c59, 0x1ac65, 0x27276, 0x27a4e, 0x093a7, 0x27b93, 0x27275, 0x0ba4c, 0x093a8, 0x0b298, 0x27273, 0x1ba46, 0x093a6, 0x27b91, 0x27272, 0x1ba42,
+    0x0ce3b, 0x1ec61, 0x20ca5, 0x228a8, 0x1ce6c, 0x1e877, 0x231b2, 0x2319c, 0x04f87, 0x131cb, 0x131d3, 0x131ca, 0x231ad, 0x2fd87, 0x231ac, 0x2fd82,
+    0x10c59, 0x22c65, 0x153a7, 0x2bb93, 0x2b176, 0x1794e, 0x2b175, 0x1394c, 0x153a8, 0x17198, 0x153a6, 0x2bb91, 0x2b173, 0x23946, 0x2b172, 0x1f942,
+    0x00c7e, 0x20ca1, 0x212b1, 0x2129b, 0x2f1b1, 0x2f19b, 0x2f1b0, 0x2f19a, 0x00fb9, 0x131c9, 0x212ab, 0x21e85, 0x2f1ab, 0x2fd85, 0x2f1aa, 0x0fd7b,
+    0x25371, 0x25b5f, 0x2536c, 0x0ba44, 0x2936c, 0x17944, 0x25369, 0x0ba40, 0x25370, 0x25b5d, 0x2536b, 0x07a3a, 0x2936b, 0x1393a, 0x25b68, 0x19f30,
+    0x00f29, 0x02cbe, 0x10d95, 0x013d7, 0x04e95, 0x0d3d7, 0x18bcc, 0x013d6, 0x18f64, 0x013d8, 0x1efa9, 0x29ec6, 0x1afa9, 0x25dc6, 0x01cd1, 0x03d94,
+    0x02c8e, 0x033c3, 0x033c7, 0x093be, 0x0f3c7, 0x293be, 0x033c5, 0x253bc, 0x033c8, 0x033c2, 0x033c6, 0x093bd, 0x0f3c6, 0x293bd, 0x033c4, 0x01f8b,
+    0x0cf62, 0x0b2c7, 0x2d2a7, 0x2d295, 0x0b2d2, 0x0b2c6, 0x2d2a6, 0x2d294, 0x10fa2, 0x272c5, 0x23a75, 0x23e60, 0x272d1, 0x272c4, 0x1fe72, 0x1fe56,
+    0x09397, 0x0938e, 0x27a62, 0x27a29, 0x09395, 0x2538c, 0x27a60, 0x0ba27, 0x09396, 0x0938d, 0x2da58, 0x1ba21, 0x09394, 0x27b8b, 0x2da56, 0x19e1e,
+    0x00f62, 0x171c7, 0x171d2, 0x171c6, 0x2f1a7, 0x2f195, 0x2f1a6, 0x2f194, 0x06fa2, 0x171c5, 0x171d1, 0x171c4, 0x21975, 0x21d60, 0x1bd72, 0x05d56,
+    0x15397, 0x2938e, 0x15395, 0x2938c, 0x2b962, 0x17929, 0x2b960, 0x13927, 0x15396, 0x2938d, 0x15394, 0x17b8b, 0x2f958, 0x23921, 0x21956, 0x1dd1e,
+    0x02f89, 0x171c0, 0x2d2a5, 0x2d291, 0x2f1a5, 0x2f191, 0x2f1a4, 0x2f190, 0x02fba, 0x171bf, 0x23a6e, 0x23e5c, 0x1b96e, 0x1bd5c, 0x19868, 0x01c38,
+    0x25b4d, 0x25b28, 0x09b43, 0x09b1f, 0x15b43, 0x15b1f, 0x03b39, 0x01b19, 0x03b4b, 0x03b26, 0x03b3f, 0x07a1a, 0x15b3f, 0x1191a, 0x03b33, 0x01b09,
+    0x18c0f, 0x18824, 0x04945, 0x0775b, 0x10a45, 0x1d75b, 0x19771, 0x25755, 0x00b4e, 0x19765, 0x19776, 0x07759, 0x1d776, 0x13759, 0x1976f, 0x25f41,
+    0x18c24, 0x19353, 0x19363, 0x1b724, 0x1d363, 0x23724, 0x1935f, 0x2171d, 0x19366, 0x19752, 0x19362, 0x1b722, 0x1d362, 0x23722, 0x1935e, 0x2d71b,
+    0x04d45, 0x19763, 0x1936d, 0x07645, 0x19374, 0x1d759, 0x1976c, 0x0b641, 0x19377, 0x19761, 0x1b66c, 0x0b63b, 0x1d773, 0x1d757, 0x1b66a, 0x0b634,
+    0x0735b, 0x1b324, 0x07245, 0x1b30f, 0x19359, 0x21320, 0x07244, 0x2170c, 0x0735a, 0x1b323, 0x07243, 0x1b70e, 0x19358, 0x2371f, 0x07242, 0x2d70a,
+    0x10e45, 0x1d763, 0x1d374, 0x19759, 0x1f16d, 0x13545, 0x1d76c, 0x13541, 0x1d377, 0x1d761, 0x19773, 0x07757, 0x1f56c, 0x1753b, 0x1d76a, 0x17534,
+    0x1d35b, 0x23324, 0x1d359, 0x23320, 0x13145, 0x2330f, 0x13144, 0x2f70c, 0x1d35a, 0x23323, 0x1d358, 0x2171f, 0x13143, 0x2370e, 0x13142, 0x2f70a,
+    0x19371, 0x1975f, 0x1936c, 0x07644, 0x1d36c, 0x13544, 0x19369, 0x0b640, 0x19370, 0x1975d, 0x1936b, 0x0b63a, 0x1d36b, 0x1753a, 0x19768, 0x25f30,
+    0x25355, 0x2131d, 0x0b241, 0x2130c, 0x13141, 0x2f30c, 0x13140, 0x21305, 0x25354, 0x2131c, 0x0b23f, 0x2130b, 0x1313f, 0x2f30b, 0x1313e, 0x21f04,
+    0x00f4e, 0x19766, 0x19777, 0x0775a, 0x1d777, 0x1d75a, 0x19770, 0x25754, 0x19378, 0x19764, 0x19775, 0x07758, 0x1d775, 0x13758, 0x1976e, 0x25f3f,
+    0x19365, 0x19352, 0x19361, 0x1b723, 0x1d361, 0x23723, 0x1935d, 0x2171c, 0x19364, 0x19351, 0x19360, 0x1b721, 0x1d360, 0x23721, 0x1935c, 0x2d71a,
+    0x19376, 0x19762, 0x1b26c, 0x07643, 0x19373, 0x1d758, 0x1b26b, 0x0b63f, 0x19375, 0x19760, 0x1b269, 0x27639, 0x19372, 0x1d756, 0x1b668, 0x27633,
+    0x07359, 0x1b322, 0x0b23b, 0x1b30e, 0x07357, 0x2131f, 0x0b23a, 0x2170b, 0x07358, 0x1b321, 0x27239, 0x1b30d, 0x07356, 0x2131e, 0x27238, 0x27f09,
+    0x1d376, 0x1d762, 0x1d373, 0x19758, 0x1f16c, 0x13543, 0x1f16b, 0x1353f, 0x1d375, 0x1d760, 0x1d372, 0x07756, 0x23169, 0x17539, 0x23568, 0x17533,
+    0x13359, 0x23322, 0x1d357, 0x2331f, 0x1713b, 0x2330e, 0x1713a, 0x2f70b, 0x13358, 0x23321, 0x1d356, 0x2331e, 0x17139, 0x2330d, 0x17138, 0x17f09,
+    0x1936f, 0x1975e, 0x1936a, 0x07642, 0x1f16a, 0x13542, 0x19368, 0x0b63e, 0x1936e, 0x1975c, 0x1b268, 0x27638, 0x23168, 0x17538, 0x23167, 0x03f2e,
+    0x25b41, 0x2d31b, 0x0b234, 0x2d30a, 0x17134, 0x2f30a, 0x25b30, 0x21b04, 0x25b3f, 0x2d31a, 0x27233, 0x27b09, 0x17133, 0x17b09, 0x03b2e, 0x19f02,
+    0x00f0b, 0x18827, 0x1893a, 0x04860, 0x1ca3a, 0x10860, 0x00885, 0x008a0, 0x18b3f, 0x0ca94, 0x12f6b, 0x009a6, 0x06f6b, 0x0caa6, 0x00bab, 0x03cb3,
+    0x00c32, 0x1885e, 0x06d7c, 0x1a887, 0x10e7c, 0x1e887, 0x188b7, 0x208b9, 0x24f6e, 0x028d1, 0x16dab, 0x253d3, 0x26eab, 0x293d3, 0x033d4, 0x01fab,
+    0x0cd1f, 0x04c8c, 0x1cd57, 0x1ad95, 0x08e91, 0x1a8c6, 0x287ca, 0x0a8cc, 0x16f58, 0x189c6, 0x12d73, 0x1ded2, 0x26fa6, 0x033da, 0x287d3, 0x0dea6,
+    0x0ef44, 0x06d93, 0x06d83, 0x0bb77, 0x08e9b, 0x27ba8, 0x093af, 0x0bb70, 0x28f75, 0x253a9, 0x2adad, 0x07a73, 0x093b3, 0x27ba6, 0x27aab, 0x05e6b,
+    0x00e1f, 0x10c8c, 0x14d91, 0x1e8c6, 0x06e57, 0x1ee95, 0x247ca, 0x128cc, 0x0af58, 0x1cac6, 0x2afa6, 0x151da, 0x06e73, 0x19dd2, 0x247d3, 0x01da6,
+    0x02f44, 0x12e93, 0x28d9b, 0x2bba8, 0x24e83, 0x17b77, 0x293af, 0x13b70, 0x24f75, 0x293a9, 0x293b3, 0x2bba6, 0x26ead, 0x13973, 0x179ab, 0x11d6b,
+    0x02f29, 0x00cbe, 0x14d95, 0x033d7, 0x08e95, 0x0f3d7, 0x247cc, 0x033d6, 0x24f64, 0x033d8, 0x287a9, 0x1dec6, 0x247a9, 0x19dc6, 0x03cd1, 0x01d94,
+    0x02f4e, 0x25b66, 0x25b77, 0x25b5a, 0x29b77, 0x17b5a, 0x25b70, 0x25b54, 0x25378, 0x25b64, 0x25b75, 0x0bb58, 0x29b75, 0x17b58, 0x25b6e, 0x19f3f,
+    0x00f1c, 0x0adbc, 0x12d5d, 0x20dc5, 0x0ae5d, 0x2eec5, 0x247c9, 0x013db, 0x24f54, 0x027d6, 0x12f70, 0x13ccc, 0x0af70, 0x0bccc, 0x21cb9, 0x01ca0,
+    0x02f3c, 0x0adc0, 0x28d86, 0x253cb, 0x08e86, 0x293cb, 0x033cd, 0x253c9, 0x24f70, 0x253cc, 0x287af, 0x253ca, 0x087af, 0x293ca, 0x19cb7, 0x01c85,
+    0x14f23, 0x26dbe, 0x16d61, 0x2cdc7, 0x24798, 0x092d8, 0x287cb, 0x2fac5, 0x16f5a, 0x252d7, 0x16f77, 0x1fa95, 0x26fa8, 0x1bcc6, 0x1fc87, 0x11c60,
+    0x14f48, 0x25399, 0x28d88, 0x0ba61, 0x0939e, 0x25398, 0x09a86, 0x0ba5d, 0x28f77, 0x09a95, 0x25a83, 0x07a57, 0x09a9b, 0x09a91, 0x11a7c, 0x1de3a,
+    0x02f23, 0x16ebe, 0x28798, 0x291d8, 0x0ae61, 0x2eec7, 0x247cb, 0x219c5, 0x24f5a, 0x291d7, 0x2afa8, 0x1fcc6, 0x0af77, 0x1b995, 0x1bc87, 0x05c60,
+    0x02f48, 0x29399, 0x2939e, 0x29398, 0x24e88, 0x17961, 0x29986, 0x1395d, 0x24f77, 0x15995, 0x2999b, 0x15991, 0x07983, 0x1d957, 0x0797c, 0x19d3a,
+    0x02f2b, 0x291d5, 0x28799, 0x17abe, 0x24799, 0x279be, 0x17ac0, 0x13abc, 0x24f66, 0x018be, 0x13a93, 0x13a8c, 0x07993, 0x0798c, 0x19c5e, 0x19c27,
+    0x02f50, 0x03b2b, 0x03b48, 0x03b23, 0x15b48, 0x15b23, 0x03b3c, 0x01b1c, 0x03b4e, 0x03b29, 0x03b44, 0x01a1f, 0x0fb44, 0x0d91f, 0x01832, 0x01b0b,
+    0x00d11, 0x18828, 0x0493c, 0x04861, 0x1ca3c, 0x10861, 0x00886, 0x008a1, 0x00b4b, 0x0ca96, 0x10970, 0x009a8, 0x00a70, 0x0caa8, 0x00baf, 0x03f9b,
+    0x00c37, 0x1885f, 0x06d80, 0x21388, 0x10e80, 0x23388, 0x193b8, 0x21380, 0x013ba, 0x213a2, 0x073b9, 0x21387, 0x1f3b9, 0x23387, 0x193b7, 0x2df7c,
+    0x00d28, 0x04c8e, 0x18d61, 0x1ad99, 0x0eec0, 0x193c7, 0x053cb, 0x193c0, 0x10f96, 0x053c8, 0x1c9a8, 0x053c1, 0x013cc, 0x193c6, 0x053ca, 0x03f91,
+    0x00d5f, 0x27365, 0x0b388, 0x27b48, 0x093a1, 0x2d361, 0x27386, 0x21b3c, 0x093a2, 0x27364, 0x0b387, 0x27b46, 0x093a0, 0x2d360, 0x27385, 0x21b3a,
+    0x10e28, 0x1cc8e, 0x02dc0, 0x1d3c7, 0x1ce61, 0x1ee99, 0x113cb, 0x1d3c0, 0x04f96, 0x1d3c8, 0x113cc, 0x1d3c6, 0x18aa8, 0x1d3c1, 0x113ca, 0x0ff91,
+    0x10e5f, 0x2f365, 0x173a1, 0x2f361, 0x17388, 0x2fb48, 0x17386, 0x2fb3c, 0x173a2, 0x2f364, 0x173a0, 0x2f360, 0x17387, 0x2fb46, 0x17385, 0x23b3a,
+    0x00c8e, 0x013c3, 0x013c7, 0x053be, 0x0d3c7, 0x1d3be, 0x013c5, 0x193bc, 0x013c8, 0x013c2, 0x013c6, 0x053bd, 0x0d3c6, 0x1d3bd, 0x013c4, 0x03f8b,
+    0x25365, 0x25352, 0x25361, 0x27b23, 0x29361, 0x2fb23, 0x2535d, 0x21b1c, 0x25364, 0x25351, 0x25360, 0x27b21, 0x29360, 0x2fb21, 0x2535c, 0x21b1a,
+    0x00f3c, 0x06dc0, 0x1cd86, 0x193cb, 0x04e86, 0x1d3cb, 0x013cd, 0x193c9, 0x18f70, 0x193cc, 0x1edaf, 0x193ca, 0x06eaf, 0x1d3ca, 0x25cb7, 0x03c85,
+    0x00d80, 0x213a1, 0x013b8, 0x21386, 0x113b8, 0x2f386, 0x013b6, 0x2137f, 0x013b9, 0x213a0, 0x013b7, 0x21385, 0x113b7, 0x2f385, 0x013b5, 0x01f7a,
+    0x0cd61, 0x053c7, 0x1eda1, 0x053c0, 0x013cb, 0x053c5, 0x013c9, 0x053bf, 0x10fa8, 0x053c6, 0x1fa9b, 0x1fa91, 0x013ca, 0x053c4, 0x1fc85, 0x11c5c,
+    0x09388, 0x27361, 0x09380, 0x27b3c, 0x09386, 0x2735d, 0x0937f, 0x27b36, 0x09387, 0x27360, 0x25a7c, 0x0bb3a, 0x09385, 0x2735c, 0x09a7a, 0x05e31,
+    0x00e61, 0x113c7, 0x0d3cb, 0x1d3c5, 0x06ea1, 0x113c0, 0x113c9, 0x1d3bf, 0x04fa8, 0x113c6, 0x0d3ca, 0x1d3c4, 0x0799b, 0x1b991, 0x07c85, 0x01c5c,
+    0x15388, 0x2b361, 0x29386, 0x2f35d, 0x17380, 0x17b3c, 0x1737f, 0x2fb36, 0x15387, 0x2b360, 0x29385, 0x2f35c, 0x2b97c, 0x17b3a, 0x0797a, 0x1dd31,
+    0x0ed99, 0x013be, 0x013c0, 0x013bc, 0x0d3c0, 0x113bc, 0x013bf, 0x013bb, 0x013c1, 0x013bd, 0x13a91, 0x1fa8b, 0x07991, 0x0798b, 0x19c5c, 0x01c25,
+    0x25b48, 0x25b23, 0x09b3c, 0x09b1c, 0x29b3c, 0x17b1c, 0x03b36, 0x01b16, 0x25b46, 0x25b21, 0x09b3a, 0x09b1a, 0x15b3a, 0x17b1a, 0x03b31, 0x01b06,
+    0x10d0e, 0x04829, 0x1893b, 0x04862, 0x10a46, 0x10864, 0x00887, 0x008a2, 0x1cb43, 0x00995, 0x1096c, 0x2b6a7, 0x04b73, 0x0caa9, 0x176ad, 0x15e75,
+    0x04c3b, 0x18862, 0x06d7e, 0x06889, 0x1c887, 0x1e8a2, 0x068b9, 0x268ba, 0x16da5, 0x093d2, 0x176b1, 0x2b6a5, 0x033d3, 0x093d1, 0x176ab, 0x15e6e,
+    0x10d22, 0x06d8e, 0x1cd59, 0x21297, 0x068c1, 0x072c8, 0x212a8, 0x21296, 0x12f62, 0x1b2c7, 0x2f676, 0x2fe62, 0x1b2d2, 0x1b2c6, 0x2f673, 0x2be58,
+    0x00d59, 0x0b297, 0x27271, 0x27a4d, 0x0b2a8, 0x0b296, 0x27270, 0x27a4b, 0x0b2a7, 0x0b295, 0x2d26c, 0x21a43, 0x0b2a6, 0x0b294, 0x2d26b, 0x1ba3f,
+    0x00e43, 0x1cc95, 0x14da5, 0x236d2, 0x18e73, 0x10aa9, 0x1f6d3, 0x2f6d1, 0x04f84, 0x10acc, 0x176b2, 0x2b6a6, 0x06fae, 0x05dd1, 0x176ac, 0x0fc72,
+    0x0cc6c, 0x293a7, 0x293b1, 0x293a5, 0x153ad, 0x17b75, 0x293ab, 0x13b6e, 0x153b2, 0x293a6, 0x293b0, 0x293a4, 0x153ac, 0x17b72, 0x293aa, 0x11f68,
+    0x0ef62, 0x072c7, 0x212a7, 0x21295, 0x072d2, 0x072c6, 0x212a6, 0x21294, 0x16fa2, 0x072c5, 0x2f675, 0x2fe60, 0x072d1, 0x072c4, 0x2f672, 0x2be56,
+    0x25376, 0x25b62, 0x2726c, 0x0ba43, 0x25373, 0x29b58, 0x2726b, 0x0ba3f, 0x25375, 0x25b60, 0x27269, 0x07a39, 0x25372, 0x17b56, 0x27a68, 0x05f33,
+    0x10f23, 0x06dbe, 0x12d61, 0x236c7, 0x04e98, 0x052d8, 0x1f6cb, 0x2f6c5, 0x1cf5a, 0x192d7, 0x12f77, 0x2b695, 0x1afa8, 0x27cc6, 0x2bc87, 0x15c60,
+    0x0ed61, 0x093c7, 0x16da1, 0x093c0, 0x033cb, 0x093c5, 0x033c9, 0x093bf, 0x14fa8, 0x093c6, 0x1769b, 0x2b691, 0x033ca, 0x093c4, 0x17c85, 0x15c5c,
+    0x10d52, 0x272c3, 0x12d65, 0x2128e, 0x272d0, 0x272c2, 0x23698, 0x2128d, 0x12f66, 0x212be, 0x2fe4e, 0x2fe29, 0x21cc1, 0x212bd, 0x13e46, 0x13e21,
+    0x14d65, 0x2728e, 0x27a5f, 0x27a28, 0x09398, 0x2728d, 0x27a5d, 0x27a26, 0x25a93, 0x2728c, 0x23e44, 0x21a1f, 0x25a91, 0x09a8b, 0x1fe3a, 0x1fe1a,
+    0x00f5a, 0x151d7, 0x16fa8, 0x236c6, 0x06fa8, 0x2d9c6, 0x1f6ca, 0x2f6c4, 0x06f9f, 0x291d6, 0x1769c, 0x2b694, 0x1bc9c, 0x07c94, 0x1bc82, 0x01c56,
+    0x0ef77, 0x29395, 0x2939b, 0x29391, 0x29987, 0x17960, 0x29985, 0x1395c, 0x1539c, 0x29394, 0x2939a, 0x29390, 0x07982, 0x1d956, 0x19c7b, 0x05d38,
+    0x14f66, 0x272be, 0x2fa93, 0x2d28c, 0x279c1, 0x272bd, 0x2fa91, 0x2fa8b, 0x16fa3, 0x272bc, 0x23e4c, 0x23e27, 0x1bc92, 0x0588b, 0x13e42, 0x11c1e,
+    0x09b4e, 0x09b29, 0x09b44, 0x0ba1f, 0x15b46, 0x15b21, 0x03b3a, 0x01b1a, 0x03b4c, 0x03b27, 0x23e40, 0x07a19, 0x0fb42, 0x0fb1e, 0x11830, 0x05a09,
+    0x04d12, 0x0482a, 0x0493d, 0x07663, 0x10a48, 0x10865, 0x05688, 0x0b65f, 0x10b4d, 0x05697, 0x10971, 0x0b659, 0x00a77, 0x05693, 0x05683, 0x25e44,
+    0x04c3d, 0x1b363, 0x07381, 0x0773d, 0x19388, 0x1b35f, 0x19380, 0x27737, 0x05389, 0x1b362, 0x0767e, 0x0773b, 0x19387, 0x1b35e, 0x0767c, 0x27732,
+    0x04d2a, 0x0538f, 0x1b663, 0x0762a, 0x05399, 0x0778e, 0x1b661, 0x0b628, 0x19697, 0x0568e, 0x21659, 0x27622, 0x19695, 0x0568c, 0x21657, 0x2761f,
+    0x07363, 0x0732a, 0x0723d, 0x07312, 0x07361, 0x1b328, 0x0723c, 0x1b311, 0x07362, 0x07329, 0x1b23b, 0x2760e, 0x07360, 0x1b327, 0x1b23a, 0x27e0b,
+    0x10e4d, 0x19397, 0x05689, 0x07662, 0x1ca77, 0x19393, 0x05687, 0x0b65e, 0x0539d, 0x19396, 0x05684, 0x0b658, 0x1939c, 0x19392, 0x05682, 0x25e42,
+    0x10c71, 0x21359, 0x0737e, 0x1b73b, 0x19383, 0x2fb44, 0x1937c, 0x21732, 0x05384, 0x21358, 0x0737d, 0x07739, 0x19382, 0x2fb42, 0x1937b, 0x27730,
+    0x05397, 0x0538e, 0x1b662, 0x07629, 0x05395, 0x1938c, 0x1b660, 0x0b627, 0x05396, 0x0538d, 0x21658, 0x27621, 0x05394, 0x0778b, 0x21656, 0x2761e,
+    0x0b359, 0x27322, 0x0723b, 0x2730e, 0x25357, 0x2d31f, 0x0723a, 0x21b0b, 0x0b358, 0x27321, 0x07239, 0x2730d, 0x25356, 0x2d31e, 0x07238, 0x07f09,
+    0x10f48, 0x19399, 0x19688, 0x07661, 0x0539e, 0x19398, 0x05686, 0x0b65d, 0x1cf77, 0x05695, 0x19683, 0x25657, 0x0569b, 0x05691, 0x1767c, 0x29e3a,
+    0x05388, 0x1b361, 0x07380, 0x0773c, 0x05386, 0x1b35d, 0x0737f, 0x27736, 0x05387, 0x1b360, 0x1967c, 0x0773a, 0x05385, 0x1b35c, 0x0767a, 0x27731,
+    0x10d65, 0x0728e, 0x1b65f, 0x1b628, 0x05398, 0x0728d, 0x1b65d, 0x27626, 0x19693, 0x1b28c, 0x2fe44, 0x2d61f, 0x19691, 0x0568b, 0x2be3a, 0x2be1a,
+    0x0b35f, 0x0b328, 0x27237, 0x0b311, 0x0b35d, 0x27326, 0x27236, 0x27310, 0x0b35e, 0x0b327, 0x21232, 0x21e0b, 0x0b35c, 0x27325, 0x21231, 0x27e06,
+    0x00f77, 0x19395, 0x19687, 0x07660, 0x0539b, 0x19391, 0x05685, 0x0b65c, 0x0539c, 0x19394, 0x19682, 0x25656, 0x0539a, 0x19390, 0x1767b, 0x29e38,
+    0x05383, 0x21357, 0x0737c, 0x1b73a, 0x1737c, 0x2bb3a, 0x0737a, 0x21731, 0x05382, 0x21356, 0x0737b, 0x07738, 0x1737b, 0x17b38, 0x07379, 0x2772f,
+    0x05393, 0x0538c, 0x1b65e, 0x1b627, 0x05391, 0x0538b, 0x1b65c, 0x27625, 0x05392, 0x0728b, 0x2fe42, 0x2d61e, 0x05390, 0x0538a, 0x17e38, 0x17e18,
+    0x25b44, 0x2731f, 0x27232, 0x27b0b, 0x29b3a, 0x2bb1a, 0x27231, 0x27b06, 0x25b42, 0x2731e, 0x27230, 0x07a09, 0x29b38, 0x17b18, 0x2722f, 0x07e03,
+    0x00e0e, 0x1c829, 0x00946, 0x00864, 0x1ca3b, 0x10862, 0x0c887, 0x0e8a2, 0x18b43, 0x0ca95, 0x10b73, 0x009a9, 0x04a6c, 0x275a7, 0x0b5ad, 0x09d75,
+    0x10c3b, 0x1c862, 0x18887, 0x188a2, 0x1ee7e, 0x1e889, 0x1e8b9, 0x2e8ba, 0x0aea5, 0x153d2, 0x0f3d3, 0x293d1, 0x275b1, 0x275a5, 0x275ab, 0x03d6e,
+    0x0cd43, 0x18c95, 0x1cd73, 0x049a9, 0x08ea5, 0x215d2, 0x1b5d3, 0x215d1, 0x1cf84, 0x009cc, 0x1efae, 0x1ded1, 0x0b5b2, 0x275a6, 0x0b5ac, 0x03c72,
+    0x00c6c, 0x253a7, 0x093ad, 0x0bb75, 0x093b1, 0x253a5, 0x093ab, 0x0bb6e, 0x093b2, 0x253a6, 0x093ac, 0x07a72, 0x093b0, 0x253a4, 0x093aa, 0x01f68,
+    0x00e22, 0x1ee8e, 0x1e8c1, 0x1f1c8, 0x18e59, 0x23197, 0x231a8, 0x23196, 0x06f62, 0x1f1c7, 0x1f1d2, 0x1f1c6, 0x2d576, 0x2dd62, 0x2d573, 0x27d58,
+    0x0ce59, 0x17197, 0x171a8, 0x17196, 0x2f171, 0x2f94d, 0x2f170, 0x2f94b, 0x171a7, 0x17195, 0x171a6, 0x17194, 0x2f16c, 0x23943, 0x2f16b, 0x2393f,
+    0x02f62, 0x131c7, 0x131d2, 0x131c6, 0x231a7, 0x23195, 0x231a6, 0x23194, 0x08fa2, 0x1f1c5, 0x1f1d1, 0x1f1c4, 0x2d575, 0x2dd60, 0x2d572, 0x09d56,
+    0x29376, 0x29b62, 0x29373, 0x25b58, 0x2b16c, 0x17943, 0x2b16b, 0x1393f, 0x29375, 0x29b60, 0x29372, 0x25b56, 0x2f169, 0x1f939, 0x2f968, 0x1df33,
+    0x00f23, 0x1eebe, 0x10d98, 0x1d1d8, 0x06e61, 0x215c7, 0x1b5cb, 0x215c5, 0x06f5a, 0x1d1d7, 0x1efa8, 0x2bcc6, 0x06f77, 0x27595, 0x27c87, 0x09c60,
+    0x02e61, 0x153c7, 0x0f3cb, 0x293c5, 0x08ea1, 0x153c0, 0x153c9, 0x293bf, 0x08fa8, 0x153c6, 0x0f3ca, 0x293c4, 0x2759b, 0x27591, 0x27c85, 0x03c5c,
+    0x02f5a, 0x111d7, 0x12fa8, 0x2fac6, 0x0afa8, 0x215c6, 0x1b5ca, 0x215c4, 0x08f9f, 0x1d1d6, 0x1fc9c, 0x13c94, 0x0b59c, 0x27594, 0x27c82, 0x03c56,
+    0x02f77, 0x25395, 0x25a87, 0x0ba60, 0x0939b, 0x25391, 0x09a85, 0x0ba5c, 0x0939c, 0x25394, 0x25a82, 0x07a56, 0x0939a, 0x25390, 0x1fc7b, 0x1de38,
+    0x00e52, 0x2f1c3, 0x2f1d0, 0x2f1c2, 0x0ae65, 0x2f18e, 0x21598, 0x2f18d, 0x0af66, 0x2f1be, 0x2fcc1, 0x2f1bd, 0x21d4e, 0x21d29, 0x0bd46, 0x0bd21,
+    0x02e65, 0x1718e, 0x15398, 0x1718d, 0x2f95f, 0x2f928, 0x2f95d, 0x2f926, 0x29993, 0x2b18c, 0x29991, 0x2998b, 0x21d44, 0x2391f, 0x1bd3a, 0x19d1a,
+    0x02f66, 0x171be, 0x17ac1, 0x171bd, 0x2d993, 0x2f18c, 0x2d991, 0x2198b, 0x08fa3, 0x2f1bc, 0x1fc92, 0x1d88b, 0x1bd4c, 0x1bd27, 0x07d42, 0x05c1e,
+    0x29b4e, 0x29b29, 0x03b46, 0x03b21, 0x15b44, 0x1791f, 0x0fb3a, 0x0fb1a, 0x15b4c, 0x15b27, 0x03b42, 0x01a1e, 0x1bd40, 0x1f919, 0x01830, 0x1d909,
+    0x1ce12, 0x1c82a, 0x00948, 0x00865, 0x1ca3d, 0x13563, 0x11588, 0x1355f, 0x00b4d, 0x11597, 0x0c977, 0x11593, 0x00a71, 0x17559, 0x09583, 0x29d44,
+    0x1cc3d, 0x1f363, 0x1d388, 0x2335f, 0x1f381, 0x1f73d, 0x1f380, 0x2f737, 0x1d389, 0x1f362, 0x1d387, 0x2335e, 0x1f57e, 0x1373b, 0x1157c, 0x17732,
+    0x00d4d, 0x1d397, 0x18977, 0x1d393, 0x1d589, 0x13562, 0x11587, 0x1355e, 0x1d39d, 0x1d396, 0x1d39c, 0x1d392, 0x1d584, 0x17558, 0x09582, 0x29d42,
+    0x00c71, 0x23359, 0x0b383, 0x2db44, 0x1f37e, 0x1f73b, 0x1f37c, 0x2f732, 0x1d384, 0x23358, 0x0b382, 0x2db42, 0x1f37d, 0x1f739, 0x1f37b, 0x2f730,
+    0x1ce2a, 0x1f18f, 0x11399, 0x1f78e, 0x1f563, 0x1f52a, 0x1f561, 0x13528, 0x1d597, 0x1d58e, 0x1d595, 0x1378c, 0x23559, 0x2f522, 0x2d557, 0x2b51f,
+    0x13363, 0x1f32a, 0x13361, 0x23328, 0x1f13d, 0x1f312, 0x1f13c, 0x23311, 0x13362, 0x1f329, 0x13360, 0x23327, 0x1f13b, 0x2f50e, 0x1f13a, 0x17d0b,
+    0x11397, 0x1d38e, 0x11395, 0x1d38c, 0x1f562, 0x1f529, 0x1f560, 0x13527, 0x11396, 0x1d38d, 0x11394, 0x1f78b, 0x23558, 0x2f521, 0x2d556, 0x2b51e,
+    0x17359, 0x2f322, 0x17357, 0x2f31f, 0x1313b, 0x2f30e, 0x1313a, 0x2fb0b, 0x17358, 0x2f321, 0x17356, 0x2f31e, 0x1f139, 0x2f30d, 0x1f138, 0x1ff09,
+    0x00f48, 0x1d399, 0x1d39e, 0x1d398, 0x1d588, 0x13561, 0x1d586, 0x1355d, 0x18f77, 0x11595, 0x1d59b, 0x11591, 0x0b583, 0x17557, 0x0957c, 0x25d3a,
+    0x11388, 0x1f361, 0x1d386, 0x2335d, 0x11380, 0x1f73c, 0x1f37f, 0x2f736, 0x11387, 0x1f360, 0x1d385, 0x2335c, 0x1f57c, 0x1373a, 0x0957a, 0x17731,
+    0x0cf77, 0x1d395, 0x1d39b, 0x1d391, 0x1d587, 0x13560, 0x1d585, 0x1355c, 0x1139c, 0x1d394, 0x1d39a, 0x1d390, 0x0b582, 0x17556, 0x0957b, 0x09d38,
+    0x09383, 0x2d357, 0x0937c, 0x27b3a, 0x1137c, 0x1f73a, 0x0937a, 0x2f731, 0x09382, 0x2d356, 0x0937b, 0x27b38, 0x1137b, 0x1f738, 0x09379, 0x2f72f,
+    0x00e65, 0x1f18e, 0x11398, 0x1f18d, 0x2355f, 0x23528, 0x2355d, 0x2f526, 0x1d593, 0x1f18c, 0x1d591, 0x1d58b, 0x2dd44, 0x2f51f, 0x27d3a, 0x25d1a,
+    0x1335f, 0x13328, 0x1335d, 0x2f326, 0x2f137, 0x13311, 0x2f136, 0x2f310, 0x1335e, 0x13327, 0x1335c, 0x2f325, 0x2f132, 0x2fd0b, 0x2f131, 0x2fd06,
+    0x11393, 0x1318c, 0x11391, 0x1d38b, 0x2355e, 0x23527, 0x2355c, 0x2f525, 0x11392, 0x1f18b, 0x11390, 0x1f18a, 0x2dd42, 0x2f51e, 0x27d38, 0x09d18,
+    0x29b44, 0x2b31f, 0x25b3a, 0x25b1a, 0x17132, 0x17b0b, 0x17131, 0x2fb06, 0x29b42, 0x2b31e, 0x09b38, 0x09b18, 0x2f130, 0x1f909, 0x2f12f, 0x1fd03,
+    0x00f13, 0x0082b, 0x00947, 0x00866, 0x10a47, 0x10866, 0x00889, 0x008a3, 0x18b47, 0x0ca99, 0x10b74, 0x15493, 0x00a74, 0x09493, 0x2546f, 0x25c4c,
+    0x18c47, 0x18866, 0x04889, 0x068a3, 0x1c889, 0x1e8a3, 0x008ba, 0x008ce, 0x033cf, 0x034c1, 0x176a5, 0x15492, 0x0b5a5, 0x09492, 0x2546e, 0x03c4a,
+    0x10d47, 0x18c99, 0x1cd74, 0x21293, 0x072cf, 0x072c1, 0x236a5, 0x21292, 0x1cf89, 0x1b2c0, 0x2f66f, 0x2fe5e, 0x094a5, 0x09491, 0x2b66a, 0x15c42,
+    0x04c74, 0x0b293, 0x2726f, 0x27a4c, 0x093a5, 0x0b292, 0x2726e, 0x27a4a, 0x0b2a5, 0x0b291, 0x2d26a, 0x21a42, 0x093a4, 0x0b290, 0x2f668, 0x15c3e,
+    0x00e47, 0x1cc99, 0x1f1cf, 0x1f1c1, 0x18e74, 0x23193, 0x215a5, 0x23192, 0x04f89, 0x1f1c0, 0x154a5, 0x15491, 0x2756f, 0x27d5e, 0x2756a, 0x09c42,
+    0x10c74, 0x17193, 0x153a5, 0x17192, 0x2f16f, 0x2f94c, 0x2f16e, 0x2f94a, 0x171a5, 0x17191, 0x171a4, 0x17190, 0x2f16a, 0x23942, 0x27568, 0x03c3e,
+    0x00f89, 0x131c0, 0x212a5, 0x21291, 0x231a5, 0x23191, 0x231a4, 0x23190, 0x00fba, 0x1f1bf, 0x2f66e, 0x2fe5c, 0x2756e, 0x27d5c, 0x25468, 0x03c38,
+    0x2536f, 0x25b5e, 0x2536a, 0x0ba42, 0x2b16a, 0x17942, 0x25368, 0x0ba3e, 0x2536e, 0x25b5c, 0x27268, 0x07a38, 0x2f168, 0x1f938, 0x2f167, 0x01f2e,
+    0x00f2b, 0x1d1d5, 0x10d99, 0x1f6be, 0x04e99, 0x075be, 0x136c0, 0x136bc, 0x18f66, 0x034be, 0x17693, 0x1768c, 0x0b593, 0x0b58c, 0x25c5e, 0x25c27,
+    0x0cd99, 0x033be, 0x033c0, 0x033bc, 0x0f3c0, 0x153bc, 0x033bf, 0x033bb, 0x033c1, 0x033bd, 0x17691, 0x1768b, 0x0b591, 0x2758b, 0x25c5c, 0x03c25,
+    0x10f66, 0x072be, 0x23693, 0x2128c, 0x075c1, 0x072bd, 0x23691, 0x2f68b, 0x1efa3, 0x1b2bc, 0x2fe4c, 0x2fe27, 0x0b592, 0x0948b, 0x17e42, 0x15c1e,
+    0x09393, 0x0938c, 0x27a5e, 0x27a27, 0x09391, 0x0938b, 0x27a5c, 0x27a25, 0x09392, 0x2728b, 0x23e42, 0x23e1e, 0x09390, 0x0938a, 0x1fe38, 0x1fe18,
+    0x00f66, 0x1f1be, 0x1f6c1, 0x1f1bd, 0x21593, 0x2318c, 0x21591, 0x2158b, 0x06fa3, 0x231bc, 0x17692, 0x2948b, 0x27d4c, 0x27d27, 0x0bd42, 0x09c1e,
+    0x15393, 0x1718c, 0x15391, 0x2938b, 0x2f95e, 0x2f927, 0x2f95c, 0x2f925, 0x15392, 0x1718b, 0x15390, 0x1718a, 0x21d42, 0x21d1e, 0x07d38, 0x07d18,
+    0x00fa3, 0x131bc, 0x23692, 0x2128b, 0x21592, 0x2f18b, 0x23690, 0x2f18a, 0x00fce, 0x2f1bb, 0x2fe4a, 0x2fe25, 0x27d4a, 0x27d25, 0x0bd3e, 0x01c18,
+    0x25b4c, 0x25b27, 0x09b42, 0x0ba1e, 0x15b42, 0x15b1e, 0x03b38, 0x01b18, 0x03b4a, 0x03b25, 0x23e3e, 0x07a18, 0x1bd3e, 0x1f918, 0x0182e, 0x01c08,
+    0x00814, 0x0172c, 0x01749, 0x01724, 0x11749, 0x11724, 0x0173d, 0x0171d, 0x0174f, 0x0172a, 0x01745, 0x03620, 0x0d745, 0x0d720, 0x01735, 0x0370c,
+    0x19749, 0x19724, 0x0573d, 0x0771d, 0x1d73d, 0x1f71d, 0x01737, 0x01717, 0x19747, 0x19722, 0x0573b, 0x0771b, 0x1173b, 0x1171b, 0x01732, 0x03707,
+    0x0574f, 0x0572a, 0x05745, 0x07620, 0x11747, 0x11722, 0x0173b, 0x0171b, 0x0174d, 0x01728, 0x01741, 0x0961b, 0x0d743, 0x0d71f, 0x01734, 0x0960a,
+    0x19745, 0x1b320, 0x07235, 0x0770c, 0x1d73b, 0x1f71b, 0x05732, 0x27707, 0x19743, 0x1971f, 0x1b234, 0x0b60a, 0x1d739, 0x1f719, 0x01730, 0x09704,
+    0x1d74f, 0x1d72a, 0x01747, 0x01722, 0x11745, 0x11720, 0x0d73b, 0x0f71b, 0x1174d, 0x11728, 0x01743, 0x0171f, 0x11741, 0x1751b, 0x0d734, 0x0f70a,
+    0x1d745, 0x1f320, 0x1973b, 0x1971b, 0x1f135, 0x1f70c, 0x1d732, 0x2f707, 0x1d743, 0x1d71f, 0x05739, 0x07719, 0x1f134, 0x1370a, 0x11730, 0x17704,
+    0x1974d, 0x19728, 0x05743, 0x0571f, 0x11743, 0x1171f, 0x01739, 0x01719, 0x0174b, 0x01726, 0x0173f, 0x0961a, 0x1173f, 0x1751a, 0x01733, 0x03709,
+    0x19741, 0x2131b, 0x07234, 0x2130a, 0x13134, 0x2330a, 0x19730, 0x21704, 0x1973f, 0x2131a, 0x07233, 0x07709, 0x1f133, 0x1f709, 0x0172e, 0x25702,
+    0x01750, 0x0172b, 0x01748, 0x01723, 0x11748, 0x11723, 0x0173c, 0x0171c, 0x0174e, 0x01729, 0x01744, 0x0361f, 0x0d744, 0x0f51f, 0x03432, 0x0370b,
+    0x19748, 0x19723, 0x0573c, 0x0771c, 0x1d73c, 0x1f71c, 0x01736, 0x01716, 0x19746, 0x19721, 0x0573a, 0x0771a, 0x1173a, 0x1171a, 0x01731, 0x03706,
+    0x0574e, 0x05729, 0x05744, 0x0761f, 0x11746, 0x11721, 0x0173a, 0x0171a, 0x0174c, 0x01727, 0x01740, 0x09619, 0x0d742, 0x0d71e, 0x15430, 0x09609,
+    0x19744, 0x1b31f, 0x07232, 0x0770b, 0x1d73a, 0x1f71a, 0x07231, 0x27706, 0x19742, 0x1b31e, 0x1b230, 0x27609, 0x1d738, 0x1f718, 0x1b22f, 0x09703,
+    0x1d74e, 0x1d729, 0x01746, 0x01721, 0x11744, 0x1351f, 0x0d73a, 0x0f71a, 0x1174c, 0x11727, 0x01742, 0x0361e, 0x11740, 0x17519, 0x03430, 0x29509,
+    0x1d744, 0x1f31f, 0x1973a, 0x1971a, 0x1f132, 0x1f70b, 0x1f131, 0x2f706, 0x1d742, 0x1f31e, 0x05738, 0x07718, 0x23130, 0x17509, 0x2312f, 0x17703,
+    0x1974c, 0x19727, 0x05742, 0x0761e, 0x11742, 0x1171e, 0x01738, 0x01718, 0x0174a, 0x01725, 0x0173e, 0x09618, 0x1173e, 0x17518, 0x0342e, 0x09608,
+    0x19740, 0x21319, 0x0b230, 0x21309, 0x13130, 0x2f309, 0x1312f, 0x21703, 0x1973e, 0x21318, 0x2722e, 0x21308, 0x2f12e, 0x2f308, 0x2f12d, 0x01f01,
+    0x00f01, 0x2e12d, 0x2e308, 0x2e12e, 0x20308, 0x2622e, 0x20318, 0x1873e, 0x20703, 0x1212f, 0x2e309, 0x12130, 0x20309, 0x0a230, 0x20319, 0x18740,
+    0x08608, 0x0242e, 0x16518, 0x1073e, 0x08618, 0x0073e, 0x00725, 0x0074a, 0x00718, 0x00738, 0x1071e, 0x10742, 0x0661e, 0x04742, 0x18727, 0x1874c,
+    0x16703, 0x2212f, 0x16509, 0x22130, 0x06718, 0x04738, 0x1e31e, 0x1c742, 0x2e706, 0x1e131, 0x1e70b, 0x1e132, 0x1871a, 0x1873a, 0x1e31f, 0x1c744,
+    0x28509, 0x02430, 0x16519, 0x10740, 0x0261e, 0x00742, 0x10727, 0x1074c, 0x0e71a, 0x0c73a, 0x1251f, 0x10744, 0x00721, 0x00746, 0x1c729, 0x1c74e,
+    0x08703, 0x1a22f, 0x1e718, 0x1c738, 0x26609, 0x1a230, 0x1a31e, 0x18742, 0x26706, 0x06231, 0x1e71a, 0x1c73a, 0x0670b, 0x06232, 0x1a31f, 0x18744,
+    0x08609, 0x14430, 0x0c71e, 0x0c742, 0x08619, 0x00740, 0x00727, 0x0074c, 0x0071a, 0x0073a, 0x10721, 0x10746, 0x0661f, 0x04744, 0x04729, 0x0474e,
+    0x02706, 0x00731, 0x1071a, 0x1073a, 0x0671a, 0x0473a, 0x18721, 0x18746, 0x00716, 0x00736, 0x1e71c, 0x1c73c, 0x0671c, 0x0473c, 0x18723, 0x18748,
+    0x0270b, 0x02432, 0x0e51f, 0x0c744, 0x0261f, 0x00744, 0x00729, 0x0074e, 0x0071c, 0x0073c, 0x10723, 0x10748, 0x00723, 0x00748, 0x0072b, 0x00750,
+    0x24702, 0x0072e, 0x1e709, 0x1e133, 0x06709, 0x06233, 0x2031a, 0x1873f, 0x20704, 0x18730, 0x2230a, 0x12134, 0x2030a, 0x06234, 0x2031b, 0x18741,
+    0x02709, 0x00733, 0x1651a, 0x1073f, 0x0861a, 0x0073f, 0x00726, 0x0074b, 0x00719, 0x00739, 0x1071f, 0x10743, 0x0471f, 0x04743, 0x18728, 0x1874d,
+    0x16704, 0x10730, 0x1270a, 0x1e134, 0x06719, 0x04739, 0x1c71f, 0x1c743, 0x2e707, 0x1c732, 0x1e70c, 0x1e135, 0x1871b, 0x1873b, 0x1e320, 0x1c745,
+    0x0e70a, 0x0c734, 0x1651b, 0x10741, 0x0071f, 0x00743, 0x10728, 0x1074d, 0x0e71b, 0x0c73b, 0x10720, 0x10745, 0x00722, 0x00747, 0x1c72a, 0x1c74f,
+    0x08704, 0x00730, 0x1e719, 0x1c739, 0x0a60a, 0x1a234, 0x1871f, 0x18743, 0x26707, 0x04732, 0x1e71b, 0x1c73b, 0x0670c, 0x06235, 0x1a320, 0x18745,
+    0x0860a, 0x00734, 0x0c71f, 0x0c743, 0x0861b, 0x00741, 0x00728, 0x0074d, 0x0071b, 0x0073b, 0x10722, 0x10747, 0x06620, 0x04745, 0x0472a, 0x0474f,
+    0x02707, 0x00732, 0x1071b, 0x1073b, 0x0671b, 0x0473b, 0x18722, 0x18747, 0x00717, 0x00737, 0x1e71d, 0x1c73d, 0x0671d, 0x0473d, 0x18724, 0x18749,
+    0x0270c, 0x00735, 0x0c720, 0x0c745, 0x02620, 0x00745, 0x0072a, 0x0074f, 0x0071d, 0x0073d, 0x10724, 0x10749, 0x00724, 0x00749, 0x0072c, 0x01814,
+    0x00c08, 0x0082e, 0x1e918, 0x1ad3e, 0x06a18, 0x22e3e, 0x02b25, 0x02b4a, 0x00b18, 0x02b38, 0x14b1e, 0x14b42, 0x0aa1e, 0x08b42, 0x24b27, 0x24b4c,
+    0x00c18, 0x0ad3e, 0x26d25, 0x26d4a, 0x2ee25, 0x2ee4a, 0x2e1bb, 0x01fce, 0x2e18a, 0x22690, 0x2e18b, 0x20592, 0x2028b, 0x22692, 0x121bc, 0x01fa3,
+    0x06d18, 0x06d38, 0x20d1e, 0x20d42, 0x1618a, 0x14390, 0x1618b, 0x14392, 0x2e925, 0x2e95c, 0x2e927, 0x2e95e, 0x2838b, 0x14391, 0x1618c, 0x14393,
+    0x08c1e, 0x0ad42, 0x26d27, 0x26d4c, 0x2848b, 0x16692, 0x221bc, 0x07fa3, 0x2058b, 0x20591, 0x2218c, 0x20593, 0x1e1bd, 0x1e6c1, 0x1e1be, 0x01f66,
+    0x1ee18, 0x1ee38, 0x0838a, 0x08390, 0x22e1e, 0x22e42, 0x2628b, 0x08392, 0x26a25, 0x26a5c, 0x0838b, 0x08391, 0x26a27, 0x26a5e, 0x0838c, 0x08393,
+    0x14c1e, 0x16e42, 0x0848b, 0x0a592, 0x2ee27, 0x2ee4c, 0x1a2bc, 0x1ffa3, 0x2e68b, 0x22691, 0x062bd, 0x065c1, 0x2028c, 0x22693, 0x062be, 0x11f66,
+    0x02c25, 0x24c5c, 0x2658b, 0x0a591, 0x1668b, 0x16691, 0x023bd, 0x023c1, 0x023bb, 0x023bf, 0x143bc, 0x0e3c0, 0x023bc, 0x023c0, 0x023be, 0x0dd99,
+    0x24c27, 0x24c5e, 0x0a58c, 0x0a593, 0x1668c, 0x16693, 0x024be, 0x19f66, 0x126bc, 0x126c0, 0x065be, 0x05e99, 0x1e6be, 0x11d99, 0x1c1d5, 0x01f2b,
+    0x00f2e, 0x2e167, 0x1e938, 0x2e168, 0x06a38, 0x26268, 0x24b5c, 0x2436e, 0x0aa3e, 0x24368, 0x16942, 0x2a16a, 0x0aa42, 0x2436a, 0x24b5e, 0x2436f,
+    0x02c38, 0x24468, 0x26d5c, 0x2656e, 0x2ee5c, 0x2e66e, 0x1e1bf, 0x01fba, 0x22190, 0x221a4, 0x22191, 0x221a5, 0x20291, 0x202a5, 0x121c0, 0x01f89,
+    0x02c3e, 0x26568, 0x22942, 0x2e16a, 0x16190, 0x161a4, 0x16191, 0x161a5, 0x2e94a, 0x2e16e, 0x2e94c, 0x2e16f, 0x16192, 0x143a5, 0x16193, 0x11c74,
+    0x08c42, 0x2656a, 0x26d5e, 0x2656f, 0x14491, 0x144a5, 0x1e1c0, 0x05f89, 0x22192, 0x205a5, 0x22193, 0x19e74, 0x1e1c1, 0x1e1cf, 0x1dc99, 0x01e47,
+    0x14c3e, 0x2e668, 0x0a290, 0x083a4, 0x20a42, 0x2c26a, 0x0a291, 0x0a2a5, 0x26a4a, 0x2626e, 0x0a292, 0x083a5, 0x26a4c, 0x2626f, 0x0a293, 0x05c74,
+    0x14c42, 0x2a66a, 0x08491, 0x084a5, 0x2ee5e, 0x2e66f, 0x1a2c0, 0x1df89, 0x20292, 0x226a5, 0x062c1, 0x062cf, 0x20293, 0x1dd74, 0x19c99, 0x11d47,
+    0x02c4a, 0x2446e, 0x08492, 0x0a5a5, 0x14492, 0x166a5, 0x024c1, 0x023cf, 0x018ce, 0x018ba, 0x1f8a3, 0x1d889, 0x078a3, 0x05889, 0x19866, 0x19c47,
+    0x24c4c, 0x2446f, 0x08493, 0x01a74, 0x14493, 0x11b74, 0x0da99, 0x19b47, 0x018a3, 0x01889, 0x11866, 0x11a47, 0x01866, 0x01947, 0x0182b, 0x01f13,
+    0x1ed03, 0x2e12f, 0x1e909, 0x2e130, 0x08b18, 0x08b38, 0x2a31e, 0x28b42, 0x2eb06, 0x16131, 0x16b0b, 0x16132, 0x24b1a, 0x24b3a, 0x2a31f, 0x28b44,
+    0x08d18, 0x26d38, 0x2e51e, 0x2cd42, 0x1e18a, 0x10390, 0x1e18b, 0x10392, 0x2e525, 0x2255c, 0x22527, 0x2255e, 0x1c38b, 0x10391, 0x1218c, 0x10393,
+    0x2ed06, 0x2e131, 0x2ed0b, 0x2e132, 0x2e325, 0x1235c, 0x12327, 0x1235e, 0x2e310, 0x2e136, 0x12311, 0x2e137, 0x2e326, 0x1235d, 0x12328, 0x1235f,
+    0x24d1a, 0x26d3a, 0x2e51f, 0x2cd44, 0x1c58b, 0x1c591, 0x1e18c, 0x1c593, 0x2e526, 0x2255d, 0x22528, 0x2255f, 0x1e18d, 0x10398, 0x1e18e, 0x01e65,
+    0x2e72f, 0x08379, 0x1e738, 0x1037b, 0x26b38, 0x0837b, 0x2c356, 0x08382, 0x2e731, 0x0837a, 0x1e73a, 0x1037c, 0x26b3a, 0x0837c, 0x2c357, 0x08383,
+    0x08d38, 0x0857b, 0x16556, 0x0a582, 0x1c390, 0x1c39a, 0x1c394, 0x1039c, 0x1255c, 0x1c585, 0x12560, 0x1c587, 0x1c391, 0x1c39b, 0x1c395, 0x0df77,
+    0x16731, 0x0857a, 0x1273a, 0x1e57c, 0x2235c, 0x1c385, 0x1e360, 0x10387, 0x2e736, 0x1e37f, 0x1e73c, 0x10380, 0x2235d, 0x1c386, 0x1e361, 0x10388,
+    0x24d3a, 0x0857c, 0x16557, 0x0a583, 0x10591, 0x1c59b, 0x10595, 0x19f77, 0x1255d, 0x1c586, 0x12561, 0x1c588, 0x1c398, 0x1c39e, 0x1c399, 0x01f48,
+    0x1ef09, 0x1e138, 0x2e30d, 0x1e139, 0x2e31e, 0x16356, 0x2e321, 0x16358, 0x2eb0b, 0x1213a, 0x2e30e, 0x1213b, 0x2e31f, 0x16357, 0x2e322, 0x16359,
+    0x2a51e, 0x2c556, 0x2e521, 0x22558, 0x1e78b, 0x10394, 0x1c38d, 0x10396, 0x12527, 0x1e560, 0x1e529, 0x1e562, 0x1c38c, 0x10395, 0x1c38e, 0x10397,
+    0x16d0b, 0x1e13a, 0x2e50e, 0x1e13b, 0x22327, 0x12360, 0x1e329, 0x12362, 0x22311, 0x1e13c, 0x1e312, 0x1e13d, 0x22328, 0x12361, 0x1e32a, 0x12363,
+    0x2a51f, 0x2c557, 0x2e522, 0x22559, 0x1278c, 0x1c595, 0x1c58e, 0x1c597, 0x12528, 0x1e561, 0x1e52a, 0x1e563, 0x1e78e, 0x10399, 0x1e18f, 0x1de2a,
+    0x2e730, 0x1e37b, 0x1e739, 0x1e37d, 0x2cb42, 0x0a382, 0x22358, 0x1c384, 0x2e732, 0x1e37c, 0x1e73b, 0x1e37e, 0x2cb44, 0x0a383, 0x22359, 0x01c71,
+    0x28d42, 0x08582, 0x16558, 0x1c584, 0x1c392, 0x1c39c, 0x1c396, 0x1c39d, 0x1255e, 0x10587, 0x12562, 0x1c589, 0x1c393, 0x19977, 0x1c397, 0x01d4d,
+    0x16732, 0x1057c, 0x1273b, 0x1e57e, 0x2235e, 0x1c387, 0x1e362, 0x1c389, 0x2e737, 0x1e380, 0x1e73d, 0x1e381, 0x2235f, 0x1c388, 0x1e363, 0x1dc3d,
+    0x28d44, 0x08583, 0x16559, 0x01a71, 0x10593, 0x0d977, 0x10597, 0x01b4d, 0x1255f, 0x10588, 0x12563, 0x1da3d, 0x01865, 0x01948, 0x1d82a, 0x1de12,
+    0x1c909, 0x00830, 0x1e919, 0x1ad40, 0x00a1e, 0x02b42, 0x14b27, 0x14b4c, 0x0eb1a, 0x0eb3a, 0x1691f, 0x14b44, 0x02b21, 0x02b46, 0x28b29, 0x28b4e,
+    0x04c1e, 0x06d42, 0x1ad27, 0x1ad4c, 0x1c88b, 0x1ec92, 0x2e1bc, 0x09fa3, 0x2098b, 0x2c991, 0x2e18c, 0x2c993, 0x161bd, 0x16ac1, 0x161be, 0x03f66,
+    0x18d1a, 0x1ad3a, 0x2291f, 0x20d44, 0x2898b, 0x28991, 0x2a18c, 0x28993, 0x2e926, 0x2e95d, 0x2e928, 0x2e95f, 0x1618d, 0x14398, 0x1618e, 0x03e65,
+    0x0ad21, 0x0ad46, 0x20d29, 0x20d4e, 0x2e1bd, 0x2ecc1, 0x2e1be, 0x0bf66, 0x2e18d, 0x20598, 0x2e18e, 0x0be65, 0x2e1c2, 0x2e1d0, 0x2e1c3, 0x01e52,
+    0x1ce38, 0x1ec7b, 0x24390, 0x0839a, 0x06a56, 0x24a82, 0x24394, 0x0839c, 0x0aa5c, 0x08a85, 0x24391, 0x0839b, 0x0aa60, 0x24a87, 0x24395, 0x03f77,
+    0x02c56, 0x26c82, 0x26594, 0x0a59c, 0x12c94, 0x1ec9c, 0x1c1d6, 0x09f9f, 0x205c4, 0x1a5ca, 0x205c6, 0x0bfa8, 0x2eac6, 0x13fa8, 0x101d7, 0x03f5a,
+    0x02c5c, 0x26c85, 0x26591, 0x2659b, 0x283c4, 0x0e3ca, 0x143c6, 0x09fa8, 0x283bf, 0x143c9, 0x143c0, 0x09ea1, 0x283c5, 0x0e3cb, 0x143c7, 0x03e61,
+    0x08c60, 0x26c87, 0x26595, 0x07f77, 0x2acc6, 0x1ffa8, 0x1c1d7, 0x07f5a, 0x205c5, 0x1a5cb, 0x205c7, 0x07e61, 0x1c1d8, 0x11d98, 0x1febe, 0x01f23,
+    0x1cf33, 0x2e968, 0x1e939, 0x2e169, 0x24b56, 0x28372, 0x28b60, 0x28375, 0x1293f, 0x2a16b, 0x16943, 0x2a16c, 0x24b58, 0x28373, 0x28b62, 0x28376,
+    0x08d56, 0x2c572, 0x2cd60, 0x2c575, 0x1e1c4, 0x1e1d1, 0x1e1c5, 0x09fa2, 0x22194, 0x221a6, 0x22195, 0x221a7, 0x121c6, 0x121d2, 0x121c7, 0x03f62,
+    0x2293f, 0x2e16b, 0x22943, 0x2e16c, 0x16194, 0x161a6, 0x16195, 0x161a7, 0x2e94b, 0x2e170, 0x2e94d, 0x2e171, 0x16196, 0x161a8, 0x16197, 0x0de59,
+    0x26d58, 0x2c573, 0x2cd62, 0x2c576, 0x1e1c6, 0x1e1d2, 0x1e1c7, 0x07f62, 0x22196, 0x221a8, 0x22197, 0x19e59, 0x1e1c8, 0x1f8c1, 0x1fe8e, 0x01e22,
+    0x00f68, 0x083aa, 0x243a4, 0x083b0, 0x06a72, 0x083ac, 0x243a6, 0x083b2, 0x0ab6e, 0x083ab, 0x243a5, 0x083b1, 0x0ab75, 0x083ad, 0x243a7, 0x01c6c,
+    0x02c72, 0x0a5ac, 0x265a6, 0x0a5b2, 0x1ced1, 0x1ffae, 0x019cc, 0x1df84, 0x205d1, 0x1a5d3, 0x205d2, 0x09ea5, 0x059a9, 0x1dd73, 0x19c95, 0x0dd43,
+    0x02d6e, 0x265ab, 0x265a5, 0x265b1, 0x283d1, 0x0e3d3, 0x143d2, 0x0bea5, 0x2f8ba, 0x1f8b9, 0x1f889, 0x1fe7e, 0x198a2, 0x19887, 0x1d862, 0x11c3b,
+    0x08d75, 0x0a5ad, 0x265a7, 0x05a6c, 0x019a9, 0x11b73, 0x0da95, 0x19b43, 0x0f8a2, 0x0d887, 0x11862, 0x1da3b, 0x01864, 0x01946, 0x1d829, 0x01e0e,
+    0x06e03, 0x2622f, 0x16b18, 0x28b38, 0x06a09, 0x26230, 0x2631e, 0x24b42, 0x26b06, 0x26231, 0x2ab1a, 0x28b3a, 0x26b0b, 0x26232, 0x2631f, 0x24b44,
+    0x16e18, 0x16e38, 0x0438a, 0x04390, 0x2c61e, 0x2ee42, 0x0628b, 0x04392, 0x26625, 0x1a65c, 0x0438b, 0x04391, 0x1a627, 0x1a65e, 0x0438c, 0x04393,
+    0x2672f, 0x06379, 0x16b38, 0x1637b, 0x06738, 0x0637b, 0x20356, 0x04382, 0x20731, 0x0637a, 0x2ab3a, 0x1637c, 0x1a73a, 0x0637c, 0x20357, 0x04383,
+    0x28e38, 0x1667b, 0x18390, 0x0439a, 0x24656, 0x18682, 0x18394, 0x0439c, 0x0a65c, 0x04685, 0x18391, 0x0439b, 0x06660, 0x18687, 0x18395, 0x01f77,
+    0x26e06, 0x20231, 0x26325, 0x0a35c, 0x20e0b, 0x20232, 0x0a327, 0x0a35e, 0x26310, 0x26236, 0x26326, 0x0a35d, 0x0a311, 0x26237, 0x0a328, 0x0a35f,
+    0x2ae1a, 0x2ae3a, 0x0468b, 0x18691, 0x2c61f, 0x2ee44, 0x1a28c, 0x18693, 0x26626, 0x1a65d, 0x0628d, 0x04398, 0x1a628, 0x1a65f, 0x0628e, 0x11d65,
+    0x26731, 0x0667a, 0x1a35c, 0x04385, 0x0673a, 0x1867c, 0x1a360, 0x04387, 0x26736, 0x0637f, 0x1a35d, 0x04386, 0x0673c, 0x06380, 0x1a361, 0x04388,
+    0x28e3a, 0x1667c, 0x04691, 0x0469b, 0x24657, 0x18683, 0x04695, 0x1df77, 0x0a65d, 0x04686, 0x18398, 0x0439e, 0x06661, 0x18688, 0x18399, 0x11f48,
+    0x06f09, 0x06238, 0x2c31e, 0x24356, 0x2630d, 0x06239, 0x26321, 0x0a358, 0x20b0b, 0x0623a, 0x2c31f, 0x24357, 0x2630e, 0x0623b, 0x26322, 0x0a359,
+    0x2661e, 0x20656, 0x0678b, 0x04394, 0x26621, 0x20658, 0x0438d, 0x04396, 0x0a627, 0x1a660, 0x1838c, 0x04395, 0x06629, 0x1a662, 0x0438e, 0x04397,
+    0x26730, 0x1837b, 0x2eb42, 0x18382, 0x06739, 0x0637d, 0x20358, 0x04384, 0x20732, 0x1837c, 0x2eb44, 0x18383, 0x1a73b, 0x0637e, 0x20359, 0x11c71,
+    0x24e42, 0x04682, 0x18392, 0x1839c, 0x0a658, 0x04684, 0x18396, 0x0439d, 0x0a65e, 0x04687, 0x18393, 0x1da77, 0x06662, 0x04689, 0x18397, 0x11e4d,
+    0x26e0b, 0x1a23a, 0x1a327, 0x06360, 0x2660e, 0x1a23b, 0x06329, 0x06362, 0x1a311, 0x0623c, 0x1a328, 0x06361, 0x06312, 0x0623d, 0x0632a, 0x06363,
+    0x2661f, 0x20657, 0x0468c, 0x18695, 0x26622, 0x20659, 0x0468e, 0x18697, 0x0a628, 0x1a661, 0x0678e, 0x04399, 0x0662a, 0x1a663, 0x0438f, 0x05d2a,
+    0x26732, 0x0667c, 0x1a35e, 0x18387, 0x0673b, 0x0667e, 0x1a362, 0x04389, 0x26737, 0x18380, 0x1a35f, 0x18388, 0x0673d, 0x06381, 0x1a363, 0x05c3d,
+    0x24e44, 0x04683, 0x04693, 0x01a77, 0x0a659, 0x11971, 0x04697, 0x11b4d, 0x0a65f, 0x04688, 0x11865, 0x11a48, 0x06663, 0x0593d, 0x0582a, 0x05d12,
+    0x04a09, 0x10830, 0x0eb1e, 0x0eb42, 0x06a19, 0x22e40, 0x02b27, 0x02b4c, 0x00b1a, 0x02b3a, 0x14b21, 0x14b46, 0x0aa1f, 0x08b44, 0x08b29, 0x08b4e,
+    0x10c1e, 0x12e42, 0x0488b, 0x1ac92, 0x22e27, 0x22e4c, 0x262bc, 0x17fa3, 0x2ea8b, 0x2ea91, 0x262bd, 0x269c1, 0x2c28c, 0x2ea93, 0x262be, 0x15f66,
+    0x04d38, 0x18c7b, 0x1c956, 0x06982, 0x28390, 0x2839a, 0x28394, 0x1439c, 0x1295c, 0x28985, 0x16960, 0x28987, 0x28391, 0x2839b, 0x28395, 0x0ff77,
+    0x00c56, 0x1ac82, 0x06c94, 0x1ac9c, 0x2a694, 0x1669c, 0x281d6, 0x07f9f, 0x2e6c4, 0x1e6ca, 0x2c9c6, 0x07fa8, 0x226c6, 0x17fa8, 0x141d7, 0x01f5a,
+    0x1ee1a, 0x1ee3a, 0x08a8b, 0x24a91, 0x20a1f, 0x22e44, 0x2628c, 0x24a93, 0x26a26, 0x26a5d, 0x2628d, 0x08398, 0x26a28, 0x26a5f, 0x2628e, 0x15d65,
+    0x12e21, 0x12e46, 0x202bd, 0x20cc1, 0x2ee29, 0x2ee4e, 0x202be, 0x13f66, 0x2028d, 0x22698, 0x262c2, 0x262d0, 0x2028e, 0x13d65, 0x262c3, 0x11d52,
+    0x14c5c, 0x16c85, 0x083c4, 0x023ca, 0x2a691, 0x1669b, 0x083c6, 0x15fa8, 0x083bf, 0x023c9, 0x083c5, 0x023cb, 0x083c0, 0x17da1, 0x083c7, 0x0fd61,
+    0x14c60, 0x2ac87, 0x26cc6, 0x1bfa8, 0x2a695, 0x13f77, 0x182d7, 0x1df5a, 0x2e6c5, 0x1e6cb, 0x042d8, 0x05e98, 0x226c7, 0x13d61, 0x07dbe, 0x11f23,
+    0x04f33, 0x26a68, 0x16b56, 0x24372, 0x06a39, 0x26269, 0x24b60, 0x24375, 0x0aa3f, 0x2626b, 0x28b58, 0x24373, 0x0aa43, 0x2626c, 0x24b62, 0x24376,
+    0x2ae56, 0x2e672, 0x062c4, 0x062d1, 0x2ee60, 0x2e675, 0x062c5, 0x17fa2, 0x20294, 0x202a6, 0x062c6, 0x062d2, 0x20295, 0x202a7, 0x062c7, 0x0ff62,
+    0x10f68, 0x283aa, 0x16b72, 0x143ac, 0x283a4, 0x283b0, 0x283a6, 0x143b2, 0x12b6e, 0x283ab, 0x16b75, 0x143ad, 0x283a5, 0x283b1, 0x283a7, 0x0dc6c,
+    0x0ec72, 0x166ac, 0x04dd1, 0x07fae, 0x2a6a6, 0x166b2, 0x11acc, 0x05f84, 0x2e6d1, 0x1e6d3, 0x11aa9, 0x19e73, 0x226d2, 0x15da5, 0x1dc95, 0x01e43,
+    0x1aa3f, 0x2c26b, 0x0a294, 0x0a2a6, 0x20a43, 0x2c26c, 0x0a295, 0x0a2a7, 0x26a4b, 0x26270, 0x0a296, 0x0a2a8, 0x26a4d, 0x26271, 0x0a297, 0x01d59,
+    0x2ae58, 0x2e673, 0x1a2c6, 0x1a2d2, 0x2ee62, 0x2e676, 0x1a2c7, 0x13f62, 0x20296, 0x202a8, 0x062c8, 0x078c1, 0x20297, 0x1dd59, 0x07d8e, 0x11d22,
+    0x14e6e, 0x166ab, 0x083d1, 0x023d3, 0x2a6a5, 0x166b1, 0x083d2, 0x17da5, 0x278ba, 0x078b9, 0x1f8a2, 0x1d887, 0x07889, 0x07d7e, 0x19862, 0x05c3b,
+    0x14e75, 0x166ad, 0x0daa9, 0x05b73, 0x2a6a7, 0x1196c, 0x01995, 0x1db43, 0x018a2, 0x01887, 0x11864, 0x11a46, 0x05862, 0x1993b, 0x05829, 0x11d0e,
+    0x00b06, 0x02b31, 0x16b1a, 0x14b3a, 0x08b1a, 0x08b3a, 0x24b21, 0x24b46, 0x00b16, 0x02b36, 0x16b1c, 0x28b3c, 0x08b1c, 0x08b3c, 0x24b23, 0x24b48,
+    0x00c25, 0x18c5c, 0x0698b, 0x06991, 0x1ea8b, 0x12a91, 0x003bd, 0x003c1, 0x003bb, 0x003bf, 0x103bc, 0x0c3c0, 0x003bc, 0x003c0, 0x003be, 0x0fd99,
+    0x1cd31, 0x0697a, 0x16b3a, 0x2a97c, 0x2e35c, 0x28385, 0x2a360, 0x14387, 0x2eb36, 0x1637f, 0x16b3c, 0x16380, 0x2e35d, 0x28386, 0x2a361, 0x14388,
+    0x00c5c, 0x06c85, 0x1a991, 0x0699b, 0x1c3c4, 0x0c3ca, 0x103c6, 0x05fa8, 0x1c3bf, 0x103c9, 0x103c0, 0x07ea1, 0x1c3c5, 0x0c3cb, 0x103c7, 0x01e61,
+    0x04e31, 0x08a7a, 0x2635c, 0x08385, 0x0ab3a, 0x24a7c, 0x26360, 0x08387, 0x26b36, 0x0837f, 0x2635d, 0x08386, 0x26b3c, 0x08380, 0x26361, 0x08388,
+    0x10c5c, 0x1ec85, 0x043c4, 0x003ca, 0x1ea91, 0x1ea9b, 0x043c6, 0x11fa8, 0x043bf, 0x003c9, 0x043c5, 0x003cb, 0x043c0, 0x1fda1, 0x043c7, 0x0dd61,
+    0x00f7a, 0x003b5, 0x2e385, 0x103b7, 0x20385, 0x003b7, 0x203a0, 0x003b9, 0x2037f, 0x003b6, 0x2e386, 0x103b8, 0x20386, 0x003b8, 0x203a1, 0x01d80,
+    0x02c85, 0x24cb7, 0x1c3ca, 0x07eaf, 0x183ca, 0x1fdaf, 0x183cc, 0x19f70, 0x183c9, 0x003cd, 0x1c3cb, 0x05e86, 0x183cb, 0x1dd86, 0x07dc0, 0x01f3c,
+    0x20b1a, 0x2435c, 0x2eb21, 0x28360, 0x26b21, 0x24360, 0x24351, 0x24364, 0x20b1c, 0x2435d, 0x2eb23, 0x28361, 0x26b23, 0x24361, 0x24352, 0x24365,
+    0x02f8b, 0x003c4, 0x1c3bd, 0x0c3c6, 0x043bd, 0x003c6, 0x003c2, 0x003c8, 0x183bc, 0x003c5, 0x1c3be, 0x0c3c7, 0x043be, 0x003c7, 0x003c3, 0x01c8e,
+    0x22b3a, 0x16385, 0x2eb46, 0x16387, 0x2e360, 0x163a0, 0x2e364, 0x163a2, 0x2eb3c, 0x16386, 0x2eb48, 0x16388, 0x2e361, 0x163a1, 0x2e365, 0x11e5f,
+    0x0ef91, 0x103ca, 0x1c3c1, 0x19aa8, 0x1c3c6, 0x103cc, 0x1c3c8, 0x05f96, 0x1c3c0, 0x103cb, 0x1fe99, 0x1de61, 0x1c3c7, 0x03dc0, 0x1dc8e, 0x11e28,
+    0x20b3a, 0x26385, 0x2c360, 0x083a0, 0x26b46, 0x0a387, 0x26364, 0x083a2, 0x20b3c, 0x26386, 0x2c361, 0x083a1, 0x26b48, 0x0a388, 0x26365, 0x01d5f,
+    0x02f91, 0x043ca, 0x183c6, 0x003cc, 0x043c1, 0x1d9a8, 0x043c8, 0x11f96, 0x183c0, 0x043cb, 0x183c7, 0x0fec0, 0x1bd99, 0x19d61, 0x05c8e, 0x01d28,
+    0x2cf7c, 0x183b7, 0x22387, 0x1e3b9, 0x20387, 0x063b9, 0x203a2, 0x003ba, 0x20380, 0x183b8, 0x22388, 0x11e80, 0x20388, 0x07d80, 0x1985f, 0x01c37,
+    0x02f9b, 0x01baf, 0x0daa8, 0x01a70, 0x019a8, 0x11970, 0x0da96, 0x01b4b, 0x018a1, 0x01886, 0x11861, 0x1da3c, 0x05861, 0x0593c, 0x19828, 0x01d11,
+    0x00b0b, 0x00832, 0x0c91f, 0x0eb44, 0x00a1f, 0x02b44, 0x02b29, 0x02b4e, 0x00b1c, 0x02b3c, 0x14b23, 0x14b48, 0x02b23, 0x02b48, 0x02b2b, 0x03f50,
+    0x18c27, 0x18c5e, 0x0698c, 0x06993, 0x12a8c, 0x12a93, 0x008be, 0x25f66, 0x12abc, 0x16ac0, 0x269be, 0x25799, 0x16abe, 0x29799, 0x281d5, 0x03f2b,
+    0x18d3a, 0x0697c, 0x1c957, 0x06983, 0x14991, 0x2899b, 0x14995, 0x25f77, 0x1295d, 0x28986, 0x16961, 0x25e88, 0x28398, 0x2839e, 0x28399, 0x03f48,
+    0x04c60, 0x1ac87, 0x1a995, 0x0bf77, 0x1ecc6, 0x2bfa8, 0x281d7, 0x25f5a, 0x209c5, 0x257cb, 0x2fec7, 0x0be61, 0x281d8, 0x29798, 0x17ebe, 0x03f23,
+    0x1ce3a, 0x10a7c, 0x08a91, 0x08a9b, 0x06a57, 0x24a83, 0x08a95, 0x29f77, 0x0aa5d, 0x08a86, 0x24398, 0x0839e, 0x0aa61, 0x29d88, 0x24399, 0x15f48,
+    0x10c60, 0x1ec87, 0x1acc6, 0x27fa8, 0x1ea95, 0x17f77, 0x242d7, 0x17f5a, 0x2eac5, 0x297cb, 0x082d8, 0x25798, 0x2ddc7, 0x17d61, 0x27dbe, 0x15f23,
+    0x00c85, 0x18cb7, 0x283ca, 0x097af, 0x243ca, 0x297af, 0x243cc, 0x25f70, 0x243c9, 0x023cd, 0x283cb, 0x09e86, 0x243cb, 0x29d86, 0x0bdc0, 0x03f3c,
+    0x00ca0, 0x20cb9, 0x0accc, 0x0bf70, 0x12ccc, 0x13f70, 0x037d6, 0x25f54, 0x003db, 0x257c9, 0x2fec5, 0x0be5d, 0x21dc5, 0x13d5d, 0x0bdbc, 0x01f1c,
+    0x18f3f, 0x24b6e, 0x16b58, 0x28b75, 0x0ab58, 0x24b75, 0x24b64, 0x24378, 0x24b54, 0x24b70, 0x16b5a, 0x28b77, 0x24b5a, 0x24b77, 0x24b66, 0x03f4e,
+    0x00d94, 0x02cd1, 0x18dc6, 0x257a9, 0x1cec6, 0x297a9, 0x023d8, 0x25f64, 0x023d6, 0x257cc, 0x0e3d7, 0x09e95, 0x023d7, 0x15d95, 0x01cbe, 0x03f29,
+    0x10d6b, 0x169ab, 0x12973, 0x27ead, 0x2aba6, 0x283b3, 0x283a9, 0x25f75, 0x12b70, 0x283af, 0x16b77, 0x25e83, 0x2aba8, 0x29d9b, 0x13e93, 0x03f44,
+    0x00da6, 0x257d3, 0x18dd2, 0x07e73, 0x141da, 0x2bfa6, 0x1dac6, 0x0bf58, 0x138cc, 0x257ca, 0x1fe95, 0x07e57, 0x1f8c6, 0x15d91, 0x11c8c, 0x01e1f,
+    0x04e6b, 0x26aab, 0x26ba6, 0x083b3, 0x06a73, 0x2bdad, 0x243a9, 0x29f75, 0x0ab70, 0x083af, 0x26ba8, 0x09e9b, 0x0ab77, 0x07d83, 0x07d93, 0x0ff44,
+    0x0cea6, 0x297d3, 0x023da, 0x27fa6, 0x1ced2, 0x13d73, 0x199c6, 0x17f58, 0x0b8cc, 0x297ca, 0x1b8c6, 0x09e91, 0x1bd95, 0x1dd57, 0x05c8c, 0x0dd1f,
+    0x00fab, 0x023d4, 0x283d3, 0x27eab, 0x243d3, 0x17dab, 0x038d1, 0x25f6e, 0x218b9, 0x198b7, 0x1f887, 0x11e7c, 0x1b887, 0x07d7c, 0x1985e, 0x01c32,
+    0x02cb3, 0x01bab, 0x0daa6, 0x07f6b, 0x019a6, 0x13f6b, 0x0da94, 0x19b3f, 0x018a0, 0x01885, 0x11860, 0x1da3a, 0x05860, 0x1993a, 0x19827, 0x01f0b,
+    0x18f02, 0x02b2e, 0x16b09, 0x16133, 0x26b09, 0x26233, 0x2c31a, 0x24b3f, 0x20b04, 0x24b30, 0x2e30a, 0x16134, 0x2c30a, 0x0a234, 0x2c31b, 0x24b41,
+    0x02f2e, 0x22167, 0x16538, 0x22168, 0x26638, 0x1a268, 0x1875c, 0x1836e, 0x0a63e, 0x18368, 0x12542, 0x1e16a, 0x06642, 0x1836a, 0x1875e, 0x1836f,
+    0x16f09, 0x16138, 0x2230d, 0x16139, 0x2231e, 0x1c356, 0x22321, 0x12358, 0x2e70b, 0x1613a, 0x2230e, 0x1613b, 0x2231f, 0x1c357, 0x22322, 0x12359,
+    0x16533, 0x22568, 0x16539, 0x22169, 0x06756, 0x1c372, 0x1c760, 0x1c375, 0x1253f, 0x1e16b, 0x12543, 0x1e16c, 0x18758, 0x1c373, 0x1c762, 0x1c376,
+    0x26f09, 0x26238, 0x2031e, 0x06356, 0x1a30d, 0x26239, 0x1a321, 0x06358, 0x2070b, 0x0a23a, 0x2031f, 0x06357, 0x1a30e, 0x0a23b, 0x1a322, 0x06359,
+    0x26633, 0x1a668, 0x1c756, 0x18372, 0x26639, 0x1a269, 0x18760, 0x18375, 0x0a63f, 0x1a26b, 0x1c758, 0x18373, 0x06643, 0x1a26c, 0x18762, 0x18376,
+    0x2c71a, 0x1835c, 0x22721, 0x1c360, 0x1a721, 0x18360, 0x18351, 0x18364, 0x2071c, 0x1835d, 0x22723, 0x1c361, 0x1a723, 0x18361, 0x18352, 0x18365,
+    0x24f3f, 0x1876e, 0x12758, 0x1c775, 0x06758, 0x18775, 0x18764, 0x18378, 0x24754, 0x18770, 0x1c75a, 0x1c777, 0x0675a, 0x18777, 0x18766, 0x01f4e,
+    0x20f04, 0x1213e, 0x2e30b, 0x1213f, 0x2030b, 0x0a23f, 0x2031c, 0x24354, 0x20305, 0x12140, 0x2e30c, 0x12141, 0x2030c, 0x0a241, 0x2031d, 0x24355,
+    0x24f30, 0x18768, 0x1653a, 0x1c36b, 0x0a63a, 0x1836b, 0x1875d, 0x18370, 0x0a640, 0x18369, 0x12544, 0x1c36c, 0x06644, 0x1836c, 0x1875f, 0x18371,
+    0x2e70a, 0x12142, 0x2270e, 0x12143, 0x2071f, 0x1c358, 0x22323, 0x1c35a, 0x2e70c, 0x12144, 0x2230f, 0x12145, 0x22320, 0x1c359, 0x22324, 0x1c35b,
+    0x16534, 0x1c76a, 0x1653b, 0x1e56c, 0x06757, 0x18773, 0x1c761, 0x1c377, 0x12541, 0x1c76c, 0x12545, 0x1e16d, 0x18759, 0x1c374, 0x1c763, 0x11e45,
+    0x2c70a, 0x06242, 0x2271f, 0x18358, 0x1a70e, 0x06243, 0x1a323, 0x0635a, 0x2070c, 0x06244, 0x20320, 0x18359, 0x1a30f, 0x06245, 0x1a324, 0x0635b,
+    0x0a634, 0x1a66a, 0x1c757, 0x1c773, 0x0a63b, 0x1a66c, 0x18761, 0x18377, 0x0a641, 0x1876c, 0x1c759, 0x18374, 0x06645, 0x1836d, 0x18763, 0x05d45,
+    0x2c71b, 0x1835e, 0x22722, 0x1c362, 0x1a722, 0x18362, 0x18752, 0x18366, 0x2071d, 0x1835f, 0x22724, 0x1c363, 0x1a724, 0x18363, 0x18353, 0x19c24,
+    0x24f41, 0x1876f, 0x12759, 0x1c776, 0x06759, 0x18776, 0x18765, 0x01b4e, 0x24755, 0x18771, 0x1c75b, 0x11a45, 0x0675b, 0x05945, 0x19824, 0x19c0f,
+    0x00b09, 0x02b33, 0x1091a, 0x14b3f, 0x06a1a, 0x02b3f, 0x02b26, 0x02b4b, 0x00b19, 0x02b39, 0x14b1f, 0x14b43, 0x08b1f, 0x08b43, 0x24b28, 0x24b4d,
+    0x00c38, 0x18868, 0x1ad5c, 0x1a96e, 0x22e5c, 0x22a6e, 0x161bf, 0x03fba, 0x2e190, 0x2e1a4, 0x2e191, 0x2e1a5, 0x2c291, 0x2c2a5, 0x161c0, 0x03f89,
+    0x1cd1e, 0x20956, 0x22921, 0x2e958, 0x16b8b, 0x14394, 0x2838d, 0x14396, 0x12927, 0x2a960, 0x16929, 0x2a962, 0x2838c, 0x14395, 0x2838e, 0x14397,
+    0x04d56, 0x1ad72, 0x20d60, 0x20975, 0x161c4, 0x161d1, 0x161c5, 0x07fa2, 0x2e194, 0x2e1a6, 0x2e195, 0x2e1a7, 0x161c6, 0x161d2, 0x161c7, 0x01f62,
+    0x18e1e, 0x2ca56, 0x26b8b, 0x08394, 0x1aa21, 0x2ca58, 0x0838d, 0x08396, 0x0aa27, 0x26a60, 0x2438c, 0x08395, 0x26a29, 0x26a62, 0x0838e, 0x08397,
+    0x1ee56, 0x1ee72, 0x262c4, 0x262d1, 0x22e60, 0x22a75, 0x262c5, 0x11fa2, 0x2c294, 0x2c2a6, 0x0a2c6, 0x0a2d2, 0x2c295, 0x2c2a7, 0x0a2c7, 0x0df62,
+    0x00f8b, 0x023c4, 0x283bd, 0x0e3c6, 0x083bd, 0x023c6, 0x023c2, 0x023c8, 0x243bc, 0x023c5, 0x283be, 0x0e3c7, 0x083be, 0x023c7, 0x023c3, 0x03c8e,
+    0x02d94, 0x00cd1, 0x24dc6, 0x1bfa9, 0x28ec6, 0x1ffa9, 0x003d8, 0x19f64, 0x003d6, 0x19bcc, 0x0c3d7, 0x05e95, 0x003d7, 0x11d95, 0x03cbe, 0x01f29,
+    0x18f30, 0x24b68, 0x1293a, 0x2836b, 0x06a3a, 0x2436b, 0x24b5d, 0x24370, 0x0aa40, 0x24369, 0x16944, 0x2836c, 0x0aa44, 0x2436c, 0x24b5f, 0x24371,
+    0x0ed7b, 0x2e1aa, 0x2ed85, 0x2e1ab, 0x20e85, 0x202ab, 0x121c9, 0x01fb9, 0x2e19a, 0x2e1b0, 0x2e19b, 0x2e1b1, 0x2029b, 0x202b1, 0x21ca1, 0x01c7e,
+    0x1e942, 0x2a172, 0x22946, 0x2a173, 0x2ab91, 0x143a6, 0x16198, 0x143a8, 0x1294c, 0x2a175, 0x1694e, 0x2a176, 0x2ab93, 0x143a7, 0x23c65, 0x11c59,
+    0x2ed82, 0x221ac, 0x2ed87, 0x221ad, 0x121ca, 0x121d3, 0x121cb, 0x05f87, 0x2219c, 0x221b2, 0x1f877, 0x1de6c, 0x238a8, 0x21ca5, 0x1fc61, 0x0de3b,
+    0x1aa42, 0x26272, 0x26b91, 0x083a6, 0x1aa46, 0x26273, 0x0a298, 0x083a8, 0x0aa4c, 0x26275, 0x26b93, 0x083a7, 0x26a4e, 0x26276, 0x1bc65, 0x05c59,
+    0x02e82, 0x202ac, 0x062ca, 0x062d3, 0x2ce87, 0x202ad, 0x062cb, 0x11f87, 0x2029c, 0x202b2, 0x218a8, 0x23ca5, 0x1b877, 0x19d6c, 0x1bc61, 0x01d3b,
+    0x0ed92, 0x023d1, 0x28dc1, 0x0e3d2, 0x08ec1, 0x023d2, 0x023d0, 0x03fc1, 0x218a3, 0x218a2, 0x23866, 0x1f862, 0x1b866, 0x1b862, 0x19c52, 0x19c22,
+    0x0ed9c, 0x01bae, 0x0f8a8, 0x01a73, 0x038a8, 0x0d973, 0x0da98, 0x19b46, 0x0189f, 0x01884, 0x1f85a, 0x11a43, 0x0585a, 0x05943, 0x19823, 0x19c0e,
+    0x1eb04, 0x14b30, 0x16b0a, 0x2a134, 0x08b19, 0x08b39, 0x28b1f, 0x28b43, 0x2eb07, 0x28b32, 0x16b0c, 0x16135, 0x24b1b, 0x24b3b, 0x2a320, 0x28b45,
+    0x2e53e, 0x1a968, 0x2e542, 0x2216a, 0x12190, 0x121a4, 0x12191, 0x121a5, 0x2e54a, 0x2216e, 0x2254c, 0x2216f, 0x12192, 0x103a5, 0x12193, 0x15c74,
+    0x1ed0b, 0x2a13a, 0x2290e, 0x2a13b, 0x2e327, 0x16360, 0x16329, 0x16362, 0x2e311, 0x1613c, 0x16312, 0x1613d, 0x2e328, 0x16361, 0x1632a, 0x16363,
+    0x2e53f, 0x2216b, 0x2e543, 0x2216c, 0x12194, 0x121a6, 0x12195, 0x121a7, 0x2e54b, 0x22170, 0x2254d, 0x22171, 0x12196, 0x121a8, 0x12197, 0x0fe59,
+    0x1ab30, 0x2437b, 0x22742, 0x24382, 0x26b39, 0x0837d, 0x2c358, 0x08384, 0x20b32, 0x2437c, 0x22744, 0x24383, 0x26b3b, 0x0837e, 0x2c359, 0x15c71,
+    0x14f68, 0x1c3aa, 0x12772, 0x103ac, 0x1c3a4, 0x1c3b0, 0x1c3a6, 0x103b2, 0x1276e, 0x1c3ab, 0x12775, 0x103ad, 0x1c3a5, 0x1c3b1, 0x1c3a7, 0x0fc6c,
+    0x2e73a, 0x1e385, 0x22746, 0x12387, 0x22360, 0x1e3a0, 0x22364, 0x103a2, 0x2e73c, 0x1e386, 0x22748, 0x12388, 0x22361, 0x1e3a1, 0x22365, 0x15e5f,
+    0x1676b, 0x1e5ab, 0x16573, 0x1e5ad, 0x1e7a6, 0x1c3b3, 0x1c3a9, 0x19f75, 0x12770, 0x1c3af, 0x12777, 0x19e83, 0x1e7a8, 0x1dd9b, 0x17e93, 0x01f44,
+    0x1ef0a, 0x16142, 0x2eb0e, 0x16143, 0x2cb1f, 0x28358, 0x2e323, 0x1635a, 0x2eb0c, 0x16144, 0x2e30f, 0x16145, 0x2e320, 0x28359, 0x2e324, 0x1635b,
+    0x2a542, 0x1e172, 0x2e546, 0x1e173, 0x1e791, 0x103a6, 0x12198, 0x103a8, 0x1254c, 0x1e175, 0x1e54e, 0x1e176, 0x1e793, 0x103a7, 0x2fc65, 0x15c59,
+    0x12f0e, 0x12146, 0x2e313, 0x12147, 0x2e329, 0x12364, 0x2e32b, 0x12366, 0x2e312, 0x12148, 0x2e314, 0x12149, 0x2e32a, 0x12365, 0x2e32c, 0x13c24,
+    0x2a543, 0x22573, 0x2e547, 0x1e174, 0x1e795, 0x121a9, 0x12199, 0x19a93, 0x1254d, 0x1e177, 0x1e54f, 0x13c45, 0x1e797, 0x23893, 0x1fc2a, 0x13c20,
+    0x2e734, 0x26382, 0x22743, 0x1e384, 0x2cb43, 0x26384, 0x2c35a, 0x0839f, 0x2e735, 0x26383, 0x22745, 0x2fc71, 0x2cb45, 0x1bc71, 0x2c35b, 0x01c55,
+    0x1676a, 0x1c3ac, 0x12773, 0x1c3ae, 0x1e7a5, 0x1c3b2, 0x1c3a8, 0x11f9c, 0x1276f, 0x1c3ad, 0x12776, 0x2fc6f, 0x21c74, 0x1bc6c, 0x21c59, 0x01d41,
+    0x2e73b, 0x1e387, 0x22747, 0x1e389, 0x22362, 0x1e3a2, 0x22366, 0x1e3a3, 0x2e73d, 0x1e388, 0x22749, 0x1fc3d, 0x22363, 0x1b85f, 0x23c24, 0x1fc1d,
+    0x1676c, 0x125ad, 0x12774, 0x01a6f, 0x1e7a7, 0x0d975, 0x0da93, 0x01b4c, 0x12771, 0x23883, 0x1fc45, 0x1fc35, 0x1b859, 0x05944, 0x1fc20, 0x1dc0c,
+    0x0cb0a, 0x0eb34, 0x1091b, 0x14b41, 0x02b1f, 0x02b43, 0x14b28, 0x14b4d, 0x0eb1b, 0x0eb3b, 0x14b20, 0x14b45, 0x02b22, 0x02b47, 0x28b2a, 0x29e4f,
+    0x04c42, 0x1a96a, 0x1ad5e, 0x1a96f, 0x10891, 0x108a5, 0x2a1c0, 0x09f89, 0x2e192, 0x2c9a5, 0x2e193, 0x29674, 0x161c1, 0x161cf, 0x15699, 0x03e47,
+    0x1e91f, 0x20957, 0x22922, 0x2e959, 0x16b8c, 0x28995, 0x2898e, 0x25697, 0x12928, 0x2a961, 0x1692a, 0x29e63, 0x16b8e, 0x14399, 0x1618f, 0x29e2a,
+    0x1ad58, 0x20973, 0x20d62, 0x0be76, 0x2a1c6, 0x2a1d2, 0x2a1c7, 0x0bf62, 0x2e196, 0x2e1a8, 0x2e197, 0x25e59, 0x161c8, 0x174c1, 0x17e8e, 0x03e22,
+    0x18e42, 0x08a82, 0x24392, 0x2439c, 0x06a58, 0x08a84, 0x24396, 0x0839d, 0x0aa5e, 0x08a87, 0x24393, 0x29677, 0x0aa62, 0x08a89, 0x24397, 0x15e4d,
+    0x0cc72, 0x1ccac, 0x08dd1, 0x096ae, 0x1eaa6, 0x13fb2, 0x156cc, 0x09f84, 0x2ead1, 0x174d3, 0x156a9, 0x25e73, 0x2b4d2, 0x11da5, 0x29c95, 0x03e43,
+    0x0cf91, 0x143ca, 0x283c1, 0x256a8, 0x283c6, 0x143cc, 0x283c8, 0x25696, 0x283c0, 0x143cb, 0x17499, 0x29e61, 0x283c7, 0x2b4c0, 0x29c8e, 0x15e28,
+    0x02da6, 0x04cd3, 0x296d2, 0x0be73, 0x101da, 0x1ffa6, 0x296c6, 0x07f58, 0x134cc, 0x174ca, 0x2be95, 0x25e57, 0x2b4c6, 0x11d91, 0x15c8c, 0x03e1f,
+    0x1cf34, 0x28b6a, 0x1293b, 0x2a96c, 0x24b57, 0x24b73, 0x28b61, 0x28377, 0x12941, 0x28b6c, 0x16945, 0x2a16d, 0x24b59, 0x28374, 0x2bc63, 0x15e45,
+    0x22d82, 0x2e1ac, 0x22d87, 0x2e1ad, 0x161ca, 0x161d3, 0x161cb, 0x09f87, 0x2e19c, 0x2e1b2, 0x2b477, 0x29e6c, 0x2f4a8, 0x2dca5, 0x2bc61, 0x0fe3b,
+    0x1e943, 0x2e973, 0x22947, 0x2a174, 0x2ab95, 0x161a9, 0x16199, 0x25693, 0x1294d, 0x2a177, 0x17c4f, 0x17c45, 0x2f497, 0x2f493, 0x17c2a, 0x17c20,
+    0x2ed84, 0x2e1ae, 0x2ed89, 0x0be6f, 0x121cc, 0x2ffd1, 0x296c0, 0x0bf5e, 0x2e19d, 0x2f49c, 0x13c4d, 0x13c41, 0x2f496, 0x2f492, 0x13c28, 0x0fe1b,
+    0x04f6a, 0x243ac, 0x26ba5, 0x243b2, 0x0ab73, 0x083ae, 0x243a8, 0x2569c, 0x0ab6f, 0x243ad, 0x2b474, 0x2bc6c, 0x21c76, 0x1bc6f, 0x2fc59, 0x15e41,
+    0x0edac, 0x2d0d9, 0x156d3, 0x256ac, 0x18ed3, 0x13fac, 0x156ca, 0x09f82, 0x2f4ae, 0x2f4ac, 0x2fc73, 0x2bc6a, 0x21c73, 0x1bc6a, 0x21c57, 0x01d34,
+    0x0cfa5, 0x143d3, 0x283cf, 0x27ea5, 0x283d2, 0x098d1, 0x296c1, 0x25692, 0x2f889, 0x23887, 0x23c47, 0x13c3b, 0x21862, 0x1b85e, 0x23c22, 0x11c1b,
+    0x0edb2, 0x01bac, 0x0daa5, 0x07e6a, 0x038a6, 0x11b72, 0x0da91, 0x19b42, 0x2f884, 0x23882, 0x1fc43, 0x13c34, 0x1b858, 0x05942, 0x1fc1f, 0x11c0a,
+    0x06b04, 0x02b30, 0x16b19, 0x28b39, 0x06a0a, 0x26234, 0x24b1f, 0x24b43, 0x26b07, 0x08b32, 0x2ab1b, 0x28b3b, 0x26b0c, 0x26235, 0x26320, 0x24b45,
+    0x2663e, 0x22a68, 0x06290, 0x043a4, 0x2c642, 0x2026a, 0x06291, 0x062a5, 0x2664a, 0x1a26e, 0x06292, 0x043a5, 0x1a64c, 0x1a26f, 0x06293, 0x09c74,
+    0x22b30, 0x2a37b, 0x16b39, 0x1637d, 0x20742, 0x06382, 0x2e358, 0x28384, 0x2eb32, 0x2a37c, 0x2ab3b, 0x1637e, 0x20744, 0x06383, 0x2e359, 0x03c71,
+    0x02f68, 0x043aa, 0x183a4, 0x043b0, 0x0a672, 0x043ac, 0x183a6, 0x043b2, 0x0a76e, 0x043ab, 0x183a5, 0x043b1, 0x06775, 0x043ad, 0x183a7, 0x03c6c,
+    0x06e0b, 0x2623a, 0x26327, 0x0a360, 0x1aa0e, 0x2623b, 0x26329, 0x0a362, 0x26311, 0x2623c, 0x26328, 0x0a361, 0x26312, 0x2623d, 0x2632a, 0x0a363,
+    0x2663f, 0x2026b, 0x06294, 0x062a6, 0x2c643, 0x2026c, 0x06295, 0x062a7, 0x2664b, 0x1a270, 0x06296, 0x062a8, 0x1a64d, 0x1a271, 0x06297, 0x03d59,
+    0x2c73a, 0x06385, 0x20360, 0x063a0, 0x1a746, 0x06387, 0x1a364, 0x063a2, 0x2073c, 0x06386, 0x20361, 0x063a1, 0x1a748, 0x06388, 0x1a365, 0x03d5f,
+    0x0a76b, 0x066ab, 0x1a7a6, 0x043b3, 0x0a673, 0x1a6ad, 0x183a9, 0x1df75, 0x0a770, 0x043af, 0x1a7a8, 0x05e9b, 0x06777, 0x0bd83, 0x0bd93, 0x0df44,
+    0x1af0a, 0x0a242, 0x2eb1f, 0x24358, 0x26b0e, 0x0a243, 0x26323, 0x2435a, 0x20b0c, 0x0a244, 0x2c320, 0x24359, 0x2630f, 0x0a245, 0x26324, 0x2435b,
+    0x26642, 0x1a272, 0x1a791, 0x043a6, 0x26646, 0x1a273, 0x06298, 0x043a8, 0x0a64c, 0x1a275, 0x1a793, 0x043a7, 0x0664e, 0x1a276, 0x27c65, 0x09c59,
+    0x2c734, 0x1a382, 0x2eb43, 0x16384, 0x20743, 0x06384, 0x2035a, 0x0639f, 0x20735, 0x1a383, 0x2eb45, 0x23c71, 0x20745, 0x27c71, 0x2035b, 0x03c55,
+    0x0a76a, 0x183ac, 0x1a7a5, 0x183b2, 0x06773, 0x043ae, 0x183a8, 0x05f9c, 0x0a76f, 0x183ad, 0x23c74, 0x1fc6c, 0x06776, 0x27c6f, 0x23c59, 0x11e41,
+    0x0af0e, 0x0a246, 0x20329, 0x0a364, 0x26313, 0x0a247, 0x2632b, 0x0a366, 0x20312, 0x0a248, 0x2032a, 0x0a365, 0x26314, 0x0a249, 0x2632c, 0x0bc24,
+    0x26643, 0x20673, 0x1a795, 0x043a9, 0x26647, 0x1a274, 0x06299, 0x1d993, 0x0a64d, 0x1a277, 0x1a797, 0x21893, 0x0664f, 0x07c45, 0x07c2a, 0x07c20,
+    0x2c73b, 0x1a387, 0x20362, 0x183a2, 0x1a747, 0x06389, 0x1a366, 0x063a3, 0x2073d, 0x1a388, 0x20363, 0x2385f, 0x1a749, 0x07c3d, 0x1bc24, 0x07c1d,
+    0x0a76c, 0x066ad, 0x1a7a7, 0x01a75, 0x0a674, 0x1196f, 0x01993, 0x11b4c, 0x0a771, 0x01883, 0x1f859, 0x11a44, 0x1bc45, 0x07c35, 0x1bc20, 0x05c0c,
+    0x04a0a, 0x02b34, 0x0eb1f, 0x0eb43, 0x06a1b, 0x02b41, 0x02b28, 0x02b4d, 0x00b1b, 0x02b3b, 0x14b22, 0x14b47, 0x0aa20, 0x08b45, 0x08b2a, 0x09d4f,
+    0x10c42, 0x1ea6a, 0x04891, 0x048a5, 0x22e5e, 0x22a6f, 0x262c0, 0x29f89, 0x2c292, 0x2eaa5, 0x262c1, 0x262cf, 0x2c293, 0x25574, 0x09599, 0x15d47,
+    0x1cd42, 0x04982, 0x12958, 0x28984, 0x28392, 0x2839c, 0x28396, 0x2839d, 0x1295e, 0x14987, 0x16962, 0x28989, 0x28393, 0x25577, 0x28397, 0x03d4d,
+    0x00c72, 0x18cac, 0x1a9a6, 0x07fb2, 0x28ed1, 0x295ae, 0x035cc, 0x29f84, 0x209d1, 0x0b4d3, 0x274d2, 0x05ea5, 0x095a9, 0x29d73, 0x25c95, 0x0fd43,
+    0x1aa1f, 0x2ca57, 0x08a8c, 0x24a95, 0x1aa22, 0x2ca59, 0x08a8e, 0x29597, 0x0aa28, 0x26a61, 0x26b8e, 0x08399, 0x26a2a, 0x25d63, 0x0838f, 0x09d2a,
+    0x1ee58, 0x22a73, 0x262c6, 0x262d2, 0x22e62, 0x17d76, 0x262c7, 0x17f62, 0x2c296, 0x2c2a8, 0x262c8, 0x274c1, 0x2c297, 0x29d59, 0x27d8e, 0x15d22,
+    0x00f91, 0x083ca, 0x243c6, 0x023cc, 0x083c1, 0x295a8, 0x083c8, 0x29596, 0x243c0, 0x083cb, 0x243c7, 0x274c0, 0x0b499, 0x25d61, 0x09c8e, 0x03d28,
+    0x0eea6, 0x10cd3, 0x003da, 0x1bfa6, 0x255d2, 0x17d73, 0x255c6, 0x13f58, 0x0b4cc, 0x0b4ca, 0x274c6, 0x05e91, 0x27d95, 0x17d57, 0x09c8c, 0x0fd1f,
+    0x18f34, 0x26a6a, 0x16b57, 0x28b73, 0x06a3b, 0x26a6c, 0x24b61, 0x24377, 0x0aa41, 0x24b6c, 0x28b59, 0x24374, 0x0aa45, 0x2436d, 0x27c63, 0x09d45,
+    0x00e82, 0x2c2ac, 0x0a2ca, 0x0a2d3, 0x20e87, 0x2c2ad, 0x0a2cb, 0x15f87, 0x2c29c, 0x2c2b2, 0x2d4a8, 0x2fca5, 0x27477, 0x25d6c, 0x27c61, 0x03d3b,
+    0x10f6a, 0x283ac, 0x16b73, 0x283ae, 0x2aba5, 0x283b2, 0x283a8, 0x2959c, 0x12b6f, 0x283ad, 0x23c76, 0x23c6f, 0x27474, 0x27c6c, 0x2dc59, 0x03d41,
+    0x0cdac, 0x210d9, 0x1cdd3, 0x07fac, 0x095d3, 0x295ac, 0x095ca, 0x05f82, 0x214ae, 0x2d4ac, 0x23c73, 0x1fc6a, 0x2dc73, 0x27c6a, 0x2dc57, 0x03d34,
+    0x1aa43, 0x2ca73, 0x26b95, 0x083a9, 0x1aa47, 0x26274, 0x0a299, 0x29593, 0x0aa4d, 0x26277, 0x2d497, 0x2d493, 0x27c4f, 0x0bc45, 0x27c2a, 0x0bc20,
+    0x20e84, 0x202ae, 0x0a2cc, 0x21fd1, 0x20e89, 0x13d6f, 0x255c0, 0x13f5e, 0x2029d, 0x2d49c, 0x2d496, 0x2d492, 0x0bc4d, 0x0bc41, 0x0bc28, 0x01d1b,
+    0x00fa5, 0x083d3, 0x243d2, 0x298d1, 0x083cf, 0x2bda5, 0x095c1, 0x29592, 0x21889, 0x21887, 0x23862, 0x2385e, 0x1bc47, 0x07c3b, 0x1bc22, 0x07c1b,
+    0x02eb2, 0x0dbac, 0x0f8a6, 0x01a72, 0x019a5, 0x13d6a, 0x01991, 0x1db42, 0x21884, 0x01882, 0x1f858, 0x11a42, 0x1bc43, 0x07c34, 0x1bc1f, 0x05c0a,
+    0x00b07, 0x02b32, 0x16b1b, 0x14b3b, 0x08b1b, 0x08b3b, 0x24b22, 0x24b47, 0x00b17, 0x02b37, 0x16b1d, 0x28b3d, 0x08b1d, 0x08b3d, 0x24b24, 0x25c49,
+    0x00c4a, 0x1886e, 0x18d92, 0x069a5, 0x1ce92, 0x12aa5, 0x008c1, 0x003cf, 0x014ce, 0x034ba, 0x174a3, 0x29489, 0x094a3, 0x09489, 0x25466, 0x25c47,
+    0x1eb32, 0x1697c, 0x16b3b, 0x1697e, 0x2e35e, 0x28387, 0x2a362, 0x28389, 0x2eb37, 0x2a380, 0x16b3d, 0x16381, 0x2e35f, 0x28388, 0x2a363, 0x29c3d,
+    0x00d6e, 0x069ab, 0x1a9a5, 0x07eb1, 0x1c3d1, 0x0c3d3, 0x103d2, 0x07ea5, 0x2f4ba, 0x174b9, 0x17489, 0x17e7e, 0x254a2, 0x25487, 0x29462, 0x15c3b,
+    0x06b32, 0x08a7c, 0x2635e, 0x24387, 0x0ab3b, 0x08a7e, 0x26362, 0x08389, 0x26b37, 0x24380, 0x2635f, 0x24388, 0x26b3d, 0x08381, 0x26363, 0x09c3d,
+    0x10e6e, 0x1eaab, 0x043d1, 0x003d3, 0x1eaa5, 0x1fdb1, 0x043d2, 0x13da5, 0x274ba, 0x094b9, 0x2b4a2, 0x29487, 0x27489, 0x09d7e, 0x25462, 0x09c3b,
+    0x20f7c, 0x243b7, 0x2e387, 0x163b9, 0x2c387, 0x083b9, 0x2c3a2, 0x023ba, 0x2c380, 0x243b8, 0x2e388, 0x2b480, 0x2c388, 0x25480, 0x2545f, 0x03c37,
+    0x02fab, 0x003d4, 0x1c3d3, 0x07eab, 0x183d3, 0x1fdab, 0x014d1, 0x19f6e, 0x214b9, 0x254b7, 0x2b487, 0x17e7c, 0x27487, 0x09d7c, 0x2545e, 0x03c32,
+    0x20b1b, 0x2435e, 0x2eb22, 0x28362, 0x26b22, 0x24362, 0x24b52, 0x24366, 0x20b1d, 0x2435f, 0x2eb24, 0x28363, 0x26b24, 0x24363, 0x24353, 0x25c24,
+    0x0cd92, 0x003d1, 0x1cdc1, 0x0c3d2, 0x04ec1, 0x003d2, 0x003d0, 0x01fc1, 0x214a3, 0x2d4a2, 0x2f466, 0x2b462, 0x27466, 0x27462, 0x25c52, 0x25c22,
+    0x22b3b, 0x2a387, 0x2eb47, 0x16389, 0x2e362, 0x2a3a2, 0x2e366, 0x163a3, 0x2eb3d, 0x2a388, 0x2fc49, 0x17c3d, 0x2e363, 0x2745f, 0x2fc24, 0x17c1d,
+    0x0efa5, 0x103d3, 0x1c3cf, 0x1bea5, 0x1c3d2, 0x054d1, 0x1dac1, 0x05f92, 0x2f489, 0x2f487, 0x2fc47, 0x17c3b, 0x2d462, 0x2745e, 0x2fc22, 0x17c1b,
+    0x20b3b, 0x26387, 0x2c362, 0x243a2, 0x26b47, 0x26389, 0x26366, 0x083a3, 0x20b3d, 0x26388, 0x2c363, 0x2f45f, 0x27c49, 0x27c3d, 0x27c24, 0x09c1d,
+    0x02fa5, 0x043d3, 0x183d2, 0x1d4d1, 0x043cf, 0x1fda5, 0x059c1, 0x11f92, 0x21489, 0x2d487, 0x2f462, 0x2f45e, 0x27c47, 0x0bc3b, 0x27c22, 0x09c1b,
+    0x20f7e, 0x203b9, 0x2e389, 0x2e3ba, 0x20389, 0x263ba, 0x203a3, 0x003ce, 0x20381, 0x2d480, 0x2fc3d, 0x2fc37, 0x21c3d, 0x27c37, 0x21c1d, 0x01c17,
+    0x02fb1, 0x038ab, 0x0f8a5, 0x01a6e, 0x038a5, 0x1196e, 0x0da92, 0x01b4a, 0x2187e, 0x2187c, 0x23c3b, 0x1fc32, 0x21c3b, 0x07c32, 0x21c1b, 0x01c07,
+    0x00b0c, 0x02b35, 0x0eb20, 0x0eb45, 0x00a20, 0x02b45, 0x02b2a, 0x0374f, 0x00b1d, 0x02b3d, 0x14b24, 0x15649, 0x02b24, 0x03549, 0x0342c, 0x03414,
+    0x18c4c, 0x1886f, 0x04893, 0x03674, 0x10893, 0x15774, 0x0f699, 0x25747, 0x014a3, 0x03489, 0x15466, 0x15647, 0x03466, 0x03547, 0x0342b, 0x03413,
+    0x1cd44, 0x04983, 0x12959, 0x03671, 0x14993, 0x0f577, 0x0f697, 0x0374d, 0x1295f, 0x0f488, 0x15463, 0x2963d, 0x03465, 0x03548, 0x2942a, 0x29412,
+    0x04d75, 0x037ad, 0x0f6a7, 0x0966c, 0x035a9, 0x15773, 0x0f695, 0x25743, 0x0f4a2, 0x0f487, 0x15462, 0x2963b, 0x03464, 0x03546, 0x29429, 0x03e0e,
+    0x18e44, 0x08a83, 0x08a93, 0x03677, 0x06a59, 0x15571, 0x03597, 0x1574d, 0x0aa5f, 0x03488, 0x15465, 0x15648, 0x09463, 0x0953d, 0x0942a, 0x09412,
+    0x10e75, 0x0f7ad, 0x0f6a9, 0x09773, 0x035a7, 0x1556c, 0x03595, 0x29743, 0x014a2, 0x03487, 0x15464, 0x15646, 0x09462, 0x2553b, 0x09429, 0x15d0e,
+    0x00f9b, 0x037af, 0x0f6a8, 0x03670, 0x035a8, 0x15570, 0x0f696, 0x0374b, 0x014a1, 0x03486, 0x15461, 0x2963c, 0x09461, 0x0953c, 0x25428, 0x25411,
+    0x014b3, 0x037ab, 0x0f6a6, 0x0966b, 0x035a6, 0x1556b, 0x0f694, 0x2573f, 0x014a0, 0x03485, 0x15460, 0x2963a, 0x09460, 0x2553a, 0x25427, 0x03f0b,
+    0x18f41, 0x24b6f, 0x16b59, 0x03676, 0x0ab59, 0x0f576, 0x24b65, 0x0374e, 0x24b55, 0x24b71, 0x2b45b, 0x15645, 0x0945b, 0x09545, 0x25424, 0x2540f,
+    0x0cd9c, 0x037ae, 0x0d4a8, 0x03673, 0x014a8, 0x0f573, 0x0f698, 0x25746, 0x0149f, 0x03484, 0x2b45a, 0x15643, 0x0945a, 0x09543, 0x25423, 0x25c0e,
+    0x12b6c, 0x0d4ad, 0x16b74, 0x0366f, 0x014a7, 0x0f575, 0x0f693, 0x0374c, 0x12b71, 0x2f483, 0x2bc45, 0x29635, 0x27459, 0x09544, 0x29420, 0x29c0c,
+    0x0d4b2, 0x037ac, 0x0f6a5, 0x0966a, 0x014a6, 0x15772, 0x0f691, 0x25742, 0x2f484, 0x2f482, 0x2bc43, 0x29634, 0x27458, 0x09542, 0x2bc1f, 0x15c0a,
+    0x06b6c, 0x014ad, 0x0d4a7, 0x03675, 0x06a74, 0x1556f, 0x03593, 0x1574c, 0x0ab71, 0x03483, 0x2b459, 0x15644, 0x27c45, 0x09535, 0x25420, 0x09c0c,
+    0x014b2, 0x0f7ac, 0x0d4a6, 0x03672, 0x035a5, 0x1556a, 0x03591, 0x29742, 0x21484, 0x03482, 0x2b458, 0x15642, 0x27c43, 0x25534, 0x27c1f, 0x09c0a,
+    0x014b1, 0x014ab, 0x0d4a5, 0x0366e, 0x014a5, 0x1556e, 0x0f692, 0x0374a, 0x2147e, 0x2d47c, 0x2fc3b, 0x17c32, 0x2dc3b, 0x27c32, 0x2dc1b, 0x03c07,
+    0x014b0, 0x037aa, 0x0f6a4, 0x0be68, 0x035a4, 0x13d68, 0x0f690, 0x2573e, 0x2147d, 0x2d47b, 0x2fc39, 0x13c30, 0x21c39, 0x0bc30, 0x21c19, 0x01c04,
+    0x00d03, 0x2442f, 0x20d18, 0x20d38, 0x20e18, 0x2ee38, 0x0068a, 0x0c690, 0x2472f, 0x00679, 0x2ed38, 0x2057b, 0x20e38, 0x2067b, 0x00690, 0x0069a,
+    0x02c09, 0x24430, 0x2451e, 0x26d42, 0x2861e, 0x2ae42, 0x0248b, 0x0c692, 0x02738, 0x0e67b, 0x2a556, 0x00582, 0x08656, 0x22682, 0x00694, 0x0c69c,
+    0x02d06, 0x08431, 0x2cd1a, 0x2cd3a, 0x02625, 0x1465c, 0x0058b, 0x00591, 0x28731, 0x0057a, 0x2ed3a, 0x2057c, 0x0265c, 0x00685, 0x0c591, 0x0059b,
+    0x08d0b, 0x08432, 0x2451f, 0x26d44, 0x14627, 0x1465e, 0x0058c, 0x00593, 0x0e73a, 0x0057c, 0x2a557, 0x00583, 0x02660, 0x0c687, 0x0c595, 0x05f77,
+    0x02e06, 0x28431, 0x02525, 0x0255c, 0x2ce1a, 0x2ee3a, 0x0068b, 0x0c691, 0x08731, 0x0067a, 0x1455c, 0x00585, 0x2ce3a, 0x2067c, 0x00691, 0x0069b,
+    0x28e0b, 0x28432, 0x02527, 0x0255e, 0x2861f, 0x2ae44, 0x0c68c, 0x0c693, 0x0273a, 0x0e67c, 0x0e560, 0x00587, 0x08657, 0x22683, 0x00695, 0x11f77,
+    0x02610, 0x02436, 0x02526, 0x0255d, 0x02626, 0x1465d, 0x0278d, 0x0c698, 0x02736, 0x0067f, 0x1455d, 0x00586, 0x0265d, 0x00686, 0x00698, 0x0069e,
+    0x14611, 0x02437, 0x02528, 0x0255f, 0x14628, 0x1465f, 0x0248e, 0x19b65, 0x0273c, 0x0e680, 0x0e561, 0x00588, 0x02661, 0x0c688, 0x00699, 0x19f48,
+    0x02f09, 0x02438, 0x2851e, 0x08556, 0x2461e, 0x2a656, 0x0278b, 0x0c694, 0x24730, 0x0067b, 0x2ad42, 0x22582, 0x26e42, 0x00682, 0x00692, 0x0069c,
+    0x2460d, 0x02439, 0x24521, 0x08558, 0x24621, 0x14658, 0x0068d, 0x0c696, 0x02739, 0x0067d, 0x14558, 0x00584, 0x08658, 0x00684, 0x00696, 0x0069d,
+    0x28d0b, 0x0243a, 0x2851f, 0x08557, 0x02627, 0x0e660, 0x0e78c, 0x00595, 0x28732, 0x0e57c, 0x2ad44, 0x22583, 0x0265e, 0x00687, 0x0c593, 0x11c77,
+    0x2450e, 0x0243b, 0x24522, 0x08559, 0x02629, 0x0e662, 0x0058e, 0x00597, 0x0e73b, 0x0057e, 0x14559, 0x19a71, 0x02662, 0x00689, 0x0c597, 0x19e4d,
+    0x08e0b, 0x0e43a, 0x14527, 0x02560, 0x2461f, 0x2a657, 0x0068c, 0x0c695, 0x08732, 0x0067c, 0x1455e, 0x0c587, 0x26e44, 0x00683, 0x00693, 0x05c77,
+    0x2460e, 0x0e43b, 0x02529, 0x02562, 0x24622, 0x14659, 0x0068e, 0x0c697, 0x0273b, 0x0067e, 0x0e562, 0x00589, 0x08659, 0x19971, 0x00697, 0x19d4d,
+    0x02611, 0x0243c, 0x14528, 0x02561, 0x02628, 0x0e661, 0x0278e, 0x0c699, 0x02737, 0x00680, 0x1455f, 0x0c588, 0x0265f, 0x00688, 0x19865, 0x19c48,
+    0x02612, 0x0243d, 0x0252a, 0x02563, 0x0262a, 0x0e663, 0x0068f, 0x01b2a, 0x0273d, 0x00681, 0x0e563, 0x01a3d, 0x02663, 0x0193d, 0x0182a, 0x01b12,
+    0x00c09, 0x18830, 0x1ad1e, 0x1ad42, 0x1ee1e, 0x1ee42, 0x0088b, 0x0ea92, 0x00b38, 0x0ea7b, 0x1e956, 0x02982, 0x04a56, 0x2ea82, 0x02a94, 0x0ea9c,
+    0x00c19, 0x0ad40, 0x0ad27, 0x0ad4c, 0x12e27, 0x12e4c, 0x244bc, 0x21fa3, 0x2e690, 0x2e69a, 0x2c594, 0x2059c, 0x2e694, 0x2269c, 0x201d6, 0x01f9f,
+    0x06d1a, 0x06d3a, 0x1ad21, 0x1ad46, 0x16c8b, 0x2ac91, 0x084bd, 0x089c1, 0x2295c, 0x20985, 0x22960, 0x2c987, 0x166c4, 0x126ca, 0x289c6, 0x03fa8,
+    0x08c1f, 0x0ad44, 0x26d29, 0x26d4e, 0x2848c, 0x2ac93, 0x084be, 0x1bf66, 0x2c591, 0x2059b, 0x2c595, 0x1bf77, 0x166c6, 0x23fa8, 0x201d7, 0x05f5a,
+    0x10e1a, 0x12e3a, 0x26c8b, 0x26c91, 0x22e21, 0x22e46, 0x284bd, 0x28ac1, 0x1aa5c, 0x2ea85, 0x265c4, 0x065ca, 0x20a60, 0x2ea87, 0x24ac6, 0x0ffa8,
+    0x14c1f, 0x16e44, 0x2448c, 0x26c93, 0x16e29, 0x16e4e, 0x284be, 0x23f66, 0x2e691, 0x2e69b, 0x0a5c6, 0x21fa8, 0x2e695, 0x1ff77, 0x222d7, 0x1ff5a,
+    0x02c26, 0x24c5d, 0x0848d, 0x0a598, 0x2848d, 0x16698, 0x024c2, 0x024d0, 0x166bf, 0x126c9, 0x265c5, 0x065cb, 0x166c5, 0x126cb, 0x004d8, 0x0dd98,
+    0x24c28, 0x24c5f, 0x0848e, 0x1bb65, 0x2848e, 0x23b65, 0x024c3, 0x19b52, 0x166c0, 0x21ba1, 0x0a5c7, 0x1bb61, 0x166c7, 0x1fb61, 0x03bbe, 0x19f23,
+    0x02c33, 0x24c68, 0x2cd56, 0x26572, 0x20e56, 0x2a672, 0x024c4, 0x024d1, 0x18f68, 0x2e6aa, 0x22d72, 0x205ac, 0x20e72, 0x226ac, 0x00bd1, 0x01cae,
+    0x02c39, 0x24469, 0x26d60, 0x26575, 0x2ae60, 0x2a675, 0x024c5, 0x21fa2, 0x2e6a4, 0x2e6b0, 0x2c5a6, 0x205b2, 0x2e6a6, 0x226b2, 0x19ccc, 0x01f84,
+    0x02c3f, 0x2446b, 0x2cd58, 0x26573, 0x14494, 0x144a6, 0x024c6, 0x024d2, 0x22d6e, 0x205ab, 0x22d75, 0x205ad, 0x166d1, 0x126d3, 0x1dca9, 0x0de73,
+    0x08c43, 0x2446c, 0x26d62, 0x26576, 0x14495, 0x144a7, 0x024c7, 0x1bf62, 0x2c5a5, 0x205b1, 0x2c5a7, 0x19a6c, 0x166d2, 0x21ba5, 0x11a95, 0x05e43,
+    0x14c3f, 0x2846b, 0x08494, 0x084a6, 0x2ee58, 0x2a673, 0x0e4c6, 0x0e4d2, 0x1ae6e, 0x2e6ab, 0x265d1, 0x065d3, 0x20e75, 0x226ad, 0x19ca9, 0x01d73,
+    0x14c43, 0x2846c, 0x08495, 0x084a7, 0x2ae62, 0x2a676, 0x0e4c7, 0x1ff62, 0x2e6a5, 0x2e6b1, 0x0a5d2, 0x23ba5, 0x2e6a7, 0x1d96c, 0x05995, 0x11d43,
+    0x02c4b, 0x24470, 0x08496, 0x084a8, 0x14496, 0x144a8, 0x024c8, 0x038c1, 0x038ba, 0x018b9, 0x118a2, 0x11887, 0x078a2, 0x05887, 0x19864, 0x19c46,
+    0x24c4d, 0x24471, 0x08497, 0x05b59, 0x14497, 0x11b59, 0x03b8e, 0x19b22, 0x03889, 0x01b7e, 0x0d862, 0x01a3b, 0x01862, 0x0d93b, 0x01829, 0x19b0e,
+    0x00d06, 0x06d31, 0x20d1a, 0x20d3a, 0x00a25, 0x10a5c, 0x0298b, 0x02991, 0x1ed31, 0x0097a, 0x22d3a, 0x2c97c, 0x00a5c, 0x02a85, 0x0e991, 0x0299b,
+    0x08d1a, 0x0ad3a, 0x26d21, 0x26d46, 0x1ec8b, 0x1ec91, 0x045bd, 0x045c1, 0x2e55c, 0x20585, 0x2e560, 0x20587, 0x1c5c4, 0x185ca, 0x1c5c6, 0x01fa8,
+    0x00d16, 0x26d36, 0x20d1c, 0x20d3c, 0x005bb, 0x045bf, 0x185bc, 0x185c0, 0x2ed36, 0x2057f, 0x2ed3c, 0x20580, 0x1c5bf, 0x185c9, 0x1c5c0, 0x01ea1,
+    0x08d1c, 0x26d3c, 0x26d23, 0x26d48, 0x005bc, 0x045c0, 0x045be, 0x07e99, 0x2e55d, 0x20586, 0x2e561, 0x20588, 0x1c5c5, 0x185cb, 0x1c5c7, 0x05e61,
+    0x02d31, 0x08c7a, 0x2455c, 0x26585, 0x18a5c, 0x1ea85, 0x005c4, 0x045ca, 0x06f7a, 0x005b5, 0x16585, 0x185b7, 0x06a85, 0x24ab7, 0x105ca, 0x01daf,
+    0x08d3a, 0x24c7c, 0x24560, 0x0a587, 0x12c91, 0x1ec9b, 0x005c6, 0x1dfa8, 0x28585, 0x005b7, 0x165a0, 0x065b9, 0x0c5ca, 0x1ddaf, 0x105cc, 0x11f70,
+    0x02d36, 0x0857f, 0x2455d, 0x26586, 0x005bf, 0x005c9, 0x005c5, 0x045cb, 0x1657f, 0x005b6, 0x16586, 0x185b8, 0x105c9, 0x005cd, 0x105cb, 0x01e86,
+    0x08d3c, 0x08580, 0x24561, 0x0a588, 0x005c0, 0x1fba1, 0x005c7, 0x19b61, 0x28586, 0x005b8, 0x165a1, 0x19e80, 0x0c5cb, 0x1db86, 0x1fec0, 0x05f3c,
+    0x16d1a, 0x2655c, 0x2ed21, 0x2c560, 0x06f8b, 0x045c4, 0x1c5bd, 0x185c6, 0x16d3a, 0x2e585, 0x2ed46, 0x22587, 0x1af91, 0x1c5ca, 0x1c5c1, 0x0dca8,
+    0x24d21, 0x26560, 0x24551, 0x26564, 0x005bd, 0x045c6, 0x005c2, 0x045c8, 0x2a560, 0x205a0, 0x2e564, 0x205a2, 0x105c6, 0x185cc, 0x1c5c8, 0x0dc96,
+    0x16d1c, 0x2655d, 0x2ed23, 0x2c561, 0x105bc, 0x045c5, 0x1c5be, 0x185c7, 0x16d3c, 0x2e586, 0x2ed48, 0x22588, 0x105c0, 0x1c5cb, 0x13e99, 0x11e61,
+    0x24d23, 0x26561, 0x24552, 0x26565, 0x005be, 0x045c7, 0x005c3, 0x05a8e, 0x2a561, 0x205a1, 0x2e565, 0x19e5f, 0x105c7, 0x07bc0, 0x1da8e, 0x19e28,
+    0x14d3a, 0x08585, 0x28560, 0x085a0, 0x06f91, 0x005ca, 0x0c5c6, 0x005cc, 0x2af7c, 0x105b7, 0x16587, 0x1e5b9, 0x06f9b, 0x05daf, 0x19ca8, 0x01c70,
+    0x24d46, 0x08587, 0x24564, 0x085a2, 0x005c1, 0x119a8, 0x005c8, 0x1df96, 0x14587, 0x005b9, 0x165a2, 0x005ba, 0x059a8, 0x19970, 0x19c96, 0x01d4b,
+    0x28d3c, 0x08586, 0x28561, 0x085a1, 0x0c5c0, 0x005cb, 0x0c5c7, 0x1bec0, 0x16580, 0x105b8, 0x16588, 0x1fe80, 0x078a1, 0x05886, 0x1d861, 0x1dc3c,
+    0x24d48, 0x08588, 0x24565, 0x01b5f, 0x0fb99, 0x0db61, 0x01a8e, 0x01b28, 0x14588, 0x01b80, 0x1185f, 0x01a37, 0x01861, 0x0193c, 0x11828, 0x19e11,
+    0x04d0b, 0x04832, 0x1891f, 0x1ad44, 0x10a27, 0x10a5e, 0x0298c, 0x02993, 0x0cb3a, 0x0097c, 0x1e957, 0x02983, 0x00a60, 0x0ea87, 0x0e995, 0x09f77,
+    0x04c1f, 0x06d44, 0x06d29, 0x06d4e, 0x1ec8c, 0x1ec93, 0x048be, 0x27f66, 0x20991, 0x2099b, 0x20995, 0x27f77, 0x12ac6, 0x2ffa8, 0x2c1d7, 0x09f5a,
+    0x06d1c, 0x06d3c, 0x1ad23, 0x1ad48, 0x22cbc, 0x22cc0, 0x089be, 0x27799, 0x2295d, 0x20986, 0x22961, 0x27e88, 0x289c5, 0x277cb, 0x2bec7, 0x09e61,
+    0x0ad23, 0x0ad48, 0x26d2b, 0x26d50, 0x2ecbe, 0x2d799, 0x201d5, 0x27f2b, 0x2c598, 0x2179e, 0x2c599, 0x0bf48, 0x201d8, 0x2d798, 0x2febe, 0x0bf23,
+    0x10e3a, 0x1ec7c, 0x0ac91, 0x26c9b, 0x1ca60, 0x12a87, 0x0eac6, 0x25fa8, 0x04a85, 0x10ab7, 0x2c5ca, 0x277af, 0x06aa0, 0x16ab9, 0x02acc, 0x03f70,
+    0x02c57, 0x26c83, 0x0ac95, 0x2df77, 0x12c95, 0x23f77, 0x1b7d7, 0x2df5a, 0x265ca, 0x217af, 0x265cc, 0x27f70, 0x22acc, 0x23f70, 0x077d6, 0x03f54,
+    0x02c5d, 0x26c86, 0x26598, 0x2779e, 0x16cc5, 0x2d7cb, 0x276d8, 0x27798, 0x265c9, 0x277cd, 0x2c5cb, 0x27e86, 0x077db, 0x277c9, 0x17ec5, 0x03e5d,
+    0x08c61, 0x26c88, 0x26599, 0x1bf48, 0x2acc7, 0x23b61, 0x09bbe, 0x1bf23, 0x265cb, 0x21b86, 0x23ec0, 0x07f3c, 0x29bc5, 0x23b5d, 0x23ebc, 0x07f1c,
+    0x10f3f, 0x26d6e, 0x22d58, 0x2cd75, 0x18e94, 0x06ad1, 0x0cbc6, 0x277a9, 0x1ed6b, 0x2e9ab, 0x1e973, 0x25ead, 0x04ba6, 0x277d3, 0x11cd2, 0x03e73,
+    0x08d58, 0x26d75, 0x26d64, 0x27778, 0x10ec6, 0x2d7a9, 0x077d8, 0x27f64, 0x2eda6, 0x217b3, 0x2c5a9, 0x27f75, 0x201da, 0x2ffa6, 0x11cc6, 0x09f58,
+    0x02d54, 0x26d70, 0x2cd5a, 0x2cd77, 0x065d6, 0x277cc, 0x276d7, 0x0be95, 0x22d70, 0x205af, 0x22d77, 0x27e83, 0x238cc, 0x277ca, 0x13e95, 0x03e57,
+    0x08d5a, 0x26d77, 0x26d66, 0x07f4e, 0x2d3d7, 0x21b95, 0x05abe, 0x07f29, 0x2eda8, 0x21b9b, 0x1fe93, 0x07f44, 0x138c6, 0x21b91, 0x1fe8c, 0x05e1f,
+    0x02d6b, 0x08cab, 0x24da6, 0x277b3, 0x18ea6, 0x2d7d3, 0x0b6da, 0x25fa6, 0x04fab, 0x277d4, 0x2c5d3, 0x09eab, 0x06ab3, 0x05dab, 0x19ca6, 0x01c6b,
+    0x02c73, 0x24cad, 0x265a9, 0x2df75, 0x10ed2, 0x1fb73, 0x0d9c6, 0x23f58, 0x265d3, 0x2fbab, 0x078d1, 0x27f6e, 0x059a6, 0x1ff6b, 0x19c94, 0x11d3f,
+    0x02d70, 0x265af, 0x24da8, 0x27e9b, 0x038cc, 0x2d7ca, 0x0f8c6, 0x0be91, 0x178b9, 0x118b7, 0x13887, 0x1fe7c, 0x078a0, 0x05885, 0x1d860, 0x11c3a,
+    0x08d77, 0x03b83, 0x03b93, 0x1bf44, 0x0fb95, 0x1fb57, 0x01a8c, 0x19b1f, 0x0f887, 0x01b7c, 0x1185e, 0x05a32, 0x01860, 0x0d93a, 0x11827, 0x05f0b,
+    0x00e06, 0x1ee31, 0x00925, 0x0095c, 0x20e1a, 0x22e3a, 0x02a8b, 0x0ea91, 0x06e31, 0x00a7a, 0x1095c, 0x02985, 0x20e3a, 0x2ca7c, 0x02a91, 0x02a9b,
+    0x16e1a, 0x16e3a, 0x06c8b, 0x1ac91, 0x2ee21, 0x2ee46, 0x1c6bd, 0x1c6c1, 0x2665c, 0x2e685, 0x046c4, 0x1c6ca, 0x2c660, 0x22687, 0x186c6, 0x0dfa8,
+    0x00d31, 0x06c7a, 0x1895c, 0x06985, 0x2465c, 0x16685, 0x006c4, 0x106ca, 0x08f7a, 0x006b5, 0x1e985, 0x249b7, 0x26685, 0x186b7, 0x046ca, 0x03daf,
+    0x14e3a, 0x2ac7c, 0x06c91, 0x06c9b, 0x28660, 0x16687, 0x0c6c6, 0x19fa8, 0x08685, 0x106b7, 0x006ca, 0x05eaf, 0x086a0, 0x1e6b9, 0x006cc, 0x01f70,
+    0x00e16, 0x2ee36, 0x006bb, 0x1c6bf, 0x20e1c, 0x2ee3c, 0x186bc, 0x1c6c0, 0x26e36, 0x2067f, 0x046bf, 0x186c9, 0x20e3c, 0x20680, 0x186c0, 0x01da1,
+    0x16e1c, 0x16e3c, 0x106bc, 0x106c0, 0x2ee23, 0x2ee48, 0x1c6be, 0x13d99, 0x2665d, 0x2e686, 0x046c5, 0x1c6cb, 0x2c661, 0x22688, 0x186c7, 0x11d61,
+    0x02e36, 0x1667f, 0x006bf, 0x106c9, 0x2465d, 0x16686, 0x006c5, 0x106cb, 0x0867f, 0x006b6, 0x006c9, 0x006cd, 0x26686, 0x186b8, 0x046cb, 0x01d86,
+    0x28e3c, 0x16680, 0x0c6c0, 0x07ba1, 0x28661, 0x16688, 0x0c6c7, 0x1db61, 0x08686, 0x106b8, 0x006cb, 0x05b86, 0x086a1, 0x1fd80, 0x1bdc0, 0x1df3c,
+    0x08e1a, 0x2e65c, 0x1ef8b, 0x1c6c4, 0x26e21, 0x2e660, 0x046bd, 0x1c6c6, 0x0ae3a, 0x20685, 0x1ef91, 0x186ca, 0x26e46, 0x20687, 0x046c1, 0x01ca8,
+    0x24e21, 0x2a660, 0x006bd, 0x106c6, 0x24651, 0x2e664, 0x006c2, 0x1c6c8, 0x26660, 0x206a0, 0x046c6, 0x186cc, 0x26664, 0x206a2, 0x046c8, 0x01c96,
+    0x08e3a, 0x28685, 0x12f91, 0x0c6ca, 0x24660, 0x166a0, 0x006c6, 0x106cc, 0x24f7c, 0x006b7, 0x1ef9b, 0x1deaf, 0x0a687, 0x066b9, 0x1dca8, 0x11c70,
+    0x24e46, 0x14687, 0x006c1, 0x05aa8, 0x24664, 0x166a2, 0x006c8, 0x19f96, 0x08687, 0x006b9, 0x11aa8, 0x19a70, 0x086a2, 0x006ba, 0x1dc96, 0x01e4b,
+    0x08e1c, 0x2e65d, 0x006bc, 0x1c6c5, 0x26e23, 0x2e661, 0x046be, 0x1c6c7, 0x26e3c, 0x20686, 0x046c0, 0x186cb, 0x26e48, 0x20688, 0x07d99, 0x05d61,
+    0x24e23, 0x2a661, 0x006be, 0x106c7, 0x24652, 0x2e665, 0x006c3, 0x1d98e, 0x26661, 0x206a1, 0x046c7, 0x13bc0, 0x26665, 0x19d5f, 0x0598e, 0x19d28,
+    0x08e3c, 0x28686, 0x006c0, 0x0c6cb, 0x24661, 0x166a1, 0x006c7, 0x1fdc0, 0x08680, 0x006b8, 0x1f8a1, 0x1d886, 0x0a688, 0x19d80, 0x19861, 0x05c3c,
+    0x24e48, 0x14688, 0x03b99, 0x01b61, 0x24665, 0x11b5f, 0x0198e, 0x11b28, 0x08688, 0x0fb80, 0x0d861, 0x01a3c, 0x0185f, 0x01937, 0x01828, 0x19d11,
+    0x1ce0b, 0x1c832, 0x00927, 0x0095e, 0x1ca1f, 0x1ee44, 0x0ea8c, 0x0ea93, 0x00b3a, 0x0ea7c, 0x0c960, 0x02987, 0x04a57, 0x2ea83, 0x02a95, 0x15f77,
+    0x10c1f, 0x12e44, 0x1ac8c, 0x1ac93, 0x1ee29, 0x1ee4e, 0x1c8be, 0x2ff66, 0x22a91, 0x2ea9b, 0x069c6, 0x2dfa8, 0x22a95, 0x2bf77, 0x2e2d7, 0x2bf5a,
+    0x04d3a, 0x18c7c, 0x18960, 0x06987, 0x16c91, 0x16c9b, 0x029c6, 0x29fa8, 0x1c985, 0x009b7, 0x1e9a0, 0x089b9, 0x2e6ca, 0x177af, 0x149cc, 0x15f70,
+    0x00c57, 0x1ac83, 0x06c95, 0x21f77, 0x16c95, 0x2ff77, 0x1f7d7, 0x21f5a, 0x2a6ca, 0x2f7af, 0x1a9cc, 0x1bf70, 0x2e6cc, 0x2ff70, 0x1f7d6, 0x01f54,
+    0x1ee1c, 0x1ee3c, 0x1acbc, 0x20cc0, 0x22e23, 0x22e48, 0x28abe, 0x2b799, 0x1aa5d, 0x2ea86, 0x08ac5, 0x2b7cb, 0x20a61, 0x2bd88, 0x27dc7, 0x15d61,
+    0x12e23, 0x12e48, 0x20cbe, 0x2f799, 0x2ee2b, 0x2ff50, 0x2f3d5, 0x2ff2b, 0x2e698, 0x2e69e, 0x2f3d8, 0x2f798, 0x2e699, 0x13f48, 0x21dbe, 0x13f23,
+    0x14c5d, 0x16c86, 0x26cc5, 0x2f7cb, 0x2a698, 0x1669e, 0x175d8, 0x2b798, 0x2e6c9, 0x2e6cd, 0x1e6db, 0x2f7c9, 0x2e6cb, 0x17d86, 0x27dc5, 0x15d5d,
+    0x14c61, 0x2ac88, 0x26cc7, 0x21b61, 0x2a699, 0x23f48, 0x29bbe, 0x23f23, 0x2a6cb, 0x2fb86, 0x09bc5, 0x1bb5d, 0x21dc0, 0x1ff3c, 0x1bdbc, 0x1ff1c,
+    0x00f3f, 0x2ee6e, 0x1cd94, 0x1e9d1, 0x20e58, 0x2ee75, 0x00bc6, 0x2b7a9, 0x1ae6b, 0x20aab, 0x10ba6, 0x2b7d3, 0x1aa73, 0x29dad, 0x05cd2, 0x0fd73,
+    0x14e58, 0x2ae75, 0x04dc6, 0x2f7a9, 0x2ee64, 0x2e678, 0x1e6d8, 0x2ff64, 0x2cea6, 0x2e6b3, 0x233da, 0x2dfa6, 0x2e6a9, 0x2bf75, 0x05cc6, 0x15f58,
+    0x0cd6b, 0x28cab, 0x1cda6, 0x2f7d3, 0x28ea6, 0x166b3, 0x126da, 0x29fa6, 0x1cfab, 0x2e6d4, 0x1e9b3, 0x1deab, 0x2e6d3, 0x29dab, 0x1dca6, 0x0dc6b,
+    0x0ec73, 0x28cad, 0x04dd2, 0x1bb73, 0x2a6a9, 0x2ff75, 0x01ac6, 0x21f58, 0x2a6d3, 0x21bab, 0x11aa6, 0x1bf6b, 0x1f8d1, 0x2ff6e, 0x1dc94, 0x01e3f,
+    0x00e54, 0x2ee70, 0x1e6d6, 0x2f7cc, 0x20e5a, 0x2ee77, 0x1e6d7, 0x17d95, 0x1ae70, 0x2e6af, 0x1b8cc, 0x2b7ca, 0x20e77, 0x1bd83, 0x07d95, 0x01d57,
+    0x2ae5a, 0x2ae77, 0x2f3d7, 0x23b95, 0x2ee66, 0x1ff4e, 0x1d9be, 0x1ff29, 0x2cea8, 0x2fb9b, 0x078c6, 0x23b91, 0x1bd93, 0x13f44, 0x1bd8c, 0x11d1f,
+    0x14e70, 0x166af, 0x158cc, 0x2f7ca, 0x28ea8, 0x17d9b, 0x038c6, 0x17d91, 0x098b9, 0x018b7, 0x1f8a0, 0x1d885, 0x07887, 0x19d7c, 0x19860, 0x05c3a,
+    0x14e77, 0x2fb83, 0x03b95, 0x05b57, 0x0fb93, 0x1ff44, 0x0fb8c, 0x1db1f, 0x03887, 0x0fb7c, 0x0d860, 0x01a3a, 0x0185e, 0x1d932, 0x01827, 0x1df0b,
+    0x00c10, 0x00836, 0x00926, 0x0095d, 0x00a26, 0x10a5d, 0x00b8d, 0x0ea98, 0x00b36, 0x00a7f, 0x1095d, 0x02986, 0x00a5d, 0x02a86, 0x02a98, 0x03d9e,
+    0x00c26, 0x18c5d, 0x04d8d, 0x1ac98, 0x1ce8d, 0x1ec98, 0x008c2, 0x01fd0, 0x02fbf, 0x12ac9, 0x069c5, 0x09ecb, 0x1eac5, 0x15dcb, 0x03cd8, 0x0fd98,
+    0x00d36, 0x06c7f, 0x1895d, 0x06986, 0x1ecbf, 0x22cc9, 0x029c5, 0x0becb, 0x1ef7f, 0x009b6, 0x1e986, 0x25eb8, 0x1afc9, 0x03dcd, 0x17ecb, 0x03e86,
+    0x00c5d, 0x06c86, 0x06c98, 0x06c9e, 0x1ecc5, 0x22ccb, 0x07ad8, 0x07e98, 0x14fc9, 0x27bcd, 0x23ecb, 0x07e86, 0x09ddb, 0x15dc9, 0x1fec5, 0x01e5d,
+    0x00e36, 0x1ec7f, 0x06cbf, 0x1acc9, 0x18a5d, 0x1ea86, 0x02ac5, 0x17dcb, 0x06f7f, 0x00ab6, 0x22fc9, 0x03ecd, 0x06a86, 0x25db8, 0x0bdcb, 0x03d86,
+    0x10c5d, 0x1ec86, 0x06cc5, 0x20ccb, 0x12c98, 0x1ec9e, 0x1f9d8, 0x13d98, 0x02fc9, 0x2eacd, 0x16fdb, 0x03ec9, 0x21dcb, 0x1fd86, 0x07dc5, 0x11d5d,
+    0x00c7f, 0x00cb6, 0x0acc9, 0x26ccd, 0x12cc9, 0x2eccd, 0x20cdb, 0x13dc9, 0x00fb6, 0x010dd, 0x2efcd, 0x01eb6, 0x27dcd, 0x01db6, 0x0bdc9, 0x01d7f,
+    0x02c86, 0x24cb8, 0x0accb, 0x07b86, 0x16ccb, 0x1fb86, 0x03bc5, 0x19b5d, 0x02fcd, 0x01bb6, 0x23ec9, 0x07e7f, 0x1bdc9, 0x1fd7f, 0x07dbf, 0x01f36,
+    0x00f26, 0x02cbf, 0x1cd8d, 0x1e9c5, 0x04e8d, 0x06ac5, 0x00bc2, 0x03fd8, 0x18f5d, 0x0aac9, 0x1ef98, 0x15ecb, 0x1af98, 0x09dcb, 0x01cd0, 0x03d98,
+    0x00d8d, 0x02cc5, 0x00dc2, 0x06dd8, 0x00ec2, 0x1ffd8, 0x250dc, 0x01fc2, 0x02fc5, 0x20adb, 0x1fcd8, 0x03ec5, 0x07cd8, 0x03dc5, 0x01cc2, 0x01c8d,
+    0x10f5d, 0x02cc9, 0x12f98, 0x21ecb, 0x06fc5, 0x16cdb, 0x1fad8, 0x07ec5, 0x1ef86, 0x2e9cd, 0x1ef9e, 0x1fe86, 0x20fcb, 0x03dc9, 0x13e98, 0x11e5d,
+    0x02c98, 0x08ccb, 0x00dd0, 0x1be98, 0x02ed8, 0x07bc5, 0x01ac2, 0x05f8d, 0x14fcb, 0x0bbc9, 0x1fe98, 0x19e5d, 0x1f8c5, 0x03dbf, 0x1dc8d, 0x01e26,
+    0x00f5d, 0x14cc9, 0x1efc5, 0x08cdb, 0x06f98, 0x23dcb, 0x06bd8, 0x1fdc5, 0x06f86, 0x26acd, 0x22fcb, 0x15ec9, 0x07d9e, 0x07d86, 0x07d98, 0x01d5d,
+    0x0ec98, 0x14ccb, 0x02dd8, 0x1fbc5, 0x00ed0, 0x1fd98, 0x019c2, 0x1df8d, 0x08fcb, 0x13bc9, 0x078c5, 0x03ebf, 0x1bd98, 0x19d5d, 0x05c8d, 0x01d26,
+    0x02f86, 0x02ccd, 0x16fcb, 0x1bec9, 0x0afcb, 0x23dc9, 0x038c5, 0x1fdbf, 0x24fb8, 0x018b6, 0x1f886, 0x1fe7f, 0x07886, 0x07d7f, 0x1985d, 0x01c36,
+    0x02c9e, 0x03b86, 0x03b98, 0x01b5d, 0x0fb98, 0x11b5d, 0x01a8d, 0x01b26, 0x03886, 0x01b7f, 0x1185d, 0x01a36, 0x0185d, 0x01936, 0x01826, 0x01d10,
+    0x18c11, 0x00837, 0x00928, 0x0095f, 0x10a28, 0x10a5f, 0x0088e, 0x25765, 0x00b3c, 0x0ea80, 0x0c961, 0x09788, 0x00a61, 0x15788, 0x02a99, 0x25f48,
+    0x18c28, 0x18c5f, 0x0488e, 0x27765, 0x1c88e, 0x2f765, 0x017c3, 0x25752, 0x12ac0, 0x217a1, 0x057c7, 0x27761, 0x117c7, 0x2b761, 0x017be, 0x25f23,
+    0x04d3c, 0x18c80, 0x18961, 0x0b788, 0x1ecc0, 0x177a1, 0x017c7, 0x25761, 0x1c986, 0x017b8, 0x1e9a1, 0x09780, 0x0d7cb, 0x29786, 0x017c0, 0x09f3c,
+    0x04c61, 0x21788, 0x06c99, 0x27f48, 0x1d7c7, 0x2f761, 0x057be, 0x27f23, 0x197cb, 0x21786, 0x057c0, 0x27f3c, 0x1d7c5, 0x2f75d, 0x017bc, 0x09f1c,
+    0x1ce3c, 0x1ec80, 0x1acc0, 0x097a1, 0x1ca61, 0x17788, 0x0d7c7, 0x29761, 0x04a86, 0x117b8, 0x017cb, 0x09786, 0x06aa1, 0x17780, 0x0d7c0, 0x29f3c,
+    0x10c61, 0x23788, 0x197c7, 0x2d761, 0x12c99, 0x2ff48, 0x1d7be, 0x2ff23, 0x1d7cb, 0x2f786, 0x057c5, 0x2775d, 0x117c0, 0x17f3c, 0x117bc, 0x17f1c,
+    0x00c86, 0x197b8, 0x057cb, 0x27786, 0x117cb, 0x17786, 0x017c5, 0x2575d, 0x017cd, 0x017b6, 0x017c9, 0x0977f, 0x117c9, 0x1777f, 0x017bf, 0x03f36,
+    0x00ca1, 0x21780, 0x197c0, 0x21f3c, 0x1d7c0, 0x2ff3c, 0x197bc, 0x21f1c, 0x197c9, 0x2177f, 0x057bf, 0x27f36, 0x1d7bf, 0x2ff36, 0x017bb, 0x01f16,
+    0x00f4b, 0x017ba, 0x1cd96, 0x097a2, 0x18e96, 0x177a2, 0x017c8, 0x25764, 0x18b70, 0x017b9, 0x10ba8, 0x09787, 0x04ba8, 0x15787, 0x017c1, 0x25f46,
+    0x00d96, 0x217a2, 0x057c8, 0x27764, 0x1d7c8, 0x2f764, 0x017c2, 0x25751, 0x197cc, 0x217a0, 0x057c6, 0x27760, 0x117c6, 0x2b760, 0x017bd, 0x25f21,
+    0x10d70, 0x077b9, 0x1cda8, 0x0b787, 0x117cc, 0x177a0, 0x017c6, 0x25760, 0x1cfaf, 0x017b7, 0x1fe9b, 0x25e7c, 0x0d7ca, 0x29785, 0x13e91, 0x09f3a,
+    0x00da8, 0x21787, 0x057c1, 0x27f46, 0x1d7c6, 0x2f760, 0x057bd, 0x27f21, 0x197ca, 0x21785, 0x1fe91, 0x0bf3a, 0x1d7c4, 0x2f75c, 0x1fe8b, 0x09f1a,
+    0x00e70, 0x1f7b9, 0x017cc, 0x097a0, 0x18ea8, 0x17787, 0x0d7c6, 0x29760, 0x04faf, 0x117b7, 0x017ca, 0x09785, 0x07d9b, 0x2bd7c, 0x07d91, 0x15f3a,
+    0x0cea8, 0x23787, 0x197c6, 0x2d760, 0x1d7c1, 0x2ff46, 0x1d7bd, 0x2ff21, 0x1d7ca, 0x2f785, 0x057c4, 0x2775c, 0x1bd91, 0x17f3a, 0x07d8b, 0x17f1a,
+    0x02caf, 0x197b7, 0x057ca, 0x27785, 0x117ca, 0x17785, 0x017c4, 0x2575c, 0x258b7, 0x017b5, 0x1f885, 0x09e7a, 0x07885, 0x07d7a, 0x1985c, 0x01c31,
+    0x03b9b, 0x2db7c, 0x03b91, 0x21f3a, 0x0fb91, 0x23f3a, 0x03b8b, 0x21f1a, 0x03885, 0x01b7a, 0x1185c, 0x07f31, 0x0185c, 0x1ff31, 0x01825, 0x01f06,
+    0x00f09, 0x00838, 0x1ed1e, 0x04956, 0x1ae1e, 0x1ea56, 0x00b8b, 0x0ea94, 0x18b30, 0x00a7b, 0x1ed42, 0x2e982, 0x1ae42, 0x02a82, 0x02a92, 0x02a9c,
+    0x00c33, 0x18c68, 0x20d56, 0x20d72, 0x2ce56, 0x22e72, 0x027c4, 0x008d1, 0x24f68, 0x206aa, 0x2a572, 0x225ac, 0x26672, 0x206ac, 0x027d1, 0x03cae,
+    0x10d1a, 0x1a95c, 0x22d21, 0x20960, 0x26f8b, 0x266c4, 0x287bd, 0x249c6, 0x12d3a, 0x2e985, 0x22d46, 0x2e987, 0x26f91, 0x066ca, 0x289c1, 0x0fca8,
+    0x14f3f, 0x1ad6e, 0x2ed58, 0x20d75, 0x08794, 0x266d1, 0x0e7c6, 0x19fa9, 0x2876b, 0x2e5ab, 0x2a573, 0x225ad, 0x087a6, 0x066d3, 0x0e7d2, 0x01e73,
+    0x06e1a, 0x22a5c, 0x16f8b, 0x165c4, 0x1ae21, 0x22a60, 0x087bd, 0x28ac6, 0x06e3a, 0x20a85, 0x2af91, 0x125ca, 0x1ae46, 0x2ca87, 0x08ac1, 0x03ca8,
+    0x02f3f, 0x22e6e, 0x14794, 0x165d1, 0x2ce58, 0x22e75, 0x027c6, 0x1dfa9, 0x2476b, 0x206ab, 0x147a6, 0x125d3, 0x26673, 0x206ad, 0x027d2, 0x0dd73,
+    0x02f26, 0x266bf, 0x2878d, 0x165c5, 0x0878d, 0x266c5, 0x027c2, 0x007d8, 0x24f5d, 0x0a6c9, 0x16598, 0x125cb, 0x0a698, 0x066cb, 0x027d0, 0x01d98,
+    0x02f4b, 0x03bba, 0x14796, 0x07ba2, 0x08796, 0x11ba2, 0x027c8, 0x19b64, 0x24770, 0x01bb9, 0x147a8, 0x05b87, 0x087a8, 0x11b87, 0x03bc1, 0x19f46,
+    0x00f19, 0x2c690, 0x12d27, 0x2e594, 0x0ae27, 0x2c694, 0x247bc, 0x2e1d6, 0x12d40, 0x2069a, 0x12d4c, 0x2259c, 0x0ae4c, 0x2069c, 0x21ca3, 0x01c9f,
+    0x02f39, 0x2c6a4, 0x2ad60, 0x2e5a6, 0x26e60, 0x2c6a6, 0x027c5, 0x19fcc, 0x24769, 0x206b0, 0x2a575, 0x225b2, 0x26675, 0x206b2, 0x21ca2, 0x01c84,
+    0x14f1f, 0x2e591, 0x16d29, 0x2e595, 0x2478c, 0x0a6c6, 0x287be, 0x221d7, 0x16d44, 0x2e59b, 0x16d4e, 0x1fc77, 0x26f93, 0x21ca8, 0x23c66, 0x1fc5a,
+    0x14f43, 0x2e5a5, 0x2ad62, 0x2e5a7, 0x08795, 0x0a6d2, 0x0e7c7, 0x05a95, 0x2876c, 0x2e5b1, 0x2a576, 0x1da6c, 0x087a7, 0x238a5, 0x1fc62, 0x11e43,
+    0x08f1f, 0x2c691, 0x2878c, 0x165c6, 0x26e29, 0x2c695, 0x087be, 0x202d7, 0x0ae44, 0x2069b, 0x2af93, 0x23ca8, 0x26e4e, 0x1bc77, 0x1bc66, 0x05c5a,
+    0x08f43, 0x2c6a5, 0x14795, 0x165d2, 0x26e62, 0x2c6a7, 0x027c7, 0x11995, 0x2476c, 0x206b1, 0x147a7, 0x218a5, 0x26676, 0x1996c, 0x1bc62, 0x05d43,
+    0x24f28, 0x0a6c0, 0x2878e, 0x165c7, 0x0878e, 0x0a6c7, 0x027c3, 0x038be, 0x24f5f, 0x218a1, 0x23865, 0x1f861, 0x1b865, 0x1b861, 0x19852, 0x19c23,
+    0x24f4d, 0x03b89, 0x14797, 0x01b62, 0x08797, 0x0db62, 0x0388e, 0x01b29, 0x24771, 0x0187e, 0x11859, 0x0da3b, 0x05859, 0x0193b, 0x19822, 0x1980e,
+    0x18d0d, 0x00839, 0x18921, 0x04958, 0x18a21, 0x10a58, 0x02a8d, 0x0ea96, 0x00b39, 0x00a7d, 0x10958, 0x02984, 0x04a58, 0x02a84, 0x02a96, 0x03c9d,
+    0x00c39, 0x18c69, 0x1ad60, 0x1a975, 0x1ee60, 0x1ea75, 0x008c5, 0x2dfa2, 0x22da4, 0x2eab0, 0x209a6, 0x2dfb2, 0x22aa6, 0x2ffb2, 0x25ccc, 0x03f84,
+    0x18d21, 0x1a960, 0x18d51, 0x1a964, 0x02ebd, 0x089c6, 0x029c2, 0x09fc8, 0x1e960, 0x209a0, 0x22964, 0x2c9a2, 0x149c6, 0x249cc, 0x29cc8, 0x0fc96,
+    0x04d58, 0x1ad75, 0x1ad64, 0x1ad78, 0x14ec6, 0x23fa9, 0x27bd8, 0x1bf64, 0x22da6, 0x21bb3, 0x22da9, 0x1bf75, 0x2c1da, 0x23fa6, 0x15cc6, 0x05f58,
+    0x18e21, 0x1ea60, 0x02dbd, 0x14ac6, 0x18e51, 0x22a64, 0x02ac2, 0x29fc8, 0x1aa60, 0x20aa0, 0x08ac6, 0x24acc, 0x1aa64, 0x2caa2, 0x09cc8, 0x03c96,
+    0x10e58, 0x1ee75, 0x08dc6, 0x21fa9, 0x22e64, 0x23f78, 0x16ad8, 0x23f64, 0x20ea6, 0x2eab3, 0x2f3da, 0x21fa6, 0x20ea9, 0x1ff75, 0x09cc6, 0x11f58,
+    0x02d8d, 0x00cc5, 0x02dc2, 0x26dd8, 0x02ec2, 0x17fd8, 0x190dc, 0x03fc2, 0x00fc5, 0x206db, 0x17cd8, 0x01ec5, 0x27cd8, 0x01dc5, 0x03cc2, 0x03c8d,
+    0x02d96, 0x2dba2, 0x08dc8, 0x1bb64, 0x28ec8, 0x23b64, 0x03bc2, 0x19f51, 0x25bcc, 0x21ba0, 0x09bc6, 0x1bb60, 0x15bc6, 0x1fb60, 0x03cbd, 0x19f21,
+    0x00f39, 0x20da4, 0x1ed60, 0x229a6, 0x1ae60, 0x20aa6, 0x00bc5, 0x25fcc, 0x18f69, 0x20ab0, 0x1e975, 0x2fcb2, 0x1aa75, 0x2dcb2, 0x2dca2, 0x03c84,
+    0x00d7d, 0x20db0, 0x20da0, 0x20db3, 0x20ea0, 0x2ffb3, 0x210db, 0x21fa0, 0x2edb0, 0x210b4, 0x2fcb3, 0x2fcb0, 0x21cb3, 0x21cb0, 0x21ca0, 0x01c7d,
+    0x10d58, 0x20da6, 0x22d64, 0x20da9, 0x08ec6, 0x2f0da, 0x169d8, 0x09fc6, 0x1ed75, 0x2e9b3, 0x23c78, 0x1fc75, 0x21ca9, 0x21ca6, 0x23c64, 0x11c58,
+    0x02d84, 0x2cdb2, 0x2cda2, 0x1bb75, 0x24ecc, 0x21ba6, 0x01ac5, 0x1bf60, 0x2edb2, 0x21bb0, 0x1f875, 0x19e69, 0x238a6, 0x21ca4, 0x1fc60, 0x01e39,
+    0x04e58, 0x22ea6, 0x14dc6, 0x2d0da, 0x1ae64, 0x22ea9, 0x26ad8, 0x15fc6, 0x1ae75, 0x20ab3, 0x23ca9, 0x23ca6, 0x1bc78, 0x1bc75, 0x1bc64, 0x05c58,
+    0x02e84, 0x2eeb2, 0x24dcc, 0x23ba6, 0x2cea2, 0x1fb75, 0x019c5, 0x1ff60, 0x2ceb2, 0x2fbb0, 0x218a6, 0x23ca4, 0x1b875, 0x19d69, 0x1bc60, 0x01d39,
+    0x0ed96, 0x258cc, 0x28dc8, 0x158c6, 0x08ec8, 0x098c6, 0x038c2, 0x03fbd, 0x2d8a2, 0x218a0, 0x23864, 0x1f860, 0x1b864, 0x1b860, 0x19c51, 0x19c21,
+    0x02d9d, 0x03b84, 0x03b96, 0x05b58, 0x0fb96, 0x11b58, 0x03b8d, 0x19b21, 0x03884, 0x01b7d, 0x11858, 0x01a39, 0x05858, 0x01939, 0x19821, 0x19c0d,
+    0x1cd0b, 0x0083a, 0x1c91f, 0x04957, 0x00a27, 0x0ca60, 0x0cb8c, 0x02995, 0x1cb32, 0x0e97c, 0x1ed44, 0x2e983, 0x00a5e, 0x02a87, 0x0e993, 0x15c77,
+    0x00c3f, 0x1ad6b, 0x20d58, 0x1a973, 0x1ce94, 0x108a6, 0x008c6, 0x05fd2, 0x2ed6e, 0x209ab, 0x2ed75, 0x29ead, 0x1ead1, 0x2b4d3, 0x2b4a9, 0x0fe73,
+    0x1ed1c, 0x1a95d, 0x22d23, 0x20961, 0x1afbc, 0x089c5, 0x289be, 0x27ec7, 0x1ed3c, 0x2e986, 0x22d48, 0x2be88, 0x20fc0, 0x2b4cb, 0x2b499, 0x15e61,
+    0x00d54, 0x1ad70, 0x20d5a, 0x20d77, 0x1e5d6, 0x1bbcc, 0x2b6d7, 0x07e95, 0x2ed70, 0x2e5af, 0x2ed77, 0x1be83, 0x2f4cc, 0x2b4ca, 0x17e95, 0x01e57,
+    0x04e3a, 0x1ca85, 0x16f91, 0x2e5ca, 0x18a60, 0x1eaa0, 0x02ac6, 0x14acc, 0x18f7c, 0x00ab7, 0x16f9b, 0x174af, 0x06a87, 0x08ab9, 0x29ca8, 0x15c70,
+    0x0ed6b, 0x1ccab, 0x28da6, 0x2e5d3, 0x1cea6, 0x1eab3, 0x176da, 0x1dfa6, 0x28fab, 0x2e5d4, 0x165b3, 0x29eab, 0x2f4d3, 0x1ddab, 0x29ca6, 0x0fc6b,
+    0x14f5d, 0x2e5c9, 0x2a598, 0x2e5cb, 0x26fc5, 0x1e5db, 0x176d8, 0x27ec5, 0x16f86, 0x2e5cd, 0x1659e, 0x17e86, 0x2f4cb, 0x2f4c9, 0x2b498, 0x15e5d,
+    0x14d70, 0x09bb9, 0x28da8, 0x07b87, 0x15bcc, 0x1fba0, 0x03bc6, 0x19b60, 0x165af, 0x01bb7, 0x17e9b, 0x19e7c, 0x2f4ca, 0x1db85, 0x17e91, 0x05f3a,
+    0x10f1f, 0x22991, 0x1ed29, 0x22995, 0x1af8c, 0x06ac6, 0x1cbbe, 0x2e1d7, 0x12d44, 0x2e99b, 0x1ed4e, 0x2bc77, 0x1af93, 0x2dca8, 0x2fc66, 0x2bc5a,
+    0x14d58, 0x2cda6, 0x2ed64, 0x2e5a9, 0x04ec6, 0x230da, 0x1e5d8, 0x05fc6, 0x2ad75, 0x2e5b3, 0x2e578, 0x2bc75, 0x2f4a9, 0x2dca6, 0x2fc64, 0x15c58,
+    0x12d23, 0x2e598, 0x2ed2b, 0x2e599, 0x20fbe, 0x2f0d8, 0x2f0d5, 0x21ebe, 0x12d48, 0x2e59e, 0x2fc50, 0x13c48, 0x2f499, 0x2f498, 0x2fc2b, 0x13c23,
+    0x2ad5a, 0x2cda8, 0x2ed66, 0x1be93, 0x2f0d7, 0x07bc6, 0x1dabe, 0x1be8c, 0x2ad77, 0x2f89b, 0x1fc4e, 0x13c44, 0x23895, 0x23891, 0x1fc29, 0x11e1f,
+    0x00f57, 0x2a5ca, 0x16f95, 0x2e5cc, 0x06f95, 0x1aacc, 0x2a7d7, 0x1f4d6, 0x1af83, 0x2f4af, 0x2fc77, 0x2fc70, 0x21c77, 0x1bc70, 0x21c5a, 0x01c54,
+    0x0ef73, 0x2a5d3, 0x2a5a9, 0x1fbd1, 0x04ed2, 0x119a6, 0x019c6, 0x1df94, 0x28fad, 0x218ab, 0x2fc75, 0x2fc6e, 0x1b873, 0x1bc6b, 0x21c58, 0x01d3f,
+    0x14f61, 0x2a5cb, 0x2a599, 0x21ec0, 0x26fc7, 0x098c5, 0x298be, 0x1bebc, 0x2af88, 0x2f886, 0x23c48, 0x1fc3c, 0x21861, 0x1b85d, 0x23c23, 0x1fc1c,
+    0x14d77, 0x03b87, 0x0f893, 0x01b5e, 0x03895, 0x0db60, 0x0da8c, 0x01b27, 0x2f883, 0x0f87c, 0x1fc44, 0x1da32, 0x05857, 0x0193a, 0x1d81f, 0x1dc0b,
+    0x1890e, 0x0083b, 0x18922, 0x04959, 0x00a29, 0x0ca62, 0x0298e, 0x09697, 0x0cb3b, 0x0097e, 0x10959, 0x25671, 0x00a62, 0x02a89, 0x15697, 0x25e4d,
+    0x04c43, 0x1886c, 0x1ad62, 0x27776, 0x10895, 0x2d7a7, 0x036c7, 0x27f62, 0x209a5, 0x217b1, 0x156a7, 0x2566c, 0x174d2, 0x2d7a5, 0x15695, 0x09e43,
+    0x18d23, 0x1a961, 0x18952, 0x1a965, 0x029be, 0x0b7c7, 0x036c3, 0x0968e, 0x1e961, 0x209a1, 0x22965, 0x25e5f, 0x174c7, 0x0b7c0, 0x2968e, 0x25e28,
+    0x04d5a, 0x1ad77, 0x1ad66, 0x27f4e, 0x213d7, 0x2d795, 0x096be, 0x27f29, 0x22da8, 0x2179b, 0x2be93, 0x0bf44, 0x174c6, 0x2d791, 0x2968c, 0x09e1f,
+    0x18e46, 0x10a87, 0x02ac1, 0x096a8, 0x18a64, 0x10aa2, 0x036c8, 0x09696, 0x04a87, 0x00ab9, 0x156a8, 0x25670, 0x06aa2, 0x02aba, 0x15696, 0x03e4b,
+    0x0cc73, 0x217ad, 0x036d2, 0x27773, 0x1cea9, 0x23f75, 0x036c6, 0x2df58, 0x134d3, 0x217ab, 0x156a6, 0x2566b, 0x174d1, 0x23f6e, 0x15694, 0x03e3f,
+    0x00c98, 0x077cb, 0x036d0, 0x0b798, 0x016d8, 0x277c5, 0x036c2, 0x0968d, 0x134cb, 0x0b7c9, 0x17498, 0x25e5d, 0x174c5, 0x277bf, 0x2968d, 0x03e26,
+    0x02da8, 0x2db87, 0x09bc1, 0x1bf46, 0x29bc6, 0x23b60, 0x096bd, 0x1bf21, 0x134ca, 0x21b85, 0x2be91, 0x07f3a, 0x174c4, 0x23b5c, 0x17e8b, 0x07f1a,
+    0x10f43, 0x229a5, 0x1ed62, 0x096a7, 0x04b95, 0x0b7d2, 0x0f6c7, 0x09695, 0x1cb6c, 0x2f4b1, 0x2b476, 0x2966c, 0x2f4a7, 0x2f4a5, 0x2bc62, 0x15e43,
+    0x00d84, 0x217b2, 0x20da2, 0x27775, 0x18ecc, 0x2d7a6, 0x036c5, 0x27f60, 0x234b2, 0x217b0, 0x2b475, 0x25669, 0x2f4a6, 0x2d7a4, 0x2bc60, 0x03e39,
+    0x1ed5a, 0x20da8, 0x22d66, 0x27e93, 0x230d7, 0x0b7c6, 0x296be, 0x2568c, 0x1ed77, 0x2f49b, 0x17c4e, 0x17c44, 0x2f495, 0x2f491, 0x17c29, 0x15e1f,
+    0x00d9f, 0x2179c, 0x20da3, 0x0bf4c, 0x2f0d6, 0x2d794, 0x256bc, 0x0bf27, 0x2349c, 0x2179a, 0x13c4c, 0x13c40, 0x2f494, 0x2d790, 0x13c27, 0x01e19,
+    0x00f73, 0x077d3, 0x0f6d2, 0x096a6, 0x18ea9, 0x277d1, 0x0f6c6, 0x09694, 0x234ad, 0x2f4ab, 0x2b473, 0x2966b, 0x21c75, 0x1bc6e, 0x2fc58, 0x15e3f,
+    0x02dae, 0x217ac, 0x036d1, 0x27772, 0x019d1, 0x23f72, 0x036c4, 0x2df56, 0x234ac, 0x217aa, 0x2b472, 0x25e68, 0x21c72, 0x19d68, 0x21c56, 0x01d33,
+    0x0eda8, 0x077ca, 0x298c1, 0x27e91, 0x258c6, 0x277c4, 0x296bd, 0x27e8b, 0x2f887, 0x2f885, 0x23c46, 0x13c3a, 0x21860, 0x1b85c, 0x23c21, 0x11c1a,
+    0x03b9c, 0x03b82, 0x03b92, 0x1bf42, 0x0fb94, 0x1fb56, 0x01a8b, 0x1bf1e, 0x2f882, 0x01b7b, 0x1fc42, 0x19a30, 0x05856, 0x01938, 0x1fc1e, 0x01e09,
+    0x04e0b, 0x0c83a, 0x10927, 0x00960, 0x18a1f, 0x1ea57, 0x02a8c, 0x0ea95, 0x04b32, 0x00a7c, 0x1095e, 0x0e987, 0x1ae44, 0x02a83, 0x02a93, 0x09c77,
+    0x10c3f, 0x1ee6b, 0x18d94, 0x048a6, 0x22e58, 0x1ea73, 0x0c8c6, 0x11fd2, 0x26e6e, 0x2eaab, 0x069d1, 0x274d3, 0x2ce75, 0x25dad, 0x274a9, 0x03d73,
+    0x10d3a, 0x04985, 0x1c960, 0x069a0, 0x0af91, 0x2c6ca, 0x0e9c6, 0x029cc, 0x1ef7c, 0x109b7, 0x12987, 0x169b9, 0x26f9b, 0x274af, 0x25ca8, 0x03c70,
+    0x00d6b, 0x04cab, 0x18da6, 0x07bb3, 0x24ea6, 0x2c6d3, 0x066da, 0x19fa6, 0x08fab, 0x266d4, 0x2d4d3, 0x05eab, 0x266b3, 0x09dab, 0x25ca6, 0x03c6b,
+    0x06e1c, 0x22a5d, 0x22fbc, 0x28ac5, 0x1ae23, 0x22a61, 0x08abe, 0x2bdc7, 0x06e3c, 0x20a86, 0x22fc0, 0x274cb, 0x1ae48, 0x27d88, 0x27499, 0x09d61,
+    0x02e54, 0x22e70, 0x066d6, 0x23bcc, 0x2ce5a, 0x22e77, 0x1a6d7, 0x13d95, 0x26e70, 0x206af, 0x274cc, 0x274ca, 0x2ce77, 0x27d83, 0x0bd95, 0x03d57,
+    0x02f5d, 0x266c9, 0x16fc5, 0x066db, 0x26698, 0x2c6cb, 0x267d8, 0x17dc5, 0x26f86, 0x266cd, 0x2d4cb, 0x274c9, 0x2669e, 0x27d86, 0x27498, 0x03d5d,
+    0x02e70, 0x17bb9, 0x03bcc, 0x07ba0, 0x24ea8, 0x13b87, 0x0fbc6, 0x1db60, 0x266af, 0x11bb7, 0x2d4ca, 0x05b85, 0x27d9b, 0x1fd7c, 0x0bd91, 0x11f3a,
+    0x04f1f, 0x20a91, 0x1ef8c, 0x129c6, 0x06e29, 0x20a95, 0x04bbe, 0x2c2d7, 0x06e44, 0x20a9b, 0x1ef93, 0x2fca8, 0x06e4e, 0x27c77, 0x27c66, 0x09c5a,
+    0x08e58, 0x2eea6, 0x10dc6, 0x210da, 0x26e64, 0x2c6a9, 0x066d8, 0x11fc6, 0x26e75, 0x206b3, 0x2d4a9, 0x2fca6, 0x26678, 0x27c75, 0x27c64, 0x09c58,
+    0x02f57, 0x266ca, 0x12f95, 0x229cc, 0x0af95, 0x266cc, 0x267d7, 0x074d6, 0x26f83, 0x214af, 0x23c77, 0x23c70, 0x2dc77, 0x27c70, 0x2dc5a, 0x03c54,
+    0x02f73, 0x266d3, 0x10dd2, 0x05aa6, 0x266a9, 0x07bd1, 0x0dac6, 0x19f94, 0x24fad, 0x2f8ab, 0x1f873, 0x1fc6b, 0x2dc75, 0x27c6e, 0x23c58, 0x11e3f,
+    0x0ae23, 0x2c698, 0x2efbe, 0x210d8, 0x26e2b, 0x2c699, 0x210d5, 0x2fdbe, 0x0ae48, 0x2069e, 0x2d499, 0x2d498, 0x27c50, 0x0bc48, 0x27c2b, 0x0bc23,
+    0x08e5a, 0x2eea8, 0x2d0d7, 0x13bc6, 0x26e66, 0x1fd93, 0x059be, 0x1fd8c, 0x26e77, 0x2189b, 0x21895, 0x21891, 0x07c4e, 0x07c44, 0x07c29, 0x05d1f,
+    0x08f61, 0x266cb, 0x2afc7, 0x298c5, 0x26699, 0x23dc0, 0x098be, 0x23dbc, 0x26f88, 0x21886, 0x23861, 0x2385d, 0x1bc48, 0x07c3c, 0x1bc23, 0x07c1c,
+    0x08e77, 0x0fb87, 0x0f895, 0x01b60, 0x03893, 0x11b5e, 0x0198c, 0x11b27, 0x03883, 0x0187c, 0x1f857, 0x0da3a, 0x1bc44, 0x05932, 0x1981f, 0x05c0b,
+    0x18a0e, 0x0c83b, 0x00929, 0x00962, 0x18a22, 0x10a59, 0x02a8e, 0x15597, 0x00b3b, 0x00a7e, 0x0c962, 0x02989, 0x04a59, 0x25571, 0x09597, 0x25d4d,
+    0x10c43, 0x1c86c, 0x04895, 0x2f7a7, 0x1ee62, 0x2b776, 0x0f5c7, 0x2bf62, 0x22aa5, 0x2f7b1, 0x0b4d2, 0x2f7a5, 0x095a7, 0x2956c, 0x09595, 0x15d43,
+    0x18d46, 0x04987, 0x18964, 0x069a2, 0x029c1, 0x155a8, 0x035c8, 0x15596, 0x10987, 0x009b9, 0x109a2, 0x029ba, 0x095a8, 0x25570, 0x09596, 0x03d4b,
+    0x00c73, 0x237ad, 0x18da9, 0x21f75, 0x0f5d2, 0x2b773, 0x0f5c6, 0x2ff58, 0x074d3, 0x2f7ab, 0x274d1, 0x1bf6e, 0x095a6, 0x2956b, 0x09594, 0x15d3f,
+    0x18e23, 0x1ea61, 0x02abe, 0x177c7, 0x18a52, 0x22a65, 0x035c3, 0x2958e, 0x1aa61, 0x20aa1, 0x0b4c7, 0x177c0, 0x1aa65, 0x25d5f, 0x0958e, 0x25d28,
+    0x1ee5a, 0x1ee77, 0x233d7, 0x2f795, 0x22e66, 0x17f4e, 0x295be, 0x17f29, 0x20ea8, 0x2f79b, 0x0b4c6, 0x2f791, 0x27d93, 0x17f44, 0x2558c, 0x15d1f,
+    0x0cc98, 0x137cb, 0x015d8, 0x177c5, 0x035d0, 0x17798, 0x035c2, 0x2958d, 0x074cb, 0x137c9, 0x274c5, 0x177bf, 0x0b498, 0x25d5d, 0x0958d, 0x03d26,
+    0x0eea8, 0x2fb87, 0x25bc6, 0x21b60, 0x29bc1, 0x23f46, 0x295bd, 0x23f21, 0x074ca, 0x2fb85, 0x274c4, 0x1bb5c, 0x27d91, 0x13f3a, 0x27d8b, 0x11f1a,
+    0x04f43, 0x20aa5, 0x10b95, 0x177d2, 0x1ae62, 0x155a7, 0x035c7, 0x15595, 0x18b6c, 0x214b1, 0x2d4a7, 0x2d4a5, 0x27476, 0x2556c, 0x27c62, 0x09d43,
+    0x00e84, 0x237b2, 0x18dcc, 0x2f7a6, 0x20ea2, 0x2b775, 0x035c5, 0x2bf60, 0x214b2, 0x2f7b0, 0x2d4a6, 0x2f7a4, 0x27475, 0x25569, 0x27c60, 0x03d39,
+    0x0cf73, 0x137d3, 0x1cda9, 0x177d1, 0x035d2, 0x155a6, 0x035c6, 0x15594, 0x214ad, 0x214ab, 0x23c75, 0x23c6e, 0x27473, 0x2556b, 0x2dc58, 0x03d3f,
+    0x00dae, 0x237ac, 0x01ad1, 0x21f72, 0x035d1, 0x2b772, 0x035c4, 0x21f56, 0x214ac, 0x2f7aa, 0x23c72, 0x19e68, 0x27472, 0x25d68, 0x2dc56, 0x03d33,
+    0x04e5a, 0x22ea8, 0x210d7, 0x177c6, 0x1ae66, 0x2bd93, 0x095be, 0x2958c, 0x1ae77, 0x2149b, 0x2d495, 0x2d491, 0x27c4e, 0x0bc44, 0x27c29, 0x09d1f,
+    0x00e9f, 0x2379c, 0x210d6, 0x2f794, 0x20ea3, 0x13f4c, 0x255bc, 0x13f27, 0x2149c, 0x2f79a, 0x2d494, 0x2f790, 0x0bc4c, 0x0bc40, 0x0bc27, 0x01d19,
+    0x02ea8, 0x137ca, 0x298c6, 0x177c4, 0x098c1, 0x2bd91, 0x095bd, 0x17d8b, 0x2d887, 0x21885, 0x23860, 0x2385c, 0x1bc46, 0x07c3a, 0x1bc21, 0x07c1a,
+    0x0fb9c, 0x2fb82, 0x03b94, 0x05b56, 0x0fb92, 0x1ff42, 0x0198b, 0x1ff1e, 0x03882, 0x0fb7b, 0x1f856, 0x01a38, 0x1bc42, 0x19930, 0x1bc1e, 0x01d09,
+    0x18f11, 0x0083c, 0x10928, 0x00961, 0x00a28, 0x0ca61, 0x00b8e, 0x0ea99, 0x00b37, 0x00a80, 0x1095f, 0x15488, 0x00a5f, 0x09488, 0x25465, 0x25c48,
+    0x00c4b, 0x18870, 0x18d96, 0x048a8, 0x1ce96, 0x108a8, 0x014c8, 0x014c1, 0x014ba, 0x014b9, 0x174a2, 0x15487, 0x094a2, 0x09487, 0x25464, 0x25c46,
+    0x1cd3c, 0x04986, 0x1c961, 0x069a1, 0x1afc0, 0x014cb, 0x0d4c7, 0x0d4c0, 0x1ef80, 0x114b8, 0x17488, 0x17480, 0x094a1, 0x09486, 0x29461, 0x29c3c,
+    0x00d70, 0x04caf, 0x18da8, 0x07e9b, 0x014cc, 0x014ca, 0x0d4c6, 0x07e91, 0x1f4b9, 0x114b7, 0x17487, 0x2be7c, 0x094a0, 0x09485, 0x29460, 0x15c3a,
+    0x04e3c, 0x1ca86, 0x1efc0, 0x0d4cb, 0x18a61, 0x1eaa1, 0x014c7, 0x014c0, 0x18f80, 0x014b8, 0x174a1, 0x29486, 0x0b488, 0x09480, 0x25461, 0x09c3c,
+    0x10e70, 0x1ccaf, 0x114cc, 0x0d4ca, 0x1cea8, 0x1fd9b, 0x014c6, 0x13d91, 0x074b9, 0x014b7, 0x174a0, 0x29485, 0x0b487, 0x25d7c, 0x25460, 0x09c3a,
+    0x00f86, 0x014cd, 0x114cb, 0x114c9, 0x054cb, 0x014c9, 0x014c5, 0x014bf, 0x194b8, 0x014b6, 0x17486, 0x1747f, 0x27486, 0x0947f, 0x2545d, 0x03c36,
+    0x00caf, 0x25bb7, 0x114ca, 0x07b85, 0x054ca, 0x1fb85, 0x014c4, 0x19b5c, 0x194b7, 0x014b5, 0x17485, 0x07e7a, 0x27485, 0x09d7a, 0x2545c, 0x03c31,
+    0x18f28, 0x06ac0, 0x1cb8e, 0x114c7, 0x04b8e, 0x054c7, 0x014c3, 0x014be, 0x18f5f, 0x214a1, 0x2f465, 0x2b461, 0x27465, 0x27461, 0x25452, 0x25c23,
+    0x0cd96, 0x194cc, 0x1d4c8, 0x114c6, 0x054c8, 0x054c6, 0x014c2, 0x014bd, 0x214a2, 0x214a0, 0x2f464, 0x2b460, 0x27464, 0x27460, 0x25451, 0x25c21,
+    0x10f61, 0x1d4cb, 0x12f99, 0x114c0, 0x194c7, 0x054c5, 0x1d4be, 0x114bc, 0x23488, 0x2f486, 0x2fc48, 0x17c3c, 0x2d461, 0x2745d, 0x2fc23, 0x17c1c,
+    0x0cda8, 0x1d4ca, 0x1d4c1, 0x1be91, 0x194c6, 0x054c4, 0x1d4bd, 0x07e8b, 0x23487, 0x2f485, 0x2fc46, 0x17c3a, 0x2d460, 0x2745c, 0x2fc21, 0x17c1a,
+    0x04f61, 0x194cb, 0x1d4c7, 0x1d4c5, 0x06f99, 0x054c0, 0x054be, 0x014bc, 0x21488, 0x21486, 0x2f461, 0x2f45d, 0x27c48, 0x27c3c, 0x27c23, 0x09c1c,
+    0x00ea8, 0x194ca, 0x1d4c6, 0x1d4c4, 0x054c1, 0x1fd91, 0x054bd, 0x1fd8b, 0x21487, 0x21485, 0x2f460, 0x2f45c, 0x27c46, 0x0bc3a, 0x27c21, 0x09c1a,
+    0x00fa1, 0x194c9, 0x1d4c0, 0x1d4bf, 0x194c0, 0x054bf, 0x194bc, 0x014bb, 0x21480, 0x2147f, 0x2fc3c, 0x2fc36, 0x21c3c, 0x27c36, 0x21c1c, 0x01c16,
+    0x0389b, 0x03b85, 0x0f891, 0x01b5c, 0x03891, 0x11b5c, 0x0388b, 0x01b25, 0x2d87c, 0x0187a, 0x23c3a, 0x1fc31, 0x21c3a, 0x07c31, 0x21c1a, 0x01c06,
+    0x00a12, 0x0083d, 0x0092a, 0x03763, 0x00a2a, 0x0f763, 0x0368f, 0x0372a, 0x00b3d, 0x01781, 0x0f463, 0x0363d, 0x03463, 0x0353d, 0x0342a, 0x03712,
+    0x18c4d, 0x18871, 0x01797, 0x09759, 0x0d797, 0x15759, 0x0178e, 0x25722, 0x01489, 0x0177e, 0x0f462, 0x0363b, 0x03462, 0x0f53b, 0x03429, 0x2570e,
+    0x18d48, 0x01788, 0x18965, 0x0375f, 0x0d799, 0x0f761, 0x0368e, 0x03728, 0x0d488, 0x01780, 0x1545f, 0x03637, 0x03461, 0x0353c, 0x15428, 0x03711,
+    0x04d77, 0x01783, 0x01793, 0x27f44, 0x0d795, 0x2b757, 0x0368c, 0x2571f, 0x0d487, 0x0177c, 0x1545e, 0x09632, 0x03460, 0x0f53a, 0x15427, 0x09f0b,
+    0x18e48, 0x0d788, 0x01799, 0x03761, 0x18a65, 0x1575f, 0x0358e, 0x15728, 0x01488, 0x0f780, 0x0f461, 0x0363c, 0x0345f, 0x03537, 0x03428, 0x15711,
+    0x10e77, 0x23783, 0x01795, 0x09757, 0x0d793, 0x2bf44, 0x0d78c, 0x2971f, 0x01487, 0x0f77c, 0x0f460, 0x0363a, 0x0345e, 0x29532, 0x03427, 0x29f0b,
+    0x0179e, 0x01786, 0x01798, 0x0375d, 0x0d798, 0x1575d, 0x0368d, 0x03726, 0x01486, 0x0177f, 0x1545d, 0x03636, 0x0345d, 0x03536, 0x03426, 0x03710,
+    0x0179b, 0x2177c, 0x01791, 0x2df3a, 0x0d791, 0x2ff3a, 0x0178b, 0x2df1a, 0x01485, 0x0177a, 0x1545c, 0x09631, 0x0345c, 0x29531, 0x03425, 0x03f06,
+    0x18f4d, 0x01789, 0x0d497, 0x03762, 0x01497, 0x0f762, 0x0148e, 0x03729, 0x18b71, 0x0147e, 0x15459, 0x0f63b, 0x09459, 0x0353b, 0x25422, 0x2540e,
+    0x0179d, 0x01784, 0x01796, 0x09758, 0x0d796, 0x15758, 0x0178d, 0x25721, 0x01484, 0x0177d, 0x15458, 0x03639, 0x09458, 0x03539, 0x25421, 0x2570d,
+    0x10d77, 0x01787, 0x0d493, 0x0375e, 0x01495, 0x0f760, 0x0f68c, 0x03727, 0x23483, 0x0f47c, 0x2bc44, 0x29632, 0x09457, 0x0353a, 0x2941f, 0x29c0b,
+    0x0179c, 0x01782, 0x01792, 0x27f42, 0x0d794, 0x2b756, 0x0368b, 0x2571e, 0x23482, 0x0177b, 0x2bc42, 0x25630, 0x09456, 0x03538, 0x2941e, 0x03e09,
+    0x04e77, 0x0d787, 0x0d495, 0x03760, 0x01493, 0x1575e, 0x0358c, 0x15727, 0x01483, 0x0147c, 0x2b457, 0x0f63a, 0x27c44, 0x09532, 0x2541f, 0x09c0b,
+    0x0d79c, 0x23782, 0x01794, 0x09756, 0x0d792, 0x2bf42, 0x0358b, 0x2971e, 0x01482, 0x0f77b, 0x2b456, 0x03638, 0x27c42, 0x25530, 0x2541e, 0x03d09,
+    0x0149b, 0x01785, 0x0d491, 0x0375c, 0x01491, 0x1575c, 0x0148b, 0x03725, 0x2147c, 0x0147a, 0x2fc3a, 0x29631, 0x2dc3a, 0x09531, 0x2dc1a, 0x03c06,
+    0x0179a, 0x2177b, 0x01790, 0x21f38, 0x0d790, 0x2ff38, 0x0368a, 0x21f18, 0x2147b, 0x01779, 0x2fc38, 0x2562f, 0x21c38, 0x2552f, 0x21c18, 0x01c03,
+    0x10d02, 0x26d2e, 0x2ed09, 0x2e133, 0x26f2e, 0x12167, 0x2e338, 0x12168, 0x2ef09, 0x2e138, 0x1270d, 0x2e139, 0x2e333, 0x12368, 0x2e339, 0x12169,
+    0x08d09, 0x08433, 0x2a51a, 0x26d3f, 0x08638, 0x14468, 0x1075c, 0x1056e, 0x1471e, 0x1e556, 0x12521, 0x1e558, 0x02756, 0x0c772, 0x10760, 0x10575,
+    0x16d04, 0x26d30, 0x2a50a, 0x22134, 0x2233e, 0x10568, 0x1e342, 0x1216a, 0x1670b, 0x2213a, 0x1250e, 0x2213b, 0x2233f, 0x1216b, 0x1e343, 0x1216c,
+    0x2850a, 0x08434, 0x2a51b, 0x26d41, 0x02642, 0x0c56a, 0x1075e, 0x1056f, 0x1651f, 0x1e557, 0x12522, 0x1e559, 0x0c758, 0x10573, 0x10762, 0x10576,
+    0x08f09, 0x08438, 0x1671e, 0x02556, 0x08633, 0x14668, 0x1e756, 0x10772, 0x2a71a, 0x1055c, 0x12721, 0x10560, 0x26f3f, 0x1076e, 0x1e758, 0x10775,
+    0x1470d, 0x08439, 0x14521, 0x02558, 0x08639, 0x14669, 0x0c760, 0x0c575, 0x14721, 0x0c560, 0x10751, 0x10564, 0x02758, 0x0c775, 0x10764, 0x10778,
+    0x2870b, 0x0843a, 0x1451f, 0x02557, 0x0263f, 0x0c76b, 0x10758, 0x0c573, 0x1671c, 0x1055d, 0x12723, 0x10561, 0x02754, 0x10770, 0x1e75a, 0x10777,
+    0x1450e, 0x0843b, 0x14522, 0x02559, 0x02643, 0x0e46c, 0x0c762, 0x0c576, 0x14723, 0x0c561, 0x10552, 0x10565, 0x0275a, 0x0c777, 0x10766, 0x05f4e,
+    0x16f04, 0x2213e, 0x1650b, 0x2213f, 0x26f30, 0x10768, 0x2233a, 0x1236b, 0x2a70a, 0x1e142, 0x1270e, 0x1e143, 0x22334, 0x1236a, 0x2233b, 0x1236c,
+    0x2850b, 0x0243f, 0x1651c, 0x02554, 0x0863a, 0x0e66b, 0x1075d, 0x10570, 0x1471f, 0x10558, 0x12523, 0x1e55a, 0x02757, 0x0c773, 0x10761, 0x10577,
+    0x16705, 0x22140, 0x1650c, 0x22141, 0x22340, 0x10769, 0x1e344, 0x1056c, 0x1670c, 0x1e144, 0x1270f, 0x1e145, 0x22341, 0x1076c, 0x1e345, 0x1216d,
+    0x2850c, 0x02441, 0x1651d, 0x02555, 0x02644, 0x0c56c, 0x1075f, 0x10571, 0x14720, 0x10559, 0x12524, 0x1e55b, 0x0c759, 0x0c774, 0x10763, 0x1de45,
+    0x2870a, 0x02442, 0x1671f, 0x0c558, 0x08634, 0x0e66a, 0x1e757, 0x10773, 0x2a71b, 0x1055e, 0x12722, 0x10562, 0x26f41, 0x1076f, 0x1e759, 0x10776,
+    0x1470e, 0x02443, 0x14523, 0x0255a, 0x0863b, 0x0e66c, 0x0c761, 0x0c577, 0x14722, 0x0c562, 0x10752, 0x10566, 0x02759, 0x0c776, 0x10765, 0x05d4e,
+    0x2870c, 0x02444, 0x16720, 0x0c559, 0x02641, 0x0c76c, 0x10759, 0x10774, 0x1671d, 0x1055f, 0x12724, 0x10563, 0x02755, 0x10771, 0x1e75b, 0x1dc45,
+    0x1470f, 0x02445, 0x14524, 0x0255b, 0x02645, 0x0e66d, 0x0c763, 0x01b45, 0x14724, 0x0c563, 0x10753, 0x11a24, 0x0275b, 0x01945, 0x11824, 0x11a0f,
+    0x04d09, 0x06d33, 0x1e91a, 0x1ad3f, 0x04a38, 0x10868, 0x14b5c, 0x1496e, 0x10b1e, 0x2a956, 0x12921, 0x2a958, 0x00b56, 0x0eb72, 0x14b60, 0x14975,
+    0x00c1a, 0x0ad3f, 0x26d26, 0x26d4b, 0x12e5c, 0x12c6e, 0x2e1bf, 0x27fba, 0x2ed8b, 0x20594, 0x2058d, 0x20596, 0x2e1c4, 0x2e1d1, 0x2e1c5, 0x01fa2,
+    0x06d19, 0x06d39, 0x20d1f, 0x20d43, 0x2a190, 0x2a1a4, 0x2a191, 0x2a1a5, 0x22927, 0x2e960, 0x2e929, 0x2e962, 0x2a194, 0x2a1a6, 0x2a195, 0x2a1a7,
+    0x0ad1f, 0x0ad43, 0x26d28, 0x26d4d, 0x28491, 0x284a5, 0x221c0, 0x07f89, 0x2c58c, 0x20595, 0x2058e, 0x20597, 0x221c6, 0x221d2, 0x221c7, 0x05f62,
+    0x0ec1e, 0x16c56, 0x08d8b, 0x0a594, 0x1ce56, 0x16c72, 0x084c4, 0x084d1, 0x04f8b, 0x065c4, 0x205bd, 0x1a5c6, 0x1ae94, 0x04ad1, 0x26bc6, 0x0dda9,
+    0x14c21, 0x28c58, 0x2658d, 0x0a596, 0x16e60, 0x16c75, 0x084c5, 0x1ffa2, 0x265bd, 0x065c6, 0x265c2, 0x065c8, 0x2cec6, 0x11da9, 0x045d8, 0x11f64,
+    0x02c27, 0x24c60, 0x2658c, 0x0a595, 0x28494, 0x284a6, 0x084c6, 0x084d2, 0x265bc, 0x065c5, 0x205be, 0x1a5c7, 0x163d6, 0x11dcc, 0x163d7, 0x01e95,
+    0x08c29, 0x24c62, 0x2658e, 0x0a597, 0x28495, 0x284a7, 0x084c7, 0x19f62, 0x265be, 0x065c7, 0x265c3, 0x07a8e, 0x146d7, 0x1db95, 0x07abe, 0x05f29,
+    0x10f30, 0x26d68, 0x1e93a, 0x2c56b, 0x06e7b, 0x161aa, 0x16b85, 0x161ab, 0x12942, 0x2e172, 0x12946, 0x2e173, 0x1ab82, 0x161ac, 0x2ab87, 0x161ad,
+    0x02c3a, 0x2656b, 0x26d5d, 0x26570, 0x28e85, 0x284ab, 0x221c9, 0x07fb9, 0x2ed91, 0x205a6, 0x22198, 0x205a8, 0x1e1ca, 0x1e1d3, 0x1e1cb, 0x01f87,
+    0x02c40, 0x26569, 0x22944, 0x2c56c, 0x1619a, 0x161b0, 0x1619b, 0x161b1, 0x2294c, 0x2e175, 0x2e94e, 0x2e176, 0x1619c, 0x161b2, 0x13877, 0x11e6c,
+    0x08c44, 0x2656c, 0x26d5f, 0x26571, 0x2849b, 0x284b1, 0x17aa1, 0x07a7e, 0x2ed93, 0x205a7, 0x13a65, 0x1da59, 0x178a8, 0x15aa5, 0x13a61, 0x19e3b,
+    0x0ec42, 0x24472, 0x24d91, 0x0a5a6, 0x06e82, 0x144ac, 0x024ca, 0x024d3, 0x06e92, 0x065d1, 0x20bc1, 0x1a5d2, 0x06e9c, 0x05dae, 0x1b8a8, 0x05c73,
+    0x14c46, 0x24473, 0x08498, 0x0a5a8, 0x28e87, 0x144ad, 0x024cb, 0x1df87, 0x26ec1, 0x065d2, 0x265d0, 0x07fc1, 0x078a8, 0x19973, 0x19c98, 0x11d46,
+    0x02c4c, 0x24475, 0x24d93, 0x0a5a7, 0x1449c, 0x144b2, 0x158a8, 0x17aa5, 0x178a3, 0x178a2, 0x13866, 0x13862, 0x0789f, 0x05884, 0x1d85a, 0x1dc43,
+    0x08c4e, 0x24476, 0x15a65, 0x01a59, 0x0f877, 0x0db6c, 0x0fa61, 0x05b3b, 0x15866, 0x0f862, 0x11a52, 0x11a22, 0x0185a, 0x01943, 0x11823, 0x11a0e,
+    0x1ed04, 0x1ad30, 0x22d0a, 0x2e134, 0x2e33e, 0x14968, 0x2a342, 0x1616a, 0x1eb0b, 0x2e13a, 0x1290e, 0x2e13b, 0x2e33f, 0x1616b, 0x2a343, 0x1616c,
+    0x08d19, 0x26d39, 0x2cd1f, 0x2cd43, 0x1e190, 0x1e1a4, 0x1e191, 0x1e1a5, 0x2e527, 0x22560, 0x2e529, 0x22562, 0x1e194, 0x1e1a6, 0x1e195, 0x1e1a7,
+    0x2ed07, 0x20d32, 0x2ed0c, 0x2e135, 0x2e34a, 0x1216e, 0x1234c, 0x1216f, 0x2e511, 0x2e13c, 0x2e512, 0x2e13d, 0x2e34b, 0x12170, 0x1234d, 0x12171,
+    0x24d1b, 0x26d3b, 0x2e520, 0x2cd45, 0x1e192, 0x1c5a5, 0x1e193, 0x1be74, 0x2e528, 0x22561, 0x2e52a, 0x22563, 0x1e196, 0x1e1a8, 0x1e197, 0x1be59,
+    0x14d30, 0x2457b, 0x16742, 0x26582, 0x1af68, 0x1e3aa, 0x22372, 0x123ac, 0x2a73a, 0x1e585, 0x12746, 0x1e587, 0x2276b, 0x1e3ab, 0x22373, 0x123ad,
+    0x08d39, 0x0857d, 0x28558, 0x26584, 0x127a4, 0x1c5b0, 0x105a6, 0x1c5b2, 0x16560, 0x1e5a0, 0x12564, 0x1e5a2, 0x127a6, 0x1c5b3, 0x127a9, 0x0df75,
+    0x28d32, 0x2457c, 0x16744, 0x26583, 0x2276e, 0x1c5ab, 0x1e775, 0x1c5ad, 0x1673c, 0x1e586, 0x12748, 0x1e588, 0x22770, 0x1e3af, 0x1e777, 0x23e83,
+    0x24d3b, 0x0857e, 0x28559, 0x1ba71, 0x105a5, 0x1c5b1, 0x105a7, 0x1ba6c, 0x16561, 0x1e5a1, 0x12565, 0x1be5f, 0x127a8, 0x1db9b, 0x23e93, 0x05f44,
+    0x16d0a, 0x22142, 0x2ed0e, 0x22143, 0x2e342, 0x12172, 0x2e346, 0x12173, 0x22f0e, 0x22146, 0x2e513, 0x22147, 0x2e343, 0x16373, 0x2e347, 0x12174,
+    0x28d1f, 0x2c558, 0x2e523, 0x2c55a, 0x12791, 0x1c5a6, 0x1e198, 0x1c5a8, 0x16529, 0x22564, 0x2e52b, 0x22566, 0x12795, 0x1e1a9, 0x1e199, 0x0dc93,
+    0x16d0c, 0x22144, 0x2e50f, 0x22145, 0x2234c, 0x12175, 0x1e34e, 0x12176, 0x16512, 0x22148, 0x2e514, 0x22149, 0x2234d, 0x12177, 0x1e34f, 0x1fa45,
+    0x2a520, 0x2c559, 0x2e524, 0x2c55b, 0x12793, 0x1c5a7, 0x2fa65, 0x21a59, 0x1652a, 0x22565, 0x2e52c, 0x23a24, 0x12797, 0x17893, 0x1fa2a, 0x1de20,
+    0x2a734, 0x24582, 0x16743, 0x1e584, 0x2276a, 0x1e3ac, 0x1e773, 0x1e3ae, 0x2a73b, 0x12587, 0x12747, 0x1e589, 0x2276c, 0x1e3ad, 0x22374, 0x01c6f,
+    0x28d43, 0x08584, 0x1655a, 0x0859f, 0x127a5, 0x105b2, 0x105a8, 0x1df9c, 0x16562, 0x105a2, 0x12566, 0x1e5a3, 0x127a7, 0x19975, 0x19c93, 0x01d4c,
+    0x16735, 0x24583, 0x16745, 0x2fa71, 0x2276f, 0x105ad, 0x1e776, 0x2fa6f, 0x1673d, 0x12588, 0x12749, 0x1fa3d, 0x22771, 0x19883, 0x13a45, 0x1dc35,
+    0x28d45, 0x15a71, 0x1655b, 0x01a55, 0x15a74, 0x0fa6c, 0x15a59, 0x01b41, 0x16563, 0x1585f, 0x13a24, 0x1fa1d, 0x0f859, 0x01944, 0x13a20, 0x1da0c,
+    0x18d0a, 0x1ad34, 0x1e91b, 0x1ad41, 0x00a42, 0x0e96a, 0x14b5e, 0x1496f, 0x1291f, 0x2a957, 0x12922, 0x2a959, 0x0eb58, 0x14973, 0x14b62, 0x09e76,
+    0x06d1f, 0x06d43, 0x1ad28, 0x1ad4d, 0x1c891, 0x1c8a5, 0x2e1c0, 0x27f89, 0x22d8c, 0x2c995, 0x2098e, 0x27697, 0x2e1c6, 0x2e1d2, 0x2e1c7, 0x09f62,
+    0x18d1b, 0x1ad3b, 0x20d20, 0x20d45, 0x2a192, 0x289a5, 0x2a193, 0x2d674, 0x22928, 0x2e961, 0x2e92a, 0x2de63, 0x2a196, 0x2a1a8, 0x2a197, 0x27e59,
+    0x0ad22, 0x0ad47, 0x20d2a, 0x20d4f, 0x2e1c1, 0x2e1cf, 0x21699, 0x0be47, 0x2ed8e, 0x20599, 0x2e18f, 0x21e2a, 0x2e1c8, 0x2f2c1, 0x2fe8e, 0x0be22,
+    0x0ce42, 0x0ac82, 0x26592, 0x2659c, 0x1ce72, 0x1ecac, 0x26bd1, 0x276ae, 0x18f91, 0x205ca, 0x205c1, 0x276a8, 0x06ba6, 0x0ddd3, 0x2d6d2, 0x09e73,
+    0x02c58, 0x26c84, 0x26596, 0x2769d, 0x12ca6, 0x1ecb2, 0x1b6cc, 0x27f84, 0x2c5c6, 0x1a5cc, 0x216c8, 0x27696, 0x1c1da, 0x13fa6, 0x2d6c6, 0x03f58,
+    0x02c5e, 0x0ac87, 0x26593, 0x2d677, 0x16cd1, 0x232d3, 0x232a9, 0x27e73, 0x2c5c0, 0x232cb, 0x23299, 0x2de61, 0x232cc, 0x232ca, 0x2fe95, 0x09e57,
+    0x08c62, 0x26c89, 0x26597, 0x1be4d, 0x2f2d2, 0x1dba5, 0x2da95, 0x07e43, 0x2f2c7, 0x2f2c0, 0x21a8e, 0x1be28, 0x2f2c6, 0x1db91, 0x23e8c, 0x07e1f,
+    0x10f34, 0x2cd6a, 0x1e93b, 0x2e96c, 0x18b82, 0x2a1ac, 0x16b87, 0x2a1ad, 0x12943, 0x2a973, 0x12947, 0x2e174, 0x16b84, 0x161ae, 0x16b89, 0x03e6f,
+    0x08d57, 0x26d73, 0x2cd61, 0x2c577, 0x221ca, 0x221d3, 0x221cb, 0x0bf87, 0x2ed95, 0x221a9, 0x22199, 0x27693, 0x221cc, 0x17fd1, 0x2d6c0, 0x03f5e,
+    0x22941, 0x2cd6c, 0x22945, 0x2e16d, 0x2a19c, 0x2a1b2, 0x2f277, 0x2de6c, 0x2294d, 0x2e177, 0x2fa4f, 0x23a45, 0x1619d, 0x2b29c, 0x23a4d, 0x23a41,
+    0x26d59, 0x2c574, 0x2cd63, 0x21e45, 0x2b2a8, 0x29aa5, 0x2fa61, 0x1be3b, 0x2b297, 0x2b293, 0x2fa2a, 0x21e20, 0x2b296, 0x2b292, 0x23a28, 0x19e1b,
+    0x02d6a, 0x265ac, 0x24da5, 0x276b2, 0x04eac, 0x170d9, 0x216d3, 0x276ac, 0x18fa5, 0x205d3, 0x216cf, 0x25ea5, 0x1abb2, 0x05dac, 0x19ca5, 0x01c6a,
+    0x08d73, 0x265ae, 0x265a8, 0x2769c, 0x0ced3, 0x1ffac, 0x216ca, 0x0bf82, 0x2c5d2, 0x278d1, 0x216c1, 0x27692, 0x078a6, 0x1dd72, 0x19c91, 0x0dd42,
+    0x02d6f, 0x2b2ad, 0x2f274, 0x2fa6c, 0x172ae, 0x2b2ac, 0x2ba73, 0x2de6a, 0x17889, 0x17887, 0x13a47, 0x1fa3b, 0x17884, 0x19882, 0x13a43, 0x11c34,
+    0x08d76, 0x15a6f, 0x2ba59, 0x1be41, 0x15a73, 0x0fa6a, 0x2ba57, 0x1be34, 0x15862, 0x1585e, 0x13a22, 0x1fa1b, 0x0f858, 0x01942, 0x13a1f, 0x19e0a,
+    0x04f09, 0x04838, 0x12b1e, 0x00956, 0x06f33, 0x10a68, 0x2ab56, 0x14b72, 0x1eb1a, 0x1495c, 0x12b21, 0x14960, 0x1af3f, 0x14b6e, 0x2ab58, 0x14b75,
+    0x0cc1e, 0x1cc56, 0x04d8b, 0x1ac94, 0x16e56, 0x12c72, 0x067c4, 0x048d1, 0x08f8b, 0x086c4, 0x207bd, 0x269c6, 0x0a794, 0x086d1, 0x1a7c6, 0x0fda9,
+    0x10d30, 0x06c7b, 0x12b42, 0x1a982, 0x26f68, 0x163aa, 0x2e372, 0x163ac, 0x1eb3a, 0x16985, 0x12b46, 0x2a987, 0x2c76b, 0x163ab, 0x2e373, 0x163ad,
+    0x0ee42, 0x06c82, 0x06c92, 0x06c9c, 0x24672, 0x146ac, 0x067d1, 0x05fae, 0x24f91, 0x026ca, 0x209c1, 0x1baa8, 0x0a7a6, 0x026d3, 0x1a7d2, 0x05e73,
+    0x00e1a, 0x12c5c, 0x2ef8b, 0x2e3c4, 0x0af3f, 0x12e6e, 0x20794, 0x2e3d1, 0x26f26, 0x2e3bf, 0x2078d, 0x2e3c5, 0x26f4b, 0x27dba, 0x20796, 0x01da2,
+    0x14e21, 0x16c60, 0x267bd, 0x2ccc6, 0x28e58, 0x16e75, 0x067c6, 0x13da9, 0x2678d, 0x086c5, 0x267c2, 0x047d8, 0x0a796, 0x1fda2, 0x067c8, 0x11d64,
+    0x02e3a, 0x28c85, 0x2ef91, 0x1e3ca, 0x2676b, 0x286ab, 0x207a6, 0x1e3d3, 0x26f5d, 0x223c9, 0x22398, 0x1e3cb, 0x26770, 0x07db9, 0x207a8, 0x01d87,
+    0x14e46, 0x28c87, 0x26cc1, 0x07aa8, 0x24673, 0x146ad, 0x067d2, 0x19b73, 0x08698, 0x026cb, 0x267d0, 0x19e98, 0x0a7a8, 0x1dd87, 0x07dc1, 0x11f46,
+    0x06f19, 0x2a390, 0x22b27, 0x2a394, 0x06f39, 0x2a3a4, 0x2eb60, 0x2a3a6, 0x20f1f, 0x2a391, 0x2eb29, 0x2a395, 0x20f43, 0x2a3a5, 0x2eb62, 0x2a3a7,
+    0x02e27, 0x28694, 0x267bc, 0x161d6, 0x24e60, 0x286a6, 0x067c5, 0x11fcc, 0x2678c, 0x086c6, 0x207be, 0x161d7, 0x0a795, 0x086d2, 0x1a7c7, 0x01c95,
+    0x02e40, 0x1639a, 0x22b4c, 0x1639c, 0x26769, 0x163b0, 0x2e375, 0x163b2, 0x22b44, 0x1639b, 0x2eb4e, 0x13a77, 0x2c76c, 0x163b1, 0x2e376, 0x11c6c,
+    0x02e4c, 0x1469c, 0x17aa3, 0x07a9f, 0x24675, 0x146b2, 0x17aa2, 0x05a84, 0x24f93, 0x15aa8, 0x13a66, 0x1da5a, 0x0a7a7, 0x178a5, 0x13a62, 0x1de43,
+    0x0af1f, 0x28691, 0x2c78c, 0x223c6, 0x0af43, 0x286a5, 0x20795, 0x223d2, 0x26f28, 0x223c0, 0x2078e, 0x223c7, 0x26f4d, 0x07d89, 0x20797, 0x05d62,
+    0x08e29, 0x28695, 0x267be, 0x047d7, 0x24e62, 0x286a7, 0x067c7, 0x1d995, 0x2678e, 0x086c7, 0x267c3, 0x078be, 0x0a797, 0x19d62, 0x0788e, 0x05d29,
+    0x08e44, 0x2869b, 0x2ef93, 0x17aa8, 0x2676c, 0x286b1, 0x207a7, 0x158a5, 0x26f5f, 0x178a1, 0x13865, 0x13861, 0x26771, 0x0787e, 0x1d859, 0x19c3b,
+    0x08e4e, 0x0fa77, 0x15a66, 0x01a5a, 0x24676, 0x0d96c, 0x0fa62, 0x01b43, 0x15865, 0x0f861, 0x11852, 0x11a23, 0x01859, 0x0593b, 0x11822, 0x1180e,
+    0x10c0d, 0x04839, 0x10921, 0x00958, 0x04a39, 0x10a69, 0x0eb60, 0x0e975, 0x10b21, 0x0e960, 0x10b51, 0x14964, 0x00b58, 0x0eb75, 0x14b64, 0x15d78,
+    0x10c21, 0x1cc58, 0x06c8d, 0x1ac96, 0x12e60, 0x12c75, 0x048c5, 0x2bfa2, 0x06ebd, 0x0a9c6, 0x269c2, 0x27fc8, 0x20ec6, 0x15da9, 0x09dd8, 0x15f64,
+    0x04d39, 0x06c7d, 0x1c958, 0x06984, 0x16ca4, 0x16cb0, 0x149a6, 0x29fb2, 0x12960, 0x169a0, 0x12964, 0x2a9a2, 0x16ba6, 0x29db3, 0x16ba9, 0x0ff75,
+    0x00c58, 0x06c84, 0x06c96, 0x06c9d, 0x16ca6, 0x2acb2, 0x27acc, 0x07f84, 0x209c6, 0x269cc, 0x21ac8, 0x07f96, 0x281da, 0x17fa6, 0x21ac6, 0x01f58,
+    0x10e21, 0x12c60, 0x06cbd, 0x20cc6, 0x1ce58, 0x12e75, 0x0abc6, 0x17da9, 0x06e8d, 0x04ac5, 0x26bc2, 0x09fd8, 0x1ae96, 0x2bda2, 0x27dc8, 0x15d64,
+    0x10c51, 0x12c64, 0x26cc2, 0x20cc8, 0x12e64, 0x12c78, 0x2ecd8, 0x13f64, 0x26ec2, 0x2ffd8, 0x110dc, 0x27fc2, 0x21dc8, 0x13d64, 0x27dc2, 0x11d51,
+    0x0ec60, 0x16ca0, 0x0acc6, 0x26ccc, 0x14ea6, 0x16cb3, 0x2a3da, 0x15fa6, 0x04fc5, 0x163db, 0x2fad8, 0x05ec5, 0x27dcc, 0x17da0, 0x0bdc6, 0x0fd60,
+    0x14c64, 0x2aca2, 0x26cc8, 0x1bf96, 0x16ca9, 0x13f75, 0x0bac6, 0x1df58, 0x08ed8, 0x05bc5, 0x27ac2, 0x07f8d, 0x21dc6, 0x13d60, 0x07dbd, 0x11f21,
+    0x04f39, 0x14ca4, 0x12b60, 0x169a6, 0x06e7d, 0x16eb0, 0x16ba0, 0x29fb3, 0x1cb58, 0x14ba6, 0x12b64, 0x14ba9, 0x06b84, 0x29db2, 0x2aba2, 0x0fd75,
+    0x0ee60, 0x14ca6, 0x04dc5, 0x27fcc, 0x16ea0, 0x17fb3, 0x170db, 0x17fa0, 0x0aec6, 0x2b0da, 0x2e9d8, 0x0bfc6, 0x26ecc, 0x15da6, 0x05cc5, 0x0ff60,
+    0x10d69, 0x28cb0, 0x12975, 0x2bab2, 0x28eb0, 0x170b4, 0x17ab3, 0x29fb0, 0x12b75, 0x169b3, 0x13a78, 0x13a75, 0x2abb2, 0x29db0, 0x13875, 0x11c69,
+    0x0ec75, 0x28cb2, 0x2baa2, 0x07a84, 0x28eb3, 0x17fb0, 0x17aa0, 0x07f7d, 0x15aa9, 0x15aa6, 0x13a64, 0x1da58, 0x178a6, 0x15da4, 0x13a60, 0x05e39,
+    0x00e58, 0x16ea6, 0x20bc6, 0x290da, 0x06e84, 0x2bdb2, 0x26bcc, 0x17da6, 0x06e96, 0x278cc, 0x20bc8, 0x218c6, 0x07d9d, 0x07d84, 0x07d96, 0x01d58,
+    0x14e64, 0x14ca9, 0x08cd8, 0x21fc6, 0x2aea2, 0x13d75, 0x059c5, 0x13f60, 0x26ec8, 0x0b8c6, 0x278c2, 0x07fbd, 0x1bd96, 0x1dd58, 0x07d8d, 0x11d21,
+    0x0ee75, 0x28cb3, 0x17aa9, 0x17aa6, 0x28eb2, 0x17db0, 0x158a6, 0x17da4, 0x2b8a2, 0x178a0, 0x13864, 0x13860, 0x07884, 0x07d7d, 0x1d858, 0x05c39,
+    0x14c78, 0x0fa75, 0x15a64, 0x01a58, 0x0f875, 0x11b69, 0x0fa60, 0x05b39, 0x15864, 0x0f860, 0x11a51, 0x11a21, 0x01858, 0x05939, 0x11821, 0x11d0d,
+    0x1cb0b, 0x0483a, 0x1091f, 0x00957, 0x00a3f, 0x0eb6b, 0x14b58, 0x0e973, 0x1eb1c, 0x1495d, 0x12b23, 0x14961, 0x00b54, 0x14b70, 0x2ab5a, 0x14b77,
+    0x00c27, 0x18c60, 0x18d8c, 0x06995, 0x10e94, 0x1c8a6, 0x048c6, 0x01fd2, 0x14fbc, 0x269c5, 0x209be, 0x25ec7, 0x1e3d6, 0x15dcc, 0x123d7, 0x03e95,
+    0x1cd32, 0x1897c, 0x12b44, 0x1a983, 0x2eb6e, 0x289ab, 0x2ab75, 0x2dead, 0x1eb3c, 0x16986, 0x12b48, 0x2fe88, 0x2eb70, 0x163af, 0x2ab77, 0x2fe83,
+    0x00c5e, 0x06c87, 0x1a993, 0x21a77, 0x1ecd1, 0x2f2d3, 0x2f2a9, 0x1be73, 0x14fc0, 0x2f2cb, 0x2f299, 0x21e61, 0x2f2cc, 0x2f2ca, 0x23e95, 0x05e57,
+    0x00e3a, 0x1cc85, 0x22f91, 0x2a3ca, 0x18e6b, 0x1caab, 0x2cba6, 0x2a3d3, 0x1af5d, 0x2e3c9, 0x2e398, 0x2a3cb, 0x1ab70, 0x09db9, 0x2cba8, 0x03d87,
+    0x0cc60, 0x1eca0, 0x06cc6, 0x1accc, 0x10ea6, 0x1ecb3, 0x1e3da, 0x11fa6, 0x08fc5, 0x1e3db, 0x2f6d8, 0x09ec5, 0x1bdcc, 0x1fda0, 0x07dc6, 0x0dd60,
+    0x0ef7c, 0x00cb7, 0x2ef9b, 0x2f2af, 0x20fab, 0x2e3d4, 0x2e3b3, 0x21eab, 0x2ef86, 0x2e3cd, 0x2e39e, 0x2fe86, 0x2e3af, 0x01db7, 0x2fe9b, 0x0fe7c,
+    0x02c87, 0x08cb9, 0x2daa8, 0x1ba70, 0x2b2d3, 0x1dbab, 0x2daa6, 0x19f6b, 0x2b2cb, 0x2f2c9, 0x2f298, 0x1be5d, 0x2b2ca, 0x1dd85, 0x23e91, 0x01f3a,
+    0x1cf1f, 0x16991, 0x1eb29, 0x16995, 0x20b58, 0x28ba6, 0x2eb64, 0x2a3a9, 0x22b23, 0x2a398, 0x2eb2b, 0x2a399, 0x20b5a, 0x28ba8, 0x2eb66, 0x0fe93,
+    0x0cd8c, 0x02cc6, 0x1cdbe, 0x2a1d7, 0x00ec6, 0x170da, 0x1e3d8, 0x01fc6, 0x28fbe, 0x170d8, 0x170d5, 0x29ebe, 0x2b0d7, 0x03dc6, 0x1dcbe, 0x0dc8c,
+    0x1eb44, 0x1699b, 0x1eb4e, 0x2fa77, 0x2eb75, 0x163b3, 0x2e378, 0x2fa75, 0x22b48, 0x1639e, 0x2fa50, 0x23a48, 0x2eb77, 0x1789b, 0x1fa4e, 0x1fa44,
+    0x0ef93, 0x29aa8, 0x2fa66, 0x21a5a, 0x2b2a9, 0x29aa6, 0x2fa64, 0x21a58, 0x2b299, 0x2b298, 0x2fa2b, 0x23a23, 0x17895, 0x17891, 0x1fa29, 0x1de1f,
+    0x04f57, 0x2e3ca, 0x22f95, 0x2e3cc, 0x1af73, 0x2e3d3, 0x2e3a9, 0x1fdd1, 0x20f61, 0x2e3cb, 0x2e399, 0x15ec0, 0x20b77, 0x07d87, 0x1b893, 0x01d5e,
+    0x02f95, 0x14ccc, 0x132d7, 0x1f2d6, 0x00ed2, 0x1d9a6, 0x059c6, 0x11f94, 0x24fc7, 0x278c5, 0x218be, 0x15ebc, 0x07895, 0x19d60, 0x19c8c, 0x01d27,
+    0x2ef83, 0x172af, 0x2ba77, 0x2fa70, 0x2cfad, 0x298ab, 0x2ba75, 0x2fa6e, 0x2ef88, 0x17886, 0x13a48, 0x1fa3c, 0x1b883, 0x1987c, 0x13a44, 0x1dc32,
+    0x15a77, 0x15a70, 0x2ba5a, 0x01a54, 0x0f873, 0x0fa6b, 0x15a58, 0x01b3f, 0x15861, 0x1585d, 0x13a23, 0x1fa1c, 0x01857, 0x0593a, 0x1181f, 0x1da0b,
+    0x1090e, 0x0483b, 0x10922, 0x00959, 0x00a43, 0x0c86c, 0x0eb62, 0x25776, 0x10b23, 0x0e961, 0x10952, 0x14965, 0x00b5a, 0x0eb77, 0x14b66, 0x09f4e,
+    0x04c29, 0x18c62, 0x0698e, 0x0b697, 0x1c895, 0x297a7, 0x076c7, 0x25f62, 0x069be, 0x097c7, 0x276c3, 0x2768e, 0x056d7, 0x29795, 0x276be, 0x09f29,
+    0x18d3b, 0x0697e, 0x1c959, 0x27671, 0x149a5, 0x297b1, 0x216a7, 0x2766c, 0x12961, 0x169a1, 0x12965, 0x27e5f, 0x16ba8, 0x2979b, 0x2fe93, 0x09f44,
+    0x04c62, 0x06c89, 0x21697, 0x27e4d, 0x232d2, 0x297a5, 0x21695, 0x0be43, 0x232c7, 0x232c0, 0x2168e, 0x27e28, 0x232c6, 0x29791, 0x2d68c, 0x0be1f,
+    0x10e46, 0x1cc87, 0x06cc1, 0x0b6a8, 0x18a73, 0x157ad, 0x076d2, 0x25773, 0x18f98, 0x037cb, 0x276d0, 0x09798, 0x06ba8, 0x29d87, 0x27dc1, 0x15f46,
+    0x10c64, 0x1eca2, 0x076c8, 0x0b696, 0x12ca9, 0x17f75, 0x076c6, 0x29f58, 0x056d8, 0x097c5, 0x276c2, 0x2768d, 0x2ddc6, 0x17d60, 0x276bd, 0x15f21,
+    0x00c87, 0x06cb9, 0x216a8, 0x27670, 0x1f2d3, 0x297ab, 0x216a6, 0x2766b, 0x1f2cb, 0x232c9, 0x23298, 0x27e5d, 0x1f2ca, 0x29d85, 0x2fe91, 0x03f3a,
+    0x00ca2, 0x26cba, 0x21696, 0x27e4b, 0x2f2d1, 0x13f6e, 0x21694, 0x0be3f, 0x2f2c5, 0x2f2bf, 0x2168d, 0x27e26, 0x2f2c4, 0x13d5c, 0x2fe8b, 0x01f1a,
+    0x1cf43, 0x169a5, 0x12b62, 0x0b6a7, 0x04b84, 0x157b2, 0x16ba2, 0x25775, 0x1cb5a, 0x14ba8, 0x12b66, 0x25e93, 0x06b9f, 0x1579c, 0x16ba3, 0x03f4c,
+    0x00d95, 0x097d2, 0x1b6c7, 0x0b695, 0x10ecc, 0x297a6, 0x076c5, 0x25f60, 0x170d7, 0x097c6, 0x216be, 0x2768c, 0x170d6, 0x29794, 0x276bc, 0x03f27,
+    0x10d6c, 0x172b1, 0x2f276, 0x2d66c, 0x172b2, 0x172b0, 0x2f275, 0x27669, 0x12b77, 0x1729b, 0x2fa4e, 0x23a44, 0x1729c, 0x1729a, 0x23a4c, 0x03f40,
+    0x2b2a7, 0x2b2a5, 0x2fa62, 0x21e43, 0x2b2a6, 0x2b2a4, 0x2fa60, 0x07e39, 0x2b295, 0x2b291, 0x2fa29, 0x21e1f, 0x2b294, 0x2b290, 0x23a27, 0x07e19,
+    0x04f73, 0x037d3, 0x1b6d2, 0x0b6a6, 0x04eae, 0x157ac, 0x076d1, 0x25772, 0x1aba8, 0x037ca, 0x218c1, 0x25e91, 0x07d9c, 0x07d82, 0x07d92, 0x0ff42,
+    0x0eca9, 0x097d1, 0x1b6c6, 0x0b694, 0x059d1, 0x13d72, 0x076c4, 0x17f56, 0x278c6, 0x097c4, 0x216bd, 0x09e8b, 0x1bd94, 0x1dd56, 0x05c8b, 0x0dd1e,
+    0x172ad, 0x172ab, 0x2f273, 0x2d66b, 0x172ac, 0x172aa, 0x2f272, 0x27e68, 0x2b887, 0x17885, 0x13a46, 0x1fa3a, 0x1b882, 0x07d7b, 0x13a42, 0x11c30,
+    0x15a75, 0x15a6e, 0x2ba58, 0x1be3f, 0x15a72, 0x11b68, 0x2ba56, 0x07e33, 0x15860, 0x1585c, 0x13a21, 0x1fa1a, 0x01856, 0x05938, 0x13a1e, 0x05e09,
+    0x1ef04, 0x2e13e, 0x1e90b, 0x2e13f, 0x1af30, 0x14b68, 0x2e33a, 0x1636b, 0x22f0a, 0x2a142, 0x12b0e, 0x2a143, 0x2e334, 0x1636a, 0x2e33b, 0x1636c,
+    0x14f30, 0x1ad68, 0x2a53a, 0x2256b, 0x2477b, 0x1e1aa, 0x1e785, 0x1e1ab, 0x16542, 0x22172, 0x12546, 0x22173, 0x26782, 0x121ac, 0x1e787, 0x121ad,
+    0x12d0a, 0x2e142, 0x22d0e, 0x2e143, 0x22342, 0x16172, 0x22346, 0x16173, 0x2ef0e, 0x2e146, 0x2e713, 0x2e147, 0x22343, 0x12373, 0x22347, 0x16174,
+    0x2a534, 0x2256a, 0x2a53b, 0x2256c, 0x24782, 0x1e1ac, 0x12787, 0x1e1ad, 0x16543, 0x1e573, 0x12547, 0x22174, 0x1e784, 0x1e1ae, 0x1e789, 0x01e6f,
+    0x08f19, 0x1e390, 0x2e727, 0x1e394, 0x26f39, 0x1e3a4, 0x22760, 0x1e3a6, 0x2cf1f, 0x1e391, 0x2e729, 0x1e395, 0x2cf43, 0x1e3a5, 0x22762, 0x1e3a7,
+    0x08f39, 0x107a4, 0x16760, 0x125a6, 0x0877d, 0x1c7b0, 0x1e7a0, 0x1c7b3, 0x28758, 0x107a6, 0x12764, 0x107a9, 0x26784, 0x1c7b2, 0x1e7a2, 0x0dd75,
+    0x28f1f, 0x12591, 0x16729, 0x12595, 0x2c758, 0x1c7a6, 0x22764, 0x1e3a9, 0x2e723, 0x1e398, 0x2e72b, 0x1e399, 0x2c75a, 0x1c7a8, 0x22766, 0x0de93,
+    0x28f43, 0x125a5, 0x16762, 0x125a7, 0x08784, 0x107b2, 0x107a2, 0x19b75, 0x1675a, 0x107a8, 0x12766, 0x19e93, 0x0879f, 0x1dd9c, 0x1e7a3, 0x01f4c,
+    0x2ef07, 0x2e14a, 0x2e711, 0x2e14b, 0x20f32, 0x1236e, 0x2e33c, 0x12370, 0x2ef0c, 0x1214c, 0x2e712, 0x1214d, 0x2e335, 0x1236f, 0x2e33d, 0x12371,
+    0x28f32, 0x2256e, 0x1653c, 0x22570, 0x2477c, 0x1c7ab, 0x1e786, 0x1e1af, 0x16544, 0x1e575, 0x12548, 0x1e577, 0x26783, 0x1c7ad, 0x1e788, 0x23c83,
+    0x16f0c, 0x2214c, 0x16712, 0x2214d, 0x22344, 0x12375, 0x22348, 0x12377, 0x2e70f, 0x1e14e, 0x2e714, 0x1e14f, 0x22345, 0x12376, 0x22349, 0x1f845,
+    0x16535, 0x2256f, 0x1653d, 0x22571, 0x24783, 0x107ad, 0x12788, 0x19a83, 0x16545, 0x1e576, 0x12549, 0x13845, 0x2f871, 0x2f86f, 0x1f83d, 0x1de35,
+    0x24f1b, 0x1e392, 0x2e728, 0x1e396, 0x26f3b, 0x1c7a5, 0x22761, 0x1e3a8, 0x2e720, 0x1e393, 0x2e72a, 0x1e397, 0x2cf45, 0x1bc74, 0x22763, 0x1bc59,
+    0x24f3b, 0x107a5, 0x16761, 0x125a8, 0x0877e, 0x1c7b1, 0x1e7a1, 0x1d99b, 0x28759, 0x107a7, 0x12765, 0x23c93, 0x1b871, 0x1b86c, 0x1bc5f, 0x05d44,
+    0x2a720, 0x12593, 0x1672a, 0x12597, 0x2c759, 0x1c7a7, 0x22765, 0x17a93, 0x2e724, 0x2f865, 0x2e72c, 0x1f82a, 0x2c75b, 0x21859, 0x23824, 0x1dc20,
+    0x28f45, 0x0fa74, 0x16763, 0x0fa59, 0x15871, 0x0f86c, 0x15a5f, 0x01b44, 0x1675b, 0x15859, 0x13824, 0x11a20, 0x01855, 0x01941, 0x1f81d, 0x1d80c,
+    0x1c90b, 0x0083f, 0x1e91c, 0x00954, 0x04a3a, 0x0ca6b, 0x14b5d, 0x14970, 0x10b1f, 0x14958, 0x12923, 0x2a95a, 0x00b57, 0x0eb73, 0x14b61, 0x14977,
+    0x00c3a, 0x18c6b, 0x1ad5d, 0x1a970, 0x1ce85, 0x1c8ab, 0x2e1c9, 0x09fb9, 0x22d91, 0x2c9a6, 0x2e198, 0x2c9a8, 0x2a1ca, 0x2a1d3, 0x2a1cb, 0x03f87,
+    0x1cd1f, 0x20958, 0x22923, 0x2095a, 0x16b91, 0x289a6, 0x2a198, 0x289a8, 0x1e929, 0x2e964, 0x2e92b, 0x2e966, 0x16b95, 0x2a1a9, 0x2a199, 0x0fc93,
+    0x04d57, 0x1ad73, 0x20d61, 0x20977, 0x2e1ca, 0x2e1d3, 0x2e1cb, 0x07f87, 0x22d95, 0x2e1a9, 0x2e199, 0x1ba93, 0x2e1cc, 0x1ffd1, 0x15cc0, 0x01f5e,
+    0x00e27, 0x10c94, 0x14dbc, 0x1e1d6, 0x18e60, 0x1caa6, 0x26bc5, 0x15fcc, 0x18f8c, 0x04ac6, 0x20bbe, 0x121d7, 0x06b95, 0x01dd2, 0x25cc7, 0x03c95,
+    0x0ce60, 0x10ca6, 0x08dc5, 0x1bfcc, 0x1eea0, 0x1ffb3, 0x1f0db, 0x1ffa0, 0x06ec6, 0x1f0da, 0x2e5d8, 0x07fc6, 0x1aecc, 0x11da6, 0x09cc5, 0x0df60,
+    0x0ed8c, 0x00cc6, 0x28dbe, 0x1e1d7, 0x02ec6, 0x130da, 0x163d8, 0x03fc6, 0x1cfbe, 0x1f0d8, 0x1f0d5, 0x1debe, 0x1f0d7, 0x01dc6, 0x29cbe, 0x0fc8c,
+    0x02d95, 0x00cd2, 0x24dc7, 0x07a95, 0x14ecc, 0x1dba6, 0x27ac5, 0x19f60, 0x130d7, 0x05bc6, 0x21abe, 0x19e8c, 0x1f0d6, 0x11d94, 0x15cbc, 0x01f27,
+    0x1cf32, 0x2e96e, 0x1e93c, 0x2e970, 0x18b7c, 0x28bab, 0x16b86, 0x161af, 0x12944, 0x2a975, 0x12948, 0x2a977, 0x1ab83, 0x2dcad, 0x2fc88, 0x2fc83,
+    0x0ed7c, 0x20dab, 0x2ed86, 0x2e1af, 0x00eb7, 0x2f0d4, 0x2f0cd, 0x01fb7, 0x2ed9b, 0x2f0b3, 0x2f09e, 0x2fc9b, 0x2f0af, 0x21cab, 0x2fc86, 0x0fc7c,
+    0x1e944, 0x2e975, 0x22948, 0x2e977, 0x16b9b, 0x170b3, 0x1709e, 0x17a9b, 0x1e94e, 0x2f078, 0x2e950, 0x1f84e, 0x2f877, 0x2f875, 0x23848, 0x1f844,
+    0x2ed83, 0x2cdad, 0x2ed88, 0x1ba83, 0x170af, 0x29aab, 0x17a86, 0x19a7c, 0x2b877, 0x2b875, 0x13848, 0x13844, 0x2f870, 0x2f86e, 0x1f83c, 0x1de32,
+    0x00e5e, 0x1eed1, 0x14dc0, 0x2f0cc, 0x06e87, 0x2f0d3, 0x2f0cb, 0x2f0ca, 0x1ab93, 0x2f0a9, 0x2f099, 0x23c95, 0x21877, 0x1bc73, 0x21c61, 0x05c57,
+    0x02e87, 0x2b0d3, 0x2b0cb, 0x2b0ca, 0x08eb9, 0x1d9ab, 0x2f0c9, 0x1df85, 0x2d8a8, 0x2d8a6, 0x2f098, 0x23c91, 0x1b870, 0x19d6b, 0x1bc5d, 0x01d3a,
+    0x0ed93, 0x2b0a9, 0x2b099, 0x17a95, 0x298a8, 0x298a6, 0x2b098, 0x17a91, 0x2f866, 0x2f864, 0x2f82b, 0x1f829, 0x2185a, 0x21858, 0x23823, 0x1dc1f,
+    0x15877, 0x0fa73, 0x15a61, 0x01a57, 0x15870, 0x0db6b, 0x15a5d, 0x05b3a, 0x2b85a, 0x15858, 0x13823, 0x11a1f, 0x01854, 0x0193f, 0x1f81c, 0x1d80b,
+    0x1ed05, 0x2e140, 0x1e90c, 0x2e141, 0x2e340, 0x14b69, 0x2a344, 0x1496c, 0x1eb0c, 0x2a144, 0x12b0f, 0x2a145, 0x2e341, 0x14b6c, 0x2a345, 0x1616d,
+    0x2e540, 0x1ad69, 0x2e544, 0x2096c, 0x1e19a, 0x1e1b0, 0x1e19b, 0x1e1b1, 0x2e54c, 0x22175, 0x2e54e, 0x22176, 0x1219c, 0x121b2, 0x17477, 0x15e6c,
+    0x1ed0c, 0x2e144, 0x22d0f, 0x2e145, 0x2e34c, 0x16175, 0x1634e, 0x16176, 0x1ef12, 0x2e148, 0x2e914, 0x2e149, 0x2e34d, 0x16177, 0x1634f, 0x2b645,
+    0x2e541, 0x20d6c, 0x2e545, 0x2216d, 0x1e19c, 0x1e1b2, 0x23277, 0x21e6c, 0x2e54d, 0x22177, 0x2f64f, 0x2f645, 0x1e19d, 0x1f29c, 0x2f64d, 0x2f641,
+    0x2e740, 0x1e39a, 0x2e74c, 0x1239c, 0x1af69, 0x1e3b0, 0x22375, 0x123b2, 0x2e744, 0x1e39b, 0x2e74e, 0x17677, 0x20b6c, 0x1e3b1, 0x22376, 0x15c6c,
+    0x14d69, 0x1e5b0, 0x16575, 0x1f6b2, 0x1e7b0, 0x1f0b4, 0x1f6b3, 0x1f6b0, 0x16775, 0x1e5b3, 0x13678, 0x17675, 0x1e7b2, 0x1f4b0, 0x17475, 0x15c69,
+    0x2a744, 0x1e59b, 0x1674e, 0x23677, 0x22775, 0x1e3b3, 0x22378, 0x23675, 0x2e748, 0x1e39e, 0x2f650, 0x2f648, 0x22777, 0x1f49b, 0x1764e, 0x2b644,
+    0x14d6c, 0x1f2b1, 0x23276, 0x21a6c, 0x132b2, 0x1f2b0, 0x23275, 0x1be69, 0x16777, 0x1f29b, 0x2f64e, 0x2f644, 0x1329c, 0x1f29a, 0x2f64c, 0x2f640,
+    0x1ef0c, 0x2e14c, 0x1ed12, 0x2e14d, 0x2e344, 0x16375, 0x2e348, 0x16377, 0x22f0f, 0x1614e, 0x2eb14, 0x1614f, 0x2e345, 0x16376, 0x2e349, 0x2b445,
+    0x2a544, 0x22575, 0x2e548, 0x22577, 0x1e79b, 0x1f0b3, 0x1f09e, 0x1f69b, 0x1654e, 0x23078, 0x2e550, 0x1744e, 0x23477, 0x23475, 0x2f448, 0x2b444,
+    0x12d0f, 0x2e14e, 0x2ed14, 0x2e14f, 0x2e34e, 0x13078, 0x2e350, 0x2f24e, 0x2ef14, 0x2f050, 0x2f015, 0x2fe14, 0x2f04f, 0x2f04e, 0x2fc14, 0x13c0f,
+    0x2a545, 0x17276, 0x2f249, 0x2f245, 0x17277, 0x17275, 0x2f248, 0x2f244, 0x1704f, 0x1704e, 0x2fa14, 0x23e0f, 0x2f04d, 0x2f04c, 0x1fc12, 0x1fe0c,
+    0x2e741, 0x1e39c, 0x2e74d, 0x1f09d, 0x20f6c, 0x1f0b2, 0x22377, 0x1f09c, 0x2e745, 0x23077, 0x2e74f, 0x2f44d, 0x2306d, 0x21c6c, 0x2f445, 0x2f441,
+    0x14f6c, 0x130b2, 0x16577, 0x1309c, 0x1f0b1, 0x1f0b0, 0x1f09b, 0x1f09a, 0x23076, 0x23075, 0x2f44e, 0x2f44c, 0x2186c, 0x1bc69, 0x2f444, 0x2f440,
+    0x2a745, 0x17077, 0x1724f, 0x2f24d, 0x17076, 0x17075, 0x1724e, 0x2f24c, 0x2f049, 0x2f048, 0x2f814, 0x1fe12, 0x2f045, 0x2f044, 0x23c0f, 0x1fc0c,
+    0x1706d, 0x15a6c, 0x2b245, 0x2f241, 0x1586c, 0x15a69, 0x2b244, 0x2f240, 0x2b045, 0x2b044, 0x13a0f, 0x1fa0c, 0x2f041, 0x2f040, 0x1f80c, 0x1fc05,
+    0x1c90c, 0x00841, 0x1e91d, 0x00955, 0x00a44, 0x0e96c, 0x14b5f, 0x14971, 0x10b20, 0x14959, 0x12924, 0x1765b, 0x0eb59, 0x0eb74, 0x17663, 0x29e45,
+    0x04c44, 0x1a96c, 0x1ad5f, 0x1a971, 0x1c89b, 0x1d6b1, 0x1f6a1, 0x0967e, 0x22d93, 0x116a7, 0x13665, 0x29659, 0x134a8, 0x116a5, 0x17661, 0x25e3b,
+    0x1cd20, 0x20959, 0x22924, 0x2d65b, 0x16b93, 0x1d6a7, 0x23665, 0x2d659, 0x1e92a, 0x2e965, 0x2f62c, 0x2f624, 0x13497, 0x13493, 0x1762a, 0x2b620,
+    0x1ad59, 0x1ad74, 0x23663, 0x2de45, 0x1f2a8, 0x1d6a5, 0x23661, 0x27e3b, 0x1f297, 0x1f293, 0x2f62a, 0x2f620, 0x1f296, 0x1f292, 0x2f628, 0x25e1b,
+    0x00e4c, 0x1cc9c, 0x1f6a3, 0x0969f, 0x18a75, 0x116b2, 0x116a2, 0x09684, 0x18f93, 0x116a8, 0x13666, 0x1765a, 0x134a7, 0x134a5, 0x17662, 0x29e43,
+    0x0cc75, 0x1d6b2, 0x1f6a2, 0x27684, 0x1d6b3, 0x1d6b0, 0x1f6a0, 0x0967d, 0x116a9, 0x116a6, 0x13664, 0x29658, 0x134a6, 0x116a4, 0x17660, 0x09e39,
+    0x0cf93, 0x1d6a8, 0x23666, 0x2d65a, 0x1f2a9, 0x1d6a6, 0x23664, 0x2d658, 0x1f299, 0x1f298, 0x2f62b, 0x2f623, 0x13495, 0x13491, 0x17629, 0x29e1f,
+    0x1f2a7, 0x1f2a5, 0x23662, 0x2de43, 0x1f2a6, 0x1f2a4, 0x23660, 0x27e39, 0x1f295, 0x1f291, 0x2f629, 0x2de1f, 0x1f294, 0x1f290, 0x2f627, 0x09e19,
+    0x1cf35, 0x2e96f, 0x1e93d, 0x2e971, 0x18b83, 0x116ad, 0x13688, 0x25683, 0x12945, 0x1f476, 0x13449, 0x17445, 0x23471, 0x2346f, 0x1743d, 0x17435,
+    0x22d83, 0x1d6ad, 0x1f688, 0x27683, 0x1f0af, 0x1d6ab, 0x1f686, 0x2567c, 0x1f477, 0x1f475, 0x13448, 0x17444, 0x23470, 0x2346e, 0x1743c, 0x29e32,
+    0x1e945, 0x13276, 0x23249, 0x23245, 0x13277, 0x13275, 0x23248, 0x23244, 0x1f04f, 0x1f04e, 0x2f614, 0x2f60f, 0x2304d, 0x2304c, 0x17612, 0x17e0c,
+    0x13271, 0x1326f, 0x2f23d, 0x2f235, 0x13270, 0x1326e, 0x2f23c, 0x21e32, 0x1304d, 0x1304c, 0x2f612, 0x2fe0c, 0x2f04b, 0x2f04a, 0x2f611, 0x2fe07,
+    0x00f6f, 0x1f0ae, 0x1f689, 0x1f684, 0x1f0ad, 0x1f0ac, 0x13687, 0x25682, 0x23074, 0x1f473, 0x13447, 0x17443, 0x2346c, 0x2346a, 0x2b43b, 0x2b434,
+    0x130ad, 0x130ac, 0x1f687, 0x27682, 0x1f0ab, 0x1f0aa, 0x1f685, 0x2567b, 0x23073, 0x23072, 0x13446, 0x17442, 0x2346b, 0x1bc68, 0x2b43a, 0x15e30,
+    0x17074, 0x13273, 0x23247, 0x23243, 0x17073, 0x17072, 0x23246, 0x23242, 0x2f047, 0x2f046, 0x2f613, 0x2fe0e, 0x2f043, 0x2f042, 0x23c0e, 0x13c0a,
+    0x1726c, 0x1726a, 0x2f23b, 0x2f234, 0x1726b, 0x15a68, 0x2f23a, 0x1be30, 0x2b043, 0x2b042, 0x13a0e, 0x23e0a, 0x2f03f, 0x2f03e, 0x1f80b, 0x1fe04,
+    0x18f0a, 0x00842, 0x12b1f, 0x0e958, 0x1af34, 0x0ca6a, 0x2ab57, 0x14b73, 0x1eb1b, 0x1495e, 0x12b22, 0x14962, 0x1af41, 0x14b6f, 0x2ab59, 0x09c76,
+    0x0cc42, 0x1cc72, 0x18d91, 0x069a6, 0x0ae82, 0x1eeac, 0x207ca, 0x0dfd3, 0x26792, 0x269d1, 0x207c1, 0x2d4d2, 0x2679c, 0x274ae, 0x274a8, 0x09c73,
+    0x10d34, 0x18982, 0x12b43, 0x16984, 0x2cf6a, 0x2a3ac, 0x2ab73, 0x163ae, 0x1eb3b, 0x16987, 0x12b47, 0x16989, 0x2eb6c, 0x2a3ad, 0x2e374, 0x03c6f,
+    0x00d6a, 0x04cac, 0x18da5, 0x1bab2, 0x267ac, 0x1d0d9, 0x207d3, 0x05fac, 0x24fa5, 0x214d3, 0x207cf, 0x19ea5, 0x267b2, 0x274ac, 0x25ca5, 0x03c6a,
+    0x06f1f, 0x1ca91, 0x22f8c, 0x2e3c6, 0x06f43, 0x1caa5, 0x2cb95, 0x2e3d2, 0x1af28, 0x2e3c0, 0x20b8e, 0x2e3c7, 0x1af4d, 0x27d89, 0x27497, 0x09d62,
+    0x02e58, 0x12ea6, 0x2c7c6, 0x1d0da, 0x26e84, 0x1fdb2, 0x1a7cc, 0x13da6, 0x26796, 0x1b4cc, 0x207c8, 0x2d4c6, 0x2679d, 0x27d84, 0x27496, 0x03d58,
+    0x08f57, 0x223ca, 0x2ef95, 0x223cc, 0x26f73, 0x223d3, 0x223a9, 0x17dd1, 0x2cf61, 0x223cb, 0x22399, 0x2d4c0, 0x2c777, 0x0bd87, 0x27493, 0x03d5e,
+    0x08f73, 0x0ccd3, 0x2c7d2, 0x07aa6, 0x267ae, 0x1fdac, 0x27ad1, 0x1df72, 0x267a8, 0x214ca, 0x214c1, 0x19e91, 0x2749c, 0x0bd82, 0x27492, 0x0df42,
+    0x18f1b, 0x2a392, 0x22b28, 0x2a396, 0x1af3b, 0x28ba5, 0x2eb61, 0x2a3a8, 0x20f20, 0x2a393, 0x2eb2a, 0x2a397, 0x20f45, 0x2d474, 0x2dc63, 0x27c59,
+    0x02e5e, 0x16ed1, 0x2c7c0, 0x230cc, 0x0ae87, 0x230d3, 0x230cb, 0x230ca, 0x26793, 0x230a9, 0x23099, 0x2fc95, 0x2d477, 0x27c73, 0x2dc61, 0x09c57,
+    0x22b41, 0x2a39c, 0x22b4d, 0x1709d, 0x2cf6c, 0x2b0b2, 0x2e377, 0x2b09c, 0x22b45, 0x2f077, 0x2eb4f, 0x2384d, 0x2f06d, 0x2dc6c, 0x23845, 0x23841,
+    0x02f6f, 0x170ae, 0x17a89, 0x17a84, 0x2b0ad, 0x2b0ac, 0x17a87, 0x19a82, 0x2f074, 0x2b873, 0x13847, 0x13843, 0x2f86c, 0x2dc6a, 0x1f83b, 0x11e34,
+    0x0af22, 0x2e3c1, 0x2ef8e, 0x2f0c8, 0x0af47, 0x2f0cf, 0x20799, 0x2f0c1, 0x20f2a, 0x21499, 0x2f08f, 0x2fc8e, 0x21c4f, 0x0bc47, 0x21c2a, 0x0bc22,
+    0x08e62, 0x2f0d2, 0x2f0c7, 0x2f0c6, 0x26e89, 0x1d9a5, 0x2f0c0, 0x1d991, 0x26797, 0x2d895, 0x2188e, 0x23c8c, 0x1bc4d, 0x07c43, 0x1bc28, 0x07c1f,
+    0x26f59, 0x2b0a8, 0x2b097, 0x2b096, 0x2c774, 0x298a5, 0x2b093, 0x2b092, 0x2cf63, 0x2f861, 0x2f82a, 0x23828, 0x21c45, 0x1bc3b, 0x21c20, 0x19c1b,
+    0x08f76, 0x15873, 0x15a62, 0x0fa58, 0x1586f, 0x0d96a, 0x15a5e, 0x01b42, 0x2b859, 0x2b857, 0x13822, 0x1381f, 0x1bc41, 0x1bc34, 0x1f81b, 0x19c0a,
+    0x10b0e, 0x00843, 0x10923, 0x0095a, 0x04a3b, 0x0ca6c, 0x0eb61, 0x0e977, 0x10b22, 0x0e962, 0x10b52, 0x14966, 0x00b59, 0x25576, 0x14b65, 0x09d4e,
+    0x10c46, 0x18873, 0x18d98, 0x069a8, 0x1ce87, 0x155ad, 0x035cb, 0x29f87, 0x06ec1, 0x074d2, 0x274d0, 0x27fc1, 0x0b4a8, 0x25573, 0x09598, 0x15d46,
+    0x1cd43, 0x04984, 0x1c95a, 0x0699f, 0x16ba5, 0x155b2, 0x149a8, 0x1559c, 0x12962, 0x169a2, 0x12966, 0x169a3, 0x0b4a7, 0x25575, 0x25c93, 0x03d4c,
+    0x04d73, 0x04cae, 0x1a9a8, 0x07f9c, 0x035d3, 0x155ac, 0x035ca, 0x07f82, 0x1b4d2, 0x074d1, 0x21ac1, 0x07f92, 0x0b4a6, 0x25572, 0x25c91, 0x0fd42,
+    0x04e29, 0x1ca95, 0x06bbe, 0x157d7, 0x18e62, 0x295a7, 0x095c7, 0x29595, 0x06b8e, 0x074c7, 0x274c3, 0x274be, 0x0b497, 0x25d62, 0x2748e, 0x09d29,
+    0x10e64, 0x10ca9, 0x054d8, 0x2dfc6, 0x1eea2, 0x17d75, 0x095c5, 0x17f60, 0x074c8, 0x074c6, 0x274c2, 0x274bd, 0x0b496, 0x29d58, 0x2748d, 0x15d21,
+    0x00f95, 0x10ccc, 0x172d7, 0x172d6, 0x095d2, 0x295a6, 0x095c6, 0x29594, 0x1b4c7, 0x074c5, 0x214be, 0x274bc, 0x0b495, 0x25d60, 0x2748c, 0x03d27,
+    0x0cca9, 0x05bd1, 0x27ac6, 0x1bf94, 0x095d1, 0x17d72, 0x095c4, 0x1df56, 0x1b4c6, 0x074c4, 0x214bd, 0x05e8b, 0x0b494, 0x17d56, 0x09c8b, 0x0fd1e,
+    0x18f3b, 0x14ba5, 0x12b61, 0x169a8, 0x06b7e, 0x295b1, 0x16ba1, 0x2959b, 0x1cb59, 0x214a7, 0x12b65, 0x2fc93, 0x27471, 0x2746c, 0x27c5f, 0x09d44,
+    0x00e87, 0x1f0d3, 0x1f0cb, 0x1f0ca, 0x06eb9, 0x295ab, 0x230c9, 0x29f85, 0x214a8, 0x214a6, 0x23098, 0x2fc91, 0x27470, 0x2746b, 0x27c5d, 0x03d3a,
+    0x10f6c, 0x170b2, 0x12977, 0x1709c, 0x170b1, 0x170b0, 0x1709b, 0x1709a, 0x2f076, 0x2f075, 0x2f84e, 0x2384c, 0x2d46c, 0x27469, 0x23844, 0x03d40,
+    0x170ad, 0x170ac, 0x2ba87, 0x1ba82, 0x170ab, 0x170aa, 0x17a85, 0x07f7b, 0x2f073, 0x2f072, 0x13846, 0x13842, 0x2d46b, 0x27c68, 0x1f83a, 0x11e30,
+    0x04e62, 0x230d2, 0x230c7, 0x230c6, 0x06e89, 0x295a5, 0x230c0, 0x29591, 0x21497, 0x21495, 0x2148e, 0x2d48c, 0x27c4d, 0x0bc43, 0x27c28, 0x0bc1f,
+    0x00ea2, 0x2f0d1, 0x2f0c5, 0x2f0c4, 0x26eba, 0x13d6e, 0x2f0bf, 0x13f5c, 0x21496, 0x21494, 0x2148d, 0x2fc8b, 0x27c4b, 0x0bc3f, 0x27c26, 0x01d1a,
+    0x2b0a7, 0x2b0a6, 0x2b095, 0x2b094, 0x2b0a5, 0x2b0a4, 0x2b091, 0x2b090, 0x2f862, 0x2f860, 0x2f829, 0x23827, 0x21c43, 0x07c39, 0x21c1f, 0x07c19,
+    0x15875, 0x0fa72, 0x15a60, 0x01a56, 0x1586e, 0x11968, 0x15a5c, 0x05b38, 0x2b858, 0x2b856, 0x13821, 0x11a1e, 0x1bc3f, 0x07c33, 0x1f81a, 0x05c09,
+    0x1cb0c, 0x00844, 0x12b20, 0x0e959, 0x00a41, 0x0eb6c, 0x14b59, 0x14b74, 0x1eb1d, 0x1495f, 0x12b24, 0x17463, 0x00b55, 0x14b71, 0x1745b, 0x29c45,
+    0x00c4c, 0x18875, 0x18d93, 0x136a7, 0x1ce9c, 0x114b2, 0x114a8, 0x136a5, 0x1f4a3, 0x114a2, 0x13466, 0x17462, 0x0949f, 0x09484, 0x1745a, 0x29c43,
+    0x1cd35, 0x18983, 0x12b45, 0x23671, 0x2eb6f, 0x114ad, 0x1f676, 0x2366f, 0x1eb3d, 0x13488, 0x13649, 0x1763d, 0x2eb71, 0x25483, 0x17645, 0x17635,
+    0x00d6f, 0x1f2ad, 0x23274, 0x2366c, 0x1f2ae, 0x1f2ac, 0x1f673, 0x2366a, 0x1f489, 0x13487, 0x13647, 0x2b63b, 0x1f484, 0x25482, 0x17643, 0x2b634,
+    0x04e44, 0x1ca9b, 0x22f93, 0x136a8, 0x1ab6c, 0x1d4b1, 0x114a7, 0x114a5, 0x1af5f, 0x1f4a1, 0x13465, 0x17461, 0x1ab71, 0x0947e, 0x29459, 0x25c3b,
+    0x0ce75, 0x1d4b3, 0x136a9, 0x136a6, 0x1d4b2, 0x1d4b0, 0x114a6, 0x136a4, 0x1f4a2, 0x1f4a0, 0x13464, 0x17460, 0x27484, 0x0947d, 0x29458, 0x09c39,
+    0x22f83, 0x1f2af, 0x1f677, 0x23670, 0x1d4ad, 0x1d4ab, 0x1f675, 0x2366e, 0x1f488, 0x1f486, 0x13648, 0x1763c, 0x27483, 0x2547c, 0x17644, 0x29c32,
+    0x132ad, 0x1f2ab, 0x23273, 0x2366b, 0x132ac, 0x1f2aa, 0x23272, 0x1be68, 0x1f487, 0x1f485, 0x13646, 0x2b63a, 0x27482, 0x2547b, 0x17642, 0x15c30,
+    0x1cf20, 0x16993, 0x1eb2a, 0x13697, 0x20b59, 0x1d4a7, 0x2eb65, 0x13693, 0x22b24, 0x23465, 0x2f42c, 0x1742a, 0x2d45b, 0x2d459, 0x2f424, 0x2b420,
+    0x0cd93, 0x1f0a9, 0x1f099, 0x13695, 0x1d4a8, 0x1d4a6, 0x1f098, 0x13691, 0x23466, 0x23464, 0x2f42b, 0x17429, 0x2d45a, 0x2d458, 0x2f423, 0x29c1f,
+    0x1eb45, 0x13077, 0x1f24f, 0x2324d, 0x13076, 0x13075, 0x1f24e, 0x2324c, 0x23049, 0x23048, 0x2f414, 0x17412, 0x23045, 0x23044, 0x2f40f, 0x17c0c,
+    0x13074, 0x17273, 0x2f247, 0x2f243, 0x13073, 0x13072, 0x2f246, 0x2f242, 0x23047, 0x23046, 0x2f413, 0x23e0e, 0x23043, 0x23042, 0x2fc0e, 0x17c0a,
+    0x1af59, 0x1f0a8, 0x1f097, 0x1f096, 0x1af74, 0x1d4a5, 0x1f093, 0x1f092, 0x23463, 0x23461, 0x2f42a, 0x2f428, 0x2dc45, 0x27c3b, 0x2f420, 0x25c1b,
+    0x1f0a7, 0x1f0a6, 0x1f095, 0x1f094, 0x1f0a5, 0x1f0a4, 0x1f091, 0x1f090, 0x23462, 0x23460, 0x2f429, 0x2f427, 0x2dc43, 0x27c39, 0x2dc1f, 0x09c19,
+    0x13071, 0x13070, 0x1324d, 0x2f24b, 0x1306f, 0x1306e, 0x1324c, 0x2f24a, 0x2f03d, 0x2f03c, 0x2f412, 0x2f411, 0x2f035, 0x21c32, 0x2fc0c, 0x2fc07,
+    0x1706c, 0x1706b, 0x2b243, 0x2f23f, 0x1706a, 0x15868, 0x2b242, 0x2f23e, 0x2f03b, 0x2f03a, 0x1380e, 0x1fa0b, 0x2f034, 0x1bc30, 0x23c0a, 0x1fc04,
+    0x10b0f, 0x00845, 0x10924, 0x0365b, 0x00a45, 0x0d66d, 0x0d663, 0x03745, 0x10b24, 0x0d463, 0x11653, 0x15624, 0x0345b, 0x03545, 0x15424, 0x1560f,
+    0x04c4e, 0x0d676, 0x11665, 0x03659, 0x0d477, 0x0f76c, 0x0d661, 0x0973b, 0x11466, 0x0d462, 0x11652, 0x15622, 0x0345a, 0x03543, 0x15423, 0x1560e,
+    0x1cd45, 0x11671, 0x1f65b, 0x03655, 0x11674, 0x0d66c, 0x11659, 0x03741, 0x11463, 0x1145f, 0x13624, 0x1761d, 0x0d459, 0x03544, 0x17620, 0x2960c,
+    0x11676, 0x1166f, 0x1f659, 0x27e41, 0x11673, 0x0d66a, 0x1f657, 0x09734, 0x11462, 0x1145e, 0x13622, 0x2b61b, 0x0d458, 0x03542, 0x1761f, 0x2960a,
+    0x04e4e, 0x0d677, 0x11666, 0x0365a, 0x0d476, 0x0f56c, 0x0d662, 0x03743, 0x11465, 0x0d461, 0x11452, 0x15623, 0x03459, 0x0953b, 0x15422, 0x1540e,
+    0x11678, 0x0d675, 0x11664, 0x03658, 0x0d475, 0x15769, 0x0d660, 0x09739, 0x11464, 0x0d460, 0x11651, 0x15621, 0x03458, 0x09539, 0x15421, 0x1560d,
+    0x11677, 0x11670, 0x1f65a, 0x03654, 0x0d473, 0x0d66b, 0x11658, 0x0373f, 0x11461, 0x1145d, 0x13623, 0x1761c, 0x03457, 0x0953a, 0x1541f, 0x2960b,
+    0x11675, 0x1166e, 0x1f658, 0x27e3f, 0x11672, 0x15768, 0x1f656, 0x09733, 0x11460, 0x1145c, 0x13621, 0x2b61a, 0x03456, 0x09538, 0x1761e, 0x09e09,
+    0x1cf45, 0x0d674, 0x11663, 0x0d659, 0x11471, 0x0d46c, 0x1165f, 0x03744, 0x1f45b, 0x11459, 0x13424, 0x15620, 0x03455, 0x03541, 0x1741d, 0x2940c,
+    0x11477, 0x0d673, 0x11661, 0x03657, 0x11470, 0x0f76b, 0x1165d, 0x0973a, 0x1f45a, 0x11458, 0x13423, 0x1561f, 0x03454, 0x0353f, 0x1741c, 0x2940b,
+    0x1306d, 0x1166c, 0x1f245, 0x23241, 0x1146c, 0x11669, 0x1f244, 0x23240, 0x1f045, 0x1f044, 0x1360f, 0x1760c, 0x23041, 0x23040, 0x1740c, 0x17605,
+    0x1326c, 0x1326a, 0x2323b, 0x23234, 0x1326b, 0x11668, 0x2323a, 0x27e30, 0x1f043, 0x1f042, 0x1360e, 0x2b60a, 0x2303f, 0x2303e, 0x1740b, 0x17e04,
+    0x11476, 0x11473, 0x11662, 0x0d658, 0x1146f, 0x0f56a, 0x1165e, 0x03742, 0x1f459, 0x1f457, 0x13422, 0x1741f, 0x27c41, 0x09534, 0x2b41b, 0x2940a,
+    0x11475, 0x0d672, 0x11660, 0x03656, 0x1146e, 0x15568, 0x1165c, 0x09738, 0x1f458, 0x1f456, 0x13421, 0x1561e, 0x27c3f, 0x09533, 0x2b41a, 0x09c09,
+    0x1306c, 0x1306b, 0x1f243, 0x2323f, 0x1306a, 0x11468, 0x1f242, 0x2323e, 0x2303b, 0x2303a, 0x1340e, 0x1760b, 0x23034, 0x27c30, 0x2b40a, 0x17c04,
+    0x13069, 0x13268, 0x2f239, 0x2f233, 0x13068, 0x13067, 0x2f238, 0x27e2e, 0x2f039, 0x2f038, 0x1360d, 0x2fe09, 0x2f033, 0x27c2e, 0x2fc09, 0x11c02,
+    0x00d04, 0x0ad30, 0x20d19, 0x20d39, 0x2463e, 0x12c68, 0x0e790, 0x005a4, 0x12d30, 0x2c57b, 0x2ed39, 0x2057d, 0x0af68, 0x026aa, 0x0e7a4, 0x005b0,
+    0x02c0a, 0x24434, 0x26d1f, 0x26d43, 0x28642, 0x1446a, 0x02491, 0x024a5, 0x14742, 0x02582, 0x2a558, 0x20584, 0x08672, 0x0e6ac, 0x0c5a6, 0x005b2,
+    0x02d07, 0x26d32, 0x2cd1b, 0x2cd3b, 0x0264a, 0x1446e, 0x0e792, 0x005a5, 0x16d32, 0x2c57c, 0x2ed3b, 0x2057e, 0x0276e, 0x005ab, 0x0c5a5, 0x005b1,
+    0x08d0c, 0x08435, 0x24520, 0x26d45, 0x1464c, 0x1446f, 0x02493, 0x0ba74, 0x14744, 0x02583, 0x2a559, 0x0ba71, 0x02775, 0x005ad, 0x0c5a7, 0x07a6c,
+    0x02e0b, 0x2443a, 0x24527, 0x08560, 0x2463f, 0x1446b, 0x0e794, 0x024a6, 0x2873a, 0x02585, 0x14560, 0x005a0, 0x0876b, 0x026ab, 0x0e7a6, 0x005b3,
+    0x14c0e, 0x2443b, 0x08529, 0x08562, 0x28643, 0x1446c, 0x02495, 0x024a7, 0x14746, 0x02587, 0x14564, 0x005a2, 0x08673, 0x0e6ad, 0x0e7a9, 0x11f75,
+    0x24511, 0x0843c, 0x24528, 0x08561, 0x0264b, 0x14470, 0x0e796, 0x024a8, 0x2873c, 0x02586, 0x14561, 0x005a1, 0x02770, 0x026af, 0x0e7a8, 0x01e9b,
+    0x08512, 0x0843d, 0x0852a, 0x08563, 0x1464d, 0x14471, 0x02497, 0x07b59, 0x14748, 0x02588, 0x14565, 0x0bb5f, 0x02777, 0x09b83, 0x09b93, 0x19f44,
+    0x14d0a, 0x08442, 0x2ad1f, 0x26558, 0x24642, 0x14672, 0x0e791, 0x005a6, 0x28734, 0x2e582, 0x2ad43, 0x2e584, 0x0876a, 0x026ac, 0x0e7a5, 0x0c5b2,
+    0x24d0e, 0x08443, 0x24523, 0x0855a, 0x24646, 0x0e473, 0x0e798, 0x005a8, 0x14743, 0x02584, 0x2a55a, 0x0059f, 0x02773, 0x026ae, 0x0c5a8, 0x0dc9c,
+    0x28d0c, 0x08444, 0x28520, 0x26559, 0x0264c, 0x0e475, 0x0e793, 0x005a7, 0x28735, 0x2e583, 0x2ad45, 0x13a71, 0x0276f, 0x0c5ad, 0x17a74, 0x13a6c,
+    0x2450f, 0x08445, 0x24524, 0x0855b, 0x0264e, 0x0e476, 0x25a65, 0x0ba59, 0x14745, 0x25a71, 0x2a55b, 0x25a55, 0x02776, 0x25a6f, 0x17a59, 0x19e41,
+    0x02f0e, 0x02446, 0x28529, 0x02564, 0x24643, 0x14673, 0x0e795, 0x005a9, 0x2873b, 0x0e587, 0x14562, 0x0e5a2, 0x0876c, 0x026ad, 0x0e7a7, 0x05c75,
+    0x02513, 0x02447, 0x0252b, 0x02566, 0x24647, 0x14674, 0x0e799, 0x11993, 0x14747, 0x02589, 0x14566, 0x005a3, 0x08674, 0x1996f, 0x05993, 0x19d4c,
+    0x28512, 0x02448, 0x2852a, 0x02565, 0x0264d, 0x0e477, 0x0e797, 0x15893, 0x2873d, 0x0e588, 0x14563, 0x1385f, 0x02771, 0x05883, 0x13859, 0x1dc44,
+    0x02514, 0x02449, 0x0252c, 0x03a24, 0x0264f, 0x03a45, 0x03a2a, 0x03a20, 0x14749, 0x03a3d, 0x15a24, 0x01a1d, 0x0fa45, 0x03a35, 0x0fa20, 0x01a0c,
+    0x00c0a, 0x06d34, 0x1ad1f, 0x1ad43, 0x1ca42, 0x12c6a, 0x00891, 0x008a5, 0x10b42, 0x00982, 0x1e958, 0x20984, 0x04a72, 0x0caac, 0x0e9a6, 0x03fb2,
+    0x00c1b, 0x0ad41, 0x0ad28, 0x0ad4d, 0x12e5e, 0x12c6f, 0x244c0, 0x21f89, 0x2c592, 0x2c59c, 0x2c596, 0x2139d, 0x20ed1, 0x213ae, 0x0b3cc, 0x21f84,
+    0x06d1b, 0x06d3b, 0x1ad22, 0x1ad47, 0x28492, 0x2aca5, 0x084c1, 0x092cf, 0x2295e, 0x20987, 0x22962, 0x20989, 0x289d1, 0x092d3, 0x252d2, 0x01ea5,
+    0x08c20, 0x0ad45, 0x26d2a, 0x26d4f, 0x28493, 0x27374, 0x0b399, 0x1bb47, 0x2c593, 0x27377, 0x2c597, 0x0bb4d, 0x0b3a9, 0x2db73, 0x27a95, 0x1bb43,
+    0x0ec1f, 0x16c57, 0x0ac8c, 0x26c95, 0x12e58, 0x16c73, 0x244c6, 0x244d2, 0x04f91, 0x0a5ca, 0x265c6, 0x0a5cc, 0x1aea6, 0x11dd3, 0x053da, 0x0ffa6,
+    0x14c22, 0x28c59, 0x26c8e, 0x2d397, 0x16e62, 0x16c76, 0x273c7, 0x23f62, 0x265c1, 0x2d3a8, 0x273c8, 0x2d396, 0x273d2, 0x23b73, 0x273c6, 0x1ff58,
+    0x02c28, 0x24c61, 0x08d8e, 0x0a599, 0x28496, 0x284a8, 0x092c8, 0x092c1, 0x265c0, 0x092cb, 0x252c7, 0x252c0, 0x032cc, 0x092ca, 0x252c6, 0x01e91,
+    0x08c2a, 0x24c63, 0x2738f, 0x27b2a, 0x28497, 0x2db59, 0x09b8e, 0x1bb22, 0x09299, 0x27b61, 0x27a8e, 0x0bb28, 0x25b95, 0x2db57, 0x0ba8c, 0x1bb1f,
+    0x02c34, 0x24c6a, 0x2cd57, 0x2cd73, 0x04e82, 0x284ac, 0x084ca, 0x084d3, 0x1ed6a, 0x2c5ac, 0x22d73, 0x205ae, 0x06eac, 0x2b0d9, 0x1dcd3, 0x0dcac,
+    0x02c3b, 0x24c6c, 0x26d61, 0x26577, 0x14e87, 0x2d3ad, 0x0b3cb, 0x21f87, 0x2eda5, 0x2d3b2, 0x2c5a8, 0x2d39c, 0x0b3d3, 0x2d3ac, 0x0b3ca, 0x01f82,
+    0x02c41, 0x26d6c, 0x2cd59, 0x26574, 0x2849c, 0x292b2, 0x292a8, 0x2baa5, 0x22d6f, 0x292ad, 0x22d76, 0x13a6f, 0x292ae, 0x292ac, 0x17a73, 0x11e6a,
+    0x08c45, 0x2736d, 0x26d63, 0x0bb45, 0x25277, 0x27b6c, 0x25a61, 0x07b3b, 0x25274, 0x25a6c, 0x29a59, 0x0bb41, 0x29a73, 0x25a6a, 0x17a57, 0x19e34,
+    0x0ec43, 0x28c73, 0x24d95, 0x0a5a9, 0x28e84, 0x284ae, 0x024cc, 0x29fd1, 0x04fa5, 0x0a5d3, 0x265d2, 0x218d1, 0x06eb2, 0x19dac, 0x1b8a6, 0x05c72,
+    0x14c47, 0x24474, 0x08499, 0x2d393, 0x28e89, 0x23b6f, 0x273c0, 0x23f5e, 0x273cf, 0x2fba5, 0x273c1, 0x2d392, 0x059a5, 0x1fb6a, 0x05991, 0x11d42,
+    0x02c4d, 0x24477, 0x29297, 0x29293, 0x2929d, 0x2929c, 0x29296, 0x29292, 0x29889, 0x15887, 0x17862, 0x1385e, 0x29884, 0x05882, 0x13858, 0x1dc42,
+    0x08c4f, 0x09a45, 0x09a2a, 0x09a20, 0x03a4d, 0x03a41, 0x03a28, 0x07b1b, 0x15a47, 0x03a3b, 0x15a22, 0x01a1b, 0x0fa43, 0x03a34, 0x0fa1f, 0x01a0a,
+    0x00d07, 0x06d32, 0x20d1b, 0x20d3b, 0x00a4a, 0x1086e, 0x0cb92, 0x029a5, 0x1ed32, 0x2097c, 0x22d3b, 0x2097e, 0x00b6e, 0x029ab, 0x0e9a5, 0x03eb1,
+    0x08d1b, 0x0ad3b, 0x26d22, 0x26d47, 0x10e92, 0x1eca5, 0x048c1, 0x052cf, 0x2e55e, 0x2c587, 0x2e562, 0x20589, 0x1c5d1, 0x052d3, 0x192d2, 0x03ea5,
+    0x00d17, 0x26d37, 0x20d1d, 0x20d3d, 0x012ce, 0x272ba, 0x212a3, 0x21289, 0x2ed37, 0x2c580, 0x2ed3d, 0x21281, 0x2f2ba, 0x212b9, 0x2f289, 0x21e7e,
+    0x08d1d, 0x26d3d, 0x26d24, 0x26d49, 0x092a3, 0x27289, 0x27266, 0x27a47, 0x2e55f, 0x27288, 0x2d263, 0x21a3d, 0x252a2, 0x27287, 0x2d262, 0x21a3b,
+    0x02d32, 0x08c7c, 0x2455e, 0x26587, 0x18e6e, 0x1ecab, 0x005d1, 0x192d3, 0x16f7c, 0x245b7, 0x2a587, 0x205b9, 0x06fab, 0x012d4, 0x1d2d3, 0x03eab,
+    0x08d3b, 0x08c7e, 0x24562, 0x26589, 0x12ca5, 0x1ecb1, 0x052d2, 0x1fba5, 0x28587, 0x085b9, 0x2a5a2, 0x265ba, 0x012d3, 0x1fbab, 0x052d1, 0x11f6e,
+    0x02d37, 0x24580, 0x2455f, 0x2d288, 0x032ba, 0x092b9, 0x2d2a2, 0x2d287, 0x2a580, 0x252b8, 0x2f288, 0x2d280, 0x172b9, 0x252b7, 0x2f287, 0x21e7c,
+    0x08d3d, 0x09281, 0x27263, 0x27a3d, 0x09289, 0x09b7e, 0x27262, 0x0ba3b, 0x25288, 0x25280, 0x2725f, 0x27a37, 0x25287, 0x09b7c, 0x2725e, 0x07a32,
+    0x16d1b, 0x2655e, 0x2ed22, 0x2c562, 0x04e92, 0x045d1, 0x1cbc1, 0x1d2d2, 0x16d3b, 0x2e587, 0x2ed47, 0x2e589, 0x1afa5, 0x112d3, 0x1d2cf, 0x0fea5,
+    0x24d22, 0x26562, 0x24d52, 0x26566, 0x00ec1, 0x012d2, 0x012d0, 0x05fc1, 0x2a562, 0x2c5a2, 0x2e566, 0x205a3, 0x0d2d2, 0x012d1, 0x1dcc1, 0x0dc92,
+    0x16d1d, 0x2655f, 0x2ed24, 0x2f263, 0x172a3, 0x2b2a2, 0x2f266, 0x2f262, 0x16d3d, 0x2b288, 0x2ed49, 0x2fa3d, 0x17289, 0x2b287, 0x2fa47, 0x23a3b,
+    0x24d24, 0x25263, 0x25253, 0x27a24, 0x25266, 0x25262, 0x25a52, 0x27a22, 0x29263, 0x2525f, 0x2fa24, 0x21a1d, 0x29262, 0x2525e, 0x2fa22, 0x21a1b,
+    0x14d3b, 0x24587, 0x28562, 0x245a2, 0x06fa5, 0x0d2d3, 0x112d2, 0x1d2d1, 0x16f7e, 0x165b9, 0x16589, 0x2e5ba, 0x06fb1, 0x078ab, 0x1b8a5, 0x01c6e,
+    0x24d47, 0x08589, 0x24566, 0x085a3, 0x012cf, 0x13ba5, 0x019c1, 0x1df92, 0x28589, 0x025ba, 0x165a3, 0x005ce, 0x078a5, 0x1996e, 0x19c92, 0x01d4a,
+    0x28d3d, 0x29288, 0x2b263, 0x2f25f, 0x29289, 0x29287, 0x2b262, 0x2f25e, 0x17281, 0x2b280, 0x17a3d, 0x2fa37, 0x1787e, 0x1787c, 0x17a3b, 0x1fa32,
+    0x24d49, 0x09a3d, 0x25a24, 0x09a1d, 0x25a47, 0x09a3b, 0x25a22, 0x09a1b, 0x29a3d, 0x03a37, 0x17a1d, 0x01a17, 0x15a3b, 0x03a32, 0x17a1b, 0x01a07,
+    0x04d0c, 0x06d35, 0x1ad20, 0x1ad45, 0x10a4c, 0x1086f, 0x00893, 0x07674, 0x10b44, 0x00983, 0x1e959, 0x0b671, 0x00b75, 0x077ad, 0x1b6a7, 0x0b66c,
+    0x04c20, 0x06d45, 0x06d2a, 0x0774f, 0x1c893, 0x1b374, 0x07399, 0x27747, 0x20993, 0x1b377, 0x1b697, 0x0b74d, 0x073a9, 0x21773, 0x1b695, 0x27743,
+    0x06d1d, 0x06d3d, 0x1ad24, 0x1b649, 0x072a3, 0x07289, 0x1b266, 0x1b647, 0x2295f, 0x1b288, 0x21263, 0x2163d, 0x192a2, 0x1b287, 0x21262, 0x2d63b,
+    0x0ad24, 0x0b349, 0x2722c, 0x27214, 0x0b266, 0x0b347, 0x2722b, 0x27213, 0x0b265, 0x0b348, 0x2122a, 0x21212, 0x0b264, 0x0b346, 0x21229, 0x0be0e,
+    0x0ce44, 0x0ac83, 0x0ac93, 0x07677, 0x1ce75, 0x1b7ad, 0x192a9, 0x0b773, 0x04f9b, 0x052af, 0x1b6a8, 0x0b670, 0x052b3, 0x077ab, 0x1b6a6, 0x0b66b,
+    0x02c59, 0x1b371, 0x07397, 0x1b74d, 0x073a7, 0x2136c, 0x07395, 0x2d743, 0x073a8, 0x1b370, 0x07396, 0x2774b, 0x073a6, 0x2136b, 0x07394, 0x2773f,
+    0x02c5f, 0x07288, 0x1b265, 0x1b648, 0x072a2, 0x07287, 0x1b264, 0x1b646, 0x072a1, 0x07286, 0x21261, 0x2163c, 0x072a0, 0x07285, 0x21260, 0x2d63a,
+    0x0b263, 0x2733d, 0x2722a, 0x27212, 0x0b262, 0x2733b, 0x27229, 0x1bb0e, 0x0b261, 0x2733c, 0x27228, 0x27211, 0x0b260, 0x2733a, 0x27227, 0x07f0b,
+    0x10f41, 0x26d6f, 0x22d59, 0x07676, 0x04e9c, 0x052ae, 0x192a8, 0x07673, 0x1ed6c, 0x192ad, 0x22d74, 0x0b66f, 0x192b2, 0x192ac, 0x1b6a5, 0x0b66a,
+    0x08d59, 0x1b376, 0x26d65, 0x0774e, 0x052a8, 0x1b373, 0x07398, 0x27746, 0x052a7, 0x1b375, 0x1b693, 0x0b74c, 0x052a6, 0x1b372, 0x1b691, 0x27742,
+    0x02d55, 0x26d71, 0x2125b, 0x21645, 0x0729f, 0x07284, 0x2125a, 0x21643, 0x22d71, 0x1b283, 0x2fa45, 0x21635, 0x17284, 0x1b282, 0x2fa43, 0x2d634,
+    0x2525b, 0x0b345, 0x27224, 0x2720f, 0x2525a, 0x0b343, 0x27223, 0x27a0e, 0x25259, 0x0b344, 0x2d220, 0x21a0c, 0x25258, 0x0b342, 0x2fa1f, 0x1be0a,
+    0x02d6c, 0x052ad, 0x192a7, 0x07675, 0x052b2, 0x052ac, 0x192a6, 0x07672, 0x052b1, 0x052ab, 0x192a5, 0x0b66e, 0x052b0, 0x052aa, 0x192a4, 0x03e68,
+    0x02c74, 0x1b36f, 0x07393, 0x1b74c, 0x073a5, 0x2136a, 0x07391, 0x2d742, 0x052a5, 0x1b36e, 0x07392, 0x2774a, 0x073a4, 0x23b68, 0x07390, 0x2773e,
+    0x02d71, 0x07283, 0x2f259, 0x21644, 0x29284, 0x07282, 0x2f258, 0x21642, 0x1727e, 0x2b27c, 0x2ba3b, 0x2fa32, 0x1727d, 0x2b27b, 0x17a39, 0x23a30,
+    0x25a45, 0x27335, 0x27220, 0x27a0c, 0x25a43, 0x27334, 0x25a1f, 0x0ba0a, 0x29a3b, 0x09a32, 0x2ba1b, 0x27a07, 0x29a39, 0x03a30, 0x17a19, 0x07a04,
+    0x00e0b, 0x1883a, 0x18927, 0x04960, 0x18a3f, 0x12e6b, 0x0cb94, 0x008a6, 0x1cb3a, 0x00985, 0x10960, 0x009a0, 0x06e6b, 0x00aab, 0x0cba6, 0x03db3,
+    0x0cc1f, 0x1cc57, 0x06c8c, 0x1ac95, 0x16e58, 0x12c73, 0x188c6, 0x1dfd2, 0x08f91, 0x286ca, 0x1a9c6, 0x0a9cc, 0x26ea6, 0x286d3, 0x093da, 0x0dfa6,
+    0x00d32, 0x06c7c, 0x1895e, 0x1a987, 0x24e6e, 0x16cab, 0x029d1, 0x252d3, 0x10f7c, 0x189b7, 0x1e987, 0x209b9, 0x26fab, 0x032d4, 0x292d3, 0x01eab,
+    0x0ee44, 0x06c83, 0x06c93, 0x0ba77, 0x28e75, 0x2acad, 0x252a9, 0x07b73, 0x08f9b, 0x092af, 0x27aa8, 0x0ba70, 0x092b3, 0x27bab, 0x27aa6, 0x05f6b,
+    0x00e1c, 0x12c5d, 0x0acbc, 0x20cc5, 0x24e54, 0x12e70, 0x026d6, 0x13dcc, 0x0af5d, 0x246c9, 0x2efc5, 0x012db, 0x0ae70, 0x21db9, 0x0bdcc, 0x01da0,
+    0x14e23, 0x16c61, 0x26cbe, 0x2ccc7, 0x16e5a, 0x16e77, 0x253d7, 0x1fb95, 0x24698, 0x286cb, 0x093d8, 0x2fbc5, 0x26ea8, 0x1fd87, 0x1bdc6, 0x11d60,
+    0x02e3c, 0x28c86, 0x0acc0, 0x252cb, 0x24e70, 0x286af, 0x252cc, 0x252ca, 0x08f86, 0x032cd, 0x292cb, 0x252c9, 0x086af, 0x19db7, 0x292ca, 0x01d85,
+    0x14e48, 0x28c88, 0x25299, 0x0bb61, 0x28e77, 0x25b83, 0x09b95, 0x07b57, 0x0929e, 0x09b86, 0x25298, 0x0bb5d, 0x09b9b, 0x11b7c, 0x09b91, 0x1df3a,
+    0x00f1f, 0x14c91, 0x10d8c, 0x1e9c6, 0x0ae58, 0x2aea6, 0x1cbc6, 0x150da, 0x06f57, 0x246ca, 0x1ef95, 0x129cc, 0x06f73, 0x246d3, 0x19cd2, 0x01ca6,
+    0x02e29, 0x14c95, 0x00dbe, 0x032d7, 0x24e64, 0x286a9, 0x032d8, 0x1dfc6, 0x08f95, 0x246cc, 0x0f2d7, 0x032d6, 0x246a9, 0x03dd1, 0x19cc6, 0x01c94,
+    0x02e44, 0x28c9b, 0x12f93, 0x2baa8, 0x24e75, 0x292b3, 0x292a9, 0x2baa6, 0x24f83, 0x292af, 0x17a77, 0x13a70, 0x26fad, 0x178ab, 0x13873, 0x11c6b,
+    0x02e4e, 0x25a77, 0x25a66, 0x25a5a, 0x25278, 0x25a75, 0x25a64, 0x0ba58, 0x29a77, 0x25a70, 0x17a5a, 0x25a54, 0x29a75, 0x25a6e, 0x17a58, 0x19e3f,
+    0x02e23, 0x28698, 0x16fbe, 0x290d8, 0x24e5a, 0x2aea8, 0x290d7, 0x1fdc6, 0x0af61, 0x246cb, 0x2efc7, 0x218c5, 0x0ae77, 0x1bd87, 0x1b895, 0x05d60,
+    0x02e2b, 0x28699, 0x290d5, 0x17bbe, 0x24e66, 0x13b93, 0x019be, 0x13b8c, 0x24699, 0x17bc0, 0x278be, 0x13bbc, 0x07893, 0x19d5e, 0x0598c, 0x19d27,
+    0x02e48, 0x2929e, 0x29299, 0x29298, 0x24e77, 0x2989b, 0x15895, 0x15891, 0x24f88, 0x29886, 0x17861, 0x1385d, 0x07883, 0x0787c, 0x1d857, 0x19c3a,
+    0x02e50, 0x03a48, 0x03a2b, 0x03a23, 0x03a4e, 0x03a44, 0x03a29, 0x01b1f, 0x15a48, 0x03a3c, 0x15a23, 0x01a1c, 0x0fa44, 0x01932, 0x0d81f, 0x01a0b,
+    0x10c0e, 0x1883b, 0x04929, 0x04962, 0x1ca43, 0x1086c, 0x00895, 0x2b7a7, 0x10b46, 0x00987, 0x10964, 0x009a2, 0x04a73, 0x177ad, 0x0cba9, 0x15f75,
+    0x10c22, 0x1cc59, 0x06c8e, 0x21397, 0x12e62, 0x2f776, 0x1b3c7, 0x2ff62, 0x069c1, 0x213a8, 0x073c8, 0x21396, 0x1b3d2, 0x2f773, 0x1b3c6, 0x2bf58,
+    0x04d3b, 0x06c7e, 0x18962, 0x06989, 0x16ca5, 0x177b1, 0x092d2, 0x2b7a5, 0x1c987, 0x069b9, 0x1e9a2, 0x269ba, 0x032d3, 0x177ab, 0x092d1, 0x15f6e,
+    0x00c59, 0x27371, 0x0b397, 0x27b4d, 0x0b3a7, 0x2d36c, 0x0b395, 0x21b43, 0x0b3a8, 0x27370, 0x0b396, 0x27b4b, 0x0b3a6, 0x2d36b, 0x0b394, 0x1bb3f,
+    0x10e23, 0x12c61, 0x06cbe, 0x237c7, 0x1ce5a, 0x12e77, 0x193d7, 0x2b795, 0x04f98, 0x1f7cb, 0x053d8, 0x2f7c5, 0x1aea8, 0x2bd87, 0x27dc6, 0x15d60,
+    0x10c52, 0x12c65, 0x273c3, 0x2138e, 0x12e66, 0x2ff4e, 0x213be, 0x2ff29, 0x273d0, 0x23798, 0x273c2, 0x2138d, 0x21dc1, 0x13f46, 0x213bd, 0x13f21,
+    0x0ec61, 0x16ca1, 0x092c7, 0x092c0, 0x14ea8, 0x1779b, 0x092c6, 0x2b791, 0x032cb, 0x032c9, 0x092c5, 0x092bf, 0x032ca, 0x17d85, 0x092c4, 0x15d5c,
+    0x14c65, 0x27b5f, 0x2738e, 0x27b28, 0x25b93, 0x23f44, 0x2738c, 0x21b1f, 0x09298, 0x27b5d, 0x2738d, 0x27b26, 0x25b91, 0x1ff3a, 0x09b8b, 0x1ff1a,
+    0x00f43, 0x14ca5, 0x1cd95, 0x237d2, 0x04e84, 0x177b2, 0x10bcc, 0x2b7a6, 0x18f73, 0x1f7d3, 0x10ba9, 0x2f7d1, 0x06eae, 0x177ac, 0x05cd1, 0x0fd72,
+    0x0ee62, 0x213a7, 0x073c7, 0x21395, 0x16ea2, 0x2f775, 0x073c5, 0x2ff60, 0x073d2, 0x213a6, 0x073c6, 0x21394, 0x073d1, 0x2f772, 0x073c4, 0x2bf56,
+    0x0cd6c, 0x292b1, 0x292a7, 0x292a5, 0x152b2, 0x292b0, 0x292a6, 0x292a4, 0x152ad, 0x292ab, 0x17a75, 0x13a6e, 0x152ac, 0x292aa, 0x17a72, 0x11e68,
+    0x25276, 0x2736c, 0x25a62, 0x0bb43, 0x25275, 0x27369, 0x25a60, 0x07b39, 0x25273, 0x2736b, 0x29a58, 0x0bb3f, 0x25272, 0x27b68, 0x17a56, 0x05e33,
+    0x00e5a, 0x16ea8, 0x150d7, 0x237c6, 0x06e9f, 0x1779c, 0x290d6, 0x2b794, 0x06ea8, 0x1f7ca, 0x2d8c6, 0x2f7c4, 0x1bd9c, 0x1bd82, 0x07d94, 0x01d56,
+    0x14e66, 0x2fb93, 0x273be, 0x2d38c, 0x16ea3, 0x23f4c, 0x273bc, 0x23f27, 0x278c1, 0x2fb91, 0x273bd, 0x2fb8b, 0x1bd92, 0x13f42, 0x0598b, 0x11d1e,
+    0x0ee77, 0x2929b, 0x29295, 0x29291, 0x1529c, 0x2929a, 0x29294, 0x29290, 0x29887, 0x29885, 0x17860, 0x1385c, 0x07882, 0x19d7b, 0x1d856, 0x05c38,
+    0x09a4e, 0x09a44, 0x09a29, 0x0bb1f, 0x03a4c, 0x23f40, 0x03a27, 0x07b19, 0x15a46, 0x03a3a, 0x15a21, 0x01a1a, 0x0fa42, 0x11930, 0x0fa1e, 0x05b09,
+    0x00c11, 0x0483c, 0x18928, 0x04961, 0x00a4b, 0x10870, 0x0cb96, 0x008a8, 0x1cb3c, 0x00986, 0x10961, 0x009a1, 0x00b70, 0x00aaf, 0x0cba8, 0x03e9b,
+    0x00c28, 0x18c61, 0x04d8e, 0x1ac99, 0x10e96, 0x1c8a8, 0x052c8, 0x052c1, 0x0efc0, 0x052cb, 0x192c7, 0x192c0, 0x012cc, 0x052ca, 0x192c6, 0x03e91,
+    0x00d37, 0x06c80, 0x1895f, 0x21288, 0x012ba, 0x072b9, 0x212a2, 0x21287, 0x10f80, 0x192b8, 0x23288, 0x21280, 0x1f2b9, 0x192b7, 0x23287, 0x2de7c,
+    0x00c5f, 0x0b288, 0x27265, 0x27a48, 0x092a2, 0x0b287, 0x27264, 0x27a46, 0x092a1, 0x27286, 0x2d261, 0x21a3c, 0x092a0, 0x27285, 0x2d260, 0x21a3a,
+    0x00e3c, 0x1cc86, 0x06cc0, 0x192cb, 0x18e70, 0x1ecaf, 0x192cc, 0x192ca, 0x04f86, 0x012cd, 0x1d2cb, 0x192c9, 0x06faf, 0x25db7, 0x1d2ca, 0x03d85,
+    0x0cc61, 0x1eca1, 0x052c7, 0x052c0, 0x10ea8, 0x1fb9b, 0x052c6, 0x1fb91, 0x012cb, 0x012c9, 0x052c5, 0x052bf, 0x012ca, 0x1fd85, 0x052c4, 0x11d5c,
+    0x00c80, 0x012b8, 0x212a1, 0x21286, 0x012b9, 0x012b7, 0x212a0, 0x21285, 0x112b8, 0x012b6, 0x2f286, 0x2127f, 0x112b7, 0x012b5, 0x2f285, 0x01e7a,
+    0x09288, 0x09280, 0x27261, 0x27a3c, 0x09287, 0x25b7c, 0x27260, 0x0ba3a, 0x09286, 0x0927f, 0x2725d, 0x27a36, 0x09285, 0x09b7a, 0x2725c, 0x05f31,
+    0x10f28, 0x02cc0, 0x1cd8e, 0x1d2c7, 0x04e96, 0x112cc, 0x1d2c8, 0x1d2c6, 0x1cf61, 0x112cb, 0x1ef99, 0x1d2c0, 0x18ba8, 0x112ca, 0x1d2c1, 0x0fe91,
+    0x00d8e, 0x012c7, 0x012c3, 0x052be, 0x012c8, 0x012c6, 0x012c2, 0x052bd, 0x0d2c7, 0x012c5, 0x1d2be, 0x192bc, 0x0d2c6, 0x012c4, 0x1d2bd, 0x03e8b,
+    0x10f5f, 0x172a1, 0x2f265, 0x2f261, 0x172a2, 0x172a0, 0x2f264, 0x2f260, 0x17288, 0x17286, 0x2fa48, 0x2fa3c, 0x17287, 0x17285, 0x2fa46, 0x23a3a,
+    0x25265, 0x25261, 0x25252, 0x27a23, 0x25264, 0x25260, 0x25251, 0x27a21, 0x29261, 0x2525d, 0x2fa23, 0x21a1c, 0x29260, 0x2525c, 0x2fa21, 0x21a1a,
+    0x00f61, 0x0d2cb, 0x112c7, 0x1d2c5, 0x04ea8, 0x0d2ca, 0x112c6, 0x1d2c4, 0x06fa1, 0x112c9, 0x112c0, 0x1d2bf, 0x0789b, 0x07d85, 0x1b891, 0x01d5c,
+    0x0ec99, 0x012c0, 0x012be, 0x012bc, 0x012c1, 0x13b91, 0x012bd, 0x1fb8b, 0x0d2c0, 0x012bf, 0x112bc, 0x012bb, 0x07891, 0x19d5c, 0x0788b, 0x01d25,
+    0x15288, 0x29286, 0x2b261, 0x2f25d, 0x15287, 0x29285, 0x2b260, 0x2f25c, 0x17280, 0x1727f, 0x17a3c, 0x2fa36, 0x2b87c, 0x0787a, 0x17a3a, 0x1dc31,
+    0x25a48, 0x09a3c, 0x25a23, 0x09a1c, 0x25a46, 0x09a3a, 0x25a21, 0x09a1a, 0x29a3c, 0x03a36, 0x17a1c, 0x01a16, 0x15a3a, 0x03a31, 0x17a1a, 0x01a06,
+    0x04c12, 0x0483d, 0x0492a, 0x07763, 0x10a4d, 0x10871, 0x05797, 0x0b759, 0x10b48, 0x05788, 0x10965, 0x0b75f, 0x00b77, 0x05783, 0x05793, 0x25f44,
+    0x04c2a, 0x1b763, 0x0738f, 0x0772a, 0x19797, 0x21759, 0x0578e, 0x27722, 0x05299, 0x1b761, 0x0768e, 0x0b728, 0x19795, 0x21757, 0x0768c, 0x2771f,
+    0x04d3d, 0x07281, 0x1b263, 0x0763d, 0x05289, 0x0777e, 0x1b262, 0x0763b, 0x19288, 0x19280, 0x1b25f, 0x27637, 0x19287, 0x0777c, 0x1b25e, 0x27632,
+    0x07263, 0x0733d, 0x0722a, 0x07212, 0x07262, 0x1b33b, 0x07229, 0x2770e, 0x07261, 0x0733c, 0x1b228, 0x1b211, 0x07260, 0x1b33a, 0x1b227, 0x27f0b,
+    0x10e48, 0x19788, 0x19299, 0x07761, 0x1ce77, 0x19783, 0x05795, 0x25757, 0x0529e, 0x05786, 0x19298, 0x0b75d, 0x0579b, 0x1777c, 0x05791, 0x29f3a,
+    0x10c65, 0x1b75f, 0x0738e, 0x1b728, 0x19793, 0x2ff44, 0x1b38c, 0x2d71f, 0x05298, 0x1b75d, 0x0738d, 0x27726, 0x19791, 0x2bf3a, 0x0578b, 0x2bf1a,
+    0x05288, 0x07280, 0x1b261, 0x0763c, 0x05287, 0x1977c, 0x1b260, 0x0763a, 0x05286, 0x0727f, 0x1b25d, 0x27636, 0x05285, 0x0777a, 0x1b25c, 0x27631,
+    0x0b25f, 0x27337, 0x0b228, 0x0b211, 0x0b25e, 0x21332, 0x0b227, 0x21f0b, 0x0b25d, 0x27336, 0x27226, 0x27210, 0x0b25c, 0x21331, 0x27225, 0x27f06,
+    0x10f4d, 0x05789, 0x19297, 0x07762, 0x0529d, 0x05784, 0x19296, 0x0b758, 0x1cb77, 0x05787, 0x19293, 0x0b75e, 0x1929c, 0x05782, 0x19292, 0x25f42,
+    0x05297, 0x1b762, 0x0528e, 0x07729, 0x05296, 0x21758, 0x0528d, 0x27721, 0x05295, 0x1b760, 0x1928c, 0x0b727, 0x05294, 0x21756, 0x0768b, 0x2771e,
+    0x10d71, 0x0727e, 0x21259, 0x1b63b, 0x05284, 0x0727d, 0x21258, 0x07639, 0x19283, 0x1927c, 0x2fa44, 0x21632, 0x19282, 0x1927b, 0x2fa42, 0x27630,
+    0x0b259, 0x0733b, 0x27222, 0x2720e, 0x0b258, 0x07339, 0x27221, 0x2720d, 0x25257, 0x0733a, 0x2d21f, 0x21a0b, 0x25256, 0x07338, 0x2d21e, 0x07e09,
+    0x00e77, 0x19787, 0x19295, 0x07760, 0x0529c, 0x19782, 0x19294, 0x25756, 0x0529b, 0x05785, 0x19291, 0x0b75c, 0x0529a, 0x1777b, 0x19290, 0x29f38,
+    0x05293, 0x1b75e, 0x0738c, 0x1b727, 0x05292, 0x2ff42, 0x0738b, 0x2d71e, 0x05291, 0x1b75c, 0x0528b, 0x27725, 0x05290, 0x17f38, 0x0738a, 0x17f18,
+    0x05283, 0x0727c, 0x21257, 0x1b63a, 0x05282, 0x0727b, 0x21256, 0x07638, 0x1727c, 0x0727a, 0x2ba3a, 0x21631, 0x1727b, 0x07279, 0x17a38, 0x2762f,
+    0x25a44, 0x27332, 0x2721f, 0x27a0b, 0x25a42, 0x27330, 0x2721e, 0x07b09, 0x29a3a, 0x27331, 0x2ba1a, 0x27a06, 0x29a38, 0x2732f, 0x17a18, 0x07f03,
+    0x10d0a, 0x04842, 0x1ed1f, 0x1a958, 0x18a42, 0x10a72, 0x0cb91, 0x029a6, 0x12d34, 0x22982, 0x1ed43, 0x2e984, 0x06f6a, 0x00aac, 0x0cba5, 0x0fcb2,
+    0x00c34, 0x18c6a, 0x20d57, 0x20d73, 0x08e82, 0x12eac, 0x147ca, 0x19fd3, 0x2ad6a, 0x2e5ac, 0x2ed73, 0x2e5ae, 0x247ac, 0x1f0d9, 0x147d3, 0x0fcac,
+    0x10d1b, 0x1a95e, 0x22d22, 0x20962, 0x24792, 0x089d1, 0x287c1, 0x292d2, 0x12d3b, 0x22987, 0x22d47, 0x2e989, 0x26fa5, 0x152d3, 0x292cf, 0x0dea5,
+    0x14f41, 0x1ad6f, 0x2ed59, 0x20d76, 0x2479c, 0x092ae, 0x252a8, 0x0ba73, 0x2ad6c, 0x252ad, 0x2a574, 0x0ba6f, 0x252b2, 0x252ac, 0x27aa5, 0x05e6a,
+    0x02f1f, 0x10c91, 0x14d8c, 0x2a5c6, 0x06e58, 0x1eea6, 0x287c6, 0x110da, 0x24f57, 0x165ca, 0x2af95, 0x125cc, 0x0af73, 0x05dd3, 0x287d2, 0x03ca6,
+    0x02f43, 0x10ca5, 0x28d95, 0x2a5d2, 0x08e84, 0x12eb2, 0x147cc, 0x1fba6, 0x24f73, 0x165d3, 0x147a9, 0x2fbd1, 0x087ae, 0x1ddac, 0x09cd1, 0x0dd72,
+    0x14f28, 0x2a5c0, 0x28d8e, 0x292c7, 0x24796, 0x152cc, 0x292c8, 0x292c6, 0x28f61, 0x152cb, 0x16599, 0x292c0, 0x247a8, 0x152ca, 0x292c1, 0x0de91,
+    0x14f4d, 0x09b89, 0x25297, 0x0bb62, 0x0929d, 0x09b84, 0x25296, 0x07b58, 0x28777, 0x09b87, 0x25293, 0x0bb5e, 0x2529c, 0x09b82, 0x25292, 0x19f42,
+    0x0ef1b, 0x2e592, 0x12d28, 0x2e596, 0x0ae5e, 0x2eed1, 0x287c0, 0x130cc, 0x12d41, 0x2e59c, 0x12d4d, 0x2f09d, 0x0af6f, 0x2f0ae, 0x2fc89, 0x2fc84,
+    0x0ef3b, 0x2cda5, 0x2ad61, 0x2e5a8, 0x08e87, 0x170d3, 0x170cb, 0x170ca, 0x28f6c, 0x2f0b2, 0x2a577, 0x2f09c, 0x2f0ad, 0x2f0ac, 0x23c87, 0x23c82,
+    0x16d20, 0x2e593, 0x16d2a, 0x2e597, 0x24793, 0x170a9, 0x17099, 0x2ba95, 0x16d45, 0x2b077, 0x16d4f, 0x1384d, 0x2b074, 0x2f873, 0x23847, 0x1f843,
+    0x14f45, 0x29274, 0x2ad63, 0x25a59, 0x29277, 0x25a73, 0x29a61, 0x25a57, 0x2b06d, 0x29a6c, 0x17845, 0x13841, 0x2b86c, 0x29a6a, 0x1383b, 0x1de34,
+    0x02f22, 0x165c1, 0x16f8e, 0x170c8, 0x0ae62, 0x2b0d2, 0x2b0c7, 0x2b0c6, 0x24f59, 0x2f0a8, 0x2f097, 0x2f096, 0x0af76, 0x21873, 0x21c62, 0x1bc58,
+    0x02f47, 0x170cf, 0x14799, 0x170c1, 0x08e89, 0x119a5, 0x2b0c0, 0x11991, 0x28774, 0x2d8a5, 0x2f093, 0x2f092, 0x1b86f, 0x1996a, 0x1bc5e, 0x05d42,
+    0x28f2a, 0x15299, 0x1708f, 0x17a8e, 0x24797, 0x29895, 0x2988e, 0x17a8c, 0x28f63, 0x2b861, 0x1782a, 0x13828, 0x2f859, 0x21857, 0x23822, 0x1f81f,
+    0x28f4f, 0x03a47, 0x29a2a, 0x03a22, 0x15a4d, 0x03a43, 0x15a28, 0x03a1f, 0x15a45, 0x0fa3b, 0x15a20, 0x0fa1b, 0x15a41, 0x0fa34, 0x1181b, 0x0da0a,
+    0x18d0e, 0x04843, 0x18923, 0x0495a, 0x18a46, 0x0c873, 0x0cb98, 0x029a8, 0x10b43, 0x00984, 0x1e95a, 0x0099f, 0x00b73, 0x00aae, 0x0e9a8, 0x0fc9c,
+    0x00c3b, 0x18c6c, 0x1ad61, 0x1a977, 0x10e87, 0x213ad, 0x073cb, 0x2df87, 0x22da5, 0x213b2, 0x209a8, 0x2139c, 0x073d3, 0x213ac, 0x073ca, 0x03f82,
+    0x18d22, 0x1a962, 0x18d52, 0x1a966, 0x02ec1, 0x032d2, 0x032d0, 0x09fc1, 0x1e962, 0x209a2, 0x22966, 0x209a3, 0x0f2d2, 0x032d1, 0x29cc1, 0x0fc92,
+    0x04d59, 0x27376, 0x1ad65, 0x27b4e, 0x092a8, 0x27373, 0x0b398, 0x1bb46, 0x092a7, 0x27375, 0x27a93, 0x0bb4c, 0x092a6, 0x27372, 0x27a91, 0x1bb42,
+    0x00e29, 0x10c95, 0x02dbe, 0x012d7, 0x18e64, 0x1eea9, 0x012d8, 0x29fc6, 0x04f95, 0x18acc, 0x0d2d7, 0x012d6, 0x1aea9, 0x01dd1, 0x25cc6, 0x03c94,
+    0x0ce62, 0x2d3a7, 0x0b3c7, 0x2d395, 0x10ea2, 0x23b75, 0x273c5, 0x23f60, 0x0b3d2, 0x2d3a6, 0x0b3c6, 0x2d394, 0x273d1, 0x1ff72, 0x273c4, 0x1ff56,
+    0x02d8e, 0x032c7, 0x032c3, 0x092be, 0x032c8, 0x032c6, 0x032c2, 0x092bd, 0x0f2c7, 0x032c5, 0x292be, 0x252bc, 0x0f2c6, 0x032c4, 0x292bd, 0x01e8b,
+    0x09297, 0x27b62, 0x0928e, 0x27b29, 0x09296, 0x2db58, 0x0928d, 0x1bb21, 0x09295, 0x27b60, 0x2528c, 0x0bb27, 0x09294, 0x2db56, 0x27a8b, 0x19f1e,
+    0x0cf3b, 0x20da5, 0x1ed61, 0x229a8, 0x04e87, 0x130d3, 0x130cb, 0x130ca, 0x1cf6c, 0x230b2, 0x1e977, 0x2309c, 0x230ad, 0x230ac, 0x2fc87, 0x2fc82,
+    0x00d7e, 0x213b1, 0x20da1, 0x2139b, 0x00eb9, 0x213ab, 0x130c9, 0x21f85, 0x2f0b1, 0x2f0b0, 0x2f09b, 0x2f09a, 0x2f0ab, 0x2f0aa, 0x2fc85, 0x0fc7b,
+    0x10d59, 0x152a7, 0x22d65, 0x2ba93, 0x152a8, 0x152a6, 0x17098, 0x2ba91, 0x2b076, 0x2b075, 0x1784e, 0x1384c, 0x2b073, 0x2b072, 0x23846, 0x1f842,
+    0x25271, 0x2526c, 0x25a5f, 0x0bb44, 0x25270, 0x2526b, 0x25a5d, 0x07b3a, 0x2926c, 0x25269, 0x17844, 0x0bb40, 0x2926b, 0x25a68, 0x1383a, 0x19e30,
+    0x00e62, 0x170d2, 0x170c7, 0x170c6, 0x06ea2, 0x170d1, 0x170c5, 0x170c4, 0x2f0a7, 0x2f0a6, 0x2f095, 0x2f094, 0x21875, 0x1bc72, 0x21c60, 0x05c56,
+    0x02e89, 0x2d3a5, 0x170c0, 0x2d391, 0x02eba, 0x23b6e, 0x170bf, 0x23f5c, 0x2f0a5, 0x2f0a4, 0x2f091, 0x2f090, 0x1b86e, 0x19968, 0x1bc5c, 0x01d38,
+    0x15297, 0x15295, 0x2928e, 0x2928c, 0x15296, 0x15294, 0x2928d, 0x17a8b, 0x2b862, 0x2b860, 0x17829, 0x13827, 0x2f858, 0x21856, 0x23821, 0x1dc1e,
+    0x25a4d, 0x09a43, 0x25a28, 0x09a1f, 0x03a4b, 0x03a3f, 0x03a26, 0x07b1a, 0x15a43, 0x03a39, 0x15a1f, 0x01a19, 0x15a3f, 0x03a33, 0x1181a, 0x01a09,
+    0x1cd0c, 0x04844, 0x1ed20, 0x1a959, 0x00a4c, 0x0c875, 0x0cb93, 0x1f6a7, 0x1ed35, 0x22983, 0x1ed45, 0x13671, 0x00b6f, 0x134ad, 0x13674, 0x1766c,
+    0x00c41, 0x1ad6c, 0x20d59, 0x20d74, 0x10e9c, 0x1d2b2, 0x1d2a8, 0x1f6a5, 0x2ed6f, 0x1d2ad, 0x13676, 0x1366f, 0x1d2ae, 0x1d2ac, 0x13673, 0x1766a,
+    0x1ed1d, 0x1a95f, 0x22d24, 0x23263, 0x1f2a3, 0x1f2a2, 0x23266, 0x23262, 0x1ed3d, 0x1f288, 0x23649, 0x2f63d, 0x1f289, 0x1f287, 0x23647, 0x2f63b,
+    0x00d55, 0x1ad71, 0x2d25b, 0x2da45, 0x0929f, 0x27284, 0x2d25a, 0x2da43, 0x2ed71, 0x27283, 0x23645, 0x2f635, 0x1f284, 0x27282, 0x23643, 0x2f634,
+    0x00e44, 0x1cc9b, 0x16f93, 0x1f6a8, 0x18e75, 0x1d2b3, 0x1d2a9, 0x1f6a6, 0x18f83, 0x1d2af, 0x13677, 0x13670, 0x1f4ad, 0x1f4ab, 0x17473, 0x1766b,
+    0x0ed6c, 0x1d2b1, 0x1d2a7, 0x1d2a5, 0x112b2, 0x1d2b0, 0x1d2a6, 0x1d2a4, 0x112ad, 0x1d2ab, 0x13675, 0x1366e, 0x112ac, 0x1d2aa, 0x13672, 0x15e68,
+    0x14f5f, 0x1f2a1, 0x23265, 0x23261, 0x112a2, 0x1f2a0, 0x23264, 0x23260, 0x13288, 0x1f286, 0x23648, 0x2f63c, 0x13287, 0x1f285, 0x23646, 0x2f63a,
+    0x14d71, 0x0927e, 0x2d259, 0x27a3b, 0x09284, 0x0927d, 0x2d258, 0x27a39, 0x25283, 0x2527c, 0x23644, 0x21a32, 0x25282, 0x2527b, 0x23642, 0x1ba30,
+    0x12d20, 0x22993, 0x1ed2a, 0x1f697, 0x18b93, 0x130a9, 0x13099, 0x1f695, 0x12d45, 0x1f077, 0x1f44f, 0x1344d, 0x1f074, 0x23473, 0x2f447, 0x2b443,
+    0x14d59, 0x112a7, 0x2ed65, 0x1f693, 0x112a8, 0x112a6, 0x13098, 0x1f691, 0x1f076, 0x1f075, 0x1f44e, 0x1344c, 0x1f073, 0x1f072, 0x2f446, 0x2b442,
+    0x12d24, 0x13265, 0x2f22c, 0x2f22a, 0x13266, 0x13264, 0x2f22b, 0x2f229, 0x13049, 0x13048, 0x2f214, 0x2f212, 0x13047, 0x13046, 0x2f213, 0x13e0e,
+    0x1725b, 0x29259, 0x2f224, 0x2f220, 0x1725a, 0x29258, 0x2f223, 0x2da1f, 0x17045, 0x17044, 0x2f20f, 0x2fa0c, 0x17043, 0x17042, 0x2fa0e, 0x1fe0a,
+    0x0ef59, 0x130a8, 0x13097, 0x13096, 0x130a7, 0x130a6, 0x13095, 0x13094, 0x23071, 0x23070, 0x2344d, 0x2f44b, 0x2306c, 0x2306b, 0x2f443, 0x2f43f,
+    0x14d74, 0x112a5, 0x13093, 0x13092, 0x130a5, 0x130a4, 0x13091, 0x13090, 0x2306f, 0x2306e, 0x2344c, 0x2f44a, 0x2306a, 0x1b868, 0x2f442, 0x2f43e,
+    0x17263, 0x17261, 0x1722a, 0x2f228, 0x17262, 0x17260, 0x17229, 0x2f227, 0x1703d, 0x1703c, 0x17212, 0x2f211, 0x2b03b, 0x2b03a, 0x2380e, 0x1fc0b,
+    0x29a45, 0x25a3b, 0x2b220, 0x25a1b, 0x29a43, 0x09a39, 0x29a1f, 0x09a19, 0x17035, 0x29a32, 0x17a0c, 0x2fa07, 0x2b034, 0x15a30, 0x17a0a, 0x1fa04,
+    0x18d0f, 0x04845, 0x18924, 0x0765b, 0x00a4e, 0x19676, 0x19665, 0x07659, 0x10b45, 0x19671, 0x1d65b, 0x25655, 0x1d676, 0x1966f, 0x13659, 0x25e41,
+    0x04c45, 0x1b36d, 0x19663, 0x07745, 0x19277, 0x1b76c, 0x19661, 0x0b73b, 0x19274, 0x1966c, 0x1d659, 0x0b741, 0x1d673, 0x1966a, 0x1d657, 0x0b734,
+    0x18d24, 0x19263, 0x19253, 0x1b624, 0x19266, 0x19262, 0x19652, 0x1b622, 0x1d263, 0x1925f, 0x23624, 0x2161d, 0x1d262, 0x1925e, 0x23622, 0x2d61b,
+    0x0725b, 0x07345, 0x1b224, 0x1b20f, 0x0725a, 0x07343, 0x1b223, 0x1b60e, 0x19259, 0x07344, 0x21220, 0x2160c, 0x19258, 0x07342, 0x2361f, 0x2d60a,
+    0x00e4e, 0x19677, 0x19666, 0x0765a, 0x19278, 0x19675, 0x19664, 0x07658, 0x1d677, 0x19670, 0x1d65a, 0x25654, 0x1d675, 0x1966e, 0x13658, 0x25e3f,
+    0x19276, 0x1b36c, 0x19662, 0x07743, 0x19275, 0x1b369, 0x19660, 0x27739, 0x19273, 0x1b36b, 0x1d658, 0x0b73f, 0x19272, 0x1b768, 0x1d656, 0x27733,
+    0x19265, 0x19261, 0x19252, 0x1b623, 0x19264, 0x19260, 0x19251, 0x1b621, 0x1d261, 0x1925d, 0x23623, 0x2161c, 0x1d260, 0x1925c, 0x23621, 0x2d61a,
+    0x07259, 0x0b33b, 0x1b222, 0x1b20e, 0x07258, 0x27339, 0x1b221, 0x1b20d, 0x07257, 0x0b33a, 0x2121f, 0x2160b, 0x07256, 0x27338, 0x2121e, 0x27e09,
+    0x10f45, 0x1d274, 0x1d663, 0x19659, 0x1d277, 0x19673, 0x1d661, 0x07657, 0x1f06d, 0x1d66c, 0x13445, 0x13441, 0x1f46c, 0x1d66a, 0x1743b, 0x17434,
+    0x19271, 0x1926c, 0x1965f, 0x07744, 0x19270, 0x1926b, 0x1965d, 0x0b73a, 0x1d26c, 0x19269, 0x13444, 0x0b740, 0x1d26b, 0x19668, 0x1743a, 0x25e30,
+    0x1d25b, 0x1d259, 0x23224, 0x23220, 0x1d25a, 0x1d258, 0x23223, 0x2161f, 0x13045, 0x13044, 0x2320f, 0x2f60c, 0x13043, 0x13042, 0x2360e, 0x2f60a,
+    0x25255, 0x0b341, 0x2121d, 0x2120c, 0x25254, 0x0b33f, 0x2121c, 0x2120b, 0x13041, 0x13040, 0x2f20c, 0x21205, 0x1303f, 0x1303e, 0x2f20b, 0x21e04,
+    0x1d276, 0x1d273, 0x1d662, 0x19658, 0x1d275, 0x1d272, 0x1d660, 0x07656, 0x1f06c, 0x1f06b, 0x13443, 0x1343f, 0x23069, 0x23468, 0x17439, 0x17433,
+    0x1926f, 0x1b36a, 0x1965e, 0x07742, 0x1926e, 0x1b368, 0x1965c, 0x27738, 0x1f06a, 0x19268, 0x13442, 0x0b73e, 0x23068, 0x23067, 0x17438, 0x03e2e,
+    0x13259, 0x1d257, 0x23222, 0x2321f, 0x13258, 0x1d256, 0x23221, 0x2321e, 0x1703b, 0x1703a, 0x2320e, 0x2f60b, 0x17039, 0x17038, 0x2320d, 0x17e09,
+    0x25a41, 0x0b334, 0x2d21b, 0x2d20a, 0x25a3f, 0x27333, 0x2d21a, 0x27a09, 0x17034, 0x25a30, 0x2f20a, 0x21a04, 0x17033, 0x03a2e, 0x17a09, 0x19e02,
+    0x00f0e, 0x00846, 0x1c929, 0x00964, 0x18a43, 0x10a73, 0x0cb95, 0x029a9, 0x1cb3b, 0x0c987, 0x10962, 0x0e9a2, 0x04b6c, 0x0b4ad, 0x274a7, 0x09c75,
+    0x0cc43, 0x1cc73, 0x18d95, 0x069a9, 0x1ce84, 0x1eeae, 0x008cc, 0x1dfd1, 0x08fa5, 0x1b4d3, 0x214d2, 0x214d1, 0x0b4b2, 0x0b4ac, 0x274a6, 0x09c72,
+    0x10d3b, 0x18987, 0x1c962, 0x189a2, 0x0afa5, 0x0f2d3, 0x152d2, 0x292d1, 0x1ef7e, 0x1e9b9, 0x1e989, 0x2e9ba, 0x274b1, 0x274ab, 0x274a5, 0x03c6e,
+    0x00d6c, 0x092ad, 0x252a7, 0x0ba75, 0x092b2, 0x092ac, 0x252a6, 0x0ba72, 0x092b1, 0x092ab, 0x252a5, 0x0ba6e, 0x092b0, 0x092aa, 0x252a4, 0x01e68,
+    0x00e23, 0x10c98, 0x1efbe, 0x1d0d8, 0x06e5a, 0x1eea8, 0x1d0d7, 0x2bdc6, 0x06f61, 0x1b4cb, 0x214c7, 0x214c5, 0x06e77, 0x27d87, 0x27495, 0x09d60,
+    0x02e5a, 0x12ea8, 0x110d7, 0x2fbc6, 0x08e9f, 0x1fd9c, 0x1d0d6, 0x13d94, 0x0aea8, 0x1b4ca, 0x214c6, 0x214c4, 0x0b49c, 0x27d82, 0x27494, 0x03d56,
+    0x02f61, 0x0f2cb, 0x152c7, 0x292c5, 0x08ea8, 0x0f2ca, 0x152c6, 0x292c4, 0x08fa1, 0x152c9, 0x152c0, 0x292bf, 0x2749b, 0x27d85, 0x27491, 0x03d5c,
+    0x02e77, 0x25b87, 0x25295, 0x0bb60, 0x0929c, 0x25b82, 0x25294, 0x07b56, 0x0929b, 0x09b85, 0x25291, 0x0bb5c, 0x0929a, 0x1fd7b, 0x25290, 0x1df38,
+    0x00f22, 0x1e9c1, 0x1ef8e, 0x1f0c8, 0x06e62, 0x1f0d2, 0x1f0c7, 0x1f0c6, 0x18f59, 0x230a8, 0x23097, 0x23096, 0x2d476, 0x2d473, 0x2dc62, 0x27c58,
+    0x02e62, 0x130d2, 0x130c7, 0x130c6, 0x08ea2, 0x1f0d1, 0x1f0c5, 0x1f0c4, 0x230a7, 0x230a6, 0x23095, 0x23094, 0x2d475, 0x2d472, 0x2dc60, 0x09c56,
+    0x0cf59, 0x170a8, 0x17097, 0x17096, 0x170a7, 0x170a6, 0x17095, 0x17094, 0x2f071, 0x2f070, 0x2f84d, 0x2f84b, 0x2f06c, 0x2f06b, 0x23843, 0x2383f,
+    0x29276, 0x29273, 0x29a62, 0x25a58, 0x29275, 0x29272, 0x29a60, 0x25a56, 0x2b06c, 0x2b06b, 0x17843, 0x1383f, 0x2f069, 0x2f868, 0x1f839, 0x1de33,
+    0x00f52, 0x2f0d0, 0x2f0c3, 0x2f0c2, 0x0ae66, 0x2fdc1, 0x2f0be, 0x2f0bd, 0x0af65, 0x21498, 0x2f08e, 0x2f08d, 0x21c4e, 0x0bc46, 0x21c29, 0x0bc21,
+    0x02e66, 0x17bc1, 0x170be, 0x170bd, 0x08ea3, 0x1fd92, 0x2f0bc, 0x1d98b, 0x2d893, 0x2d891, 0x2f08c, 0x2188b, 0x1bc4c, 0x07c42, 0x1bc27, 0x07c1e,
+    0x02f65, 0x15298, 0x1708e, 0x1708d, 0x29893, 0x29891, 0x2b08c, 0x2988b, 0x2f85f, 0x2f85d, 0x2f828, 0x2f826, 0x21c44, 0x1bc3a, 0x2381f, 0x19c1a,
+    0x29a4e, 0x03a46, 0x29a29, 0x03a21, 0x15a4c, 0x03a42, 0x15a27, 0x03a1e, 0x15a44, 0x0fa3a, 0x1781f, 0x0fa1a, 0x1bc40, 0x01930, 0x1f819, 0x1d809,
+    0x00e13, 0x00847, 0x0092b, 0x00966, 0x18a47, 0x10a74, 0x0cb99, 0x15593, 0x10b47, 0x00989, 0x10966, 0x009a3, 0x04a74, 0x2556f, 0x09593, 0x25d4c,
+    0x10c47, 0x1cc74, 0x18d99, 0x21393, 0x1ce89, 0x2f76f, 0x1b3c0, 0x2ff5e, 0x073cf, 0x237a5, 0x073c1, 0x21392, 0x095a5, 0x2b76a, 0x09591, 0x15d42,
+    0x18d47, 0x04989, 0x18966, 0x069a3, 0x032cf, 0x177a5, 0x035c1, 0x15592, 0x1c989, 0x009ba, 0x1e9a3, 0x009ce, 0x0b4a5, 0x2556e, 0x09592, 0x03d4a,
+    0x00c74, 0x2736f, 0x0b393, 0x27b4c, 0x0b3a5, 0x2d36a, 0x0b391, 0x21b42, 0x092a5, 0x2736e, 0x0b392, 0x27b4a, 0x0b3a4, 0x2f768, 0x0b390, 0x15d3e,
+    0x00e2b, 0x10c99, 0x1d0d5, 0x1f7be, 0x18e66, 0x17793, 0x035be, 0x1778c, 0x04f99, 0x137c0, 0x074be, 0x137bc, 0x0b493, 0x25d5e, 0x0958c, 0x25d27,
+    0x10e66, 0x23793, 0x073be, 0x2138c, 0x1eea3, 0x2ff4c, 0x1b3bc, 0x2ff27, 0x074c1, 0x23791, 0x073bd, 0x2f78b, 0x0b492, 0x17f42, 0x0958b, 0x15d1e,
+    0x0cc99, 0x032c0, 0x032be, 0x032bc, 0x032c1, 0x17791, 0x032bd, 0x1778b, 0x0f2c0, 0x032bf, 0x152bc, 0x032bb, 0x0b491, 0x25d5c, 0x2748b, 0x03d25,
+    0x09293, 0x27b5e, 0x0b38c, 0x27b27, 0x09292, 0x23f42, 0x2738b, 0x23f1e, 0x09291, 0x27b5c, 0x0928b, 0x27b25, 0x09290, 0x1ff38, 0x2738a, 0x1ff18,
+    0x00f47, 0x1f0cf, 0x1cd99, 0x1f0c1, 0x04e89, 0x155a5, 0x1f0c0, 0x15591, 0x18f74, 0x214a5, 0x23093, 0x23092, 0x2746f, 0x2556a, 0x27c5e, 0x09d42,
+    0x00e89, 0x213a5, 0x130c0, 0x21391, 0x00eba, 0x2f76e, 0x1f0bf, 0x2ff5c, 0x230a5, 0x230a4, 0x23091, 0x23090, 0x2746e, 0x25568, 0x27c5c, 0x03d38,
+    0x10d74, 0x152a5, 0x17093, 0x17092, 0x170a5, 0x170a4, 0x17091, 0x17090, 0x2f06f, 0x2f06e, 0x2f84c, 0x2f84a, 0x2f06a, 0x27468, 0x23842, 0x03d3e,
+    0x2526f, 0x2736a, 0x25a5e, 0x0bb42, 0x2526e, 0x27368, 0x25a5c, 0x07b38, 0x2b06a, 0x25268, 0x17842, 0x0bb3e, 0x2f068, 0x2f067, 0x1f838, 0x01e2e,
+    0x00e66, 0x1f7c1, 0x1f0be, 0x1f0bd, 0x06ea3, 0x17792, 0x230bc, 0x2958b, 0x21493, 0x21491, 0x2308c, 0x2148b, 0x27c4c, 0x0bc42, 0x27c27, 0x0bc1e,
+    0x00ea3, 0x23792, 0x130bc, 0x2138b, 0x00ece, 0x2ff4a, 0x2f0bb, 0x2ff25, 0x21492, 0x23790, 0x2f08b, 0x2f08a, 0x27c4a, 0x0bc3e, 0x27c25, 0x01d18,
+    0x15293, 0x15291, 0x1708c, 0x2928b, 0x15292, 0x15290, 0x1708b, 0x1708a, 0x2f85e, 0x2f85c, 0x2f827, 0x2f825, 0x21c42, 0x07c38, 0x21c1e, 0x07c18,
+    0x25a4c, 0x09a42, 0x25a27, 0x09a1e, 0x03a4a, 0x23f3e, 0x03a25, 0x07b18, 0x15a42, 0x03a38, 0x15a1e, 0x01a18, 0x1bc3e, 0x0192e, 0x1f818, 0x05c08,
+    0x1cf12, 0x00848, 0x1c92a, 0x00965, 0x00a4d, 0x0c877, 0x11497, 0x11493, 0x1cb3d, 0x11488, 0x13463, 0x1345f, 0x00b71, 0x09483, 0x17459, 0x29c44,
+    0x00c4d, 0x18877, 0x1d297, 0x1d293, 0x1d29d, 0x1d29c, 0x1d296, 0x1d292, 0x1d489, 0x11487, 0x13462, 0x1345e, 0x1d484, 0x09482, 0x17458, 0x29c42,
+    0x1cd3d, 0x1d288, 0x1f263, 0x2325f, 0x1d289, 0x1d287, 0x1f262, 0x2325e, 0x1f281, 0x1f280, 0x1f63d, 0x2f637, 0x1f47e, 0x1147c, 0x1363b, 0x17632,
+    0x00d71, 0x0b283, 0x23259, 0x2da44, 0x1d284, 0x0b282, 0x23258, 0x2da42, 0x1f27e, 0x1f27c, 0x1f63b, 0x2f632, 0x1f27d, 0x1f27b, 0x1f639, 0x2f630,
+    0x00e48, 0x1d29e, 0x1d299, 0x1d298, 0x18e77, 0x1d49b, 0x11495, 0x11491, 0x1d488, 0x1d486, 0x13461, 0x1345d, 0x0b483, 0x0947c, 0x17457, 0x25c3a,
+    0x0ce77, 0x1d29b, 0x1d295, 0x1d291, 0x1129c, 0x1d29a, 0x1d294, 0x1d290, 0x1d487, 0x1d485, 0x13460, 0x1345c, 0x0b482, 0x0947b, 0x17456, 0x09c38,
+    0x11288, 0x1d286, 0x1f261, 0x2325d, 0x11287, 0x1d285, 0x1f260, 0x2325c, 0x11280, 0x1f27f, 0x1f63c, 0x2f636, 0x1f47c, 0x0947a, 0x1363a, 0x17631,
+    0x09283, 0x0927c, 0x2d257, 0x27a3a, 0x09282, 0x0927b, 0x2d256, 0x27a38, 0x1127c, 0x0927a, 0x1f63a, 0x2f631, 0x1127b, 0x09279, 0x1f638, 0x2f62f,
+    0x1cf2a, 0x11299, 0x1f08f, 0x1f68e, 0x1d497, 0x1d495, 0x1d48e, 0x1368c, 0x1f463, 0x1f461, 0x1f42a, 0x13428, 0x23459, 0x2d457, 0x2f422, 0x2b41f,
+    0x11297, 0x11295, 0x1d28e, 0x1d28c, 0x11296, 0x11294, 0x1d28d, 0x1f68b, 0x1f462, 0x1f460, 0x1f429, 0x13427, 0x23458, 0x2d456, 0x2f421, 0x2b41e,
+    0x13263, 0x13261, 0x1f22a, 0x23228, 0x13262, 0x13260, 0x1f229, 0x23227, 0x1f03d, 0x1f03c, 0x1f212, 0x23211, 0x1f03b, 0x1f03a, 0x2f40e, 0x17c0b,
+    0x17259, 0x17257, 0x2f222, 0x2f21f, 0x17258, 0x17256, 0x2f221, 0x2f21e, 0x1303b, 0x1303a, 0x2f20e, 0x2fa0b, 0x1f039, 0x1f038, 0x2f20d, 0x1fe09,
+    0x00f65, 0x11298, 0x1f08e, 0x1f08d, 0x1d493, 0x1d491, 0x1f08c, 0x1d48b, 0x2345f, 0x2345d, 0x23428, 0x2f426, 0x2dc44, 0x27c3a, 0x2f41f, 0x25c1a,
+    0x11293, 0x11291, 0x1308c, 0x1d28b, 0x11292, 0x11290, 0x1f08b, 0x1f08a, 0x2345e, 0x2345c, 0x23427, 0x2f425, 0x2dc42, 0x27c38, 0x2f41e, 0x09c18,
+    0x1325f, 0x1325d, 0x13228, 0x2f226, 0x1325e, 0x1325c, 0x13227, 0x2f225, 0x2f037, 0x2f036, 0x13211, 0x2f210, 0x2f032, 0x2f031, 0x2fc0b, 0x2fc06,
+    0x29a44, 0x25a3a, 0x2b21f, 0x25a1a, 0x29a42, 0x09a38, 0x2b21e, 0x09a18, 0x17032, 0x17031, 0x17a0b, 0x2fa06, 0x2f030, 0x2f02f, 0x1f809, 0x1fc03,
+    0x00914, 0x01649, 0x0162c, 0x01624, 0x0164f, 0x01645, 0x0162a, 0x01620, 0x11649, 0x0163d, 0x11624, 0x0161d, 0x0d645, 0x01635, 0x0d620, 0x0360c,
+    0x0564f, 0x05645, 0x0562a, 0x05620, 0x0164d, 0x01641, 0x01628, 0x0971b, 0x11647, 0x0163b, 0x11622, 0x0161b, 0x0d643, 0x01634, 0x0d61f, 0x0360a,
+    0x19649, 0x0563d, 0x19624, 0x0761d, 0x19647, 0x0563b, 0x19622, 0x0761b, 0x1d63d, 0x01637, 0x1f61d, 0x01617, 0x1163b, 0x01632, 0x1161b, 0x03607,
+    0x19645, 0x07335, 0x1b220, 0x0760c, 0x19643, 0x1b334, 0x1961f, 0x0760a, 0x1d63b, 0x05632, 0x1f61b, 0x27607, 0x1d639, 0x01630, 0x1f619, 0x09604,
+    0x01650, 0x01648, 0x0162b, 0x01623, 0x0164e, 0x01644, 0x01629, 0x0371f, 0x11648, 0x0163c, 0x11623, 0x0161c, 0x0d644, 0x03532, 0x0f41f, 0x0360b,
+    0x0564e, 0x05644, 0x05629, 0x0771f, 0x0164c, 0x01640, 0x01627, 0x09719, 0x11646, 0x0163a, 0x11621, 0x0161a, 0x0d642, 0x15530, 0x0d61e, 0x09709,
+    0x19648, 0x0563c, 0x19623, 0x0761c, 0x19646, 0x0563a, 0x19621, 0x0761a, 0x1d63c, 0x01636, 0x1f61c, 0x01616, 0x1163a, 0x01631, 0x1161a, 0x03606,
+    0x19644, 0x07332, 0x1b21f, 0x0760b, 0x19642, 0x1b330, 0x1b21e, 0x27709, 0x1d63a, 0x07331, 0x1f61a, 0x27606, 0x1d638, 0x1b32f, 0x1f618, 0x09603,
+    0x1d64f, 0x01647, 0x1d62a, 0x01622, 0x1164d, 0x01643, 0x11628, 0x0161f, 0x11645, 0x0d63b, 0x11620, 0x0f61b, 0x11641, 0x0d634, 0x1741b, 0x0f60a,
+    0x1964d, 0x05643, 0x19628, 0x0561f, 0x0164b, 0x0163f, 0x01626, 0x0971a, 0x11643, 0x01639, 0x1161f, 0x01619, 0x1163f, 0x01633, 0x1741a, 0x03609,
+    0x1d645, 0x1963b, 0x1f220, 0x1961b, 0x1d643, 0x05639, 0x1d61f, 0x07619, 0x1f035, 0x1d632, 0x1f60c, 0x2f607, 0x1f034, 0x11630, 0x1360a, 0x17604,
+    0x19641, 0x07334, 0x2121b, 0x2120a, 0x1963f, 0x07333, 0x2121a, 0x07609, 0x13034, 0x19630, 0x2320a, 0x21604, 0x1f033, 0x0162e, 0x1f609, 0x25602,
+    0x1d64e, 0x01646, 0x1d629, 0x01621, 0x1164c, 0x01642, 0x11627, 0x0161e, 0x11644, 0x0d63a, 0x1341f, 0x0f61a, 0x11640, 0x03530, 0x17419, 0x29409,
+    0x1964c, 0x05642, 0x19627, 0x0561e, 0x0164a, 0x0163e, 0x01625, 0x09718, 0x11642, 0x01638, 0x1161e, 0x01618, 0x1163e, 0x0352e, 0x17418, 0x03608,
+    0x1d644, 0x1963a, 0x1f21f, 0x1961a, 0x1d642, 0x05638, 0x1f21e, 0x07618, 0x1f032, 0x1f031, 0x1f60b, 0x2f606, 0x23030, 0x2302f, 0x17409, 0x17603,
+    0x19640, 0x0b330, 0x21219, 0x21209, 0x1963e, 0x2732e, 0x21218, 0x21208, 0x13030, 0x1302f, 0x2f209, 0x21603, 0x2f02e, 0x2f02d, 0x2f208, 0x01e01,
+    0x00f02, 0x2ee2e, 0x2ef2e, 0x0a367, 0x20e09, 0x20233, 0x20338, 0x0a268, 0x20f09, 0x20238, 0x20333, 0x0a368, 0x0a60d, 0x20239, 0x20339, 0x0a369,
+    0x28e09, 0x28433, 0x28538, 0x02468, 0x2461a, 0x2ee3f, 0x0075c, 0x0066e, 0x0a61e, 0x04656, 0x00756, 0x04672, 0x0a621, 0x1a658, 0x04760, 0x04675,
+    0x28f09, 0x28438, 0x28533, 0x02568, 0x0861e, 0x00656, 0x04756, 0x00672, 0x2471a, 0x0065c, 0x2ef3f, 0x0076e, 0x0a721, 0x04660, 0x1a758, 0x04775,
+    0x0260d, 0x28439, 0x28539, 0x02569, 0x02621, 0x0e658, 0x00760, 0x00675, 0x02721, 0x00660, 0x0e758, 0x00775, 0x00651, 0x00664, 0x00764, 0x00678,
+    0x08e04, 0x2ee30, 0x1a33e, 0x00668, 0x2660a, 0x20234, 0x1a342, 0x0626a, 0x2670b, 0x2023a, 0x1a33f, 0x0626b, 0x0a60e, 0x2023b, 0x1a343, 0x0626c,
+    0x2460a, 0x14434, 0x0e542, 0x0066a, 0x2461b, 0x2ee41, 0x0075e, 0x0066f, 0x0a61f, 0x04657, 0x00758, 0x04673, 0x0a622, 0x1a659, 0x04762, 0x04676,
+    0x0870b, 0x1443a, 0x1453f, 0x0076b, 0x0861f, 0x00657, 0x04758, 0x00673, 0x0871c, 0x0065d, 0x00754, 0x00770, 0x0a723, 0x04661, 0x0475a, 0x04777,
+    0x0260e, 0x1443b, 0x0e543, 0x0246c, 0x02622, 0x0e659, 0x00762, 0x00676, 0x02723, 0x00661, 0x0075a, 0x00777, 0x00652, 0x00665, 0x00766, 0x1df4e,
+    0x08f04, 0x1a23e, 0x2ef30, 0x00768, 0x2660b, 0x1a23f, 0x2033a, 0x0636b, 0x2670a, 0x1a242, 0x20334, 0x0636a, 0x0a70e, 0x1a243, 0x2033b, 0x0636c,
+    0x0860b, 0x1443f, 0x1453a, 0x0066b, 0x0861c, 0x00654, 0x0075d, 0x00670, 0x0871f, 0x04658, 0x00757, 0x00773, 0x0a623, 0x0465a, 0x04761, 0x04677,
+    0x2470a, 0x0e442, 0x14534, 0x0076a, 0x0a71f, 0x00658, 0x04757, 0x04773, 0x2471b, 0x0065e, 0x2ef41, 0x0076f, 0x0a722, 0x04662, 0x1a759, 0x04776,
+    0x0270e, 0x0e443, 0x1453b, 0x0256c, 0x02623, 0x0065a, 0x00761, 0x00677, 0x02722, 0x00662, 0x0e759, 0x00776, 0x00752, 0x00666, 0x00765, 0x1de4e,
+    0x08605, 0x1a240, 0x1a340, 0x00669, 0x2660c, 0x1a241, 0x1a344, 0x0466c, 0x2670c, 0x1a244, 0x1a341, 0x0476c, 0x0a60f, 0x1a245, 0x1a345, 0x0636d,
+    0x0860c, 0x14441, 0x0e544, 0x0066c, 0x0861d, 0x00655, 0x0075f, 0x00671, 0x0a620, 0x04659, 0x00759, 0x04674, 0x0a624, 0x0465b, 0x04763, 0x19d45,
+    0x0870c, 0x0e444, 0x14541, 0x0076c, 0x08620, 0x00659, 0x04759, 0x00674, 0x0871d, 0x0065f, 0x00755, 0x00771, 0x0a724, 0x04663, 0x0475b, 0x19c45,
+    0x0260f, 0x0e445, 0x0e545, 0x0066d, 0x02624, 0x0065b, 0x00763, 0x0db45, 0x02724, 0x00663, 0x0075b, 0x0da45, 0x00653, 0x01924, 0x01824, 0x0190f,
+    0x1ce09, 0x1ee33, 0x1c938, 0x00868, 0x18a1a, 0x22e3f, 0x02b5c, 0x02a6e, 0x06a1e, 0x08a56, 0x02b56, 0x08a72, 0x0aa21, 0x26a58, 0x08b60, 0x08a75,
+    0x0ec1a, 0x12e3f, 0x0ad5c, 0x0ac6e, 0x2ee26, 0x2ee4b, 0x202bf, 0x2ffba, 0x20e8b, 0x22694, 0x202c4, 0x202d1, 0x2e68d, 0x22696, 0x202c5, 0x0ffa2,
+    0x02c1e, 0x24c56, 0x06d56, 0x0ac72, 0x28e8b, 0x16694, 0x284c4, 0x284d1, 0x1cf8b, 0x1e6c4, 0x1ed94, 0x1c9d1, 0x2e6bd, 0x1e6c6, 0x2abc6, 0x03fa9,
+    0x02c21, 0x24c58, 0x0ad60, 0x0ac75, 0x1668d, 0x16696, 0x284c5, 0x19fa2, 0x166bd, 0x126c6, 0x2edc6, 0x07fa9, 0x2e6c2, 0x1e6c8, 0x1c6d8, 0x01f64,
+    0x1ee19, 0x1ee39, 0x26290, 0x262a4, 0x22e1f, 0x22e43, 0x26291, 0x262a5, 0x1aa27, 0x2ca60, 0x26294, 0x262a6, 0x20a29, 0x2ca62, 0x26295, 0x262a7,
+    0x16e1f, 0x16e43, 0x24491, 0x244a5, 0x2ee28, 0x2ee4d, 0x202c0, 0x1ff89, 0x2e68c, 0x22695, 0x202c6, 0x202d2, 0x2e68e, 0x22697, 0x202c7, 0x11f62,
+    0x14c27, 0x28c60, 0x24494, 0x244a6, 0x2a68c, 0x16695, 0x144c6, 0x144d2, 0x2e6bc, 0x1e6c5, 0x263d6, 0x01ecc, 0x2e6be, 0x1e6c7, 0x0a3d7, 0x0dd95,
+    0x28c29, 0x28c62, 0x24495, 0x244a7, 0x1668e, 0x16697, 0x144c7, 0x1df62, 0x166be, 0x126c7, 0x106d7, 0x19b95, 0x2e6c3, 0x1f98e, 0x1f9be, 0x1df29,
+    0x00f30, 0x2ee68, 0x10d7b, 0x262aa, 0x1aa3a, 0x2e66b, 0x26b85, 0x262ab, 0x06a42, 0x2c272, 0x26b82, 0x0a2ac, 0x0aa46, 0x2c273, 0x26b87, 0x0a2ad,
+    0x0ec3a, 0x2a66b, 0x08d85, 0x084ab, 0x2ee5d, 0x2e670, 0x1a2c9, 0x1ffb9, 0x2ce91, 0x226a6, 0x1a2ca, 0x1a2d3, 0x20298, 0x226a8, 0x1a2cb, 0x0df87,
+    0x02c42, 0x28472, 0x24d82, 0x084ac, 0x28e91, 0x166a6, 0x0e4ca, 0x0e4d3, 0x12d92, 0x1e6d1, 0x12d9c, 0x1deae, 0x2ebc1, 0x1e6d2, 0x1f8a8, 0x11c73,
+    0x02c46, 0x28473, 0x24d87, 0x084ad, 0x14498, 0x166a8, 0x0e4cb, 0x19f87, 0x16dc1, 0x126d2, 0x138a8, 0x1da73, 0x2e6d0, 0x1ffc1, 0x1dc98, 0x01e46,
+    0x14c40, 0x2e669, 0x2629a, 0x262b0, 0x20a44, 0x2e66c, 0x2629b, 0x262b1, 0x1aa4c, 0x2c275, 0x0a29c, 0x0a2b2, 0x20a4e, 0x2c276, 0x07877, 0x05d6c,
+    0x14c44, 0x2a66c, 0x0849b, 0x084b1, 0x2ee5f, 0x2e671, 0x099a1, 0x1f97e, 0x2ce93, 0x226a7, 0x0b8a8, 0x099a5, 0x0b965, 0x19959, 0x07961, 0x1dd3b,
+    0x14c4c, 0x28475, 0x0849c, 0x084b2, 0x28e93, 0x166a7, 0x098a8, 0x0b9a5, 0x098a3, 0x098a2, 0x0989f, 0x1d884, 0x0b866, 0x07862, 0x0785a, 0x19c43,
+    0x28c4e, 0x28476, 0x03877, 0x01b6c, 0x03965, 0x0d959, 0x03961, 0x11b3b, 0x03866, 0x03862, 0x0385a, 0x0da43, 0x01952, 0x01922, 0x01823, 0x0190e,
+    0x1cf09, 0x1c838, 0x1ef33, 0x00968, 0x04a1e, 0x02a56, 0x08b56, 0x02a72, 0x18b1a, 0x02a5c, 0x22f3f, 0x02b6e, 0x0ab21, 0x08a60, 0x26b58, 0x08b75,
+    0x00c1e, 0x06c56, 0x24d56, 0x06c72, 0x1ce8b, 0x1ec94, 0x1e7c4, 0x1c8d1, 0x28f8b, 0x285c4, 0x16794, 0x285d1, 0x2e7bd, 0x2aac6, 0x1e7c6, 0x01fa9,
+    0x0ed1a, 0x0ac5c, 0x12f3f, 0x0ad6e, 0x20f8b, 0x203c4, 0x22794, 0x203d1, 0x2ef26, 0x203bf, 0x2ef4b, 0x2feba, 0x2e78d, 0x203c5, 0x22796, 0x0fea2,
+    0x02d21, 0x0ac60, 0x24d58, 0x0ad75, 0x167bd, 0x2ecc6, 0x127c6, 0x05fa9, 0x1678d, 0x285c5, 0x16796, 0x19ea2, 0x2e7c2, 0x1c7d8, 0x1e7c8, 0x01e64,
+    0x00e30, 0x10c7b, 0x2ef68, 0x263aa, 0x06b42, 0x26a82, 0x2c372, 0x0a3ac, 0x1ab3a, 0x26a85, 0x2e76b, 0x263ab, 0x0ab46, 0x26a87, 0x2c373, 0x0a3ad,
+    0x02d42, 0x24c82, 0x28572, 0x085ac, 0x12c92, 0x12c9c, 0x1e7d1, 0x1dfae, 0x28f91, 0x0e5ca, 0x167a6, 0x0e5d3, 0x2eac1, 0x1f9a8, 0x1e7d2, 0x11d73,
+    0x0ed3a, 0x08c85, 0x2a76b, 0x085ab, 0x2cf91, 0x1a3ca, 0x227a6, 0x1a3d3, 0x2ef5d, 0x1a3c9, 0x2e770, 0x1feb9, 0x20398, 0x1a3cb, 0x227a8, 0x0de87,
+    0x02d46, 0x24c87, 0x28573, 0x085ad, 0x16cc1, 0x139a8, 0x127d2, 0x1db73, 0x14598, 0x0e5cb, 0x167a8, 0x19e87, 0x2e7d0, 0x1dd98, 0x1fec1, 0x01f46,
+    0x1ef19, 0x26390, 0x1ef39, 0x263a4, 0x1ab27, 0x26394, 0x2cb60, 0x263a6, 0x22f1f, 0x26391, 0x22f43, 0x263a5, 0x20b29, 0x26395, 0x2cb62, 0x263a7,
+    0x14d27, 0x24594, 0x28d60, 0x245a6, 0x2e7bc, 0x262d6, 0x1e7c5, 0x01fcc, 0x2a78c, 0x145c6, 0x16795, 0x145d2, 0x2e7be, 0x0a2d7, 0x1e7c7, 0x0dc95,
+    0x16f1f, 0x24591, 0x16f43, 0x245a5, 0x2e78c, 0x203c6, 0x22795, 0x203d2, 0x2ef28, 0x203c0, 0x2ef4d, 0x1fe89, 0x2e78e, 0x203c7, 0x22797, 0x11e62,
+    0x28d29, 0x24595, 0x28d62, 0x245a7, 0x167be, 0x107d7, 0x127c7, 0x19a95, 0x1678e, 0x145c7, 0x16797, 0x1de62, 0x2e7c3, 0x1f8be, 0x1f88e, 0x1de29,
+    0x14d40, 0x2639a, 0x2e769, 0x263b0, 0x1ab4c, 0x0a39c, 0x2c375, 0x0a3b2, 0x20b44, 0x2639b, 0x2e76c, 0x263b1, 0x20b4e, 0x07977, 0x2c376, 0x05c6c,
+    0x14d4c, 0x0859c, 0x28575, 0x085b2, 0x099a3, 0x0999f, 0x099a2, 0x1d984, 0x28f93, 0x099a8, 0x167a7, 0x0b8a5, 0x0b966, 0x0795a, 0x07962, 0x19d43,
+    0x14d44, 0x0859b, 0x2a76c, 0x085b1, 0x2cf93, 0x0b9a8, 0x227a7, 0x098a5, 0x2ef5f, 0x098a1, 0x2e771, 0x1f87e, 0x0b865, 0x07861, 0x19859, 0x1dc3b,
+    0x28d4e, 0x03977, 0x28576, 0x01a6c, 0x03966, 0x0395a, 0x03962, 0x0db43, 0x03865, 0x03861, 0x0d859, 0x11a3b, 0x01852, 0x01923, 0x01822, 0x0180e,
+    0x00c0d, 0x1c839, 0x1c939, 0x00969, 0x00a21, 0x0ca58, 0x02b60, 0x02a75, 0x00b21, 0x02a60, 0x0cb58, 0x02b75, 0x00a51, 0x02a64, 0x02b64, 0x03f78,
+    0x00c21, 0x18c58, 0x06d60, 0x06c75, 0x1ec8d, 0x1ec96, 0x1c8c5, 0x25fa2, 0x1edbd, 0x16ac6, 0x22dc6, 0x0bfa9, 0x2eac2, 0x17fc8, 0x29ed8, 0x03f64,
+    0x00d21, 0x06c60, 0x18d58, 0x06d75, 0x1ecbd, 0x22cc6, 0x16bc6, 0x09fa9, 0x1ed8d, 0x1c9c5, 0x1ed96, 0x25ea2, 0x2ebc2, 0x29fd8, 0x17ec8, 0x03e64,
+    0x00c51, 0x0ac64, 0x0ad64, 0x0ac78, 0x2ecc2, 0x2ecc8, 0x20cd8, 0x0bf64, 0x2edc2, 0x20dd8, 0x2edc8, 0x0be64, 0x010dc, 0x2ffc2, 0x2fec2, 0x01f51,
+    0x1ce39, 0x1ec7d, 0x0aca4, 0x26cb0, 0x18a58, 0x1ea84, 0x08aa6, 0x25fb2, 0x06a60, 0x08aa0, 0x0aba6, 0x09eb3, 0x0aa64, 0x24aa2, 0x08aa9, 0x03f75,
+    0x0cc58, 0x1ec84, 0x0aca6, 0x26cb2, 0x12c96, 0x1ec9d, 0x2f9cc, 0x1ff84, 0x22ac6, 0x2eacc, 0x251da, 0x0bfa6, 0x2eac8, 0x13f96, 0x239c6, 0x0df58,
+    0x02c60, 0x08ca0, 0x08da6, 0x26cb3, 0x16cc6, 0x2eccc, 0x271da, 0x09fa6, 0x1cfc5, 0x091db, 0x2fecc, 0x09ea0, 0x20bd8, 0x1ddc5, 0x17ec6, 0x03e60,
+    0x02c64, 0x24ca2, 0x0aca9, 0x07f75, 0x16cc8, 0x1ff96, 0x179c6, 0x19f58, 0x28dd8, 0x1dbc5, 0x23ec6, 0x07e60, 0x2f9c2, 0x1ff8d, 0x1febd, 0x01f21,
+    0x1cf39, 0x08ca4, 0x1ed7d, 0x26db0, 0x06b60, 0x0aaa6, 0x08ba0, 0x09fb3, 0x18b58, 0x08ba6, 0x1eb84, 0x25eb2, 0x0ab64, 0x0aaa9, 0x24ba2, 0x03e75,
+    0x02d60, 0x08ca6, 0x08da0, 0x26db3, 0x1cec5, 0x2ffcc, 0x090db, 0x09fa0, 0x16dc6, 0x270da, 0x2edcc, 0x09ea6, 0x20ad8, 0x17fc6, 0x1dcc5, 0x03f60,
+    0x0cd58, 0x0ada6, 0x1ed84, 0x26db2, 0x22bc6, 0x250da, 0x2ebcc, 0x0bea6, 0x12d96, 0x2f8cc, 0x1ed9d, 0x1fe84, 0x2ebc8, 0x238c6, 0x13e96, 0x0de58,
+    0x02d64, 0x08ca9, 0x24da2, 0x07e75, 0x28cd8, 0x23fc6, 0x1dac5, 0x07f60, 0x16dc8, 0x178c6, 0x1fe96, 0x19e58, 0x2f8c2, 0x1ffbd, 0x1fe8d, 0x01e21,
+    0x00f69, 0x08cb0, 0x08db0, 0x090b4, 0x06a75, 0x26ab2, 0x26bb3, 0x09fb0, 0x06b75, 0x26ab3, 0x26bb2, 0x09eb0, 0x0aa78, 0x07975, 0x07875, 0x01c69,
+    0x02c75, 0x24cb2, 0x08db3, 0x27fb0, 0x259a2, 0x1f984, 0x099a0, 0x1ff7d, 0x099a9, 0x099a6, 0x0b8a6, 0x0bfa4, 0x0b964, 0x19958, 0x07960, 0x1dd39,
+    0x02d75, 0x08cb3, 0x24db2, 0x27eb0, 0x0b9a9, 0x0b9a6, 0x098a6, 0x09fa4, 0x258a2, 0x098a0, 0x1f884, 0x1fe7d, 0x0b864, 0x07860, 0x19858, 0x1dc39,
+    0x02c78, 0x03975, 0x03875, 0x01a69, 0x03964, 0x0d958, 0x03960, 0x1db39, 0x03864, 0x03860, 0x0d858, 0x1da39, 0x01951, 0x01921, 0x01821, 0x01f0d,
+    0x06e04, 0x22e30, 0x2633e, 0x02a68, 0x20e0a, 0x2c234, 0x26342, 0x0a26a, 0x06b0b, 0x2c23a, 0x2633f, 0x0a26b, 0x0aa0e, 0x2c23b, 0x26343, 0x0a26c,
+    0x16e19, 0x16e39, 0x1a290, 0x1a2a4, 0x2ee1f, 0x2ee43, 0x1a291, 0x1a2a5, 0x26627, 0x20660, 0x1a294, 0x1a2a6, 0x20629, 0x20662, 0x1a295, 0x1a2a7,
+    0x02e30, 0x2a67b, 0x22f68, 0x063aa, 0x0a742, 0x1a682, 0x20372, 0x063ac, 0x2673a, 0x06685, 0x2076b, 0x063ab, 0x0a746, 0x1a687, 0x20373, 0x063ad,
+    0x28e39, 0x1667d, 0x046a4, 0x046b0, 0x24658, 0x16684, 0x046a6, 0x186b2, 0x0a660, 0x066a0, 0x067a6, 0x046b3, 0x0a664, 0x186a2, 0x046a9, 0x01f75,
+    0x26e07, 0x2ee32, 0x2634a, 0x0a26e, 0x20e0c, 0x20235, 0x0a34c, 0x0a26f, 0x26611, 0x2023c, 0x2634b, 0x0a270, 0x20612, 0x2023d, 0x0a34d, 0x0a271,
+    0x2ae1b, 0x2ae3b, 0x1a292, 0x186a5, 0x2c620, 0x2ee45, 0x1a293, 0x1fd74, 0x26628, 0x20661, 0x1a296, 0x1a2a8, 0x2062a, 0x20663, 0x1a297, 0x1fd59,
+    0x08e32, 0x2a67c, 0x1a76e, 0x046ab, 0x0a744, 0x1a683, 0x1a775, 0x186ad, 0x2673c, 0x06686, 0x1a770, 0x063af, 0x0a748, 0x1a688, 0x1a777, 0x01d83,
+    0x28e3b, 0x1667e, 0x046a5, 0x046b1, 0x24659, 0x23971, 0x046a7, 0x1f96c, 0x0a661, 0x066a1, 0x067a8, 0x05b9b, 0x0a665, 0x23d5f, 0x21d93, 0x11f44,
+    0x06f0a, 0x20242, 0x2c342, 0x0a372, 0x26e0e, 0x20243, 0x26346, 0x06273, 0x1af0e, 0x1a246, 0x2c343, 0x0a373, 0x26613, 0x1a247, 0x26347, 0x0a374,
+    0x24e1f, 0x2e658, 0x06791, 0x186a6, 0x26623, 0x2065a, 0x1a298, 0x186a8, 0x26629, 0x1a664, 0x06795, 0x1a2a9, 0x2662b, 0x1a666, 0x1a299, 0x01c93,
+    0x26734, 0x06682, 0x2076a, 0x1a3ac, 0x0a743, 0x06684, 0x1a773, 0x063ae, 0x2673b, 0x06687, 0x2076c, 0x1a3ad, 0x0a747, 0x06689, 0x20374, 0x11c6f,
+    0x24e43, 0x28684, 0x067a5, 0x046b2, 0x2465a, 0x0669f, 0x046a8, 0x19f9c, 0x0a662, 0x066a2, 0x067a7, 0x1da75, 0x0a666, 0x066a3, 0x1dc93, 0x11e4c,
+    0x26e0c, 0x20244, 0x1a34c, 0x06275, 0x2660f, 0x20245, 0x0634e, 0x06276, 0x26612, 0x1a248, 0x1a34d, 0x06277, 0x26614, 0x1a249, 0x0634f, 0x1b945,
+    0x26620, 0x2e659, 0x06793, 0x186a7, 0x26624, 0x2065b, 0x27965, 0x23959, 0x2662a, 0x1a665, 0x06797, 0x0b893, 0x2662c, 0x1b924, 0x0792a, 0x19d20,
+    0x26735, 0x06683, 0x1a76f, 0x046ad, 0x0a745, 0x27971, 0x1a776, 0x2796f, 0x2673d, 0x06688, 0x1a771, 0x0b883, 0x0a749, 0x0793d, 0x07945, 0x05c35,
+    0x24e45, 0x03971, 0x09974, 0x0396c, 0x2465b, 0x03955, 0x09959, 0x11b41, 0x0a663, 0x0385f, 0x03859, 0x0da44, 0x0b924, 0x0791d, 0x07920, 0x0590c,
+    0x1ce0a, 0x1ee34, 0x0c942, 0x02a6a, 0x18a1b, 0x22e41, 0x02b5e, 0x02a6f, 0x06a1f, 0x08a57, 0x02b58, 0x08a73, 0x0aa22, 0x26a59, 0x08b62, 0x15d76,
+    0x12e1f, 0x12e43, 0x18891, 0x188a5, 0x22e28, 0x22e4d, 0x2c2c0, 0x17f89, 0x20e8c, 0x2ea95, 0x2c2c6, 0x2c2d2, 0x2ea8e, 0x2b597, 0x2c2c7, 0x15f62,
+    0x00d42, 0x18c82, 0x18d72, 0x1acac, 0x2a692, 0x2a69c, 0x16bd1, 0x175ae, 0x1cf91, 0x226ca, 0x12ba6, 0x01ed3, 0x2e6c1, 0x2b5a8, 0x2f5d2, 0x15d73,
+    0x0ec58, 0x16c84, 0x06ca6, 0x1acb2, 0x2a696, 0x1669d, 0x235cc, 0x17f84, 0x2e6c6, 0x226cc, 0x191da, 0x07fa6, 0x2e6c8, 0x2b596, 0x2f5c6, 0x0ff58,
+    0x1ee1b, 0x1ee3b, 0x26292, 0x24aa5, 0x22e20, 0x22e45, 0x26293, 0x2f574, 0x1aa28, 0x2ca61, 0x26296, 0x262a8, 0x20a2a, 0x2fd63, 0x26297, 0x2bd59,
+    0x12e22, 0x12e47, 0x202c1, 0x211cf, 0x2ee2a, 0x2fd4f, 0x23599, 0x13d47, 0x20e8e, 0x22699, 0x211c8, 0x211c1, 0x2118f, 0x2fd2a, 0x21d8e, 0x13d22,
+    0x14c5e, 0x16c87, 0x26cd1, 0x211d3, 0x2a693, 0x2f577, 0x211a9, 0x2bd73, 0x2e6c0, 0x211cb, 0x1b1cc, 0x211ca, 0x21199, 0x2fd61, 0x2dd95, 0x2bd57,
+    0x14c62, 0x16c89, 0x2d1d2, 0x19ba5, 0x2a697, 0x23d4d, 0x2f995, 0x13d43, 0x2d1c7, 0x2d1c0, 0x2d1c6, 0x19b91, 0x2f98e, 0x23d28, 0x21d8c, 0x13d1f,
+    0x04f34, 0x2ee6a, 0x0ab82, 0x262ac, 0x1aa3b, 0x2ca6c, 0x0ab87, 0x262ad, 0x06a43, 0x26a73, 0x26b84, 0x262ae, 0x0aa47, 0x2c274, 0x26b89, 0x15d6f,
+    0x2ae57, 0x2ae73, 0x202ca, 0x202d3, 0x2ee61, 0x2e677, 0x202cb, 0x17f87, 0x2ce95, 0x202a9, 0x1a2cc, 0x27fd1, 0x20299, 0x2b593, 0x2f5c0, 0x15f5e,
+    0x0cf6a, 0x2a6ac, 0x10dac, 0x250d9, 0x28ea5, 0x2a6b2, 0x235d3, 0x2b5ac, 0x1cfa5, 0x226d3, 0x1ebb2, 0x11eac, 0x2e6cf, 0x29da5, 0x1dca5, 0x0dc6a,
+    0x14e73, 0x166ae, 0x00dd3, 0x1bfac, 0x2a6a8, 0x2b59c, 0x235ca, 0x19f82, 0x2e6d2, 0x178d1, 0x138a6, 0x19e72, 0x2f5c1, 0x2b592, 0x1dc91, 0x01e42,
+    0x1aa41, 0x2ee6c, 0x2629c, 0x271b2, 0x20a45, 0x2d16d, 0x2d177, 0x2fd6c, 0x1aa4d, 0x2c277, 0x2719d, 0x2719c, 0x20a4f, 0x21945, 0x1b94d, 0x1b941,
+    0x2ae59, 0x2e674, 0x271a8, 0x259a5, 0x2ee63, 0x23d45, 0x2d961, 0x1fd3b, 0x27197, 0x27193, 0x27196, 0x27192, 0x2192a, 0x23d20, 0x1b928, 0x1fd1b,
+    0x14e6f, 0x271ad, 0x271ae, 0x271ac, 0x2d174, 0x2d96c, 0x27973, 0x2fd6a, 0x27889, 0x0b887, 0x27884, 0x0b882, 0x0b947, 0x1b93b, 0x07943, 0x05c34,
+    0x14e76, 0x0396f, 0x09973, 0x01b6a, 0x27959, 0x23d41, 0x09957, 0x1fd34, 0x09862, 0x0385e, 0x03858, 0x0da42, 0x0b922, 0x1991b, 0x0791f, 0x1dd0a,
+    0x04b0b, 0x1083a, 0x1093f, 0x02b6b, 0x04a1f, 0x02a57, 0x08b58, 0x02a73, 0x06b1c, 0x02a5d, 0x02b54, 0x02b70, 0x0ab23, 0x08a61, 0x08b5a, 0x08b77,
+    0x10c27, 0x1cc60, 0x04d94, 0x188a6, 0x1ce8c, 0x12a95, 0x108c6, 0x0dfd2, 0x02fbc, 0x16ac5, 0x063d6, 0x03ecc, 0x2eabe, 0x29dc7, 0x063d7, 0x0fd95,
+    0x0cd3a, 0x04c85, 0x1cd6b, 0x049ab, 0x20f91, 0x263ca, 0x2eba6, 0x263d3, 0x22f5d, 0x263c9, 0x22b70, 0x17eb9, 0x2c398, 0x263cb, 0x2eba8, 0x0fe87,
+    0x00c60, 0x06ca0, 0x04da6, 0x06cb3, 0x12cc6, 0x22ccc, 0x1b1da, 0x05fa6, 0x28fc5, 0x071db, 0x23ecc, 0x07ea0, 0x207d8, 0x29dc5, 0x13ec6, 0x01e60,
+    0x04e32, 0x1ea7c, 0x26b6e, 0x08aab, 0x06b44, 0x26a83, 0x26b75, 0x2fdad, 0x06b3c, 0x26a86, 0x26b70, 0x263af, 0x0ab48, 0x2dd88, 0x26b77, 0x03d83,
+    0x10c5e, 0x12c87, 0x06cd1, 0x2d1d3, 0x1ea93, 0x23977, 0x2d1a9, 0x1fd73, 0x08fc0, 0x2d1cb, 0x271cc, 0x2d1ca, 0x2d199, 0x23d61, 0x21d95, 0x1fd57,
+    0x00f7c, 0x10cb7, 0x2efab, 0x271d4, 0x20f9b, 0x211af, 0x211b3, 0x2fdab, 0x20f86, 0x271cd, 0x203af, 0x11eb7, 0x2119e, 0x21d86, 0x21d9b, 0x01d7c,
+    0x0ec87, 0x16cb9, 0x271d3, 0x05bab, 0x2f9a8, 0x23970, 0x2f9a6, 0x1df6b, 0x271cb, 0x271c9, 0x271ca, 0x05e85, 0x2d198, 0x23d5d, 0x21d91, 0x0df3a,
+    0x18f1f, 0x0aa91, 0x22b58, 0x24ba6, 0x06b29, 0x0aa95, 0x26b64, 0x263a9, 0x1ab23, 0x26398, 0x2cb5a, 0x24ba8, 0x26b2b, 0x26399, 0x26b66, 0x03d93,
+    0x02f8c, 0x0ecc6, 0x0cdc6, 0x0b0da, 0x04ebe, 0x1b1d7, 0x071d8, 0x0dfc6, 0x08fbe, 0x270d8, 0x270d7, 0x0fec6, 0x270d5, 0x09dbe, 0x05cbe, 0x01c8c,
+    0x1ef57, 0x2c3ca, 0x1ef73, 0x2c3d3, 0x20f95, 0x263cc, 0x2c3a9, 0x07ed1, 0x22f61, 0x2c3cb, 0x22b77, 0x13e87, 0x2c399, 0x09dc0, 0x1f893, 0x11e5e,
+    0x0ef95, 0x02ccc, 0x0cdd2, 0x19aa6, 0x071d7, 0x071d6, 0x11ac6, 0x05f94, 0x28fc7, 0x178c5, 0x13895, 0x1de60, 0x2f8be, 0x03dbc, 0x1dc8c, 0x11e27,
+    0x1ab44, 0x26a9b, 0x2cb75, 0x271b3, 0x06b4e, 0x2d977, 0x27178, 0x2d975, 0x1ab48, 0x2719e, 0x2cb77, 0x2789b, 0x26b50, 0x1b948, 0x0794e, 0x1b944,
+    0x02f93, 0x259a8, 0x271a9, 0x259a6, 0x27966, 0x2d95a, 0x27964, 0x23958, 0x27199, 0x27198, 0x0b895, 0x0b891, 0x2792b, 0x1b923, 0x07929, 0x19d1f,
+    0x02f83, 0x271af, 0x2efad, 0x098ab, 0x27977, 0x27970, 0x27975, 0x2796e, 0x2cf88, 0x27886, 0x27883, 0x1f87c, 0x0b948, 0x0793c, 0x07944, 0x05c32,
+    0x09977, 0x03970, 0x03873, 0x01a6b, 0x0995a, 0x03954, 0x09958, 0x11b3f, 0x09861, 0x0385d, 0x03857, 0x11a3a, 0x0b923, 0x0791c, 0x0581f, 0x0590b,
+    0x00a0e, 0x1083b, 0x0c943, 0x0086c, 0x00a22, 0x0ca59, 0x02b62, 0x29776, 0x00b23, 0x02a61, 0x02b5a, 0x02b77, 0x00a52, 0x02a65, 0x02b66, 0x29f4e,
+    0x1cc29, 0x1cc62, 0x18895, 0x257a7, 0x1ea8e, 0x17597, 0x135c7, 0x29f62, 0x1eabe, 0x157c7, 0x096d7, 0x25795, 0x2f5c3, 0x1758e, 0x175be, 0x29f29,
+    0x00d46, 0x18c87, 0x1c973, 0x097ad, 0x1ecc1, 0x175a8, 0x135d2, 0x29773, 0x1cf98, 0x0f7cb, 0x12ba8, 0x25e87, 0x2f5d0, 0x15798, 0x17ec1, 0x03f46,
+    0x00c64, 0x18ca2, 0x06ca9, 0x0bf75, 0x1f5c8, 0x17596, 0x135c6, 0x25f58, 0x1d5d8, 0x297c5, 0x2fec6, 0x0be60, 0x2f5c2, 0x1758d, 0x175bd, 0x03f21,
+    0x1ce3b, 0x1ea7e, 0x08aa5, 0x097b1, 0x18a59, 0x2f571, 0x235a7, 0x2b56c, 0x06a61, 0x08aa1, 0x0aba8, 0x0979b, 0x0aa65, 0x2fd5f, 0x2dd93, 0x15f44,
+    0x10c62, 0x1ec89, 0x211d2, 0x257a5, 0x23597, 0x2fd4d, 0x23595, 0x17d43, 0x211c7, 0x211c0, 0x211c6, 0x25791, 0x2f58e, 0x2fd28, 0x2f58c, 0x17d1f,
+    0x0cc87, 0x1ecb9, 0x1b1d3, 0x097ab, 0x235a8, 0x2f570, 0x235a6, 0x2b56b, 0x1b1cb, 0x1b1c9, 0x1b1ca, 0x09e85, 0x21198, 0x2fd5d, 0x2dd91, 0x0ff3a,
+    0x0eca2, 0x2ecba, 0x211d1, 0x0bf6e, 0x23596, 0x2fd4b, 0x23594, 0x13d3f, 0x211c5, 0x211bf, 0x211c4, 0x0be5c, 0x2f58d, 0x2fd26, 0x21d8b, 0x0ff1a,
+    0x18f43, 0x0aaa5, 0x1cb84, 0x097b2, 0x06b62, 0x175a7, 0x08ba2, 0x29775, 0x06b5a, 0x08ba8, 0x08b9f, 0x0979c, 0x0ab66, 0x29d93, 0x08ba3, 0x15f4c,
+    0x0ce95, 0x157d2, 0x00dcc, 0x257a6, 0x1f5c7, 0x17595, 0x1f5c5, 0x29f60, 0x0b0d7, 0x157c6, 0x270d6, 0x25794, 0x2f5be, 0x2b58c, 0x2f5bc, 0x15f27,
+    0x10f73, 0x0f7d3, 0x1cdae, 0x097ac, 0x1f5d2, 0x175a6, 0x1f5d1, 0x29772, 0x1eba8, 0x0f7ca, 0x13e9c, 0x25e82, 0x2f8c1, 0x29d91, 0x13e92, 0x03f42,
+    0x02ca9, 0x297d1, 0x1dad1, 0x0bf72, 0x1f5c6, 0x17594, 0x1f5c4, 0x25f56, 0x2b8c6, 0x297c4, 0x1fe94, 0x07e56, 0x2f5bd, 0x29d8b, 0x1dc8b, 0x03f1e,
+    0x04e6c, 0x271b1, 0x0b1b2, 0x271b0, 0x2d176, 0x2f56c, 0x2d175, 0x2f569, 0x06b77, 0x2719b, 0x0b19c, 0x2719a, 0x2194e, 0x21944, 0x1b94c, 0x15f40,
+    0x271a7, 0x271a5, 0x271a6, 0x271a4, 0x2d962, 0x23d43, 0x2d960, 0x1fd39, 0x27195, 0x27191, 0x27194, 0x27190, 0x21929, 0x23d1f, 0x1b927, 0x1fd19,
+    0x0b1ad, 0x271ab, 0x0b1ac, 0x271aa, 0x2d173, 0x2f56b, 0x2d172, 0x2fd68, 0x27887, 0x27885, 0x27882, 0x11e7b, 0x0b946, 0x1b93a, 0x07942, 0x01c30,
+    0x09975, 0x0396e, 0x09972, 0x01b68, 0x27958, 0x23d3f, 0x09956, 0x1fd33, 0x09860, 0x0385c, 0x03856, 0x1da38, 0x0b921, 0x1991a, 0x0791e, 0x1dd09,
+    0x06f04, 0x2623e, 0x22f30, 0x02b68, 0x06a0b, 0x2623f, 0x2c33a, 0x0a36b, 0x20f0a, 0x26242, 0x2c334, 0x0a36a, 0x0ab0e, 0x26243, 0x2c33b, 0x0a36c,
+    0x02f30, 0x22e68, 0x2a77b, 0x062aa, 0x2663a, 0x2066b, 0x06785, 0x062ab, 0x0a642, 0x20272, 0x1a782, 0x062ac, 0x0a646, 0x20273, 0x1a787, 0x062ad,
+    0x16f19, 0x1a390, 0x16f39, 0x1a3a4, 0x26727, 0x1a394, 0x20760, 0x1a3a6, 0x2ef1f, 0x1a391, 0x2ef43, 0x1a3a5, 0x20729, 0x1a395, 0x20762, 0x1a3a7,
+    0x28f39, 0x066a4, 0x1677d, 0x047b0, 0x0a760, 0x066a6, 0x067a0, 0x047b3, 0x24758, 0x047a6, 0x16784, 0x187b2, 0x0a764, 0x066a9, 0x187a2, 0x01e75,
+    0x0af0a, 0x2c242, 0x20342, 0x06372, 0x1ae0e, 0x2c243, 0x1a346, 0x0a273, 0x26f0e, 0x26246, 0x20343, 0x06373, 0x26713, 0x26247, 0x1a347, 0x06374,
+    0x26634, 0x2066a, 0x06782, 0x1a2ac, 0x2663b, 0x2066c, 0x06787, 0x1a2ad, 0x0a643, 0x1a673, 0x06784, 0x062ae, 0x0a647, 0x20274, 0x06789, 0x11d6f,
+    0x24f1f, 0x06691, 0x2e758, 0x187a6, 0x26729, 0x06695, 0x1a764, 0x1a3a9, 0x26723, 0x1a398, 0x2075a, 0x187a8, 0x2672b, 0x1a399, 0x1a766, 0x01d93,
+    0x24f43, 0x066a5, 0x28784, 0x047b2, 0x0a762, 0x066a7, 0x067a2, 0x1db75, 0x2475a, 0x047a8, 0x0679f, 0x19e9c, 0x0a766, 0x1dd93, 0x067a3, 0x11f4c,
+    0x26f07, 0x2624a, 0x2ef32, 0x0a36e, 0x26711, 0x2624b, 0x2033c, 0x0a370, 0x20f0c, 0x0a24c, 0x20335, 0x0a36f, 0x20712, 0x0a24d, 0x2033d, 0x0a371,
+    0x08f32, 0x1a66e, 0x2a77c, 0x047ab, 0x2663c, 0x1a670, 0x06786, 0x062af, 0x0a644, 0x1a675, 0x1a783, 0x187ad, 0x0a648, 0x1a677, 0x1a788, 0x01c83,
+    0x2af1b, 0x1a392, 0x2af3b, 0x187a5, 0x26728, 0x1a396, 0x20761, 0x1a3a8, 0x2c720, 0x1a393, 0x2ef45, 0x1fc74, 0x2072a, 0x1a397, 0x20763, 0x1fc59,
+    0x28f3b, 0x047a5, 0x1677e, 0x047b1, 0x0a761, 0x066a8, 0x067a1, 0x05a9b, 0x24759, 0x047a7, 0x23871, 0x1f86c, 0x0a765, 0x21c93, 0x23c5f, 0x11e44,
+    0x26f0c, 0x1a24c, 0x20344, 0x06375, 0x26712, 0x1a24d, 0x1a348, 0x06377, 0x2670f, 0x0624e, 0x20345, 0x06376, 0x26714, 0x0624f, 0x1a349, 0x1b845,
+    0x26635, 0x1a66f, 0x06783, 0x047ad, 0x2663d, 0x1a671, 0x06788, 0x0b983, 0x0a645, 0x1a676, 0x27871, 0x2786f, 0x0a649, 0x07845, 0x0783d, 0x05d35,
+    0x26720, 0x06693, 0x2e759, 0x187a7, 0x2672a, 0x06697, 0x1a765, 0x0b993, 0x26724, 0x27865, 0x2075b, 0x23859, 0x2672c, 0x0782a, 0x1b824, 0x19c20,
+    0x24f45, 0x03974, 0x03871, 0x0386c, 0x0a763, 0x03959, 0x0395f, 0x0db44, 0x2475b, 0x09859, 0x03855, 0x11a41, 0x0b824, 0x05920, 0x0781d, 0x0580c,
+    0x04a0b, 0x1083f, 0x1093a, 0x02a6b, 0x06a1c, 0x02a54, 0x02b5d, 0x02a70, 0x04b1f, 0x08a58, 0x02b57, 0x02b73, 0x0aa23, 0x08a5a, 0x08b61, 0x08a77,
+    0x0cc3a, 0x1cc6b, 0x04d85, 0x048ab, 0x22e5d, 0x22a70, 0x262c9, 0x17fb9, 0x20e91, 0x2eaa6, 0x262ca, 0x262d3, 0x2c298, 0x2eaa8, 0x262cb, 0x0ff87,
+    0x10d27, 0x04c94, 0x1cd60, 0x189a6, 0x02ebc, 0x062d6, 0x16bc5, 0x03fcc, 0x1cf8c, 0x109c6, 0x12b95, 0x0ded2, 0x2ebbe, 0x062d7, 0x29cc7, 0x0fc95,
+    0x00d60, 0x04ca6, 0x06da0, 0x06db3, 0x28ec5, 0x23fcc, 0x070db, 0x07fa0, 0x12dc6, 0x1b0da, 0x22dcc, 0x05ea6, 0x206d8, 0x13fc6, 0x29cc5, 0x01f60,
+    0x18e1f, 0x22a58, 0x0ab91, 0x24aa6, 0x1aa23, 0x2ca5a, 0x26298, 0x24aa8, 0x06a29, 0x26a64, 0x0ab95, 0x262a9, 0x26a2b, 0x26a66, 0x26299, 0x03c93,
+    0x1ee57, 0x1ee73, 0x2c2ca, 0x2c2d3, 0x22e61, 0x22a77, 0x2c2cb, 0x13f87, 0x20e95, 0x2c2a9, 0x262cc, 0x07fd1, 0x2c299, 0x1f993, 0x09cc0, 0x11f5e,
+    0x00f8c, 0x0ccc6, 0x0edc6, 0x070da, 0x08ebe, 0x271d7, 0x271d8, 0x0ffc6, 0x04fbe, 0x070d8, 0x1b0d7, 0x0dec6, 0x070d5, 0x05dbe, 0x09cbe, 0x03c8c,
+    0x0ee95, 0x0ccd2, 0x02dcc, 0x19ba6, 0x28ec7, 0x13995, 0x179c5, 0x1df60, 0x070d7, 0x11bc6, 0x070d6, 0x05e94, 0x2f9be, 0x1dd8c, 0x03cbc, 0x11f27,
+    0x04f32, 0x26a6e, 0x1eb7c, 0x08bab, 0x06a3c, 0x26a70, 0x26b86, 0x262af, 0x06a44, 0x26a75, 0x26b83, 0x2fcad, 0x0aa48, 0x26a77, 0x2dc88, 0x03c83,
+    0x00e7c, 0x2eeab, 0x10db7, 0x270d4, 0x20e86, 0x202af, 0x270cd, 0x11fb7, 0x20e9b, 0x210b3, 0x210af, 0x2fcab, 0x2109e, 0x21c9b, 0x21c86, 0x01c7c,
+    0x10d5e, 0x06dd1, 0x12d87, 0x2d0d3, 0x08ec0, 0x270cc, 0x2d0cb, 0x2d0ca, 0x1eb93, 0x2d0a9, 0x23877, 0x1fc73, 0x2d099, 0x21c95, 0x23c61, 0x1fc57,
+    0x0ed87, 0x270d3, 0x16db9, 0x05aab, 0x270cb, 0x270ca, 0x270c9, 0x05f85, 0x2f8a8, 0x2f8a6, 0x23870, 0x1de6b, 0x2d098, 0x21c91, 0x23c5d, 0x0de3a,
+    0x1aa44, 0x2ca75, 0x26b9b, 0x270b3, 0x1aa48, 0x2ca77, 0x2709e, 0x2799b, 0x06a4e, 0x27078, 0x2d877, 0x2d875, 0x26a50, 0x0784e, 0x1b848, 0x1b844,
+    0x02e83, 0x2eead, 0x270af, 0x099ab, 0x2ce88, 0x27983, 0x27986, 0x1f97c, 0x27877, 0x27875, 0x27870, 0x2786e, 0x0b848, 0x07844, 0x0783c, 0x05d32,
+    0x02e93, 0x270a9, 0x258a8, 0x258a6, 0x27099, 0x0b995, 0x27098, 0x0b991, 0x27866, 0x27864, 0x2d85a, 0x23858, 0x2782b, 0x07829, 0x1b823, 0x19c1f,
+    0x09877, 0x03973, 0x03870, 0x01b6b, 0x09961, 0x03957, 0x0395d, 0x11b3a, 0x0985a, 0x09858, 0x03854, 0x11a3f, 0x0b823, 0x0591f, 0x0781c, 0x0580b,
+    0x1cf0a, 0x0c842, 0x1ef34, 0x02b6a, 0x06b1f, 0x02a58, 0x08b57, 0x08b73, 0x18b1b, 0x02a5e, 0x22f41, 0x02b6f, 0x0ab22, 0x08a62, 0x26b59, 0x15c76,
+    0x00c42, 0x18c72, 0x18d82, 0x1adac, 0x1ce91, 0x12aa6, 0x227ca, 0x01fd3, 0x2a792, 0x16ad1, 0x2a79c, 0x174ae, 0x2e7c1, 0x2f4d2, 0x2b4a8, 0x15c73,
+    0x12f1f, 0x18991, 0x12f43, 0x189a5, 0x20f8c, 0x2c3c6, 0x2eb95, 0x2c3d2, 0x22f28, 0x2c3c0, 0x22f4d, 0x17e89, 0x2eb8e, 0x2c3c7, 0x2b497, 0x15e62,
+    0x0ed58, 0x06da6, 0x16d84, 0x1adb2, 0x2e7c6, 0x190da, 0x227cc, 0x07ea6, 0x2a796, 0x234cc, 0x1679d, 0x17e84, 0x2e7c8, 0x2f4c6, 0x2b496, 0x0fe58,
+    0x04e34, 0x0aa82, 0x2ef6a, 0x263ac, 0x06b43, 0x26a84, 0x26b73, 0x263ae, 0x1ab3b, 0x0aa87, 0x2cb6c, 0x263ad, 0x0ab47, 0x26a89, 0x2c374, 0x15c6f,
+    0x0ef6a, 0x10cac, 0x2a7ac, 0x070d9, 0x1cea5, 0x1eab2, 0x227d3, 0x11fac, 0x28fa5, 0x234d3, 0x2a7b2, 0x2b4ac, 0x2e7cf, 0x1dda5, 0x29ca5, 0x0fc6a,
+    0x2af57, 0x203ca, 0x2af73, 0x203d3, 0x2cf95, 0x1a3cc, 0x203a9, 0x27ed1, 0x2ef61, 0x203cb, 0x2e777, 0x17e87, 0x20399, 0x2f4c0, 0x2b493, 0x15e5e,
+    0x14f73, 0x00cd3, 0x167ae, 0x1beac, 0x2e7d2, 0x139a6, 0x179d1, 0x19f72, 0x2a7a8, 0x234ca, 0x2b49c, 0x19e82, 0x2f4c1, 0x1dd91, 0x2b492, 0x01f42,
+    0x1ef1b, 0x26392, 0x1ef3b, 0x24ba5, 0x1ab28, 0x26396, 0x2cb61, 0x263a8, 0x22f20, 0x26393, 0x22f45, 0x2f474, 0x20b2a, 0x26397, 0x2fc63, 0x2bc59,
+    0x14d5e, 0x26dd1, 0x16d87, 0x210d3, 0x2e7c0, 0x1b0cc, 0x210cb, 0x210ca, 0x2a793, 0x210a9, 0x2f477, 0x2bc73, 0x21099, 0x2dc95, 0x2fc61, 0x2bc57,
+    0x12f22, 0x203c1, 0x12f47, 0x210cf, 0x20f8e, 0x210c8, 0x22799, 0x210c1, 0x2ef2a, 0x23499, 0x2fc4f, 0x13c47, 0x2108f, 0x21c8e, 0x2fc2a, 0x13c22,
+    0x14d62, 0x2d0d2, 0x16d89, 0x19aa5, 0x2d0c7, 0x2d0c6, 0x2d0c0, 0x19a91, 0x2a797, 0x2f895, 0x23c4d, 0x13c43, 0x2f88e, 0x21c8c, 0x23c28, 0x13c1f,
+    0x1ab41, 0x2639c, 0x2ef6c, 0x270b2, 0x1ab4d, 0x2709d, 0x2c377, 0x2709c, 0x20b45, 0x2d077, 0x2d06d, 0x2fc6c, 0x20b4f, 0x1b84d, 0x21845, 0x1b841,
+    0x14f6f, 0x270ae, 0x270ad, 0x270ac, 0x27989, 0x27984, 0x0b987, 0x0b982, 0x2d074, 0x27873, 0x2d86c, 0x2fc6a, 0x0b847, 0x07843, 0x1b83b, 0x05d34,
+    0x2af59, 0x270a8, 0x2e774, 0x258a5, 0x27097, 0x27096, 0x27093, 0x27092, 0x2ef63, 0x2d861, 0x23c45, 0x1fc3b, 0x2182a, 0x1b828, 0x23c20, 0x1fc1b,
+    0x14f76, 0x09873, 0x0386f, 0x01a6a, 0x09962, 0x03958, 0x0395e, 0x0db42, 0x27859, 0x09857, 0x23c41, 0x1fc34, 0x0b822, 0x0781f, 0x1981b, 0x1dc0a,
+    0x00b0e, 0x0c843, 0x1093b, 0x0096c, 0x00a23, 0x02a5a, 0x02b61, 0x02a77, 0x00b22, 0x02a62, 0x0cb59, 0x29676, 0x00b52, 0x02a66, 0x02b65, 0x29e4e,
+    0x00c46, 0x1c873, 0x18d87, 0x096ad, 0x1ce98, 0x12aa8, 0x0f6cb, 0x25f87, 0x1edc1, 0x134d2, 0x174a8, 0x29673, 0x2f4d0, 0x17fc1, 0x15698, 0x03e46,
+    0x1cd29, 0x18995, 0x1cd62, 0x256a7, 0x1ebbe, 0x097d7, 0x156c7, 0x25695, 0x1eb8e, 0x134c7, 0x17497, 0x29e62, 0x2f4c3, 0x174be, 0x1748e, 0x29e29,
+    0x00d64, 0x04ca9, 0x18da2, 0x0be75, 0x1d4d8, 0x2ffc6, 0x296c5, 0x0bf60, 0x1f4c8, 0x134c6, 0x17496, 0x25e58, 0x2f4c2, 0x174bd, 0x1748d, 0x03e21,
+    0x18e43, 0x1ca84, 0x0aba5, 0x096b2, 0x06a5a, 0x08a9f, 0x08aa8, 0x0969c, 0x06a62, 0x08aa2, 0x174a7, 0x29675, 0x0aa66, 0x08aa3, 0x29c93, 0x15e4c,
+    0x10e73, 0x1ccae, 0x0f6d3, 0x096ac, 0x1eaa8, 0x13f9c, 0x0f6ca, 0x25f82, 0x1f4d2, 0x1f4d1, 0x174a6, 0x29672, 0x2f9c1, 0x13f92, 0x29c91, 0x03e42,
+    0x0cf95, 0x00ccc, 0x156d2, 0x256a6, 0x0b1d7, 0x271d6, 0x156c6, 0x25694, 0x1f4c7, 0x1f4c5, 0x17495, 0x29e60, 0x2f4be, 0x2f4bc, 0x2b48c, 0x15e27,
+    0x00ca9, 0x1dbd1, 0x296d1, 0x07f72, 0x2b9c6, 0x1ff94, 0x296c4, 0x07f56, 0x1f4c6, 0x1f4c4, 0x17494, 0x25e56, 0x2f4bd, 0x1dd8b, 0x29c8b, 0x01f1e,
+    0x1cf3b, 0x08ba5, 0x1eb7e, 0x096b1, 0x06b61, 0x0aaa8, 0x08ba1, 0x0969b, 0x18b59, 0x234a7, 0x2f471, 0x2b46c, 0x0ab65, 0x2dc93, 0x2fc5f, 0x15e44,
+    0x0cd87, 0x1b0d3, 0x1edb9, 0x096ab, 0x1b0cb, 0x1b0ca, 0x1b0c9, 0x09f85, 0x234a8, 0x234a6, 0x2f470, 0x2b46b, 0x21098, 0x2dc91, 0x2fc5d, 0x0fe3a,
+    0x10d62, 0x210d2, 0x1ed89, 0x256a5, 0x210c7, 0x210c6, 0x210c0, 0x25691, 0x23497, 0x23495, 0x2fc4d, 0x17c43, 0x2f48e, 0x2f48c, 0x2fc28, 0x17c1f,
+    0x0eda2, 0x210d1, 0x2edba, 0x0be6e, 0x210c5, 0x210c4, 0x210bf, 0x0bf5c, 0x23496, 0x23494, 0x2fc4b, 0x13c3f, 0x2f48d, 0x21c8b, 0x2fc26, 0x0fe1a,
+    0x04f6c, 0x0b0b2, 0x270b1, 0x270b0, 0x06a77, 0x0b09c, 0x2709b, 0x2709a, 0x2d076, 0x2d075, 0x2f46c, 0x2f469, 0x2184e, 0x1b84c, 0x21844, 0x15e40,
+    0x0b0ad, 0x0b0ac, 0x270ab, 0x270aa, 0x27987, 0x27982, 0x27985, 0x11f7b, 0x2d073, 0x2d072, 0x2f46b, 0x2fc68, 0x0b846, 0x07842, 0x1b83a, 0x01d30,
+    0x270a7, 0x270a6, 0x270a5, 0x270a4, 0x27095, 0x27094, 0x27091, 0x27090, 0x2d862, 0x2d860, 0x23c43, 0x1fc39, 0x21829, 0x1b827, 0x23c1f, 0x1fc19,
+    0x09875, 0x03972, 0x0386e, 0x01a68, 0x09960, 0x03956, 0x0395c, 0x1db38, 0x27858, 0x09856, 0x23c3f, 0x1fc33, 0x0b821, 0x0591e, 0x1981a, 0x1dc09,
+    0x06f05, 0x26240, 0x26340, 0x02a69, 0x06a0c, 0x26241, 0x26344, 0x08a6c, 0x06b0c, 0x26244, 0x26341, 0x08b6c, 0x0aa0f, 0x26245, 0x26345, 0x0a36d,
+    0x26640, 0x22e69, 0x0629a, 0x062b0, 0x2c644, 0x22a6c, 0x0629b, 0x062b1, 0x2664c, 0x20275, 0x0629c, 0x062b2, 0x2064e, 0x20276, 0x0b477, 0x09d6c,
+    0x26740, 0x0639a, 0x22f69, 0x063b0, 0x2674c, 0x0639c, 0x20375, 0x063b2, 0x2c744, 0x0639b, 0x22b6c, 0x063b1, 0x2074e, 0x0b577, 0x20376, 0x09c6c,
+    0x02f69, 0x066b0, 0x067b0, 0x070b4, 0x0a675, 0x1a6b2, 0x067b3, 0x075b0, 0x0a775, 0x066b3, 0x1a7b2, 0x074b0, 0x0a678, 0x0b575, 0x0b475, 0x03c69,
+    0x06e0c, 0x2c244, 0x2634c, 0x0a275, 0x1ae0f, 0x2c245, 0x2634e, 0x0a276, 0x06f12, 0x26248, 0x2634d, 0x0a277, 0x26a14, 0x26249, 0x2634f, 0x27545,
+    0x26641, 0x22e6c, 0x1a29c, 0x1b1b2, 0x2c645, 0x2116d, 0x21177, 0x23d6c, 0x2664d, 0x20277, 0x0719d, 0x1b19c, 0x2064f, 0x2d545, 0x2754d, 0x27541,
+    0x26744, 0x0669b, 0x20775, 0x071b3, 0x2674e, 0x21577, 0x1b178, 0x21575, 0x26748, 0x0719e, 0x20777, 0x0749b, 0x26750, 0x27548, 0x2754e, 0x27544,
+    0x08e6c, 0x071b1, 0x071b2, 0x071b0, 0x21176, 0x2396c, 0x21175, 0x23d69, 0x0a777, 0x0719b, 0x0719c, 0x0719a, 0x2154e, 0x2d544, 0x2754c, 0x27540,
+    0x06f0c, 0x2624c, 0x2c344, 0x0a375, 0x06e12, 0x2624d, 0x26348, 0x0a377, 0x1af0f, 0x2624e, 0x2c345, 0x0a376, 0x26b14, 0x2624f, 0x26349, 0x27445,
+    0x26644, 0x20675, 0x0679b, 0x070b3, 0x26648, 0x20677, 0x0709e, 0x0759b, 0x2664e, 0x1b078, 0x21477, 0x21475, 0x26650, 0x2744e, 0x27448, 0x27444,
+    0x26741, 0x1a39c, 0x22f6c, 0x1b0b2, 0x2674d, 0x0709d, 0x20377, 0x1b09c, 0x2c745, 0x21077, 0x2106d, 0x23c6c, 0x2074f, 0x2744d, 0x2d445, 0x27441,
+    0x08f6c, 0x070b2, 0x070b1, 0x070b0, 0x0a677, 0x0709c, 0x0709b, 0x0709a, 0x21076, 0x21075, 0x2386c, 0x23c69, 0x2144e, 0x2744c, 0x2d444, 0x27440,
+    0x0af0f, 0x2024e, 0x2034e, 0x0b078, 0x26e14, 0x2114f, 0x27150, 0x2114e, 0x26f14, 0x27050, 0x2104f, 0x2104e, 0x27015, 0x27d14, 0x27c14, 0x0bc0f,
+    0x26645, 0x0b176, 0x0b177, 0x0b175, 0x27149, 0x2d145, 0x27148, 0x2d144, 0x2704f, 0x2704e, 0x2704d, 0x2704c, 0x27914, 0x1bd0f, 0x07c12, 0x07d0c,
+    0x26745, 0x0b077, 0x0b076, 0x0b075, 0x2714f, 0x2714d, 0x2714e, 0x2714c, 0x27049, 0x27048, 0x2d045, 0x2d044, 0x27814, 0x07d12, 0x1bc0f, 0x07c0c,
+    0x0b06d, 0x0996c, 0x0986c, 0x03969, 0x27145, 0x27141, 0x27144, 0x27140, 0x27045, 0x27044, 0x27041, 0x27040, 0x0b90f, 0x0790c, 0x0780c, 0x07c05,
+    0x04a0c, 0x10841, 0x0c944, 0x02a6c, 0x06a1d, 0x02a55, 0x02b5f, 0x02a71, 0x06a20, 0x08a59, 0x02b59, 0x08a74, 0x0aa24, 0x2555b, 0x0b563, 0x25d45,
+    0x10c44, 0x1ea6c, 0x0489b, 0x055b1, 0x22e5f, 0x22a71, 0x075a1, 0x1757e, 0x20e93, 0x055a7, 0x074a8, 0x055a5, 0x0b565, 0x25559, 0x0b561, 0x29d3b,
+    0x10d4c, 0x18c9c, 0x1c975, 0x055b2, 0x075a3, 0x0759f, 0x075a2, 0x29584, 0x1cf93, 0x055a8, 0x074a7, 0x074a5, 0x0b566, 0x2555a, 0x0b562, 0x25d43,
+    0x00c75, 0x195b2, 0x055b3, 0x055b0, 0x195a2, 0x17584, 0x075a0, 0x1757d, 0x055a9, 0x055a6, 0x074a6, 0x055a4, 0x0b564, 0x25558, 0x0b560, 0x29d39,
+    0x18e20, 0x22a59, 0x0ab93, 0x195a7, 0x1aa24, 0x2155b, 0x1b565, 0x2f559, 0x06a2a, 0x26a65, 0x07497, 0x07493, 0x2752c, 0x27524, 0x2752a, 0x27520,
+    0x1ee59, 0x1ee74, 0x1b1a8, 0x195a5, 0x21563, 0x2fd45, 0x21561, 0x2bd3b, 0x1b197, 0x1b193, 0x1b196, 0x1b192, 0x2152a, 0x2d520, 0x27528, 0x2bd1b,
+    0x00f93, 0x195a8, 0x1b1a9, 0x195a6, 0x1b566, 0x2155a, 0x1b564, 0x2f558, 0x1b199, 0x1b198, 0x07495, 0x07491, 0x2752b, 0x27523, 0x27529, 0x25d1f,
+    0x1b1a7, 0x1b1a5, 0x1b1a6, 0x1b1a4, 0x21562, 0x2fd43, 0x21560, 0x17d39, 0x1b195, 0x1b191, 0x1b194, 0x1b190, 0x21529, 0x2fd1f, 0x27527, 0x17d19,
+    0x04f35, 0x26a6f, 0x0ab83, 0x055ad, 0x06a3d, 0x26a71, 0x07588, 0x07583, 0x06a45, 0x1b476, 0x1b471, 0x1b46f, 0x0b449, 0x0b445, 0x2743d, 0x27435,
+    0x00e83, 0x195ad, 0x070af, 0x055ab, 0x1b588, 0x1b583, 0x07586, 0x2b57c, 0x1b477, 0x1b475, 0x1b470, 0x1b46e, 0x0b448, 0x0b444, 0x2743c, 0x09d32,
+    0x10f6f, 0x070ae, 0x1b0ad, 0x1b0ac, 0x07589, 0x07584, 0x07587, 0x07582, 0x21074, 0x1b473, 0x2146c, 0x2146a, 0x0b447, 0x0b443, 0x2743b, 0x27434,
+    0x070ad, 0x070ac, 0x070ab, 0x070aa, 0x1b587, 0x1b582, 0x07585, 0x2b57b, 0x21073, 0x21072, 0x2146b, 0x23c68, 0x0b446, 0x0b442, 0x2743a, 0x03d30,
+    0x1aa45, 0x07176, 0x07177, 0x07175, 0x1b149, 0x21145, 0x1b148, 0x21144, 0x0704f, 0x0704e, 0x1b04d, 0x1b04c, 0x27514, 0x2750f, 0x27512, 0x27d0c,
+    0x0b171, 0x0b16f, 0x0b170, 0x0b16e, 0x2113d, 0x21135, 0x2113c, 0x2fd32, 0x0b04d, 0x0b04c, 0x2704b, 0x2704a, 0x21512, 0x21d0c, 0x27511, 0x27d07,
+    0x0b074, 0x07173, 0x0b073, 0x0b072, 0x1b147, 0x21143, 0x1b146, 0x21142, 0x27047, 0x27046, 0x2d043, 0x2d042, 0x27513, 0x27d0e, 0x1bc0e, 0x07c0a,
+    0x0b16c, 0x0b16a, 0x0b16b, 0x03968, 0x2d13b, 0x2d134, 0x2d13a, 0x23d30, 0x27043, 0x27042, 0x2703f, 0x2703e, 0x0b90e, 0x21d0a, 0x0780b, 0x07d04,
+    0x04b0c, 0x0c844, 0x10941, 0x02b6c, 0x04a20, 0x02a59, 0x08b59, 0x02a74, 0x06b1d, 0x02a5f, 0x02b55, 0x02b71, 0x0ab24, 0x0b463, 0x2545b, 0x25c45,
+    0x10c4c, 0x1c875, 0x18d9c, 0x054b2, 0x1ce93, 0x075a7, 0x054a8, 0x075a5, 0x074a3, 0x074a2, 0x0749f, 0x29484, 0x0b466, 0x0b462, 0x2545a, 0x25c43,
+    0x10d44, 0x0499b, 0x1eb6c, 0x054b1, 0x20f93, 0x075a8, 0x054a7, 0x054a5, 0x22f5f, 0x074a1, 0x22b71, 0x1747e, 0x0b465, 0x0b461, 0x25459, 0x29c3b,
+    0x00d75, 0x054b3, 0x194b2, 0x054b0, 0x075a9, 0x075a6, 0x054a6, 0x075a4, 0x194a2, 0x074a0, 0x17484, 0x1747d, 0x0b464, 0x0b460, 0x25458, 0x29c39,
+    0x04e35, 0x0aa83, 0x26b6f, 0x054ad, 0x06b45, 0x1b571, 0x1b576, 0x1b56f, 0x06b3d, 0x07488, 0x26b71, 0x07483, 0x0b549, 0x2753d, 0x0b545, 0x27535,
+    0x10e6f, 0x1b1ad, 0x071ae, 0x1b1ac, 0x21174, 0x2156c, 0x1b573, 0x2156a, 0x07489, 0x07487, 0x07484, 0x07482, 0x0b547, 0x2753b, 0x0b543, 0x27534,
+    0x00f83, 0x071af, 0x194ad, 0x054ab, 0x1b577, 0x1b570, 0x1b575, 0x1b56e, 0x1b488, 0x07486, 0x1b483, 0x2b47c, 0x0b548, 0x2753c, 0x0b544, 0x09c32,
+    0x071ad, 0x071ab, 0x071ac, 0x071aa, 0x21173, 0x2156b, 0x21172, 0x23d68, 0x1b487, 0x07485, 0x1b482, 0x2b47b, 0x0b546, 0x2753a, 0x0b542, 0x03c30,
+    0x18f20, 0x0aa93, 0x22b59, 0x194a7, 0x06b2a, 0x07597, 0x26b65, 0x07593, 0x1ab24, 0x1b465, 0x2145b, 0x2f459, 0x2742c, 0x2742a, 0x27424, 0x27420,
+    0x00e93, 0x1b0a9, 0x194a8, 0x194a6, 0x1b099, 0x07595, 0x1b098, 0x07591, 0x1b466, 0x1b464, 0x2145a, 0x2f458, 0x2742b, 0x27429, 0x27423, 0x25c1f,
+    0x1ef59, 0x1b0a8, 0x1ef74, 0x194a5, 0x1b097, 0x1b096, 0x1b093, 0x1b092, 0x21463, 0x21461, 0x2fc45, 0x2bc3b, 0x2142a, 0x27428, 0x2d420, 0x2bc1b,
+    0x1b0a7, 0x1b0a6, 0x1b0a5, 0x1b0a4, 0x1b095, 0x1b094, 0x1b091, 0x1b090, 0x21462, 0x21460, 0x2fc43, 0x17c39, 0x21429, 0x27427, 0x2fc1f, 0x17c19,
+    0x1ab45, 0x07077, 0x07076, 0x07075, 0x0714f, 0x1b14d, 0x0714e, 0x1b14c, 0x1b049, 0x1b048, 0x21045, 0x21044, 0x27414, 0x27412, 0x2740f, 0x27c0c,
+    0x07074, 0x0b173, 0x07073, 0x07072, 0x27147, 0x2d143, 0x27146, 0x2d142, 0x1b047, 0x1b046, 0x21043, 0x21042, 0x27413, 0x1bd0e, 0x27c0e, 0x0bc0a,
+    0x0b071, 0x0b070, 0x0b06f, 0x0b06e, 0x0b14d, 0x2714b, 0x0b14c, 0x2714a, 0x2103d, 0x2103c, 0x21035, 0x2fc32, 0x21412, 0x27411, 0x21c0c, 0x27c07,
+    0x0b06c, 0x0b06b, 0x0b06a, 0x03868, 0x27143, 0x2713f, 0x27142, 0x2713e, 0x2d03b, 0x2d03a, 0x2d034, 0x23c30, 0x0b80e, 0x0790b, 0x21c0a, 0x07c04,
+    0x00a0f, 0x0c845, 0x0c945, 0x0366d, 0x00a24, 0x0155b, 0x01563, 0x0f745, 0x00b24, 0x01463, 0x0145b, 0x0f645, 0x01553, 0x03524, 0x03424, 0x0350f,
+    0x1cc4e, 0x01576, 0x01477, 0x0376c, 0x01565, 0x0f559, 0x01561, 0x1573b, 0x01466, 0x01462, 0x0145a, 0x0f643, 0x01552, 0x03522, 0x03423, 0x0350e,
+    0x1cd4e, 0x01577, 0x01476, 0x0366c, 0x01566, 0x0155a, 0x01562, 0x0f743, 0x01465, 0x01461, 0x0f459, 0x1563b, 0x01452, 0x03523, 0x03422, 0x0340e,
+    0x01578, 0x01575, 0x01475, 0x03669, 0x01564, 0x0f558, 0x01560, 0x29739, 0x01464, 0x01460, 0x0f458, 0x29639, 0x01551, 0x03521, 0x03421, 0x0350d,
+    0x18e45, 0x01571, 0x05574, 0x0156c, 0x0555b, 0x01555, 0x05559, 0x15741, 0x05463, 0x0145f, 0x01459, 0x0f644, 0x0b524, 0x0951d, 0x0b520, 0x0950c,
+    0x05576, 0x0156f, 0x05573, 0x0376a, 0x1b559, 0x2fd41, 0x05557, 0x15734, 0x05462, 0x0145e, 0x01458, 0x0f642, 0x0b522, 0x2551b, 0x0b51f, 0x2550a,
+    0x05577, 0x01570, 0x01473, 0x0366b, 0x0555a, 0x01554, 0x05558, 0x1573f, 0x05461, 0x0145d, 0x01457, 0x1563a, 0x0b523, 0x0951c, 0x0941f, 0x0950b,
+    0x05575, 0x0156e, 0x05572, 0x03768, 0x1b558, 0x2fd3f, 0x05556, 0x29733, 0x05460, 0x0145c, 0x01456, 0x29638, 0x0b521, 0x2551a, 0x0b51e, 0x29d09,
+    0x18f45, 0x01574, 0x01471, 0x0146c, 0x05563, 0x01559, 0x0155f, 0x0f744, 0x0545b, 0x05459, 0x01455, 0x15641, 0x0b424, 0x09520, 0x0941d, 0x0940c,
+    0x05477, 0x01573, 0x01470, 0x0376b, 0x05561, 0x01557, 0x0155d, 0x1573a, 0x0545a, 0x05458, 0x01454, 0x1563f, 0x0b423, 0x0951f, 0x0941c, 0x0940b,
+    0x05476, 0x05473, 0x0146f, 0x0366a, 0x05562, 0x01558, 0x0155e, 0x0f742, 0x1b459, 0x05457, 0x2fc41, 0x15634, 0x0b422, 0x0b41f, 0x2541b, 0x2540a,
+    0x05475, 0x01572, 0x0146e, 0x03668, 0x05560, 0x01556, 0x0155c, 0x29738, 0x1b458, 0x05456, 0x2fc3f, 0x29633, 0x0b421, 0x0951e, 0x2541a, 0x29c09,
+    0x0706d, 0x0556c, 0x0546c, 0x01569, 0x1b145, 0x1b141, 0x1b144, 0x1b140, 0x1b045, 0x1b044, 0x1b041, 0x1b040, 0x0b50f, 0x2750c, 0x2740c, 0x09505,
+    0x0716c, 0x0716a, 0x0716b, 0x01568, 0x2113b, 0x21134, 0x2113a, 0x2fd30, 0x1b043, 0x1b042, 0x1b03f, 0x1b03e, 0x0b50e, 0x2750a, 0x2740b, 0x09d04,
+    0x0706c, 0x0706b, 0x0706a, 0x01468, 0x1b143, 0x1b13f, 0x1b142, 0x1b13e, 0x2103b, 0x2103a, 0x21034, 0x2fc30, 0x0b40e, 0x2750b, 0x2740a, 0x09c04,
+    0x0b069, 0x0b168, 0x0b068, 0x0b067, 0x21139, 0x21133, 0x21138, 0x2fd2e, 0x21039, 0x21038, 0x21033, 0x2fc2e, 0x0b50d, 0x21d09, 0x21c09, 0x01c02,
+    0x00e04, 0x12e30, 0x2453e, 0x0ac68, 0x20e19, 0x2ee39, 0x02790, 0x0c6a4, 0x0ae30, 0x2c67b, 0x12f68, 0x006aa, 0x20e39, 0x2067d, 0x006a4, 0x006b0,
+    0x0ec0a, 0x28434, 0x24542, 0x0846a, 0x2ae1f, 0x2ae43, 0x0e491, 0x0e4a5, 0x08742, 0x2e682, 0x0e772, 0x0c6ac, 0x26658, 0x2e684, 0x006a6, 0x0c6b2,
+    0x02d0b, 0x2843a, 0x2453f, 0x0846b, 0x24627, 0x14660, 0x02794, 0x0e4a6, 0x2473a, 0x02685, 0x1476b, 0x025ab, 0x08660, 0x006a0, 0x027a6, 0x006b3,
+    0x02c0e, 0x2843b, 0x24543, 0x0846c, 0x28629, 0x14662, 0x0e495, 0x0e4a7, 0x02746, 0x0e687, 0x14573, 0x025ad, 0x02664, 0x0e6a2, 0x006a9, 0x05f75,
+    0x02e07, 0x16e32, 0x0254a, 0x0246e, 0x2ce1b, 0x2ee3b, 0x02792, 0x0c6a5, 0x26e32, 0x2c67c, 0x1476e, 0x006ab, 0x2ce3b, 0x2067e, 0x006a5, 0x006b1,
+    0x28e0c, 0x28435, 0x0254c, 0x0246f, 0x28620, 0x2ae45, 0x0e493, 0x13b74, 0x08744, 0x2e683, 0x0e775, 0x0c6ad, 0x26659, 0x13971, 0x006a7, 0x1396c,
+    0x24611, 0x2843c, 0x0254b, 0x02470, 0x24628, 0x14661, 0x02796, 0x0e4a8, 0x0873c, 0x02686, 0x14770, 0x006af, 0x08661, 0x006a1, 0x027a8, 0x01d9b,
+    0x28612, 0x2843d, 0x0254d, 0x02471, 0x2862a, 0x14663, 0x0e497, 0x13b59, 0x02748, 0x0e688, 0x0e777, 0x05b83, 0x02665, 0x13b5f, 0x15b93, 0x1df44,
+    0x02f0a, 0x14442, 0x28542, 0x08572, 0x26e1f, 0x2a658, 0x02791, 0x0c6a6, 0x24734, 0x02682, 0x1476a, 0x006ac, 0x26e43, 0x20684, 0x027a5, 0x006b2,
+    0x24e0e, 0x14443, 0x24546, 0x02473, 0x24623, 0x2a65a, 0x02798, 0x0c6a8, 0x08743, 0x02684, 0x0e773, 0x006ae, 0x0865a, 0x0069f, 0x006a8, 0x01c9c,
+    0x14f0e, 0x14446, 0x28543, 0x08573, 0x08629, 0x14664, 0x02795, 0x0c6a9, 0x2473b, 0x02687, 0x1476c, 0x0e5ad, 0x08662, 0x006a2, 0x027a7, 0x11c75,
+    0x02613, 0x14447, 0x24547, 0x08574, 0x0262b, 0x14666, 0x02799, 0x05a93, 0x02747, 0x02689, 0x0e774, 0x19a6f, 0x02666, 0x006a3, 0x11a93, 0x19e4c,
+    0x08e0c, 0x14444, 0x1454c, 0x02475, 0x24620, 0x2a659, 0x02793, 0x0c6a7, 0x08735, 0x02683, 0x1476f, 0x006ad, 0x26e45, 0x0b971, 0x0b974, 0x0796c,
+    0x2460f, 0x14445, 0x0254e, 0x02476, 0x24624, 0x2a65b, 0x25965, 0x17959, 0x08745, 0x25971, 0x0e776, 0x2596f, 0x0865b, 0x25955, 0x0b959, 0x19d41,
+    0x08612, 0x14448, 0x1454d, 0x02477, 0x0862a, 0x14665, 0x02797, 0x09893, 0x0873d, 0x02688, 0x14771, 0x09883, 0x08663, 0x0b85f, 0x07859, 0x19c44,
+    0x02614, 0x14449, 0x0254f, 0x0f945, 0x0262c, 0x15924, 0x0392a, 0x0db20, 0x02749, 0x0393d, 0x03945, 0x01a35, 0x03924, 0x0191d, 0x03920, 0x0190c,
+    0x0cc0a, 0x12e34, 0x18942, 0x06c6a, 0x1ee1f, 0x1ee43, 0x0c891, 0x0c8a5, 0x04b42, 0x22a82, 0x0cb72, 0x0eaac, 0x1aa58, 0x2ea84, 0x02aa6, 0x0ffb2,
+    0x0ec1b, 0x12e41, 0x0ad5e, 0x0ac6f, 0x12e28, 0x12e4d, 0x284c0, 0x2ff89, 0x2e692, 0x2e69c, 0x2edd1, 0x2f3ae, 0x2e696, 0x2f39d, 0x133cc, 0x2ff84,
+    0x02c1f, 0x24c57, 0x06d58, 0x0ac73, 0x16c8c, 0x2ac95, 0x284c6, 0x284d2, 0x10f91, 0x166ca, 0x1eda6, 0x05ed3, 0x2a6c6, 0x126cc, 0x0d1da, 0x03fa6,
+    0x02c22, 0x24c59, 0x0ad62, 0x0ac76, 0x16c8e, 0x2f397, 0x2b3c7, 0x21f62, 0x166c1, 0x2f3a8, 0x2b3d2, 0x21b73, 0x173c8, 0x2f396, 0x2b3c6, 0x1bf58,
+    0x10e1b, 0x12e3b, 0x24492, 0x26ca5, 0x22e22, 0x22e47, 0x284c1, 0x291cf, 0x1aa5e, 0x22a87, 0x08ad1, 0x151d3, 0x20a62, 0x2ea89, 0x291d2, 0x0dda5,
+    0x14c20, 0x16e45, 0x24493, 0x2b374, 0x16e2a, 0x16e4f, 0x17399, 0x23b47, 0x2e693, 0x2b377, 0x151a9, 0x2fb73, 0x2e697, 0x13b4d, 0x2b995, 0x1fb43,
+    0x14c28, 0x28c61, 0x24496, 0x244a8, 0x28e8e, 0x16699, 0x291c8, 0x291c1, 0x2a6c0, 0x151cb, 0x151cc, 0x151ca, 0x291c7, 0x291c0, 0x291c6, 0x0dd91,
+    0x28c2a, 0x28c63, 0x24497, 0x2fb59, 0x2918f, 0x17b2a, 0x29b8e, 0x23b22, 0x15199, 0x2bb61, 0x29b95, 0x21b57, 0x1798e, 0x13b28, 0x15b8c, 0x1fb1f,
+    0x0ec34, 0x28c6a, 0x08d82, 0x244ac, 0x20e57, 0x2ee73, 0x144ca, 0x144d3, 0x18f6a, 0x2e6ac, 0x12dac, 0x090d9, 0x20e73, 0x2e6ae, 0x19cd3, 0x01cac,
+    0x0ec3b, 0x28c6c, 0x08d87, 0x2f3ad, 0x2ae61, 0x2a677, 0x173cb, 0x23f87, 0x2cea5, 0x2f3b2, 0x173d3, 0x2f3ac, 0x2e6a8, 0x2f39c, 0x173ca, 0x23f82,
+    0x02c43, 0x24c73, 0x08d84, 0x084ae, 0x28e95, 0x166a9, 0x144cc, 0x09fd1, 0x10fa5, 0x166d3, 0x12db2, 0x1deac, 0x2a6d2, 0x2f8d1, 0x1f8a6, 0x11c72,
+    0x02c47, 0x28474, 0x08d89, 0x1bb6f, 0x14499, 0x2f393, 0x2b3c0, 0x1bf5e, 0x173cf, 0x2dba5, 0x11aa5, 0x19a6a, 0x173c1, 0x2f392, 0x11a91, 0x05e42,
+    0x14c41, 0x2ae6c, 0x2449c, 0x251b2, 0x2ee59, 0x2a674, 0x251a8, 0x279a5, 0x1ae6f, 0x251ad, 0x091ae, 0x251ac, 0x20e76, 0x0b96f, 0x0b973, 0x05d6a,
+    0x14c45, 0x2916d, 0x29177, 0x2bb6c, 0x2ae63, 0x17b45, 0x29961, 0x13b3b, 0x29174, 0x2996c, 0x25973, 0x2bb6a, 0x25959, 0x13b41, 0x25957, 0x1dd34,
+    0x14c4d, 0x28477, 0x0919d, 0x2519c, 0x25197, 0x25193, 0x25196, 0x25192, 0x09889, 0x09887, 0x09884, 0x09882, 0x0b862, 0x0b85e, 0x07858, 0x19c42,
+    0x28c4f, 0x15945, 0x1594d, 0x15941, 0x2992a, 0x17b20, 0x15928, 0x11b1b, 0x03947, 0x0f93b, 0x03943, 0x01a34, 0x03922, 0x0f91b, 0x0391f, 0x11b0a,
+    0x00d0b, 0x1c83a, 0x1893f, 0x06d6b, 0x18a27, 0x10a60, 0x00b94, 0x0c8a6, 0x18b3a, 0x00a85, 0x12d6b, 0x009ab, 0x04a60, 0x00aa0, 0x00ba6, 0x03eb3,
+    0x00c1f, 0x06c57, 0x0ad58, 0x06c73, 0x12c8c, 0x1ec95, 0x1c8c6, 0x19fd2, 0x14f91, 0x245ca, 0x2ada6, 0x245d3, 0x1eac6, 0x12acc, 0x0f1da, 0x01fa6,
+    0x00d1c, 0x0ac5d, 0x24d54, 0x0ad70, 0x12cbc, 0x2ecc5, 0x025d6, 0x0becc, 0x12f5d, 0x245c9, 0x12d70, 0x21eb9, 0x20fc5, 0x011db, 0x13ecc, 0x01ea0,
+    0x02d23, 0x0ac61, 0x24d5a, 0x0ad77, 0x16cbe, 0x2ecc7, 0x293d7, 0x1bb95, 0x28598, 0x245cb, 0x2ada8, 0x1be87, 0x293d8, 0x21bc5, 0x1fec6, 0x05e60,
+    0x00e32, 0x10c7c, 0x24d6e, 0x26cab, 0x18a5e, 0x1ea87, 0x02ad1, 0x291d3, 0x06f7c, 0x18ab7, 0x16fab, 0x031d4, 0x1aa87, 0x20ab9, 0x251d3, 0x01dab,
+    0x02d44, 0x24c83, 0x24d75, 0x26cad, 0x12c93, 0x17977, 0x291a9, 0x13b73, 0x28f9b, 0x291af, 0x291b3, 0x17bab, 0x2b9a8, 0x13970, 0x2b9a6, 0x11f6b,
+    0x02d3c, 0x08c86, 0x24d70, 0x085af, 0x16cc0, 0x291cb, 0x251cc, 0x291ca, 0x28f86, 0x031cd, 0x285af, 0x19eb7, 0x251cb, 0x251c9, 0x251ca, 0x01e85,
+    0x02d48, 0x24c88, 0x24d77, 0x07b83, 0x29199, 0x17b61, 0x15b95, 0x1db57, 0x2919e, 0x29b86, 0x29b9b, 0x07b7c, 0x29198, 0x13b5d, 0x15b91, 0x19f3a,
+    0x0cf1f, 0x08c91, 0x16d58, 0x26da6, 0x06f8c, 0x1aac6, 0x18bc6, 0x090da, 0x1cf57, 0x285ca, 0x12f73, 0x285d3, 0x1af95, 0x0aacc, 0x1dcd2, 0x0dca6,
+    0x02d29, 0x08c95, 0x24d64, 0x245a9, 0x00ebe, 0x0f1d7, 0x031d8, 0x19fc6, 0x14f95, 0x245cc, 0x285a9, 0x03ed1, 0x031d7, 0x031d6, 0x1dcc6, 0x0dc94,
+    0x14d23, 0x24598, 0x16d5a, 0x26da8, 0x26fbe, 0x090d8, 0x250d7, 0x1bec6, 0x16f61, 0x285cb, 0x16d77, 0x1fe87, 0x2cfc7, 0x2f8c5, 0x1f895, 0x11e60,
+    0x02d2b, 0x24599, 0x24d66, 0x07b93, 0x090d5, 0x27bbe, 0x01abe, 0x05a8c, 0x28599, 0x0bbc0, 0x13893, 0x19e5e, 0x178be, 0x0bbbc, 0x11a8c, 0x19e27,
+    0x0ed44, 0x08c9b, 0x28d75, 0x091b3, 0x06f93, 0x279a8, 0x251a9, 0x279a6, 0x06f83, 0x091af, 0x2afad, 0x278ab, 0x0b977, 0x0b970, 0x07873, 0x05c6b,
+    0x02d4e, 0x29977, 0x25178, 0x29975, 0x25966, 0x1795a, 0x25964, 0x17958, 0x25977, 0x25970, 0x25975, 0x2596e, 0x2595a, 0x25954, 0x0b958, 0x19d3f,
+    0x14d48, 0x0919e, 0x28d77, 0x0989b, 0x25199, 0x25198, 0x09895, 0x09891, 0x28f88, 0x09886, 0x25883, 0x1187c, 0x0b861, 0x0b85d, 0x07857, 0x1dc3a,
+    0x02d50, 0x15948, 0x0394e, 0x0f944, 0x0392b, 0x15923, 0x03929, 0x0db1f, 0x03948, 0x0393c, 0x03944, 0x01a32, 0x03923, 0x0191c, 0x0181f, 0x0190b,
+    0x00c0e, 0x1c83b, 0x18943, 0x0486c, 0x1ca29, 0x10a62, 0x0c895, 0x277a7, 0x00b46, 0x0ca87, 0x10973, 0x0b7ad, 0x00a64, 0x0eaa2, 0x02aa9, 0x09f75,
+    0x00c22, 0x18c59, 0x06d62, 0x2d776, 0x1ec8e, 0x23397, 0x1f3c7, 0x2df62, 0x1eac1, 0x233a8, 0x1f3d2, 0x2d773, 0x1f3c8, 0x23396, 0x1f3c6, 0x27f58,
+    0x00d23, 0x06c61, 0x06d5a, 0x06d77, 0x1ecbe, 0x217c7, 0x1d3d7, 0x27795, 0x10f98, 0x1b7cb, 0x1eda8, 0x27e87, 0x1d3d8, 0x217c5, 0x2bec6, 0x09e60,
+    0x00c52, 0x0ac65, 0x0ad66, 0x21f4e, 0x2f3c3, 0x2f38e, 0x2f3be, 0x21f29, 0x2f3d0, 0x21798, 0x2fec1, 0x0bf46, 0x2f3c2, 0x2f38d, 0x2f3bd, 0x0bf21,
+    0x10e3b, 0x1ec7e, 0x0aca5, 0x277b1, 0x1ca62, 0x1ea89, 0x151d2, 0x277a5, 0x18a87, 0x1eab9, 0x0f1d3, 0x277ab, 0x18aa2, 0x2eaba, 0x291d1, 0x03f6e,
+    0x0cc59, 0x2f371, 0x173a7, 0x2f36c, 0x17397, 0x2fb4d, 0x17395, 0x23b43, 0x173a8, 0x2f370, 0x173a6, 0x2f36b, 0x17396, 0x2fb4b, 0x17394, 0x23b3f,
+    0x02c61, 0x08ca1, 0x08da8, 0x2779b, 0x151c7, 0x151c0, 0x151c6, 0x27791, 0x0f1cb, 0x151c9, 0x0f1ca, 0x27e85, 0x291c5, 0x291bf, 0x291c4, 0x03e5c,
+    0x02c65, 0x2fb5f, 0x29b93, 0x21f44, 0x1738e, 0x2fb28, 0x2b38c, 0x23b1f, 0x15198, 0x2fb5d, 0x29b91, 0x1bf3a, 0x1738d, 0x2fb26, 0x29b8b, 0x19f1a,
+    0x0cf43, 0x08ca5, 0x1cd84, 0x0b7b2, 0x18e95, 0x217d2, 0x00bcc, 0x277a6, 0x1cf73, 0x1b7d3, 0x1edae, 0x0b7ac, 0x06aa9, 0x217d1, 0x1dcd1, 0x09f72,
+    0x02d62, 0x233a7, 0x08da2, 0x2d775, 0x133c7, 0x23395, 0x1f3c5, 0x2df60, 0x133d2, 0x233a6, 0x1f3d1, 0x2d772, 0x133c6, 0x23394, 0x1f3c4, 0x09f56,
+    0x02d5a, 0x0ada8, 0x08d9f, 0x0b79c, 0x090d7, 0x217c6, 0x090d6, 0x27794, 0x12da8, 0x1b7ca, 0x1fe9c, 0x27e82, 0x2f8c6, 0x217c4, 0x13e94, 0x03e56,
+    0x02d66, 0x2db93, 0x08da3, 0x1bf4c, 0x173be, 0x2f38c, 0x2f3bc, 0x1bf27, 0x178c1, 0x2db91, 0x1fe92, 0x07f42, 0x173bd, 0x21b8b, 0x1da8b, 0x07f1e,
+    0x00e6c, 0x091b1, 0x091b2, 0x091b0, 0x251a7, 0x251a5, 0x251a6, 0x251a4, 0x091ad, 0x091ab, 0x091ac, 0x091aa, 0x0b975, 0x0b96e, 0x0b972, 0x01d68,
+    0x29176, 0x2b36c, 0x29175, 0x2f369, 0x29962, 0x17b43, 0x29960, 0x1fb39, 0x29173, 0x2b36b, 0x29172, 0x2fb68, 0x25958, 0x13b3f, 0x25956, 0x1dd33,
+    0x02d77, 0x0919b, 0x0919c, 0x0919a, 0x25195, 0x25191, 0x25194, 0x25190, 0x25887, 0x09885, 0x25882, 0x1fe7b, 0x0b860, 0x0b85c, 0x07856, 0x1dc38,
+    0x2994e, 0x15944, 0x1594c, 0x1bf40, 0x29929, 0x17b1f, 0x15927, 0x1fb19, 0x03946, 0x0f93a, 0x03942, 0x01a30, 0x03921, 0x0f91a, 0x0391e, 0x1db09,
+    0x00e07, 0x1ee32, 0x0094a, 0x0086e, 0x20e1b, 0x22e3b, 0x00b92, 0x0eaa5, 0x06e32, 0x20a7c, 0x10b6e, 0x02aab, 0x20e3b, 0x20a7e, 0x02aa5, 0x03db1,
+    0x16e1b, 0x16e3b, 0x04d92, 0x1aca5, 0x2ee22, 0x2ee47, 0x1c8c1, 0x1d1cf, 0x2665e, 0x2e687, 0x046d1, 0x111d3, 0x2c662, 0x2e689, 0x1d1d2, 0x0fda5,
+    0x02e32, 0x16c7c, 0x18d6e, 0x06cab, 0x2465e, 0x2a687, 0x006d1, 0x1d1d3, 0x08f7c, 0x246b7, 0x1efab, 0x011d4, 0x26687, 0x206b9, 0x191d3, 0x03dab,
+    0x14e3b, 0x16c7e, 0x06ca5, 0x06cb1, 0x28662, 0x16689, 0x111d2, 0x1bba5, 0x24687, 0x166b9, 0x0d1d3, 0x07bab, 0x246a2, 0x2e6ba, 0x1d1d1, 0x01f6e,
+    0x00e17, 0x2ee37, 0x011ce, 0x2f1ba, 0x20e1d, 0x2ee3d, 0x211a3, 0x2f189, 0x26e37, 0x2c680, 0x271ba, 0x211b9, 0x20e3d, 0x21181, 0x21189, 0x21d7e,
+    0x16e1d, 0x16e3d, 0x171a3, 0x17189, 0x2ee24, 0x2ee49, 0x2f166, 0x2f947, 0x2665f, 0x2b188, 0x2b1a2, 0x2b187, 0x2f163, 0x2f93d, 0x2f162, 0x2393b,
+    0x02e37, 0x2a680, 0x031ba, 0x171b9, 0x2465f, 0x2f188, 0x2d1a2, 0x2f187, 0x24680, 0x251b8, 0x091b9, 0x251b7, 0x2d188, 0x2d180, 0x2d187, 0x21d7c,
+    0x28e3d, 0x17181, 0x29189, 0x17b7e, 0x2b163, 0x1793d, 0x2b162, 0x1793b, 0x29188, 0x2b180, 0x29187, 0x17b7c, 0x2f15f, 0x2f937, 0x2f15e, 0x1f932,
+    0x08e1b, 0x2e65e, 0x10d92, 0x1c6d1, 0x26e22, 0x2e662, 0x04bc1, 0x191d2, 0x0ae3b, 0x2c687, 0x1efa5, 0x051d3, 0x26e47, 0x20689, 0x051cf, 0x03da5,
+    0x24e22, 0x2a662, 0x00dc1, 0x0d1d2, 0x24e52, 0x2e666, 0x011d0, 0x1dfc1, 0x26662, 0x2c6a2, 0x011d2, 0x011d1, 0x26666, 0x206a3, 0x05cc1, 0x01c92,
+    0x08e3b, 0x28687, 0x12fa5, 0x011d3, 0x24662, 0x2a6a2, 0x051d2, 0x051d1, 0x08f7e, 0x086b9, 0x1efb1, 0x1f8ab, 0x26689, 0x266ba, 0x1f8a5, 0x11c6e,
+    0x24e47, 0x28689, 0x011cf, 0x07ba5, 0x24666, 0x166a3, 0x01ac1, 0x19f92, 0x08689, 0x026ba, 0x138a5, 0x19a6e, 0x086a3, 0x006ce, 0x1dc92, 0x01e4a,
+    0x08e1d, 0x2e65f, 0x091a3, 0x251a2, 0x26e24, 0x2d163, 0x27166, 0x2d162, 0x26e3d, 0x27188, 0x27189, 0x27187, 0x26e49, 0x2193d, 0x27947, 0x2193b,
+    0x24e24, 0x29163, 0x25166, 0x29162, 0x25153, 0x2f924, 0x25952, 0x2f922, 0x25163, 0x2515f, 0x25162, 0x2515e, 0x27924, 0x2191d, 0x27922, 0x2191b,
+    0x08e3d, 0x25188, 0x09189, 0x25187, 0x27163, 0x2715f, 0x27162, 0x2715e, 0x09181, 0x25180, 0x0987e, 0x0987c, 0x2793d, 0x27937, 0x0b93b, 0x07932,
+    0x24e49, 0x2993d, 0x25947, 0x1593b, 0x25924, 0x1791d, 0x25922, 0x1791b, 0x0993d, 0x03937, 0x0993b, 0x03932, 0x0991d, 0x01917, 0x0991b, 0x01907,
+    0x1ce0c, 0x1ee35, 0x0094c, 0x0086f, 0x1ee20, 0x1ee45, 0x0c893, 0x17774, 0x04b44, 0x22a83, 0x0cb75, 0x137ad, 0x1aa59, 0x13571, 0x1f5a7, 0x1756c,
+    0x10c20, 0x12e45, 0x18893, 0x1f374, 0x1ee2a, 0x1f74f, 0x13399, 0x2f747, 0x22a93, 0x1f377, 0x111a9, 0x23773, 0x1f597, 0x1374d, 0x1f595, 0x2b743,
+    0x00d44, 0x18c83, 0x18d75, 0x1f7ad, 0x16c93, 0x13577, 0x1d1a9, 0x17773, 0x1cf9b, 0x1d1af, 0x1d1b3, 0x1f7ab, 0x1f5a8, 0x13570, 0x1f5a6, 0x1756b,
+    0x0ec59, 0x23371, 0x133a7, 0x2336c, 0x13397, 0x2374d, 0x13395, 0x2f743, 0x133a8, 0x23370, 0x133a6, 0x2336b, 0x13396, 0x2f74b, 0x13394, 0x2f73f,
+    0x1ee1d, 0x1ee3d, 0x1f1a3, 0x1f189, 0x22e24, 0x23549, 0x23166, 0x23547, 0x1aa5f, 0x1f188, 0x1f1a2, 0x1f187, 0x23163, 0x2f53d, 0x23162, 0x2f53b,
+    0x12e24, 0x13349, 0x13166, 0x13347, 0x2f12c, 0x2f114, 0x2f12b, 0x2f113, 0x13165, 0x13348, 0x13164, 0x13346, 0x2f12a, 0x2f112, 0x2f129, 0x13d0e,
+    0x14c5f, 0x13188, 0x111a2, 0x13187, 0x23165, 0x23548, 0x23164, 0x23546, 0x1f1a1, 0x1f186, 0x1f1a0, 0x1f185, 0x23161, 0x2f53c, 0x23160, 0x2f53a,
+    0x17163, 0x1733d, 0x17162, 0x2b33b, 0x1712a, 0x17112, 0x17129, 0x23b0e, 0x17161, 0x1733c, 0x17160, 0x2b33a, 0x2f128, 0x2f111, 0x2f127, 0x1ff0b,
+    0x00f41, 0x2ee6f, 0x10d9c, 0x1d1ae, 0x20e59, 0x13576, 0x1d1a8, 0x13573, 0x1ae6c, 0x1d1ad, 0x1d1b2, 0x1d1ac, 0x20e74, 0x1356f, 0x1f5a5, 0x1756a,
+    0x14e59, 0x1f376, 0x111a8, 0x1f373, 0x2ee65, 0x1f74e, 0x13398, 0x2f746, 0x111a7, 0x1f375, 0x111a6, 0x1f372, 0x1f593, 0x1374c, 0x1f591, 0x2b742,
+    0x0ee6c, 0x111ad, 0x111b2, 0x111ac, 0x1d1a7, 0x13575, 0x1d1a6, 0x17772, 0x1d1b1, 0x1d1ab, 0x1d1b0, 0x1d1aa, 0x1d1a5, 0x1356e, 0x1d1a4, 0x15d68,
+    0x0ec74, 0x2336f, 0x133a5, 0x2336a, 0x13393, 0x2374c, 0x13391, 0x2f742, 0x111a5, 0x2336e, 0x111a4, 0x1bb68, 0x13392, 0x2f74a, 0x13390, 0x2f73e,
+    0x00e55, 0x2ee71, 0x0919f, 0x1f184, 0x2d15b, 0x23545, 0x2d15a, 0x23543, 0x1ae71, 0x27183, 0x27184, 0x27182, 0x2d945, 0x2f535, 0x2d943, 0x2f534,
+    0x1715b, 0x17345, 0x1715a, 0x17343, 0x2f124, 0x2f10f, 0x2f123, 0x2f90e, 0x29159, 0x17344, 0x29158, 0x17342, 0x2f120, 0x2f90c, 0x2d91f, 0x1fd0a,
+    0x14e71, 0x25183, 0x09184, 0x25182, 0x2d159, 0x23544, 0x2d158, 0x23542, 0x0917e, 0x2517c, 0x0917d, 0x2517b, 0x2793b, 0x21932, 0x27939, 0x1b930,
+    0x29945, 0x17335, 0x29943, 0x2b334, 0x2b120, 0x1790c, 0x2991f, 0x13b0a, 0x2593b, 0x29932, 0x09939, 0x15930, 0x2591b, 0x2f907, 0x09919, 0x1f904,
+    0x10c11, 0x1c83c, 0x0094b, 0x00870, 0x18a28, 0x10a61, 0x00b96, 0x0c8a8, 0x04b3c, 0x00a86, 0x10b70, 0x02aaf, 0x04a61, 0x00aa1, 0x00ba8, 0x03d9b,
+    0x10c28, 0x1cc61, 0x04d96, 0x188a8, 0x1ce8e, 0x1ec99, 0x1d1c8, 0x1d1c1, 0x02fc0, 0x111cb, 0x111cc, 0x111ca, 0x1d1c7, 0x1d1c0, 0x1d1c6, 0x0fd91,
+    0x00d3c, 0x04c86, 0x18d70, 0x06caf, 0x12cc0, 0x1d1cb, 0x191cc, 0x1d1ca, 0x1cf86, 0x011cd, 0x1efaf, 0x25eb7, 0x191cb, 0x191c9, 0x191ca, 0x03e85,
+    0x00c61, 0x06ca1, 0x04da8, 0x07b9b, 0x111c7, 0x111c0, 0x111c6, 0x1bb91, 0x0d1cb, 0x111c9, 0x0d1ca, 0x07e85, 0x1d1c5, 0x1d1bf, 0x1d1c4, 0x01e5c,
+    0x00e37, 0x10c80, 0x011ba, 0x1f1b9, 0x18a5f, 0x23188, 0x211a2, 0x23187, 0x06f80, 0x191b8, 0x071b9, 0x191b7, 0x21188, 0x21180, 0x21187, 0x2dd7c,
+    0x10c5f, 0x17188, 0x171a2, 0x17187, 0x2f165, 0x2f948, 0x2f164, 0x2f946, 0x171a1, 0x17186, 0x171a0, 0x17185, 0x2f161, 0x2f93c, 0x2f160, 0x2393a,
+    0x0ec80, 0x111b8, 0x011b9, 0x111b7, 0x211a1, 0x2f186, 0x211a0, 0x2f185, 0x011b8, 0x011b6, 0x011b7, 0x011b5, 0x21186, 0x2117f, 0x21185, 0x01d7a,
+    0x15188, 0x17180, 0x15187, 0x2bb7c, 0x2b161, 0x1793c, 0x2b160, 0x1793a, 0x29186, 0x1717f, 0x29185, 0x07b7a, 0x2f15d, 0x2f936, 0x2f15c, 0x1df31,
+    0x00f28, 0x0ecc0, 0x10d96, 0x011cc, 0x04e8e, 0x191c7, 0x051c8, 0x191c6, 0x18f61, 0x051cb, 0x1cba8, 0x051ca, 0x1af99, 0x191c0, 0x051c1, 0x03d91,
+    0x00e8e, 0x0d1c7, 0x011c8, 0x0d1c6, 0x011c3, 0x1d1be, 0x011c2, 0x1d1bd, 0x011c7, 0x011c5, 0x011c6, 0x011c4, 0x051be, 0x191bc, 0x051bd, 0x03d8b,
+    0x0cf61, 0x011cb, 0x10da8, 0x011ca, 0x051c7, 0x051c5, 0x051c6, 0x051c4, 0x1efa1, 0x011c9, 0x1f89b, 0x1fe85, 0x051c0, 0x051bf, 0x1f891, 0x11e5c,
+    0x02c99, 0x0d1c0, 0x011c1, 0x07b91, 0x011be, 0x111bc, 0x011bd, 0x07b8b, 0x011c0, 0x011bf, 0x13891, 0x19e5c, 0x011bc, 0x011bb, 0x1f88b, 0x01e25,
+    0x00f5f, 0x091a1, 0x091a2, 0x091a0, 0x27165, 0x2d161, 0x27164, 0x2d160, 0x0b188, 0x27186, 0x0b187, 0x27185, 0x27948, 0x2193c, 0x27946, 0x2193a,
+    0x25165, 0x29161, 0x25164, 0x29160, 0x25152, 0x2f923, 0x25151, 0x2f921, 0x25161, 0x2515d, 0x25160, 0x2515c, 0x27923, 0x2191c, 0x27921, 0x2191a,
+    0x09188, 0x09186, 0x09187, 0x09185, 0x27161, 0x2715d, 0x27160, 0x2715c, 0x09180, 0x0917f, 0x2587c, 0x0987a, 0x2793c, 0x27936, 0x0b93a, 0x05c31,
+    0x25948, 0x2993c, 0x25946, 0x1593a, 0x25923, 0x1791c, 0x25921, 0x1791a, 0x0993c, 0x03936, 0x0993a, 0x01a31, 0x0991c, 0x01916, 0x0991a, 0x01906,
+    0x1cc12, 0x1c83d, 0x0094d, 0x00871, 0x1ca2a, 0x13763, 0x11797, 0x17759, 0x00b48, 0x11788, 0x0cb77, 0x09783, 0x00a65, 0x1375f, 0x11793, 0x29f44,
+    0x1cc2a, 0x1f763, 0x1d797, 0x23759, 0x1d18f, 0x1f72a, 0x1d78e, 0x2f722, 0x11199, 0x1f761, 0x1d795, 0x2d757, 0x1f58e, 0x13728, 0x1178c, 0x2b71f,
+    0x00d48, 0x1d788, 0x18d77, 0x0b783, 0x1d199, 0x13761, 0x11795, 0x17757, 0x1d19e, 0x1d786, 0x1d79b, 0x0977c, 0x1d198, 0x1375d, 0x11791, 0x25f3a,
+    0x00c65, 0x2375f, 0x1d793, 0x2df44, 0x1f38e, 0x23728, 0x1f38c, 0x2f71f, 0x11198, 0x2375d, 0x1d791, 0x27f3a, 0x1f38d, 0x2f726, 0x1d78b, 0x25f1a,
+    0x1ce3d, 0x1f181, 0x1d189, 0x1f77e, 0x1f163, 0x1f53d, 0x1f162, 0x1353b, 0x1d188, 0x1f180, 0x1d187, 0x1177c, 0x2315f, 0x2f537, 0x2315e, 0x17532,
+    0x13163, 0x1f33d, 0x13162, 0x1f33b, 0x1f12a, 0x1f112, 0x1f129, 0x2f70e, 0x13161, 0x1f33c, 0x13160, 0x1f33a, 0x23128, 0x23111, 0x23127, 0x17f0b,
+    0x11188, 0x11180, 0x11187, 0x1f77c, 0x1f161, 0x1f53c, 0x1f160, 0x1353a, 0x1d186, 0x1f17f, 0x1d185, 0x0977a, 0x2315d, 0x2f536, 0x2315c, 0x17531,
+    0x1315f, 0x2f337, 0x1315e, 0x2f332, 0x13128, 0x13111, 0x13127, 0x2ff0b, 0x1315d, 0x2f336, 0x1315c, 0x2f331, 0x2f126, 0x2f110, 0x2f125, 0x2ff06,
+    0x00f4d, 0x1d789, 0x1d19d, 0x1d784, 0x1d197, 0x13762, 0x1d196, 0x17758, 0x18b77, 0x11787, 0x1d19c, 0x09782, 0x1d193, 0x1375e, 0x1d192, 0x29f42,
+    0x11197, 0x1f762, 0x11196, 0x23758, 0x1d18e, 0x1f729, 0x1d18d, 0x2f721, 0x11195, 0x1f760, 0x11194, 0x2d756, 0x1d18c, 0x13727, 0x1f58b, 0x2b71e,
+    0x0cd77, 0x1d787, 0x1119c, 0x0b782, 0x1d195, 0x13760, 0x1d194, 0x17756, 0x1d19b, 0x1d785, 0x1d19a, 0x0977b, 0x1d191, 0x1375c, 0x1d190, 0x09f38,
+    0x11193, 0x2375e, 0x11192, 0x2df42, 0x1118c, 0x23727, 0x1f38b, 0x2f71e, 0x11191, 0x2375c, 0x11190, 0x27f38, 0x1d18b, 0x2f725, 0x1d18a, 0x09f18,
+    0x00e71, 0x1f17e, 0x1d184, 0x1f17d, 0x23159, 0x1f53b, 0x23158, 0x1f539, 0x0b183, 0x1f17c, 0x0b182, 0x1f17b, 0x2d944, 0x2f532, 0x2d942, 0x2f530,
+    0x17159, 0x1333b, 0x17158, 0x1f339, 0x2f122, 0x2f10e, 0x2f121, 0x2f10d, 0x17157, 0x1333a, 0x17156, 0x1f338, 0x2f11f, 0x2f90b, 0x2f11e, 0x1fd09,
+    0x09183, 0x1117c, 0x09182, 0x1117b, 0x2d157, 0x1f53a, 0x2d156, 0x1f538, 0x0917c, 0x0917a, 0x0917b, 0x09179, 0x2793a, 0x2f531, 0x27938, 0x2f52f,
+    0x29944, 0x17332, 0x29942, 0x2f330, 0x2b11f, 0x1790b, 0x2b11e, 0x1fb09, 0x2593a, 0x17331, 0x09938, 0x2f32f, 0x2591a, 0x2f906, 0x09918, 0x1ff03,
+    0x00f0a, 0x10842, 0x1c942, 0x04972, 0x1ae1f, 0x1ea58, 0x00b91, 0x0eaa6, 0x06e34, 0x00a82, 0x12f6a, 0x02aac, 0x1ae43, 0x20a84, 0x00ba5, 0x03cb2,
+    0x0cc34, 0x1cc6a, 0x04d82, 0x06dac, 0x2ce57, 0x22e73, 0x087ca, 0x1dfd3, 0x24f6a, 0x2c6ac, 0x287ac, 0x050d9, 0x2ce73, 0x206ae, 0x087d3, 0x03cac,
+    0x0ef1f, 0x04c91, 0x12d58, 0x1ada6, 0x0af8c, 0x266c6, 0x247c6, 0x050da, 0x16f57, 0x0a6ca, 0x16f73, 0x11ed3, 0x26f95, 0x0a6cc, 0x247d2, 0x0fca6,
+    0x0ef43, 0x04ca5, 0x28d84, 0x06db2, 0x24e95, 0x266d2, 0x027cc, 0x1bba6, 0x28f73, 0x0a6d3, 0x287ae, 0x19eac, 0x0a6a9, 0x21bd1, 0x29cd1, 0x05f72,
+    0x06e1b, 0x22a5e, 0x28792, 0x28ad1, 0x1ae22, 0x22a62, 0x087c1, 0x251d2, 0x06e3b, 0x20a87, 0x2afa5, 0x091d3, 0x1ae47, 0x20a89, 0x091cf, 0x01da5,
+    0x02f41, 0x22e6f, 0x2879c, 0x291ae, 0x2ce59, 0x22e76, 0x291a8, 0x17973, 0x26e6c, 0x291ad, 0x291b2, 0x291ac, 0x26674, 0x1396f, 0x2b9a5, 0x11d6a,
+    0x02f28, 0x266c0, 0x28796, 0x031cc, 0x08e8e, 0x251c7, 0x091c8, 0x251c6, 0x24f61, 0x091cb, 0x287a8, 0x091ca, 0x0a699, 0x251c0, 0x091c1, 0x01d91,
+    0x02f4d, 0x29b89, 0x2919d, 0x29b84, 0x29197, 0x17b62, 0x29196, 0x13b58, 0x24777, 0x15b87, 0x2919c, 0x05b82, 0x29193, 0x13b5e, 0x29192, 0x1df42,
+    0x00f1b, 0x2c692, 0x12d5e, 0x20dd1, 0x0ae28, 0x2c696, 0x247c0, 0x0b0cc, 0x0ae41, 0x2c69c, 0x12f6f, 0x210ae, 0x0ae4d, 0x2109d, 0x21c89, 0x21c84,
+    0x02f3b, 0x2eea5, 0x14d87, 0x0b0d3, 0x26e61, 0x2c6a8, 0x0b0cb, 0x0b0ca, 0x24f6c, 0x2d0b2, 0x2d0ad, 0x2d0ac, 0x26677, 0x2d09c, 0x21c87, 0x01c82,
+    0x14f22, 0x266c1, 0x16d62, 0x270d2, 0x26f8e, 0x270c8, 0x270c7, 0x270c6, 0x28f59, 0x2d0a8, 0x16f76, 0x23873, 0x2d097, 0x2d096, 0x23c62, 0x1fc58,
+    0x14f47, 0x270cf, 0x28d89, 0x05aa5, 0x08799, 0x270c1, 0x270c0, 0x05a91, 0x24774, 0x2f8a5, 0x2386f, 0x1da6a, 0x2d093, 0x2d092, 0x23c5e, 0x11e42,
+    0x08f20, 0x2c693, 0x28793, 0x0b0a9, 0x26e2a, 0x2c697, 0x0b099, 0x27995, 0x0ae45, 0x27077, 0x27074, 0x2d873, 0x26e4f, 0x0b84d, 0x1b847, 0x1b843,
+    0x08f45, 0x25174, 0x25177, 0x29973, 0x26e63, 0x29959, 0x25961, 0x17957, 0x2706d, 0x2596c, 0x2786c, 0x2596a, 0x0b845, 0x0b841, 0x0783b, 0x19d34,
+    0x08f2a, 0x09199, 0x28797, 0x25895, 0x2708f, 0x2798e, 0x0988e, 0x0b98c, 0x24f63, 0x27861, 0x2d859, 0x2d857, 0x2782a, 0x0b828, 0x1b822, 0x1b81f,
+    0x08f4f, 0x15947, 0x0394d, 0x0f943, 0x0992a, 0x15922, 0x03928, 0x0f91f, 0x09945, 0x0393b, 0x03941, 0x0da34, 0x09920, 0x0191b, 0x0781b, 0x0190a,
+    0x18e0e, 0x10843, 0x18946, 0x00873, 0x18a23, 0x1ea5a, 0x00b98, 0x0eaa8, 0x04b43, 0x00a84, 0x0cb73, 0x02aae, 0x04a5a, 0x00a9f, 0x02aa8, 0x03c9c,
+    0x0cc3b, 0x1cc6c, 0x04d87, 0x233ad, 0x1ee61, 0x1ea77, 0x133cb, 0x2ff87, 0x20ea5, 0x233b2, 0x133d3, 0x233ac, 0x22aa8, 0x2339c, 0x133ca, 0x2ff82,
+    0x00d29, 0x04c95, 0x18d64, 0x1ada9, 0x02ebe, 0x0d1d7, 0x011d8, 0x25fc6, 0x10f95, 0x189cc, 0x1eda9, 0x01ed1, 0x011d7, 0x011d6, 0x29cc6, 0x0fc94,
+    0x00d62, 0x2f3a7, 0x06da2, 0x21b75, 0x173c7, 0x2f395, 0x173c5, 0x21f60, 0x173d2, 0x2f3a6, 0x173d1, 0x1bf72, 0x173c6, 0x2f394, 0x173c4, 0x05f56,
+    0x18e22, 0x1ea62, 0x02dc1, 0x0f1d2, 0x18e52, 0x22a66, 0x031d0, 0x29fc1, 0x1aa62, 0x20aa2, 0x031d2, 0x031d1, 0x1aa66, 0x20aa3, 0x09cc1, 0x03c92,
+    0x10e59, 0x2b376, 0x151a8, 0x2b373, 0x22e65, 0x17b4e, 0x17398, 0x23b46, 0x151a7, 0x2b375, 0x151a6, 0x2b372, 0x2b993, 0x13b4c, 0x2b991, 0x1fb42,
+    0x02e8e, 0x0f1c7, 0x031c8, 0x0f1c6, 0x031c3, 0x291be, 0x031c2, 0x291bd, 0x031c7, 0x031c5, 0x031c6, 0x031c4, 0x091be, 0x251bc, 0x091bd, 0x01d8b,
+    0x15197, 0x2bb62, 0x15196, 0x2fb58, 0x2918e, 0x17b29, 0x2918d, 0x23b21, 0x15195, 0x2bb60, 0x15194, 0x21b56, 0x2918c, 0x13b27, 0x1798b, 0x1df1e,
+    0x00f3b, 0x22ea5, 0x10d87, 0x070d3, 0x1ae61, 0x20aa8, 0x070cb, 0x070ca, 0x18f6c, 0x210b2, 0x210ad, 0x210ac, 0x1aa77, 0x2109c, 0x2dc87, 0x03c82,
+    0x00e7e, 0x2f3b1, 0x00db9, 0x2f3ab, 0x20ea1, 0x2f39b, 0x0b0c9, 0x2ff85, 0x210b1, 0x210b0, 0x210ab, 0x210aa, 0x2109b, 0x2109a, 0x21c85, 0x01c7b,
+    0x0cd62, 0x0b0d2, 0x10da2, 0x270d1, 0x0b0c7, 0x0b0c6, 0x270c5, 0x270c4, 0x2d0a7, 0x2d0a6, 0x23875, 0x1fc72, 0x2d095, 0x2d094, 0x23c60, 0x1fc56,
+    0x02d89, 0x2f3a5, 0x02dba, 0x1bb6e, 0x0b0c0, 0x2f391, 0x270bf, 0x1bf5c, 0x2d0a5, 0x2d0a4, 0x2386e, 0x19a68, 0x2d091, 0x2d090, 0x23c5c, 0x01e38,
+    0x04e59, 0x091a7, 0x091a8, 0x091a6, 0x1ae65, 0x27993, 0x0b098, 0x27991, 0x27076, 0x27075, 0x27073, 0x27072, 0x2784e, 0x0b84c, 0x1b846, 0x1b842,
+    0x25171, 0x2916c, 0x25170, 0x2916b, 0x2595f, 0x17b44, 0x2595d, 0x13b3a, 0x2516c, 0x25169, 0x2516b, 0x25968, 0x0b844, 0x13b40, 0x0783a, 0x19d30,
+    0x09197, 0x09195, 0x09196, 0x09194, 0x0918e, 0x2518c, 0x0918d, 0x2798b, 0x27862, 0x27860, 0x2d858, 0x2d856, 0x27829, 0x0b827, 0x1b821, 0x19c1e,
+    0x2594d, 0x15943, 0x0394b, 0x1593f, 0x25928, 0x1591f, 0x03926, 0x11b1a, 0x09943, 0x03939, 0x0393f, 0x01a33, 0x0991f, 0x01919, 0x0781a, 0x01909,
+    0x10f0e, 0x10846, 0x1c943, 0x04973, 0x04a29, 0x10a64, 0x00b95, 0x0eaa9, 0x18b3b, 0x00a87, 0x10b6c, 0x174ad, 0x04a62, 0x00aa2, 0x2b4a7, 0x15c75,
+    0x00c43, 0x18c73, 0x04d84, 0x06dae, 0x1ce95, 0x12aa9, 0x108cc, 0x05fd1, 0x14fa5, 0x1f4d3, 0x174b2, 0x174ac, 0x234d2, 0x2f4d1, 0x2b4a6, 0x15c72,
+    0x10d23, 0x04c98, 0x1cd5a, 0x1ada8, 0x06fbe, 0x050d8, 0x190d7, 0x27ec6, 0x12f61, 0x1f4cb, 0x12d77, 0x2be87, 0x234c7, 0x2f4c5, 0x2b495, 0x15e60,
+    0x00d5a, 0x06da8, 0x06d9f, 0x1be9c, 0x050d7, 0x2dbc6, 0x050d6, 0x07e94, 0x16da8, 0x1f4ca, 0x1749c, 0x1be82, 0x234c6, 0x2f4c4, 0x2b494, 0x01e56,
+    0x04e3b, 0x1ca87, 0x16fa5, 0x031d3, 0x18a62, 0x1eaa2, 0x091d2, 0x091d1, 0x06f7e, 0x06ab9, 0x174b1, 0x174ab, 0x06a89, 0x26aba, 0x2b4a5, 0x15c6e,
+    0x0ce6c, 0x151ad, 0x151b2, 0x151ac, 0x291a7, 0x17975, 0x291a6, 0x13b72, 0x291b1, 0x291ab, 0x291b0, 0x291aa, 0x291a5, 0x1396e, 0x291a4, 0x11d68,
+    0x0ef61, 0x031cb, 0x14da8, 0x031ca, 0x091c7, 0x091c5, 0x091c6, 0x091c4, 0x16fa1, 0x031c9, 0x1749b, 0x17e85, 0x091c0, 0x091bf, 0x2b491, 0x15e5c,
+    0x0ed77, 0x29b87, 0x1519c, 0x07b82, 0x29195, 0x17b60, 0x29194, 0x1db56, 0x2919b, 0x29b85, 0x2919a, 0x19e7b, 0x29191, 0x13b5c, 0x29190, 0x05f38,
+    0x10f22, 0x06ac1, 0x12d62, 0x1b0d2, 0x06f8e, 0x070c8, 0x1b0c7, 0x1b0c6, 0x1cf59, 0x210a8, 0x2f476, 0x2f473, 0x21097, 0x21096, 0x2fc62, 0x2bc58,
+    0x0ed62, 0x070d2, 0x16da2, 0x070d1, 0x070c7, 0x070c6, 0x070c5, 0x070c4, 0x210a7, 0x210a6, 0x2f475, 0x2f472, 0x21095, 0x21094, 0x2fc60, 0x2bc56,
+    0x10f52, 0x270d0, 0x12d66, 0x21ec1, 0x270c3, 0x270c2, 0x210be, 0x210bd, 0x12f65, 0x23498, 0x2fc4e, 0x13c46, 0x2108e, 0x2108d, 0x2fc29, 0x13c21,
+    0x14d66, 0x27bc1, 0x16da3, 0x1be92, 0x270be, 0x270bd, 0x270bc, 0x05a8b, 0x2f893, 0x2f891, 0x23c4c, 0x13c42, 0x2d08c, 0x2f88b, 0x23c27, 0x13c1e,
+    0x00f59, 0x0b0a8, 0x0b0a7, 0x0b0a6, 0x0b097, 0x0b096, 0x0b095, 0x0b094, 0x27071, 0x27070, 0x2d06c, 0x2d06b, 0x2784d, 0x2784b, 0x21843, 0x1b83f,
+    0x25176, 0x25173, 0x25175, 0x25172, 0x25962, 0x29958, 0x25960, 0x17956, 0x2706c, 0x2706b, 0x27069, 0x27868, 0x0b843, 0x0b83f, 0x07839, 0x05d33,
+    0x14f65, 0x09198, 0x25893, 0x25891, 0x2708e, 0x2708d, 0x2708c, 0x0988b, 0x2785f, 0x2785d, 0x23c44, 0x1fc3a, 0x27828, 0x27826, 0x2181f, 0x1fc1a,
+    0x0994e, 0x15946, 0x0394c, 0x0f942, 0x09929, 0x15921, 0x03927, 0x0db1e, 0x09944, 0x0393a, 0x23c40, 0x11a30, 0x0b81f, 0x0191a, 0x07819, 0x05809,
+    0x00d13, 0x10847, 0x18947, 0x04974, 0x00a2b, 0x10a66, 0x00b99, 0x09693, 0x00b47, 0x00a89, 0x0cb74, 0x2566f, 0x00a66, 0x00aa3, 0x15693, 0x25e4c,
+    0x00c47, 0x18c74, 0x04d89, 0x2776f, 0x1ce99, 0x23393, 0x1f3c0, 0x27f5e, 0x1f3cf, 0x217a5, 0x156a5, 0x2566a, 0x1f3c1, 0x23392, 0x15691, 0x09e42,
+    0x00d2b, 0x04c99, 0x18d66, 0x0b793, 0x050d5, 0x077be, 0x036be, 0x0968c, 0x10f99, 0x077c0, 0x17493, 0x25e5e, 0x1f4be, 0x0b7bc, 0x1568c, 0x25e27,
+    0x00d66, 0x21793, 0x06da3, 0x27f4c, 0x1f3be, 0x2338c, 0x233bc, 0x27f27, 0x1f4c1, 0x21791, 0x17492, 0x0bf42, 0x1f3bd, 0x2178b, 0x2968b, 0x0bf1e,
+    0x18e47, 0x1ca89, 0x031cf, 0x0b7a5, 0x18a66, 0x1eaa3, 0x036c1, 0x09692, 0x04a89, 0x00aba, 0x174a5, 0x2566e, 0x06aa3, 0x00ace, 0x15692, 0x03e4a,
+    0x0cc74, 0x2f36f, 0x173a5, 0x2f36a, 0x17393, 0x2fb4c, 0x17391, 0x23b42, 0x151a5, 0x2f36e, 0x151a4, 0x27768, 0x17392, 0x2fb4a, 0x17390, 0x03e3e,
+    0x00c99, 0x0f1c0, 0x031c1, 0x0b791, 0x031be, 0x151bc, 0x031bd, 0x2778b, 0x031c0, 0x031bf, 0x17491, 0x25e5c, 0x031bc, 0x031bb, 0x1748b, 0x03e25,
+    0x15193, 0x2fb5e, 0x15192, 0x21f42, 0x1518c, 0x2fb27, 0x1738b, 0x21f1e, 0x15191, 0x2fb5c, 0x15190, 0x07f38, 0x2918b, 0x2fb25, 0x2918a, 0x07f18,
+    0x10f47, 0x070cf, 0x1cd89, 0x096a5, 0x18e99, 0x070c1, 0x1b0c0, 0x09691, 0x1cf74, 0x234a5, 0x2f46f, 0x2966a, 0x21093, 0x21092, 0x2fc5e, 0x15e42,
+    0x00d89, 0x233a5, 0x00dba, 0x2776e, 0x070c0, 0x23391, 0x070bf, 0x27f5c, 0x210a5, 0x210a4, 0x2f46e, 0x25668, 0x21091, 0x21090, 0x2fc5c, 0x03e38,
+    0x10d66, 0x077c1, 0x1eda3, 0x0b792, 0x070be, 0x070bd, 0x1b0bc, 0x0968b, 0x23493, 0x23491, 0x2fc4c, 0x17c42, 0x2108c, 0x2f48b, 0x2fc27, 0x17c1e,
+    0x00da3, 0x21792, 0x00dce, 0x27f4a, 0x0b0bc, 0x2f38b, 0x270bb, 0x27f25, 0x23492, 0x21790, 0x2fc4a, 0x13c3e, 0x2108b, 0x2108a, 0x2fc25, 0x01e18,
+    0x00f74, 0x091a5, 0x0b0a5, 0x0b0a4, 0x0b093, 0x0b092, 0x0b091, 0x0b090, 0x2706f, 0x2706e, 0x2d06a, 0x2f468, 0x2784c, 0x2784a, 0x21842, 0x15e3e,
+    0x2516f, 0x2916a, 0x2516e, 0x2f368, 0x2595e, 0x17b42, 0x2595c, 0x1fb38, 0x2706a, 0x25168, 0x27068, 0x27067, 0x0b842, 0x13b3e, 0x07838, 0x01d2e,
+    0x09193, 0x09191, 0x09192, 0x09190, 0x0b08c, 0x0918b, 0x2708b, 0x2708a, 0x2785e, 0x2785c, 0x23c42, 0x1fc38, 0x27827, 0x27825, 0x23c1e, 0x1fc18,
+    0x2594c, 0x15942, 0x0394a, 0x1bf3e, 0x25927, 0x17b1e, 0x03925, 0x1fb18, 0x09942, 0x03938, 0x23c3e, 0x01a2e, 0x0991e, 0x01918, 0x07818, 0x1dc08,
+    0x04e0c, 0x10844, 0x1094c, 0x00875, 0x1ae20, 0x1ea59, 0x00b93, 0x1b5a7, 0x06e35, 0x00a83, 0x10b6f, 0x074ad, 0x1ae45, 0x0b571, 0x07574, 0x0b56c,
+    0x10c41, 0x1ee6c, 0x04d9c, 0x191b2, 0x22e59, 0x22e74, 0x191a8, 0x1b5a5, 0x26e6f, 0x191ad, 0x051ae, 0x191ac, 0x07576, 0x0b56f, 0x07573, 0x0b56a,
+    0x0cd44, 0x04c9b, 0x1cd75, 0x051b3, 0x0af93, 0x1b5a8, 0x191a9, 0x1b5a6, 0x0af83, 0x051af, 0x1b4ad, 0x074ab, 0x07577, 0x0b570, 0x0b473, 0x0b56b,
+    0x02e6c, 0x051b1, 0x051b2, 0x051b0, 0x191a7, 0x191a5, 0x191a6, 0x191a4, 0x051ad, 0x051ab, 0x051ac, 0x051aa, 0x07575, 0x0b56e, 0x07572, 0x03d68,
+    0x06e1d, 0x22a5f, 0x071a3, 0x191a2, 0x1ae24, 0x21163, 0x1b166, 0x21162, 0x06e3d, 0x1b188, 0x07189, 0x1b187, 0x1b549, 0x2153d, 0x1b547, 0x2d53b,
+    0x02e55, 0x22e71, 0x0719f, 0x17184, 0x2115b, 0x2f945, 0x2115a, 0x2f943, 0x26e71, 0x1b183, 0x07184, 0x1b182, 0x21545, 0x21535, 0x21543, 0x2d534,
+    0x02f5f, 0x071a1, 0x071a2, 0x071a0, 0x1b165, 0x21161, 0x1b164, 0x21160, 0x07188, 0x07186, 0x07187, 0x07185, 0x1b548, 0x2153c, 0x1b546, 0x2d53a,
+    0x02e71, 0x1717e, 0x29184, 0x1717d, 0x2f159, 0x2b93b, 0x2f158, 0x17939, 0x07183, 0x2b17c, 0x07182, 0x2b17b, 0x21544, 0x2f932, 0x21542, 0x23930,
+    0x04f20, 0x20a93, 0x1cb93, 0x070a9, 0x06e2a, 0x1b597, 0x07099, 0x1b595, 0x06e45, 0x1b077, 0x1b074, 0x21473, 0x0744f, 0x0b44d, 0x27447, 0x27443,
+    0x08e59, 0x051a7, 0x051a8, 0x051a6, 0x26e65, 0x1b593, 0x07098, 0x1b591, 0x1b076, 0x1b075, 0x1b073, 0x1b072, 0x0744e, 0x0b44c, 0x27446, 0x27442,
+    0x02f59, 0x070a8, 0x070a7, 0x070a6, 0x07097, 0x07096, 0x07095, 0x07094, 0x1b071, 0x1b070, 0x2106c, 0x2106b, 0x1b44d, 0x2744b, 0x2d443, 0x2743f,
+    0x02f74, 0x051a5, 0x070a5, 0x070a4, 0x07093, 0x07092, 0x07091, 0x07090, 0x1b06f, 0x1b06e, 0x2106a, 0x23868, 0x1b44c, 0x2744a, 0x2d442, 0x2743e,
+    0x0ae24, 0x0b165, 0x0b166, 0x0b164, 0x2712c, 0x2112a, 0x2712b, 0x21129, 0x0b049, 0x0b048, 0x0b047, 0x0b046, 0x27114, 0x21112, 0x27113, 0x0bd0e,
+    0x2515b, 0x25159, 0x2515a, 0x25158, 0x27124, 0x2d120, 0x27123, 0x2f91f, 0x0b045, 0x0b044, 0x0b043, 0x0b042, 0x2710f, 0x2190c, 0x2790e, 0x1bd0a,
+    0x0b163, 0x0b161, 0x0b162, 0x0b160, 0x2712a, 0x27128, 0x27129, 0x27127, 0x2703d, 0x2703c, 0x2703b, 0x2703a, 0x27112, 0x27111, 0x1b80e, 0x07c0b,
+    0x25945, 0x2993b, 0x25943, 0x29939, 0x27120, 0x2b91b, 0x2591f, 0x17919, 0x27035, 0x09932, 0x27034, 0x03930, 0x2790c, 0x27907, 0x0b90a, 0x07904,
+    0x18e0f, 0x10845, 0x0094e, 0x1d576, 0x18a24, 0x1d55b, 0x19565, 0x13559, 0x04b45, 0x19571, 0x19576, 0x1956f, 0x0755b, 0x25555, 0x07559, 0x25d41,
+    0x10c45, 0x1d16d, 0x1d177, 0x1f76c, 0x1d563, 0x13745, 0x1d561, 0x1773b, 0x1d174, 0x1d56c, 0x19573, 0x1f76a, 0x19559, 0x13741, 0x07557, 0x17734,
+    0x00d4e, 0x1d577, 0x19178, 0x1d575, 0x19566, 0x1d55a, 0x19564, 0x13558, 0x19577, 0x19570, 0x19575, 0x1956e, 0x0755a, 0x25554, 0x07558, 0x25d3f,
+    0x1d176, 0x1f36c, 0x1d175, 0x23369, 0x1d562, 0x13743, 0x1d560, 0x17739, 0x1d173, 0x1f36b, 0x1d172, 0x23768, 0x19558, 0x1373f, 0x07556, 0x17733,
+    0x18e24, 0x1d163, 0x19166, 0x1d162, 0x19153, 0x23524, 0x19552, 0x23522, 0x19163, 0x1915f, 0x19162, 0x1915e, 0x1b524, 0x2151d, 0x1b522, 0x2d51b,
+    0x1d15b, 0x13345, 0x1d15a, 0x13343, 0x23124, 0x2310f, 0x23123, 0x2350e, 0x1d159, 0x13344, 0x1d158, 0x13342, 0x23120, 0x2f50c, 0x2151f, 0x2f50a,
+    0x19165, 0x1d161, 0x19164, 0x1d160, 0x19152, 0x23523, 0x19151, 0x23521, 0x19161, 0x1915d, 0x19160, 0x1915c, 0x1b523, 0x2151c, 0x1b521, 0x2d51a,
+    0x13159, 0x1733b, 0x13158, 0x17339, 0x23122, 0x2310e, 0x23121, 0x2310d, 0x1d157, 0x1733a, 0x1d156, 0x17338, 0x2311f, 0x2f50b, 0x2311e, 0x17d09,
+    0x04f45, 0x19174, 0x19177, 0x1d573, 0x19563, 0x1d559, 0x19561, 0x1d557, 0x1b06d, 0x1956c, 0x1b46c, 0x1956a, 0x07445, 0x0b441, 0x0b43b, 0x0b434,
+    0x19171, 0x1d16c, 0x19170, 0x1d16b, 0x1955f, 0x13744, 0x1955d, 0x1773a, 0x1916c, 0x19169, 0x1916b, 0x19568, 0x07444, 0x13740, 0x0b43a, 0x25d30,
+    0x19176, 0x19173, 0x19175, 0x19172, 0x19562, 0x1d558, 0x19560, 0x1d556, 0x1b06c, 0x1b06b, 0x1b069, 0x1b468, 0x07443, 0x0b43f, 0x27439, 0x27433,
+    0x1916f, 0x1d16a, 0x1916e, 0x23368, 0x1955e, 0x13742, 0x1955c, 0x17738, 0x1b06a, 0x19168, 0x1b068, 0x1b067, 0x07442, 0x1373e, 0x27438, 0x03d2e,
+    0x0715b, 0x19159, 0x0715a, 0x19158, 0x1b124, 0x21120, 0x1b123, 0x2351f, 0x07045, 0x07044, 0x07043, 0x07042, 0x1b10f, 0x2150c, 0x1b50e, 0x2d50a,
+    0x25155, 0x13341, 0x25154, 0x1333f, 0x2111d, 0x2f10c, 0x2111c, 0x2f10b, 0x0b041, 0x0b040, 0x0b03f, 0x0b03e, 0x2110c, 0x21105, 0x2110b, 0x21d04,
+    0x07159, 0x07157, 0x07158, 0x07156, 0x1b122, 0x2111f, 0x1b121, 0x2111e, 0x0b03b, 0x0b03a, 0x27039, 0x27038, 0x1b10e, 0x2150b, 0x1b10d, 0x27d09,
+    0x25941, 0x17334, 0x2593f, 0x17333, 0x2d11b, 0x2f10a, 0x2d11a, 0x17909, 0x0b034, 0x25930, 0x27033, 0x0392e, 0x2d10a, 0x21904, 0x27909, 0x19d02,
+    0x04f12, 0x10848, 0x1094d, 0x00877, 0x04a2a, 0x10a65, 0x05497, 0x05493, 0x04b3d, 0x05488, 0x10b71, 0x05483, 0x07463, 0x0b45f, 0x0b459, 0x25c44,
+    0x10c4d, 0x1c877, 0x0519d, 0x1919c, 0x19197, 0x19193, 0x19196, 0x19192, 0x05489, 0x05487, 0x05484, 0x05482, 0x07462, 0x0b45e, 0x0b458, 0x25c42,
+    0x10d48, 0x0519e, 0x1cd77, 0x0549b, 0x19199, 0x19198, 0x05495, 0x05491, 0x19488, 0x05486, 0x19483, 0x1747c, 0x07461, 0x0b45d, 0x25457, 0x29c3a,
+    0x00d77, 0x0519b, 0x0519c, 0x0519a, 0x19195, 0x19191, 0x19194, 0x19190, 0x19487, 0x05485, 0x19482, 0x1747b, 0x07460, 0x0b45c, 0x25456, 0x29c38,
+    0x04e3d, 0x19188, 0x05189, 0x19187, 0x1b163, 0x1b15f, 0x1b162, 0x1b15e, 0x07181, 0x19180, 0x0747e, 0x0747c, 0x0753d, 0x27537, 0x0753b, 0x27532,
+    0x10e71, 0x19183, 0x05184, 0x19182, 0x21159, 0x2f944, 0x21158, 0x2f942, 0x0717e, 0x1917c, 0x0717d, 0x1917b, 0x1b53b, 0x21532, 0x07539, 0x27530,
+    0x05188, 0x05186, 0x05187, 0x05185, 0x1b161, 0x1b15d, 0x1b160, 0x1b15c, 0x07180, 0x0717f, 0x1947c, 0x0747a, 0x0753c, 0x27536, 0x0753a, 0x27531,
+    0x05183, 0x1717c, 0x05182, 0x1717b, 0x21157, 0x2b93a, 0x21156, 0x17938, 0x0717c, 0x0717a, 0x0717b, 0x07179, 0x1b53a, 0x21531, 0x07538, 0x2752f,
+    0x04f2a, 0x05199, 0x19497, 0x19495, 0x0708f, 0x0758e, 0x0548e, 0x0758c, 0x1b463, 0x1b461, 0x21459, 0x21457, 0x0742a, 0x0b428, 0x27422, 0x2741f,
+    0x05197, 0x05195, 0x05196, 0x05194, 0x0518e, 0x1918c, 0x0518d, 0x0758b, 0x1b462, 0x1b460, 0x21458, 0x21456, 0x07429, 0x0b427, 0x27421, 0x2741e,
+    0x10f65, 0x05198, 0x19493, 0x19491, 0x0708e, 0x0708d, 0x1b08c, 0x0548b, 0x1b45f, 0x1b45d, 0x2fc44, 0x2bc3a, 0x1b428, 0x27426, 0x2d41f, 0x2bc1a,
+    0x05193, 0x05191, 0x05192, 0x05190, 0x0708c, 0x0518b, 0x0708b, 0x0708a, 0x1b45e, 0x1b45c, 0x2fc42, 0x17c38, 0x1b427, 0x27425, 0x2d41e, 0x17c18,
+    0x07163, 0x07161, 0x07162, 0x07160, 0x0712a, 0x1b128, 0x07129, 0x1b127, 0x0703d, 0x0703c, 0x1b03b, 0x1b03a, 0x07112, 0x1b111, 0x2740e, 0x27c0b,
+    0x0b159, 0x25157, 0x0b158, 0x25156, 0x27122, 0x2d11f, 0x27121, 0x2d11e, 0x0703b, 0x0703a, 0x07039, 0x07038, 0x2710e, 0x2190b, 0x2710d, 0x07d09,
+    0x0b15f, 0x0b15d, 0x0b15e, 0x0b15c, 0x0b128, 0x27126, 0x0b127, 0x27125, 0x27037, 0x27036, 0x21032, 0x21031, 0x0b111, 0x27110, 0x21c0b, 0x27c06,
+    0x25944, 0x2993a, 0x25942, 0x29938, 0x2711f, 0x2b91a, 0x2711e, 0x17918, 0x27032, 0x27031, 0x27030, 0x2702f, 0x2790b, 0x27906, 0x07809, 0x07c03,
+    0x00a14, 0x11549, 0x0154f, 0x0d545, 0x0152c, 0x11524, 0x0152a, 0x0f720, 0x01549, 0x0153d, 0x01545, 0x03635, 0x01524, 0x0151d, 0x01520, 0x0350c,
+    0x1d54f, 0x11545, 0x1154d, 0x11541, 0x1d52a, 0x13720, 0x11528, 0x1771b, 0x01547, 0x0d53b, 0x01543, 0x03634, 0x01522, 0x0f51b, 0x0151f, 0x1570a,
+    0x01550, 0x11548, 0x0154e, 0x0d544, 0x0152b, 0x11523, 0x01529, 0x0f71f, 0x01548, 0x0153c, 0x01544, 0x03632, 0x01523, 0x0151c, 0x0341f, 0x0350b,
+    0x1d54e, 0x11544, 0x1154c, 0x11540, 0x1d529, 0x1371f, 0x11527, 0x17719, 0x01546, 0x0d53a, 0x01542, 0x03630, 0x01521, 0x0f51a, 0x0151e, 0x29709,
+    0x19549, 0x1d53d, 0x19547, 0x1153b, 0x19524, 0x1f51d, 0x19522, 0x1151b, 0x0553d, 0x01537, 0x0553b, 0x01532, 0x0751d, 0x01517, 0x0751b, 0x03507,
+    0x1d545, 0x1f335, 0x1d543, 0x1f334, 0x1f120, 0x1f50c, 0x1d51f, 0x1770a, 0x1953b, 0x1d532, 0x05539, 0x11530, 0x1951b, 0x2f507, 0x07519, 0x17504,
+    0x19548, 0x1d53c, 0x19546, 0x1153a, 0x19523, 0x1f51c, 0x19521, 0x1151a, 0x0553c, 0x01536, 0x0553a, 0x03631, 0x0751c, 0x01516, 0x0751a, 0x03506,
+    0x1d544, 0x1f332, 0x1d542, 0x23330, 0x1f11f, 0x1f50b, 0x1f11e, 0x17709, 0x1953a, 0x1f331, 0x05538, 0x2332f, 0x1951a, 0x2f506, 0x07518, 0x17503,
+    0x0554f, 0x11547, 0x0154d, 0x0d543, 0x0552a, 0x11522, 0x01528, 0x0d51f, 0x05545, 0x0153b, 0x01541, 0x0f634, 0x05520, 0x0151b, 0x0941b, 0x0350a,
+    0x1954d, 0x11543, 0x0154b, 0x1153f, 0x19528, 0x1151f, 0x01526, 0x1771a, 0x05543, 0x01539, 0x0153f, 0x03633, 0x0551f, 0x01519, 0x0941a, 0x03509,
+    0x0554e, 0x11546, 0x0154c, 0x0d542, 0x05529, 0x11521, 0x01527, 0x0f71e, 0x05544, 0x0153a, 0x01540, 0x15630, 0x0741f, 0x0151a, 0x09419, 0x09409,
+    0x1954c, 0x11542, 0x0154a, 0x1153e, 0x19527, 0x1371e, 0x01525, 0x17718, 0x05542, 0x01538, 0x0153e, 0x0362e, 0x0551e, 0x01518, 0x09418, 0x29708,
+    0x19545, 0x1d53b, 0x19543, 0x1d539, 0x1b120, 0x1f51b, 0x1951f, 0x1f519, 0x07035, 0x05532, 0x1b034, 0x01530, 0x0750c, 0x27507, 0x0750a, 0x09504,
+    0x19541, 0x13334, 0x1953f, 0x1f333, 0x2111b, 0x2310a, 0x2111a, 0x1f509, 0x07034, 0x19530, 0x07033, 0x0152e, 0x2110a, 0x21504, 0x07509, 0x25502,
+    0x19544, 0x1d53a, 0x19542, 0x1d538, 0x1b11f, 0x1f51a, 0x1b11e, 0x1f518, 0x07032, 0x07031, 0x1b030, 0x1b02f, 0x0750b, 0x27506, 0x27409, 0x09503,
+    0x19540, 0x13330, 0x1953e, 0x2f32e, 0x21119, 0x2f109, 0x21118, 0x2f108, 0x0b030, 0x0b02f, 0x2702e, 0x2702d, 0x21109, 0x21503, 0x21108, 0x01d01,
+    0x00f04, 0x2443e, 0x12f30, 0x0ad68, 0x0af30, 0x12e68, 0x2c77b, 0x007aa, 0x20f19, 0x02690, 0x2ef39, 0x0c7a4, 0x20f39, 0x026a4, 0x2077d, 0x007b0,
+    0x02c0b, 0x2443f, 0x2853a, 0x0856b, 0x2463a, 0x1466b, 0x02785, 0x024ab, 0x24727, 0x02694, 0x14760, 0x0e5a6, 0x08760, 0x026a6, 0x007a0, 0x007b3,
+    0x0ed0a, 0x24442, 0x28534, 0x0856a, 0x08642, 0x0e672, 0x2e782, 0x0c7ac, 0x2af1f, 0x0e591, 0x2af43, 0x0e5a5, 0x26758, 0x007a6, 0x2e784, 0x0c7b2,
+    0x02d0e, 0x24443, 0x2853b, 0x0856c, 0x02646, 0x14473, 0x0e787, 0x024ad, 0x28729, 0x0e595, 0x14762, 0x0e5a7, 0x02764, 0x026a9, 0x0e7a2, 0x05e75,
+    0x08f0a, 0x28442, 0x14542, 0x02572, 0x24634, 0x1466a, 0x02782, 0x007ac, 0x26f1f, 0x02691, 0x2a758, 0x0c7a6, 0x26f43, 0x026a5, 0x20784, 0x007b2,
+    0x14e0e, 0x28443, 0x14546, 0x08473, 0x2463b, 0x1466c, 0x02787, 0x0e4ad, 0x08729, 0x02695, 0x14764, 0x0c7a9, 0x08762, 0x026a7, 0x007a2, 0x11d75,
+    0x24f0e, 0x24446, 0x14543, 0x02573, 0x08643, 0x0e673, 0x02784, 0x007ae, 0x24723, 0x02698, 0x2a75a, 0x0c7a8, 0x0875a, 0x007a8, 0x0079f, 0x01d9c,
+    0x02713, 0x24447, 0x14547, 0x02574, 0x02647, 0x0e674, 0x02789, 0x19b6f, 0x0272b, 0x02699, 0x14766, 0x05b93, 0x02766, 0x11b93, 0x007a3, 0x19f4c,
+    0x02f07, 0x0244a, 0x16f32, 0x0256e, 0x26f32, 0x1466e, 0x2c77c, 0x007ab, 0x2cf1b, 0x02692, 0x2ef3b, 0x0c7a5, 0x2cf3b, 0x007a5, 0x2077e, 0x007b1,
+    0x24711, 0x0244b, 0x2853c, 0x02570, 0x0863c, 0x14670, 0x02786, 0x007af, 0x24728, 0x02696, 0x14761, 0x0e5a8, 0x08761, 0x026a8, 0x007a1, 0x01c9b,
+    0x28f0c, 0x0244c, 0x28535, 0x0256f, 0x08644, 0x0e675, 0x2e783, 0x0c7ad, 0x28720, 0x0e593, 0x2af45, 0x13a74, 0x26759, 0x007a7, 0x13871, 0x1386c,
+    0x28712, 0x0244d, 0x2853d, 0x02571, 0x02648, 0x0e677, 0x0e788, 0x05a83, 0x2872a, 0x0e597, 0x14763, 0x13a59, 0x02765, 0x15a93, 0x13a5f, 0x1de44,
+    0x08f0c, 0x1444c, 0x14544, 0x02575, 0x08635, 0x1466f, 0x02783, 0x007ad, 0x24720, 0x02693, 0x2a759, 0x0c7a7, 0x26f45, 0x07974, 0x0b871, 0x0786c,
+    0x08712, 0x1444d, 0x14548, 0x02577, 0x0863d, 0x14671, 0x02788, 0x09983, 0x0872a, 0x02697, 0x14765, 0x09993, 0x08763, 0x07959, 0x0b95f, 0x19d44,
+    0x2470f, 0x0244e, 0x14545, 0x02576, 0x08645, 0x0e676, 0x25871, 0x2586f, 0x24724, 0x25865, 0x2a75b, 0x17859, 0x0875b, 0x0b859, 0x25855, 0x19c41,
+    0x02714, 0x0244f, 0x14549, 0x0f845, 0x02649, 0x03845, 0x0383d, 0x01b35, 0x0272c, 0x0382a, 0x15824, 0x0da20, 0x03824, 0x01920, 0x0181d, 0x0180c,
+    0x00c0b, 0x1883f, 0x1c93a, 0x06c6b, 0x18a3a, 0x12c6b, 0x00b85, 0x008ab, 0x18b27, 0x00a94, 0x10b60, 0x0c9a6, 0x04b60, 0x00aa6, 0x00ba0, 0x03fb3,
+    0x00c1c, 0x24c54, 0x0ad5d, 0x0ac70, 0x12e5d, 0x12c70, 0x244c9, 0x21fb9, 0x12dbc, 0x024d6, 0x2edc5, 0x0bfcc, 0x20ec5, 0x13fcc, 0x010db, 0x01fa0,
+    0x00d1f, 0x0ac58, 0x06d57, 0x06d73, 0x14e91, 0x2aca6, 0x244ca, 0x244d3, 0x12d8c, 0x1c9c6, 0x1ed95, 0x19ed2, 0x1ebc6, 0x0f0da, 0x12bcc, 0x01ea6,
+    0x02c23, 0x24c5a, 0x0ad61, 0x0ac77, 0x28498, 0x2aca8, 0x244cb, 0x1bf87, 0x16dbe, 0x292d7, 0x2edc7, 0x1ba95, 0x292d8, 0x1ffc6, 0x21ac5, 0x05f60,
+    0x0ce1f, 0x16c58, 0x08d91, 0x26ca6, 0x1ce57, 0x12e73, 0x284ca, 0x284d3, 0x04f8c, 0x18ac6, 0x1abc6, 0x030da, 0x1ae95, 0x1ddd2, 0x0abcc, 0x0dda6,
+    0x14c23, 0x16c5a, 0x24498, 0x26ca8, 0x16e61, 0x16c77, 0x284cb, 0x1ff87, 0x26ebe, 0x251d7, 0x091d8, 0x1bfc6, 0x2cec7, 0x1f995, 0x2f9c5, 0x11f60,
+    0x02c29, 0x24c64, 0x08d95, 0x244a9, 0x14e95, 0x284a9, 0x244cc, 0x03fd1, 0x00fbe, 0x030d8, 0x0f0d7, 0x19ec6, 0x030d7, 0x1ddc6, 0x030d6, 0x0dd94,
+    0x02c2b, 0x24c66, 0x24499, 0x07a93, 0x28499, 0x13993, 0x0bac0, 0x19f5e, 0x030d5, 0x01bbe, 0x27abe, 0x07a8c, 0x179be, 0x11b8c, 0x0babc, 0x19f27,
+    0x00f32, 0x24c6e, 0x10d7c, 0x26dab, 0x06e7c, 0x16eab, 0x18bb7, 0x030d4, 0x18b5e, 0x02bd1, 0x1eb87, 0x290d3, 0x1ab87, 0x250d3, 0x20bb9, 0x01cab,
+    0x02c3c, 0x24c70, 0x08d86, 0x084af, 0x28e86, 0x284af, 0x030cd, 0x19fb7, 0x16dc0, 0x250cc, 0x290cb, 0x290ca, 0x250cb, 0x250ca, 0x250c9, 0x01f85,
+    0x02c44, 0x24c75, 0x24d83, 0x26dad, 0x28e9b, 0x290b3, 0x290af, 0x17aab, 0x12d93, 0x290a9, 0x17877, 0x13a73, 0x2b8a8, 0x2b8a6, 0x13870, 0x11e6b,
+    0x02c48, 0x24c77, 0x24d88, 0x07a83, 0x2909e, 0x29a9b, 0x29a86, 0x07a7c, 0x29099, 0x15a95, 0x17a61, 0x1da57, 0x29098, 0x15a91, 0x13a5d, 0x19e3a,
+    0x0ec44, 0x28c75, 0x08d9b, 0x090b3, 0x06e83, 0x2aead, 0x090af, 0x279ab, 0x06e93, 0x250a9, 0x278a8, 0x278a6, 0x0b877, 0x07973, 0x0b870, 0x05d6b,
+    0x14c48, 0x28c77, 0x0909e, 0x0999b, 0x28e88, 0x25983, 0x09986, 0x1197c, 0x25099, 0x09995, 0x25098, 0x09991, 0x0b961, 0x07957, 0x0b95d, 0x1dd3a,
+    0x02c4e, 0x25078, 0x29877, 0x29875, 0x25877, 0x25875, 0x25870, 0x2586e, 0x25866, 0x25864, 0x1785a, 0x17858, 0x2585a, 0x0b858, 0x25854, 0x19c3f,
+    0x02c50, 0x0384e, 0x15848, 0x0f844, 0x03848, 0x03844, 0x0383c, 0x01b32, 0x0382b, 0x03829, 0x15823, 0x0da1f, 0x03823, 0x0191f, 0x0181c, 0x0180b,
+    0x0cd0a, 0x18842, 0x12f34, 0x06d6a, 0x04a42, 0x0ca72, 0x22b82, 0x0ebac, 0x1ef1f, 0x0c991, 0x1ef43, 0x0c9a5, 0x1ab58, 0x02ba6, 0x2eb84, 0x0feb2,
+    0x02d1f, 0x06c58, 0x24d57, 0x0ad73, 0x10e91, 0x1eca6, 0x167ca, 0x05fd3, 0x16d8c, 0x285c6, 0x2ad95, 0x285d2, 0x2a7c6, 0x0d0da, 0x127cc, 0x03ea6,
+    0x0ed1b, 0x0ac5e, 0x12f41, 0x0ad6f, 0x2e792, 0x2ecd1, 0x2e79c, 0x2f2ae, 0x12f28, 0x285c0, 0x12f4d, 0x2fe89, 0x2e796, 0x132cc, 0x2f29d, 0x2fe84,
+    0x02d22, 0x0ac62, 0x24d59, 0x0ad76, 0x167c1, 0x2b2d2, 0x2f2a8, 0x21a73, 0x16d8e, 0x2b2c7, 0x2f297, 0x21e62, 0x172c8, 0x2b2c6, 0x2f296, 0x1be58,
+    0x0ed34, 0x08c82, 0x28d6a, 0x245ac, 0x1af6a, 0x12cac, 0x2e7ac, 0x030d9, 0x20f57, 0x145ca, 0x2ef73, 0x145d3, 0x20f73, 0x19dd3, 0x2e7ae, 0x01dac,
+    0x02d43, 0x08c84, 0x24d73, 0x085ae, 0x10ea5, 0x12cb2, 0x167d3, 0x1dfac, 0x28f95, 0x145cc, 0x167a9, 0x09ed1, 0x2a7d2, 0x1f9a6, 0x2f9d1, 0x11d72,
+    0x0ed3b, 0x08c87, 0x28d6c, 0x2f2ad, 0x2cfa5, 0x172d3, 0x2f2b2, 0x2f2ac, 0x2af61, 0x172cb, 0x2a777, 0x23e87, 0x2e7a8, 0x172ca, 0x2f29c, 0x23e82,
+    0x02d47, 0x08c89, 0x28574, 0x1ba6f, 0x172cf, 0x11ba5, 0x2daa5, 0x1ba6a, 0x14599, 0x2b2c0, 0x2f293, 0x1be5e, 0x172c1, 0x11b91, 0x2f292, 0x05f42,
+    0x10f1b, 0x24592, 0x12f3b, 0x26da5, 0x1ab5e, 0x08bd1, 0x22b87, 0x150d3, 0x22f22, 0x285c1, 0x22f47, 0x290cf, 0x20b62, 0x290d2, 0x2eb89, 0x0dca5,
+    0x14d28, 0x24596, 0x28d61, 0x245a8, 0x2a7c0, 0x150cc, 0x150cb, 0x150ca, 0x28f8e, 0x290c8, 0x16799, 0x290c1, 0x290c7, 0x290c6, 0x290c0, 0x0dc91,
+    0x14d20, 0x24593, 0x16f45, 0x2b274, 0x2e793, 0x150a9, 0x2b277, 0x2fa73, 0x16f2a, 0x17299, 0x16f4f, 0x23a47, 0x2e797, 0x2b895, 0x13a4d, 0x1fa43,
+    0x28d2a, 0x24597, 0x28d63, 0x2fa59, 0x15099, 0x29a95, 0x2ba61, 0x21a57, 0x2908f, 0x29a8e, 0x17a2a, 0x23a22, 0x1788e, 0x15a8c, 0x13a28, 0x1fa1f,
+    0x14d41, 0x2459c, 0x2af6c, 0x250b2, 0x1af6f, 0x090ae, 0x250ad, 0x250ac, 0x2ef59, 0x250a8, 0x2a774, 0x278a5, 0x20f76, 0x0b873, 0x0b86f, 0x05c6a,
+    0x14d4d, 0x0909d, 0x28577, 0x2509c, 0x09989, 0x09984, 0x09987, 0x09982, 0x25097, 0x25096, 0x25093, 0x25092, 0x0b962, 0x07958, 0x0b95e, 0x19d42,
+    0x14d45, 0x29077, 0x2906d, 0x2ba6c, 0x29074, 0x25873, 0x2986c, 0x2ba6a, 0x2af63, 0x29861, 0x17a45, 0x13a3b, 0x25859, 0x25857, 0x13a41, 0x1dc34,
+    0x28d4f, 0x1584d, 0x15845, 0x15841, 0x03847, 0x03843, 0x0f83b, 0x01b34, 0x2982a, 0x15828, 0x17a20, 0x11a1b, 0x03822, 0x0381f, 0x0f81b, 0x11a0a,
+    0x00d0e, 0x18843, 0x1c93b, 0x0496c, 0x00a46, 0x10873, 0x0cb87, 0x0b6ad, 0x1cb29, 0x0c995, 0x10b62, 0x276a7, 0x00b64, 0x00aa9, 0x0eba2, 0x09e75,
+    0x00c23, 0x06c5a, 0x06d61, 0x06c77, 0x10e98, 0x1eca8, 0x1b6cb, 0x27f87, 0x1edbe, 0x1d2d7, 0x216c7, 0x27695, 0x1d2d8, 0x2bfc6, 0x216c5, 0x09f60,
+    0x00d22, 0x06c62, 0x18d59, 0x2d676, 0x1ebc1, 0x1f2d2, 0x232a8, 0x2d673, 0x1ed8e, 0x1f2c7, 0x23297, 0x2de62, 0x1f2c8, 0x1f2c6, 0x23296, 0x27e58,
+    0x00d52, 0x0ac66, 0x0ad65, 0x21e4e, 0x2f2d0, 0x2ffc1, 0x21698, 0x0be46, 0x2f2c3, 0x2f2be, 0x2f28e, 0x21e29, 0x2f2c2, 0x2f2bd, 0x2f28d, 0x0be21,
+    0x0ce43, 0x1cc84, 0x08da5, 0x0b6b2, 0x1ce73, 0x1ecae, 0x1b6d3, 0x0b6ac, 0x18f95, 0x00acc, 0x216d2, 0x276a6, 0x04aa9, 0x1ddd1, 0x216d1, 0x03f72,
+    0x02c5a, 0x08c9f, 0x0aca8, 0x0b69c, 0x12ca8, 0x1ff9c, 0x1b6ca, 0x27f82, 0x091d7, 0x091d6, 0x216c6, 0x27694, 0x2f9c6, 0x13f94, 0x216c4, 0x03f56,
+    0x02c62, 0x08ca2, 0x232a7, 0x2d675, 0x132d2, 0x1f2d1, 0x232a6, 0x2d672, 0x132c7, 0x1f2c5, 0x23295, 0x2de60, 0x132c6, 0x1f2c4, 0x23294, 0x09e56,
+    0x02c66, 0x08ca3, 0x2da93, 0x1be4c, 0x179c1, 0x1ff92, 0x2da91, 0x07e42, 0x172be, 0x2f2bc, 0x2f28c, 0x1be27, 0x172bd, 0x1db8b, 0x21a8b, 0x05f1e,
+    0x10f3b, 0x0ada5, 0x1ed7e, 0x276b1, 0x18b87, 0x0f0d3, 0x1ebb9, 0x276ab, 0x1cb62, 0x150d2, 0x1eb89, 0x276a5, 0x18ba2, 0x290d1, 0x2ebba, 0x03e6e,
+    0x02d61, 0x08ca8, 0x08da1, 0x2769b, 0x0f0cb, 0x0f0ca, 0x150c9, 0x27f85, 0x150c7, 0x150c6, 0x150c0, 0x27691, 0x290c5, 0x290c4, 0x290bf, 0x03f5c,
+    0x0cd59, 0x172a7, 0x2f271, 0x2f26c, 0x172a8, 0x172a6, 0x2f270, 0x2f26b, 0x17297, 0x17295, 0x2fa4d, 0x23a43, 0x17296, 0x17294, 0x2fa4b, 0x23a3f,
+    0x02d65, 0x29a93, 0x2fa5f, 0x21e44, 0x15098, 0x29a91, 0x2fa5d, 0x1be3a, 0x1728e, 0x2b28c, 0x2fa28, 0x23a1f, 0x1728d, 0x29a8b, 0x2fa26, 0x19e1a,
+    0x00f6c, 0x090b2, 0x090b1, 0x090b0, 0x090ad, 0x090ac, 0x090ab, 0x090aa, 0x250a7, 0x250a6, 0x250a5, 0x250a4, 0x0b875, 0x07972, 0x0b86e, 0x01c68,
+    0x02c77, 0x0909c, 0x0909b, 0x0909a, 0x25987, 0x25982, 0x09985, 0x1ff7b, 0x25095, 0x25094, 0x25091, 0x25090, 0x0b960, 0x07956, 0x0b95c, 0x1dd38,
+    0x29076, 0x29075, 0x2b26c, 0x2f269, 0x29073, 0x29072, 0x2b26b, 0x2fa68, 0x29862, 0x29860, 0x17a43, 0x1fa39, 0x25858, 0x25856, 0x13a3f, 0x1dc33,
+    0x2984e, 0x1584c, 0x15844, 0x1be40, 0x03846, 0x03842, 0x0f83a, 0x01b30, 0x29829, 0x15827, 0x17a1f, 0x1fa19, 0x03821, 0x0191e, 0x0f81a, 0x1da09,
+    0x04f0a, 0x1c842, 0x10942, 0x00972, 0x06f34, 0x12e6a, 0x00b82, 0x02bac, 0x1af1f, 0x00a91, 0x1eb58, 0x0eba6, 0x1af43, 0x00aa5, 0x20b84, 0x03db2,
+    0x0ee1f, 0x12c58, 0x04d91, 0x1aca6, 0x16e57, 0x16e73, 0x0a7ca, 0x11fd3, 0x08f8c, 0x246c6, 0x267c6, 0x010da, 0x26e95, 0x246d2, 0x0a7cc, 0x0fda6,
+    0x0cd34, 0x04c82, 0x1cd6a, 0x06cac, 0x26f6a, 0x286ac, 0x2c7ac, 0x010d9, 0x2cf57, 0x086ca, 0x22f73, 0x1ded3, 0x2cf73, 0x086d3, 0x207ae, 0x03dac,
+    0x0ee43, 0x28c84, 0x04da5, 0x06cb2, 0x28e73, 0x286ae, 0x0a7d3, 0x19fac, 0x24f95, 0x026cc, 0x267d2, 0x1baa6, 0x086a9, 0x29dd1, 0x21ad1, 0x01f72,
+    0x00e1b, 0x12c5e, 0x2c792, 0x20cd1, 0x0af41, 0x12e6f, 0x2c79c, 0x211ae, 0x0af28, 0x246c0, 0x2c796, 0x0b1cc, 0x0af4d, 0x21d89, 0x2119d, 0x21d84,
+    0x14e22, 0x16c62, 0x267c1, 0x271d2, 0x28e59, 0x16e76, 0x2d1a8, 0x23973, 0x26e8e, 0x271c7, 0x271c8, 0x271c6, 0x2d197, 0x23d62, 0x2d196, 0x1fd58,
+    0x02e3b, 0x14c87, 0x2efa5, 0x0b1d3, 0x24e6c, 0x2d1ad, 0x2d1b2, 0x2d1ac, 0x26f61, 0x0b1cb, 0x2c7a8, 0x0b1ca, 0x26777, 0x21d87, 0x2d19c, 0x01d82,
+    0x14e47, 0x28c89, 0x271cf, 0x05ba5, 0x24674, 0x2396f, 0x2f9a5, 0x1db6a, 0x08699, 0x271c0, 0x271c1, 0x05b91, 0x2d193, 0x23d5e, 0x2d192, 0x11f42,
+    0x06f1b, 0x28692, 0x22b5e, 0x28bd1, 0x06f3b, 0x2aea5, 0x20b87, 0x090d3, 0x1af22, 0x086c1, 0x22b62, 0x250d2, 0x1af47, 0x090cf, 0x20b89, 0x01ca5,
+    0x02e28, 0x28696, 0x267c0, 0x030cc, 0x24e61, 0x286a8, 0x090cb, 0x090ca, 0x08f8e, 0x090c8, 0x250c7, 0x250c6, 0x0a799, 0x090c1, 0x250c0, 0x01c91,
+    0x02e41, 0x2869c, 0x22f6f, 0x290ae, 0x26f6c, 0x290b2, 0x290ad, 0x290ac, 0x2cf59, 0x290a8, 0x22f76, 0x17873, 0x26774, 0x2b8a5, 0x1386f, 0x11c6a,
+    0x02e4d, 0x2909d, 0x29a89, 0x29a84, 0x24677, 0x2909c, 0x15a87, 0x05a82, 0x29097, 0x29096, 0x17a62, 0x13a58, 0x29093, 0x29092, 0x13a5e, 0x1de42,
+    0x0af20, 0x28693, 0x2c793, 0x090a9, 0x0af45, 0x27174, 0x27177, 0x2d973, 0x26f2a, 0x0b199, 0x2c797, 0x27895, 0x26f4f, 0x1b947, 0x0b94d, 0x1b943,
+    0x08e2a, 0x28697, 0x09099, 0x25995, 0x24e63, 0x2d959, 0x27961, 0x2d957, 0x0908f, 0x0998e, 0x2788e, 0x0998c, 0x2792a, 0x1b922, 0x0b928, 0x1b91f,
+    0x08e45, 0x25077, 0x25074, 0x29873, 0x2506d, 0x2796c, 0x2586c, 0x2796a, 0x26f63, 0x25861, 0x29859, 0x17857, 0x0b945, 0x0793b, 0x0b941, 0x19c34,
+    0x08e4f, 0x0384d, 0x15847, 0x0f843, 0x09845, 0x03841, 0x0383b, 0x0db34, 0x0982a, 0x03828, 0x15822, 0x0f81f, 0x0b920, 0x0791b, 0x0181b, 0x0590a,
+    0x10e0e, 0x1c843, 0x10946, 0x04873, 0x18a3b, 0x10a6c, 0x00b87, 0x175ad, 0x04b29, 0x00a95, 0x10b64, 0x0eba9, 0x04b62, 0x2b5a7, 0x00ba2, 0x15d75,
+    0x10c23, 0x1cc5a, 0x04d98, 0x1aca8, 0x12e61, 0x12c77, 0x1f5cb, 0x2bf87, 0x06ebe, 0x191d7, 0x051d8, 0x27fc6, 0x235c7, 0x2b595, 0x2f5c5, 0x15f60,
+    0x00d43, 0x04c84, 0x18d73, 0x06cae, 0x14ea5, 0x175b2, 0x1f5d3, 0x175ac, 0x1cf95, 0x109cc, 0x12ba9, 0x05ed1, 0x235d2, 0x2b5a6, 0x2f5d1, 0x15d72,
+    0x00c5a, 0x06c9f, 0x06ca8, 0x1bf9c, 0x16ca8, 0x1759c, 0x1f5ca, 0x1bf82, 0x051d7, 0x051d6, 0x2dac6, 0x07f94, 0x235c6, 0x2b594, 0x2f5c4, 0x01f56,
+    0x10e22, 0x12c62, 0x06bc1, 0x1b1d2, 0x1ce59, 0x2f576, 0x211a8, 0x2f573, 0x06e8e, 0x1b1c7, 0x071c8, 0x1b1c6, 0x21197, 0x2fd62, 0x21196, 0x2bd58,
+    0x10e52, 0x12c66, 0x271d0, 0x21fc1, 0x12e65, 0x2fd4e, 0x23598, 0x13d46, 0x271c3, 0x211be, 0x271c2, 0x211bd, 0x2118e, 0x2fd29, 0x2118d, 0x13d21,
+    0x0ec62, 0x16ca2, 0x071d2, 0x071d1, 0x211a7, 0x2f575, 0x211a6, 0x2f572, 0x071c7, 0x071c5, 0x071c6, 0x071c4, 0x21195, 0x2fd60, 0x21194, 0x2bd56,
+    0x14c66, 0x16ca3, 0x27ac1, 0x1bf92, 0x2f993, 0x23d4c, 0x2f991, 0x13d42, 0x271be, 0x271bc, 0x271bd, 0x05b8b, 0x2d18c, 0x23d27, 0x2f98b, 0x13d1e,
+    0x04f3b, 0x16ea5, 0x1cb87, 0x030d3, 0x06e7e, 0x175b1, 0x06bb9, 0x175ab, 0x18b62, 0x090d2, 0x1eba2, 0x090d1, 0x06b89, 0x2b5a5, 0x26bba, 0x15d6e,
+    0x0ee61, 0x14ca8, 0x030cb, 0x030ca, 0x16ea1, 0x1759b, 0x030c9, 0x17f85, 0x090c7, 0x090c6, 0x090c5, 0x090c4, 0x090c0, 0x2b591, 0x090bf, 0x15f5c,
+    0x0cf6c, 0x150b2, 0x150ad, 0x150ac, 0x290b1, 0x290b0, 0x290ab, 0x290aa, 0x290a7, 0x290a6, 0x17875, 0x13a72, 0x290a5, 0x290a4, 0x1386e, 0x11c68,
+    0x0ec77, 0x1509c, 0x29a87, 0x07a82, 0x2909b, 0x2909a, 0x29a85, 0x19f7b, 0x29095, 0x29094, 0x17a60, 0x1da56, 0x29091, 0x29090, 0x13a5c, 0x05e38,
+    0x00e59, 0x0b1a7, 0x0b1a8, 0x0b1a6, 0x27171, 0x2d16c, 0x27170, 0x2d16b, 0x0b197, 0x0b195, 0x0b196, 0x0b194, 0x2794d, 0x21943, 0x2794b, 0x1b93f,
+    0x14e65, 0x25993, 0x09098, 0x25991, 0x2795f, 0x23d44, 0x2795d, 0x1fd3a, 0x2718e, 0x2718c, 0x2718d, 0x0998b, 0x27928, 0x2191f, 0x27926, 0x1fd1a,
+    0x25076, 0x25075, 0x25073, 0x25072, 0x2716c, 0x27169, 0x2716b, 0x27968, 0x25862, 0x25860, 0x29858, 0x17856, 0x0b943, 0x07939, 0x0b93f, 0x05c33,
+    0x0984e, 0x0384c, 0x15846, 0x0f842, 0x09844, 0x23d40, 0x0383a, 0x11b30, 0x09829, 0x03827, 0x15821, 0x0da1e, 0x0b91f, 0x07919, 0x0181a, 0x05909,
+    0x18f0e, 0x18846, 0x10943, 0x00973, 0x04a43, 0x0ca73, 0x00b84, 0x02bae, 0x18b23, 0x00a98, 0x1eb5a, 0x0eba8, 0x04b5a, 0x02ba8, 0x00b9f, 0x03d9c,
+    0x00c29, 0x18c64, 0x04d95, 0x1aca9, 0x10e95, 0x1eca9, 0x188cc, 0x01fd1, 0x02fbe, 0x010d8, 0x0d0d7, 0x25ec6, 0x010d7, 0x29dc6, 0x010d6, 0x0fd94,
+    0x0cd3b, 0x04c87, 0x1cd6c, 0x232ad, 0x20fa5, 0x132d3, 0x232b2, 0x232ac, 0x1ef61, 0x132cb, 0x1eb77, 0x2fe87, 0x22ba8, 0x132ca, 0x2329c, 0x2fe82,
+    0x00c62, 0x06ca2, 0x2f2a7, 0x21a75, 0x172d2, 0x172d1, 0x2f2a6, 0x1be72, 0x172c7, 0x172c5, 0x2f295, 0x21e60, 0x172c6, 0x172c4, 0x2f294, 0x05e56,
+    0x00e3b, 0x10c87, 0x22fa5, 0x071d3, 0x18e6c, 0x211ad, 0x211b2, 0x211ac, 0x1af61, 0x071cb, 0x20ba8, 0x071ca, 0x1ab77, 0x2dd87, 0x2119c, 0x03d82,
+    0x0cc62, 0x10ca2, 0x0b1d2, 0x271d1, 0x2d1a7, 0x23975, 0x2d1a6, 0x1fd72, 0x0b1c7, 0x271c5, 0x0b1c6, 0x271c4, 0x2d195, 0x23d60, 0x2d194, 0x1fd56,
+    0x00f7e, 0x00cb9, 0x2f2b1, 0x2f2ab, 0x211b1, 0x211ab, 0x211b0, 0x211aa, 0x20fa1, 0x0b1c9, 0x2f29b, 0x2fe85, 0x2119b, 0x21d85, 0x2119a, 0x01d7b,
+    0x02c89, 0x02cba, 0x2f2a5, 0x1ba6e, 0x2d1a5, 0x2396e, 0x2d1a4, 0x19b68, 0x0b1c0, 0x271bf, 0x2f291, 0x1be5c, 0x2d191, 0x23d5c, 0x2d190, 0x01f38,
+    0x18f22, 0x02cc1, 0x1eb62, 0x0f0d2, 0x1ab62, 0x030d2, 0x20ba2, 0x030d1, 0x18f52, 0x030d0, 0x22b66, 0x29ec1, 0x1ab66, 0x09dc1, 0x20ba3, 0x03d92,
+    0x02f8e, 0x030c8, 0x0f0c7, 0x0f0c6, 0x030c7, 0x030c6, 0x030c5, 0x030c4, 0x030c3, 0x030c2, 0x290be, 0x290bd, 0x090be, 0x090bd, 0x250bc, 0x01c8b,
+    0x10f59, 0x150a8, 0x2b276, 0x2b273, 0x150a7, 0x150a6, 0x2b275, 0x2b272, 0x22f65, 0x17298, 0x17a4e, 0x23a46, 0x2b893, 0x2b891, 0x13a4c, 0x1fa42,
+    0x15097, 0x15096, 0x2ba62, 0x2fa58, 0x15095, 0x15094, 0x2ba60, 0x21a56, 0x2908e, 0x2908d, 0x17a29, 0x23a21, 0x2908c, 0x1788b, 0x13a27, 0x1de1e,
+    0x04f59, 0x090a8, 0x090a7, 0x090a6, 0x27176, 0x27173, 0x27175, 0x27172, 0x1af65, 0x0b198, 0x27893, 0x27891, 0x2794e, 0x1b946, 0x0b94c, 0x1b942,
+    0x09097, 0x09096, 0x09095, 0x09094, 0x27962, 0x2d958, 0x27960, 0x2d956, 0x0908e, 0x0908d, 0x2508c, 0x2788b, 0x27929, 0x1b921, 0x0b927, 0x19d1e,
+    0x25071, 0x25070, 0x2906c, 0x2906b, 0x2506c, 0x2506b, 0x25069, 0x25868, 0x2585f, 0x2585d, 0x17a44, 0x13a3a, 0x0b944, 0x0793a, 0x13a40, 0x19c30,
+    0x2584d, 0x0384b, 0x15843, 0x1583f, 0x09843, 0x0383f, 0x03839, 0x01b33, 0x25828, 0x03826, 0x1581f, 0x11a1a, 0x0981f, 0x0791a, 0x01819, 0x01809,
+    0x00c13, 0x18847, 0x10947, 0x00974, 0x00a47, 0x0ca74, 0x00b89, 0x2576f, 0x00b2b, 0x00a99, 0x10b66, 0x09793, 0x00b66, 0x15793, 0x00ba3, 0x25f4c,
+    0x00c2b, 0x18c66, 0x04d99, 0x0b693, 0x10e99, 0x17593, 0x076c0, 0x25f5e, 0x010d5, 0x037be, 0x076be, 0x0b68c, 0x1f5be, 0x1578c, 0x0b6bc, 0x25f27,
+    0x00d47, 0x04c89, 0x18d74, 0x2766f, 0x1f2cf, 0x157a5, 0x216a5, 0x2766a, 0x1cf99, 0x1f2c0, 0x23293, 0x27e5e, 0x1f2c1, 0x15791, 0x23292, 0x09f42,
+    0x00c66, 0x06ca3, 0x21693, 0x27e4c, 0x1f5c1, 0x17592, 0x21691, 0x0be42, 0x1f2be, 0x232bc, 0x2328c, 0x27e27, 0x1f2bd, 0x2978b, 0x2168b, 0x09f1e,
+    0x10e47, 0x1cc89, 0x071cf, 0x097a5, 0x1ce74, 0x2f56f, 0x235a5, 0x2976a, 0x18f99, 0x1b1c0, 0x071c1, 0x09791, 0x21193, 0x2fd5e, 0x21192, 0x15f42,
+    0x10c66, 0x1eca3, 0x076c1, 0x0b692, 0x23593, 0x2fd4c, 0x23591, 0x17d42, 0x071be, 0x1b1bc, 0x071bd, 0x0978b, 0x2118c, 0x2fd27, 0x2f58b, 0x17d1e,
+    0x00c89, 0x00cba, 0x232a5, 0x2766e, 0x211a5, 0x2f56e, 0x211a4, 0x25768, 0x071c0, 0x071bf, 0x23291, 0x27e5c, 0x21191, 0x2fd5c, 0x21190, 0x03f38,
+    0x00ca3, 0x00cce, 0x21692, 0x27e4a, 0x23592, 0x2fd4a, 0x21690, 0x13d3e, 0x0b1bc, 0x271bb, 0x2f28b, 0x27e25, 0x2118b, 0x2fd25, 0x2118a, 0x01f18,
+    0x18f47, 0x030cf, 0x1cb89, 0x0b6a5, 0x04b89, 0x175a5, 0x00bba, 0x2576e, 0x18b66, 0x037c1, 0x1eba3, 0x09792, 0x06ba3, 0x15792, 0x00bce, 0x03f4a,
+    0x00d99, 0x030c1, 0x0f0c0, 0x0b691, 0x030c0, 0x17591, 0x030bf, 0x25f5c, 0x030be, 0x030bd, 0x150bc, 0x2768b, 0x030bc, 0x1758b, 0x030bb, 0x03f25,
+    0x0cd74, 0x172a5, 0x2f26f, 0x2f26a, 0x150a5, 0x150a4, 0x2f26e, 0x27668, 0x17293, 0x17291, 0x2fa4c, 0x23a42, 0x17292, 0x17290, 0x2fa4a, 0x03f3e,
+    0x15093, 0x15092, 0x2fa5e, 0x21e42, 0x15091, 0x15090, 0x2fa5c, 0x07e38, 0x1508c, 0x1728b, 0x2fa27, 0x21e1e, 0x2908b, 0x2908a, 0x2fa25, 0x07e18,
+    0x04f74, 0x0b1a5, 0x090a5, 0x090a4, 0x2716f, 0x2d16a, 0x2716e, 0x2f568, 0x0b193, 0x0b191, 0x0b192, 0x0b190, 0x2794c, 0x21942, 0x2794a, 0x15f3e,
+    0x09093, 0x09092, 0x09091, 0x09090, 0x2795e, 0x23d42, 0x2795c, 0x1fd38, 0x0908c, 0x2718b, 0x0908b, 0x0908a, 0x27927, 0x23d1e, 0x27925, 0x1fd18,
+    0x2506f, 0x2506e, 0x2906a, 0x2f268, 0x2506a, 0x27168, 0x25068, 0x25067, 0x2585e, 0x2585c, 0x17a42, 0x1fa38, 0x0b942, 0x07938, 0x13a3e, 0x01c2e,
+    0x2584c, 0x0384a, 0x15842, 0x1be3e, 0x09842, 0x23d3e, 0x03838, 0x01b2e, 0x25827, 0x03825, 0x17a1e, 0x1fa18, 0x0b91e, 0x07918, 0x01818, 0x1dd08,
+    0x00f07, 0x0084a, 0x1ef32, 0x0096e, 0x06f32, 0x10a6e, 0x20b7c, 0x02bab, 0x20f1b, 0x00a92, 0x22f3b, 0x0eba5, 0x20f3b, 0x02ba5, 0x20b7e, 0x03cb1,
+    0x02f32, 0x18c6e, 0x16d7c, 0x06dab, 0x08e7c, 0x1eeab, 0x247b7, 0x010d4, 0x2475e, 0x007d1, 0x2a787, 0x1d0d3, 0x26787, 0x190d3, 0x207b9, 0x03cab,
+    0x16f1b, 0x04c92, 0x16f3b, 0x1ada5, 0x2675e, 0x047d1, 0x2e787, 0x110d3, 0x2ef22, 0x1c9c1, 0x2ef47, 0x1d0cf, 0x2c762, 0x1d0d2, 0x2e789, 0x0fca5,
+    0x14f3b, 0x06da5, 0x16d7e, 0x06db1, 0x24787, 0x0d0d3, 0x167b9, 0x07aab, 0x28762, 0x110d2, 0x16789, 0x1baa5, 0x247a2, 0x1d0d1, 0x2e7ba, 0x01e6e,
+    0x08f1b, 0x10c92, 0x2e75e, 0x1c7d1, 0x0af3b, 0x1eea5, 0x2c787, 0x050d3, 0x26f22, 0x04ac1, 0x2e762, 0x190d2, 0x26f47, 0x050cf, 0x20789, 0x03ca5,
+    0x08f3b, 0x12ea5, 0x28787, 0x010d3, 0x08e7e, 0x1eeb1, 0x087b9, 0x1f9ab, 0x24762, 0x050d2, 0x2a7a2, 0x050d1, 0x26789, 0x1f9a5, 0x267ba, 0x11d6e,
+    0x24f22, 0x00cc1, 0x2a762, 0x0d0d2, 0x26762, 0x010d2, 0x2c7a2, 0x010d1, 0x24f52, 0x010d0, 0x2e766, 0x1dec1, 0x26766, 0x05dc1, 0x207a3, 0x01d92,
+    0x24f47, 0x010cf, 0x28789, 0x07aa5, 0x08789, 0x139a5, 0x027ba, 0x19b6e, 0x24766, 0x01bc1, 0x167a3, 0x19e92, 0x087a3, 0x1dd92, 0x007ce, 0x01f4a,
+    0x00f17, 0x010ce, 0x2ef37, 0x2f0ba, 0x26f37, 0x270ba, 0x2c780, 0x210b9, 0x20f1d, 0x210a3, 0x2ef3d, 0x2f089, 0x20f3d, 0x21089, 0x21081, 0x21c7e,
+    0x02f37, 0x030ba, 0x2a780, 0x170b9, 0x24780, 0x090b9, 0x250b8, 0x250b7, 0x2475f, 0x2d0a2, 0x2f088, 0x2f087, 0x2d088, 0x2d087, 0x2d080, 0x21c7c,
+    0x16f1d, 0x170a3, 0x16f3d, 0x17089, 0x2675f, 0x2b0a2, 0x2b088, 0x2b087, 0x2ef24, 0x2f066, 0x2ef49, 0x2f847, 0x2f063, 0x2f062, 0x2f83d, 0x2383b,
+    0x28f3d, 0x29089, 0x17081, 0x17a7e, 0x29088, 0x29087, 0x2b080, 0x17a7c, 0x2b063, 0x2b062, 0x1783d, 0x1783b, 0x2f05f, 0x2f05e, 0x2f837, 0x1f832,
+    0x08f1d, 0x090a3, 0x2e75f, 0x250a2, 0x26f3d, 0x27089, 0x27088, 0x27087, 0x26f24, 0x27066, 0x2d063, 0x2d062, 0x26f49, 0x27847, 0x2183d, 0x2183b,
+    0x08f3d, 0x09089, 0x25088, 0x25087, 0x09081, 0x0997e, 0x25080, 0x0997c, 0x27063, 0x27062, 0x2705f, 0x2705e, 0x2783d, 0x0b83b, 0x27837, 0x07832,
+    0x24f24, 0x25066, 0x29063, 0x29062, 0x25063, 0x25062, 0x2505f, 0x2505e, 0x25053, 0x25852, 0x2f824, 0x2f822, 0x27824, 0x27822, 0x2181d, 0x2181b,
+    0x24f49, 0x25847, 0x2983d, 0x1583b, 0x0983d, 0x0983b, 0x03837, 0x03832, 0x25824, 0x25822, 0x1781d, 0x1781b, 0x0981d, 0x0981b, 0x01817, 0x01807,
+    0x10d11, 0x0084b, 0x1c93c, 0x00970, 0x04a3c, 0x10a70, 0x00b86, 0x02baf, 0x18b28, 0x00a96, 0x10b61, 0x0c9a8, 0x04b61, 0x00aa8, 0x00ba1, 0x03c9b,
+    0x00c3c, 0x18c70, 0x04d86, 0x06daf, 0x1ce86, 0x1eeaf, 0x010cd, 0x25fb7, 0x12dc0, 0x190cc, 0x1d0cb, 0x1d0ca, 0x190cb, 0x190ca, 0x190c9, 0x03f85,
+    0x10d28, 0x04c96, 0x1cd61, 0x189a8, 0x02ec0, 0x110cc, 0x110cb, 0x110ca, 0x1cf8e, 0x1d0c8, 0x1ed99, 0x1d0c1, 0x1d0c7, 0x1d0c6, 0x1d0c0, 0x0fc91,
+    0x00d61, 0x04ca8, 0x06da1, 0x07a9b, 0x0d0cb, 0x0d0ca, 0x110c9, 0x07f85, 0x110c7, 0x110c6, 0x110c0, 0x1ba91, 0x1d0c5, 0x1d0c4, 0x1d0bf, 0x01f5c,
+    0x00e28, 0x10c96, 0x0edc0, 0x010cc, 0x18e61, 0x1caa8, 0x050cb, 0x050ca, 0x04f8e, 0x050c8, 0x190c7, 0x190c6, 0x1ae99, 0x050c1, 0x190c0, 0x03c91,
+    0x0ce61, 0x10ca8, 0x010cb, 0x010ca, 0x1eea1, 0x1f99b, 0x010c9, 0x1ff85, 0x050c7, 0x050c6, 0x050c5, 0x050c4, 0x050c0, 0x1f991, 0x050bf, 0x11f5c,
+    0x00f8e, 0x010c8, 0x0d0c7, 0x0d0c6, 0x010c7, 0x010c6, 0x010c5, 0x010c4, 0x010c3, 0x010c2, 0x1d0be, 0x1d0bd, 0x050be, 0x050bd, 0x190bc, 0x03c8b,
+    0x02d99, 0x010c1, 0x0d0c0, 0x07a91, 0x010c0, 0x13991, 0x010bf, 0x19f5c, 0x010be, 0x010bd, 0x110bc, 0x07a8b, 0x010bc, 0x1f98b, 0x010bb, 0x01f25,
+    0x00f37, 0x010ba, 0x10d80, 0x1f0b9, 0x06e80, 0x070b9, 0x190b8, 0x190b7, 0x18b5f, 0x210a2, 0x23088, 0x23087, 0x21088, 0x21087, 0x21080, 0x2dc7c,
+    0x0ed80, 0x010b9, 0x110b8, 0x110b7, 0x010b8, 0x010b7, 0x010b6, 0x010b5, 0x210a1, 0x210a0, 0x2f086, 0x2f085, 0x21086, 0x21085, 0x2107f, 0x01c7a,
+    0x10d5f, 0x170a2, 0x17088, 0x17087, 0x170a1, 0x170a0, 0x17086, 0x17085, 0x2f065, 0x2f064, 0x2f848, 0x2f846, 0x2f061, 0x2f060, 0x2f83c, 0x2383a,
+    0x15088, 0x15087, 0x17080, 0x2ba7c, 0x29086, 0x29085, 0x1707f, 0x07a7a, 0x2b061, 0x2b060, 0x1783c, 0x1783a, 0x2f05d, 0x2f05c, 0x2f836, 0x1de31,
+    0x00e5f, 0x090a2, 0x090a1, 0x090a0, 0x0b088, 0x0b087, 0x27086, 0x27085, 0x27065, 0x27064, 0x2d061, 0x2d060, 0x27848, 0x27846, 0x2183c, 0x2183a,
+    0x09088, 0x09087, 0x09086, 0x09085, 0x09080, 0x2597c, 0x0907f, 0x0997a, 0x27061, 0x27060, 0x2705d, 0x2705c, 0x2783c, 0x0b83a, 0x27836, 0x05d31,
+    0x25065, 0x25064, 0x29061, 0x29060, 0x25061, 0x25060, 0x2505d, 0x2505c, 0x25052, 0x25051, 0x2f823, 0x2f821, 0x27823, 0x27821, 0x2181c, 0x2181a,
+    0x25848, 0x25846, 0x2983c, 0x1583a, 0x0983c, 0x0983a, 0x03836, 0x01b31, 0x25823, 0x25821, 0x1781c, 0x1781a, 0x0981c, 0x0981a, 0x01816, 0x01806,
+    0x1cf0c, 0x0084c, 0x1ef35, 0x0096f, 0x04a44, 0x0ca75, 0x22b83, 0x136ad, 0x1ef20, 0x0c993, 0x1ef45, 0x17674, 0x1ab59, 0x1f4a7, 0x13471, 0x1746c,
+    0x00c44, 0x18c75, 0x18d83, 0x1f6ad, 0x1ce9b, 0x1d0b3, 0x1d0af, 0x1f6ab, 0x16d93, 0x1d0a9, 0x13477, 0x17673, 0x1f4a8, 0x1f4a6, 0x13470, 0x1746b,
+    0x10d20, 0x18993, 0x12f45, 0x1f274, 0x22b93, 0x110a9, 0x1f277, 0x23673, 0x1ef2a, 0x13299, 0x1f64f, 0x2f647, 0x1f497, 0x1f495, 0x1364d, 0x2b643,
+    0x0ed59, 0x132a7, 0x23271, 0x2326c, 0x132a8, 0x132a6, 0x23270, 0x2326b, 0x13297, 0x13295, 0x2364d, 0x2f643, 0x13296, 0x13294, 0x2f64b, 0x2f63f,
+    0x00e41, 0x10c9c, 0x2ef6f, 0x1d0ae, 0x1af6c, 0x1d0b2, 0x1d0ad, 0x1d0ac, 0x20f59, 0x1d0a8, 0x13476, 0x13473, 0x20f74, 0x1f4a5, 0x1346f, 0x1746a,
+    0x0ef6c, 0x110b2, 0x110ad, 0x110ac, 0x1d0b1, 0x1d0b0, 0x1d0ab, 0x1d0aa, 0x1d0a7, 0x1d0a6, 0x13475, 0x17672, 0x1d0a5, 0x1d0a4, 0x1346e, 0x15c68,
+    0x14f59, 0x110a8, 0x1f276, 0x1f273, 0x110a7, 0x110a6, 0x1f275, 0x1f272, 0x2ef65, 0x13298, 0x1f64e, 0x2f646, 0x1f493, 0x1f491, 0x1364c, 0x2b642,
+    0x0ed74, 0x132a5, 0x2326f, 0x2326a, 0x110a5, 0x110a4, 0x2326e, 0x1ba68, 0x13293, 0x13291, 0x2364c, 0x2f642, 0x13292, 0x13290, 0x2f64a, 0x2f63e,
+    0x1ef1d, 0x1f0a3, 0x1ef3d, 0x1f089, 0x1ab5f, 0x1f0a2, 0x1f088, 0x1f087, 0x22f24, 0x23066, 0x23449, 0x23447, 0x23063, 0x23062, 0x2f43d, 0x2f43b,
+    0x14d5f, 0x110a2, 0x13088, 0x13087, 0x1f0a1, 0x1f0a0, 0x1f086, 0x1f085, 0x23065, 0x23064, 0x23448, 0x23446, 0x23061, 0x23060, 0x2f43c, 0x2f43a,
+    0x12f24, 0x13066, 0x13249, 0x13247, 0x13065, 0x13064, 0x13248, 0x13246, 0x2f02c, 0x2f02b, 0x2f014, 0x2f013, 0x2f02a, 0x2f029, 0x2f012, 0x13c0e,
+    0x17063, 0x17062, 0x1723d, 0x2b23b, 0x17061, 0x17060, 0x1723c, 0x2b23a, 0x1702a, 0x17029, 0x17012, 0x23a0e, 0x2f028, 0x2f027, 0x2f011, 0x1fe0b,
+    0x00f55, 0x0909f, 0x2ef71, 0x1f084, 0x1af71, 0x27084, 0x27083, 0x27082, 0x2d05b, 0x2d05a, 0x23445, 0x23443, 0x2d845, 0x2d843, 0x2f435, 0x2f434,
+    0x14f71, 0x09084, 0x25083, 0x25082, 0x0907e, 0x0907d, 0x2507c, 0x2507b, 0x2d059, 0x2d058, 0x23444, 0x23442, 0x2783b, 0x27839, 0x21832, 0x1b830,
+    0x1705b, 0x1705a, 0x17245, 0x17243, 0x29059, 0x29058, 0x17244, 0x17242, 0x2f024, 0x2f023, 0x2f00f, 0x2f80e, 0x2f020, 0x2d81f, 0x2f80c, 0x1fc0a,
+    0x29845, 0x29843, 0x17235, 0x2b234, 0x2583b, 0x09839, 0x29832, 0x15830, 0x2b020, 0x2981f, 0x1780c, 0x13a0a, 0x2581b, 0x09819, 0x2f807, 0x1f804,
+    0x1cd12, 0x0084d, 0x1c93d, 0x00971, 0x00a48, 0x0ca77, 0x11688, 0x09683, 0x1cb2a, 0x11697, 0x13663, 0x17659, 0x00b65, 0x11693, 0x1365f, 0x29e44,
+    0x00c48, 0x18c77, 0x1d688, 0x0b683, 0x1d09e, 0x1d69b, 0x1d686, 0x0967c, 0x1d099, 0x11695, 0x13661, 0x17657, 0x1d098, 0x11691, 0x1365d, 0x25e3a,
+    0x1cd2a, 0x1d697, 0x1f663, 0x23659, 0x11099, 0x1d695, 0x1f661, 0x2d657, 0x1d08f, 0x1d68e, 0x1f62a, 0x2f622, 0x1f48e, 0x1168c, 0x13628, 0x2b61f,
+    0x00d65, 0x1d693, 0x2365f, 0x2de44, 0x11098, 0x1d691, 0x2365d, 0x27e3a, 0x1f28e, 0x1f28c, 0x23628, 0x2f61f, 0x1f28d, 0x1d68b, 0x2f626, 0x25e1a,
+    0x00e4d, 0x1d09d, 0x1d689, 0x1d684, 0x18a77, 0x1d09c, 0x11687, 0x09682, 0x1d097, 0x1d096, 0x13662, 0x17658, 0x1d093, 0x1d092, 0x1365e, 0x29e42,
+    0x0cc77, 0x1109c, 0x1d687, 0x0b682, 0x1d09b, 0x1d09a, 0x1d685, 0x0967b, 0x1d095, 0x1d094, 0x13660, 0x17656, 0x1d091, 0x1d090, 0x1365c, 0x09e38,
+    0x11097, 0x11096, 0x1f662, 0x23658, 0x11095, 0x11094, 0x1f660, 0x2d656, 0x1d08e, 0x1d08d, 0x1f629, 0x2f621, 0x1d08c, 0x1f48b, 0x13627, 0x2b61e,
+    0x11093, 0x11092, 0x2365e, 0x2de42, 0x11091, 0x11090, 0x2365c, 0x27e38, 0x1108c, 0x1f28b, 0x23627, 0x2f61e, 0x1d08b, 0x1d08a, 0x2f625, 0x09e18,
+    0x1cf3d, 0x1d089, 0x1f081, 0x1f67e, 0x1d088, 0x1d087, 0x1f080, 0x1167c, 0x1f063, 0x1f062, 0x1f43d, 0x1343b, 0x2305f, 0x2305e, 0x2f437, 0x17432,
+    0x11088, 0x11087, 0x11080, 0x1f67c, 0x1d086, 0x1d085, 0x1f07f, 0x0967a, 0x1f061, 0x1f060, 0x1f43c, 0x1343a, 0x2305d, 0x2305c, 0x2f436, 0x17431,
+    0x13063, 0x13062, 0x1f23d, 0x1f23b, 0x13061, 0x13060, 0x1f23c, 0x1f23a, 0x1f02a, 0x1f029, 0x1f012, 0x2f60e, 0x23028, 0x23027, 0x23011, 0x17e0b,
+    0x1305f, 0x1305e, 0x2f237, 0x2f232, 0x1305d, 0x1305c, 0x2f236, 0x2f231, 0x13028, 0x13027, 0x13011, 0x2fe0b, 0x2f026, 0x2f025, 0x2f010, 0x2fe06,
+    0x00f71, 0x1d084, 0x1f07e, 0x1f07d, 0x0b083, 0x0b082, 0x1f07c, 0x1f07b, 0x23059, 0x23058, 0x1f43b, 0x1f439, 0x2d844, 0x2d842, 0x2f432, 0x2f430,
+    0x09083, 0x09082, 0x1107c, 0x1107b, 0x0907c, 0x0907b, 0x0907a, 0x09079, 0x2d057, 0x2d056, 0x1f43a, 0x1f438, 0x2783a, 0x27838, 0x2f431, 0x2f42f,
+    0x17059, 0x17058, 0x1323b, 0x1f239, 0x17057, 0x17056, 0x1323a, 0x1f238, 0x2f022, 0x2f021, 0x2f00e, 0x2f00d, 0x2f01f, 0x2f01e, 0x2f80b, 0x1fc09,
+    0x29844, 0x29842, 0x17232, 0x2f230, 0x2583a, 0x09838, 0x17231, 0x2f22f, 0x2b01f, 0x2b01e, 0x1780b, 0x1fa09, 0x2581a, 0x09818, 0x2f806, 0x1fe03,
+    0x04f0c, 0x1084c, 0x10944, 0x00975, 0x06f35, 0x10a6f, 0x00b83, 0x075ad, 0x1af20, 0x00a93, 0x1eb59, 0x1b4a7, 0x1af45, 0x0b574, 0x0b471, 0x0b46c,
+    0x0cc44, 0x1cc75, 0x04d9b, 0x050b3, 0x0ae83, 0x1b5ad, 0x050af, 0x075ab, 0x0ae93, 0x190a9, 0x1b4a8, 0x1b4a6, 0x07477, 0x0b573, 0x0b470, 0x0b46b,
+    0x10d41, 0x04c9c, 0x1ef6c, 0x190b2, 0x26f6f, 0x050ae, 0x190ad, 0x190ac, 0x22f59, 0x190a8, 0x22f74, 0x1b4a5, 0x07476, 0x07473, 0x0b46f, 0x0b46a,
+    0x02f6c, 0x050b2, 0x050b1, 0x050b0, 0x050ad, 0x050ac, 0x050ab, 0x050aa, 0x190a7, 0x190a6, 0x190a5, 0x190a4, 0x07475, 0x0b572, 0x0b46e, 0x03c68,
+    0x06f20, 0x1ca93, 0x20b93, 0x050a9, 0x06f45, 0x1b174, 0x1b177, 0x21573, 0x06f2a, 0x07199, 0x1b497, 0x1b495, 0x0754f, 0x27547, 0x0b54d, 0x27543,
+    0x02e59, 0x071a7, 0x071a8, 0x071a6, 0x1b171, 0x2116c, 0x1b170, 0x2116b, 0x07197, 0x07195, 0x07196, 0x07194, 0x1b54d, 0x2d543, 0x2754b, 0x2753f,
+    0x08f59, 0x050a8, 0x050a7, 0x050a6, 0x1b176, 0x1b173, 0x1b175, 0x1b172, 0x26f65, 0x07198, 0x1b493, 0x1b491, 0x0754e, 0x27546, 0x0b54c, 0x27542,
+    0x08f74, 0x071a5, 0x050a5, 0x050a4, 0x1b16f, 0x2116a, 0x1b16e, 0x23968, 0x07193, 0x07191, 0x07192, 0x07190, 0x1b54c, 0x2d542, 0x2754a, 0x2753e,
+    0x06f1d, 0x070a3, 0x22b5f, 0x190a2, 0x06f3d, 0x07089, 0x1b088, 0x1b087, 0x1af24, 0x1b066, 0x21063, 0x21062, 0x1b449, 0x1b447, 0x2143d, 0x2d43b,
+    0x02e5f, 0x070a2, 0x070a1, 0x070a0, 0x07088, 0x07087, 0x07086, 0x07085, 0x1b065, 0x1b064, 0x21061, 0x21060, 0x1b448, 0x1b446, 0x2143c, 0x2d43a,
+    0x02f55, 0x0709f, 0x22f71, 0x17084, 0x26f71, 0x07084, 0x1b083, 0x1b082, 0x2105b, 0x2105a, 0x2f845, 0x2f843, 0x21445, 0x21443, 0x21435, 0x2d434,
+    0x02f71, 0x29084, 0x1707e, 0x1707d, 0x07083, 0x07082, 0x2b07c, 0x2b07b, 0x2f059, 0x2f058, 0x2b83b, 0x17839, 0x21444, 0x21442, 0x2f832, 0x23830,
+    0x0af24, 0x0b066, 0x0b065, 0x0b064, 0x0b149, 0x0b147, 0x0b148, 0x0b146, 0x2702c, 0x2702b, 0x2102a, 0x21029, 0x27014, 0x27013, 0x21012, 0x0bc0e,
+    0x0b063, 0x0b062, 0x0b061, 0x0b060, 0x2713d, 0x2713b, 0x2713c, 0x2713a, 0x2702a, 0x27029, 0x27028, 0x27027, 0x27012, 0x1b90e, 0x27011, 0x07d0b,
+    0x2505b, 0x2505a, 0x25059, 0x25058, 0x0b145, 0x0b143, 0x0b144, 0x0b142, 0x27024, 0x27023, 0x2d020, 0x2f81f, 0x2700f, 0x2780e, 0x2180c, 0x1bc0a,
+    0x25845, 0x25843, 0x2983b, 0x29839, 0x27135, 0x27134, 0x09832, 0x03830, 0x27020, 0x2581f, 0x2b81b, 0x17819, 0x2780c, 0x0790a, 0x27807, 0x07804,
+    0x04e12, 0x1084d, 0x10948, 0x00977, 0x04a3d, 0x10a71, 0x05588, 0x05583, 0x04b2a, 0x05597, 0x10b65, 0x05593, 0x07563, 0x0b559, 0x0b55f, 0x25d44,
+    0x10c48, 0x1cc77, 0x0509e, 0x0559b, 0x19588, 0x19583, 0x05586, 0x1757c, 0x19099, 0x05595, 0x19098, 0x05591, 0x07561, 0x25557, 0x0b55d, 0x29d3a,
+    0x10d4d, 0x0509d, 0x1c977, 0x1909c, 0x05589, 0x05584, 0x05587, 0x05582, 0x19097, 0x19096, 0x19093, 0x19092, 0x07562, 0x0b558, 0x0b55e, 0x25d42,
+    0x00c77, 0x0509c, 0x0509b, 0x0509a, 0x19587, 0x19582, 0x05585, 0x1757b, 0x19095, 0x19094, 0x19091, 0x19090, 0x07560, 0x25556, 0x0b55c, 0x29d38,
+    0x04e2a, 0x19597, 0x05099, 0x19595, 0x1b563, 0x21559, 0x1b561, 0x21557, 0x0508f, 0x0558e, 0x0748e, 0x0558c, 0x0752a, 0x27522, 0x0b528, 0x2751f,
+    0x10e65, 0x19593, 0x05098, 0x19591, 0x1b55f, 0x2fd44, 0x1b55d, 0x2bd3a, 0x0718e, 0x1b18c, 0x0718d, 0x0558b, 0x1b528, 0x2d51f, 0x27526, 0x2bd1a,
+    0x05097, 0x05096, 0x05095, 0x05094, 0x1b562, 0x21558, 0x1b560, 0x21556, 0x0508e, 0x0508d, 0x1908c, 0x0748b, 0x07529, 0x27521, 0x0b527, 0x2751e,
+    0x05093, 0x05092, 0x05091, 0x05090, 0x1b55e, 0x2fd42, 0x1b55c, 0x17d38, 0x0508c, 0x0718b, 0x0508b, 0x0508a, 0x1b527, 0x2d51e, 0x27525, 0x17d18,
+    0x04f3d, 0x05089, 0x19088, 0x19087, 0x07081, 0x0757e, 0x19080, 0x0757c, 0x1b063, 0x1b062, 0x1b05f, 0x1b05e, 0x0743d, 0x0743b, 0x27437, 0x27432,
+    0x05088, 0x05087, 0x05086, 0x05085, 0x07080, 0x1957c, 0x0707f, 0x0757a, 0x1b061, 0x1b060, 0x1b05d, 0x1b05c, 0x0743c, 0x0743a, 0x27436, 0x27431,
+    0x10f71, 0x05084, 0x19083, 0x19082, 0x0707e, 0x0707d, 0x1907c, 0x1907b, 0x21059, 0x21058, 0x2f844, 0x2f842, 0x1b43b, 0x07439, 0x21432, 0x27430,
+    0x05083, 0x05082, 0x1707c, 0x1707b, 0x0707c, 0x0707b, 0x0707a, 0x07079, 0x21057, 0x21056, 0x2b83a, 0x17838, 0x1b43a, 0x07438, 0x21431, 0x2742f,
+    0x07063, 0x07062, 0x07061, 0x07060, 0x0713d, 0x1b13b, 0x0713c, 0x1b13a, 0x0702a, 0x07029, 0x1b028, 0x1b027, 0x07012, 0x2750e, 0x1b011, 0x27d0b,
+    0x0b05f, 0x0b05e, 0x0b05d, 0x0b05c, 0x27137, 0x21132, 0x27136, 0x21131, 0x0b028, 0x0b027, 0x27026, 0x27025, 0x0b011, 0x21d0b, 0x27010, 0x27d06,
+    0x0b059, 0x0b058, 0x25057, 0x25056, 0x0713b, 0x07139, 0x0713a, 0x07138, 0x27022, 0x27021, 0x2d01f, 0x2d01e, 0x2700e, 0x2700d, 0x2180b, 0x07c09,
+    0x25844, 0x25842, 0x2983a, 0x29838, 0x27132, 0x27130, 0x27131, 0x2712f, 0x2701f, 0x2701e, 0x2b81a, 0x17818, 0x2780b, 0x07909, 0x27806, 0x07d03,
+    0x18f0f, 0x0084e, 0x10945, 0x1d476, 0x04a45, 0x19476, 0x19471, 0x1946f, 0x18b24, 0x19465, 0x1d45b, 0x13459, 0x0745b, 0x07459, 0x25455, 0x25c41,
+    0x00c4e, 0x19078, 0x1d477, 0x1d475, 0x19477, 0x19475, 0x19470, 0x1946e, 0x19466, 0x19464, 0x1d45a, 0x13458, 0x0745a, 0x07458, 0x25454, 0x25c3f,
+    0x10d45, 0x1d077, 0x1d06d, 0x1f66c, 0x1d074, 0x19473, 0x1d46c, 0x1f66a, 0x1d463, 0x1d461, 0x13645, 0x1763b, 0x19459, 0x07457, 0x13641, 0x17634,
+    0x1d076, 0x1d075, 0x1f26c, 0x23269, 0x1d073, 0x1d072, 0x1f26b, 0x23668, 0x1d462, 0x1d460, 0x13643, 0x17639, 0x19458, 0x07456, 0x1363f, 0x17633,
+    0x04e45, 0x19077, 0x19074, 0x1d473, 0x1906d, 0x1b56c, 0x1946c, 0x1b56a, 0x19463, 0x19461, 0x1d459, 0x1d457, 0x07545, 0x0b53b, 0x0b541, 0x0b534,
+    0x19076, 0x19075, 0x19073, 0x19072, 0x1b16c, 0x1b169, 0x1b16b, 0x1b568, 0x19462, 0x19460, 0x1d458, 0x1d456, 0x07543, 0x27539, 0x0b53f, 0x27533,
+    0x19071, 0x19070, 0x1d06c, 0x1d06b, 0x1906c, 0x1906b, 0x19069, 0x19468, 0x1945f, 0x1945d, 0x13644, 0x1763a, 0x07544, 0x0b53a, 0x13640, 0x25c30,
+    0x1906f, 0x1906e, 0x1d06a, 0x23268, 0x1906a, 0x1b168, 0x19068, 0x19067, 0x1945e, 0x1945c, 0x13642, 0x17638, 0x07542, 0x27538, 0x1363e, 0x03c2e,
+    0x18f24, 0x19066, 0x1d063, 0x1d062, 0x19063, 0x19062, 0x1905f, 0x1905e, 0x19053, 0x19452, 0x23424, 0x23422, 0x1b424, 0x1b422, 0x2141d, 0x2d41b,
+    0x19065, 0x19064, 0x1d061, 0x1d060, 0x19061, 0x19060, 0x1905d, 0x1905c, 0x19052, 0x19051, 0x23423, 0x23421, 0x1b423, 0x1b421, 0x2141c, 0x2d41a,
+    0x1d05b, 0x1d05a, 0x13245, 0x13243, 0x1d059, 0x1d058, 0x13244, 0x13242, 0x23024, 0x23023, 0x2300f, 0x2340e, 0x23020, 0x2141f, 0x2f40c, 0x2f40a,
+    0x13059, 0x13058, 0x1723b, 0x17239, 0x1d057, 0x1d056, 0x1723a, 0x17238, 0x23022, 0x23021, 0x2300e, 0x2300d, 0x2301f, 0x2301e, 0x2f40b, 0x17c09,
+    0x0705b, 0x0705a, 0x19059, 0x19058, 0x07145, 0x07143, 0x07144, 0x07142, 0x1b024, 0x1b023, 0x21020, 0x2341f, 0x1b00f, 0x1b40e, 0x2140c, 0x2d40a,
+    0x07059, 0x07058, 0x07057, 0x07056, 0x0b13b, 0x27139, 0x0b13a, 0x27138, 0x1b022, 0x1b021, 0x2101f, 0x2101e, 0x1b00e, 0x1b00d, 0x2140b, 0x27c09,
+    0x25055, 0x25054, 0x13241, 0x1323f, 0x0b141, 0x0b13f, 0x0b140, 0x0b13e, 0x2101d, 0x2101c, 0x2f00c, 0x2f00b, 0x2100c, 0x2100b, 0x21005, 0x21c04,
+    0x25841, 0x2583f, 0x17234, 0x17233, 0x0b134, 0x27133, 0x25830, 0x0382e, 0x2d01b, 0x2d01a, 0x2f00a, 0x17809, 0x2d00a, 0x27809, 0x21804, 0x19c02,
+    0x00b14, 0x0144f, 0x11449, 0x0d445, 0x01449, 0x01445, 0x0143d, 0x03735, 0x0142c, 0x0142a, 0x11424, 0x0f620, 0x01424, 0x03520, 0x0141d, 0x0340c,
+    0x01450, 0x0144e, 0x11448, 0x0d444, 0x01448, 0x01444, 0x0143c, 0x03732, 0x0142b, 0x01429, 0x11423, 0x0f61f, 0x01423, 0x0351f, 0x0141c, 0x0340b,
+    0x1d44f, 0x1144d, 0x11445, 0x11441, 0x01447, 0x01443, 0x0d43b, 0x03734, 0x1d42a, 0x11428, 0x13620, 0x1761b, 0x01422, 0x0141f, 0x0f41b, 0x1560a,
+    0x1d44e, 0x1144c, 0x11444, 0x11440, 0x01446, 0x01442, 0x0d43a, 0x03730, 0x1d429, 0x11427, 0x1361f, 0x17619, 0x01421, 0x0351e, 0x0f41a, 0x29609,
+    0x0544f, 0x0144d, 0x11447, 0x0d443, 0x05445, 0x01441, 0x0143b, 0x0f734, 0x0542a, 0x01428, 0x11422, 0x0d41f, 0x07520, 0x0951b, 0x0141b, 0x0950a,
+    0x0544e, 0x0144c, 0x11446, 0x0d442, 0x05444, 0x01440, 0x0143a, 0x15730, 0x05429, 0x01427, 0x11421, 0x0f61e, 0x0751f, 0x09519, 0x0141a, 0x09509,
+    0x1944d, 0x0144b, 0x11443, 0x1143f, 0x05443, 0x0143f, 0x01439, 0x03733, 0x19428, 0x01426, 0x1141f, 0x1761a, 0x0541f, 0x0951a, 0x01419, 0x03409,
+    0x1944c, 0x0144a, 0x11442, 0x1143e, 0x05442, 0x0143e, 0x01438, 0x0372e, 0x19427, 0x01425, 0x1361e, 0x17618, 0x0751e, 0x09518, 0x01418, 0x29608,
+    0x19449, 0x19447, 0x1d43d, 0x1143b, 0x0543d, 0x0543b, 0x01437, 0x01432, 0x19424, 0x19422, 0x1f41d, 0x1141b, 0x0741d, 0x0741b, 0x01417, 0x03407,
+    0x19448, 0x19446, 0x1d43c, 0x1143a, 0x0543c, 0x0543a, 0x01436, 0x03731, 0x19423, 0x19421, 0x1f41c, 0x1141a, 0x0741c, 0x0741a, 0x01416, 0x03406,
+    0x1d445, 0x1d443, 0x1f235, 0x1f234, 0x1943b, 0x05439, 0x1d432, 0x11430, 0x1f020, 0x1d41f, 0x1f40c, 0x1760a, 0x1941b, 0x07419, 0x2f407, 0x17404,
+    0x1d444, 0x1d442, 0x1f232, 0x23230, 0x1943a, 0x05438, 0x1f231, 0x2322f, 0x1f01f, 0x1f01e, 0x1f40b, 0x17609, 0x1941a, 0x07418, 0x2f406, 0x17403,
+    0x19445, 0x19443, 0x1d43b, 0x1d439, 0x07135, 0x1b134, 0x05432, 0x01430, 0x1b020, 0x1941f, 0x1f41b, 0x1f419, 0x0740c, 0x0b50a, 0x27407, 0x09404,
+    0x19444, 0x19442, 0x1d43a, 0x1d438, 0x07132, 0x1b130, 0x07131, 0x1b12f, 0x1b01f, 0x1b01e, 0x1f41a, 0x1f418, 0x0740b, 0x27509, 0x27406, 0x09403,
+    0x19441, 0x1943f, 0x13234, 0x1f233, 0x07134, 0x07133, 0x19430, 0x0142e, 0x2101b, 0x2101a, 0x2300a, 0x1f409, 0x2100a, 0x07409, 0x21404, 0x25402,
+    0x19440, 0x1943e, 0x13230, 0x2f22e, 0x0b130, 0x2712e, 0x0b12f, 0x2712d, 0x21019, 0x21018, 0x2f009, 0x2f008, 0x21009, 0x21008, 0x21403, 0x01c01,
+    0x00c05, 0x24440, 0x24540, 0x0ac69, 0x24640, 0x12c69, 0x0279a, 0x024b0, 0x24740, 0x0269a, 0x12d69, 0x025b0, 0x0af69, 0x026b0, 0x027b0, 0x010b4,
+    0x02c0c, 0x24441, 0x24544, 0x0ac6c, 0x28644, 0x16c6c, 0x0249b, 0x033b1, 0x2474c, 0x0e69c, 0x14575, 0x033b2, 0x08675, 0x0f3b2, 0x033b3, 0x033b0,
+    0x02d0c, 0x24444, 0x24541, 0x0ad6c, 0x2464c, 0x14475, 0x0e79c, 0x032b2, 0x28744, 0x0259b, 0x16d6c, 0x032b1, 0x08775, 0x032b3, 0x0f2b2, 0x032b0,
+    0x02c0f, 0x24445, 0x24545, 0x0936d, 0x2864e, 0x09376, 0x09277, 0x0bb6c, 0x2874e, 0x09377, 0x09276, 0x0ba6c, 0x03378, 0x09375, 0x09275, 0x0ba69,
+    0x02e0c, 0x28444, 0x2454c, 0x08475, 0x24641, 0x16e6c, 0x0279c, 0x0f1b2, 0x24744, 0x0269b, 0x14775, 0x031b3, 0x0ae6c, 0x031b1, 0x031b2, 0x031b0,
+    0x14c0f, 0x28445, 0x0854e, 0x15376, 0x28645, 0x1516d, 0x15177, 0x17b6c, 0x0874e, 0x15377, 0x15178, 0x15375, 0x15176, 0x1796c, 0x15175, 0x13b69,
+    0x02c12, 0x24448, 0x2454d, 0x08477, 0x2464d, 0x14477, 0x0319d, 0x0f19c, 0x24748, 0x0319e, 0x14777, 0x0329b, 0x08777, 0x0319b, 0x0319c, 0x0319a,
+    0x02c14, 0x25349, 0x0934f, 0x25345, 0x2934f, 0x29345, 0x2534d, 0x25341, 0x03350, 0x25348, 0x0934e, 0x25344, 0x2934e, 0x29344, 0x2534c, 0x25340,
+    0x02f0c, 0x2444c, 0x28544, 0x08575, 0x24644, 0x14675, 0x0279b, 0x030b3, 0x24741, 0x0269c, 0x16f6c, 0x0f0b2, 0x0af6c, 0x030b2, 0x030b1, 0x030b0,
+    0x02d12, 0x2444d, 0x24548, 0x08577, 0x24648, 0x14677, 0x0309e, 0x0339b, 0x2474d, 0x0309d, 0x14577, 0x0f09c, 0x08677, 0x0309c, 0x0309b, 0x0309a,
+    0x14d0f, 0x0844e, 0x28545, 0x15276, 0x0864e, 0x15078, 0x15277, 0x15275, 0x28745, 0x15077, 0x1506d, 0x17a6c, 0x15076, 0x15075, 0x1786c, 0x13a69,
+    0x02d14, 0x0924f, 0x25249, 0x25245, 0x03250, 0x0924e, 0x25248, 0x25244, 0x2924f, 0x2524d, 0x29245, 0x25241, 0x2924e, 0x2524c, 0x29244, 0x25240,
+    0x02f0f, 0x2844e, 0x2854e, 0x03078, 0x24645, 0x09176, 0x09177, 0x09175, 0x24745, 0x09077, 0x09076, 0x09075, 0x0906d, 0x0b96c, 0x0b86c, 0x0b969,
+    0x02e14, 0x2914f, 0x03150, 0x2914e, 0x25149, 0x29145, 0x25148, 0x29144, 0x0914f, 0x2514d, 0x0914e, 0x2514c, 0x25145, 0x25141, 0x25144, 0x25140,
+    0x02f14, 0x03050, 0x2904f, 0x2904e, 0x0904f, 0x0904e, 0x2504d, 0x2504c, 0x25049, 0x25048, 0x29045, 0x29044, 0x25045, 0x25044, 0x25041, 0x25040,
+    0x03015, 0x03b14, 0x03a14, 0x03a0f, 0x03914, 0x15b0f, 0x03a12, 0x03b0c, 0x03814, 0x03b12, 0x15a0f, 0x03a0c, 0x0390f, 0x0390c, 0x0380c, 0x01a05,
+    0x00c0c, 0x18841, 0x18944, 0x06c6c, 0x1ca44, 0x12c6c, 0x0089b, 0x013b1, 0x18b4c, 0x0ca9c, 0x10975, 0x013b2, 0x04a75, 0x0d3b2, 0x013b3, 0x013b0,
+    0x00c1d, 0x24c55, 0x0ad5f, 0x0ac71, 0x12e5f, 0x12c71, 0x013a1, 0x2137e, 0x013a3, 0x0139f, 0x013a2, 0x21384, 0x0f3a2, 0x2f384, 0x013a0, 0x2137d,
+    0x02c20, 0x0ac59, 0x06d59, 0x0ac74, 0x14e93, 0x013a7, 0x032a8, 0x013a5, 0x10f93, 0x013a8, 0x032a7, 0x032a5, 0x013a9, 0x013a6, 0x032a6, 0x013a4,
+    0x02c24, 0x0935b, 0x09363, 0x27b45, 0x03365, 0x27359, 0x09361, 0x2db3b, 0x03366, 0x0935a, 0x09362, 0x27b43, 0x03364, 0x27358, 0x09360, 0x21b39,
+    0x0ec20, 0x16c59, 0x08d93, 0x0d3a7, 0x12e59, 0x16c74, 0x0f1a8, 0x0d3a5, 0x04f93, 0x0d3a8, 0x0f1a9, 0x0d3a6, 0x0f1a7, 0x0f1a5, 0x0f1a6, 0x0f1a4,
+    0x14c24, 0x2b35b, 0x15365, 0x2b359, 0x15363, 0x2bb45, 0x15361, 0x2fb3b, 0x15366, 0x2b35a, 0x15364, 0x2b358, 0x15362, 0x2bb43, 0x15360, 0x2fb39,
+    0x02c2a, 0x24c65, 0x03297, 0x03293, 0x0f197, 0x0f193, 0x0f196, 0x0f192, 0x0f199, 0x0f198, 0x03295, 0x03291, 0x0f195, 0x0f191, 0x0f194, 0x0f190,
+    0x0332c, 0x25324, 0x0932a, 0x25320, 0x2932a, 0x29320, 0x25328, 0x2db1b, 0x0332b, 0x25323, 0x09329, 0x27b1f, 0x29329, 0x2bb1f, 0x25327, 0x21b19,
+    0x02c35, 0x24c6f, 0x08d83, 0x013ad, 0x04e83, 0x0d3ad, 0x030af, 0x013ab, 0x18f6f, 0x030ae, 0x0f0ad, 0x0f0ac, 0x030ad, 0x030ac, 0x030ab, 0x030aa,
+    0x02c3d, 0x24c71, 0x03388, 0x03383, 0x0f388, 0x2f383, 0x03386, 0x2d37c, 0x03389, 0x03384, 0x03387, 0x03382, 0x0f387, 0x2f382, 0x03385, 0x2d37b,
+    0x02c45, 0x0f276, 0x15271, 0x1526f, 0x0f277, 0x0f275, 0x15270, 0x1526e, 0x15074, 0x0f273, 0x1526c, 0x1526a, 0x15073, 0x15072, 0x1526b, 0x13a68,
+    0x03249, 0x09245, 0x0923d, 0x09235, 0x03248, 0x09244, 0x0923c, 0x27b32, 0x03247, 0x09243, 0x2523b, 0x25234, 0x03246, 0x09242, 0x2523a, 0x0bb30,
+    0x0ec45, 0x03176, 0x03177, 0x03175, 0x03171, 0x0316f, 0x03170, 0x0316e, 0x09074, 0x03173, 0x09073, 0x09072, 0x0916c, 0x0916a, 0x0916b, 0x0b968,
+    0x15149, 0x15145, 0x15148, 0x15144, 0x2913d, 0x29135, 0x2913c, 0x17b32, 0x15147, 0x15143, 0x15146, 0x15142, 0x2913b, 0x29134, 0x2913a, 0x13b30,
+    0x0304f, 0x0304e, 0x1504d, 0x1504c, 0x0304d, 0x0304c, 0x0304b, 0x0304a, 0x25047, 0x25046, 0x29043, 0x29042, 0x25043, 0x25042, 0x2503f, 0x2503e,
+    0x03314, 0x2530f, 0x09312, 0x09b0c, 0x29312, 0x29b0c, 0x25311, 0x03b07, 0x03313, 0x25b0e, 0x15a0e, 0x03a0a, 0x0390e, 0x15b0a, 0x0380b, 0x01b04,
+    0x00d0c, 0x18844, 0x18941, 0x06d6c, 0x18a4c, 0x10875, 0x0cb9c, 0x012b2, 0x1cb44, 0x0099b, 0x12d6c, 0x012b1, 0x04b75, 0x012b3, 0x0d2b2, 0x012b0,
+    0x00c20, 0x06c59, 0x0ad59, 0x06c74, 0x10e93, 0x033a7, 0x012a8, 0x033a5, 0x14f93, 0x033a8, 0x012a7, 0x012a5, 0x033a9, 0x033a6, 0x012a6, 0x033a4,
+    0x00d1d, 0x0ac5f, 0x24d55, 0x0ad71, 0x012a3, 0x012a2, 0x0129f, 0x21284, 0x12f5f, 0x012a1, 0x12d71, 0x2127e, 0x0f2a2, 0x012a0, 0x2f284, 0x2127d,
+    0x02d24, 0x09263, 0x0925b, 0x27a45, 0x03266, 0x09262, 0x0925a, 0x27a43, 0x03265, 0x09261, 0x27259, 0x2da3b, 0x03264, 0x09260, 0x27258, 0x21a39,
+    0x02d35, 0x08c83, 0x24d6f, 0x012ad, 0x18e6f, 0x0f1ad, 0x031ae, 0x0f1ac, 0x04f83, 0x031af, 0x0d2ad, 0x012ab, 0x031ad, 0x031ab, 0x031ac, 0x031aa,
+    0x02d45, 0x15371, 0x0f376, 0x1536f, 0x15174, 0x1536c, 0x0f373, 0x1536a, 0x0f377, 0x15370, 0x0f375, 0x1536e, 0x15173, 0x1536b, 0x15172, 0x13b68,
+    0x02d3d, 0x03288, 0x24d71, 0x03283, 0x03289, 0x03287, 0x03284, 0x03282, 0x0f288, 0x03286, 0x2f283, 0x2d27c, 0x0f287, 0x03285, 0x2f282, 0x2d27b,
+    0x03349, 0x0933d, 0x09345, 0x09335, 0x03347, 0x2533b, 0x09343, 0x25334, 0x03348, 0x0933c, 0x09344, 0x27a32, 0x03346, 0x2533a, 0x09342, 0x0ba30,
+    0x0ed20, 0x08c93, 0x16d59, 0x0d2a7, 0x04e93, 0x0f0a9, 0x0d2a8, 0x0d2a6, 0x12f59, 0x0f0a8, 0x16d74, 0x0d2a5, 0x0f0a7, 0x0f0a6, 0x0f0a5, 0x0f0a4,
+    0x02d2a, 0x03397, 0x24d65, 0x03393, 0x0f099, 0x03395, 0x0f098, 0x03391, 0x0f097, 0x0f096, 0x0f093, 0x0f092, 0x0f095, 0x0f094, 0x0f091, 0x0f090,
+    0x14d24, 0x15265, 0x2b25b, 0x2b259, 0x15266, 0x15264, 0x2b25a, 0x2b258, 0x15263, 0x15261, 0x2ba45, 0x2fa3b, 0x15262, 0x15260, 0x2ba43, 0x2fa39,
+    0x0322c, 0x0922a, 0x25224, 0x25220, 0x0322b, 0x09229, 0x25223, 0x27a1f, 0x2922a, 0x25228, 0x29220, 0x2da1b, 0x29229, 0x25227, 0x2ba1f, 0x21a19,
+    0x0ed45, 0x03077, 0x03076, 0x03075, 0x03074, 0x09173, 0x03073, 0x03072, 0x03071, 0x03070, 0x0306f, 0x0306e, 0x0906c, 0x0906b, 0x0906a, 0x0b868,
+    0x0314f, 0x1514d, 0x0314e, 0x1514c, 0x25147, 0x29143, 0x25146, 0x29142, 0x0314d, 0x0314b, 0x0314c, 0x0314a, 0x25143, 0x2513f, 0x25142, 0x2513e,
+    0x15049, 0x15048, 0x15045, 0x15044, 0x15047, 0x15046, 0x15043, 0x15042, 0x2903d, 0x2903c, 0x29035, 0x17a32, 0x2903b, 0x2903a, 0x29034, 0x13a30,
+    0x03214, 0x09212, 0x2520f, 0x09a0c, 0x03213, 0x15b0e, 0x25a0e, 0x09a0a, 0x29212, 0x25211, 0x29a0c, 0x03a07, 0x0380e, 0x0390b, 0x15a0a, 0x01a04,
+    0x00c0f, 0x18845, 0x18945, 0x0536d, 0x1ca4e, 0x05376, 0x05277, 0x0776c, 0x1cb4e, 0x05377, 0x05276, 0x0766c, 0x01378, 0x05375, 0x05275, 0x0b669,
+    0x00c24, 0x0535b, 0x05363, 0x1b745, 0x01365, 0x1b359, 0x05361, 0x2173b, 0x01366, 0x0535a, 0x05362, 0x1b743, 0x01364, 0x1b358, 0x05360, 0x21739,
+    0x00d24, 0x05263, 0x0525b, 0x1b645, 0x01266, 0x05262, 0x0525a, 0x1b643, 0x01265, 0x05261, 0x1b259, 0x2163b, 0x01264, 0x05260, 0x1b258, 0x21639,
+    0x01353, 0x0b324, 0x0b224, 0x0b30f, 0x01352, 0x0b322, 0x0b223, 0x0b30e, 0x01252, 0x0b323, 0x0b222, 0x0b20e, 0x01351, 0x0b321, 0x0b221, 0x0b30d,
+    0x0ce45, 0x01371, 0x01374, 0x0536c, 0x01376, 0x0136f, 0x01373, 0x0536a, 0x01377, 0x01370, 0x05273, 0x0536b, 0x01375, 0x0136e, 0x01372, 0x0b768,
+    0x0135b, 0x01355, 0x01359, 0x1b741, 0x0f359, 0x2fb41, 0x01357, 0x21734, 0x0135a, 0x01354, 0x01358, 0x1b73f, 0x0f358, 0x2fb3f, 0x01356, 0x21733,
+    0x01263, 0x0125f, 0x05259, 0x1b644, 0x01262, 0x0125e, 0x05258, 0x1b642, 0x01261, 0x0125d, 0x05257, 0x2163a, 0x01260, 0x0125c, 0x05256, 0x21638,
+    0x03324, 0x0931d, 0x09320, 0x2730c, 0x03322, 0x2531b, 0x0931f, 0x2730a, 0x03323, 0x0931c, 0x0b21f, 0x2730b, 0x03321, 0x2531a, 0x0931e, 0x21b09,
+    0x0cf45, 0x05374, 0x01271, 0x0526c, 0x01277, 0x05373, 0x01270, 0x0526b, 0x01276, 0x01273, 0x0126f, 0x0526a, 0x01275, 0x05372, 0x0126e, 0x0b668,
+    0x01363, 0x05359, 0x0135f, 0x1b744, 0x01361, 0x05357, 0x0135d, 0x2173a, 0x01362, 0x05358, 0x0135e, 0x1b742, 0x01360, 0x05356, 0x0135c, 0x21738,
+    0x0125b, 0x01259, 0x01255, 0x1b641, 0x0125a, 0x01258, 0x01254, 0x1b63f, 0x0f259, 0x01257, 0x2fa41, 0x21634, 0x0f258, 0x01256, 0x2fa3f, 0x21633,
+    0x03224, 0x0b320, 0x0921d, 0x2720c, 0x03223, 0x0b31f, 0x0921c, 0x2720b, 0x03222, 0x0921f, 0x2521b, 0x2720a, 0x03221, 0x0b31e, 0x2521a, 0x21a09,
+    0x0306d, 0x0136c, 0x0126c, 0x01369, 0x0316c, 0x0316a, 0x0316b, 0x01368, 0x0306c, 0x0306b, 0x0306a, 0x01268, 0x03069, 0x03168, 0x03068, 0x03067,
+    0x0f145, 0x15141, 0x0f144, 0x15140, 0x1513b, 0x15134, 0x1513a, 0x2fb30, 0x0f143, 0x1513f, 0x0f142, 0x1513e, 0x29139, 0x29133, 0x29138, 0x2fb2e,
+    0x0f045, 0x0f044, 0x15041, 0x15040, 0x0f043, 0x0f042, 0x1503f, 0x1503e, 0x1503b, 0x1503a, 0x15034, 0x2fa30, 0x29039, 0x29038, 0x29033, 0x2fa2e,
+    0x0330f, 0x0930c, 0x0920c, 0x09305, 0x0330e, 0x2530a, 0x0920b, 0x09b04, 0x0320e, 0x0930b, 0x2520a, 0x09a04, 0x0330d, 0x29b09, 0x29a09, 0x01a02,
+    0x00e0c, 0x1c844, 0x1894c, 0x04875, 0x18a41, 0x12e6c, 0x00b9c, 0x0d1b2, 0x18b44, 0x00a9b, 0x10b75, 0x011b3, 0x06e6c, 0x011b1, 0x011b2, 0x011b0,
+    0x0cc20, 0x12c59, 0x04d93, 0x0f3a7, 0x16e59, 0x12c74, 0x0d1a8, 0x0f3a5, 0x08f93, 0x0f3a8, 0x0d1a9, 0x0f3a6, 0x0d1a7, 0x0d1a5, 0x0d1a6, 0x0d1a4,
+    0x00d35, 0x04c83, 0x18d6f, 0x032ad, 0x24e6f, 0x0d1ad, 0x011ae, 0x0d1ac, 0x08f83, 0x011af, 0x0f2ad, 0x032ab, 0x011ad, 0x011ab, 0x011ac, 0x011aa,
+    0x0ee45, 0x03371, 0x03374, 0x0936c, 0x03376, 0x0336f, 0x03373, 0x0936a, 0x03377, 0x03370, 0x09273, 0x0936b, 0x03375, 0x0336e, 0x03372, 0x0bb68,
+    0x00e1d, 0x12c5f, 0x011a3, 0x0f1a2, 0x24e55, 0x12e71, 0x0119f, 0x2f184, 0x0af5f, 0x011a1, 0x011a2, 0x011a0, 0x0ae71, 0x2117e, 0x21184, 0x2117d,
+    0x14e24, 0x15163, 0x15166, 0x15162, 0x2b15b, 0x2b945, 0x2b15a, 0x2b943, 0x15165, 0x15161, 0x15164, 0x15160, 0x2b159, 0x2f93b, 0x2b158, 0x2f939,
+    0x02e3d, 0x0f188, 0x03189, 0x0f187, 0x24e71, 0x2f183, 0x03184, 0x2f182, 0x03188, 0x03186, 0x03187, 0x03185, 0x03183, 0x2d17c, 0x03182, 0x2d17b,
+    0x15349, 0x2933d, 0x15347, 0x2933b, 0x15345, 0x29335, 0x15343, 0x29334, 0x15348, 0x2933c, 0x15346, 0x2933a, 0x15344, 0x17932, 0x15342, 0x13930,
+    0x00f20, 0x14c93, 0x10d93, 0x030a9, 0x0ae59, 0x011a7, 0x011a8, 0x011a6, 0x06f59, 0x030a8, 0x030a7, 0x030a6, 0x06f74, 0x011a5, 0x030a5, 0x030a4,
+    0x02e2a, 0x0f397, 0x03099, 0x0f395, 0x24e65, 0x0f393, 0x03098, 0x0f391, 0x03097, 0x03096, 0x03095, 0x03094, 0x03093, 0x03092, 0x03091, 0x03090,
+    0x02e45, 0x0f077, 0x0f074, 0x15273, 0x0f076, 0x0f075, 0x0f073, 0x0f072, 0x15071, 0x15070, 0x1506c, 0x1506b, 0x1506f, 0x1506e, 0x1506a, 0x13868,
+    0x0324f, 0x0324d, 0x25247, 0x25243, 0x0324e, 0x0324c, 0x25246, 0x25242, 0x1524d, 0x0324b, 0x29243, 0x2523f, 0x1524c, 0x0324a, 0x29242, 0x2523e,
+    0x02e24, 0x03165, 0x03166, 0x03164, 0x0915b, 0x27159, 0x0915a, 0x27158, 0x09163, 0x09161, 0x09162, 0x09160, 0x27945, 0x2d93b, 0x27943, 0x21939,
+    0x0312c, 0x2912a, 0x0312b, 0x29129, 0x25124, 0x29120, 0x25123, 0x2b91f, 0x0912a, 0x25128, 0x09129, 0x25127, 0x25120, 0x2d91b, 0x2791f, 0x21919,
+    0x03049, 0x03048, 0x03047, 0x03046, 0x09045, 0x09044, 0x09043, 0x09042, 0x0903d, 0x0903c, 0x2503b, 0x2503a, 0x09035, 0x27932, 0x25034, 0x0b930,
+    0x03114, 0x29112, 0x03113, 0x03b0e, 0x2510f, 0x2990c, 0x2590e, 0x0fb0a, 0x09112, 0x25111, 0x1580e, 0x03a0b, 0x0990c, 0x03907, 0x0990a, 0x01904,
+    0x10c0f, 0x1c845, 0x0494e, 0x11376, 0x1ca45, 0x1116d, 0x11177, 0x1376c, 0x04b4e, 0x11377, 0x11178, 0x11375, 0x11176, 0x1356c, 0x11175, 0x13769,
+    0x10c24, 0x1f35b, 0x11365, 0x1f359, 0x11363, 0x1f745, 0x11361, 0x2373b, 0x11366, 0x1f35a, 0x11364, 0x1f358, 0x11362, 0x1f743, 0x11360, 0x2f739,
+    0x00d45, 0x11371, 0x0d376, 0x1136f, 0x11174, 0x1136c, 0x0d373, 0x1136a, 0x0d377, 0x11370, 0x0d375, 0x1136e, 0x11173, 0x1136b, 0x11172, 0x13768,
+    0x0335b, 0x03355, 0x03359, 0x27b41, 0x0d359, 0x23741, 0x03357, 0x23734, 0x0335a, 0x03354, 0x03358, 0x27b3f, 0x0d358, 0x2373f, 0x03356, 0x2f733,
+    0x10e24, 0x11163, 0x11166, 0x11162, 0x1f15b, 0x1f545, 0x1f15a, 0x1f543, 0x11165, 0x11161, 0x11164, 0x11160, 0x1f159, 0x2353b, 0x1f158, 0x2f539,
+    0x11153, 0x13324, 0x11352, 0x13322, 0x13124, 0x1310f, 0x13123, 0x1330e, 0x11152, 0x13323, 0x11151, 0x13321, 0x13122, 0x1310e, 0x13121, 0x1310d,
+    0x0d163, 0x1115f, 0x0d162, 0x1115e, 0x11159, 0x1f544, 0x11158, 0x1f542, 0x0d161, 0x1115d, 0x0d160, 0x1115c, 0x1f157, 0x2353a, 0x1f156, 0x2f538,
+    0x15324, 0x1731d, 0x15322, 0x2b31b, 0x17120, 0x1730c, 0x1531f, 0x2b30a, 0x15323, 0x1731c, 0x15321, 0x2b31a, 0x1711f, 0x1730b, 0x1711e, 0x2fb09,
+    0x00f45, 0x0d174, 0x0d177, 0x11373, 0x11171, 0x1116c, 0x11170, 0x1116b, 0x0d176, 0x0d173, 0x0d175, 0x0d172, 0x1116f, 0x1116a, 0x1116e, 0x13568,
+    0x0d363, 0x11359, 0x0d361, 0x1f357, 0x1135f, 0x1f744, 0x1135d, 0x2373a, 0x0d362, 0x11358, 0x0d360, 0x1f356, 0x1135e, 0x1f742, 0x1135c, 0x2f738,
+    0x0f06d, 0x0d36c, 0x0f26c, 0x0d36a, 0x0d16c, 0x11169, 0x0d16b, 0x11368, 0x0f06c, 0x0f06b, 0x15069, 0x15268, 0x0f06a, 0x11168, 0x15068, 0x15067,
+    0x03245, 0x03241, 0x0923b, 0x09234, 0x03244, 0x03240, 0x0923a, 0x27b30, 0x03243, 0x0323f, 0x09239, 0x09233, 0x03242, 0x0323e, 0x09238, 0x27b2e,
+    0x0315b, 0x0d159, 0x0315a, 0x0d158, 0x03155, 0x23541, 0x03154, 0x2353f, 0x03159, 0x03157, 0x03158, 0x03156, 0x27941, 0x23534, 0x2793f, 0x2f533,
+    0x15124, 0x15120, 0x15123, 0x1731f, 0x1711d, 0x1710c, 0x1711c, 0x1710b, 0x15122, 0x1511f, 0x15121, 0x1511e, 0x2b11b, 0x2b10a, 0x2b11a, 0x2f909,
+    0x03045, 0x03044, 0x03043, 0x03042, 0x03041, 0x03040, 0x0303f, 0x0303e, 0x0903b, 0x0903a, 0x09039, 0x09038, 0x09034, 0x27930, 0x09033, 0x2792e,
+    0x1510f, 0x2930c, 0x1530e, 0x2930a, 0x2910c, 0x17105, 0x2910b, 0x17b04, 0x1510e, 0x2930b, 0x1510d, 0x09b09, 0x2910a, 0x17904, 0x09909, 0x11b02,
+    0x00c12, 0x18848, 0x1894d, 0x04877, 0x18a4d, 0x10877, 0x0119d, 0x0d19c, 0x18b48, 0x0119e, 0x10b77, 0x0129b, 0x04b77, 0x0119b, 0x0119c, 0x0119a,
+    0x00c2a, 0x18c65, 0x01297, 0x01293, 0x0d197, 0x0d193, 0x0d196, 0x0d192, 0x0d199, 0x0d198, 0x01295, 0x01291, 0x0d195, 0x0d191, 0x0d194, 0x0d190,
+    0x00d3d, 0x01288, 0x18d71, 0x01283, 0x01289, 0x01287, 0x01284, 0x01282, 0x0d288, 0x01286, 0x23283, 0x2127c, 0x0d287, 0x01285, 0x23282, 0x2127b,
+    0x03263, 0x0325f, 0x09259, 0x27a44, 0x03262, 0x0325e, 0x09258, 0x27a42, 0x03261, 0x0325d, 0x09257, 0x2da3a, 0x03260, 0x0325c, 0x09256, 0x21a38,
+    0x00e3d, 0x0d188, 0x01189, 0x0d187, 0x18e71, 0x23183, 0x01184, 0x23182, 0x01188, 0x01186, 0x01187, 0x01185, 0x01183, 0x2117c, 0x01182, 0x2117b,
+    0x0f163, 0x1515f, 0x0f162, 0x1515e, 0x15159, 0x2b944, 0x15158, 0x2b942, 0x0f161, 0x1515d, 0x0f160, 0x1515c, 0x2b157, 0x2f93a, 0x2b156, 0x2f938,
+    0x01181, 0x0f180, 0x0127e, 0x0127c, 0x0117e, 0x0f17c, 0x0117d, 0x0f17b, 0x01180, 0x0117f, 0x0f27c, 0x0127a, 0x0117c, 0x0117a, 0x0117b, 0x01179,
+    0x0333d, 0x03337, 0x0333b, 0x09332, 0x0f33b, 0x29332, 0x03339, 0x25330, 0x0333c, 0x03336, 0x0333a, 0x09331, 0x0f33a, 0x29331, 0x03338, 0x2532f,
+    0x00f2a, 0x01199, 0x0d297, 0x0d295, 0x01197, 0x01195, 0x01196, 0x01194, 0x18f65, 0x01198, 0x0d293, 0x0d291, 0x01193, 0x01191, 0x01192, 0x01190,
+    0x0308f, 0x0338e, 0x0128e, 0x0338c, 0x0118e, 0x0d18c, 0x0118d, 0x0338b, 0x0308e, 0x0308d, 0x0f08c, 0x0128b, 0x0308c, 0x0118b, 0x0308b, 0x0308a,
+    0x0f263, 0x0f261, 0x15259, 0x2b257, 0x0f262, 0x0f260, 0x15258, 0x2b256, 0x1525f, 0x1525d, 0x2ba44, 0x2fa3a, 0x1525e, 0x1525c, 0x2ba42, 0x2fa38,
+    0x0322a, 0x03228, 0x25222, 0x2521f, 0x03229, 0x03227, 0x25221, 0x2521e, 0x15228, 0x03226, 0x2921f, 0x2da1a, 0x15227, 0x03225, 0x2921e, 0x21a18,
+    0x03163, 0x03161, 0x03162, 0x03160, 0x09159, 0x09157, 0x09158, 0x09156, 0x0315f, 0x0315d, 0x0315e, 0x0315c, 0x27944, 0x2d93a, 0x27942, 0x21938,
+    0x0312a, 0x15128, 0x03129, 0x15127, 0x25122, 0x2911f, 0x25121, 0x2911e, 0x03128, 0x03126, 0x03127, 0x03125, 0x2511f, 0x2d91a, 0x2511e, 0x21918,
+    0x0303d, 0x0303c, 0x0f03b, 0x0f03a, 0x0303b, 0x0303a, 0x03039, 0x03038, 0x03037, 0x03036, 0x29032, 0x29031, 0x09032, 0x09031, 0x25030, 0x2502f,
+    0x03112, 0x15111, 0x2520e, 0x09a0b, 0x2510e, 0x2990b, 0x2510d, 0x03b09, 0x03111, 0x03110, 0x29a0b, 0x03a06, 0x0990b, 0x03906, 0x03809, 0x01a03,
+    0x00c14, 0x19349, 0x0534f, 0x19345, 0x1d34f, 0x1d345, 0x1934d, 0x19341, 0x01350, 0x19348, 0x0534e, 0x19344, 0x1d34e, 0x1d344, 0x1934c, 0x19340,
+    0x0132c, 0x19324, 0x0532a, 0x19320, 0x1d32a, 0x1d320, 0x19328, 0x2171b, 0x0132b, 0x19323, 0x05329, 0x1b71f, 0x1d329, 0x1f71f, 0x19327, 0x21719,
+    0x01349, 0x0533d, 0x05345, 0x05335, 0x01347, 0x1933b, 0x05343, 0x19334, 0x01348, 0x0533c, 0x05344, 0x07632, 0x01346, 0x1933a, 0x05342, 0x0b630,
+    0x01324, 0x0731d, 0x05320, 0x0730c, 0x01322, 0x1931b, 0x0531f, 0x1b30a, 0x01323, 0x0731c, 0x0721f, 0x0730b, 0x01321, 0x1931a, 0x0531e, 0x21709,
+    0x11349, 0x1d33d, 0x11347, 0x1d33b, 0x11345, 0x1d335, 0x11343, 0x1d334, 0x11348, 0x1d33c, 0x11346, 0x1d33a, 0x11344, 0x1f532, 0x11342, 0x13530,
+    0x11324, 0x1f31d, 0x11322, 0x1f31b, 0x13120, 0x1f30c, 0x1131f, 0x1f30a, 0x11323, 0x1f31c, 0x11321, 0x1f31a, 0x1311f, 0x1f30b, 0x1311e, 0x2f709,
+    0x0133d, 0x01337, 0x0133b, 0x05332, 0x0d33b, 0x1d332, 0x01339, 0x19330, 0x0133c, 0x01336, 0x0133a, 0x05331, 0x0d33a, 0x1d331, 0x01338, 0x1932f,
+    0x0131d, 0x01317, 0x0131b, 0x27307, 0x0f31b, 0x2f307, 0x01319, 0x21304, 0x0131c, 0x01316, 0x0131a, 0x27306, 0x0f31a, 0x2f306, 0x01318, 0x21303,
+    0x0134f, 0x19347, 0x0134d, 0x19343, 0x1134d, 0x1d343, 0x0134b, 0x1933f, 0x0134e, 0x19346, 0x0134c, 0x19342, 0x1134c, 0x1d342, 0x0134a, 0x1933e,
+    0x0132a, 0x19322, 0x01328, 0x1931f, 0x11328, 0x1d31f, 0x01326, 0x2171a, 0x01329, 0x19321, 0x01327, 0x1931e, 0x11327, 0x1d31e, 0x01325, 0x21718,
+    0x01345, 0x0533b, 0x01341, 0x05334, 0x01343, 0x05339, 0x0133f, 0x05333, 0x01344, 0x0533a, 0x01340, 0x1b630, 0x01342, 0x05338, 0x0133e, 0x2762e,
+    0x01320, 0x0731b, 0x0921b, 0x0730a, 0x0131f, 0x07319, 0x0921a, 0x07309, 0x0321f, 0x0731a, 0x09219, 0x27209, 0x0131e, 0x07318, 0x09218, 0x07308,
+    0x0d345, 0x1133b, 0x0d343, 0x1d339, 0x11341, 0x11334, 0x1133f, 0x1d333, 0x0d344, 0x1133a, 0x0d342, 0x1d338, 0x11340, 0x23530, 0x1133e, 0x2f52e,
+    0x0f120, 0x1131b, 0x0d31f, 0x1f319, 0x1711b, 0x1710a, 0x1711a, 0x1f309, 0x0f11f, 0x1131a, 0x0f11e, 0x1f318, 0x17119, 0x17109, 0x17118, 0x17108,
+    0x03035, 0x01332, 0x0f034, 0x01330, 0x03034, 0x11330, 0x03033, 0x0132e, 0x03032, 0x03031, 0x15030, 0x1502f, 0x03030, 0x0302f, 0x0302e, 0x0302d,
+    0x0330c, 0x03307, 0x0330a, 0x09304, 0x1510a, 0x17304, 0x03309, 0x25302, 0x0330b, 0x03306, 0x09209, 0x09303, 0x29109, 0x17303, 0x29108, 0x01b01,
+    0x00f0c, 0x1884c, 0x1c944, 0x04975, 0x18a44, 0x10a75, 0x00b9b, 0x010b3, 0x18b41, 0x00a9c, 0x12f6c, 0x0d0b2, 0x06f6c, 0x010b2, 0x010b1, 0x010b0,
+    0x00c35, 0x18c6f, 0x04d83, 0x033ad, 0x08e83, 0x0f3ad, 0x010af, 0x033ab, 0x24f6f, 0x010ae, 0x0d0ad, 0x0d0ac, 0x010ad, 0x010ac, 0x010ab, 0x010aa,
+    0x0cd20, 0x04c93, 0x12d59, 0x0f2a7, 0x08e93, 0x0d0a9, 0x0f2a8, 0x0f2a6, 0x16f59, 0x0d0a8, 0x12d74, 0x0f2a5, 0x0d0a7, 0x0d0a6, 0x0d0a5, 0x0d0a4,
+    0x0ef45, 0x09374, 0x03271, 0x0926c, 0x03277, 0x09373, 0x03270, 0x0926b, 0x03276, 0x03273, 0x0326f, 0x0926a, 0x03275, 0x09372, 0x0326e, 0x0ba68,
+    0x02f20, 0x10c93, 0x14d93, 0x010a9, 0x06e59, 0x031a7, 0x031a8, 0x031a6, 0x0af59, 0x010a8, 0x010a7, 0x010a6, 0x0af74, 0x031a5, 0x010a5, 0x010a4,
+    0x02f45, 0x0f174, 0x0f177, 0x15373, 0x15171, 0x1516c, 0x15170, 0x1516b, 0x0f176, 0x0f173, 0x0f175, 0x0f172, 0x1516f, 0x1516a, 0x1516e, 0x13968,
+    0x02f2a, 0x03199, 0x0f297, 0x0f295, 0x03197, 0x03195, 0x03196, 0x03194, 0x24f65, 0x03198, 0x0f293, 0x0f291, 0x03193, 0x03191, 0x03192, 0x03190,
+    0x0334f, 0x25347, 0x0334d, 0x25343, 0x1534d, 0x29343, 0x0334b, 0x2533f, 0x0334e, 0x25346, 0x0334c, 0x25342, 0x1534c, 0x29342, 0x0334a, 0x2533e,
+    0x00f1d, 0x010a3, 0x12d5f, 0x0f0a2, 0x0ae5f, 0x010a2, 0x010a1, 0x010a0, 0x24f55, 0x0109f, 0x12f71, 0x2f084, 0x0af71, 0x21084, 0x2107e, 0x2107d,
+    0x02f3d, 0x03089, 0x0f088, 0x0f087, 0x03088, 0x03087, 0x03086, 0x03085, 0x24f71, 0x03084, 0x2f083, 0x2f082, 0x03083, 0x03082, 0x2d07c, 0x2d07b,
+    0x14f24, 0x15066, 0x15063, 0x15062, 0x15065, 0x15064, 0x15061, 0x15060, 0x2b05b, 0x2b05a, 0x2b845, 0x2b843, 0x2b059, 0x2b058, 0x2f83b, 0x2f839,
+    0x15249, 0x15247, 0x2923d, 0x2923b, 0x15248, 0x15246, 0x2923c, 0x2923a, 0x15245, 0x15243, 0x29235, 0x29234, 0x15244, 0x15242, 0x17832, 0x13830,
+    0x02f24, 0x03066, 0x03065, 0x03064, 0x09063, 0x09062, 0x09061, 0x09060, 0x0905b, 0x0905a, 0x27059, 0x27058, 0x27845, 0x27843, 0x2d83b, 0x21839,
+    0x03149, 0x03147, 0x03148, 0x03146, 0x0913d, 0x2513b, 0x0913c, 0x2513a, 0x09145, 0x09143, 0x09144, 0x09142, 0x09135, 0x25134, 0x27832, 0x0b830,
+    0x0302c, 0x0302b, 0x2902a, 0x29029, 0x0902a, 0x09029, 0x25028, 0x25027, 0x25024, 0x25023, 0x29020, 0x2b81f, 0x25020, 0x2781f, 0x2d81b, 0x21819,
+    0x03014, 0x03013, 0x29012, 0x03a0e, 0x09012, 0x1590e, 0x25011, 0x03b0b, 0x2500f, 0x2580e, 0x2980c, 0x0fa0a, 0x0980c, 0x0390a, 0x03807, 0x01804,
+    0x00d12, 0x1884d, 0x18948, 0x04977, 0x18a48, 0x10a77, 0x0109e, 0x0139b, 0x18b4d, 0x0109d, 0x10977, 0x0d09c, 0x04a77, 0x0109c, 0x0109b, 0x0109a,
+    0x00c3d, 0x18c71, 0x01388, 0x01383, 0x0d388, 0x23383, 0x01386, 0x2137c, 0x01389, 0x01384, 0x01387, 0x01382, 0x0d387, 0x23382, 0x01385, 0x2137b,
+    0x00d2a, 0x01397, 0x18d65, 0x01393, 0x0d099, 0x01395, 0x0d098, 0x01391, 0x0d097, 0x0d096, 0x0d093, 0x0d092, 0x0d095, 0x0d094, 0x0d091, 0x0d090,
+    0x03363, 0x09359, 0x0335f, 0x27b44, 0x03361, 0x09357, 0x0335d, 0x2db3a, 0x03362, 0x09358, 0x0335e, 0x27b42, 0x03360, 0x09356, 0x0335c, 0x21b38,
+    0x00e2a, 0x0d397, 0x01099, 0x0d395, 0x18e65, 0x0d393, 0x01098, 0x0d391, 0x01097, 0x01096, 0x01095, 0x01094, 0x01093, 0x01092, 0x01091, 0x01090,
+    0x0f363, 0x15359, 0x0f361, 0x2b357, 0x1535f, 0x2bb44, 0x1535d, 0x2fb3a, 0x0f362, 0x15358, 0x0f360, 0x2b356, 0x1535e, 0x2bb42, 0x1535c, 0x2fb38,
+    0x0108f, 0x0138e, 0x0328e, 0x0138c, 0x0318e, 0x0f18c, 0x0318d, 0x0138b, 0x0108e, 0x0108d, 0x0d08c, 0x0328b, 0x0108c, 0x0318b, 0x0108b, 0x0108a,
+    0x0332a, 0x25322, 0x03328, 0x2531f, 0x15328, 0x2931f, 0x03326, 0x2db1a, 0x03329, 0x25321, 0x03327, 0x2531e, 0x15327, 0x2931e, 0x03325, 0x21b18,
+    0x00f3d, 0x01089, 0x0d088, 0x0d087, 0x01088, 0x01087, 0x01086, 0x01085, 0x18f71, 0x01084, 0x23083, 0x23082, 0x01083, 0x01082, 0x2107c, 0x2107b,
+    0x01081, 0x0137e, 0x0f080, 0x0137c, 0x01080, 0x0f37c, 0x0107f, 0x0137a, 0x0107e, 0x0107d, 0x0f07c, 0x0f07b, 0x0107c, 0x0107b, 0x0107a, 0x01079,
+    0x0f063, 0x0f062, 0x1505f, 0x1505e, 0x0f061, 0x0f060, 0x1505d, 0x1505c, 0x15059, 0x15058, 0x2b844, 0x2b842, 0x2b057, 0x2b056, 0x2f83a, 0x2f838,
+    0x0323d, 0x0323b, 0x03237, 0x09232, 0x0323c, 0x0323a, 0x03236, 0x09231, 0x0f23b, 0x03239, 0x29232, 0x25230, 0x0f23a, 0x03238, 0x29231, 0x2522f,
+    0x03063, 0x03062, 0x03061, 0x03060, 0x0305f, 0x0305e, 0x0305d, 0x0305c, 0x09059, 0x09058, 0x09057, 0x09056, 0x27844, 0x27842, 0x2d83a, 0x21838,
+    0x0313d, 0x0f13b, 0x0313c, 0x0f13a, 0x03137, 0x29132, 0x03136, 0x29131, 0x0313b, 0x03139, 0x0313a, 0x03138, 0x09132, 0x25130, 0x09131, 0x2512f,
+    0x0302a, 0x03029, 0x15028, 0x15027, 0x03028, 0x03027, 0x03026, 0x03025, 0x25022, 0x25021, 0x2901f, 0x2901e, 0x2501f, 0x2501e, 0x2d81a, 0x21818,
+    0x03012, 0x2530e, 0x15011, 0x09b0b, 0x03011, 0x29b0b, 0x03010, 0x03b06, 0x2500e, 0x2500d, 0x2980b, 0x03a09, 0x0980b, 0x03909, 0x03806, 0x01b03,
+    0x10d0f, 0x0484e, 0x1c945, 0x11276, 0x04a4e, 0x11078, 0x11277, 0x11275, 0x1cb45, 0x11077, 0x1106d, 0x1366c, 0x11076, 0x11075, 0x1346c, 0x13669,
+    0x00c45, 0x0d276, 0x11271, 0x1126f, 0x0d277, 0x0d275, 0x11270, 0x1126e, 0x11074, 0x0d273, 0x1126c, 0x1126a, 0x11073, 0x11072, 0x1126b, 0x13668,
+    0x10d24, 0x11265, 0x1f25b, 0x1f259, 0x11266, 0x11264, 0x1f25a, 0x1f258, 0x11263, 0x11261, 0x1f645, 0x2363b, 0x11262, 0x11260, 0x1f643, 0x2f639,
+    0x0325b, 0x03259, 0x03255, 0x27a41, 0x0325a, 0x03258, 0x03254, 0x27a3f, 0x0d259, 0x03257, 0x23641, 0x23634, 0x0d258, 0x03256, 0x2363f, 0x2f633,
+    0x00e45, 0x0d077, 0x0d074, 0x11273, 0x0d076, 0x0d075, 0x0d073, 0x0d072, 0x11071, 0x11070, 0x1106c, 0x1106b, 0x1106f, 0x1106e, 0x1106a, 0x13468,
+    0x0d06d, 0x0f36c, 0x0d26c, 0x0f36a, 0x0f16c, 0x15169, 0x0f16b, 0x15368, 0x0d06c, 0x0d06b, 0x11069, 0x11268, 0x0d06a, 0x15168, 0x11068, 0x11067,
+    0x0d263, 0x0d261, 0x11259, 0x1f257, 0x0d262, 0x0d260, 0x11258, 0x1f256, 0x1125f, 0x1125d, 0x1f644, 0x2363a, 0x1125e, 0x1125c, 0x1f642, 0x2f638,
+    0x03345, 0x0933b, 0x03341, 0x09334, 0x03343, 0x09339, 0x0333f, 0x09333, 0x03344, 0x0933a, 0x03340, 0x27a30, 0x03342, 0x09338, 0x0333e, 0x27a2e,
+    0x10f24, 0x11066, 0x11063, 0x11062, 0x11065, 0x11064, 0x11061, 0x11060, 0x1f05b, 0x1f05a, 0x1f445, 0x1f443, 0x1f059, 0x1f058, 0x2343b, 0x2f439,
+    0x0d063, 0x0d062, 0x1105f, 0x1105e, 0x0d061, 0x0d060, 0x1105d, 0x1105c, 0x11059, 0x11058, 0x1f444, 0x1f442, 0x1f057, 0x1f056, 0x2343a, 0x2f438,
+    0x11053, 0x11252, 0x13224, 0x13222, 0x11052, 0x11051, 0x13223, 0x13221, 0x13024, 0x13023, 0x1300f, 0x1320e, 0x13022, 0x13021, 0x1300e, 0x1300d,
+    0x15224, 0x15222, 0x1721d, 0x2b21b, 0x15223, 0x15221, 0x1721c, 0x2b21a, 0x17020, 0x1521f, 0x1720c, 0x2b20a, 0x1701f, 0x1701e, 0x1720b, 0x2fa09,
+    0x0305b, 0x0305a, 0x0d059, 0x0d058, 0x03059, 0x03058, 0x03057, 0x03056, 0x03055, 0x03054, 0x23441, 0x2343f, 0x27841, 0x2783f, 0x23434, 0x2f433,
+    0x03145, 0x03143, 0x03144, 0x03142, 0x0913b, 0x09139, 0x0913a, 0x09138, 0x03141, 0x0313f, 0x03140, 0x0313e, 0x09134, 0x09133, 0x27830, 0x2782e,
+    0x15024, 0x15023, 0x15020, 0x1721f, 0x15022, 0x15021, 0x1501f, 0x1501e, 0x1701d, 0x1701c, 0x1700c, 0x1700b, 0x2b01b, 0x2b01a, 0x2b00a, 0x2f809,
+    0x1500f, 0x1520e, 0x2920c, 0x2920a, 0x1500e, 0x1500d, 0x2920b, 0x09a09, 0x2900c, 0x2900b, 0x17005, 0x17a04, 0x2900a, 0x09809, 0x17804, 0x11a02,
+    0x00d14, 0x0524f, 0x19249, 0x19245, 0x01250, 0x0524e, 0x19248, 0x19244, 0x1d24f, 0x1924d, 0x1d245, 0x19241, 0x1d24e, 0x1924c, 0x1d244, 0x19240,
+    0x01249, 0x05245, 0x0523d, 0x05235, 0x01248, 0x05244, 0x0523c, 0x07732, 0x01247, 0x05243, 0x1923b, 0x19234, 0x01246, 0x05242, 0x1923a, 0x0b730,
+    0x0122c, 0x0522a, 0x19224, 0x19220, 0x0122b, 0x05229, 0x19223, 0x1b61f, 0x1d22a, 0x19228, 0x1d220, 0x2161b, 0x1d229, 0x19227, 0x1f61f, 0x21619,
+    0x01224, 0x07320, 0x0721d, 0x0720c, 0x01223, 0x0731f, 0x0721c, 0x0720b, 0x01222, 0x0521f, 0x1921b, 0x1b20a, 0x01221, 0x0731e, 0x1921a, 0x21609,
+    0x0124f, 0x0124d, 0x19247, 0x19243, 0x0124e, 0x0124c, 0x19246, 0x19242, 0x1124d, 0x0124b, 0x1d243, 0x1923f, 0x1124c, 0x0124a, 0x1d242, 0x1923e,
+    0x01245, 0x01241, 0x0523b, 0x05234, 0x01244, 0x01240, 0x0523a, 0x1b730, 0x01243, 0x0123f, 0x05239, 0x05233, 0x01242, 0x0123e, 0x05238, 0x2772e,
+    0x0122a, 0x01228, 0x19222, 0x1921f, 0x01229, 0x01227, 0x19221, 0x1921e, 0x11228, 0x01226, 0x1d21f, 0x2161a, 0x11227, 0x01225, 0x1d21e, 0x21618,
+    0x03320, 0x0931b, 0x0721b, 0x0b30a, 0x0331f, 0x09319, 0x0721a, 0x27309, 0x0121f, 0x0931a, 0x07219, 0x07209, 0x0331e, 0x09318, 0x07218, 0x27308,
+    0x11249, 0x11247, 0x1d23d, 0x1d23b, 0x11248, 0x11246, 0x1d23c, 0x1d23a, 0x11245, 0x11243, 0x1d235, 0x1d234, 0x11244, 0x11242, 0x1f432, 0x13430,
+    0x0123d, 0x0123b, 0x01237, 0x05232, 0x0123c, 0x0123a, 0x01236, 0x05231, 0x0d23b, 0x01239, 0x1d232, 0x19230, 0x0d23a, 0x01238, 0x1d231, 0x1922f,
+    0x11224, 0x11222, 0x1f21d, 0x1f21b, 0x11223, 0x11221, 0x1f21c, 0x1f21a, 0x13020, 0x1121f, 0x1f20c, 0x1f20a, 0x1301f, 0x1301e, 0x1f20b, 0x2f609,
+    0x0121d, 0x0121b, 0x01217, 0x27207, 0x0121c, 0x0121a, 0x01216, 0x27206, 0x0f21b, 0x01219, 0x2f207, 0x21204, 0x0f21a, 0x01218, 0x2f206, 0x21203,
+    0x0d245, 0x0d243, 0x1123b, 0x1d239, 0x0d244, 0x0d242, 0x1123a, 0x1d238, 0x11241, 0x1123f, 0x11234, 0x1d233, 0x11240, 0x1123e, 0x23430, 0x2f42e,
+    0x03135, 0x0f134, 0x01232, 0x01230, 0x03132, 0x15130, 0x03131, 0x1512f, 0x03134, 0x03133, 0x11230, 0x0122e, 0x03130, 0x0312e, 0x0312f, 0x0312d,
+    0x0f020, 0x0d21f, 0x1121b, 0x1f219, 0x0f01f, 0x0f01e, 0x1121a, 0x1f218, 0x1701b, 0x1701a, 0x1700a, 0x1f209, 0x17019, 0x17018, 0x17009, 0x17008,
+    0x0320c, 0x0930a, 0x03207, 0x09204, 0x0320b, 0x09309, 0x03206, 0x09203, 0x1500a, 0x03209, 0x17204, 0x25202, 0x29009, 0x29008, 0x17203, 0x01a01,
+    0x00f0f, 0x1c84e, 0x1c94e, 0x01078, 0x18a45, 0x05176, 0x05177, 0x05175, 0x18b45, 0x05077, 0x05076, 0x05075, 0x0506d, 0x0756c, 0x0746c, 0x0b569,
+    0x0cc45, 0x01176, 0x01177, 0x01175, 0x01171, 0x0116f, 0x01170, 0x0116e, 0x05074, 0x01173, 0x05073, 0x05072, 0x0516c, 0x0516a, 0x0516b, 0x0b568,
+    0x0cd45, 0x01077, 0x01076, 0x01075, 0x01074, 0x05173, 0x01073, 0x01072, 0x01071, 0x01070, 0x0106f, 0x0106e, 0x0506c, 0x0506b, 0x0506a, 0x0b468,
+    0x0106d, 0x0336c, 0x0326c, 0x03369, 0x0116c, 0x0116a, 0x0116b, 0x03368, 0x0106c, 0x0106b, 0x0106a, 0x03268, 0x01069, 0x01168, 0x01068, 0x01067,
+    0x00e24, 0x01165, 0x01166, 0x01164, 0x0515b, 0x1b159, 0x0515a, 0x1b158, 0x05163, 0x05161, 0x05162, 0x05160, 0x1b545, 0x2153b, 0x1b543, 0x21539,
+    0x0115b, 0x0f159, 0x0115a, 0x0f158, 0x01155, 0x2f941, 0x01154, 0x2f93f, 0x01159, 0x01157, 0x01158, 0x01156, 0x1b541, 0x21534, 0x1b53f, 0x21533,
+    0x01163, 0x01161, 0x01162, 0x01160, 0x05159, 0x05157, 0x05158, 0x05156, 0x0115f, 0x0115d, 0x0115e, 0x0115c, 0x1b544, 0x2153a, 0x1b542, 0x21538,
+    0x0f345, 0x1533b, 0x0f343, 0x29339, 0x15341, 0x15334, 0x1533f, 0x29333, 0x0f344, 0x1533a, 0x0f342, 0x29338, 0x15340, 0x2f930, 0x1533e, 0x2f92e,
+    0x00f24, 0x01066, 0x01065, 0x01064, 0x05063, 0x05062, 0x05061, 0x05060, 0x0505b, 0x0505a, 0x1b059, 0x1b058, 0x1b445, 0x1b443, 0x2143b, 0x21439,
+    0x01063, 0x01062, 0x01061, 0x01060, 0x0105f, 0x0105e, 0x0105d, 0x0105c, 0x05059, 0x05058, 0x05057, 0x05056, 0x1b444, 0x1b442, 0x2143a, 0x21438,
+    0x0105b, 0x0105a, 0x0f059, 0x0f058, 0x01059, 0x01058, 0x01057, 0x01056, 0x01055, 0x01054, 0x2f841, 0x2f83f, 0x1b441, 0x1b43f, 0x21434, 0x21433,
+    0x0f245, 0x0f243, 0x1523b, 0x29239, 0x0f244, 0x0f242, 0x1523a, 0x29238, 0x15241, 0x1523f, 0x15234, 0x29233, 0x15240, 0x1523e, 0x2f830, 0x2f82e,
+    0x01053, 0x01152, 0x01052, 0x01051, 0x0b124, 0x0b122, 0x0b123, 0x0b121, 0x0b024, 0x0b023, 0x0b022, 0x0b021, 0x0b00f, 0x0b10e, 0x0b00e, 0x0b00d,
+    0x03124, 0x03122, 0x03123, 0x03121, 0x0911d, 0x2511b, 0x0911c, 0x2511a, 0x0b020, 0x0911f, 0x0b01f, 0x0b01e, 0x2710c, 0x2710a, 0x2710b, 0x21909,
+    0x03024, 0x03023, 0x03022, 0x03021, 0x09020, 0x0b11f, 0x0901f, 0x0901e, 0x0901d, 0x0901c, 0x2501b, 0x2501a, 0x2700c, 0x2700b, 0x2700a, 0x21809,
+    0x0300f, 0x0310e, 0x0300e, 0x0300d, 0x0910c, 0x2510a, 0x0910b, 0x29909, 0x0900c, 0x0900b, 0x2500a, 0x29809, 0x09005, 0x09904, 0x09804, 0x01902,
+    0x00e14, 0x1d14f, 0x01150, 0x1d14e, 0x19149, 0x1d145, 0x19148, 0x1d144, 0x0514f, 0x1914d, 0x0514e, 0x1914c, 0x19145, 0x19141, 0x19144, 0x19140,
+    0x11149, 0x11145, 0x11148, 0x11144, 0x1d13d, 0x1d135, 0x1d13c, 0x1f732, 0x11147, 0x11143, 0x11146, 0x11142, 0x1d13b, 0x1d134, 0x1d13a, 0x13730,
+    0x0114f, 0x1114d, 0x0114e, 0x1114c, 0x19147, 0x1d143, 0x19146, 0x1d142, 0x0114d, 0x0114b, 0x0114c, 0x0114a, 0x19143, 0x1913f, 0x19142, 0x1913e,
+    0x0d145, 0x11141, 0x0d144, 0x11140, 0x1113b, 0x11134, 0x1113a, 0x23730, 0x0d143, 0x1113f, 0x0d142, 0x1113e, 0x1d139, 0x1d133, 0x1d138, 0x2f72e,
+    0x0112c, 0x1d12a, 0x0112b, 0x1d129, 0x19124, 0x1d120, 0x19123, 0x1f51f, 0x0512a, 0x19128, 0x05129, 0x19127, 0x19120, 0x2151b, 0x1b51f, 0x21519,
+    0x11124, 0x11120, 0x11123, 0x1331f, 0x1f11d, 0x1f10c, 0x1f11c, 0x1f10b, 0x11122, 0x1111f, 0x11121, 0x1111e, 0x1f11b, 0x1f10a, 0x1f11a, 0x2f509,
+    0x0112a, 0x11128, 0x01129, 0x11127, 0x19122, 0x1d11f, 0x19121, 0x1d11e, 0x01128, 0x01126, 0x01127, 0x01125, 0x1911f, 0x2151a, 0x1911e, 0x21518,
+    0x0d120, 0x1731b, 0x0f31f, 0x17319, 0x1111b, 0x1310a, 0x1111a, 0x17309, 0x0d11f, 0x1731a, 0x0d11e, 0x17318, 0x1f119, 0x1f109, 0x1f118, 0x1f108,
+    0x01149, 0x01147, 0x01148, 0x01146, 0x0513d, 0x1913b, 0x0513c, 0x1913a, 0x05145, 0x05143, 0x05144, 0x05142, 0x05135, 0x19134, 0x07432, 0x0b430,
+    0x0113d, 0x0d13b, 0x0113c, 0x0d13a, 0x01137, 0x1d132, 0x01136, 0x1d131, 0x0113b, 0x01139, 0x0113a, 0x01138, 0x05132, 0x19130, 0x05131, 0x1912f,
+    0x01145, 0x01143, 0x01144, 0x01142, 0x0513b, 0x05139, 0x0513a, 0x05138, 0x01141, 0x0113f, 0x01140, 0x0113e, 0x05134, 0x05133, 0x1b430, 0x2742e,
+    0x01135, 0x0d134, 0x03232, 0x03230, 0x01132, 0x11130, 0x01131, 0x1112f, 0x01134, 0x01133, 0x15230, 0x0322e, 0x01130, 0x0112e, 0x0112f, 0x0112d,
+    0x01124, 0x01122, 0x01123, 0x01121, 0x0711d, 0x1911b, 0x0711c, 0x1911a, 0x07020, 0x0511f, 0x0701f, 0x0701e, 0x0710c, 0x1b10a, 0x0710b, 0x21509,
+    0x0111d, 0x0f11b, 0x0111c, 0x0f11a, 0x01117, 0x2f107, 0x01116, 0x2f106, 0x0111b, 0x01119, 0x0111a, 0x01118, 0x27107, 0x21104, 0x27106, 0x21103,
+    0x03020, 0x0111f, 0x0301f, 0x0301e, 0x0711b, 0x07119, 0x0711a, 0x07118, 0x0901b, 0x0901a, 0x09019, 0x09018, 0x0b00a, 0x07109, 0x27009, 0x27008,
+    0x0310c, 0x0f10a, 0x0310b, 0x29309, 0x03107, 0x17104, 0x03106, 0x17103, 0x0900a, 0x03109, 0x09009, 0x09008, 0x09104, 0x25102, 0x09103, 0x01901,
+    0x00f14, 0x01050, 0x1d04f, 0x1d04e, 0x0504f, 0x0504e, 0x1904d, 0x1904c, 0x19049, 0x19048, 0x1d045, 0x1d044, 0x19045, 0x19044, 0x19041, 0x19040,
+    0x0104f, 0x0104e, 0x1104d, 0x1104c, 0x0104d, 0x0104c, 0x0104b, 0x0104a, 0x19047, 0x19046, 0x1d043, 0x1d042, 0x19043, 0x19042, 0x1903f, 0x1903e,
+    0x11049, 0x11048, 0x11045, 0x11044, 0x11047, 0x11046, 0x11043, 0x11042, 0x1d03d, 0x1d03c, 0x1d035, 0x1f632, 0x1d03b, 0x1d03a, 0x1d034, 0x13630,
+    0x0d045, 0x0d044, 0x11041, 0x11040, 0x0d043, 0x0d042, 0x1103f, 0x1103e, 0x1103b, 0x1103a, 0x11034, 0x23630, 0x1d039, 0x1d038, 0x1d033, 0x2f62e,
+    0x01049, 0x01048, 0x01047, 0x01046, 0x05045, 0x05044, 0x05043, 0x05042, 0x0503d, 0x0503c, 0x1903b, 0x1903a, 0x05035, 0x07532, 0x19034, 0x0b530,
+    0x01045, 0x01044, 0x01043, 0x01042, 0x01041, 0x01040, 0x0103f, 0x0103e, 0x0503b, 0x0503a, 0x05039, 0x05038, 0x05034, 0x1b530, 0x05033, 0x2752e,
+    0x0103d, 0x0103c, 0x0d03b, 0x0d03a, 0x0103b, 0x0103a, 0x01039, 0x01038, 0x01037, 0x01036, 0x1d032, 0x1d031, 0x05032, 0x05031, 0x19030, 0x1902f,
+    0x01035, 0x03332, 0x0d034, 0x03330, 0x01034, 0x15330, 0x01033, 0x0332e, 0x01032, 0x01031, 0x11030, 0x1102f, 0x01030, 0x0102f, 0x0102e, 0x0102d,
+    0x0102c, 0x0102b, 0x1d02a, 0x1d029, 0x0502a, 0x05029, 0x19028, 0x19027, 0x19024, 0x19023, 0x1d020, 0x1f41f, 0x19020, 0x1b41f, 0x2141b, 0x21419,
+    0x0102a, 0x01029, 0x11028, 0x11027, 0x01028, 0x01027, 0x01026, 0x01025, 0x19022, 0x19021, 0x1d01f, 0x1d01e, 0x1901f, 0x1901e, 0x2141a, 0x21418,
+    0x11024, 0x11023, 0x11020, 0x1321f, 0x11022, 0x11021, 0x1101f, 0x1101e, 0x1f01d, 0x1f01c, 0x1f00c, 0x1f00b, 0x1f01b, 0x1f01a, 0x1f00a, 0x2f409,
+    0x0d020, 0x0f21f, 0x1721b, 0x17219, 0x0d01f, 0x0d01e, 0x1721a, 0x17218, 0x1101b, 0x1101a, 0x1300a, 0x17209, 0x1f019, 0x1f018, 0x1f009, 0x1f008,
+    0x01024, 0x01023, 0x01022, 0x01021, 0x05020, 0x0711f, 0x0501f, 0x0501e, 0x0701d, 0x0701c, 0x1901b, 0x1901a, 0x0700c, 0x0700b, 0x1b00a, 0x21409,
+    0x01020, 0x0311f, 0x0101f, 0x0101e, 0x0911b, 0x09119, 0x0911a, 0x09118, 0x0701b, 0x0701a, 0x07019, 0x07018, 0x0700a, 0x27109, 0x07009, 0x07008,
+    0x0101d, 0x0101c, 0x0f01b, 0x0f01a, 0x0101b, 0x0101a, 0x01019, 0x01018, 0x01017, 0x01016, 0x2f007, 0x2f006, 0x27007, 0x27006, 0x21004, 0x21003,
+    0x0300c, 0x0300b, 0x0f00a, 0x29209, 0x0300a, 0x09109, 0x03009, 0x03008, 0x03007, 0x03006, 0x17004, 0x17003, 0x09004, 0x09003, 0x25002, 0x01801,
+    0x01015, 0x01714, 0x01614, 0x0160f, 0x01514, 0x1170f, 0x01612, 0x0170c, 0x01414, 0x01712, 0x1160f, 0x0160c, 0x0150f, 0x0150c, 0x0140c, 0x01605,
+    0x01314, 0x1930f, 0x05312, 0x0570c, 0x1d312, 0x1d70c, 0x19311, 0x01707, 0x01313, 0x1970e, 0x1160e, 0x0160a, 0x0150e, 0x1170a, 0x0140b, 0x01704,
+    0x01214, 0x05212, 0x1920f, 0x0560c, 0x01213, 0x1170e, 0x1960e, 0x0560a, 0x1d212, 0x19211, 0x1d60c, 0x01607, 0x0140e, 0x0150b, 0x1160a, 0x01604,
+    0x0130f, 0x0530c, 0x0520c, 0x07305, 0x0130e, 0x1930a, 0x0520b, 0x07704, 0x0120e, 0x0530b, 0x1920a, 0x07604, 0x0130d, 0x1d709, 0x1d609, 0x01602,
+    0x01114, 0x1d112, 0x01113, 0x0170e, 0x1910f, 0x1d50c, 0x1950e, 0x0d70a, 0x05112, 0x19111, 0x1140e, 0x0160b, 0x0550c, 0x01507, 0x0550a, 0x01504,
+    0x1110f, 0x1d30c, 0x1130e, 0x1d30a, 0x1d10c, 0x1f105, 0x1d10b, 0x1f704, 0x1110e, 0x1d30b, 0x1110d, 0x05709, 0x1d10a, 0x1f504, 0x05509, 0x11702,
+    0x01112, 0x11111, 0x1920e, 0x0560b, 0x1910e, 0x1d50b, 0x1910d, 0x01709, 0x01111, 0x01110, 0x1d60b, 0x01606, 0x0550b, 0x01506, 0x01409, 0x01603,
+    0x0130c, 0x01307, 0x0130a, 0x07304, 0x1110a, 0x1f304, 0x01309, 0x19302, 0x0130b, 0x01306, 0x05209, 0x07303, 0x1d109, 0x1f303, 0x1d108, 0x01701,
+    0x01014, 0x01013, 0x1d012, 0x0160e, 0x05012, 0x1150e, 0x19011, 0x0170b, 0x1900f, 0x1940e, 0x1d40c, 0x0d60a, 0x0540c, 0x0150a, 0x01407, 0x01404,
+    0x01012, 0x1930e, 0x11011, 0x0570b, 0x01011, 0x1d70b, 0x01010, 0x01706, 0x1900e, 0x1900d, 0x1d40b, 0x01609, 0x0540b, 0x01509, 0x01406, 0x01703,
+    0x1100f, 0x1120e, 0x1d20c, 0x1d20a, 0x1100e, 0x1100d, 0x1d20b, 0x05609, 0x1d00c, 0x1d00b, 0x1f005, 0x1f604, 0x1d00a, 0x05409, 0x1f404, 0x11602,
+    0x0120c, 0x0530a, 0x01207, 0x07204, 0x0120b, 0x05309, 0x01206, 0x07203, 0x1100a, 0x01209, 0x1f204, 0x19202, 0x1d009, 0x1d008, 0x1f203, 0x01601,
+    0x0100f, 0x0110e, 0x0100e, 0x0100d, 0x0510c, 0x1910a, 0x0510b, 0x1d509, 0x0500c, 0x0500b, 0x1900a, 0x1d409, 0x07005, 0x07504, 0x07404, 0x01502,
+    0x0110c, 0x0d10a, 0x0110b, 0x1d309, 0x01107, 0x1f104, 0x01106, 0x1f103, 0x0500a, 0x01109, 0x05009, 0x05008, 0x07104, 0x19102, 0x07103, 0x01501,
+    0x0100c, 0x0100b, 0x0d00a, 0x1d209, 0x0100a, 0x05109, 0x01009, 0x01008, 0x01007, 0x01006, 0x1f004, 0x1f003, 0x07004, 0x07003, 0x19002, 0x01401,
+    0x01005, 0x01304, 0x01204, 0x01302, 0x01104, 0x11102, 0x01103, 0x01301, 0x01004, 0x01003, 0x11002, 0x01201, 0x01002, 0x01101, 0x01001, 0x01000};
+// clang-format on
+
+} /* namespace detail */
+
+} /* namespace mockturtle */
+/*! \endcond */
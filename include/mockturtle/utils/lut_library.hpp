@@ -0,0 +1,235 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2019  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file lut_library.hpp
+  \brief LUT library with area and delay per LUT size
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <istream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace mockturtle
+{
+
+/*! \brief LUT library.
+ *
+ * A LUT library assigns an area and a delay to each LUT size.  Optionally,
+ * each LUT size can have individual pin delays, which must be given in
+ * non-decreasing order, i.e., the first pin is the fastest one.  When pin
+ * delays are given, the latest arriving leaf of a cut is assigned to the
+ * fastest pin.
+ *
+ * The default constructed library is the unit library for LUTs up to size 6,
+ * where each LUT has area 1 and delay 1.
+ *
+ * A library can be read from a text file using `read_lut_library`.  Each
+ * non-empty line that does not start with `#` describes one LUT size:
+ *
+   \verbatim embed:rst
+
+   .. code-block:: none
+
+      # size  area  delay  [pin delays ...]
+      1       1.0   1
+      2       1.0   1
+      3       1.0   1
+      4       1.0   1
+      5       1.0   1
+      6       2.5   3      1 1 2 2 3 3
+
+   \endverbatim
+ *
+ * LUT sizes must be given in increasing order without gaps starting from 1.
+ */
+class lut_library
+{
+public:
+  struct lut_entry
+  {
+    float area{1.0f};
+    uint32_t delay{1u};
+    std::vector<uint32_t> pin_delays;
+  };
+
+public:
+  /*! \brief Creates unit library for LUTs up to size `max_lut_size`. */
+  explicit lut_library( uint32_t max_lut_size = 6u )
+      : _entries( max_lut_size )
+  {
+  }
+
+  /*! \brief Largest LUT size in the library. */
+  uint32_t max_lut_size() const
+  {
+    return static_cast<uint32_t>( _entries.size() );
+  }
+
+  /*! \brief Adds the next LUT size to the library. */
+  void add_lut( float area, uint32_t delay, std::vector<uint32_t> const& pin_delays = {} )
+  {
+    _entries.push_back( {area, delay, pin_delays} );
+  }
+
+  /*! \brief Returns the library entry for LUTs with `size` inputs. */
+  lut_entry const& entry( uint32_t size ) const
+  {
+    assert( size >= 1u && size <= max_lut_size() );
+    return _entries[size - 1];
+  }
+
+  /*! \brief Area of a LUT with `size` inputs (0 for trivial cuts). */
+  float area( uint32_t size ) const
+  {
+    assert( size <= max_lut_size() );
+    return size < 2 ? 0.0f : _entries[size - 1].area;
+  }
+
+  /*! \brief Delay of a LUT with `size` inputs. */
+  uint32_t delay( uint32_t size ) const
+  {
+    assert( size <= max_lut_size() );
+    return size == 0 ? 0u : _entries[size - 1].delay;
+  }
+
+  /*! \brief Arrival time at the output of a LUT.
+   *
+   * Computes the arrival time at the LUT output given the arrival times of
+   * its inputs.  The arrival times in `arrivals` are reordered.
+   */
+  uint32_t arrival( std::vector<uint32_t>& arrivals ) const
+  {
+    const auto size = static_cast<uint32_t>( arrivals.size() );
+    assert( size <= max_lut_size() );
+    if ( size == 0u )
+    {
+      return 0u;
+    }
+
+    auto const& e = _entries[size - 1];
+    if ( e.pin_delays.empty() )
+    {
+      return *std::max_element( arrivals.begin(), arrivals.end() ) + e.delay;
+    }
+
+    /* latest arriving input is assigned to the fastest pin */
+    std::sort( arrivals.begin(), arrivals.end(), std::greater<uint32_t>() );
+    uint32_t time{0u};
+    for ( auto i = 0u; i < size; ++i )
+    {
+      time = std::max( time, arrivals[i] + e.pin_delays[i] );
+    }
+    return time;
+  }
+
+  /*! \brief Checks whether all LUTs have unit area and delay. */
+  bool is_unit() const
+  {
+    return std::all_of( _entries.begin(), _entries.end(), []( auto const& e ) {
+      return e.area == 1.0f && e.delay == 1u && e.pin_delays.empty();
+    } );
+  }
+
+private:
+  std::vector<lut_entry> _entries;
+};
+
+/*! \brief Reads a LUT library from an input stream.
+ *
+ * Returns `std::nullopt` if the stream does not describe a valid library.
+ */
+inline std::optional<lut_library> read_lut_library( std::istream& in )
+{
+  lut_library lib( 0u );
+
+  std::string line;
+  while ( std::getline( in, line ) )
+  {
+    if ( const auto pos = line.find( '#' ); pos != std::string::npos )
+    {
+      line.erase( pos );
+    }
+
+    std::istringstream is( line );
+    uint32_t size;
+    if ( !( is >> size ) )
+    {
+      continue; /* empty line */
+    }
+
+    lut_library::lut_entry e;
+    if ( size != lib.max_lut_size() + 1 || !( is >> e.area >> e.delay ) )
+    {
+      return std::nullopt;
+    }
+
+    uint32_t pin_delay;
+    while ( is >> pin_delay )
+    {
+      e.pin_delays.push_back( pin_delay );
+    }
+    if ( !is.eof() )
+    {
+      return std::nullopt;
+    }
+
+    if ( !e.pin_delays.empty() && ( e.pin_delays.size() != size || !std::is_sorted( e.pin_delays.begin(), e.pin_delays.end() ) ) )
+    {
+      return std::nullopt;
+    }
+
+    lib.add_lut( e.area, e.delay, e.pin_delays );
+  }
+
+  if ( lib.max_lut_size() == 0u )
+  {
+    return std::nullopt;
+  }
+
+  return lib;
+}
+
+/*! \brief Reads a LUT library from a file. */
+inline std::optional<lut_library> read_lut_library( std::string const& filename )
+{
+  std::ifstream in( filename, std::ifstream::in );
+  if ( !in.is_open() )
+  {
+    return std::nullopt;
+  }
+  return read_lut_library( in );
+}
+
+} /* namespace mockturtle */
@@ -0,0 +1,149 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2019  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file mapped_file.hpp
+  \brief Read-only memory-mapped files
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define MOCKTURTLE_HAS_MMAP 1
+#endif
+
+namespace mockturtle
+{
+
+/*! \brief Read-only view of the contents of a file.
+ *
+ * On POSIX systems, the file is memory-mapped, such that its pages are
+ * loaded on demand and shared between processes that map the same file.
+ * Otherwise, the file is read into memory.  The contents remain valid until
+ * the object is destroyed.
+ */
+class mapped_file
+{
+public:
+  /*! \brief Maps the file `filename`; check `is_open` for success. */
+  explicit mapped_file( std::string const& filename )
+  {
+#ifdef MOCKTURTLE_HAS_MMAP
+    const auto fd = ::open( filename.c_str(), O_RDONLY );
+    if ( fd < 0 )
+    {
+      return;
+    }
+
+    struct stat st;
+    if ( ::fstat( fd, &st ) == 0 )
+    {
+      /* empty files cannot be mapped */
+      _open = st.st_size == 0;
+      if ( st.st_size > 0 )
+      {
+        auto* addr = ::mmap( nullptr, static_cast<std::size_t>( st.st_size ), PROT_READ, MAP_SHARED, fd, 0 );
+        if ( addr != MAP_FAILED )
+        {
+          _data = static_cast<char const*>( addr );
+          _size = static_cast<std::size_t>( st.st_size );
+          _open = _mapped = true;
+        }
+      }
+    }
+    ::close( fd );
+#else
+    std::ifstream is( filename, std::ifstream::in | std::ifstream::binary );
+    if ( !is.is_open() )
+    {
+      return;
+    }
+    _buffer.assign( std::istreambuf_iterator<char>( is ), std::istreambuf_iterator<char>() );
+    _data = _buffer.data();
+    _size = _buffer.size();
+    _open = true;
+#endif
+  }
+
+  mapped_file( mapped_file const& ) = delete;
+  mapped_file& operator=( mapped_file const& ) = delete;
+
+  ~mapped_file()
+  {
+#ifdef MOCKTURTLE_HAS_MMAP
+    if ( _mapped )
+    {
+      ::munmap( const_cast<char*>( _data ), _size );
+    }
+#endif
+  }
+
+  /*! \brief Whether the file could be opened. */
+  bool is_open() const
+  {
+    return _open;
+  }
+
+  /*! \brief Pointer to the first byte of the file. */
+  char const* data() const
+  {
+    return _data;
+  }
+
+  /*! \brief Size of the file in bytes. */
+  std::size_t size() const
+  {
+    return _size;
+  }
+
+  /*! \brief Copies a value of type `T` at `offset`, which must be in range. */
+  template<typename T>
+  T read( std::size_t offset ) const
+  {
+    T value;
+    std::memcpy( &value, _data + offset, sizeof( T ) );
+    return value;
+  }
+
+private:
+  char const* _data{nullptr};
+  std::size_t _size{0u};
+  bool _open{false};
+  bool _mapped{false};
+  std::vector<char> _buffer;
+};
+
+} /* namespace mockturtle */
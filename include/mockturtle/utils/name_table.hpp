@@ -0,0 +1,333 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2019  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file name_table.hpp
+  \brief Interned names with 32-bit identifiers
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace mockturtle
+{
+
+/*! \brief Table of interned names.
+ *
+ * Each distinct name is stored once in an arena of large character blocks
+ * and identified by a 32-bit id, such that maps from signals to names only
+ * need to store ids.  Ids are assigned consecutively from 0 in the order in
+ * which names are inserted, and are never invalidated.  Names are found by
+ * hashing into an open-addressing table of ids.
+ *
+ * If `compress_prefixes` is true, a name is split at the last occurrence of
+ * `separator` into a prefix, which is interned recursively, and a leaf.
+ * Only the leaf characters are stored for each name, such that hierarchical
+ * names such as `top/core/alu/n12` share the storage of their common
+ * prefixes.  The prefixes are themselves entries of the table and have ids.
+ *
+ * The table is not thread-safe.
+ */
+class name_table
+{
+public:
+  /*! \brief Id returned by `find` if a name is not in the table. */
+  static constexpr uint32_t invalid_id = std::numeric_limits<uint32_t>::max();
+
+  /*! \brief Creates an empty table.
+   *
+   * \param compress_prefixes Store hierarchical names as prefix and leaf
+   * \param separator Separator of hierarchy levels in names
+   */
+  explicit name_table( bool compress_prefixes = false, char separator = '/' )
+      : _compress_prefixes( compress_prefixes ), _separator( separator ), _slots( 16u, invalid_id )
+  {
+  }
+
+  /*! \brief Copies a table, such that the ids in the copy are the same. */
+  name_table( name_table const& other )
+      : _compress_prefixes( other._compress_prefixes ), _separator( other._separator ), _slots( other._slots )
+  {
+    _entries.reserve( other._entries.size() );
+    for ( auto const& e : other._entries )
+    {
+      _entries.push_back( {allocate( {e.data, e.length} ), e.length, e.parent, e.hash} );
+    }
+  }
+
+  name_table& operator=( name_table const& other )
+  {
+    if ( this != &other )
+    {
+      *this = name_table( other );
+    }
+    return *this;
+  }
+
+  name_table( name_table&& ) = default;
+  name_table& operator=( name_table&& ) = default;
+
+  /*! \brief Returns the id of `name` and inserts it if needed. */
+  uint32_t insert( std::string_view name )
+  {
+    auto parent = invalid_id;
+    auto leaf = name;
+    if ( _compress_prefixes )
+    {
+      if ( const auto pos = name.rfind( _separator ); pos != std::string_view::npos )
+      {
+        parent = insert( name.substr( 0, pos ) );
+        leaf = name.substr( pos + 1 );
+      }
+    }
+
+    const auto h = hash( parent, leaf );
+    auto slot = find_slot( parent, leaf, h );
+    if ( _slots[slot] != invalid_id )
+    {
+      return _slots[slot];
+    }
+
+    assert( _entries.size() < invalid_id );
+    const auto id = static_cast<uint32_t>( _entries.size() );
+    _entries.push_back( {allocate( leaf ), static_cast<uint32_t>( leaf.size() ), parent, h} );
+    _slots[slot] = id;
+
+    /* keep the load factor of the table below 1/2 */
+    if ( 2u * _entries.size() > _slots.size() )
+    {
+      rehash( 2u * _slots.size() );
+    }
+    return id;
+  }
+
+  /*! \brief Returns the id of `name`, or `invalid_id` if it is not in the table. */
+  uint32_t find( std::string_view name ) const
+  {
+    auto parent = invalid_id;
+    auto leaf = name;
+    if ( _compress_prefixes )
+    {
+      if ( const auto pos = name.rfind( _separator ); pos != std::string_view::npos )
+      {
+        parent = find( name.substr( 0, pos ) );
+        if ( parent == invalid_id )
+        {
+          return invalid_id;
+        }
+        leaf = name.substr( pos + 1 );
+      }
+    }
+
+    return _slots[find_slot( parent, leaf, hash( parent, leaf ) )];
+  }
+
+  /*! \brief Returns the name of `id`. */
+  std::string str( uint32_t id ) const
+  {
+    std::string name;
+    append( name, id );
+    return name;
+  }
+
+  /*! \brief Appends the name of `id` to `name`. */
+  void append( std::string& name, uint32_t id ) const
+  {
+    assert( id < _entries.size() );
+    auto const& e = _entries[id];
+    if ( e.parent != invalid_id )
+    {
+      append( name, e.parent );
+      name += _separator;
+    }
+    name.append( e.data, e.length );
+  }
+
+  /*! \brief Returns the stored characters of `id`.
+   *
+   * This is the full name of `id` unless prefixes are compressed, in which
+   * case it is the part after the last separator.  The view remains valid
+   * for the lifetime of the table.
+   */
+  std::string_view leaf( uint32_t id ) const
+  {
+    assert( id < _entries.size() );
+    return {_entries[id].data, _entries[id].length};
+  }
+
+  /*! \brief Returns the id of the prefix of `id`, or `invalid_id` if it has none. */
+  uint32_t prefix( uint32_t id ) const
+  {
+    assert( id < _entries.size() );
+    return _entries[id].parent;
+  }
+
+  /*! \brief Compares the name of `id` with `name` without building a string. */
+  bool equals( uint32_t id, std::string_view name ) const
+  {
+    assert( id < _entries.size() );
+    auto const& e = _entries[id];
+    if ( name.size() < e.length || std::string_view( e.data, e.length ) != name.substr( name.size() - e.length ) )
+    {
+      return false;
+    }
+    if ( e.parent == invalid_id )
+    {
+      return name.size() == e.length;
+    }
+    name.remove_suffix( e.length );
+    return !name.empty() && name.back() == _separator && equals( e.parent, name.substr( 0, name.size() - 1 ) );
+  }
+
+  /*! \brief Number of entries, including the prefixes of compressed names. */
+  uint32_t size() const
+  {
+    return static_cast<uint32_t>( _entries.size() );
+  }
+
+  /*! \brief Number of bytes allocated by the table. */
+  std::size_t memory_usage() const
+  {
+    return _allocated + _entries.capacity() * sizeof( entry ) + _slots.capacity() * sizeof( uint32_t );
+  }
+
+  /*! \brief Whether hierarchical names are stored as prefix and leaf. */
+  bool compress_prefixes() const
+  {
+    return _compress_prefixes;
+  }
+
+private:
+  struct entry
+  {
+    char const* data;
+    uint32_t length;
+    uint32_t parent;
+    uint32_t hash;
+  };
+
+  static constexpr std::size_t block_size = 1u << 16u;
+
+  static uint32_t hash( uint32_t parent, std::string_view leaf )
+  {
+    /* FNV-1a over the leaf, combined with the prefix id */
+    uint64_t h = 0xcbf29ce484222325ull ^ ( uint64_t( parent ) * 0x9e3779b97f4a7c15ull );
+    for ( auto c : leaf )
+    {
+      h ^= static_cast<unsigned char>( c );
+      h *= 0x100000001b3ull;
+    }
+    h ^= h >> 33u;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33u;
+    return static_cast<uint32_t>( h );
+  }
+
+  /* slot that contains the entry for (parent, leaf), or the empty slot at which it is inserted */
+  std::size_t find_slot( uint32_t parent, std::string_view leaf, uint32_t h ) const
+  {
+    const auto mask = _slots.size() - 1u;
+    for ( auto slot = std::size_t( h ) & mask;; slot = ( slot + 1u ) & mask )
+    {
+      const auto id = _slots[slot];
+      if ( id == invalid_id )
+      {
+        return slot;
+      }
+      auto const& e = _entries[id];
+      if ( e.hash == h && e.parent == parent && std::string_view( e.data, e.length ) == leaf )
+      {
+        return slot;
+      }
+    }
+  }
+
+  void rehash( std::size_t num_slots )
+  {
+    _slots.assign( num_slots, invalid_id );
+    const auto mask = num_slots - 1u;
+    for ( auto id = 0u; id < _entries.size(); ++id )
+    {
+      auto slot = std::size_t( _entries[id].hash ) & mask;
+      while ( _slots[slot] != invalid_id )
+      {
+        slot = ( slot + 1u ) & mask;
+      }
+      _slots[slot] = id;
+    }
+  }
+
+  char const* allocate( std::string_view s )
+  {
+    if ( s.empty() )
+    {
+      return "";
+    }
+
+    /* long strings get a block of their own to not waste the current one */
+    if ( s.size() > block_size / 4u )
+    {
+      auto& block = _blocks.emplace_back( new char[s.size()] );
+      std::memcpy( block.get(), s.data(), s.size() );
+      _allocated += s.size();
+      return block.get();
+    }
+
+    if ( s.size() > _remaining )
+    {
+      _next = _blocks.emplace_back( new char[block_size] ).get();
+      _remaining = block_size;
+      _allocated += block_size;
+    }
+    auto* data = _next;
+    std::memcpy( data, s.data(), s.size() );
+    _next += s.size();
+    _remaining -= s.size();
+    return data;
+  }
+
+private:
+  bool _compress_prefixes;
+  char _separator;
+
+  std::vector<entry> _entries;
+  std::vector<uint32_t> _slots;
+
+  std::vector<std::unique_ptr<char[]>> _blocks;
+  char* _next{nullptr};
+  std::size_t _remaining{0u};
+  std::size_t _allocated{0u};
+};
+
+} /* namespace mockturtle */
@@ -32,6 +32,12 @@
 
 #pragma once
 
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
 #include <sstream>
 #include <type_traits>
 #include <unordered_map>
@@ -46,6 +52,7 @@
 #include "../io/verilog_reader.hpp"
 #include "../io/write_verilog.hpp"
 #include "../views/topo_view.hpp"
+#include "binary_utils.hpp"
 
 namespace mockturtle
 {
@@ -169,4 +176,519 @@ private:
   std::vector<Key> _output_functions;
 };
 
+namespace detail
+{
+
+/* hash map that is split into shards, each protected by its own lock; new
+ * and modified entries are recorded once until the next flush, such that
+ * they can be written incrementally */
+template<typename Key, typename Value, class Hash = std::hash<Key>, uint32_t NumShards = 64u>
+class sharded_map
+{
+  static_assert( NumShards > 0u && ( NumShards & ( NumShards - 1u ) ) == 0u, "NumShards must be a power of 2" );
+
+public:
+  std::optional<Value> find( Key const& key ) const
+  {
+    auto const& s = shard_of( key );
+    std::shared_lock lock( s.mutex );
+    if ( const auto it = s.map.find( key ); it != s.map.end() )
+    {
+      return it->second.value;
+    }
+    return std::nullopt;
+  }
+
+  bool has( Key const& key ) const
+  {
+    auto const& s = shard_of( key );
+    std::shared_lock lock( s.mutex );
+    return s.map.find( key ) != s.map.end();
+  }
+
+  /* returns false, if the key already exists */
+  bool insert( Key const& key, Value const& value, bool record = true )
+  {
+    auto& s = shard_of( key );
+    std::unique_lock lock( s.mutex );
+    const auto [it, inserted] = s.map.emplace( key, entry{value, record} );
+    if ( inserted && record )
+    {
+      s.pending.push_back( &it->first );
+    }
+    return inserted;
+  }
+
+  void assign( Key const& key, Value const& value, bool record = true )
+  {
+    auto& s = shard_of( key );
+    std::unique_lock lock( s.mutex );
+    auto it = s.map.find( key );
+    if ( it == s.map.end() )
+    {
+      it = s.map.emplace( key, entry{value, false} ).first;
+    }
+    else
+    {
+      it->second.value = value;
+    }
+    if ( record && !it->second.pending )
+    {
+      it->second.pending = true;
+      s.pending.push_back( &it->first );
+    }
+  }
+
+  std::size_t size() const
+  {
+    std::size_t total{0u};
+    for ( auto const& s : shards )
+    {
+      std::shared_lock lock( s.mutex );
+      total += s.map.size();
+    }
+    return total;
+  }
+
+  /* calls fn( key, value ) for all entries (or only recorded entries) and
+   * clears the recorded entries */
+  template<typename Fn>
+  void flush( Fn&& fn, bool only_recorded = true )
+  {
+    for ( auto& s : shards )
+    {
+      std::unique_lock lock( s.mutex );
+      if ( only_recorded )
+      {
+        for ( auto const* key : s.pending )
+        {
+          auto& e = s.map.at( *key );
+          fn( *key, e.value );
+          e.pending = false;
+        }
+      }
+      else
+      {
+        for ( auto& [key, e] : s.map )
+        {
+          fn( key, e.value );
+          e.pending = false;
+        }
+      }
+      s.pending.clear();
+    }
+  }
+
+private:
+  struct entry
+  {
+    Value value;
+    bool pending;
+  };
+
+  struct shard
+  {
+    mutable std::shared_mutex mutex;
+    std::unordered_map<Key, entry, Hash> map;
+
+    /* keys are stable in unordered maps */
+    std::vector<Key const*> pending;
+  };
+
+  shard& shard_of( Key const& key )
+  {
+    return shards[shard_index( key )];
+  }
+
+  shard const& shard_of( Key const& key ) const
+  {
+    return shards[shard_index( key )];
+  }
+
+  static std::size_t shard_index( Key const& key )
+  {
+    /* finalizer of MurmurHash3 to spread bits over shards */
+    uint64_t h = Hash()( key );
+    h ^= h >> 33u;
+    h *= UINT64_C( 0xff51afd7ed558ccd );
+    h ^= h >> 33u;
+    return static_cast<std::size_t>( h & ( NumShards - 1u ) );
+  }
+
+private:
+  std::array<shard, NumShards> shards;
+};
+
+} /* namespace detail */
+
+/*! \brief Thread-safe network cache.
+ *
+ * Stores for each key a small network in terms of inputs, which is encoded
+ * as a list of gates.  In contrast to `network_cache`, the networks are not
+ * stored in a common network, but each entry is self-contained.  Therefore,
+ * entries can be looked up and inserted from multiple threads, and can be
+ * written to and read from binary streams.  The cache is split into shards,
+ * each protected by its own reader-writer lock, such that lookups do not
+ * block each other.
+ *
+ * An entry is a sequence of gates, each given by its kind followed by its
+ * fanin literals, and terminated by the output literal.  Literal `2 * i + c`
+ * refers to the constant for `i = 0`, to input `i - 1` for `1 <= i <= k`,
+ * and to gate `i - k - 1` otherwise, where `k` is the number of inputs, and
+ * `c` indicates complementation.  Supported gates are AND, OR, XOR, MAJ,
+ * XOR3, and ITE.  Other gates are stored as LUTs, if the network implements
+ * `node_function` and `create_node`: the kind is followed by the number of
+ * fanins `l`, the `l` fanin literals, and the truth table in
+ * `max(1, 2^l / 32)` words of 32 bits.
+ */
+template<typename Key, class Hash = std::hash<Key>, uint32_t NumShards = 64u>
+class concurrent_network_cache
+{
+public:
+  using entry_t = std::vector<uint32_t>;
+
+  enum gate_kind : uint32_t
+  {
+    gate_and = 0u,
+    gate_or,
+    gate_xor,
+    gate_maj,
+    gate_xor3,
+    gate_ite,
+    gate_lut
+  };
+
+  bool has( Key const& key ) const
+  {
+    return _map.has( key );
+  }
+
+  std::optional<entry_t> find( Key const& key ) const
+  {
+    return _map.find( key );
+  }
+
+  bool insert( Key const& key, entry_t const& entry, bool record = true )
+  {
+    return _map.insert( key, entry, record );
+  }
+
+  std::size_t size() const
+  {
+    return _map.size();
+  }
+
+  /*! \brief Inserts the function of `f` in terms of inputs `begin` to `end`.
+   *
+   * Returns false, if the key already exists, or if the cone of `f` is not
+   * bounded by the inputs, or contains more than `max_gates` gates or
+   * unsupported gates.
+   */
+  template<class Ntk, typename Iterator>
+  bool insert_signal( Ntk const& ntk, Key const& key, signal<Ntk> const& f, Iterator begin, Iterator end, uint32_t max_gates = 1000u )
+  {
+    if ( _map.has( key ) )
+    {
+      return false;
+    }
+    if ( const auto entry = encode( ntk, f, begin, end, max_gates ); entry )
+    {
+      return _map.insert( key, *entry );
+    }
+    return false;
+  }
+
+  /*! \brief Creates the network of an entry in terms of inputs `begin` to `end`. */
+  template<class Ntk, typename Iterator>
+  std::optional<signal<Ntk>> get( Ntk& ntk, Key const& key, Iterator begin, Iterator end ) const
+  {
+    if ( const auto entry = _map.find( key ); entry )
+    {
+      return decode( ntk, *entry, begin, end );
+    }
+    return std::nullopt;
+  }
+
+  /*! \brief Calls `fn( key, entry )` for new (or all) entries. */
+  template<typename Fn>
+  void flush( Fn&& fn, bool only_new = true )
+  {
+    _map.flush( fn, only_new );
+  }
+
+  template<class Ntk, typename Iterator>
+  static std::optional<entry_t> encode( Ntk const& ntk, signal<Ntk> const& f, Iterator begin, Iterator end, uint32_t max_gates = 1000u )
+  {
+    const auto num_inputs = static_cast<uint32_t>( std::distance( begin, end ) );
+
+    std::unordered_map<node<Ntk>, uint32_t> literals;
+    literals[ntk.get_node( ntk.get_constant( false ) )] = 0u;
+    uint32_t i{1u};
+    for ( auto it = begin; it != end; ++it, ++i )
+    {
+      if ( !ntk.is_constant( ntk.get_node( *it ) ) )
+      {
+        literals.emplace( ntk.get_node( *it ), 2u * i + ( ntk.is_complemented( *it ) ? 1u : 0u ) );
+      }
+    }
+
+    entry_t entry;
+    uint32_t num_gates{0u};
+    const auto lit = encode_rec( ntk, ntk.get_node( f ), literals, entry, num_inputs, num_gates, max_gates );
+    if ( !lit )
+    {
+      return std::nullopt;
+    }
+    entry.push_back( *lit ^ ( ntk.is_complemented( f ) ? 1u : 0u ) );
+    return entry;
+  }
+
+  template<class Ntk, typename Iterator>
+  static std::optional<signal<Ntk>> decode( Ntk& ntk, entry_t const& entry, Iterator begin, Iterator end )
+  {
+    std::vector<signal<Ntk>> signals( 1u, ntk.get_constant( false ) );
+    std::copy( begin, end, std::back_inserter( signals ) );
+
+    const auto to_signal = [&]( uint32_t lit ) -> std::optional<signal<Ntk>> {
+      if ( ( lit >> 1u ) >= signals.size() )
+      {
+        return std::nullopt;
+      }
+      return ( lit & 1u ) ? ntk.create_not( signals[lit >> 1u] ) : signals[lit >> 1u];
+    };
+
+    if ( entry.empty() )
+    {
+      return std::nullopt;
+    }
+
+    std::size_t pos = 0u;
+    std::vector<signal<Ntk>> fanins;
+    while ( pos + 1u < entry.size() )
+    {
+      const auto kind = entry[pos++];
+      if ( kind > gate_lut )
+      {
+        return std::nullopt;
+      }
+      if ( kind == gate_lut && ( pos >= entry.size() || entry[pos] > max_lut_size ) )
+      {
+        return std::nullopt;
+      }
+      const auto arity = kind == gate_lut ? entry[pos++] : ( kind <= gate_xor ? 2u : 3u );
+      const auto num_words = kind == gate_lut ? lut_words( arity ) : 0u;
+      if ( pos + arity + num_words >= entry.size() )
+      {
+        return std::nullopt;
+      }
+
+      fanins.clear();
+      for ( auto j = 0u; j < arity; ++j )
+      {
+        const auto s = to_signal( entry[pos++] );
+        if ( !s )
+        {
+          return std::nullopt;
+        }
+        fanins.push_back( *s );
+      }
+
+      std::optional<signal<Ntk>> g;
+      if ( kind == gate_lut )
+      {
+        g = create_lut( ntk, fanins, entry.begin() + pos );
+        pos += num_words;
+      }
+      else
+      {
+        g = create_gate( ntk, kind, fanins );
+      }
+      if ( !g )
+      {
+        return std::nullopt;
+      }
+      signals.push_back( *g );
+    }
+
+    return to_signal( entry.back() );
+  }
+
+private:
+  /* LUTs are bounded, such that corrupt entries cannot request large truth tables */
+  static constexpr uint32_t max_lut_size = 16u;
+
+  static uint32_t lut_words( uint32_t num_vars )
+  {
+    return num_vars <= 5u ? 1u : ( 1u << ( num_vars - 5u ) );
+  }
+
+  template<class Ntk>
+  static std::optional<uint32_t> encode_rec( Ntk const& ntk, node<Ntk> const& n, std::unordered_map<node<Ntk>, uint32_t>& literals, entry_t& entry, uint32_t num_inputs, uint32_t& num_gates, uint32_t max_gates )
+  {
+    if ( const auto it = literals.find( n ); it != literals.end() )
+    {
+      return it->second;
+    }
+    if constexpr ( has_constant_value_v<Ntk> )
+    {
+      /* networks with a separate node for constant 1 */
+      if ( ntk.is_constant( n ) )
+      {
+        return ntk.constant_value( n ) ? 1u : 0u;
+      }
+    }
+    if ( ntk.is_pi( n ) || num_gates == max_gates )
+    {
+      return std::nullopt;
+    }
+
+    std::vector<uint32_t> fanins;
+    bool success{true};
+    ntk.foreach_fanin( n, [&]( auto const& c ) {
+      const auto lit = encode_rec( ntk, ntk.get_node( c ), literals, entry, num_inputs, num_gates, max_gates );
+      if ( !lit )
+      {
+        success = false;
+        return false;
+      }
+      fanins.push_back( *lit ^ ( ntk.is_complemented( c ) ? 1u : 0u ) );
+      return true;
+    } );
+
+    if ( !success )
+    {
+      return std::nullopt;
+    }
+
+    if ( const auto kind = gate_kind_of( ntk, n ); kind && fanins.size() == ( *kind <= gate_xor ? 2u : 3u ) )
+    {
+      entry.push_back( *kind );
+      entry.insert( entry.end(), fanins.begin(), fanins.end() );
+    }
+    else if constexpr ( has_node_function_v<Ntk> && has_create_node_v<Ntk> )
+    {
+      if ( fanins.size() > max_lut_size )
+      {
+        return std::nullopt;
+      }
+
+      const auto function = ntk.node_function( n );
+      entry.push_back( gate_lut );
+      entry.push_back( static_cast<uint32_t>( fanins.size() ) );
+      entry.insert( entry.end(), fanins.begin(), fanins.end() );
+      for ( auto w = 0u; w < lut_words( function.num_vars() ); ++w )
+      {
+        const auto word = function.num_vars() <= 5u ? *function.begin() : *( function.begin() + w / 2u ) >> ( 32u * ( w % 2u ) );
+        entry.push_back( static_cast<uint32_t>( word ) );
+      }
+    }
+    else
+    {
+      return std::nullopt;
+    }
+
+    const auto lit = 2u * ( num_inputs + 1u + num_gates++ );
+    literals.emplace( n, lit );
+    return lit;
+  }
+
+  template<class Ntk>
+  static std::optional<uint32_t> gate_kind_of( Ntk const& ntk, node<Ntk> const& n )
+  {
+    if constexpr ( has_is_and_v<Ntk> )
+    {
+      if ( ntk.is_and( n ) )
+        return gate_and;
+    }
+    if constexpr ( has_is_or_v<Ntk> )
+    {
+      if ( ntk.is_or( n ) )
+        return gate_or;
+    }
+    if constexpr ( has_is_xor_v<Ntk> )
+    {
+      if ( ntk.is_xor( n ) )
+        return gate_xor;
+    }
+    if constexpr ( has_is_maj_v<Ntk> )
+    {
+      if ( ntk.is_maj( n ) )
+        return gate_maj;
+    }
+    if constexpr ( has_is_xor3_v<Ntk> )
+    {
+      if ( ntk.is_xor3( n ) )
+        return gate_xor3;
+    }
+    if constexpr ( has_is_ite_v<Ntk> )
+    {
+      if ( ntk.is_ite( n ) )
+        return gate_ite;
+    }
+    (void)ntk;
+    (void)n;
+    return std::nullopt;
+  }
+
+  template<class Ntk, typename WordIterator>
+  static std::optional<signal<Ntk>> create_lut( Ntk& ntk, std::vector<signal<Ntk>> const& fanins, WordIterator words )
+  {
+    if constexpr ( has_create_node_v<Ntk> )
+    {
+      kitty::dynamic_truth_table function( static_cast<uint32_t>( fanins.size() ) );
+      for ( auto w = 0u; w < lut_words( function.num_vars() ); ++w, ++words )
+      {
+        *( function.begin() + w / 2u ) |= static_cast<uint64_t>( *words ) << ( 32u * ( w % 2u ) );
+      }
+      function.mask_bits();
+      return ntk.create_node( fanins, function );
+    }
+    else
+    {
+      (void)ntk;
+      (void)fanins;
+      (void)words;
+      return std::nullopt;
+    }
+  }
+
+  template<class Ntk>
+  static std::optional<signal<Ntk>> create_gate( Ntk& ntk, uint32_t kind, std::vector<signal<Ntk>> const& fanins )
+  {
+    switch ( kind )
+    {
+    case gate_and:
+      if constexpr ( has_create_and_v<Ntk> )
+        return ntk.create_and( fanins[0], fanins[1] );
+      break;
+    case gate_or:
+      if constexpr ( has_create_or_v<Ntk> )
+        return ntk.create_or( fanins[0], fanins[1] );
+      break;
+    case gate_xor:
+      if constexpr ( has_create_xor_v<Ntk> )
+        return ntk.create_xor( fanins[0], fanins[1] );
+      break;
+    case gate_maj:
+      if constexpr ( has_create_maj_v<Ntk> )
+        return ntk.create_maj( fanins[0], fanins[1], fanins[2] );
+      break;
+    case gate_xor3:
+      if constexpr ( has_create_xor3_v<Ntk> )
+        return ntk.create_xor3( fanins[0], fanins[1], fanins[2] );
+      break;
+    case gate_ite:
+      if constexpr ( has_create_ite_v<Ntk> )
+        return ntk.create_ite( fanins[0], fanins[1], fanins[2] );
+      break;
+    }
+    (void)ntk;
+    (void)fanins;
+    return std::nullopt;
+  }
+
+private:
+  detail::sharded_map<Key, entry_t, Hash, NumShards> _map;
+};
+
 } /* namespace mockturtle */
@@ -0,0 +1,133 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2019  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file npn4_classes.hpp
+  \brief Shared NPN classification of all 4-input functions
+*/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+#include <kitty/static_truth_table.hpp>
+
+#include "detail/npn4_constants.hpp"
+
+namespace mockturtle
+{
+
+/*! \brief NPN classification of all 4-input functions.
+ *
+ * The table assigns each of the 65,536 4-input functions its NPN class, the
+ * class representative, and an NPN transformation from the representative to
+ * the function.  Representatives and transformations are the ones computed by
+ * `kitty::exact_npn_canonization`, i.e., `kitty::create_from_npn_config`
+ * applied to the result of `canonization` returns the original function, and
+ * functions with symmetries get the same transformation as from kitty.
+ *
+ * The classification is precomputed and stored as constant data, so the
+ * shared object returned by `get` is available without any canonization at
+ * runtime.  All lookups are constant-time and can be performed concurrently.
+ *
+   \verbatim embed:rst
+
+   Example
+
+   .. code-block:: c++
+
+      auto const& classes = npn4_classes::get();
+
+      kitty::static_truth_table<4> tt;
+      kitty::create_from_hex_string( tt, "1ee1" );
+
+      const auto [repr, phase, perm] = classes.canonization( tt );
+      const auto index = classes.class_index( tt ); // between 0 and 221
+   \endverbatim
+ */
+class npn4_classes
+{
+public:
+  using truth_table_t = kitty::static_truth_table<4u>;
+
+  /*! \brief Returns the shared table. */
+  static npn4_classes const& get()
+  {
+    static const npn4_classes classes;
+    return classes;
+  }
+
+  /*! \brief Number of NPN classes (222). */
+  uint32_t num_classes() const
+  {
+    return static_cast<uint32_t>( _repr.size() );
+  }
+
+  /*! \brief Index of the NPN class of `tt`. */
+  uint32_t class_index( truth_table_t const& tt ) const
+  {
+    return detail::npn4_entries[*tt.cbegin()] & 0xff;
+  }
+
+  /*! \brief Representative of the class with index `index`. */
+  truth_table_t const& representative( uint32_t index ) const
+  {
+    return _repr[index];
+  }
+
+  /*! \brief Representative of the NPN class of `tt`. */
+  truth_table_t const& representative( truth_table_t const& tt ) const
+  {
+    return _repr[class_index( tt )];
+  }
+
+  /*! \brief Returns the NPN configuration of `tt`.
+   *
+   * The result has the same format as `kitty::exact_npn_canonization`.
+   */
+  std::tuple<truth_table_t, uint32_t, std::vector<uint8_t>> canonization( truth_table_t const& tt ) const
+  {
+    const auto e = detail::npn4_entries[*tt.cbegin()];
+    auto const& perm = detail::npn4_permutations[e >> 13];
+    return {_repr[e & 0xff], ( e >> 8 ) & 0x1f, std::vector<uint8_t>( perm, perm + 4 )};
+  }
+
+private:
+  npn4_classes()
+  {
+    for ( auto i = 0u; i < _repr.size(); ++i )
+    {
+      *_repr[i].begin() = detail::npn4_representatives[i];
+    }
+  }
+
+private:
+  std::array<truth_table_t, sizeof( detail::npn4_representatives ) / sizeof( detail::npn4_representatives[0] )> _repr;
+};
+
+} /* namespace mockturtle */
@@ -0,0 +1,137 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2019  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file output_buffer.hpp
+  \brief Buffered output for writers
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace mockturtle
+{
+
+/*! \brief Output buffer that is flushed to a stream with raw writes.
+ *
+ * Strings, characters, and integers are formatted into a reusable buffer,
+ * which is written to the stream whenever it is full and on destruction.
+ * Writers use it to avoid temporary strings and formatted stream output
+ * for each node.
+ */
+class output_buffer
+{
+public:
+  /*! \brief Creates a buffer of `capacity` bytes for `os`. */
+  explicit output_buffer( std::ostream& os, std::size_t capacity = 1u << 16u )
+      : os( os ), buffer( capacity > 0u ? capacity : 1u )
+  {
+  }
+
+  output_buffer( output_buffer const& ) = delete;
+  output_buffer& operator=( output_buffer const& ) = delete;
+
+  ~output_buffer()
+  {
+    flush();
+  }
+
+  output_buffer& operator<<( std::string_view s )
+  {
+    if ( s.size() > buffer.size() - size )
+    {
+      flush();
+      if ( s.size() > buffer.size() )
+      {
+        os.write( s.data(), s.size() );
+        return *this;
+      }
+    }
+    std::memcpy( buffer.data() + size, s.data(), s.size() );
+    size += s.size();
+    return *this;
+  }
+
+  output_buffer& operator<<( char c )
+  {
+    if ( size == buffer.size() )
+    {
+      flush();
+    }
+    buffer[size++] = c;
+    return *this;
+  }
+
+  /*! \brief Appends an integer in decimal notation. */
+  template<typename T, typename = std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, char> && !std::is_same_v<T, bool>>>
+  output_buffer& operator<<( T value )
+  {
+    char digits[24];
+    auto pos = sizeof( digits );
+
+    using unsigned_t = std::make_unsigned_t<T>;
+    auto v = static_cast<unsigned_t>( value );
+    const bool negative = std::is_signed_v<T> && value < 0;
+    if ( negative )
+    {
+      v = static_cast<unsigned_t>( 0u - v );
+    }
+
+    do
+    {
+      digits[--pos] = static_cast<char>( '0' + v % 10u );
+      v /= 10u;
+    } while ( v != 0u );
+    if ( negative )
+    {
+      digits[--pos] = '-';
+    }
+
+    return *this << std::string_view( digits + pos, sizeof( digits ) - pos );
+  }
+
+  /*! \brief Writes the buffered bytes to the stream. */
+  void flush()
+  {
+    if ( size > 0u )
+    {
+      os.write( buffer.data(), size );
+      size = 0u;
+    }
+  }
+
+private:
+  std::ostream& os;
+  std::vector<char> buffer;
+  std::size_t size{0u};
+};
+
+} /* namespace mockturtle */
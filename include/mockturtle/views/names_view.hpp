@@ -33,12 +33,26 @@
 #pragma once
 
 #include "../traits.hpp"
+#include "../utils/name_table.hpp"
 
-#include <map>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace mockturtle
 {
 
+/*! \brief Assigns names to signals and outputs.
+ *
+ * The names are interned in a `name_table`, such that the view only stores
+ * 32-bit name ids per signal and output.  Since the table is not
+ * thread-safe, copies of the view have their own copy of the table.  A table
+ * can be shared explicitly with other views or with a `NameMap` by passing
+ * it in the constructor, in which case these must not be used concurrently.
+ */
 template<class Ntk>
 class names_view : public Ntk
 {
@@ -48,13 +62,14 @@ public:
   using signal = typename Ntk::signal;
 
 public:
-  names_view( Ntk const& ntk = Ntk() )
-    : Ntk( ntk )
+  names_view( Ntk const& ntk = Ntk(), std::shared_ptr<name_table> names = std::make_shared<name_table>() )
+    : Ntk( ntk ), _names( names )
   {
   }
 
   names_view( names_view<Ntk> const& named_ntk )
     : Ntk( named_ntk )
+    , _names( std::make_shared<name_table>( *named_ntk._names ) )
     , _signal_names( named_ntk._signal_names )
     , _output_names( named_ntk._output_names )
   {
@@ -62,7 +77,7 @@ public:
 
   names_view<Ntk>& operator=( names_view<Ntk> const& named_ntk )
   {
-    std::map<signal, std::string> new_signal_names;
+    std::unordered_map<signal, uint32_t> new_signal_names;
     std::vector<signal> current_pis;
     Ntk::foreach_pi( [&]( auto const& n ) {
         current_pis.emplace_back( Ntk::make_signal( n ) );
@@ -104,32 +119,57 @@ public:
 
   void set_name( signal const& s, std::string const& name )
   {
-    _signal_names[s] = name;
+    _signal_names[s] = _names->insert( name );
   }
 
   std::string get_name( signal const& s ) const
   {
-    return _signal_names.at( s );
+    return _names->str( _signal_names.at( s ) );
   }
 
   bool has_output_name( uint32_t index ) const
   {
-    return ( _output_names.find( index ) != _output_names.end() );
+    return index < _output_names.size() && _output_names[index] != name_table::invalid_id;
   }
 
   void set_output_name( uint32_t index, std::string const& name )
   {
-    _output_names[index] = name;
+    if ( index >= _output_names.size() )
+    {
+      _output_names.resize( index + 1, name_table::invalid_id );
+    }
+    _output_names[index] = _names->insert( name );
   }
 
   std::string get_output_name( uint32_t index ) const
   {
-    return _output_names.at( index );
+    if ( !has_output_name( index ) )
+    {
+      throw std::out_of_range( "output has no name" );
+    }
+    return _names->str( _output_names[index] );
+  }
+
+  /*! \brief Removes the names of all signals and outputs.
+   *
+   * The names remain in the name table.
+   */
+  void clear_names()
+  {
+    _signal_names.clear();
+    _output_names.clear();
+  }
+
+  /*! \brief Returns the table in which the names are interned. */
+  std::shared_ptr<name_table> const& get_name_table() const
+  {
+    return _names;
   }
 
 private:
-  std::map<signal, std::string> _signal_names;
-  std::map<uint32_t, std::string> _output_names;
+  std::shared_ptr<name_table> _names;
+  std::unordered_map<signal, uint32_t> _signal_names;
+  std::vector<uint32_t> _output_names;
 }; /* names_view */
 
 template<class T>
@@ -7,6 +7,7 @@
 #include <mockturtle/algorithms/cut_enumeration.hpp>
 #include <mockturtle/networks/aig.hpp>
 #include <mockturtle/networks/klut.hpp>
+#include <mockturtle/views/fanout_view.hpp>
 
 using namespace mockturtle;
 
@@ -329,3 +330,74 @@ TEST_CASE( "enumerate smaller cuts for an AIG (small graph version)", "[fast_sma
   CHECK( bitcut_to_vector( cuts.at( i4 )[1] ) == std::vector<uint32_t>{ 4, 5 } );
   CHECK( bitcut_to_vector( cuts.at( i4 )[2] ) == std::vector<uint32_t>{ 6 } );
 }
+
+TEST_CASE( "incrementally update cuts after substitution", "[cut_enumeration]" )
+{
+  fanout_view<aig_network> aig;
+
+  const auto a = aig.create_pi();
+  const auto b = aig.create_pi();
+  const auto c = aig.create_pi();
+  const auto d = aig.create_pi();
+
+  const auto g = aig.create_and( a, c );
+  const auto f1 = aig.create_and( a, b );
+  const auto f2 = aig.create_and( f1, c );
+  const auto f3 = aig.create_and( f2, d );
+  const auto f4 = aig.create_and( b, d );
+  aig.create_po( f3 );
+  aig.create_po( g );
+  aig.create_po( f4 );
+
+  incremental_network_cuts<fanout_view<aig_network>, true> cuts( aig );
+  CHECK( cuts.is_up_to_date() );
+
+  aig.substitute_node( aig.get_node( f1 ), g );
+  CHECK( !cuts.is_up_to_date() );
+  CHECK( cuts.update() > 0u );
+  CHECK( cuts.is_up_to_date() );
+
+  /* compare with cuts from scratch */
+  const auto ref = cut_enumeration<fanout_view<aig_network>, true>( aig );
+  aig.foreach_node( [&]( auto n ) {
+    if ( aig.is_dead( n ) )
+      return;
+
+    const auto i = aig.node_to_index( n );
+    REQUIRE( cuts.cuts( i ).size() == ref.cuts( i ).size() );
+    for ( auto j = 0u; j < ref.cuts( i ).size(); ++j )
+    {
+      CHECK( std::vector<uint32_t>( cuts.cuts( i )[j].begin(), cuts.cuts( i )[j].end() ) == std::vector<uint32_t>( ref.cuts( i )[j].begin(), ref.cuts( i )[j].end() ) );
+      CHECK( cuts.truth_table( cuts.cuts( i )[j] ) == ref.truth_table( ref.cuts( i )[j] ) );
+    }
+  } );
+
+  /* new node */
+  const auto f5 = aig.create_and( f3, f4 );
+  aig.create_po( f5 );
+  cuts.update();
+  CHECK( cuts.nodes_size() == aig.size() );
+  CHECK( cuts.cuts( aig.node_to_index( aig.get_node( f5 ) ) ).size() > 1 );
+}
+
+TEST_CASE( "incrementally update cuts of a long chain", "[cut_enumeration]" )
+{
+  fanout_view<aig_network> aig;
+
+  const auto a = aig.create_pi();
+  const auto b = aig.create_pi();
+
+  incremental_network_cuts<fanout_view<aig_network>> cuts( aig );
+
+  /* all nodes of the chain are marked, the last one is updated first */
+  auto f = aig.create_and( a, b );
+  for ( auto i = 0u; i < 5000u; ++i )
+  {
+    f = aig.create_and( f, ( i & 1 ) ? a : b );
+  }
+  aig.create_po( f );
+
+  CHECK( cuts.update() == 5001u );
+  CHECK( cuts.is_up_to_date() );
+  CHECK( cuts.nodes_size() == aig.size() );
+}
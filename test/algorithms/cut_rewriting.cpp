@@ -1,5 +1,7 @@
 #include <catch.hpp>
 
+#include <kitty/static_truth_table.hpp>
+
 #include <mockturtle/algorithms/cut_rewriting.hpp>
 #include <mockturtle/algorithms/node_resynthesis/akers.hpp>
 #include <mockturtle/algorithms/node_resynthesis/exact.hpp>
@@ -7,6 +9,8 @@
 #include <mockturtle/algorithms/node_resynthesis/xag_minmc2.hpp>
 #include <mockturtle/algorithms/node_resynthesis/xag_npn.hpp>
 #include <mockturtle/algorithms/node_resynthesis/xmg3_npn.hpp>
+#include <mockturtle/algorithms/simulation.hpp>
+#include <mockturtle/generators/arithmetic.hpp>
 #include <mockturtle/views/fanout_view.hpp>
 #include <mockturtle/networks/aig.hpp>
 #include <mockturtle/networks/klut.hpp>
@@ -461,3 +465,157 @@ TEST_CASE( "Cut rewriting with stacked depth-fanout views", "[cut_rewriting]" )
   CHECK( aig.num_pos() == 2 );
   CHECK( aig.num_gates() == 8 );
 }
+
+TEST_CASE( "DAG-aware cut rewriting of bad MAJ", "[cut_rewriting]" )
+{
+  mig_network mig;
+  const auto a = mig.create_pi();
+  const auto b = mig.create_pi();
+  const auto c = mig.create_pi();
+
+  const auto f = mig.create_maj( a, mig.create_maj( a, b, c ), c );
+  mig.create_po( f );
+
+  mig_npn_resynthesis resyn;
+  dag_aware_cut_rewriting( mig, resyn );
+
+  mig = cleanup_dangling( mig );
+
+  CHECK( mig.size() == 5 );
+  CHECK( mig.num_pis() == 3 );
+  CHECK( mig.num_pos() == 1 );
+  CHECK( mig.num_gates() == 1 );
+}
+
+TEST_CASE( "DAG-aware cut rewriting of AIG preserves functionality", "[cut_rewriting]" )
+{
+  aig_network aig;
+  const auto x0 = aig.create_pi();
+  const auto x1 = aig.create_pi();
+  const auto x2 = aig.create_pi();
+  const auto x3 = aig.create_pi();
+
+  /* redundant conjunctions */
+  const auto n0 = aig.create_and( x0, x1 );
+  const auto n1 = aig.create_and( x0, x2 );
+  const auto n2 = aig.create_and( x1, x3 );
+  const auto n3 = aig.create_and( x2, x3 );
+  aig.create_po( aig.create_and( n0, n1 ) );
+  aig.create_po( aig.create_and( n2, n3 ) );
+
+  const auto tts = simulate<kitty::static_truth_table<4>>( aig );
+  CHECK( aig.num_gates() == 6u );
+
+  xag_npn_resynthesis<aig_network> resyn;
+  cut_rewriting_stats st;
+  dag_aware_cut_rewriting( aig, resyn, {}, &st );
+  aig = cleanup_dangling( aig );
+
+  CHECK( aig.num_gates() == 4u );
+  CHECK( simulate<kitty::static_truth_table<4>>( aig ) == tts );
+}
+
+TEST_CASE( "DAG-aware cut rewriting finds gain missed by cut rewriting", "[cut_rewriting]" )
+{
+  const auto make_multiplier = []() {
+    aig_network aig;
+    std::vector<aig_network::signal> a( 2 ), b( 2 );
+    std::generate( a.begin(), a.end(), [&]() { return aig.create_pi(); } );
+    std::generate( b.begin(), b.end(), [&]() { return aig.create_pi(); } );
+    for ( auto const& f : carry_ripple_multiplier( aig, a, b ) )
+    {
+      aig.create_po( f );
+    }
+    return aig;
+  };
+
+  xag_npn_resynthesis<aig_network> resyn;
+  cut_rewriting_params ps;
+  ps.cut_enumeration_ps.cut_size = 4;
+
+  auto aig1 = make_multiplier();
+  const auto tts = simulate<kitty::static_truth_table<4>>( aig1 );
+  CHECK( aig1.num_gates() == 10u );
+  aig1 = cut_rewriting( aig1, resyn, ps );
+  aig1 = cleanup_dangling( aig1 );
+
+  auto aig2 = make_multiplier();
+  cut_rewriting_stats st;
+  dag_aware_cut_rewriting( aig2, resyn, ps, &st );
+  aig2 = cleanup_dangling( aig2 );
+
+  CHECK( aig1.num_gates() == 9u );
+  CHECK( aig2.num_gates() == 8u );
+  CHECK( st.total_gain == 2u );
+  CHECK( simulate<kitty::static_truth_table<4>>( aig1 ) == tts );
+  CHECK( simulate<kitty::static_truth_table<4>>( aig2 ) == tts );
+}
+
+TEST_CASE( "DAG-aware cut rewriting after nodes are merged by structural hashing", "[cut_rewriting]" )
+{
+  aig_network aig;
+  std::vector<aig_network::signal> x( 5 );
+  std::generate( x.begin(), x.end(), [&]() { return aig.create_pi(); } );
+
+  /* substitutions merge fanouts with existing nodes, which must still be referenced */
+  const auto n6 = aig.create_and( x[1], !x[2] );
+  const auto n7 = aig.create_and( x[4], n6 );
+  const auto n8 = aig.create_and( x[4], n7 );
+  aig.create_po( aig.create_and( x[4], !n8 ) );
+  aig.create_po( aig.get_constant( false ) );
+  aig.create_po( aig.create_and( x[4], !n7 ) );
+
+  const auto tts = simulate<kitty::static_truth_table<5>>( aig );
+  CHECK( aig.num_gates() == 5u );
+
+  xag_npn_resynthesis<aig_network> resyn;
+  cut_rewriting_params ps;
+  ps.cut_enumeration_ps.cut_size = 4;
+  cut_rewriting_stats st;
+  dag_aware_cut_rewriting( aig, resyn, ps, &st );
+  aig = cleanup_dangling( aig );
+
+  CHECK( aig.num_gates() == 2u );
+  CHECK( st.total_gain == 2u );
+  CHECK( simulate<kitty::static_truth_table<5>>( aig ) == tts );
+}
+
+TEST_CASE( "Cut rewriting with compatibility graph and parallel candidate evaluation", "[cut_rewriting]" )
+{
+  const auto make_multiplier = []() {
+    xag_network xag;
+    std::vector<xag_network::signal> a( 4 ), b( 4 );
+    std::generate( a.begin(), a.end(), [&]() { return xag.create_pi(); } );
+    std::generate( b.begin(), b.end(), [&]() { return xag.create_pi(); } );
+    for ( auto const& f : carry_ripple_multiplier( xag, a, b ) )
+    {
+      xag.create_po( f );
+    }
+    return xag;
+  };
+
+  xag_npn_resynthesis<xag_network> resyn;
+  cut_rewriting_params ps;
+  ps.cut_enumeration_ps.cut_size = 4;
+
+  auto xag1 = make_multiplier();
+  const auto tts = simulate<kitty::static_truth_table<8>>( xag1 );
+  const auto size_before = xag1.num_gates();
+  cut_rewriting_stats st1;
+  cut_rewriting_with_compatibility_graph( xag1, resyn, ps, &st1 );
+  xag1 = cleanup_dangling( xag1 );
+
+  auto xag2 = make_multiplier();
+  ps.num_threads = 4u;
+  cut_rewriting_stats st2;
+  cut_rewriting_with_compatibility_graph( xag2, resyn, ps, &st2 );
+  xag2 = cleanup_dangling( xag2 );
+
+  /* the candidates were evaluated on copies of the network in 4 threads */
+  CHECK( st1.num_threads == 1u );
+  CHECK( st2.num_threads == 4u );
+  CHECK( xag1.num_gates() < size_before );
+  CHECK( xag2.num_gates() == xag1.num_gates() );
+  CHECK( simulate<kitty::static_truth_table<8>>( xag1 ) == tts );
+  CHECK( simulate<kitty::static_truth_table<8>>( xag2 ) == tts );
+}
@@ -1,10 +1,16 @@
 #include <catch.hpp>
 
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
 #include <kitty/static_truth_table.hpp>
 
 #include <mockturtle/algorithms/simulation.hpp>
 #include <mockturtle/algorithms/functional_reduction.hpp>
 #include <mockturtle/algorithms/cleanup.hpp>
+#include <mockturtle/generators/arithmetic.hpp>
+#include <mockturtle/io/binary_patterns.hpp>
 #include <mockturtle/networks/aig.hpp>
 #include <mockturtle/networks/mig.hpp>
 #include <mockturtle/networks/xag.hpp>
@@ -129,3 +135,46 @@ TEST_CASE( "functional reduction on XMG", "[functional_reduction]" )
   CHECK( ntk.size() == 9 );
   CHECK( vals == simulate<kitty::static_truth_table<4>>( ntk ) );
 }
+
+TEST_CASE( "functional reduction appends counter-examples to a binary pattern file", "[functional_reduction]" )
+{
+  aig_network ntk;
+
+  std::vector<aig_network::signal> a( 4u ), b( 4u );
+  std::generate( a.begin(), a.end(), [&]() { return ntk.create_pi(); } );
+  std::generate( b.begin(), b.end(), [&]() { return ntk.create_pi(); } );
+  for ( auto const& f : carry_ripple_multiplier( ntk, a, b ) )
+  {
+    ntk.create_po( f );
+  }
+
+  /* two patterns do not distinguish most nodes */
+  partial_simulator loaded( 8u, 0u );
+  loaded.add_pattern( std::vector<bool>( 8u, false ) );
+  loaded.add_pattern( {true, false, true, false, false, true, false, true} );
+  CHECK( write_binary_patterns( loaded, "mockturtle-test-fraig.bpat" ) );
+
+  const auto vals = simulate<kitty::static_truth_table<8>>( ntk );
+
+  functional_reduction_params ps;
+  ps.pattern_filename = "mockturtle-test-fraig.bpat";
+  ps.save_patterns = "mockturtle-test-fraig.bpat";
+  ps.binary_patterns = true;
+  functional_reduction_stats st;
+  functional_reduction( ntk, ps, &st );
+  CHECK( vals == simulate<kitty::static_truth_table<8>>( ntk ) );
+
+  /* the counter-examples are appended to the loaded patterns */
+  partial_simulator saved( "mockturtle-test-fraig.bpat" );
+  CHECK( st.num_cex > 0u );
+  CHECK( saved.num_bits() == 2u + st.num_cex );
+  REQUIRE( saved.get_patterns().size() == 8u );
+  for ( auto i = 0u; i < 8u; ++i )
+  {
+    auto prefix = saved.get_patterns()[i];
+    prefix.resize( 2 );
+    CHECK( prefix == loaded.get_patterns()[i] );
+  }
+
+  std::remove( "mockturtle-test-fraig.bpat" );
+}
@@ -0,0 +1,178 @@
+#include <catch.hpp>
+
+#include <vector>
+
+#include <mockturtle/algorithms/cut_enumeration.hpp>
+#include <mockturtle/algorithms/cut_enumeration/mf_cut.hpp>
+#include <mockturtle/algorithms/lazy_cut_enumeration.hpp>
+#include <mockturtle/generators/arithmetic.hpp>
+#include <mockturtle/networks/aig.hpp>
+#include <mockturtle/networks/klut.hpp>
+
+using namespace mockturtle;
+
+template<class Ntk>
+static void check_lazy_cuts( Ntk const& ntk, uint32_t max_cut_sets )
+{
+  cut_enumeration_params ps;
+  const auto ref = cut_enumeration<Ntk, true>( ntk, ps );
+
+  lazy_cut_enumeration_params lps;
+  lps.max_cut_sets = max_cut_sets;
+  lazy_network_cuts<Ntk, true> cuts( ntk, lps );
+
+  /* visit nodes in reverse order to trigger recursive computation */
+  for ( auto i = ntk.size(); i-- > 0; )
+  {
+    auto const& set = cuts.cuts( i );
+    REQUIRE( set.size() == ref.cuts( i ).size() );
+    for ( auto j = 0u; j < set.size(); ++j )
+    {
+      CHECK( std::vector<uint32_t>( set[j].begin(), set[j].end() ) == std::vector<uint32_t>( ref.cuts( i )[j].begin(), ref.cuts( i )[j].end() ) );
+      CHECK( cuts.truth_table( set[j] ) == ref.truth_table( ref.cuts( i )[j] ) );
+    }
+    CHECK( cuts.num_cut_sets() <= max_cut_sets );
+  }
+}
+
+TEST_CASE( "lazy cut enumeration for an AIG", "[lazy_cut_enumeration]" )
+{
+  aig_network aig;
+
+  std::vector<aig_network::signal> a( 4 ), b( 4 );
+  std::generate( a.begin(), a.end(), [&aig]() { return aig.create_pi(); } );
+  std::generate( b.begin(), b.end(), [&aig]() { return aig.create_pi(); } );
+  auto carry = aig.create_pi();
+
+  carry_ripple_adder_inplace( aig, a, b, carry );
+
+  std::for_each( a.begin(), a.end(), [&]( auto f ) { aig.create_po( f ); } );
+  aig.create_po( carry );
+
+  check_lazy_cuts( aig, 1000u );
+  check_lazy_cuts( aig, 8u );
+}
+
+TEST_CASE( "lazy cut enumeration for a k-LUT network", "[lazy_cut_enumeration]" )
+{
+  klut_network klut;
+
+  const auto a = klut.create_pi();
+  const auto b = klut.create_pi();
+  const auto c = klut.create_pi();
+  const auto d = klut.create_pi();
+
+  const auto f1 = klut.create_maj( a, b, c );
+  const auto f2 = klut.create_xor( f1, d );
+  const auto f3 = klut.create_not( f2 );
+  const auto f4 = klut.create_and( f3, a );
+  klut.create_po( f4 );
+
+  check_lazy_cuts( klut, 1000u );
+  check_lazy_cuts( klut, 3u );
+}
+
+TEST_CASE( "lazy cut enumeration statistics", "[lazy_cut_enumeration]" )
+{
+  aig_network aig;
+
+  const auto a = aig.create_pi();
+  const auto b = aig.create_pi();
+  const auto c = aig.create_pi();
+  const auto f1 = aig.create_and( a, b );
+  const auto f2 = aig.create_and( f1, c );
+  aig.create_po( f2 );
+
+  lazy_cut_enumeration_params ps;
+  ps.max_cut_sets = 2u;
+  lazy_network_cuts<aig_network> cuts( aig, ps );
+
+  CHECK( cuts.cuts( aig.node_to_index( aig.get_node( f2 ) ) ).size() == 3u );
+  CHECK( cuts.stats().misses == 5u );
+  CHECK( cuts.num_cut_sets() == 2u );
+  CHECK( cuts.has_cuts( aig.node_to_index( aig.get_node( f2 ) ) ) );
+  CHECK( cuts.stats().evictions == 3u );
+
+  cuts.cuts( aig.node_to_index( aig.get_node( f2 ) ) );
+  CHECK( cuts.stats().hits == 1u );
+}
+
+TEST_CASE( "lazy cut enumeration for a long chain", "[lazy_cut_enumeration]" )
+{
+  aig_network aig;
+
+  const auto a = aig.create_pi();
+  const auto b = aig.create_pi();
+
+  auto f = aig.create_and( a, b );
+  for ( auto i = 0u; i < 200000u; ++i )
+  {
+    f = aig.create_and( f, ( i & 1 ) ? a : b );
+  }
+  aig.create_po( f );
+
+  lazy_cut_enumeration_params ps;
+  ps.max_cut_sets = 16u;
+  lazy_network_cuts<aig_network, true> cuts( aig, ps );
+
+  CHECK( cuts.cuts( aig.node_to_index( aig.get_node( f ) ) ).size() > 1u );
+  CHECK( cuts.stats().misses == aig.size() - 1u );
+  CHECK( cuts.num_cut_sets() <= 16u );
+}
+
+TEST_CASE( "lazy cut enumeration removes unused truth tables", "[lazy_cut_enumeration]" )
+{
+  aig_network aig;
+
+  std::vector<aig_network::signal> a( 6 ), b( 6 );
+  std::generate( a.begin(), a.end(), [&aig]() { return aig.create_pi(); } );
+  std::generate( b.begin(), b.end(), [&aig]() { return aig.create_pi(); } );
+  for ( auto const& f : carry_ripple_multiplier( aig, a, b ) )
+  {
+    aig.create_po( f );
+  }
+
+  check_lazy_cuts( aig, 4u );
+
+  lazy_cut_enumeration_params ps;
+  ps.max_cut_sets = 4u;
+  lazy_network_cuts<aig_network, true> cuts( aig, ps );
+  aig.foreach_node( [&]( auto n ) {
+    cuts.cuts( aig.node_to_index( n ) );
+    CHECK( cuts.num_truth_tables() <= 2u * ps.max_cut_sets * ps.cut_limit );
+  } );
+}
+
+TEST_CASE( "lazy cut enumeration with cut data computed from leaf cuts", "[lazy_cut_enumeration]" )
+{
+  aig_network aig;
+
+  std::vector<aig_network::signal> a( 4 ), b( 4 );
+  std::generate( a.begin(), a.end(), [&aig]() { return aig.create_pi(); } );
+  std::generate( b.begin(), b.end(), [&aig]() { return aig.create_pi(); } );
+  for ( auto const& f : carry_ripple_multiplier( aig, a, b ) )
+  {
+    aig.create_po( f );
+  }
+
+  const auto ref = cut_enumeration<aig_network, false, cut_enumeration_mf_cut>( aig );
+
+  for ( auto max_cut_sets : {1000u, 3u} )
+  {
+    lazy_cut_enumeration_params ps;
+    ps.max_cut_sets = max_cut_sets;
+    lazy_network_cuts<aig_network, false, cut_enumeration_mf_cut> cuts( aig, ps );
+
+    for ( auto i = aig.size(); i-- > 0; )
+    {
+      auto const& set = cuts.cuts( i );
+      REQUIRE( set.size() == ref.cuts( i ).size() );
+      for ( auto j = 0u; j < set.size(); ++j )
+      {
+        CHECK( std::vector<uint32_t>( set[j].begin(), set[j].end() ) == std::vector<uint32_t>( ref.cuts( i )[j].begin(), ref.cuts( i )[j].end() ) );
+        CHECK( set[j]->data.delay == ref.cuts( i )[j]->data.delay );
+        CHECK( set[j]->data.flow == Approx( ref.cuts( i )[j]->data.flow ) );
+      }
+    }
+  }
+}
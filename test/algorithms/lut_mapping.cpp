@@ -1,9 +1,13 @@
 #include <catch.hpp>
 
 #include <mockturtle/traits.hpp>
+#include <mockturtle/algorithms/collapse_mapped.hpp>
 #include <mockturtle/algorithms/lut_mapping.hpp>
+#include <mockturtle/algorithms/simulation.hpp>
 #include <mockturtle/generators/arithmetic.hpp>
 #include <mockturtle/networks/aig.hpp>
+#include <mockturtle/networks/klut.hpp>
+#include <mockturtle/views/depth_view.hpp>
 #include <mockturtle/views/mapping_view.hpp>
 
 using namespace mockturtle;
@@ -141,3 +145,131 @@ TEST_CASE( "LUT mapping with functions of full adder", "[lut_mapping]" )
   CHECK( mapped_aig.cell_function( aig.get_node( sum ) )._bits[0] == 0x96 );
   CHECK( mapped_aig.cell_function( aig.get_node( carry ) )._bits[0] == 0x17 );
 }
+
+TEST_CASE( "LUT mapping with unit LUT library", "[lut_mapping]" )
+{
+  aig_network aig;
+
+  std::vector<aig_network::signal> a( 8 ), b( 8 );
+  std::generate( a.begin(), a.end(), [&aig]() { return aig.create_pi(); } );
+  std::generate( b.begin(), b.end(), [&aig]() { return aig.create_pi(); } );
+  auto carry = aig.get_constant( false );
+
+  carry_ripple_adder_inplace( aig, a, b, carry );
+
+  std::for_each( a.begin(), a.end(), [&]( auto f ) { aig.create_po( f ); } );
+  aig.create_po( carry );
+
+  mapping_view mapped_aig{ aig };
+  lut_mapping_params ps;
+  ps.lut_lib = lut_library();
+  lut_mapping( mapped_aig, ps );
+
+  CHECK( mapped_aig.num_cells() == 12 );
+}
+
+TEST_CASE( "LUT mapping with LUT library", "[lut_mapping]" )
+{
+  aig_network aig;
+
+  const auto a = aig.create_pi();
+  const auto b = aig.create_pi();
+  const auto c = aig.create_pi();
+  const auto d = aig.create_pi();
+  aig.create_po( aig.create_and( aig.create_and( a, b ), aig.create_and( c, d ) ) );
+
+  /* a 4-LUT is more expensive than three 2-LUTs */
+  lut_library lib( 0u );
+  lib.add_lut( 1.0f, 1u );
+  lib.add_lut( 1.0f, 1u );
+  lib.add_lut( 4.0f, 1u );
+  lib.add_lut( 4.0f, 1u );
+
+  mapping_view mapped_aig{ aig };
+  lut_mapping_params ps;
+  lut_mapping_stats st;
+  ps.cut_enumeration_ps.cut_size = 4;
+  ps.lut_lib = lib;
+  lut_mapping( mapped_aig, ps, &st );
+
+  CHECK( mapped_aig.num_cells() == 3 );
+  CHECK( st.area == 3.0f );
+
+  lut_mapping_params ps_unit;
+  ps_unit.cut_enumeration_ps.cut_size = 4;
+  lut_mapping( mapped_aig, ps_unit );
+
+  CHECK( mapped_aig.num_cells() == 1 );
+}
+
+TEST_CASE( "LUT mapping with LUT library smaller than cut size", "[lut_mapping]" )
+{
+  aig_network aig;
+
+  std::vector<aig_network::signal> a( 4 ), b( 4 );
+  std::generate( a.begin(), a.end(), [&aig]() { return aig.create_pi(); } );
+  std::generate( b.begin(), b.end(), [&aig]() { return aig.create_pi(); } );
+  auto carry = aig.get_constant( false );
+
+  carry_ripple_adder_inplace( aig, a, b, carry );
+
+  std::for_each( a.begin(), a.end(), [&]( auto f ) { aig.create_po( f ); } );
+  aig.create_po( carry );
+
+  lut_library lib( 0u );
+  lib.add_lut( 1.0f, 1u );
+  lib.add_lut( 1.0f, 1u );
+  lib.add_lut( 2.0f, 1u );
+
+  /* the default cut size of 6 is reduced to the largest LUT size */
+  mapping_view mapped_aig{ aig };
+  lut_mapping_params ps;
+  lut_mapping_stats st;
+  ps.lut_lib = lib;
+  lut_mapping( mapped_aig, ps, &st );
+
+  float area{0.0f};
+  mapped_aig.foreach_node( [&]( auto n ) {
+    if ( !mapped_aig.is_cell_root( n ) )
+      return;
+    uint32_t size{0u};
+    mapped_aig.foreach_cell_fanin( n, [&]( auto ) { ++size; } );
+    CHECK( size <= 3u );
+    area += lib.area( size );
+  } );
+  CHECK( st.area == area );
+}
+
+TEST_CASE( "LUT mapping with parallel exact area recovery", "[lut_mapping]" )
+{
+  aig_network aig;
+
+  std::vector<aig_network::signal> a( 8 ), b( 8 );
+  std::generate( a.begin(), a.end(), [&aig]() { return aig.create_pi(); } );
+  std::generate( b.begin(), b.end(), [&aig]() { return aig.create_pi(); } );
+  auto carry = aig.get_constant( false );
+
+  carry_ripple_adder_inplace( aig, a, b, carry );
+
+  std::for_each( a.begin(), a.end(), [&]( auto f ) { aig.create_po( f ); } );
+  aig.create_po( carry );
+
+  /* dangling logic */
+  aig.create_and( a[0], b[1] );
+
+  mapping_view<aig_network, true> mapped_aig{ aig };
+  lut_mapping_params ps;
+  lut_mapping_stats st;
+  ps.ela_threads = 4u;
+  lut_mapping<mapping_view<aig_network, true>, true>( mapped_aig, ps, &st );
+
+  CHECK( mapped_aig.num_cells() == 12 );
+  CHECK( st.area == 12.0f );
+
+  const auto klut = collapse_mapped_network<klut_network>( mapped_aig );
+  REQUIRE( klut );
+  CHECK( st.delay == depth_view{*klut}.depth() );
+
+  default_simulator<kitty::static_truth_table<16>> sim;
+  CHECK( simulate<kitty::static_truth_table<16>>( *klut, sim ) == simulate<kitty::static_truth_table<16>>( aig, sim ) );
+}
@@ -1,10 +1,22 @@
 #include <catch.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
 #include <kitty/constructors.hpp>
 #include <kitty/dynamic_truth_table.hpp>
 
 #include <mockturtle/algorithms/node_resynthesis/cached.hpp>
 #include <mockturtle/algorithms/node_resynthesis/exact.hpp>
+#include <mockturtle/algorithms/simulation.hpp>
+#include <mockturtle/networks/klut.hpp>
 #include <mockturtle/networks/xag.hpp>
 
 using namespace mockturtle;
@@ -50,3 +62,327 @@ TEST_CASE( "Exact XAG for MAJ cached", "[cached]" )
   CHECK( !fs::exists( "mockturtle-test-cache.db.bak" ) );
   fs::remove( "mockturtle-test-cache.db" );
 }
+
+namespace
+{
+
+/* counts the calls to the underlying resynthesis function */
+struct counting_resynthesis
+{
+  template<typename LeavesIterator, typename Fn>
+  void operator()( xag_network& xag, kitty::dynamic_truth_table const& function, LeavesIterator begin, LeavesIterator end, Fn&& fn )
+  {
+    ++*calls;
+    resyn( xag, function, begin, end, fn );
+  }
+
+  exact_aig_resynthesis<xag_network> resyn;
+  std::shared_ptr<std::atomic<uint32_t>> calls = std::make_shared<std::atomic<uint32_t>>( 0u );
+};
+
+} // namespace
+
+TEST_CASE( "Binary cache is appended and reloaded", "[cached]" )
+{
+#if __GNUC__ == 7
+  namespace fs = std::experimental::filesystem::v1;
+#else
+  namespace fs = std::filesystem;
+#endif
+
+  const std::string filename = "mockturtle-test-binary-cache.db";
+  fs::remove( filename );
+
+  kitty::dynamic_truth_table maj( 3u ), mux( 3u );
+  kitty::create_majority( maj );
+  kitty::create_from_hex_string( mux, "d8" );
+
+  xag_network xag;
+  std::vector<xag_network::signal> pis( 3u );
+  std::generate( pis.begin(), pis.end(), [&]() { return xag.create_pi(); } );
+
+  counting_resynthesis counter;
+  {
+    cached_resynthesis<xag_network, counting_resynthesis> resyn( counter, 6u, filename );
+    resyn( xag, maj, pis.begin(), pis.end(), [&]( auto const& f ) { xag.create_po( f ); } );
+    resyn.save();
+    const auto size = fs::file_size( filename );
+
+    resyn( xag, mux, pis.begin(), pis.end(), [&]( auto const& f ) { xag.create_po( f ); } );
+    resyn.save();
+    CHECK( fs::file_size( filename ) > size );
+  }
+  CHECK( *counter.calls == 2u );
+
+  /* both entries are found in the file */
+  {
+    cached_resynthesis<xag_network, counting_resynthesis> resyn( counter, 6u, filename );
+    resyn( xag, maj, pis.begin(), pis.end(), [&]( auto const& f ) { xag.create_po( f ); } );
+    resyn( xag, mux, pis.begin(), pis.end(), [&]( auto const& f ) { xag.create_po( f ); } );
+  }
+  CHECK( *counter.calls == 2u );
+
+  default_simulator<kitty::dynamic_truth_table> sim( 3u );
+  const auto tts = simulate<kitty::dynamic_truth_table>( xag, sim );
+  CHECK( tts == std::vector<kitty::dynamic_truth_table>{maj, mux, maj, mux} );
+
+  CHECK( !fs::exists( filename + ".bak" ) );
+  fs::remove( filename );
+}
+
+TEST_CASE( "Cached resynthesis shared between threads", "[cached]" )
+{
+  std::vector<kitty::dynamic_truth_table> functions;
+  for ( auto const& hex : {"e8", "96", "d8", "1e", "78", "6a", "ca", "b2"} )
+  {
+    kitty::dynamic_truth_table tt( 3u );
+    kitty::create_from_hex_string( tt, hex );
+    functions.push_back( tt );
+  }
+
+  counting_resynthesis counter;
+  cached_resynthesis<xag_network, counting_resynthesis> resyn( counter, 6u );
+
+  std::vector<xag_network> xags( 4u );
+  std::vector<std::thread> threads;
+  for ( auto& xag : xags )
+  {
+    threads.emplace_back( [&xag, &functions, resyn]() mutable {
+      std::vector<xag_network::signal> pis( 3u );
+      std::generate( pis.begin(), pis.end(), [&]() { return xag.create_pi(); } );
+      for ( auto const& tt : functions )
+      {
+        resyn( xag, tt, pis.begin(), pis.end(), [&]( auto const& f ) { xag.create_po( f ); } );
+      }
+    } );
+  }
+  for ( auto& t : threads )
+  {
+    t.join();
+  }
+
+  CHECK( *counter.calls >= functions.size() );
+
+  default_simulator<kitty::dynamic_truth_table> sim( 3u );
+  for ( auto const& xag : xags )
+  {
+    CHECK( simulate<kitty::dynamic_truth_table>( xag, sim ) == functions );
+  }
+}
+
+namespace
+{
+
+/* creates a single LUT for the function */
+struct lut_resynthesis
+{
+  template<typename LeavesIterator, typename Fn>
+  void operator()( klut_network& klut, kitty::dynamic_truth_table const& function, LeavesIterator begin, LeavesIterator end, Fn&& fn )
+  {
+    ++*calls;
+    fn( klut.create_node( std::vector<klut_network::signal>( begin, end ), function ) );
+  }
+
+  std::shared_ptr<std::atomic<uint32_t>> calls = std::make_shared<std::atomic<uint32_t>>( 0u );
+};
+
+/* blacklist info that is not trivially copyable */
+struct named_blacklist_cache_info
+{
+  bool retry( named_blacklist_cache_info const& old_info ) const
+  {
+    return old_info.name != name;
+  }
+
+  std::string name;
+};
+
+void to_json( nlohmann::json& j, named_blacklist_cache_info const& info )
+{
+  j = info.name;
+}
+
+void from_json( nlohmann::json const& j, named_blacklist_cache_info& info )
+{
+  j.get_to( info.name );
+}
+
+/* finds no network */
+struct failing_resynthesis
+{
+  template<typename LeavesIterator, typename Fn>
+  void operator()( xag_network& xag, kitty::dynamic_truth_table const& function, LeavesIterator begin, LeavesIterator end, Fn&& fn )
+  {
+    (void)xag;
+    (void)function;
+    (void)begin;
+    (void)end;
+    (void)fn;
+    ++*calls;
+  }
+
+  std::shared_ptr<std::atomic<uint32_t>> calls = std::make_shared<std::atomic<uint32_t>>( 0u );
+};
+
+} // namespace
+
+TEST_CASE( "Binary cache for k-LUT networks", "[cached]" )
+{
+#if __GNUC__ == 7
+  namespace fs = std::experimental::filesystem::v1;
+#else
+  namespace fs = std::filesystem;
+#endif
+
+  const std::string filename = "mockturtle-test-klut-cache.db";
+  fs::remove( filename );
+
+  /* 6-input function, which uses two words per LUT */
+  kitty::dynamic_truth_table tt6( 6u ), maj( 3u );
+  kitty::create_from_hex_string( tt6, "8ff0f00ff00f0ff8" );
+  kitty::create_majority( maj );
+
+  klut_network klut;
+  std::vector<klut_network::signal> pis( 6u );
+  std::generate( pis.begin(), pis.end(), [&]() { return klut.create_pi(); } );
+
+  lut_resynthesis counter;
+  {
+    cached_resynthesis<klut_network, lut_resynthesis> resyn( counter, 6u, filename );
+    resyn( klut, tt6, pis.begin(), pis.end(), [&]( auto const& f ) { klut.create_po( f ); } );
+    resyn( klut, maj, pis.begin(), pis.begin() + 3u, [&]( auto const& f ) { klut.create_po( f ); } );
+    CHECK( resyn.save() );
+  }
+  CHECK( *counter.calls == 2u );
+
+  {
+    cached_resynthesis<klut_network, lut_resynthesis> resyn( counter, 6u, filename );
+    resyn( klut, tt6, pis.begin(), pis.end(), [&]( auto const& f ) { klut.create_po( f ); } );
+    resyn( klut, maj, pis.begin(), pis.begin() + 3u, [&]( auto const& f ) { klut.create_po( f ); } );
+  }
+  CHECK( *counter.calls == 2u );
+
+  kitty::dynamic_truth_table maj6( 6u );
+  kitty::create_from_hex_string( maj6, "e8e8e8e8e8e8e8e8" );
+
+  default_simulator<kitty::dynamic_truth_table> sim( 6u );
+  const auto tts = simulate<kitty::dynamic_truth_table>( klut, sim );
+  CHECK( tts == std::vector<kitty::dynamic_truth_table>{tt6, maj6, tt6, maj6} );
+
+  fs::remove( filename );
+}
+
+TEST_CASE( "Binary cache with blacklist info that is not trivially copyable", "[cached]" )
+{
+#if __GNUC__ == 7
+  namespace fs = std::experimental::filesystem::v1;
+#else
+  namespace fs = std::filesystem;
+#endif
+
+  const std::string filename = "mockturtle-test-blacklist-cache.db";
+  fs::remove( filename );
+
+  kitty::dynamic_truth_table maj( 3u );
+  kitty::create_majority( maj );
+
+  xag_network xag;
+  std::vector<xag_network::signal> pis( 3u );
+  std::generate( pis.begin(), pis.end(), [&]() { return xag.create_pi(); } );
+
+  failing_resynthesis counter;
+  {
+    cached_resynthesis<xag_network, failing_resynthesis, named_blacklist_cache_info> resyn( counter, 6u, filename, {"first"} );
+    resyn( xag, maj, pis.begin(), pis.end(), [&]( auto const& f ) { xag.create_po( f ); } );
+  }
+  CHECK( *counter.calls == 1u );
+
+  /* blacklisted with the same info */
+  {
+    cached_resynthesis<xag_network, failing_resynthesis, named_blacklist_cache_info> resyn( counter, 6u, filename, {"first"} );
+    resyn( xag, maj, pis.begin(), pis.end(), [&]( auto const& f ) { xag.create_po( f ); } );
+  }
+  CHECK( *counter.calls == 1u );
+
+  /* retried with a different info */
+  {
+    cached_resynthesis<xag_network, failing_resynthesis, named_blacklist_cache_info> resyn( counter, 6u, filename, {"second"} );
+    resyn( xag, maj, pis.begin(), pis.end(), [&]( auto const& f ) { xag.create_po( f ); } );
+  }
+  CHECK( *counter.calls == 2u );
+  CHECK( xag.num_pos() == 0u );
+
+  fs::remove( filename );
+}
+
+TEST_CASE( "Reassigned cache entries are recorded once", "[cached]" )
+{
+  detail::sharded_map<uint32_t, uint32_t> map;
+  const auto flush = [&]() {
+    std::vector<std::pair<uint32_t, uint32_t>> records;
+    map.flush( [&]( auto key, auto value ) { records.emplace_back( key, value ); } );
+    return records;
+  };
+
+  map.insert( 1u, 10u );
+  map.assign( 1u, 11u );
+  map.assign( 2u, 20u );
+  map.assign( 2u, 21u );
+  map.assign( 3u, 30u, false );
+  auto records = flush();
+  std::sort( records.begin(), records.end() );
+  CHECK( records == std::vector<std::pair<uint32_t, uint32_t>>{{1u, 11u}, {2u, 21u}} );
+
+  /* entries are recorded again after a flush */
+  map.assign( 2u, 22u );
+  map.assign( 2u, 23u );
+  CHECK( flush() == std::vector<std::pair<uint32_t, uint32_t>>{{2u, 23u}} );
+  CHECK( flush().empty() );
+  CHECK( map.size() == 3u );
+  CHECK( *map.find( 3u ) == 30u );
+}
+
+TEST_CASE( "Cache files in an unknown format are not overwritten", "[cached]" )
+{
+#if __GNUC__ == 7
+  namespace fs = std::experimental::filesystem::v1;
+#else
+  namespace fs = std::filesystem;
+#endif
+
+  const std::string filename = "mockturtle-test-unknown-cache.db";
+
+  const auto read_file = [&]() {
+    std::ifstream is( filename, std::ifstream::in | std::ifstream::binary );
+    return std::string( std::istreambuf_iterator<char>( is ), std::istreambuf_iterator<char>() );
+  };
+
+  kitty::dynamic_truth_table maj( 3u );
+  kitty::create_majority( maj );
+
+  xag_network xag;
+  std::vector<xag_network::signal> pis( 3u );
+  std::generate( pis.begin(), pis.end(), [&]() { return xag.create_pi(); } );
+
+  /* a newer binary version, and a file that is not a cache */
+  const std::string newer( "MTRC\x63\0\0\0\x06\0\0\0\x05", 13u );
+  for ( auto const& contents : {newer, std::string( "not a cache" )} )
+  {
+    {
+      std::ofstream os( filename, std::ofstream::out | std::ofstream::binary );
+      os << contents;
+    }
+
+    counting_resynthesis counter;
+    {
+      cached_resynthesis<xag_network, counting_resynthesis> resyn( counter, 6u, filename );
+      resyn( xag, maj, pis.begin(), pis.end(), [&]( auto const& f ) { xag.create_po( f ); } );
+      CHECK( !resyn.save() );
+    }
+    CHECK( *counter.calls == 1u );
+    CHECK( read_file() == contents );
+    CHECK( !fs::exists( filename + ".bak" ) );
+  }
+
+  fs::remove( filename );
+}
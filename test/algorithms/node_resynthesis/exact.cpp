@@ -1,11 +1,17 @@
 #include <catch.hpp>
 
+#include <algorithm>
+#include <sstream>
+
 #include <kitty/constructors.hpp>
 #include <kitty/dynamic_truth_table.hpp>
+#include <kitty/operations.hpp>
+#include <kitty/operators.hpp>
 
 #include <mockturtle/algorithms/node_resynthesis/exact.hpp>
 #include <mockturtle/algorithms/simulation.hpp>
 #include <mockturtle/networks/aig.hpp>
+#include <mockturtle/networks/klut.hpp>
 #include <mockturtle/networks/xag.hpp>
 
 using namespace mockturtle;
@@ -170,3 +176,319 @@ TEST_CASE( "Exact XMG for XOR3", "[exact]" )
   CHECK( xmg.num_gates() == 1u );
   CHECK( simulate<kitty::dynamic_truth_table>( xmg, sim )[0] == _xor );
 }
+
+TEST_CASE( "Exact LUT synthesis with NPN cache", "[exact]" )
+{
+  exact_resynthesis_params ps;
+  ps.cache = std::make_shared<exact_resynthesis_params::cache_map_t>();
+  ps.use_npn_cache = true;
+  exact_resynthesis<klut_network> resyn( 3u, ps );
+
+  kitty::dynamic_truth_table f( 4u ), g( 4u );
+  kitty::create_from_hex_string( f, "1ee1" );
+  g = ~kitty::flip( kitty::swap( f, 0u, 3u ), 1u );
+
+  klut_network klut;
+  std::vector<klut_network::signal> pis( 4u );
+  std::generate( pis.begin(), pis.end(), [&]() { return klut.create_pi(); } );
+
+  for ( auto const& tt : {f, g} )
+  {
+    resyn( klut, tt, pis.begin(), pis.end(), [&]( auto const& s ) {
+      klut.create_po( s );
+    } );
+  }
+
+  CHECK( ps.cache->size() == 1u );
+  CHECK( klut.num_pos() == 2u );
+
+  default_simulator<kitty::dynamic_truth_table> sim( 4u );
+  const auto tts = simulate<kitty::dynamic_truth_table>( klut, sim );
+  CHECK( tts[0] == f );
+  CHECK( tts[1] == g );
+}
+
+TEST_CASE( "Exact AIG synthesis with NPN cache", "[exact]" )
+{
+  exact_resynthesis_params ps;
+  ps.cache = std::make_shared<exact_resynthesis_params::cache_map_t>();
+  ps.use_npn_cache = true;
+  exact_aig_resynthesis<aig_network> resyn( false, ps );
+
+  kitty::dynamic_truth_table f( 3u ), g( 3u );
+  kitty::create_from_hex_string( f, "d8" );
+  g = ~kitty::flip( kitty::swap( f, 0u, 2u ), 1u );
+
+  aig_network aig;
+  std::vector<aig_network::signal> pis( 3u );
+  std::generate( pis.begin(), pis.end(), [&]() { return aig.create_pi(); } );
+
+  for ( auto const& tt : {f, g} )
+  {
+    resyn( aig, tt, pis.begin(), pis.end(), [&]( auto const& s ) {
+      aig.create_po( s );
+    } );
+  }
+
+  CHECK( ps.cache->size() == 1u );
+
+  default_simulator<kitty::dynamic_truth_table> sim( 3u );
+  const auto tts = simulate<kitty::dynamic_truth_table>( aig, sim );
+  CHECK( tts[0] == f );
+  CHECK( tts[1] == g );
+}
+
+TEST_CASE( "Read and write exact synthesis cache", "[exact]" )
+{
+  exact_resynthesis_params ps;
+  ps.cache = std::make_shared<exact_resynthesis_params::cache_map_t>();
+  ps.blacklist_cache = std::make_shared<exact_resynthesis_params::blacklist_cache_map_t>();
+  exact_resynthesis<klut_network> resyn( 2u, ps );
+
+  klut_network klut;
+  std::vector<klut_network::signal> pis( 3u );
+  std::generate( pis.begin(), pis.end(), [&]() { return klut.create_pi(); } );
+
+  kitty::dynamic_truth_table maj( 3u ), blocked( 4u );
+  kitty::create_majority( maj );
+  kitty::create_from_hex_string( blocked, "6996" );
+  resyn( klut, maj, pis.begin(), pis.end(), [&]( auto const& s ) {
+    klut.create_po( s );
+  } );
+  ( *ps.blacklist_cache )[blocked] = 100;
+
+  std::stringstream str;
+  write_exact_resynthesis_cache( str, ps );
+
+  exact_resynthesis_params ps2;
+  CHECK( read_exact_resynthesis_cache( str, ps2 ) );
+  REQUIRE( ps2.cache );
+  REQUIRE( ps2.blacklist_cache );
+  CHECK( ps2.cache->size() == 1u );
+  CHECK( ps2.blacklist_cache->size() == 1u );
+  CHECK( ps2.blacklist_cache->at( blocked ) == 100 );
+
+  const auto& c1 = ps.cache->at( maj );
+  const auto& c2 = ps2.cache->at( maj );
+  CHECK( c1.get_nr_steps() == c2.get_nr_steps() );
+  CHECK( c1.get_outputs() == c2.get_outputs() );
+  CHECK( c2.simulate()[0] == maj );
+
+  /* the restored cache is used for synthesis */
+  exact_resynthesis<klut_network> resyn2( 2u, ps2 );
+  resyn2( klut, maj, pis.begin(), pis.end(), [&]( auto const& s ) {
+    klut.create_po( s );
+  } );
+  default_simulator<kitty::dynamic_truth_table> sim( 3u );
+  CHECK( simulate<kitty::dynamic_truth_table>( klut, sim )[1] == maj );
+
+  std::stringstream bad( "not a cache" );
+  exact_resynthesis_params ps3;
+  CHECK( !read_exact_resynthesis_cache( bad, ps3 ) );
+}
+
+TEST_CASE( "Reject malformed exact synthesis cache", "[exact]" )
+{
+  /* cache with a single chain for a 3-input function with 2-input steps */
+  const auto write_cache = []( uint8_t num_vars, uint8_t nr_in, std::vector<int32_t> const& children, int32_t output ) {
+    std::stringstream str;
+    detail::write_binary<uint32_t>( str, detail::exact_cache_magic );
+    detail::write_binary<uint32_t>( str, detail::exact_cache_version );
+    detail::write_binary<uint32_t>( str, 1u );
+    kitty::dynamic_truth_table function( num_vars );
+    detail::write_binary_truth_table( str, function );
+    detail::write_binary<uint8_t>( str, nr_in );
+    detail::write_binary<uint8_t>( str, 2u );
+    detail::write_binary<uint32_t>( str, static_cast<uint32_t>( children.size() / 2u ) );
+    detail::write_binary<uint32_t>( str, 1u );
+    for ( auto i = 0u; i < children.size(); i += 2u )
+    {
+      detail::write_binary<int32_t>( str, children[i] );
+      detail::write_binary<int32_t>( str, children[i + 1u] );
+      detail::write_binary<uint64_t>( str, 0x8u );
+    }
+    detail::write_binary<int32_t>( str, output );
+    detail::write_binary<uint32_t>( str, 0u );
+    return str;
+  };
+
+  exact_resynthesis_params ps;
+  auto good = write_cache( 3u, 3u, {0, 1, 2, 3}, 10 );
+  CHECK( read_exact_resynthesis_cache( good, ps ) );
+  CHECK( ps.cache->size() == 1u );
+
+  const auto rejects = [&]( std::stringstream str ) {
+    exact_resynthesis_params ps;
+    return !read_exact_resynthesis_cache( str, ps ) && ps.cache->empty();
+  };
+
+  /* too many variables */
+  CHECK( rejects( write_cache( 7u, 7u, {0, 1}, 16 ) ) );
+  /* number of inputs does not match function */
+  CHECK( rejects( write_cache( 3u, 4u, {0, 1}, 10 ) ) );
+  /* step refers to itself or a later step */
+  CHECK( rejects( write_cache( 3u, 3u, {0, 3, 1, 2}, 10 ) ) );
+  CHECK( rejects( write_cache( 3u, 3u, {0, 1, 2, 4}, 10 ) ) );
+  /* negative child */
+  CHECK( rejects( write_cache( 3u, 3u, {-1, 1}, 8 ) ) );
+  /* output refers to a missing step */
+  CHECK( rejects( write_cache( 3u, 3u, {0, 1}, 10 ) ) );
+
+  /* number of steps beyond the limit of percy */
+  std::stringstream huge;
+  detail::write_binary<uint32_t>( huge, detail::exact_cache_magic );
+  detail::write_binary<uint32_t>( huge, detail::exact_cache_version );
+  detail::write_binary<uint32_t>( huge, 1u );
+  detail::write_binary_truth_table( huge, kitty::dynamic_truth_table( 3u ) );
+  detail::write_binary<uint8_t>( huge, 3u );
+  detail::write_binary<uint8_t>( huge, 2u );
+  detail::write_binary<uint32_t>( huge, 0x40000000u );
+  detail::write_binary<uint32_t>( huge, 1u );
+  CHECK( rejects( std::move( huge ) ) );
+}
+
+TEST_CASE( "Exact LUT synthesis with cached chain without steps", "[exact]" )
+{
+  /* the 4-input function is the complement of its third input */
+  kitty::dynamic_truth_table f( 4u );
+  kitty::create_nth_var( f, 2u, true );
+
+  klut_network klut;
+  std::vector<klut_network::signal> pis( 4u );
+  std::generate( pis.begin(), pis.end(), [&]() { return klut.create_pi(); } );
+
+  for ( auto use_npn : {false, true} )
+  {
+    exact_resynthesis_params ps;
+    ps.cache = std::make_shared<exact_resynthesis_params::cache_map_t>();
+    ps.use_npn_cache = use_npn;
+
+    /* store a chain for the key under which f is looked up */
+    const auto [key, phase, perm] = detail::exact_cache_key( f, use_npn );
+    percy::chain c;
+    c.reset( 4, 1, 0, 3 );
+    for ( auto i = 0u; i < 4u; ++i )
+    {
+      if ( kitty::has_var( key, i ) )
+      {
+        c.set_output( 0, ( ( i + 1 ) << 1 ) | ( kitty::get_bit( key, 0u ) ? 1 : 0 ) );
+      }
+    }
+    ( *ps.cache )[key] = c;
+
+    exact_resynthesis<klut_network> resyn( 3u, ps );
+    resyn( klut, f, pis.begin(), pis.end(), [&]( auto const& s ) {
+      klut.create_po( s );
+    } );
+    CHECK( ps.cache->size() == 1u );
+  }
+
+  default_simulator<kitty::dynamic_truth_table> sim( 4u );
+  const auto tts = simulate<kitty::dynamic_truth_table>( klut, sim );
+  REQUIRE( tts.size() == 2u );
+  CHECK( tts[0] == f );
+  CHECK( tts[1] == f );
+}
+
+TEST_CASE( "Exact LUT synthesis of projections", "[exact]" )
+{
+  klut_network klut;
+  std::vector<klut_network::signal> pis( 4u );
+  std::generate( pis.begin(), pis.end(), [&]() { return klut.create_pi(); } );
+
+  /* chains of projections have no steps, and their output may be complemented */
+  std::vector<kitty::dynamic_truth_table> functions;
+  for ( auto complement : {false, true} )
+  {
+    for ( auto i = 0u; i < 4u; ++i )
+    {
+      kitty::dynamic_truth_table f( 4u );
+      kitty::create_nth_var( f, i, complement );
+      functions.push_back( f );
+
+      exact_resynthesis<klut_network> resyn( 3u );
+      resyn( klut, f, pis.begin(), pis.end(), [&]( auto const& s ) {
+        klut.create_po( s );
+      } );
+    }
+  }
+
+  default_simulator<kitty::dynamic_truth_table> sim( 4u );
+  CHECK( simulate<kitty::dynamic_truth_table>( klut, sim ) == functions );
+}
+
+TEST_CASE( "Exact AIG synthesis with portfolio", "[exact]" )
+{
+  exact_resynthesis_params ps;
+  ps.portfolio = {{percy::SLV_BSAT2, percy::ENC_SSV, percy::SYNTH_STD},
+                  {percy::SLV_BSAT2, percy::ENC_SSV, percy::SYNTH_STD_CEGAR},
+                  {percy::SLV_BSAT2, percy::ENC_DITT, percy::SYNTH_STD_CEGAR}};
+  exact_aig_resynthesis<aig_network> resyn( false, ps );
+
+  aig_network aig;
+  const auto a = aig.create_pi();
+  const auto b = aig.create_pi();
+  const auto c = aig.create_pi();
+
+  kitty::dynamic_truth_table maj( 3u );
+  kitty::create_majority( maj );
+
+  std::vector<aig_network::signal> pis = {a, b, c};
+  resyn( aig, maj, pis.begin(), pis.end(), [&]( auto const& s ) {
+    aig.create_po( s );
+  } );
+
+  CHECK( aig.num_gates() == 4u );
+
+  default_simulator<kitty::dynamic_truth_table> sim( 3u );
+  CHECK( simulate<kitty::dynamic_truth_table>( aig, sim )[0] == maj );
+}
+
+TEST_CASE( "Exact LUT synthesis in batch mode", "[exact]" )
+{
+  exact_resynthesis_params ps;
+  ps.cache = std::make_shared<exact_resynthesis_params::cache_map_t>();
+  ps.num_threads = 4u;
+  exact_resynthesis<klut_network> resyn( 2u, ps );
+
+  std::vector<kitty::dynamic_truth_table> functions;
+  for ( auto const& hex : {"e8", "96", "d8", "e8", "1e", "80", "fe"} )
+  {
+    kitty::dynamic_truth_table tt( 3u );
+    kitty::create_from_hex_string( tt, hex );
+    functions.push_back( tt );
+  }
+  /* functions that can be realized by a single LUT are not cached */
+  functions.push_back( kitty::dynamic_truth_table( 2u ) );
+
+  resyn.synthesize_batch( functions );
+  CHECK( ps.cache->size() == 6u );
+
+  /* cached chains are used and realize the functions */
+  exact_resynthesis_params ps_seq;
+  ps_seq.cache = std::make_shared<exact_resynthesis_params::cache_map_t>();
+  exact_resynthesis<klut_network> resyn_seq( 2u, ps_seq );
+
+  klut_network klut, klut_seq;
+  std::vector<klut_network::signal> pis( 3u ), pis_seq( 3u );
+  std::generate( pis.begin(), pis.end(), [&]() { return klut.create_pi(); } );
+  std::generate( pis_seq.begin(), pis_seq.end(), [&]() { return klut_seq.create_pi(); } );
+  for ( auto i = 0u; i + 1u < functions.size(); ++i )
+  {
+    resyn( klut, functions[i], pis.begin(), pis.end(), [&]( auto const& s ) {
+      klut.create_po( s );
+    } );
+    resyn_seq( klut_seq, functions[i], pis_seq.begin(), pis_seq.end(), [&]( auto const& s ) {
+      klut_seq.create_po( s );
+    } );
+  }
+  CHECK( ps.cache->size() == 6u );
+  CHECK( klut.num_gates() == klut_seq.num_gates() );
+
+  default_simulator<kitty::dynamic_truth_table> sim( 3u );
+  const auto tts = simulate<kitty::dynamic_truth_table>( klut, sim );
+  for ( auto i = 0u; i + 1u < functions.size(); ++i )
+  {
+    CHECK( tts[i] == functions[i] );
+  }
+}
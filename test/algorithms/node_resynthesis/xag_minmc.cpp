@@ -0,0 +1,148 @@
+#include <catch.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+#include <kitty/constructors.hpp>
+#include <kitty/dynamic_truth_table.hpp>
+#include <kitty/operators.hpp>
+#include <kitty/print.hpp>
+#include <kitty/spectral.hpp>
+#include <kitty/static_truth_table.hpp>
+
+#include <mockturtle/algorithms/node_resynthesis/xag_minmc.hpp>
+#include <mockturtle/algorithms/simulation.hpp>
+#include <mockturtle/networks/xag.hpp>
+
+using namespace mockturtle;
+
+static xag_network resynthesize_minmc( std::string const& filename, kitty::dynamic_truth_table const& function )
+{
+  xag_network xag;
+  std::vector<xag_network::signal> pis;
+  for ( auto i = 0u; i < function.num_vars(); ++i )
+  {
+    pis.push_back( xag.create_pi() );
+  }
+
+  xag_minmc_resynthesis resyn( filename );
+  resyn( xag, function, pis.begin(), pis.end(), [&]( auto const& f ) {
+    xag.create_po( f );
+  } );
+  return xag;
+}
+
+TEST_CASE( "MC-optimum resynthesis from text and binary database", "[xag_minmc]" )
+{
+  /* database with a single entry for the AND function */
+  kitty::static_truth_table<6u> tt_and, tt_a, tt_b;
+  kitty::create_nth_var( tt_a, 0 );
+  kitty::create_nth_var( tt_b, 1 );
+  tt_and = tt_a & tt_b;
+  const auto repr = kitty::exact_spectral_canonization( tt_and );
+
+  {
+    std::ofstream os( "mockturtle-test-minmc.txt", std::ofstream::out );
+    os << "and\t" << kitty::to_hex( tt_and ) << "\t" << kitty::to_hex( repr ) << "\t1\t2 2 4 0 6\n";
+  }
+  CHECK( compile_xag_minmc_database( "mockturtle-test-minmc.txt", "mockturtle-test-minmc.db" ) );
+
+  /* spectrally equivalent function */
+  kitty::dynamic_truth_table function( 4u ), a( 4u ), b( 4u );
+  kitty::create_nth_var( a, 2 );
+  kitty::create_nth_var( b, 3 );
+  function = a & ~b;
+
+  for ( auto const& filename : {"mockturtle-test-minmc.txt", "mockturtle-test-minmc.db"} )
+  {
+    const auto xag = resynthesize_minmc( filename, function );
+    CHECK( xag.num_pos() == 1u );
+    CHECK( xag.num_gates() == 1u );
+    CHECK( simulate<kitty::dynamic_truth_table>( xag, {4u} )[0] == function );
+  }
+
+  /* majority is in the same class */
+  kitty::dynamic_truth_table maj( 3u );
+  kitty::create_majority( maj );
+  const auto xag_maj = resynthesize_minmc( "mockturtle-test-minmc.db", maj );
+  CHECK( xag_maj.num_pos() == 1u );
+  CHECK( simulate<kitty::dynamic_truth_table>( xag_maj, {3u} )[0] == maj );
+
+  /* unknown functions are not synthesized */
+  kitty::dynamic_truth_table and3( 3u );
+  kitty::create_from_hex_string( and3, "80" );
+  CHECK( resynthesize_minmc( "mockturtle-test-minmc.db", and3 ).num_pos() == 0u );
+
+  std::remove( "mockturtle-test-minmc.txt" );
+  std::remove( "mockturtle-test-minmc.db" );
+}
+
+TEST_CASE( "Compiled MC database keeps the first entry of a class", "[xag_minmc]" )
+{
+  kitty::static_truth_table<6u> tt_and, tt_a, tt_b;
+  kitty::create_nth_var( tt_a, 0 );
+  kitty::create_nth_var( tt_b, 1 );
+  tt_and = tt_a & tt_b;
+  const auto repr = kitty::exact_spectral_canonization( tt_and );
+
+  /* the first entry computes a & b as a & ~( a ^ b ) */
+  {
+    std::ofstream os( "mockturtle-test-minmc.txt", std::ofstream::out );
+    os << "and\t" << kitty::to_hex( tt_and ) << "\t" << kitty::to_hex( repr ) << "\t1\t2 4 2 0 2 7 0 8\n";
+    os << "and\t" << kitty::to_hex( tt_and ) << "\t" << kitty::to_hex( repr ) << "\t1\t2 2 4 0 6\n";
+  }
+  CHECK( compile_xag_minmc_database( "mockturtle-test-minmc.txt", "mockturtle-test-minmc.db" ) );
+
+  kitty::dynamic_truth_table function( 2u );
+  kitty::create_from_hex_string( function, "8" );
+  for ( auto const& filename : {"mockturtle-test-minmc.txt", "mockturtle-test-minmc.db"} )
+  {
+    const auto xag = resynthesize_minmc( filename, function );
+    CHECK( xag.num_gates() == 2u );
+    CHECK( simulate<kitty::dynamic_truth_table>( xag, {2u} )[0] == function );
+  }
+
+  std::remove( "mockturtle-test-minmc.txt" );
+  std::remove( "mockturtle-test-minmc.db" );
+}
+
+TEST_CASE( "Reject invalid MC databases", "[xag_minmc]" )
+{
+  kitty::static_truth_table<6u> tt_and, tt_a, tt_b;
+  kitty::create_nth_var( tt_a, 0 );
+  kitty::create_nth_var( tt_b, 1 );
+  tt_and = tt_a & tt_b;
+  const auto repr = kitty::exact_spectral_canonization( tt_and );
+
+  /* literal 14 is not defined */
+  {
+    std::ofstream os( "mockturtle-test-minmc.txt", std::ofstream::out );
+    os << "and\t" << kitty::to_hex( tt_and ) << "\t" << kitty::to_hex( repr ) << "\t1\t2 2 14 0 6\n";
+  }
+  CHECK( !compile_xag_minmc_database( "mockturtle-test-minmc.txt", "mockturtle-test-minmc.db" ) );
+
+  {
+    std::ofstream os( "mockturtle-test-minmc.txt", std::ofstream::out );
+    os << "and\t" << kitty::to_hex( tt_and ) << "\t" << kitty::to_hex( repr ) << "\t1\t2 2 4 0 6\n";
+  }
+  kitty::dynamic_truth_table function( 2u );
+  kitty::create_from_hex_string( function, "8" );
+
+  /* another version, and another byte order */
+  for ( auto offset : {4u, 48u} )
+  {
+    CHECK( compile_xag_minmc_database( "mockturtle-test-minmc.txt", "mockturtle-test-minmc.db" ) );
+    CHECK( resynthesize_minmc( "mockturtle-test-minmc.db", function ).num_pos() == 1u );
+
+    {
+      std::fstream fs( "mockturtle-test-minmc.db", std::fstream::in | std::fstream::out | std::fstream::binary );
+      fs.seekp( offset );
+      fs.put( 0x7f );
+    }
+    CHECK( resynthesize_minmc( "mockturtle-test-minmc.db", function ).num_pos() == 0u );
+  }
+
+  std::remove( "mockturtle-test-minmc.txt" );
+  std::remove( "mockturtle-test-minmc.db" );
+}
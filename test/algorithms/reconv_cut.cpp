@@ -81,3 +81,34 @@ TEST_CASE( "generate fanin-cuts for an AIG using manager class API", "[reconv_cu
   CHECK( leaves( f4, 2u ) == set_t{aig.get_node( f2 ), aig.get_node( f3 )} );
   CHECK( leaves( f4, 3u ) == set_t{aig.get_node( a ), aig.get_node( b )} );
 }
+
+TEST_CASE( "generate fanin-cuts for single pivots with reused buffers", "[reconv_cut]" )
+{
+  using cuts_impl = detail::reconvergence_driven_cut_impl<aig_network, false, false>;
+
+  aig_network aig;
+  const auto a = aig.create_pi();
+  const auto b = aig.create_pi();
+  const auto f1 = aig.create_nand( a, b );
+  const auto f2 = aig.create_nand( f1, a );
+  const auto f3 = aig.create_nand( f1, b );
+  const auto f4 = aig.create_nand( f2, f3 );
+  aig.create_po( f4 );
+
+  using set_t = std::set<node<aig_network>>;
+
+  cuts_impl::parameters_type ps{2u};
+  cuts_impl::statistics_type st;
+  cuts_impl cuts( aig, ps, st );
+
+  auto const& leaves = cuts.run_single( aig.get_node( f4 ) );
+  const auto data = leaves.data();
+  CHECK( set_t( leaves.begin(), leaves.end() ) == set_t{aig.get_node( f2 ), aig.get_node( f3 )} );
+
+  /* the same buffer is used for all pivots */
+  CHECK( &cuts.run_single( aig.get_node( f1 ) ) == &leaves );
+  CHECK( leaves.data() == data );
+  CHECK( set_t( leaves.begin(), leaves.end() ) == set_t{aig.get_node( a ), aig.get_node( b )} );
+
+  CHECK( st.num_calls == 2u );
+}
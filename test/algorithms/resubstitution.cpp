@@ -5,6 +5,7 @@
 #include <mockturtle/algorithms/resubstitution.hpp>
 #include <mockturtle/algorithms/cleanup.hpp>
 #include <mockturtle/algorithms/simulation.hpp>
+#include <mockturtle/generators/arithmetic.hpp>
 #include <mockturtle/networks/aig.hpp>
 #include <mockturtle/networks/mig.hpp>
 #include <mockturtle/networks/xmg.hpp>
@@ -174,6 +175,97 @@ TEST_CASE( "Resubstitution of XAG to minimize ANDs", "[resubstitution]" )
   CHECK( xag.num_gates() == 2 );
 }
 
+TEST_CASE( "Speculative parallel resubstitution of AIG", "[resubstitution]" )
+{
+  aig_network aig;
+
+  std::vector<aig_network::signal> a( 4u ), b( 4u );
+  std::generate( a.begin(), a.end(), [&]() { return aig.create_pi(); } );
+  std::generate( b.begin(), b.end(), [&]() { return aig.create_pi(); } );
+
+  /* multiplier and a redundant copy of the product bits in OR form */
+  for ( auto const& f : carry_ripple_multiplier( aig, a, b ) )
+  {
+    aig.create_po( f );
+    aig.create_po( aig.create_or( aig.create_and( f, a[0] ), aig.create_and( f, !a[0] ) ) );
+  }
+
+  const auto tts = simulate<kitty::static_truth_table<8u>>( aig );
+  const auto size_before = aig.num_gates();
+
+  auto aig_seq = cleanup_dangling( aig );
+  aig_resubstitution( aig_seq );
+  aig_seq = cleanup_dangling( aig_seq );
+
+  resubstitution_params ps;
+  ps.num_threads = 4u;
+  ps.speculation_window = 16u;
+
+  resubstitution_stats st;
+  aig_resubstitution( aig, ps, &st );
+  aig = cleanup_dangling( aig );
+
+  CHECK( st.num_speculative_accepts > 0u );
+  CHECK( st.num_speculative_accepts + st.num_speculative_retries <= size_before );
+  CHECK( aig.num_gates() < size_before );
+  CHECK( aig.num_gates() == aig_seq.num_gates() );
+  CHECK( simulate<kitty::static_truth_table<8u>>( aig ) == tts );
+  CHECK( simulate<kitty::static_truth_table<8u>>( aig_seq ) == tts );
+}
+
+TEST_CASE( "Speculative resubstitution falls back to a single thread", "[resubstitution]" )
+{
+  mig_network mig;
+
+  const auto a = mig.create_pi();
+  const auto b = mig.create_pi();
+  const auto c = mig.create_pi();
+  mig.create_po( mig.create_maj( a, mig.create_maj( a, b, c ), c ) );
+
+  /* the speculative mode requires fanout_view<depth_view<mig_network>> */
+  fanout_view<mig_network> fanout_mig{mig};
+  depth_view<fanout_view<mig_network>> resub_view{fanout_mig};
+
+  resubstitution_params ps;
+  ps.num_threads = 4u;
+  resubstitution_stats st;
+  mig_resubstitution( resub_view, ps, &st );
+  mig = cleanup_dangling( mig );
+
+  CHECK( st.single_threaded_fallback );
+  CHECK( st.num_speculative_accepts + st.num_speculative_retries == 0u );
+  CHECK( mig.num_gates() == 1u );
+  CHECK( simulate<kitty::static_truth_table<3u>>( mig )[0]._bits == 0xe8 );
+}
+
+TEST_CASE( "Resubstitution of AIG with different window sizes", "[resubstitution]" )
+{
+  for ( auto max_pis : {4u, 6u, 7u, 10u} )
+  {
+    aig_network aig;
+
+    std::vector<aig_network::signal> a( 4u ), b( 4u );
+    std::generate( a.begin(), a.end(), [&]() { return aig.create_pi(); } );
+    std::generate( b.begin(), b.end(), [&]() { return aig.create_pi(); } );
+
+    for ( auto const& f : carry_ripple_multiplier( aig, a, b ) )
+    {
+      aig.create_po( aig.create_or( aig.create_and( f, b[0] ), aig.create_and( f, !b[0] ) ) );
+    }
+
+    const auto tts = simulate<kitty::static_truth_table<8u>>( aig );
+    const auto size_before = aig.num_gates();
+
+    resubstitution_params ps;
+    ps.max_pis = max_pis;
+    aig_resubstitution( aig, ps );
+    aig = cleanup_dangling( aig );
+
+    CHECK( aig.num_gates() < size_before );
+    CHECK( simulate<kitty::static_truth_table<8u>>( aig ) == tts );
+  }
+}
+
 TEST_CASE( "Simulation-guided resubstitution", "[resubstitution]" )
 {
   aig_network aig;
@@ -205,3 +297,45 @@ TEST_CASE( "Simulation-guided resubstitution", "[resubstitution]" )
   CHECK( aig.num_pos() == 1 );
   CHECK( aig.num_gates() == 1 );
 }
+
+TEST_CASE( "Simulation-guided resubstitution appends counter-examples to a binary pattern file", "[resubstitution]" )
+{
+  aig_network aig;
+
+  std::vector<aig_network::signal> a( 4u ), b( 4u );
+  std::generate( a.begin(), a.end(), [&]() { return aig.create_pi(); } );
+  std::generate( b.begin(), b.end(), [&]() { return aig.create_pi(); } );
+  for ( auto const& f : carry_ripple_multiplier( aig, a, b ) )
+  {
+    aig.create_po( f );
+  }
+
+  /* two patterns do not distinguish most nodes */
+  partial_simulator loaded( 8u, 0u );
+  loaded.add_pattern( std::vector<bool>( 8u, false ) );
+  loaded.add_pattern( {true, false, true, false, false, true, false, true} );
+  CHECK( write_binary_patterns( loaded, "mockturtle-test-resub.bpat" ) );
+
+  const auto tts = simulate<kitty::static_truth_table<8u>>( aig );
+
+  resubstitution_params ps;
+  ps.pattern_filename = "mockturtle-test-resub.bpat";
+  ps.save_patterns = "mockturtle-test-resub.bpat";
+  ps.binary_patterns = true;
+  sim_resubstitution( aig, ps );
+  aig = cleanup_dangling( aig );
+  CHECK( simulate<kitty::static_truth_table<8u>>( aig ) == tts );
+
+  /* the counter-examples are appended to the loaded patterns */
+  partial_simulator saved( "mockturtle-test-resub.bpat" );
+  CHECK( saved.num_bits() > 2u );
+  REQUIRE( saved.get_patterns().size() == 8u );
+  for ( auto i = 0u; i < 8u; ++i )
+  {
+    auto prefix = saved.get_patterns()[i];
+    prefix.resize( 2 );
+    CHECK( prefix == loaded.get_patterns()[i] );
+  }
+
+  std::remove( "mockturtle-test-resub.bpat" );
+}
@@ -0,0 +1,105 @@
+#include <catch.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include <mockturtle/algorithms/simulation.hpp>
+#include <mockturtle/io/aiger_reader.hpp>
+#include <mockturtle/io/read_binary_aiger.hpp>
+#include <mockturtle/io/write_aiger.hpp>
+#include <mockturtle/networks/aig.hpp>
+
+#include <kitty/dynamic_truth_table.hpp>
+#include <lorina/aiger.hpp>
+
+using namespace mockturtle;
+
+static void write_file( std::string const& filename, std::string const& contents )
+{
+  std::ofstream os( filename.c_str(), std::ofstream::out | std::ofstream::binary );
+  os << contents;
+}
+
+TEST_CASE( "read binary AIGER file with fast reader", "[read_binary_aiger]" )
+{
+  aig_network aig;
+  const auto a = aig.create_pi();
+  const auto b = aig.create_pi();
+  const auto c = aig.create_pi();
+  aig.create_po( aig.create_maj( a, !b, c ) );
+  aig.create_po( aig.create_xor( a, b ) );
+  aig.create_po( !a );
+  write_aiger( aig, "mockturtle-test-fast.aig" );
+
+  aig_network expected;
+  CHECK( lorina::read_aiger( "mockturtle-test-fast.aig", aiger_reader( expected ) ) == lorina::return_code::success );
+  const auto expected_tts = simulate<kitty::dynamic_truth_table>( expected, {3u} );
+
+  for ( auto assume_strashed : {false, true} )
+  {
+    read_binary_aiger_params ps;
+    ps.assume_strashed = assume_strashed;
+
+    aig_network read;
+    CHECK( read_binary_aiger( "mockturtle-test-fast.aig", read, ps ) == lorina::return_code::success );
+    CHECK( read.num_pis() == 3u );
+    CHECK( read.num_pos() == 3u );
+    CHECK( read.num_gates() == expected.num_gates() );
+    CHECK( simulate<kitty::dynamic_truth_table>( read, {3u} ) == expected_tts );
+
+    /* structural hash table is built */
+    const auto size = read.size();
+    read.foreach_gate( [&]( auto const& n ) {
+      std::vector<aig_network::signal> children;
+      read.foreach_fanin( n, [&]( auto const& f ) { children.push_back( f ); } );
+      read.create_and( children[0], children[1] );
+    } );
+    CHECK( read.size() == size );
+  }
+
+  std::remove( "mockturtle-test-fast.aig" );
+}
+
+TEST_CASE( "read binary AIGER file with latches and names", "[read_binary_aiger]" )
+{
+  /* x0 & s0 stored in latch s0 and output y0 */
+  write_file( "mockturtle-test-fast.aig", std::string( "aig 3 1 1 1 1\n6 1\n6\n" ) + char( 2 ) + char( 2 ) + "i0 x0\nl0 s0\no0 y0\nc\ncomment\n" );
+
+  aig_network aig;
+  NameMap<aig_network> names;
+  CHECK( read_binary_aiger( "mockturtle-test-fast.aig", aig, {}, &names ) == lorina::return_code::success );
+  CHECK( aig.num_pis() == 1u );
+  CHECK( aig.num_latches() == 1u );
+  CHECK( aig.num_pos() == 1u );
+  CHECK( aig.num_gates() == 1u );
+  CHECK( aig.latch_reset( 0u ) == 1 );
+  CHECK( names.has_name( aig.make_signal( aig.pi_at( 0 ) ), "x0" ) );
+  CHECK( names.has_name( aig.make_signal( aig.ro_at( 0 ) ), "s0" ) );
+  CHECK( names.has_name( aig.ri_at( 0 ), "s0_next" ) );
+  CHECK( names.has_name( aig.po_at( 0 ), "y0" ) );
+
+  std::remove( "mockturtle-test-fast.aig" );
+}
+
+TEST_CASE( "reject malformed binary AIGER files", "[read_binary_aiger]" )
+{
+  for ( auto const& contents : {std::string( "aag 3 2 0 1 1\n2\n4\n6\n6 2 4\n" ),
+                                std::string( "aig 3 2 0 1 2\n6\n" ),
+                                std::string( "aig 3 2 0 1 1\n6\n" ),
+                                std::string( "aig 3 2 0 1 1\n6\n" ) + char( 7 ) + char( 2 ),
+                                std::string( "aig 3 2 0 1 1\n8\n" ) + char( 2 ) + char( 2 ),
+                                std::string( "aig 4000000000000 0 0 0 4000000000000\n" ),
+                                std::string( "aig 2 0 2 4000000000000 0\n2\n2\n" ),
+                                std::string( "aig 8000000000 8000000000 0 0 0\n" )} )
+  {
+    write_file( "mockturtle-test-fast.aig", contents );
+    aig_network aig;
+    CHECK( read_binary_aiger( "mockturtle-test-fast.aig", aig ) == lorina::return_code::parse_error );
+  }
+
+  aig_network aig;
+  CHECK( read_binary_aiger( "mockturtle-test-missing.aig", aig ) == lorina::return_code::parse_error );
+
+  std::remove( "mockturtle-test-fast.aig" );
+}
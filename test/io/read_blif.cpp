@@ -0,0 +1,183 @@
+#include <catch.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include <mockturtle/algorithms/simulation.hpp>
+#include <mockturtle/io/blif_reader.hpp>
+#include <mockturtle/io/read_blif.hpp>
+#include <mockturtle/networks/klut.hpp>
+#include <mockturtle/views/names_view.hpp>
+
+#include <kitty/dynamic_truth_table.hpp>
+#include <kitty/print.hpp>
+#include <lorina/blif.hpp>
+#include <lorina/diagnostics.hpp>
+
+using namespace mockturtle;
+
+static void write_file( std::string const& filename, std::string const& contents )
+{
+  std::ofstream os( filename.c_str(), std::ofstream::out | std::ofstream::binary );
+  os << contents;
+}
+
+TEST_CASE( "read a combinational BLIF file with the fast reader", "[read_blif]" )
+{
+  write_file( "mockturtle-test-read.blif", ".model top\n"
+                                           ".inputs a b \\\n"
+                                           "  c\n"
+                                           ".outputs y1 y2 y3\n"
+                                           "# gates in any order\n"
+                                           ".names n2 y1\n"
+                                           "0 1\n"
+                                           ".names a b n1\n"
+                                           "11 1\n"
+                                           ".names c n1 n2\n"
+                                           "1- 1\n"
+                                           "-1 1\n"
+                                           "\n"
+                                           ".names n2 y2\n"
+                                           "1 1\n"
+                                           ".names a c y3\n"
+                                           "11 1\n"
+                                           ".end\n" );
+
+  names_view<klut_network> klut;
+  read_blif_stats st;
+  CHECK( read_blif( "mockturtle-test-read.blif", klut, &st ) == lorina::return_code::success );
+  CHECK( klut.num_pis() == 3u );
+  CHECK( klut.num_pos() == 3u );
+  CHECK( klut.num_gates() == 5u );
+  CHECK( st.num_covers == 5u );
+  CHECK( st.num_unique_covers == 4u );
+
+  const auto tts = simulate<kitty::dynamic_truth_table>( klut, default_simulator<kitty::dynamic_truth_table>( 3u ) );
+  CHECK( kitty::to_hex( tts[0] ) == "07" );
+  CHECK( kitty::to_hex( tts[1] ) == "f8" );
+  CHECK( kitty::to_hex( tts[2] ) == "a0" );
+
+  CHECK( klut.get_name( klut.make_signal( klut.pi_at( 2u ) ) ) == "c" );
+  CHECK( klut.get_output_name( 1u ) == "y2" );
+
+  std::remove( "mockturtle-test-read.blif" );
+}
+
+TEST_CASE( "read BLIF covers with many inputs and max terms with the fast reader", "[read_blif]" )
+{
+  std::string contents = ".model top\n.inputs";
+  for ( auto i = 0u; i < 9u; ++i )
+  {
+    contents += " x" + std::to_string( i );
+  }
+  contents += "\n.outputs f g h\n"
+              ".names x0 x1 x2 x3 x4 x5 x6 x7 x8 f\n"
+              "1-------1 1\n"
+              "-0----1-- 1\n"
+              "---1-1-0- 1\n"
+              ".names x0 x1 x2 g\n"
+              "0-0 0\n"
+              "10- 0\n"
+              ".names h\n"
+              "1\n"
+              ".end\n";
+  write_file( "mockturtle-test-read.blif", contents );
+
+  klut_network expected;
+  CHECK( lorina::read_blif( "mockturtle-test-read.blif", blif_reader( expected ) ) == lorina::return_code::success );
+
+  klut_network klut;
+  CHECK( read_blif( "mockturtle-test-read.blif", klut ) == lorina::return_code::success );
+  CHECK( klut.num_gates() == expected.num_gates() );
+
+  default_simulator<kitty::dynamic_truth_table> sim( 9u );
+  CHECK( simulate<kitty::dynamic_truth_table>( klut, sim ) == simulate<kitty::dynamic_truth_table>( expected, sim ) );
+
+  std::remove( "mockturtle-test-read.blif" );
+}
+
+TEST_CASE( "read a sequential BLIF file with the fast reader", "[read_blif]" )
+{
+  write_file( "mockturtle-test-read.blif", ".model top\n"
+                                           ".inputs clock a b c d\n"
+                                           ".outputs f\n"
+                                           ".latch     lo0_in        lo0  1\n"
+                                           ".latch     lo1_in        lo1  fe clock 0\n"
+                                           ".latch     lo2_in        lo2  ah clock 2\n"
+                                           ".names a lo1 new_n16_\n"
+                                           "01 1\n"
+                                           ".names d new_n16_ new_n17_\n"
+                                           "00 1\n"
+                                           ".names b lo2 new_n18_\n"
+                                           "00 1\n"
+                                           ".names new_n16_ new_n18_ new_n19_\n"
+                                           "00 1\n"
+                                           ".names new_n17_ new_n19_ new_n20_\n"
+                                           "00 1\n"
+                                           ".names lo0 new_n20_ lo1_in\n"
+                                           "01 1\n"
+                                           ".names a lo1_in lo0_in\n"
+                                           "10 1\n"
+                                           ".names c new_n18_ lo2_in\n"
+                                           "00 1\n"
+                                           ".names lo1_in f\n"
+                                           "0 1\n"
+                                           ".end\n" );
+
+  klut_network klut;
+  CHECK( read_blif( "mockturtle-test-read.blif", klut ) == lorina::return_code::success );
+  CHECK( klut.num_pis() == 5u );
+  CHECK( klut.num_pos() == 1u );
+  CHECK( klut.num_latches() == 3u );
+  CHECK( klut.num_gates() == 9u );
+
+  klut.foreach_ro( [&]( auto ro, auto i ) {
+    latch_info l_info = klut._storage->latch_information[ro];
+    switch ( i )
+    {
+    case 0:
+      CHECK( l_info.type == "re" );
+      CHECK( l_info.init == 1u );
+      CHECK( klut.latch_reset( i ) == 1 );
+      break;
+    case 1:
+      CHECK( l_info.type == "fe" );
+      CHECK( l_info.control == "clock" );
+      CHECK( l_info.init == 0u );
+      break;
+    case 2:
+      CHECK( l_info.type == "ah" );
+      CHECK( l_info.init == 2u );
+      break;
+    }
+  } );
+
+  std::remove( "mockturtle-test-read.blif" );
+}
+
+TEST_CASE( "reject malformed BLIF files in the fast reader", "[read_blif]" )
+{
+  klut_network klut;
+
+  write_file( "mockturtle-test-read.blif", ".model top\n.inputs a\n.outputs f\n.names a g f\n11 1\n.end\n" );
+  lorina::silent_diagnostic_engine diag;
+  CHECK( read_blif( "mockturtle-test-read.blif", klut, nullptr, &diag ) == lorina::return_code::parse_error );
+  CHECK( diag.number_of_diagnostics == 1u );
+
+  write_file( "mockturtle-test-read.blif", ".model top\n.inputs a\n.outputs f\n.names a g f\n11 1\n.names f g\n1 1\n.end\n" );
+  CHECK( read_blif( "mockturtle-test-read.blif", klut ) == lorina::return_code::parse_error );
+
+  write_file( "mockturtle-test-read.blif", ".model top\n.inputs a b\n.outputs f\n.names a b f\n1 1\n.end\n" );
+  CHECK( read_blif( "mockturtle-test-read.blif", klut ) == lorina::return_code::parse_error );
+
+  /* the function of the first cover is not added to the network */
+  klut_network klut_cache;
+  const auto cache_size = klut_cache._storage->data.cache.size();
+  write_file( "mockturtle-test-read.blif", ".model top\n.inputs a b\n.outputs f\n.names a b g\n11 1\n.names a g f\n1- 1\n.names g f\n.end\n" );
+  CHECK( read_blif( "mockturtle-test-read.blif", klut_cache ) == lorina::return_code::parse_error );
+  CHECK( klut_cache._storage->data.cache.size() == cache_size );
+  CHECK( klut_cache.size() == 2u );
+
+  std::remove( "mockturtle-test-read.blif" );
+}
@@ -0,0 +1,115 @@
+#include <catch.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include <kitty/static_truth_table.hpp>
+#include <mockturtle/algorithms/simulation.hpp>
+#include <mockturtle/io/bristol_reader.hpp>
+#include <mockturtle/io/read_bristol.hpp>
+#include <mockturtle/networks/xag.hpp>
+
+#include <lorina/bristol.hpp>
+#include <lorina/diagnostics.hpp>
+
+using namespace mockturtle;
+
+static void write_file( std::string const& filename, std::string const& contents )
+{
+  std::ofstream os( filename.c_str(), std::ofstream::out | std::ofstream::binary );
+  os << contents;
+}
+
+TEST_CASE( "read a Bristol circuit with the fast reader", "[read_bristol]" )
+{
+  const std::string gates = "2 1 0 1 3 AND\n"
+                            "2 1 1 2 4 XOR\n"
+                            "1 1 3 6 INV\n"
+                            "2 1 4 6 7 XOR\n";
+
+  /* Bristol Fashion */
+  write_file( "mockturtle-test-read.txt", "4 8\n2 2 1\n1 2\n\n" + gates );
+
+  xag_network expected;
+  CHECK( lorina::read_bristol( "mockturtle-test-read.txt", bristol_reader( expected ) ) == lorina::return_code::success );
+
+  xag_network xag;
+  CHECK( read_bristol( "mockturtle-test-read.txt", xag ) == lorina::return_code::success );
+  CHECK( xag.num_pis() == 3u );
+  CHECK( xag.num_pos() == 2u );
+  CHECK( xag.num_gates() == expected.num_gates() );
+  CHECK( simulate<kitty::static_truth_table<3u>>( xag ) == simulate<kitty::static_truth_table<3u>>( expected ) );
+
+  /* original format */
+  write_file( "mockturtle-test-read.txt", "4 8\n2 1 2\n\n" + gates );
+
+  xag_network xag_old;
+  CHECK( read_bristol( "mockturtle-test-read.txt", xag_old ) == lorina::return_code::success );
+  CHECK( xag_old.num_pis() == 3u );
+  CHECK( xag_old.num_pos() == 2u );
+  CHECK( simulate<kitty::static_truth_table<3u>>( xag_old ) == simulate<kitty::static_truth_table<3u>>( expected ) );
+
+  std::remove( "mockturtle-test-read.txt" );
+}
+
+TEST_CASE( "read a Bristol Fashion circuit with the fast reader", "[read_bristol]" )
+{
+  /* y0 = x0 & x2, y1 = x1 & x3, y2 = ~x0, y3 = 1 */
+  write_file( "mockturtle-test-read.txt", "4 10\r\n"
+                                          "2 2 2\r\n"
+                                          "2 2 2\r\n"
+                                          "\r\n"
+                                          "4 2 0 1 2 3 6 7 MAND\r\n"
+                                          "1 1 0 4 INV\r\n"
+                                          "1 1 1 5 EQ\r\n"
+                                          "1 1 4 8 EQW\r\n"
+                                          "1 1 5 9 EQW\r\n" );
+
+  xag_network xag;
+  CHECK( read_bristol( "mockturtle-test-read.txt", xag ) == lorina::return_code::success );
+  CHECK( xag.num_pis() == 4u );
+  CHECK( xag.num_pos() == 4u );
+  CHECK( xag.num_gates() == 2u );
+
+  const auto tts = simulate<kitty::static_truth_table<4u>>( xag );
+  CHECK( tts[0]._bits == 0xa0a0u );
+  CHECK( tts[1]._bits == 0xcc00u );
+  CHECK( tts[2]._bits == 0x5555u );
+  CHECK( tts[3]._bits == 0xffffu );
+
+  std::remove( "mockturtle-test-read.txt" );
+}
+
+TEST_CASE( "reject malformed Bristol circuits in the fast reader", "[read_bristol]" )
+{
+  xag_network xag;
+
+  /* wire 3 is used before it is assigned */
+  write_file( "mockturtle-test-read.txt", "2 5\n1 1 1\n2 1 0 3 4 AND\n2 1 0 1 3 XOR\n" );
+  CHECK( read_bristol( "mockturtle-test-read.txt", xag ) == lorina::return_code::parse_error );
+
+  write_file( "mockturtle-test-read.txt", "1 4\n1 1 1\n2 1 0 1 3 NAND\n" );
+  lorina::silent_diagnostic_engine diag;
+  CHECK( read_bristol( "mockturtle-test-read.txt", xag, &diag ) == lorina::return_code::parse_error );
+  CHECK( diag.number_of_diagnostics == 1u );
+
+  write_file( "mockturtle-test-read.txt", "1 4\n1 1 1\n2 1 0 1 7 AND\n" );
+  CHECK( read_bristol( "mockturtle-test-read.txt", xag ) == lorina::return_code::parse_error );
+
+  write_file( "mockturtle-test-read.txt", "1 4\n1 1 1\n2 1 0 1\n" );
+  CHECK( read_bristol( "mockturtle-test-read.txt", xag ) == lorina::return_code::parse_error );
+
+  /* counts in the header that do not fit the file size */
+  write_file( "mockturtle-test-read.txt", "1 18446744073709551000\n1 1 1\n2 1 0 1 2 AND\n" );
+  CHECK( read_bristol( "mockturtle-test-read.txt", xag ) == lorina::return_code::parse_error );
+
+  write_file( "mockturtle-test-read.txt", "4000000000000 3\n1 1 1\n2 1 0 1 2 AND\n" );
+  CHECK( read_bristol( "mockturtle-test-read.txt", xag ) == lorina::return_code::parse_error );
+
+  /* the number of inputs overflows */
+  write_file( "mockturtle-test-read.txt", "1 3\n2 18446744073709551615 3\n1 1\n2 1 0 1 2 AND\n" );
+  CHECK( read_bristol( "mockturtle-test-read.txt", xag ) == lorina::return_code::parse_error );
+
+  std::remove( "mockturtle-test-read.txt" );
+}
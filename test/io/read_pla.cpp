@@ -0,0 +1,166 @@
+#include <catch.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include <kitty/dynamic_truth_table.hpp>
+#include <kitty/static_truth_table.hpp>
+#include <mockturtle/algorithms/simulation.hpp>
+#include <mockturtle/io/pla_reader.hpp>
+#include <mockturtle/io/read_pla.hpp>
+#include <mockturtle/networks/aig.hpp>
+#include <mockturtle/networks/klut.hpp>
+#include <mockturtle/networks/xag.hpp>
+
+#include <lorina/diagnostics.hpp>
+#include <lorina/pla.hpp>
+
+using namespace mockturtle;
+
+static void write_file( std::string const& filename, std::string const& contents )
+{
+  std::ofstream os( filename.c_str(), std::ofstream::out | std::ofstream::binary );
+  os << contents;
+}
+
+TEST_CASE( "read a PLA file with the parallel reader", "[read_pla]" )
+{
+  write_file( "mockturtle-test-read.pla", "# example\n"
+                                          ".i 3\n"
+                                          ".o 2\n"
+                                          ".ilb a b c\n"
+                                          ".p 3\n"
+                                          "1-1 11\n"
+                                          "00- 10\n"
+                                          "-11 01\n"
+                                          ".e\n"
+                                          "111 11\n" );
+
+  pla_cover cover;
+  CHECK( read_pla_cover( "mockturtle-test-read.pla", cover ) == lorina::return_code::success );
+  CHECK( cover.num_inputs == 3u );
+  CHECK( cover.num_outputs == 2u );
+  CHECK( !cover.is_esop );
+  CHECK( cover.num_cubes == 3u );
+  CHECK( cover.output_cubes( 0u ) == std::vector<kitty::cube>{kitty::cube( "1-1" ), kitty::cube( "00-" )} );
+  CHECK( cover.output_cubes( 1u ) == std::vector<kitty::cube>{kitty::cube( "1-1" ), kitty::cube( "-11" )} );
+
+  xag_network xag;
+  CHECK( read_pla( "mockturtle-test-read.pla", xag ) == lorina::return_code::success );
+  CHECK( xag.num_pis() == 3u );
+  CHECK( xag.num_pos() == 2u );
+  CHECK( xag.num_gates() == 5u );
+  CHECK( simulate<kitty::static_truth_table<3u>>( xag )[0]._bits == 0xb1u );
+  CHECK( simulate<kitty::static_truth_table<3u>>( xag )[1]._bits == 0xe0u );
+
+  read_pla_params ps;
+  ps.lut_size = 2u;
+  klut_network klut;
+  CHECK( read_pla( "mockturtle-test-read.pla", klut, ps ) == lorina::return_code::success );
+  CHECK( klut.num_pis() == 3u );
+  CHECK( klut.num_pos() == 2u );
+  klut.foreach_gate( [&]( auto const& n ) { CHECK( klut.fanin_size( n ) <= 2u ); } );
+  CHECK( simulate<kitty::static_truth_table<3u>>( klut )[0]._bits == 0xb1u );
+  CHECK( simulate<kitty::static_truth_table<3u>>( klut )[1]._bits == 0xe0u );
+
+  /* the node functions would be too large */
+  ps.lut_size = 17u;
+  klut_network klut_large;
+  lorina::silent_diagnostic_engine diag;
+  CHECK( read_pla( "mockturtle-test-read.pla", klut_large, ps, &diag ) == lorina::return_code::parse_error );
+  CHECK( diag.number_of_diagnostics == 1u );
+  CHECK( klut_large.num_pis() == 0u );
+
+  /* the number of cubes in the header is ignored */
+  write_file( "mockturtle-test-read.pla", ".i 3\n.o 2\n.p 1000000000000\n1-1 11\n.e\n" );
+  CHECK( read_pla_cover( "mockturtle-test-read.pla", cover ) == lorina::return_code::success );
+  CHECK( cover.num_cubes == 1u );
+
+  std::remove( "mockturtle-test-read.pla" );
+}
+
+TEST_CASE( "read an ESOP PLA file with the parallel reader", "[read_pla]" )
+{
+  write_file( "mockturtle-test-read.pla", ".i 3\n"
+                                          ".o 1\n"
+                                          ".type esop\n"
+                                          "1-- 1\n"
+                                          "-1- 1\n"
+                                          "11- 1\n"
+                                          "--- 1\n" );
+
+  /* a | b, complemented */
+  const uint64_t expected = 0x11u;
+  for ( auto minimize_esop : {false, true} )
+  {
+    read_pla_params ps;
+    ps.minimize_esop = minimize_esop;
+
+    aig_network aig;
+    CHECK( read_pla( "mockturtle-test-read.pla", aig, ps ) == lorina::return_code::success );
+    CHECK( simulate<kitty::static_truth_table<3u>>( aig )[0]._bits == expected );
+    if ( minimize_esop )
+    {
+      CHECK( aig.num_gates() <= 2u );
+    }
+
+    klut_network klut;
+    CHECK( read_pla( "mockturtle-test-read.pla", klut, ps ) == lorina::return_code::success );
+    CHECK( simulate<kitty::static_truth_table<3u>>( klut )[0]._bits == expected );
+  }
+
+  std::remove( "mockturtle-test-read.pla" );
+}
+
+TEST_CASE( "read a PLA file in several chunks", "[read_pla]" )
+{
+  std::string contents = ".i 70\n.o 3\n";
+  for ( auto c = 0u; c < 200u; ++c )
+  {
+    for ( auto i = 0u; i < 70u; ++i )
+    {
+      const auto r = ( c * 7u + i * 13u + c * i ) % 23u;
+      contents += r == 0u ? '0' : ( r == 1u ? '1' : '-' );
+    }
+    contents += ' ';
+    for ( auto o = 0u; o < 3u; ++o )
+    {
+      contents += ( c + o ) % 3u == 0u ? '0' : '1';
+    }
+    contents += '\n';
+  }
+  contents += ".e\n";
+  write_file( "mockturtle-test-read.pla", contents );
+
+  xag_network expected;
+  CHECK( lorina::read_pla( "mockturtle-test-read.pla", pla_reader( expected ) ) == lorina::return_code::success );
+
+  read_pla_params ps;
+  ps.num_threads = 4u;
+  ps.min_chunk_size = 100u;
+  aig_network aig;
+  CHECK( read_pla( "mockturtle-test-read.pla", aig, ps ) == lorina::return_code::success );
+  CHECK( aig.num_pis() == 70u );
+  CHECK( aig.num_pos() == 3u );
+
+  for ( auto r = 0u; r < 64u; ++r )
+  {
+    std::vector<bool> assignment( 70u );
+    for ( auto i = 0u; i < 70u; ++i )
+    {
+      assignment[i] = ( ( r * 37u + i * 11u ) % 7u ) < 4u;
+    }
+    default_simulator<bool> sim( assignment );
+    CHECK( simulate<bool>( aig, sim ) == simulate<bool>( expected, sim ) );
+  }
+
+  /* incomplete cube */
+  write_file( "mockturtle-test-read.pla", ".i 3\n.o 1\n1-1\n" );
+  aig_network incomplete;
+  lorina::silent_diagnostic_engine diag;
+  CHECK( read_pla( "mockturtle-test-read.pla", incomplete, {}, &diag ) == lorina::return_code::parse_error );
+  CHECK( diag.number_of_diagnostics == 1u );
+
+  std::remove( "mockturtle-test-read.pla" );
+}
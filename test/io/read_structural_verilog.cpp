@@ -0,0 +1,126 @@
+#include <catch.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include <kitty/dynamic_truth_table.hpp>
+#include <lorina/diagnostics.hpp>
+#include <lorina/verilog.hpp>
+#include <mockturtle/algorithms/simulation.hpp>
+#include <mockturtle/generators/arithmetic.hpp>
+#include <mockturtle/io/read_structural_verilog.hpp>
+#include <mockturtle/io/verilog_reader.hpp>
+#include <mockturtle/io/write_verilog.hpp>
+#include <mockturtle/networks/aig.hpp>
+#include <mockturtle/networks/mig.hpp>
+#include <mockturtle/networks/xag.hpp>
+#include <mockturtle/networks/xmg.hpp>
+
+using namespace mockturtle;
+
+template<class Ntk>
+static void check_same_as_verilog_reader( std::string const& filename, uint32_t num_threads )
+{
+  Ntk expected;
+  CHECK( lorina::read_verilog( filename, verilog_reader( expected ) ) == lorina::return_code::success );
+
+  read_structural_verilog_params ps;
+  ps.num_threads = num_threads;
+  ps.min_chunk_size = 1u;
+
+  Ntk ntk;
+  CHECK( read_structural_verilog( filename, ntk, ps ) == lorina::return_code::success );
+  CHECK( ntk.num_pis() == expected.num_pis() );
+  CHECK( ntk.num_pos() == expected.num_pos() );
+  CHECK( ntk.size() == expected.size() );
+
+  /* same nodes in the same order */
+  ntk.foreach_gate( [&]( auto const& n ) {
+    expected.foreach_fanin( n, [&]( auto const& f, auto i ) {
+      CHECK( ntk._storage->nodes[n].children[i].data == f.data );
+    } );
+  } );
+  ntk.foreach_po( [&]( auto const& f, auto i ) {
+    CHECK( f == expected.po_at( i ) );
+  } );
+}
+
+static void write_file( std::string const& filename, std::string const& contents )
+{
+  std::ofstream os( filename.c_str(), std::ofstream::out );
+  os << contents;
+}
+
+TEST_CASE( "read structural Verilog written by write_verilog", "[read_structural_verilog]" )
+{
+  xmg_network xmg;
+  std::vector<xmg_network::signal> a( 8u ), b( 8u );
+  std::generate( a.begin(), a.end(), [&]() { return xmg.create_pi(); } );
+  std::generate( b.begin(), b.end(), [&]() { return xmg.create_pi(); } );
+  auto carry = xmg.get_constant( false );
+  carry_ripple_adder_inplace( xmg, a, b, carry );
+  std::for_each( a.begin(), a.end(), [&]( auto const& f ) { xmg.create_po( f ); } );
+  xmg.create_po( !carry );
+  xmg.create_po( xmg.create_xor3( a[0], !b[1], b[2] ) );
+  xmg.create_po( xmg.get_constant( true ) );
+
+  write_verilog( xmg, "mockturtle-test-structural.v" );
+  for ( auto num_threads : {1u, 4u} )
+  {
+    check_same_as_verilog_reader<xmg_network>( "mockturtle-test-structural.v", num_threads );
+    check_same_as_verilog_reader<mig_network>( "mockturtle-test-structural.v", num_threads );
+    check_same_as_verilog_reader<aig_network>( "mockturtle-test-structural.v", num_threads );
+  }
+
+  /* registers */
+  write_verilog_params ps;
+  ps.input_names = {{"a", 8u}, {"b", 8u}};
+  ps.output_names = {{"s", 8u}, {"c", 3u}};
+  write_verilog( xmg, "mockturtle-test-structural.v", ps );
+  check_same_as_verilog_reader<xag_network>( "mockturtle-test-structural.v", 3u );
+
+  std::remove( "mockturtle-test-structural.v" );
+}
+
+TEST_CASE( "read structural Verilog with assignments out of order", "[read_structural_verilog]" )
+{
+  write_file( "mockturtle-test-structural.v", "module top( x0 , x1 , x2 , y0 ) ;\n"
+                                              "  input x0 , x1 , x2 ;\n"
+                                              "  output y0 ;\n"
+                                              "  wire n4 , n5 ;\n"
+                                              "  assign y0 = ~n5 ;\n"
+                                              "  assign n5 = n4 | ~x2 ;\n"
+                                              "  assign n4 = x0 & x1 ;\n"
+                                              "endmodule\n" );
+
+  aig_network aig;
+  CHECK( read_structural_verilog( "mockturtle-test-structural.v", aig ) == lorina::return_code::success );
+  CHECK( aig.num_pis() == 3u );
+  CHECK( aig.num_pos() == 1u );
+  CHECK( aig.num_gates() == 2u );
+  CHECK( simulate<kitty::dynamic_truth_table>( aig, {3u} )[0]._bits[0] == 0x70 );
+
+  std::remove( "mockturtle-test-structural.v" );
+}
+
+TEST_CASE( "reject unsupported structural Verilog", "[read_structural_verilog]" )
+{
+  for ( auto const& body : {std::string( "  assign n4 = x0 & x1 & x2 ;\n" ),
+                            std::string( "  assign n4 = n5 & x1 ;\n  assign n5 = n4 & x0 ;\n" ),
+                            std::string( "  adder a1( .a( x0 ), .b( x1 ), .c( n4 ) ) ;\n" )} )
+  {
+    write_file( "mockturtle-test-structural.v", "module top( x0 , x1 , x2 , y0 ) ;\n"
+                                                "  input x0 , x1 , x2 ;\n"
+                                                "  output y0 ;\n" +
+                                                    body +
+                                                    "  assign y0 = n4 ;\n"
+                                                    "endmodule\n" );
+    aig_network aig;
+    lorina::silent_diagnostic_engine diag;
+    CHECK( read_structural_verilog( "mockturtle-test-structural.v", aig, {}, &diag ) == lorina::return_code::parse_error );
+    CHECK( diag.number_of_diagnostics == 1u );
+  }
+
+  std::remove( "mockturtle-test-structural.v" );
+}
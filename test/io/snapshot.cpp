@@ -0,0 +1,200 @@
+#include <catch.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include <kitty/constructors.hpp>
+#include <kitty/dynamic_truth_table.hpp>
+#include <mockturtle/algorithms/simulation.hpp>
+#include <mockturtle/generators/arithmetic.hpp>
+#include <mockturtle/io/snapshot.hpp>
+#include <mockturtle/networks/aig.hpp>
+#include <mockturtle/networks/klut.hpp>
+#include <mockturtle/networks/mig.hpp>
+#include <mockturtle/networks/xag.hpp>
+#include <mockturtle/views/names_view.hpp>
+
+using namespace mockturtle;
+
+template<class Ntk>
+static void check_same_storage( Ntk const& ntk, Ntk const& loaded )
+{
+  auto const& a = *ntk._storage;
+  auto const& b = *loaded._storage;
+
+  CHECK( a.nodes.size() == b.nodes.size() );
+  for ( auto i = 0u; i < std::min( a.nodes.size(), b.nodes.size() ); ++i )
+  {
+    CHECK( a.nodes[i].children == b.nodes[i].children );
+    for ( auto j = 0u; j < a.nodes[i].data.size(); ++j )
+    {
+      CHECK( a.nodes[i].data[j].n == b.nodes[i].data[j].n );
+    }
+  }
+  CHECK( a.inputs == b.inputs );
+  CHECK( a.outputs == b.outputs );
+  CHECK( a.hash.size() == b.hash.size() );
+  CHECK( a.data.num_pis == b.data.num_pis );
+  CHECK( a.data.num_pos == b.data.num_pos );
+  CHECK( a.data.latches == b.data.latches );
+}
+
+template<class Ntk>
+static Ntk create_adder()
+{
+  Ntk ntk;
+  std::vector<typename Ntk::signal> a( 4u ), b( 4u );
+  std::generate( a.begin(), a.end(), [&]() { return ntk.create_pi(); } );
+  std::generate( b.begin(), b.end(), [&]() { return ntk.create_pi(); } );
+  auto carry = ntk.get_constant( false );
+  carry_ripple_adder_inplace( ntk, a, b, carry );
+  std::for_each( a.begin(), a.end(), [&]( auto const& f ) { ntk.create_po( f ); } );
+  ntk.create_po( !carry );
+  return ntk;
+}
+
+TEST_CASE( "write and read snapshots of networks", "[snapshot]" )
+{
+  /* AIG with dead nodes */
+  auto aig = create_adder<aig_network>();
+  aig.substitute_node( aig.get_node( aig.po_at( 0 ) ), aig.get_constant( true ) );
+  write_snapshot( aig, "mockturtle-test-snapshot.bin" );
+
+  aig_network aig2;
+  CHECK( read_snapshot( "mockturtle-test-snapshot.bin", aig2 ) );
+  check_same_storage( aig, aig2 );
+  CHECK( simulate<kitty::dynamic_truth_table>( aig, {8u} ) == simulate<kitty::dynamic_truth_table>( aig2, {8u} ) );
+
+  /* structural hashing works after loading */
+  const auto size = aig2.size();
+  aig2.foreach_gate( [&]( auto const& n ) {
+    std::vector<aig_network::signal> children;
+    aig2.foreach_fanin( n, [&]( auto const& f ) { children.push_back( f ); } );
+    CHECK( aig2.create_and( children[0], children[1] ) == aig2.make_signal( n ) );
+  } );
+  CHECK( aig2.size() == size );
+
+  /* MIG */
+  auto mig = create_adder<mig_network>();
+  write_snapshot( mig, "mockturtle-test-snapshot.bin" );
+  mig_network mig2;
+  CHECK( read_snapshot( "mockturtle-test-snapshot.bin", mig2 ) );
+  check_same_storage( mig, mig2 );
+
+  /* snapshots of other network types are rejected */
+  xag_network xag;
+  CHECK( !read_snapshot( "mockturtle-test-snapshot.bin", xag ) );
+
+  std::remove( "mockturtle-test-snapshot.bin" );
+}
+
+TEST_CASE( "snapshots with latches and names", "[snapshot]" )
+{
+  names_view<xag_network> xag;
+  const auto a = xag.create_pi( "a" );
+  const auto s = xag.create_ro();
+  xag.set_name( s, "state" );
+  const auto f = xag.create_xor( a, s );
+  xag.set_name( !f, "nf" );
+  xag.create_po( !f, "out" );
+  xag.create_ri( f, 1 );
+
+  write_snapshot( xag, "mockturtle-test-snapshot.bin" );
+  names_view<xag_network> xag2;
+  CHECK( read_snapshot( "mockturtle-test-snapshot.bin", xag2 ) );
+  check_same_storage<xag_network>( xag, xag2 );
+  CHECK( xag2.num_latches() == 1u );
+  CHECK( xag2.latch_reset( 0u ) == 1 );
+  CHECK( xag2.get_name( a ) == "a" );
+  CHECK( xag2.get_name( s ) == "state" );
+  CHECK( xag2.get_name( !f ) == "nf" );
+  CHECK( !xag2.has_name( f ) );
+  CHECK( xag2.get_output_name( 0u ) == "out" );
+
+  std::remove( "mockturtle-test-snapshot.bin" );
+}
+
+TEST_CASE( "snapshots of k-LUT networks", "[snapshot]" )
+{
+  klut_network klut;
+  const auto a = klut.create_pi();
+  const auto b = klut.create_pi();
+  const auto c = klut.create_pi();
+  kitty::dynamic_truth_table maj( 3u );
+  kitty::create_majority( maj );
+  klut.create_po( klut.create_node( {a, b, c}, maj ) );
+  klut.create_po( klut.create_node( {a, b, c}, ~maj ) );
+  klut.create_po( klut.create_xor( a, b ) );
+
+  write_snapshot( klut, "mockturtle-test-snapshot.bin" );
+  klut_network klut2;
+  CHECK( read_snapshot( "mockturtle-test-snapshot.bin", klut2 ) );
+  check_same_storage( klut, klut2 );
+  CHECK( klut2._storage->data.cache.size() == klut._storage->data.cache.size() );
+  CHECK( simulate<kitty::dynamic_truth_table>( klut, {3u} ) == simulate<kitty::dynamic_truth_table>( klut2, {3u} ) );
+
+  /* truncated snapshots are rejected */
+  std::string contents;
+  {
+    std::ifstream is( "mockturtle-test-snapshot.bin", std::ifstream::binary );
+    contents.assign( std::istreambuf_iterator<char>( is ), std::istreambuf_iterator<char>() );
+  }
+  for ( auto size : {contents.size() / 2u, contents.size() - 8u} )
+  {
+    {
+      std::ofstream os( "mockturtle-test-snapshot.bin", std::ofstream::binary );
+      os.write( contents.data(), size );
+    }
+    klut_network klut3;
+    CHECK( !read_snapshot( "mockturtle-test-snapshot.bin", klut3 ) );
+    CHECK( klut3.size() == 2u );
+  }
+
+  std::remove( "mockturtle-test-snapshot.bin" );
+}
+
+TEST_CASE( "snapshots replace names and check counts", "[snapshot]" )
+{
+  names_view<xag_network> xag;
+  const auto a = xag.create_pi( "a" );
+  const auto b = xag.create_pi();
+  xag.create_po( xag.create_and( a, b ), "and" );
+  write_snapshot( xag, "mockturtle-test-snapshot.bin" );
+
+  /* names of the previous network are removed */
+  names_view<xag_network> xag2;
+  const auto c = xag2.create_pi( "c" );
+  const auto d = xag2.create_pi( "d" );
+  xag2.create_po( xag2.create_or( c, d ), "or" );
+  xag2.create_po( c, "c_out" );
+  CHECK( read_snapshot( "mockturtle-test-snapshot.bin", xag2 ) );
+  CHECK( xag2.get_name( a ) == "a" );
+  CHECK( !xag2.has_name( b ) );
+  CHECK( xag2.get_output_name( 0u ) == "and" );
+  CHECK( !xag2.has_output_name( 1u ) );
+
+  /* the network type is identified by its tag, not by its node size */
+  aig_network aig;
+  CHECK( !read_snapshot( "mockturtle-test-snapshot.bin", aig ) );
+  CHECK( aig.size() == 1u );
+
+  /* the numbers of primary inputs and outputs must match the inputs and outputs */
+  xag_network xag3;
+  xag3.create_po( xag3.create_pi() );
+  xag3._storage->data.num_pis = 2u;
+  write_snapshot( xag3, "mockturtle-test-snapshot.bin" );
+  xag_network xag4;
+  CHECK( !read_snapshot( "mockturtle-test-snapshot.bin", xag4 ) );
+  xag3._storage->data.num_pis = 1u;
+  xag3._storage->data.num_pos = 2u;
+  write_snapshot( xag3, "mockturtle-test-snapshot.bin" );
+  CHECK( !read_snapshot( "mockturtle-test-snapshot.bin", xag4 ) );
+  CHECK( xag4.size() == 1u );
+  xag3._storage->data.num_pos = 1u;
+  write_snapshot( xag3, "mockturtle-test-snapshot.bin" );
+  CHECK( read_snapshot( "mockturtle-test-snapshot.bin", xag4 ) );
+  CHECK( xag4.num_pis() == 1u );
+
+  std::remove( "mockturtle-test-snapshot.bin" );
+}
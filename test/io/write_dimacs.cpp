@@ -40,3 +40,47 @@ TEST_CASE( "write XAG into DIMACS", "[write_dimacs]" )
                       "5 6 7 0\n"
                       "-7 0\n" );
 }
+
+TEST_CASE( "write cone of influence of XAG outputs into DIMACS", "[write_dimacs]" )
+{
+  xag_network xag;
+
+  const auto a = xag.create_pi();
+  const auto b = xag.create_pi();
+  const auto c = xag.create_pi();
+
+  const auto f1 = xag.create_and( a, b );
+  const auto f2 = xag.create_xor( b, c );
+  const auto f3 = xag.create_and( f2, !c );
+
+  xag.create_po( f1 );
+  xag.create_po( !f3 );
+
+  write_dimacs_params ps;
+  ps.outputs = {1u};
+  write_dimacs_stats st;
+
+  std::ostringstream out;
+  write_dimacs( xag, out, ps, &st );
+
+  /* f1 is not in the cone, f2 and f3 get variables 5 and 6 */
+  CHECK( out.str() == "p cnf 6 9\n"
+                      "-1 0\n"
+                      "-4 -3 -5 0\n"
+                      "-4 3 5 0\n"
+                      "4 -3 5 0\n"
+                      "4 3 -5 0\n"
+                      "-4 -6 0\n"
+                      "5 -6 0\n"
+                      "4 -5 6 0\n"
+                      "-6 0\n" );
+  CHECK( st.num_variables == 6u );
+  CHECK( st.num_clauses == 9u );
+
+  ps.outputs.clear();
+  out.str( "" );
+  write_dimacs( xag, out, ps, &st );
+  CHECK( st.num_variables == 7u );
+  CHECK( st.num_clauses == 13u );
+  CHECK( out.str().substr( 0, 11 ) == "p cnf 7 13\n" );
+}
@@ -1,7 +1,11 @@
 #include <catch.hpp>
 
+#include <cstdio>
+#include <fstream>
 #include <sstream>
+#include <vector>
 
+#include <mockturtle/io/binary_patterns.hpp>
 #include <mockturtle/io/write_patterns.hpp>
 #include <mockturtle/algorithms/simulation.hpp>
 
@@ -30,3 +34,133 @@ TEST_CASE( "write patterns", "[write_patterns]" )
                       "0d4\n"
                       "19a\n" );
 }
+
+TEST_CASE( "write and append binary patterns", "[write_patterns]" )
+{
+  partial_simulator sim( 3, 0 );
+  sim.add_pattern( {0, 0, 0} );
+  sim.add_pattern( {0, 0, 1} );
+  sim.add_pattern( {0, 1, 0} );
+  sim.add_pattern( {1, 0, 1} );
+  sim.add_pattern( {1, 1, 1} );
+
+  CHECK( write_binary_patterns( sim, "mockturtle-test.bpat" ) );
+  CHECK( is_binary_patterns_file( "mockturtle-test.bpat" ) );
+
+  partial_simulator loaded( "mockturtle-test.bpat" );
+  CHECK( loaded.num_bits() == 5u );
+  CHECK( loaded.get_patterns() == sim.get_patterns() );
+
+  /* append counter-examples in blocks, first growing the rows and then in place */
+  auto num_saved = sim.num_bits();
+  for ( auto i = 0u; i < 200u; ++i )
+  {
+    sim.add_pattern( {i % 2u == 0u, i % 3u == 0u, i % 5u == 0u} );
+    if ( i % 7u == 6u || i == 199u )
+    {
+      CHECK( append_binary_patterns( sim, "mockturtle-test.bpat", num_saved ) );
+      num_saved = sim.num_bits();
+
+      partial_simulator appended( "mockturtle-test.bpat" );
+      CHECK( appended.num_bits() == sim.num_bits() );
+      CHECK( appended.get_patterns() == sim.get_patterns() );
+    }
+  }
+
+  partial_simulator prefix( "mockturtle-test.bpat", 10u );
+  CHECK( prefix.num_bits() == 10u );
+  for ( auto i = 0u; i < 3u; ++i )
+  {
+    auto expected = sim.get_patterns()[i];
+    expected.resize( 10 );
+    CHECK( prefix.get_patterns()[i] == expected );
+  }
+
+  /* the number of inputs must match */
+  partial_simulator other( 4, 10 );
+  CHECK( !append_binary_patterns( other, "mockturtle-test.bpat", 0u ) );
+
+  std::remove( "mockturtle-test.bpat" );
+}
+
+TEST_CASE( "appended binary patterns leave unused bits clear", "[write_patterns]" )
+{
+  /* the first input is always 1, the others are always 0 */
+  partial_simulator sim( 3, 0 );
+  const auto add_patterns = [&]( uint32_t count ) {
+    for ( auto i = 0u; i < count; ++i )
+    {
+      sim.add_pattern( {true, false, false} );
+    }
+  };
+  add_patterns( 10u );
+  CHECK( write_binary_patterns( sim, "mockturtle-test.bpat" ) );
+
+  /* the rows grow to 2 and 4 words, and the last block spans two words in place */
+  for ( auto count : {60u, 100u, 80u} )
+  {
+    const auto num_saved = sim.num_bits();
+    add_patterns( count );
+    CHECK( append_binary_patterns( sim, "mockturtle-test.bpat", num_saved ) );
+  }
+
+  std::ifstream is( "mockturtle-test.bpat", std::ifstream::in | std::ifstream::binary );
+  detail::binary_patterns_header header;
+  is.read( reinterpret_cast<char*>( &header ), sizeof( header ) );
+  REQUIRE( header.num_patterns == 250u );
+  REQUIRE( header.row_words == 4u );
+  std::vector<uint64_t> rows( header.num_pis * header.row_words );
+  is.read( reinterpret_cast<char*>( rows.data() ), rows.size() * 8u );
+  REQUIRE( is );
+
+  for ( auto i = 0u; i < header.num_pis; ++i )
+  {
+    for ( auto w = 0u; w < header.row_words; ++w )
+    {
+      const auto used = std::min<uint64_t>( 64u, header.num_patterns > 64u * w ? header.num_patterns - 64u * w : 0u );
+      const auto mask = used == 64u ? ~uint64_t( 0 ) : ( uint64_t( 1 ) << used ) - 1u;
+      CHECK( rows[i * header.row_words + w] == ( i == 0u ? mask : 0u ) );
+    }
+  }
+
+  std::remove( "mockturtle-test.bpat" );
+}
+
+TEST_CASE( "partial simulator from an invalid pattern file", "[write_patterns]" )
+{
+  partial_simulator sim( 3, 0 );
+  sim.add_pattern( {0, 1, 0} );
+  CHECK( write_binary_patterns( sim, "mockturtle-test.bpat" ) );
+
+  /* truncate the rows */
+  {
+    std::ifstream is( "mockturtle-test.bpat", std::ifstream::in | std::ifstream::binary );
+    std::vector<char> header( sizeof( detail::binary_patterns_header ) );
+    is.read( header.data(), header.size() );
+    is.close();
+    std::ofstream os( "mockturtle-test.bpat", std::ofstream::out | std::ofstream::binary | std::ofstream::trunc );
+    os.write( header.data(), header.size() );
+  }
+  CHECK( is_binary_patterns_file( "mockturtle-test.bpat" ) );
+  partial_simulator truncated( "mockturtle-test.bpat" );
+  CHECK( truncated.num_bits() == 0u );
+  CHECK( truncated.get_patterns().empty() );
+
+  /* rows without words */
+  {
+    detail::binary_patterns_header header;
+    header.num_pis = uint64_t( 1 ) << 60u;
+    std::ofstream os( "mockturtle-test.bpat", std::ofstream::out | std::ofstream::binary | std::ofstream::trunc );
+    os.write( reinterpret_cast<char const*>( &header ), sizeof( header ) );
+  }
+  std::vector<kitty::partial_truth_table> patterns;
+  CHECK( !read_binary_patterns( "mockturtle-test.bpat", patterns ) );
+
+  {
+    std::ofstream os( "mockturtle-test.bpat", std::ofstream::out | std::ofstream::trunc );
+  }
+  partial_simulator empty( "mockturtle-test.bpat" );
+  CHECK( empty.num_bits() == 0u );
+
+  std::remove( "mockturtle-test.bpat" );
+}
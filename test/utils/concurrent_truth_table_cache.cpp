@@ -0,0 +1,90 @@
+#include <catch.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <kitty/constructors.hpp>
+#include <kitty/dynamic_truth_table.hpp>
+#include <kitty/static_truth_table.hpp>
+#include <mockturtle/utils/concurrent_truth_table_cache.hpp>
+
+using namespace mockturtle;
+
+TEST_CASE( "NPN normalizing truth table cache", "[concurrent_truth_table_cache]" )
+{
+  concurrent_truth_table_cache<kitty::static_truth_table<3>> cache;
+
+  kitty::static_truth_table<3> maj, f_and, f_or;
+  kitty::create_majority( maj );
+  kitty::create_from_hex_string( f_and, "80" );
+  kitty::create_from_hex_string( f_or, "fe" );
+
+  const auto e1 = cache.insert( maj );
+  const auto e2 = cache.insert( ~maj );
+  CHECK( e1.index == e2.index );
+  CHECK( cache.size() == 1u );
+
+  const auto e3 = cache.insert( f_and );
+  const auto e4 = cache.insert( f_or );
+  CHECK( e3.index == e4.index );
+  CHECK( e1.index != e3.index );
+  CHECK( cache.size() == 2u );
+
+  CHECK( cache.get( e1 ) == maj );
+  CHECK( cache.get( e2 ) == ~maj );
+  CHECK( cache.get( e3 ) == f_and );
+  CHECK( cache.get( e4 ) == f_or );
+
+  kitty::static_truth_table<3> x1;
+  kitty::create_nth_var( x1, 1 );
+  CHECK( !cache.find( x1 ) );
+  CHECK( cache.find( f_or ) );
+  CHECK( cache.find( f_or )->index == e3.index );
+}
+
+TEST_CASE( "complement normalizing truth table cache", "[concurrent_truth_table_cache]" )
+{
+  concurrent_truth_table_cache<kitty::dynamic_truth_table, complement_normalization, 4u> cache( 10u );
+
+  for ( auto i = 0u; i < 256u; ++i )
+  {
+    kitty::dynamic_truth_table tt( 3u );
+    kitty::create_from_words( tt, &i, &i + 1 );
+    const auto e = cache.insert( tt );
+    CHECK( cache.get( e ) == tt );
+  }
+  CHECK( cache.size() == 128u );
+}
+
+TEST_CASE( "concurrent insertion into truth table cache", "[concurrent_truth_table_cache]" )
+{
+  concurrent_truth_table_cache<kitty::static_truth_table<4>> cache;
+
+  std::atomic<bool> valid{true};
+  std::vector<std::thread> threads;
+  for ( auto t = 0u; t < 4u; ++t )
+  {
+    threads.emplace_back( [&cache, &valid, t]() {
+      for ( auto i = t; i < 65536u; i += 4u )
+      {
+        kitty::static_truth_table<4> tt;
+        kitty::create_from_words( tt, &i, &i + 1 );
+        const auto e = cache.insert( tt );
+        if ( cache.get( e ) != tt )
+        {
+          valid = false;
+        }
+      }
+    } );
+  }
+  for ( auto& t : threads )
+  {
+    t.join();
+  }
+
+  CHECK( valid );
+
+  /* there are 222 NPN classes of 4-input functions */
+  CHECK( cache.size() == 222u );
+}
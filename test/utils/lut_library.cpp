@@ -0,0 +1,64 @@
+#include <catch.hpp>
+
+#include <sstream>
+
+#include <mockturtle/utils/lut_library.hpp>
+
+using namespace mockturtle;
+
+TEST_CASE( "default LUT library", "[lut_library]" )
+{
+  lut_library lib;
+
+  CHECK( lib.max_lut_size() == 6u );
+  CHECK( lib.is_unit() );
+  CHECK( lib.area( 1u ) == 0.0f );
+  CHECK( lib.area( 4u ) == 1.0f );
+  CHECK( lib.delay( 6u ) == 1u );
+
+  std::vector<uint32_t> arrivals{2u, 5u, 3u};
+  CHECK( lib.arrival( arrivals ) == 6u );
+}
+
+TEST_CASE( "read LUT library from text", "[lut_library]" )
+{
+  std::istringstream in( "# size area delay [pin delays]\n"
+                         "1 1.0 1\n"
+                         "2 1.0 1\n"
+                         "\n"
+                         "3 1.5 2 # comment\n"
+                         "4 2.5 3 1 1 2 3\n" );
+
+  const auto lib = read_lut_library( in );
+  CHECK( lib );
+  CHECK( lib->max_lut_size() == 4u );
+  CHECK( !lib->is_unit() );
+  CHECK( lib->area( 3u ) == 1.5f );
+  CHECK( lib->delay( 3u ) == 2u );
+  CHECK( lib->entry( 4u ).pin_delays == std::vector<uint32_t>{1u, 1u, 2u, 3u} );
+
+  /* latest input uses fastest pin */
+  std::vector<uint32_t> arrivals{0u, 4u, 1u, 0u};
+  CHECK( lib->arrival( arrivals ) == 5u );
+
+  std::vector<uint32_t> arrivals3{0u, 4u, 1u};
+  CHECK( lib->arrival( arrivals3 ) == 6u );
+}
+
+TEST_CASE( "read invalid LUT libraries", "[lut_library]" )
+{
+  std::istringstream gap( "1 1 1\n3 1 1\n" );
+  CHECK( !read_lut_library( gap ) );
+
+  std::istringstream pins( "1 1 1\n2 1 1 1\n" );
+  CHECK( !read_lut_library( pins ) );
+
+  std::istringstream unsorted( "1 1 1\n2 1 1 2 1\n" );
+  CHECK( !read_lut_library( unsorted ) );
+
+  std::istringstream garbage( "1 1 1 x\n" );
+  CHECK( !read_lut_library( garbage ) );
+
+  std::istringstream empty( "# nothing\n" );
+  CHECK( !read_lut_library( empty ) );
+}
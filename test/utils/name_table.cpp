@@ -0,0 +1,121 @@
+#include <catch.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <mockturtle/utils/name_table.hpp>
+
+using namespace mockturtle;
+
+TEST_CASE( "intern names in name table", "[name_table]" )
+{
+  name_table names;
+
+  const auto a = names.insert( "a" );
+  const auto b = names.insert( "top/core/b" );
+  const auto empty = names.insert( "" );
+
+  CHECK( a == 0u );
+  CHECK( b == 1u );
+  CHECK( empty == 2u );
+  CHECK( names.size() == 3u );
+
+  CHECK( names.insert( "a" ) == a );
+  CHECK( names.insert( std::string( "top/core/b" ) ) == b );
+  CHECK( names.size() == 3u );
+
+  CHECK( names.find( "a" ) == a );
+  CHECK( names.find( "" ) == empty );
+  CHECK( names.find( "top/core" ) == name_table::invalid_id );
+
+  CHECK( names.str( a ) == "a" );
+  CHECK( names.str( b ) == "top/core/b" );
+  CHECK( names.leaf( b ) == "top/core/b" );
+  CHECK( names.prefix( b ) == name_table::invalid_id );
+  CHECK( names.equals( b, "top/core/b" ) );
+  CHECK( !names.equals( b, "top/core/c" ) );
+}
+
+TEST_CASE( "intern many names in name table", "[name_table]" )
+{
+  name_table names;
+
+  /* long names are stored outside of the blocks */
+  const std::string long_name( 100000u, 'x' );
+  const auto long_id = names.insert( long_name );
+
+  std::vector<uint32_t> ids;
+  for ( auto i = 0u; i < 100000u; ++i )
+  {
+    ids.push_back( names.insert( "n" + std::to_string( i ) ) );
+  }
+
+  CHECK( names.size() == 100001u );
+  CHECK( names.str( long_id ) == long_name );
+  for ( auto i = 0u; i < 100000u; ++i )
+  {
+    CHECK( names.find( "n" + std::to_string( i ) ) == ids[i] );
+    CHECK( names.str( ids[i] ) == "n" + std::to_string( i ) );
+  }
+}
+
+TEST_CASE( "compress prefixes of hierarchical names in name table", "[name_table]" )
+{
+  name_table names( true, '.' );
+  CHECK( names.compress_prefixes() );
+
+  const auto a = names.insert( "top.core.alu.a" );
+  const auto b = names.insert( "top.core.alu.b" );
+  const auto c = names.insert( "top.core.c" );
+  const auto d = names.insert( ".d" );
+
+  /* top, top.core, top.core.alu, a, b, c, the empty prefix, and d */
+  CHECK( names.size() == 8u );
+
+  CHECK( names.str( a ) == "top.core.alu.a" );
+  CHECK( names.str( b ) == "top.core.alu.b" );
+  CHECK( names.str( c ) == "top.core.c" );
+  CHECK( names.str( d ) == ".d" );
+  CHECK( names.leaf( a ) == "a" );
+  CHECK( names.prefix( a ) == names.prefix( b ) );
+  CHECK( names.str( names.prefix( a ) ) == "top.core.alu" );
+  CHECK( names.prefix( names.prefix( a ) ) == names.prefix( c ) );
+
+  CHECK( names.find( "top.core.alu.b" ) == b );
+  CHECK( names.find( "top.core" ) == names.prefix( c ) );
+  CHECK( names.find( "top.core.alu.c" ) == name_table::invalid_id );
+  CHECK( names.find( "top.mem.c" ) == name_table::invalid_id );
+  CHECK( names.insert( "top.core.c" ) == c );
+
+  CHECK( names.equals( a, "top.core.alu.a" ) );
+  CHECK( !names.equals( a, "top.core.alua" ) );
+  CHECK( !names.equals( a, "top.core.alu.b" ) );
+  CHECK( !names.equals( a, "alu.a" ) );
+  CHECK( names.equals( d, ".d" ) );
+}
+
+TEST_CASE( "copy name table", "[name_table]" )
+{
+  name_table names( true, '/' );
+  const auto a = names.insert( "top/core/a" );
+  const auto b = names.insert( "b" );
+
+  name_table copy( names );
+  CHECK( copy.size() == names.size() );
+  CHECK( copy.str( a ) == "top/core/a" );
+  CHECK( copy.str( b ) == "b" );
+  CHECK( copy.prefix( a ) == names.prefix( a ) );
+  CHECK( copy.find( "top/core/a" ) == a );
+
+  /* the tables are independent */
+  const auto c = copy.insert( "top/core/c" );
+  CHECK( names.find( "top/core/c" ) == name_table::invalid_id );
+  CHECK( names.insert( "d" ) == c );
+  CHECK( copy.str( c ) == "top/core/c" );
+
+  names = copy;
+  CHECK( names.size() == copy.size() );
+  CHECK( names.str( c ) == "top/core/c" );
+  CHECK( names.find( "d" ) == name_table::invalid_id );
+}
@@ -0,0 +1,43 @@
+#include <catch.hpp>
+
+#include <mockturtle/utils/npn4_classes.hpp>
+#include <kitty/constructors.hpp>
+#include <kitty/npn.hpp>
+#include <kitty/operations.hpp>
+#include <kitty/operators.hpp>
+#include <kitty/static_truth_table.hpp>
+
+using namespace mockturtle;
+
+TEST_CASE( "NPN classes of 4-input functions", "[npn4_classes]" )
+{
+  auto const& classes = npn4_classes::get();
+  CHECK( classes.num_classes() == 222u );
+  CHECK( &classes == &npn4_classes::get() );
+
+  kitty::static_truth_table<4u> tt;
+  do
+  {
+    const auto config = classes.canonization( tt );
+    CHECK( config == kitty::exact_npn_canonization( tt ) );
+    CHECK( kitty::create_from_npn_config( config ) == tt );
+    CHECK( classes.representative( classes.class_index( tt ) ) == std::get<0>( config ) );
+
+    kitty::next_inplace( tt );
+  } while ( !kitty::is_const0( tt ) );
+}
+
+TEST_CASE( "NPN class indexes of 4-input functions", "[npn4_classes]" )
+{
+  auto const& classes = npn4_classes::get();
+
+  kitty::static_truth_table<4u> maj, tt;
+  kitty::create_from_hex_string( maj, "e8e8" );
+  tt = kitty::swap( maj, 0u, 3u );
+  CHECK( classes.class_index( tt ) == classes.class_index( maj ) );
+  CHECK( classes.class_index( ~tt ) == classes.class_index( maj ) );
+  CHECK( classes.class_index( kitty::flip( tt, 1u ) ) == classes.class_index( maj ) );
+
+  kitty::create_from_hex_string( tt, "6996" );
+  CHECK( classes.class_index( tt ) != classes.class_index( maj ) );
+}
@@ -0,0 +1,41 @@
+#include <catch.hpp>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+#include <mockturtle/utils/output_buffer.hpp>
+
+using namespace mockturtle;
+
+TEST_CASE( "format strings and integers into output buffer", "[output_buffer]" )
+{
+  std::ostringstream os;
+  {
+    output_buffer out( os );
+    out << "n" << 42u << ' ' << int32_t( -7 ) << ' ' << uint64_t( 18446744073709551615ull ) << ' ' << int64_t( INT64_MIN ) << ' ' << 0;
+    CHECK( os.str().empty() );
+  }
+  CHECK( os.str() == "n42 -7 18446744073709551615 -9223372036854775808 0" );
+}
+
+TEST_CASE( "flush output buffer when it is full", "[output_buffer]" )
+{
+  std::ostringstream os;
+  std::string expected;
+
+  output_buffer out( os, 8u );
+  for ( auto i = 0u; i < 100u; ++i )
+  {
+    out << "x" << i << ";";
+    expected += "x" + std::to_string( i ) + ";";
+  }
+
+  /* strings that are larger than the buffer are written directly */
+  const std::string large( 20u, 'a' );
+  out << large;
+  expected += large;
+
+  out.flush();
+  CHECK( os.str() == expected );
+}
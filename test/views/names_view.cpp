@@ -1,6 +1,8 @@
 #include <catch.hpp>
 
 #include <set>
+#include <string>
+#include <thread>
 
 #include <mockturtle/traits.hpp>
 #include <mockturtle/networks/aig.hpp>
@@ -99,3 +101,41 @@ TEST_CASE( "copy names", "[names_view]" )
   test_copy_names_view<xmg_network>();
   test_copy_names_view<klut_network>();
 }
+
+TEST_CASE( "copies of names views have their own name table", "[names_view]" )
+{
+  names_view<aig_network> named_ntk;
+  auto const a = named_ntk.create_pi();
+  auto const b = named_ntk.create_pi();
+  named_ntk.create_po( named_ntk.create_and( a, b ) );
+  named_ntk.set_name( a, "a" );
+  named_ntk.set_output_name( 0, "f" );
+
+  names_view<aig_network> copy1 = named_ntk;
+  names_view<aig_network> copy2 = named_ntk;
+  CHECK( copy1.get_name_table() != named_ntk.get_name_table() );
+  CHECK( copy1.get_name_table() != copy2.get_name_table() );
+  CHECK( copy1.get_name( a ) == "a" );
+  CHECK( copy1.get_output_name( 0 ) == "f" );
+
+  /* copies can be renamed concurrently */
+  std::thread t1( [&]() {
+    for ( auto i = 0u; i < 1000u; ++i )
+    {
+      copy1.set_name( b, "x" + std::to_string( i ) );
+    }
+  } );
+  std::thread t2( [&]() {
+    for ( auto i = 0u; i < 1000u; ++i )
+    {
+      copy2.set_name( b, "y" + std::to_string( i ) );
+    }
+  } );
+  t1.join();
+  t2.join();
+
+  CHECK( copy1.get_name( b ) == "x999" );
+  CHECK( copy2.get_name( b ) == "y999" );
+  CHECK( !named_ntk.has_name( b ) );
+  CHECK( named_ntk.get_name_table()->size() == 2u );
+}